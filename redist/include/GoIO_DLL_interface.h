@@ -91,6 +91,14 @@ typedef float gtype_real32;
 #endif
 
 typedef void *GOIO_SENSOR_HANDLE;
+typedef void *GOIO_STREAM_HANDLE;
+typedef void *GOIO_CONSUMER_HANDLE;
+
+typedef void (*GOIO_MEASUREMENT_CALLBACK)(
+	GOIO_SENSOR_HANDLE hSensor,				//[in] handle to the sensor that took the measurements.
+	void *pContext,							//[in] pContext value passed to GoIO_Sensor_SetMeasurementCallback().
+	const gtype_int32 *pMeasurements,		//[in] raw measurements, oldest first.
+	gtype_int32 numMeasurements);			//[in] # of measurements in pMeasurements.
 
 #ifdef TARGET_OS_LINUX
 #define SKIP_TIMEOUT_MS_DEFAULT 1000
@@ -129,6 +137,76 @@ GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Init();
 ****************************************************************************************************************************/
 GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Uninit();
 
+/***************************************************************************************************************************
+	Function Name: GoIO_SetDaemonSocketPath()
+	
+	Purpose:	Make the following GoIO_Init() connect to the goiod daemon listening on the Unix domain socket at pPath, 
+				instead of opening USB devices itself. goiod owns the devices, so any number of processes can use the 
+				same sensor at once: each one opens it with GoIO_Sensor_Open() as usual, and the daemon only opens the 
+				device for the first of them. The daemon publishes the measurements to shared memory(see 
+				GoIO_Sensor_StartPublishing()), and every client reads them from there with its own read position, so 
+				measurements never pass through the socket and clients do not slow each other down. Commands from all
+				the clients of a device are queued by the daemon and sent to it one at a time.
+
+				The following routines are supported through the daemon: GoIO_UpdateListOfAvailableDevices(),
+				GoIO_GetNthAvailableDeviceName(), GoIO_Sensor_Open(), GoIO_Sensor_Close(), GoIO_Sensor_GetOpenDeviceName(),
+				GoIO_Sensor_ClearIO(), GoIO_Sensor_SendCmdAndGetResponse(), GoIO_Sensor_GetMeasurementTickInSeconds(),
+				GoIO_Sensor_GetMinimumMeasurementPeriod(), GoIO_Sensor_GetMaximumMeasurementPeriod(),
+				GoIO_Sensor_SetMeasurementPeriod(), GoIO_Sensor_GetMeasurementPeriod(), 
+				GoIO_Sensor_GetNumMeasurementsAvailable(), GoIO_Sensor_ReadRawMeasurements(), 
+				GoIO_Sensor_GetLatestRawMeasurement(), GoIO_Sensor_ConvertToVoltage(), GoIO_Sensor_CalibrateData(),
+				GoIO_Sensor_GetProbeType() and GoIO_Sensor_DDSMem_GetRecord(). The other GoIO_Sensor_* routines fail.
+				GoIO_Stream_Open() works as usual. Measurement period and sensor DDS changes made by one client affect
+				all the clients of the device, and GoIO_Sensor_ClearIO() only discards the calling client's measurements.
+
+				If this is not called, GoIO_Init() uses the GOIO_DAEMON environment variable, if it is set, as the socket 
+				path. If it is empty, the socket is GOIO_DAEMON_SOCKET_NAME in $XDG_RUNTIME_DIR, or in 
+				GOIO_DAEMON_DEFAULT_SOCKET_DIR if XDG_RUNTIME_DIR is not set, which is also where goiod listens by 
+				default. Pass NULL to go back to opening devices directly.
+
+				goiod only accepts clients running as the same user as itself, as root, or in the group given with 
+				'goiod -g', and keeps its socket in a directory that other users cannot write to.
+
+				Currently only supported on Linux.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+#define GOIO_DAEMON_DEFAULT_SOCKET_DIR "/run/goiod"
+#define GOIO_DAEMON_SOCKET_NAME "goiod.socket"
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_SetDaemonSocketPath(
+	const char *pPath);//[in] NULL terminated path.
+
+/***************************************************************************************************************************
+	Function Name: GoIO_SetIOThreadPolicy()
+
+	Purpose:	Set the scheduling priority and the cpus used by the threads that GoIO creates to read from devices(one
+				per open sensor) and to write the binary log. Raising the priority of these threads, or giving them cpus
+				of their own, stops them from being starved of cpu time by busy app threads, which causes measurement
+				packets to be dropped.
+
+				The policy applies to threads that are already running as well as to threads created later. The
+				threads pick it up within a few milliseconds.
+
+				On Linux, GOIO_THREAD_PRIORITY_HIGH and GOIO_THREAD_PRIORITY_TIME_CRITICAL use the SCHED_FIFO real time
+				policy if the process is permitted to(it runs as root, has CAP_SYS_NICE, or has a nonzero RLIMIT_RTPRIO).
+				Otherwise, and for the lower priorities, nice levels are used. Nice levels below 0 also need CAP_SYS_NICE
+				or a suitable RLIMIT_NICE; without them the threads run at the highest priority that they are allowed.
+				
+				cpuMask is ignored on Mac OS X.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+#define GOIO_THREAD_PRIORITY_BELOW_NORMAL 0
+#define GOIO_THREAD_PRIORITY_NORMAL 1
+#define GOIO_THREAD_PRIORITY_ABOVE_NORMAL 2
+#define GOIO_THREAD_PRIORITY_HIGH 3
+#define GOIO_THREAD_PRIORITY_TIME_CRITICAL 4
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_SetIOThreadPolicy(
+	gtype_int32 priority,	//[in] GOIO_THREAD_PRIORITY_*. The default is GOIO_THREAD_PRIORITY_NORMAL.
+	gtype_uint64 cpuMask);	//[in] bit n set allows the threads to run on cpu n. 0(the default) allows any cpu.
+
 /***************************************************************************************************************************
 	Function Name: GoIO_Diags_SetDebugTraceThreshold()
 	
@@ -153,6 +231,314 @@ GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_SetDebugTraceThreshold(
 GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_GetDebugTraceThreshold(
 	gtype_int32 *pThreshold);//[out]
 
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_SetSimulatorConfig()
+	
+	Purpose:	Enable simulated Go! devices, so that applications and the lib itself can be exercised and load tested
+				without hardware. Simulated devices show up in GoIO_UpdateListOfAvailableDevices() alongside real ones, with
+				names of the form "sim:<product id>:<index>", and they support the full GoIO_Sensor_* API. They speak the
+				same packet protocol as real devices, so everything above the USB transport runs unchanged.
+
+				pConfig is a comma separated list of key=value pairs:
+					golink=N, gotemp=N, gomotion=N, minigc=N	number of simulated devices of each type.
+					period_us=N		override the measurement period requested by the app(0 => honour it).
+					fill=N			measurements per packet, 1 to 3(0 => choose from the period like Go! Link does).
+					loss=N			drop packets out of every N generated(0 => no loss).
+					burst=N			number of consecutive packets dropped each time(default 1).
+					sensor_id=N		sensor id reported by simulated Go! Links and Mini GCs(default 20, a smart sensor).
+				Keys that are left out take their default values, so an empty string disables the simulator.
+				Raw measurements ramp up by one per measurement, so consumers can check ordering and detect lost packets.
+
+				GoIO_Init() applies the GOIO_SIMULATOR environment variable, if it is set, in the same format.
+				Call this before GoIO_UpdateListOfAvailableDevices(). Sensors that are already open are not affected.
+
+				Currently only supported on Linux.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_SetSimulatorConfig(
+	const char *pConfig);//[in] NULL terminated config string.
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_SetPacketCapturePrefix()
+	
+	Purpose:	Record the raw 8 byte packets exchanged with each Go! device, with host time stamps, so that field
+				problems can be reproduced offline with GoIO_Diags_SetReplayConfig().
+
+				Every sensor opened while a non-empty prefix is set records to a file named
+				"<pPrefix>-<product id>-<n>.gcap", where n counts the capture files created by this process.
+				Recording starts when the sensor is opened and stops when it is closed, so the capture includes
+				the commands that GoIO_Sensor_Open() sends. Existing files with the same name are overwritten.
+				Pass NULL or an empty string to disable capture for sensors opened afterwards.
+
+				GoIO_Init() applies the GOIO_CAPTURE environment variable, if it is set.
+
+				Currently only supported on Linux.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_SetPacketCapturePrefix(
+	const char *pPrefix);//[in] NULL terminated path prefix, e.g. "/tmp/golink_session".
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_SetReplayConfig()
+	
+	Purpose:	Replay packet capture files recorded with GoIO_Diags_SetPacketCapturePrefix(). Each capture file shows up
+				in GoIO_UpdateListOfAvailableDevices() as a device of the captured type, named "replay:<product id>:<index>",
+				and packets from the file are fed to the lib as if they were being read from the device.
+
+				pConfig is a comma separated list of key=value pairs:
+					speed=X			playback speed relative to the original timing, e.g. 1, 10 or 0.5(default 1).
+									0 delivers packets as fast as the lib's queues accept them.
+					file=PATH		capture file to replay. Repeat the key to replay several files at once.
+									PATH may not contain commas.
+				An empty string disables replay.
+
+				Commands in the capture act as gates: replay does not move past a captured command until the app
+				sends a command of its own, and the timing restarts from that point. So the app should issue the same
+				sequence of GoIO calls as the captured session did, starting from GoIO_Sensor_Open().
+
+				GoIO_Init() applies the GOIO_REPLAY environment variable, if it is set, in the same format.
+				Call this before GoIO_UpdateListOfAvailableDevices(). Sensors that are already open are not affected.
+
+				Currently only supported on Linux.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_SetReplayConfig(
+	const char *pConfig);//[in] NULL terminated config string.
+
+typedef struct
+{
+	gtype_real64 portOpenSeconds;		//creating the device object and opening the USB port.
+	gtype_real64 initSeconds;			//SKIP_CMD_ID_INIT, and flushing stale measurements.
+	gtype_real64 flashReadSeconds;		//reading the Go! Link or Mini GC flash memory calibration record.
+	gtype_real64 sensorIdSeconds;		//SKIP_CMD_ID_GET_SENSOR_ID.
+	gtype_real64 ddsReadSeconds;		//reading and validating the sensor DDS memory.
+	gtype_real64 channelSetupSeconds;	//SKIP_CMD_ID_SET_ANALOG_INPUT_CHANNEL.
+	gtype_real64 totalSeconds;			//all of GoIO_Sensor_Open().
+} GoIOSensorOpenTimings;
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_GetSensorOpenTimings()
+
+	Purpose:	Report how long each phase of GoIO_Sensor_Open() took for hSensor. This is mainly useful for tracking down
+				slow startup with many devices attached, and for benchmarking the lib between releases.
+
+				Phases that do not apply to the device type, e.g. flashReadSeconds for a Go! Temp, are set to 0.
+				The phase times add up to a little less than totalSeconds, because validating the request
+				and registering the new sensor are not counted in any phase.
+
+	Return:		0 if hSensor is valid, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_GetSensorOpenTimings(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
+	GoIOSensorOpenTimings *pTimings);//[out]
+
+#define GOIO_CMD_LATENCY_NUM_BUCKETS 24
+
+typedef struct
+{
+	gtype_int32 numCmds;			//# of times the cmd was sent with GoIO_Sensor_SendCmdAndGetResponse().
+	gtype_int32 numTimeouts;		//# of times no complete response arrived in time.
+	gtype_int32 numErrors;			//# of times the device reported an error, or the response did not match the cmd.
+	gtype_int32 numRetries;			//# of extra copies of the cmd sent, e.g. SKIP_CMD_ID_INIT while a Go! Link powers up.
+	gtype_int32 firstPacketHistogram[GOIO_CMD_LATENCY_NUM_BUCKETS];
+	gtype_int32 completeHistogram[GOIO_CMD_LATENCY_NUM_BUCKETS];
+} GoIOCmdLatencyStats;
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_GetCmdLatencyStats()
+
+	Purpose:	Retrieve latency statistics for one command id, accumulated over all the GoIO_Sensor_SendCmdAndGetResponse()
+				calls for hSensor, including the ones the lib makes internally, e.g. in GoIO_Sensor_Open(). This is meant 
+				for tracking down sporadic slow responses, which GoIO_Sensor_GetLastCmdResponseStatus() cannot show.
+
+				Two latencies are recorded for each command, and each is counted in a histogram with logarithmic buckets:
+				histogram bucket k counts latencies from 2^k to 2^(k+1) - 1 microseconds, except that bucket 0 also 
+				counts anything faster, and bucket GOIO_CMD_LATENCY_NUM_BUCKETS - 1 counts anything slower.
+					firstPacketHistogram	cmd sent -> first response packet read by the lib.
+					completeHistogram		cmd first sent -> complete response, including any retries.
+				Commands that time out are counted in numTimeouts rather than completeHistogram.
+
+				Recording only costs a few atomic increments, and this routine does not lock the sensor, so it may be 
+				called from any thread, even while the owning thread is stuck waiting for a response.
+
+	Return:		0 if successful, else -1(invalid hSensor or cmd out of range).
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_GetCmdLatencyStats(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
+	unsigned char cmd,				//[in] command code. See SKIP_CMD_ID_* in GSkipCommExt.h.
+	GoIOCmdLatencyStats *pStats);//[out]
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_ResetCmdLatencyStats()
+
+	Purpose:	Zero the statistics reported by GoIO_Diags_GetCmdLatencyStats() for all command ids on hSensor.
+				Like GoIO_Diags_GetCmdLatencyStats(), this does not lock the sensor.
+
+	Return:		0 if successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_ResetCmdLatencyStats(
+	GOIO_SENSOR_HANDLE hSensor);//[in] handle to open sensor.
+
+typedef struct
+{
+	gtype_uint64 measurementPacketsReceived;
+	gtype_uint64 cmdRespPacketsReceived;
+	gtype_uint64 initRespPacketsReceived;
+	gtype_uint64 packetsDropped;
+	gtype_uint64 rollingCounterGaps;
+	gtype_uint64 transferErrors;
+	gtype_uint64 transferTimeouts;
+	gtype_uint64 bytesWritten;
+	gtype_uint32 queueHighWaterMark;
+	gtype_uint32 consumerLagMeasurements;
+	gtype_uint32 consumerLagMs;
+	gtype_uint32 numSensors;
+	gtype_uint64 queueOverflows;
+	gtype_uint64 producerBlockedMs;
+	gtype_uint64 packetsSpilled;
+	gtype_uint64 spillErrors;
+} GoIOCounters;
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_GetCounters()
+
+	Purpose:	Retrieve the I/O counters for hSensor. The counters are always on, and cost an increment or two per packet,
+				so they can be polled in production to spot flaky cables, overloaded hosts and apps that fall behind.
+
+					measurementPacketsReceived	measurement packets read from the device.
+					cmdRespPacketsReceived		command response packets read, including initRespPacketsReceived.
+					initRespPacketsReceived		responses to SKIP_CMD_ID_INIT.
+					packetsDropped				packets discarded because the lib's queue was full when they arrived.
+					rollingCounterGaps			measurement packets whose rolling counter did not follow on from the 
+												previous packet, i.e. the device or the USB stack lost packets.
+					transferErrors				failed USB reads and writes, including transferTimeouts.
+					transferTimeouts			USB writes that timed out.
+					bytesWritten				command bytes written to the device.
+					queueHighWaterMark			most measurements ever waiting in the measurement queue.
+					consumerLagMeasurements		measurements waiting in the queue right now.
+					consumerLagMs				ms since the app last read measurements, or 0 if none are waiting.
+					numSensors					1.
+					queueOverflows				measurement packets that arrived while the measurement queue was
+												full. See GoIO_SetMeasurementQueueConfig().
+					producerBlockedMs			total ms spent waiting for the app to make space in the measurement
+												queue, see GOIO_QUEUE_OVERFLOW_BLOCK_PRODUCER.
+					packetsSpilled				measurement packets written to the spill file. 
+												See GoIO_Sensor_SetMeasurementSpillFile().
+					spillErrors					measurement packets lost because the spill file could not be written.
+
+				Like GoIO_Diags_GetCmdLatencyStats(), this does not lock the sensor, so it may be called from any thread.
+				The counters are read without synchronization, so counters that are related may be off by a packet.
+
+	Return:		0 if hSensor is valid, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_GetCounters(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
+	GoIOCounters *pCounters);//[out]
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_GetAggregateCounters()
+
+	Purpose:	Add up the GoIO_Diags_GetCounters() counters for all the sensors opened since GoIO_Init(), including 
+				ones that have been closed. queueHighWaterMark and consumerLagMs are the largest values of any open
+				sensor, consumerLagMeasurements is summed over open sensors, and numSensors is the number of open sensors.
+
+	Return:		0 if successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_GetAggregateCounters(
+	GoIOCounters *pCounters);//[out]
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_OpenBinaryLog()
+
+	Purpose:	Start recording lib events, e.g. commands sent, errors and (at GOIO_TRACE_SEVERITY_LOWEST) every packet 
+				received, to a compact binary log file. Use the GoIO_LogDecode tool to convert the file to text.
+
+				Unlike the debug trace output controlled by GoIO_Diags_SetDebugTraceThreshold(), events are not
+				formatted when they are recorded. Each thread copies its events into its own ring buffer, and a 
+				background thread writes them to the file, so logging costs well under a microsecond per event
+				and never waits on disk I/O. If the background thread falls behind, events are discarded and the
+				number discarded is recorded in the log.
+
+				Opening a log closes any log that is already open. On Linux, GoIO_Init() opens a log with 
+				threshold GOIO_TRACE_SEVERITY_LOW if the GOIO_BINLOG environment variable names the file.
+
+	Return:		0 if the file was created, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_OpenBinaryLog(
+	const char *pFileName,	//[in] NULL terminated file name.
+	gtype_int32 threshold);//[in] Only events with a severity >= threshold are recorded.
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_CloseBinaryLog()
+
+	Purpose:	Stop recording events, write out any that are still queued, and close the file opened by
+				GoIO_Diags_OpenBinaryLog(). GoIO_Uninit() calls this.
+
+	Return:		0.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_CloseBinaryLog();
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_StartTimeline()
+
+	Purpose:	Start recording a timeline of what the lib is doing, for viewing in chrome://tracing or 
+				https://ui.perfetto.dev. Spans are recorded for the GoIO_Sensor_*() calls that talk to devices, 
+				SendCmdAndGetResponse(), packet reads and queueing on the listener threads, and(on Linux) waits for
+				locks. The depth of each measurement queue is recorded as a counter.
+
+				Each thread records into its own ring of eventsPerThread events, so the timeline holds the most 
+				recent events and recording never blocks. When the timeline is not running, the cost is one test
+				of a flag per instrumented call. Call GoIO_Diags_WriteTimeline() to save the events.
+
+				Restarting the timeline discards the events already recorded. On Linux, GoIO_Init() starts the
+				timeline if the GOIO_TIMELINE environment variable names a file, and GoIO_Uninit() writes it.
+
+	Return:		0 if successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_StartTimeline(
+	gtype_int32 eventsPerThread);//[in] ring size, 0 for the default(16384 events).
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_StopTimeline()
+
+	Purpose:	Stop recording the timeline started by GoIO_Diags_StartTimeline(). The events already recorded 
+				are kept until the timeline is restarted.
+
+	Return:		0.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_StopTimeline();
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_WriteTimeline()
+
+	Purpose:	Write the recorded timeline to a file in the Chrome trace event JSON format. Timestamps are in
+				microseconds since GoIO_Diags_StartTimeline(). Events carry the device they relate to(0 if none)
+				as args.device. Counters are named "<counter> <device>".
+
+				This may be called while the timeline is running, but then the oldest events of each thread are
+				left out, since they may be being overwritten.
+
+	Return:		0 if the file was written, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_WriteTimeline(
+	const char *pFileName);	//[in] NULL terminated file name.
+
 /***************************************************************************************************************************
 	Function Name: GoIO_GetDLLVersion()
 		Added in version 2.00.
@@ -547,10 +933,12 @@ GOIO_DLL_INTERFACE_DECL gtype_real64 GoIO_Sensor_GetMeasurementPeriod(
 				often enough so that the GoIO_Sensor_GetNumMeasurementsAvailable() does not reach 1200.
 				On the other hand, we reserve the right to make the Measurement Buffer > 1200 measurements, so
 				do not assume that you can empty the buffer simply by reading in 1200 measurements.
+				The size of the buffer, and what happens when it is full, can be changed on Linux with
+				GoIO_SetMeasurementQueueConfig() and GoIO_Sensor_SetMeasurementQueueConfig().
 
 				Each of the following actions clears the GoIO Measurement Buffer:
 					1) Call GoIO_Sensor_ReadRawMeasurements() with count set to GoIO_Sensor_GetNumMeasurementsAvailable(), or
-					2) Call GoIO_Sensor_GetLatestRawMeasurement(), or
+					2) Call GoIO_Sensor_GetLatestRawMeasurementEx() with drainBuffer set, or
 					3) Call GoIO_Sensor_ClearIO().
 
 				The GoIO Measurement Buffer is empty after GoIO_Sensor_Open() is called. It does not
@@ -566,6 +954,508 @@ GOIO_DLL_INTERFACE_DECL gtype_real64 GoIO_Sensor_GetMeasurementPeriod(
 GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetNumMeasurementsAvailable(
 	GOIO_SENSOR_HANDLE hSensor);//[in] handle to open sensor.
 
+/***************************************************************************************************************************
+	Function Name: GoIO_SetMeasurementQueueConfig()
+	
+	Purpose:	Configure the GoIO Measurement Buffer of a sensor before it is opened. The config is applied by
+				GoIO_Sensor_Open() when pDeviceName is opened. If pDeviceName is NULL, the config becomes the default
+				for devices that have not been given a config of their own. Configs are forgotten by GoIO_Init().
+				Use GoIO_Sensor_SetMeasurementQueueConfig() to change the config of a sensor that is already open.
+
+				capacity is in packets. Each packet holds 1 to 3 measurements. The default is 1999.
+
+				overflowPolicy decides what happens to a packet that arrives when the buffer is full:
+					GOIO_QUEUE_OVERFLOW_DROP_OLDEST		discard the oldest packet in the buffer. This is the default.
+					GOIO_QUEUE_OVERFLOW_DROP_NEWEST		discard the new packet.
+					GOIO_QUEUE_OVERFLOW_BLOCK_PRODUCER	stop reading from the device for up to blockTimeoutMs to give the
+														app time to make space, then discard the new packet. While the
+														device is not being read, packets back up in the USB stack, which
+														may drop them. The wait is skipped while a command is waiting for
+														its response, and after a wait times out until the app next reads.
+				Each full buffer event is counted in queueOverflows by GoIO_Diags_GetCounters(), and each discarded packet
+				in packetsDropped.
+
+				Only Linux supports configuring the GoIO Measurement Buffer. On other platforms the config is rejected
+				when the sensor is opened, but the open still succeeds.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+#define GOIO_QUEUE_OVERFLOW_DROP_OLDEST 0
+#define GOIO_QUEUE_OVERFLOW_DROP_NEWEST 1
+#define GOIO_QUEUE_OVERFLOW_BLOCK_PRODUCER 2
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_SetMeasurementQueueConfig(
+	const char *pDeviceName,	//[in] NULL terminated string that uniquely identifies the device, or NULL for all devices.
+	gtype_int32 capacity,		//[in] in packets.
+	gtype_int32 overflowPolicy,	//[in] GOIO_QUEUE_OVERFLOW_*.
+	gtype_int32 blockTimeoutMs);	//[in] only used by GOIO_QUEUE_OVERFLOW_BLOCK_PRODUCER.
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_SetMeasurementQueueConfig()
+	
+	Purpose:	Change the capacity and overflow policy of the GoIO Measurement Buffer of an open sensor. This may be called 
+				while measurements are being collected. If the buffer shrinks, the newest measurements are kept.
+				See GoIO_SetMeasurementQueueConfig().
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_SetMeasurementQueueConfig(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	gtype_int32 capacity,		//[in] in packets.
+	gtype_int32 overflowPolicy,	//[in] GOIO_QUEUE_OVERFLOW_*.
+	gtype_int32 blockTimeoutMs);	//[in] only used by GOIO_QUEUE_OVERFLOW_BLOCK_PRODUCER.
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_GetMeasurementQueueConfig()
+	
+	Purpose:	Get the capacity and overflow policy of the GoIO Measurement Buffer of an open sensor.
+				See GoIO_SetMeasurementQueueConfig().
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetMeasurementQueueConfig(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
+	gtype_int32 *pCapacity,			//[out] in packets.
+	gtype_int32 *pOverflowPolicy,	//[out] GOIO_QUEUE_OVERFLOW_*.
+	gtype_int32 *pBlockTimeoutMs);	//[out]
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_SetMeasurementSpillFile()
+	
+	Purpose:	Let the GoIO Measurement Buffer overflow to disk, for long captures where the app may sometimes fall far
+				behind. Once highWatermark packets are waiting in the buffer, further packets are appended to pFileName
+				instead, until the app has read all of them. GoIO_Sensor_ReadRawMeasurements() returns the spilled 
+				measurements in order after the ones that were in memory, and GoIO_Sensor_GetNumMeasurementsAvailable()
+				counts them. So a slow app costs disk space rather than measurements.
+
+				The file is created(or overwritten) by this call, reused from the start whenever the app catches up, and 
+				deleted when the sensor is closed or spilling is stopped. Pass a NULL or empty pFileName to stop spilling. 
+				This fails while spilled measurements are still waiting to be read.
+
+				highWatermark is in packets, and is capped at the buffer capacity(see GoIO_SetMeasurementQueueConfig()).
+				Packets written to the file are counted in packetsSpilled by GoIO_Diags_GetCounters(), and packets lost
+				because the file could not be written in spillErrors.
+
+				Only Linux supports spilling.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_SetMeasurementSpillFile(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	const char *pFileName,		//[in] NULL terminated file name, or NULL to stop spilling.
+	gtype_int32 highWatermark);	//[in] in packets.
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Recorder_Start()
+	
+	Purpose:	Record every measurement that arrives from the sensor to pFileName, for captures that must be kept intact.
+				Measurements are still delivered to the GoIO Measurement Buffer(or the measurement callback) as usual.
+				The recording holds the raw measurements with their sample indices, host arrival times, the gaps where
+				measurements were lost on the way from the sensor, and the sensor's DDS record(including the calibration
+				pages), probe type, measurement period and voltage conversion. If the measurement period is changed
+				while recording, the new period is recorded too.
+
+				A background thread writes the file in large aligned blocks, and the listener thread only hands it a batch
+				of measurements every few hundred measurements or 250 milliseconds, so recording does not slow down 
+				acquisition. The file is written at least once a second, and every chunk in it is checksummed. The file 
+				layout is described in GSkipRecorder.h, and the GoIO_RecordingDump tool converts recordings to text.
+
+				The measurements are compressed(see GoIO_Recorder_StartEx()), which typically makes the file several
+				times smaller than the raw measurements.
+
+				The file is created(or overwritten) by this call. Only one recording per sensor may be in progress.
+				Call GoIO_Recorder_Stop() to finish the recording; closing the sensor also finishes it.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Recorder_Start(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	const char *pFileName);		//[in] NULL terminated file name.
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Recorder_StartEx()
+	
+	Purpose:	Same as GoIO_Recorder_Start(), but with options:
+
+				GOIO_RECORDER_OPTION_COMPRESS stores each batch of measurements as the first measurement followed by 
+				the zigzag encoded differences between neighbouring measurements, bit packed per frame of 64 at the width
+				of the largest difference in the frame. Slowly changing signals need only a few bits per measurement.
+
+				GOIO_RECORDER_OPTION_CALIBRATED also stores the calibrated value of every measurement, computed with the
+				calibration in the sensor's DDS record when the measurement was recorded. Each value is XORed with the 
+				previous one and only the bits that changed are stored, so repeated or slowly changing values take a 
+				few bits each. Implies GOIO_RECORDER_OPTION_COMPRESS.
+
+				Each batch is compressed on its own, so batches that are waiting for the background writer are 
+				compressed in parallel on a pool of threads, and readers can decompress them in parallel too.
+				Pass 0 for options to record the raw measurements uncompressed.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+#define GOIO_RECORDER_OPTION_COMPRESS 1
+#define GOIO_RECORDER_OPTION_CALIBRATED 2
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Recorder_StartEx(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	const char *pFileName,		//[in] NULL terminated file name.
+	gtype_int32 options);		//[in] GOIO_RECORDER_OPTION_* flags.
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Recorder_Stop()
+	
+	Purpose:	Write out the measurements still waiting to be recorded, end the recording started by GoIO_Recorder_Start(),
+				and close the file.
+
+	Return:		0 iff successful, else -1(e.g. if nothing was being recorded).
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Recorder_Stop(
+	GOIO_SENSOR_HANDLE hSensor);	//[in] handle to open sensor.
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Recorder_GetStats()
+	
+	Purpose:	Report on the recording started by GoIO_Recorder_Start(). samplesLost counts measurements that were 
+				discarded because the disk could not keep up. If writeFailed is set, the disk reported an error and
+				nothing further is being written.
+
+	Return:		0 iff successful, else -1(e.g. if nothing is being recorded).
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Recorder_GetStats(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
+	gtype_uint64 *pSamplesRecorded,	//[out] measurements handed to the background writer.
+	gtype_uint64 *pSamplesMissing,	//[out] measurements lost between the sensor and the computer.
+	gtype_uint64 *pSamplesLost,		//[out] measurements discarded by the recorder.
+	gtype_uint64 *pBytesWritten,	//[out]
+	gtype_bool *pWriteFailed);		//[out]
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_StartPublishing()
+	
+	Purpose:	Publish every measurement that arrives from the sensor to a ring in named shared memory, so that any number
+				of other processes(or other parts of this one) can follow the sensor with GoIO_Stream_Open(), without
+				going through the process that owns it. Measurements are still delivered to the GoIO Measurement Buffer
+				(or the measurement callback) as usual.
+
+				Each measurement is published as a GoIOStreamSample, with its sample index, host arrival time, raw 
+				value, voltage and calibrated value(computed with the calibration in the sensor's DDS record), so 
+				readers do not need access to the sensor. The ring holds the newest numSlots measurements. Publishing
+				costs the listener thread a few stores per measurement, no matter how many readers there are, and 
+				readers never slow it down: a reader that falls more than numSlots measurements behind loses the oldest
+				ones, and GoIO_Stream_GetStatus() reports how many.
+
+				Only one process may publish a given device. Call GoIO_Sensor_StopPublishing() to stop; closing the 
+				sensor also stops publishing.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+#define GOIO_STREAM_DEFAULT_NUM_SLOTS 65536
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_StartPublishing(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	gtype_int32 numSlots);		//[in] # of measurements the ring holds, rounded up to a power of 2. 
+								//0 means GOIO_STREAM_DEFAULT_NUM_SLOTS.
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_StopPublishing()
+	
+	Purpose:	Stop publishing the measurements from the sensor. Readers that are attached can still read the 
+				measurements that were published, and GoIO_Stream_GetStatus() tells them that publishing stopped.
+
+	Return:		0 iff successful, else -1(e.g. if nothing was being published).
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_StopPublishing(
+	GOIO_SENSOR_HANDLE hSensor);	//[in] handle to open sensor.
+
+typedef struct
+{
+	gtype_uint64 sampleIndex;		//counts measurement slots from 0 when publishing started, including lost measurements.
+	gtype_uint64 timeUs;			//host time stamp in microseconds when the measurement arrived. Comparable between
+									//processes on the same computer.
+	gtype_real64 calibrated;		//calibrated with the calibration in the sensor's DDS record.
+	gtype_int32 rawMeasurement;
+	gtype_real32 volts;
+} GoIOStreamSample;
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Stream_Open()
+	
+	Purpose:	Attach to the measurements that some process is publishing for pDeviceName with 
+				GoIO_Sensor_StartPublishing(). The device does not need to be opened in this process, and GoIO_Init() is
+				not required. Each stream handle has its own read position, which starts at the newest measurement, or 
+				at the oldest one still in the ring if fromOldest is set.
+
+				Reading is plain memory access, without system calls, so poll with GoIO_Stream_Read() as often as needed.
+				A stream handle may only be used by one thread at a time.
+
+	Return:		handle to the stream if successful, else NULL(e.g. if nothing is being published for pDeviceName).
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL GOIO_STREAM_HANDLE GoIO_Stream_Open(
+	const char *pDeviceName,	//[in] NULL terminated string that identifies the device, as passed to GoIO_Sensor_Open().
+	gtype_bool fromOldest);		//[in]
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Stream_Close()
+	
+	Purpose:	Detach from the stream, and invalidate hStream.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Stream_Close(
+	GOIO_STREAM_HANDLE hStream);	//[in] handle from GoIO_Stream_Open().
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Stream_Read()
+	
+	Purpose:	Copy up to maxCount measurements, oldest first, from the stream's read position, and advance it past them.
+
+	Return:		# of measurements copied, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Stream_Read(
+	GOIO_STREAM_HANDLE hStream,		//[in] handle from GoIO_Stream_Open().
+	GoIOStreamSample *pSamples,		//[out] buffer with room for maxCount samples.
+	gtype_int32 maxCount);			//[in]
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Stream_Peek()
+	
+	Purpose:	Zero copy alternative to GoIO_Stream_Read(): point (*ppSamples) at up to maxCount measurements in the 
+				shared memory, from the stream's read position on, without advancing it. Fewer than maxCount may be 
+				returned when the measurements wrap around the end of the ring, even if more are available.
+
+				Once done with them, call GoIO_Stream_Consume() with the # used. The publisher does not wait for readers,
+				so it may overwrite the oldest of them meanwhile if the reader is nearly a ring behind. 
+				GoIO_Stream_Consume() reports how many were overwritten, so the caller can discard what it got from them.
+
+	Return:		# of measurements at (*ppSamples), else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Stream_Peek(
+	GOIO_STREAM_HANDLE hStream,			//[in] handle from GoIO_Stream_Open().
+	const GoIOStreamSample **ppSamples,	//[out] read only.
+	gtype_int32 maxCount);				//[in]
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Stream_Consume()
+	
+	Purpose:	Advance the stream's read position past count measurements returned by GoIO_Stream_Peek().
+
+	Return:		# of the measurements, counting from the first one, that were overwritten before this call and must
+				be discarded(usually 0), else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Stream_Consume(
+	GOIO_STREAM_HANDLE hStream,	//[in] handle from GoIO_Stream_Open().
+	gtype_int32 count);			//[in]
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Stream_GetStatus()
+	
+	Purpose:	Report on the stream. isPublishing is cleared once the publisher stops. samplesLost counts measurements
+				that were overwritten before this handle read them. measurementPeriod applies from sample index
+				periodFirstSampleIndex on; it is 0.0 if the publisher did not know it.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Stream_GetStatus(
+	GOIO_STREAM_HANDLE hStream,			//[in] handle from GoIO_Stream_Open().
+	gtype_bool *pIsPublishing,			//[out]
+	gtype_int32 *pNumAvailable,			//[out] measurements after the read position.
+	gtype_uint64 *pSamplesLost,			//[out]
+	gtype_real64 *pMeasurementPeriod,	//[out] in seconds.
+	gtype_uint64 *pPeriodFirstSampleIndex);//[out]
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_AddConsumer()
+	
+	Purpose:	Register a consumer of the sensor's measurements within this process. GoIO_Sensor_ReadRawMeasurements() 
+				removes the measurements it returns, so only one part of an app can use it; consumers let several parts,
+				such as a logger and a live display, each see every measurement, at their own pace, with no need for one
+				of them to pass the measurements on to the others.
+
+				The measurements are kept once, in a ring of numSlots measurements per sensor shared by all its consumers,
+				and each consumer has its own read position in it, so a second consumer costs no extra copies. The ring
+				is created along with the first consumer. New consumers start at the newest measurement. Measurements are
+				still delivered to the GoIO Measurement Buffer(or the measurement callback) as usual.
+
+				policy says what happens when the consumer falls numSlots measurements behind:
+					GOIO_CONSUMER_POLICY_SKIP	the oldest measurements are overwritten, and the consumer loses them.
+					GOIO_CONSUMER_POLICY_BLOCK	GoIO waits for the consumer to read, so it does not lose any. No
+												measurements are read from the sensor meanwhile, so a blocking consumer
+												that falls behind slows the sensor down for everyone, and the sensor
+												drops measurements if it is held up for long. GoIO stops waiting for a 
+												consumer that has not read anything for a second, until it reads again.
+				GoIO_Consumer_GetStatus() reports the lag of the slowest consumer, so apps can see how close they are to
+				losing measurements or to holding up the sensor.
+
+				The GoIO_Consumer_* routines do not lock the sensor, so each consumer can be used on a thread of its own.
+				A consumer handle may only be used by one thread at a time. Consumers remain valid after the sensor is 
+				closed, and must be removed with GoIO_Consumer_Remove().
+
+	Return:		handle to the consumer if successful, else NULL.
+
+****************************************************************************************************************************/
+#define GOIO_CONSUMER_POLICY_SKIP 0
+#define GOIO_CONSUMER_POLICY_BLOCK 1
+#define GOIO_CONSUMER_DEFAULT_NUM_SLOTS 65536
+GOIO_DLL_INTERFACE_DECL GOIO_CONSUMER_HANDLE GoIO_Sensor_AddConsumer(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	gtype_int32 policy,			//[in] GOIO_CONSUMER_POLICY_*
+	gtype_int32 numSlots);		//[in] # of measurements the ring holds, rounded up to a power of 2(and to a whole
+								//number of memory pages if the ring is mapped twice). Only used by the first consumer
+								//of the sensor. 0 means GOIO_CONSUMER_DEFAULT_NUM_SLOTS.
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Consumer_Remove()
+	
+	Purpose:	Unregister a consumer, and invalidate hConsumer. A blocking consumer must be removed once it stops 
+				reading, or GoIO keeps waiting for it.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Consumer_Remove(
+	GOIO_CONSUMER_HANDLE hConsumer);	//[in] handle from GoIO_Sensor_AddConsumer().
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Consumer_ReadRawMeasurements()
+	
+	Purpose:	Copy up to maxCount measurements, oldest first, from the consumer's read position, and advance it past 
+				them. Other consumers still get the measurements. The raw measurements are the same as the ones from 
+				GoIO_Sensor_ReadRawMeasurements().
+
+	Return:		# of measurements copied, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Consumer_ReadRawMeasurements(
+	GOIO_CONSUMER_HANDLE hConsumer,	//[in] handle from GoIO_Sensor_AddConsumer().
+	gtype_int32 *pMeasurementsBuf,	//[out] buffer with room for maxCount measurements.
+	gtype_uint64 *pTimeStampsUs,	//[out] host time stamps in microseconds when the measurements arrived, may be NULL.
+	gtype_int32 maxCount);			//[in]
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Consumer_PeekRawMeasurements()
+	
+	Purpose:	Copy up to maxCount measurements, starting firstIndex measurements after the consumer's read position,
+				without advancing it, so the same measurements can be looked at again, or read later.
+
+	Return:		# of measurements copied, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Consumer_PeekRawMeasurements(
+	GOIO_CONSUMER_HANDLE hConsumer,	//[in] handle from GoIO_Sensor_AddConsumer().
+	gtype_int32 *pMeasurementsBuf,	//[out] buffer with room for maxCount measurements.
+	gtype_int32 firstIndex,			//[in] 0 => the measurement at the read position.
+	gtype_int32 maxCount);			//[in]
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Consumer_GetStatus()
+	
+	Purpose:	Report on the consumer, and on all the consumers of its sensor.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+typedef struct
+{
+	gtype_uint64 numLost;				//measurements that were overwritten before this consumer read them.
+	gtype_uint64 numWritten;			//measurements written to the ring since it was created, while it had consumers.
+	gtype_uint64 blockedUs;				//total time GoIO spent waiting for GOIO_CONSUMER_POLICY_BLOCK consumers.
+	gtype_uint64 numBlockTimeouts;		//# of times GoIO gave up waiting for a GOIO_CONSUMER_POLICY_BLOCK consumer.
+	gtype_int32 numAvailable;			//measurements after this consumer's read position.
+	gtype_int32 numConsumers;			//of the sensor.
+	gtype_uint32 slowestLag;			//# of measurements the slowest consumer of the sensor has yet to read.
+	gtype_uint32 maxSlowestLag;			//highest slowestLag seen so far.
+	gtype_int32 isSensorOpen;			//0 once the sensor has been closed.
+	gtype_int32 reserved;
+} GoIOConsumerStatus;
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Consumer_GetStatus(
+	GOIO_CONSUMER_HANDLE hConsumer,	//[in] handle from GoIO_Sensor_AddConsumer().
+	GoIOConsumerStatus *pStatus);	//[out]
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Consumer_BorrowMeasurements()
+	
+	Purpose:	Zero copy alternative to GoIO_Consumer_ReadRawMeasurements(): point (*ppMeasurements), and 
+				(*ppTimeStampsUs) if it is not NULL, at the measurements after the consumer's read position, where GoIO
+				keeps them, without copying them or advancing the read position. The pointers are read only, and stay
+				valid until the consumer is removed. Bindings can wrap them as arrays without a copy.
+
+				GoIO maps the ring twice back to back in memory where the OS allows, so all the available measurements
+				are returned, contiguously, even when they wrap around the end of the ring. Otherwise (*pCount) may be
+				less than the number available when they wrap; the rest are returned by the next call.
+
+				Once done with them, call GoIO_Consumer_ReleaseMeasurements() with the # used. GoIO does not overwrite
+				the borrowed measurements of a GOIO_CONSUMER_POLICY_BLOCK consumer, unless it gives up waiting for it. 
+				GoIO may overwrite the oldest of the borrowed measurements of a GOIO_CONSUMER_POLICY_SKIP consumer that 
+				is nearly a ring behind, and GoIO_Consumer_ReleaseMeasurements() reports how many, so the caller can 
+				discard what it got from them.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Consumer_BorrowMeasurements(
+	GOIO_CONSUMER_HANDLE hConsumer,			//[in] handle from GoIO_Sensor_AddConsumer().
+	const gtype_int32 **ppMeasurements,		//[out] read only, NULL if (*pCount) is 0.
+	gtype_int32 *pCount,					//[out] # of measurements at (*ppMeasurements).
+	const gtype_uint64 **ppTimeStampsUs);	//[out] host arrival times in microseconds, may be NULL.
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Consumer_ReleaseMeasurements()
+	
+	Purpose:	Advance the consumer's read position past count measurements returned by GoIO_Consumer_BorrowMeasurements().
+
+	Return:		# of the measurements, counting from the first one, that were overwritten before this call and must
+				be discarded(usually 0), else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Consumer_ReleaseMeasurements(
+	GOIO_CONSUMER_HANDLE hConsumer,	//[in] handle from GoIO_Sensor_AddConsumer().
+	gtype_int32 count);				//[in] at most the (*pCount) reported by GoIO_Consumer_BorrowMeasurements().
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_BorrowMeasurements()
+	
+	Purpose:	Same as GoIO_Consumer_BorrowMeasurements(), for callers that do not want to manage a consumer: the first
+				call adds a GOIO_CONSUMER_POLICY_SKIP consumer of GOIO_CONSUMER_DEFAULT_NUM_SLOTS for the sensor, which 
+				this routine and GoIO_Sensor_ReleaseMeasurements() then use until the sensor is closed. 
+
+				The consumer sees the measurements that arrive after the first call, so call this once before sending
+				SKIP_CMD_ID_START_MEASUREMENTS. Its measurements are separate from those in the GoIO Measurement Buffer: 
+				releasing them does not remove them from the GoIO Measurement Buffer, and vice versa.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_BorrowMeasurements(
+	GOIO_SENSOR_HANDLE hSensor,				//[in] handle to open sensor.
+	const gtype_int32 **ppMeasurements,		//[out] read only, NULL if (*pCount) is 0.
+	gtype_int32 *pCount,					//[out] # of measurements at (*ppMeasurements).
+	const gtype_uint64 **ppTimeStampsUs);	//[out] host arrival times in microseconds, may be NULL.
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_ReleaseMeasurements()
+	
+	Purpose:	Same as GoIO_Consumer_ReleaseMeasurements(), for measurements from GoIO_Sensor_BorrowMeasurements().
+
+	Return:		# of the measurements, counting from the first one, that were overwritten before this call and must
+				be discarded(usually 0), else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_ReleaseMeasurements(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	gtype_int32 count);			//[in] at most the (*pCount) reported by GoIO_Sensor_BorrowMeasurements().
+
 /***************************************************************************************************************************
 	Function Name: GoIO_Sensor_ReadRawMeasurements()
 	
@@ -613,8 +1503,9 @@ GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_ReadRawMeasurements(
 				measurements have been placed in the GoIO Measurement Buffer since it was
 				created byGoIO_Sensor_Open(), then report a value of 0. 
 				
-				This routine also empties the GoIO Measurement Buffer, so GoIO_Sensor_GetNumMeasurementsAvailable()
-				will report 0 after calling GoIO_Sensor_GetLatestRawMeasurement().
+				This routine leaves the GoIO Measurement Buffer untouched. The most recent measurement is recorded
+				as it arrives, so this routine is cheap enough to call as often as a display needs refreshing.
+				Call GoIO_Sensor_GetLatestRawMeasurementEx() to empty the GoIO Measurement Buffer as well.
 
 				After SKIP_CMD_ID_START_MEASUREMENTS has been sent to the sensor, the sensor starts
 				sending measurements to the host computer. These measurements are stored in the 
@@ -635,6 +1526,179 @@ GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_ReadRawMeasurements(
 GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetLatestRawMeasurement(
 	GOIO_SENSOR_HANDLE hSensor);//[in] handle to open sensor.
 
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_GetLatestRawMeasurementEx()
+	
+	Purpose:	Same as GoIO_Sensor_GetLatestRawMeasurement(), but also report when the most recent measurement arrived,
+				and optionally empty the GoIO Measurement Buffer.
+
+				The timestamp is the host's millisecond tick count at the moment the packet containing the measurement
+				was received. It wraps around, and only differences between timestamps are meaningful.
+
+				If drainBuffer is non zero, the GoIO Measurement Buffer is emptied, so GoIO_Sensor_GetNumMeasurementsAvailable()
+				will report 0 afterwards. This is what GoIO_Sensor_GetLatestRawMeasurement() did in older versions of GoIO.
+
+	Return:		0 if successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetLatestRawMeasurementEx(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
+	gtype_int32 *pMeasurement,		//[out] most recent measurement, 0 if none have arrived since GoIO_Sensor_Open().
+	gtype_uint32 *pTimeStampMs,		//[out] host time in milliseconds when the measurement arrived, may be NULL.
+	gtype_bool drainBuffer);		//[in] if non zero, empty the GoIO Measurement Buffer as well.
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_SetMeasurementCallback()
+	
+	Purpose:	Switch a sensor between queued mode and push mode.
+
+				By default, measurements are stored in the GoIO Measurement Buffer until the application retrieves
+				them with GoIO_Sensor_ReadRawMeasurements(). If pCallback is not NULL, the sensor is placed in push mode:
+				measurements are decoded as they arrive from the device and passed to pCallback in batches. 
+				They are not stored in the GoIO Measurement Buffer, so GoIO_Sensor_GetNumMeasurementsAvailable() stays at 0.
+				GoIO_Sensor_GetLatestRawMeasurement() still reports the most recent measurement.
+
+				pCallback is invoked on the internal thread that receives data from the device, not on the thread
+				that called GoIO_Sensor_SetMeasurementCallback(). Calls for a given sensor never overlap. Each call
+				receives a contiguous array of raw measurements in the order they were taken. The array is only valid
+				for the duration of the call.
+
+				A batch is delivered as soon as it holds at least minBatchSize measurements, or when its oldest
+				measurement is maxLatencyMs old, whichever comes first. The latency bound is approximate: it is checked
+				when packets arrive and when the receiving thread wakes up, typically every 20 to 100 milliseconds.
+				maxLatencyMs = 0 means no latency limit: a batch is only delivered once it holds minBatchSize 
+				measurements, or when the callback is replaced. minBatchSize = 1 delivers every packet immediately.
+
+				pCallback should return quickly. While it runs, no other measurements are received from the sensor.
+				pCallback must not call GoIO_Sensor_* routines for the same sensor.
+
+				Call GoIO_Sensor_SetMeasurementCallback(hSensor, NULL, NULL, 0, 0) to return to queued mode. Any measurements
+				held in a partial batch are delivered to the old callback before this routine returns.
+				GoIO_Sensor_Close() does this automatically.
+
+				Push mode is supported on Windows and Linux.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_SetMeasurementCallback(
+	GOIO_SENSOR_HANDLE hSensor,				//[in] handle to open sensor.
+	GOIO_MEASUREMENT_CALLBACK pCallback,	//[in] routine to receive measurements, or NULL for queued mode.
+	void *pContext,							//[in] passed to pCallback unchanged.
+	gtype_int32 minBatchSize,				//[in] deliver a batch once it holds this many measurements.
+	gtype_int32 maxLatencyMs);				//[in] deliver a partial batch once its oldest measurement is this old, 0 for no limit.
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_GetReadinessFd()
+	
+	Purpose:	Get a file descriptor that becomes readable when the sensor has something for the application, so
+				that a program can wait on many sensors with a single select(), poll(), or epoll_wait() call.
+
+				The descriptor is signalled when:
+					1) the number of measurements in the GoIO Measurement Buffer reaches the readiness watermark, 
+						see GoIO_Sensor_SetReadinessWatermark(), or
+					2) a command response packet arrives from the sensor.
+
+				The descriptor is an eventfd opened in nonblocking mode. After it becomes readable, read 8 bytes from it
+				to reset it, then call GoIO_Sensor_ReadRawMeasurements() and/or GoIO_Sensor_GetNextResponse().
+				The watermark signal fires once each time the GoIO Measurement Buffer fills up to the watermark. It is
+				rearmed when measurements are removed from the buffer; if the buffer is still at or above the watermark
+				afterwards, the descriptor is signalled again right away.
+
+				The descriptor is created by the first call to this routine and is owned by the sensor: do not close it.
+				It is closed by GoIO_Sensor_Close().
+
+				Measurements delivered through GoIO_Sensor_SetMeasurementCallback() do not signal the descriptor.
+
+				This routine is only supported on Linux.
+
+	Return:		file descriptor, or -1 if not supported or an error occurred.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetReadinessFd(
+	GOIO_SENSOR_HANDLE hSensor);//[in] handle to open sensor.
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_SetReadinessWatermark()
+	
+	Purpose:	Set the number of measurements that must be in the GoIO Measurement Buffer before the descriptor
+				returned by GoIO_Sensor_GetReadinessFd() is signalled. The default is 1.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_SetReadinessWatermark(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
+	gtype_int32 minMeasurements);//[in] watermark, in measurements.
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_WaitForMeasurements()
+	
+	Purpose:	Block until the GoIO Measurement Buffer holds at least minCount measurements, or until timeoutMs
+				milliseconds have elapsed. 
+
+				The calling thread sleeps until the thread that receives data from the sensor reports that enough
+				measurements have arrived, so this is much cheaper than calling GoIO_Sensor_GetNumMeasurementsAvailable() 
+				in a loop. See GoIO_WaitAny() to wait on several sensors at once.
+
+				The sensor is not locked while we wait, so other threads may read measurements or send commands to it
+				meanwhile. If another thread closes the sensor, the wait ends at once and -1 is returned.
+
+				Measurements delivered through GoIO_Sensor_SetMeasurementCallback() never reach the GoIO Measurement
+				Buffer, so waiting on a sensor in push mode always times out.
+
+	Return:		number of measurements in the GoIO Measurement Buffer. If this is less than minCount, the wait timed out.
+				-1 if hSensor is not valid or was closed during the wait.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_WaitForMeasurements(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
+	gtype_int32 minCount,			//[in] # of measurements to wait for.
+	gtype_int32 timeoutMs);				//[in] # of milliseconds to wait before giving up.
+
+/***************************************************************************************************************************
+	Function Name: GoIO_WaitAny()
+	
+	Purpose:	Block until the GoIO Measurement Buffer of at least one of the specified sensors holds minCount or more 
+				measurements, or until timeoutMs milliseconds have elapsed. See GoIO_Sensor_WaitForMeasurements().
+
+				The sensors are not locked while we wait. If another thread closes one of them, the wait ends at once.
+
+	Return:		index into pSensors of a sensor that has at least minCount measurements available. If several sensors are
+				ready, the one with the lowest index is reported. -1 if the wait timed out, if any handle is not valid, or
+				if a sensor was closed during the wait.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_WaitAny(
+	const GOIO_SENSOR_HANDLE *pSensors,	//[in] array of handles to open sensors.
+	gtype_int32 numSensors,			//[in] # of handles in pSensors.
+	gtype_int32 minCount,			//[in] # of measurements to wait for.
+	gtype_int32 timeoutMs);				//[in] # of milliseconds to wait before giving up.
+
+/***************************************************************************************************************************
+	Function Name: GoIO_ReadRawMeasurementsMulti()
+	
+	Purpose:	Retrieve measurements from the GoIO Measurement Buffers of several sensors in one call. This is equivalent 
+				to calling GoIO_Sensor_ReadRawMeasurements(pSensors[i], pMeasurementsBufs[i], maxCounts[i]) for each
+				sensor, but all the handles are validated together and every buffer is drained in a single pass, which
+				is considerably cheaper when many sensors are open.
+
+				Unlike GoIO_Sensor_ReadRawMeasurements(), this routine never loses measurements: if the packet fill
+				changes part way through a call, the measurements that did not fit are returned by the next read.
+
+				pCounts[i] is set to the number of measurements copied into pMeasurementsBufs[i].
+
+	Return:		total number of measurements retrieved from all the sensors. This routine returns immediately.
+				-1 if any handle is not valid, in which case no measurements are retrieved.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_ReadRawMeasurementsMulti(
+	const GOIO_SENSOR_HANDLE *pSensors,	//[in] array of handles to open sensors.
+	gtype_int32 numSensors,			//[in] # of handles in pSensors.
+	gtype_int32 **pMeasurementsBufs,	//[out] array of numSensors ptrs to locs to store measurements.
+	const gtype_int32 *maxCounts,		//[in] array of numSensors maximum number of measurements to copy to each buffer.
+	gtype_int32 *pCounts);			//[out] array of numSensors counts of measurements retrieved.
+
 /***************************************************************************************************************************
 	Function Name: GoIO_Sensor_ConvertToVoltage()
 	
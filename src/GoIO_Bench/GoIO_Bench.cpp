@@ -0,0 +1,755 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GoIO_Bench.cpp
+//
+// GoIO_Bench measures the acquisition hot paths of the GoIO lib against simulated devices(see
+// GoIO_Diags_SetSimulatorConfig()), and writes the results as JSON so that they can be compared between
+// SDK releases. It only uses the public GoIO_DLL interface, so it measures exactly what an app sees.
+//
+// Sections:
+//		ingest		measurement throughput from each packet source: "sim", "replay"(a capture of a simulated
+//					session played back at full speed), and "usb" if real devices(or GoIO_GadgetEmulator) are attached.
+//		cmd			GoIO_Sensor_SendCmdAndGetResponse() round trip latency percentiles, idle and while measuring.
+//		open		GoIO_Sensor_Open() time broken down by phase, see GoIO_Diags_GetSensorOpenTimings().
+//		sample		ns per measurement for GoIO_Sensor_ReadRawMeasurements(), _ConvertToVoltage() and _CalibrateData().
+//		scaling		aggregate throughput, loss and CPU load with 1, 2, 4, ... up to 256 simulated Go! Links at 1 kHz.
+//
+// "make bench" in the top level build directory runs every section and writes bench.json.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <glob.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+#include "GoIO_DLL_interface.h"
+
+#define BENCH_MAX_DEVICES 256
+#define BENCH_READ_BUF_SIZE 6000	//Enough to drain a full GoIO Measurement Buffer in one call.
+#define BENCH_MAX_JSON_DEPTH 8
+#define BENCH_REPLAY_IDLE_US 200000
+
+struct BenchOptions
+{
+	double fSectionSeconds;
+	int nMaxDevices;
+	int nCmdIterations;
+	int nOpenIterations;
+	std::string sSections;
+	std::string sCapturePrefix;
+};
+
+static BenchOptions options;
+static volatile double sink;//Keeps the conversion loops from being optimized away.
+
+//--------------------------------------------------------------------------------------------------------------------------
+// Minimal streaming JSON writer.
+
+static FILE *jsonFile = NULL;
+static int jsonDepth = 0;
+static bool jsonNeedComma[BENCH_MAX_JSON_DEPTH];
+
+static void JsonKey(const char *pKey)
+{
+	if (jsonNeedComma[jsonDepth])
+		fprintf(jsonFile, ",");
+	if (jsonDepth > 0)
+		fprintf(jsonFile, "\n%*s", 2*jsonDepth, "");
+	if (pKey)
+		fprintf(jsonFile, "\"%s\": ", pKey);
+	jsonNeedComma[jsonDepth] = true;
+}
+
+static void JsonBegin(const char *pKey, char bracket)
+{
+	JsonKey(pKey);
+	fprintf(jsonFile, "%c", bracket);
+	jsonDepth++;
+	jsonNeedComma[jsonDepth] = false;
+}
+
+static void JsonEnd(char bracket)
+{
+	jsonDepth--;
+	fprintf(jsonFile, "\n%*s%c", 2*jsonDepth, "", bracket);
+}
+
+static void JsonBeginObject(const char *pKey) { JsonBegin(pKey, '{'); }
+static void JsonEndObject(void) { JsonEnd('}'); }
+static void JsonBeginArray(const char *pKey) { JsonBegin(pKey, '['); }
+static void JsonEndArray(void) { JsonEnd(']'); }
+
+static void JsonNumber(const char *pKey, double value)
+{
+	JsonKey(pKey);
+	if ((value != value) || (fabs(value) > 1e300))
+		fprintf(jsonFile, "null");//JSON has no NaN or infinity.
+	else
+		fprintf(jsonFile, "%.6g", value);
+}
+
+static void JsonInteger(const char *pKey, long long value)
+{
+	JsonKey(pKey);
+	fprintf(jsonFile, "%lld", value);
+}
+
+static void JsonString(const char *pKey, const char *pValue)
+{
+	JsonKey(pKey);
+	fprintf(jsonFile, "\"%s\"", pValue);//Only used for fixed strings and device names, which need no escaping.
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+// Helpers.
+
+static unsigned long long BenchNowUs(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((unsigned long long) ts.tv_sec)*1000000ULL + ts.tv_nsec/1000;
+}
+
+static double BenchCpuSeconds(void)
+{
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec)/1000000.0;
+}
+
+static bool IsSectionEnabled(const char *pSection)
+{
+	std::string sList = "," + options.sSections + ",";
+	return (std::string::npos != sList.find(std::string(",") + pSection + ",")) || ("all" == options.sSections);
+}
+
+static const char *GetProductName(int productId)
+{
+	switch (productId)
+	{
+		case SKIP_DEFAULT_PRODUCT_ID:				return "Go! Link";
+		case USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID:	return "Go! Temp";
+		case CYCLOPS_DEFAULT_PRODUCT_ID:			return "Go! Motion";
+		case MINI_GC_DEFAULT_PRODUCT_ID:			return "Mini GC";
+	}
+	return "?";
+}
+
+static bool SetSimulatorConfig(const char *pConfig)
+{
+	//Sim and replay devices are listed together, so only one packet source is active at a time.
+	GoIO_Diags_SetReplayConfig("");
+	return (0 == GoIO_Diags_SetSimulatorConfig(pConfig));
+}
+
+//Return the names of the currently available devices with the given product id.
+static std::vector<std::string> GetDeviceNames(int productId)
+{
+	std::vector<std::string> names;
+	char name[GOIO_MAX_SIZE_DEVICE_NAME];
+	int numDevices = GoIO_UpdateListOfAvailableDevices(VERNIER_DEFAULT_VENDOR_ID, productId);
+	for (int i = 0; i < numDevices; i++)
+	{
+		if (0 == GoIO_GetNthAvailableDeviceName(name, sizeof(name), VERNIER_DEFAULT_VENDOR_ID, productId, i))
+			names.push_back(name);
+	}
+	return names;
+}
+
+static GOIO_SENSOR_HANDLE OpenFirstDevice(int productId, const char *pPrefix)
+{
+	std::vector<std::string> names = GetDeviceNames(productId);
+	for (size_t i = 0; i < names.size(); i++)
+	{
+		if ((!pPrefix) || (0 == names[i].compare(0, strlen(pPrefix), pPrefix)))
+			return GoIO_Sensor_Open(names[i].c_str(), VERNIER_DEFAULT_VENDOR_ID, productId, 0);
+	}
+	return NULL;
+}
+
+static double Percentile(const std::vector<double> &sorted, double fraction)
+{
+	if (sorted.empty())
+		return 0.0;
+	size_t index = (size_t) floor(fraction*(sorted.size() - 1) + 0.5);
+	return sorted[index];
+}
+
+//Simulated and replayed Go! Links ramp up by one per measurement, so any other step is a lost packet.
+struct GapCounter
+{
+	GapCounter() : bHavePrev(false), prev(0), nGaps(0) {}
+	void Add(const gtype_int32 *pMeasurements, int nCount)
+	{
+		for (int i = 0; i < nCount; i++)
+		{
+			if (bHavePrev && (((pMeasurements[i] - prev) & 0xFFFF) != 1))
+				nGaps++;
+			prev = pMeasurements[i];
+			bHavePrev = true;
+		}
+	}
+	bool bHavePrev;
+	gtype_int32 prev;
+	long long nGaps;
+};
+
+//--------------------------------------------------------------------------------------------------------------------------
+// ingest
+
+struct IngestResult
+{
+	long long nMeasurements;
+	double fSeconds;
+	long long nGaps;
+};
+
+//Drain hSensor until fSeconds elapse or, if bStopWhenIdle, until no measurements arrive for BENCH_REPLAY_IDLE_US.
+static IngestResult DrainSensor(GOIO_SENSOR_HANDLE hSensor, double fSeconds, bool bStopWhenIdle)
+{
+	IngestResult result;
+	std::vector<gtype_int32> buf(BENCH_READ_BUF_SIZE);
+	GapCounter gaps;
+	unsigned long long startUs = BenchNowUs();
+	unsigned long long lastDataUs = startUs;
+	unsigned long long endUs = startUs + (unsigned long long) (fSeconds*1000000.0);
+
+	result.nMeasurements = 0;
+	for (;;)
+	{
+		int nCount = GoIO_Sensor_ReadRawMeasurements(hSensor, &buf[0], BENCH_READ_BUF_SIZE);
+		unsigned long long nowUs = BenchNowUs();
+		if (nCount > 0)
+		{
+			gaps.Add(&buf[0], nCount);
+			result.nMeasurements += nCount;
+			lastDataUs = nowUs;
+		}
+		else
+		{
+			if (bStopWhenIdle && ((nowUs - lastDataUs) > BENCH_REPLAY_IDLE_US))
+				break;
+			usleep(200);
+		}
+		if (nowUs >= endUs)
+			break;
+	}
+
+	result.fSeconds = ((bStopWhenIdle ? lastDataUs : BenchNowUs()) - startUs)/1000000.0;
+	result.nGaps = gaps.nGaps;
+	return result;
+}
+
+static void WriteIngestResult(const char *pBackend, const IngestResult &result)
+{
+	JsonBeginObject(NULL);
+	JsonString("backend", pBackend);
+	JsonInteger("measurements", result.nMeasurements);
+	JsonNumber("seconds", result.fSeconds);
+	JsonNumber("measurements_per_second", (result.fSeconds > 0.0) ? result.nMeasurements/result.fSeconds : 0.0);
+	JsonInteger("gaps", result.nGaps);
+	JsonEndObject();
+}
+
+static bool RunIngest(GOIO_SENSOR_HANDLE hSensor, double fPeriod, double fSeconds, bool bStopWhenIdle, IngestResult *pResult)
+{
+	if (0 != GoIO_Sensor_SetMeasurementPeriod(hSensor, fPeriod, SKIP_TIMEOUT_MS_DEFAULT))
+		return false;
+	if (0 != GoIO_Sensor_SendCmdAndGetResponse(hSensor, SKIP_CMD_ID_START_MEASUREMENTS, NULL, 0, NULL, NULL, SKIP_TIMEOUT_MS_DEFAULT))
+		return false;
+	*pResult = DrainSensor(hSensor, fSeconds, bStopWhenIdle);
+	GoIO_Sensor_SendCmdAndGetResponse(hSensor, SKIP_CMD_ID_STOP_MEASUREMENTS, NULL, 0, NULL, NULL, SKIP_TIMEOUT_MS_DEFAULT);
+	return true;
+}
+
+static void BenchIngest(void)
+{
+	IngestResult result;
+	GOIO_SENSOR_HANDLE hSensor;
+
+	JsonBeginArray("ingest");
+
+	//Real devices first, before any virtual devices are listed.
+	SetSimulatorConfig("");
+	hSensor = OpenFirstDevice(SKIP_DEFAULT_PRODUCT_ID, NULL);
+	if (hSensor)
+	{
+		fprintf(stderr, "ingest: usb\n");
+		if (RunIngest(hSensor, 0.001, options.fSectionSeconds, false, &result))
+			WriteIngestResult("usb", result);
+		GoIO_Sensor_Close(hSensor);
+	}
+
+	//The simulator generates 1 measurement per us, 3 per packet, which is faster than the lib can take them.
+	fprintf(stderr, "ingest: sim\n");
+	SetSimulatorConfig("golink=1,period_us=1,fill=3");
+	hSensor = OpenFirstDevice(SKIP_DEFAULT_PRODUCT_ID, "sim:");
+	if (hSensor)
+	{
+		if (RunIngest(hSensor, 0.001, options.fSectionSeconds, false, &result))
+			WriteIngestResult("sim", result);
+		GoIO_Sensor_Close(hSensor);
+	}
+
+	//Capture a 10 kHz session, then replay it as fast as the lib will accept the packets.
+	fprintf(stderr, "ingest: replay\n");
+	GoIO_Diags_SetPacketCapturePrefix(options.sCapturePrefix.c_str());
+	SetSimulatorConfig("golink=1,period_us=100,fill=3");
+	hSensor = OpenFirstDevice(SKIP_DEFAULT_PRODUCT_ID, "sim:");
+	GoIO_Diags_SetPacketCapturePrefix("");
+	if (hSensor)
+	{
+		bool bCaptured = RunIngest(hSensor, 0.001, options.fSectionSeconds, false, &result);
+		GoIO_Sensor_Close(hSensor);
+
+		glob_t globResult;
+		std::string sPattern = options.sCapturePrefix + "-*.gcap";
+		if (bCaptured && (0 == glob(sPattern.c_str(), 0, NULL, &globResult)))
+		{
+			std::string sConfig = std::string("speed=0,file=") + globResult.gl_pathv[globResult.gl_pathc - 1];
+			SetSimulatorConfig("");
+			if (0 == GoIO_Diags_SetReplayConfig(sConfig.c_str()))
+			{
+				hSensor = OpenFirstDevice(SKIP_DEFAULT_PRODUCT_ID, "replay:");
+				if (hSensor)
+				{
+					if (RunIngest(hSensor, 0.001, 10.0*options.fSectionSeconds, true, &result))
+						WriteIngestResult("replay", result);
+					GoIO_Sensor_Close(hSensor);
+				}
+				GoIO_Diags_SetReplayConfig("");
+			}
+			for (size_t i = 0; i < globResult.gl_pathc; i++)
+				unlink(globResult.gl_pathv[i]);
+			globfree(&globResult);
+		}
+	}
+
+	JsonEndArray();
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+// cmd
+
+static void MeasureCmdLatency(GOIO_SENSOR_HANDLE hSensor, const char *pLoad, bool bMeasuring)
+{
+	std::vector<double> latencies;
+	std::vector<gtype_int32> buf(BENCH_READ_BUF_SIZE);
+	GSkipGetStatusCmdResponsePayload status;
+	int nFailures = 0;
+	double fTotalUs = 0.0;
+
+	if (bMeasuring)
+	{
+		GoIO_Sensor_SetMeasurementPeriod(hSensor, 0.001, SKIP_TIMEOUT_MS_DEFAULT);
+		GoIO_Sensor_SendCmdAndGetResponse(hSensor, SKIP_CMD_ID_START_MEASUREMENTS, NULL, 0, NULL, NULL, SKIP_TIMEOUT_MS_DEFAULT);
+	}
+
+	for (int i = 0; i < options.nCmdIterations; i++)
+	{
+		gtype_int32 nRespBytes = sizeof(status);
+		unsigned long long startUs = BenchNowUs();
+		int nResult = GoIO_Sensor_SendCmdAndGetResponse(hSensor, SKIP_CMD_ID_GET_STATUS, NULL, 0, &status, &nRespBytes,
+			SKIP_TIMEOUT_MS_DEFAULT);
+		double fUs = (double) (BenchNowUs() - startUs);
+		if (0 == nResult)
+		{
+			latencies.push_back(fUs);
+			fTotalUs += fUs;
+		}
+		else
+			nFailures++;
+		if (bMeasuring)
+			GoIO_Sensor_ReadRawMeasurements(hSensor, &buf[0], BENCH_READ_BUF_SIZE);
+	}
+
+	if (bMeasuring)
+		GoIO_Sensor_SendCmdAndGetResponse(hSensor, SKIP_CMD_ID_STOP_MEASUREMENTS, NULL, 0, NULL, NULL, SKIP_TIMEOUT_MS_DEFAULT);
+
+	std::sort(latencies.begin(), latencies.end());
+	JsonBeginObject(NULL);
+	JsonString("device", "sim Go! Link");
+	JsonString("cmd", "SKIP_CMD_ID_GET_STATUS");
+	JsonString("load", pLoad);
+	JsonInteger("count", (long long) latencies.size());
+	JsonInteger("failures", nFailures);
+	JsonNumber("mean_us", latencies.empty() ? 0.0 : fTotalUs/latencies.size());
+	JsonNumber("p50_us", Percentile(latencies, 0.5));
+	JsonNumber("p90_us", Percentile(latencies, 0.9));
+	JsonNumber("p99_us", Percentile(latencies, 0.99));
+	JsonNumber("p999_us", Percentile(latencies, 0.999));
+	JsonNumber("max_us", latencies.empty() ? 0.0 : latencies.back());
+	JsonEndObject();
+}
+
+static void BenchCmd(void)
+{
+	fprintf(stderr, "cmd\n");
+	JsonBeginArray("cmd_latency");
+	SetSimulatorConfig("golink=1");
+	GOIO_SENSOR_HANDLE hSensor = OpenFirstDevice(SKIP_DEFAULT_PRODUCT_ID, "sim:");
+	if (hSensor)
+	{
+		MeasureCmdLatency(hSensor, "idle", false);
+		MeasureCmdLatency(hSensor, "measuring_1khz", true);
+		GoIO_Sensor_Close(hSensor);
+	}
+	JsonEndArray();
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+// open
+
+static void BenchOpen(void)
+{
+	static const int productIds[] = {SKIP_DEFAULT_PRODUCT_ID, USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID, CYCLOPS_DEFAULT_PRODUCT_ID,
+		MINI_GC_DEFAULT_PRODUCT_ID};
+
+	fprintf(stderr, "open\n");
+	JsonBeginArray("sensor_open");
+	SetSimulatorConfig("golink=1,gotemp=1,gomotion=1,minigc=1");
+	for (size_t k = 0; k < sizeof(productIds)/sizeof(productIds[0]); k++)
+	{
+		std::vector<std::string> names = GetDeviceNames(productIds[k]);
+		std::vector<double> totals;
+		GoIOSensorOpenTimings sum;
+		int nFailures = 0;
+
+		memset(&sum, 0, sizeof(sum));
+		for (int i = 0; (i < options.nOpenIterations) && !names.empty(); i++)
+		{
+			GoIOSensorOpenTimings timings;
+			GOIO_SENSOR_HANDLE hSensor = GoIO_Sensor_Open(names[0].c_str(), VERNIER_DEFAULT_VENDOR_ID, productIds[k], 0);
+			if (hSensor && (0 == GoIO_Diags_GetSensorOpenTimings(hSensor, &timings)))
+			{
+				sum.portOpenSeconds += timings.portOpenSeconds;
+				sum.initSeconds += timings.initSeconds;
+				sum.flashReadSeconds += timings.flashReadSeconds;
+				sum.sensorIdSeconds += timings.sensorIdSeconds;
+				sum.ddsReadSeconds += timings.ddsReadSeconds;
+				sum.channelSetupSeconds += timings.channelSetupSeconds;
+				sum.totalSeconds += timings.totalSeconds;
+				totals.push_back(timings.totalSeconds*1000000.0);
+			}
+			else
+				nFailures++;
+			if (hSensor)
+				GoIO_Sensor_Close(hSensor);
+		}
+
+		std::sort(totals.begin(), totals.end());
+		double fScale = totals.empty() ? 0.0 : 1000000.0/totals.size();
+		JsonBeginObject(NULL);
+		JsonString("device", GetProductName(productIds[k]));
+		JsonInteger("product_id", productIds[k]);
+		JsonInteger("opens", (long long) totals.size());
+		JsonInteger("failures", nFailures);
+		JsonNumber("port_open_us_mean", sum.portOpenSeconds*fScale);
+		JsonNumber("init_us_mean", sum.initSeconds*fScale);
+		JsonNumber("flash_read_us_mean", sum.flashReadSeconds*fScale);
+		JsonNumber("sensor_id_us_mean", sum.sensorIdSeconds*fScale);
+		JsonNumber("dds_read_us_mean", sum.ddsReadSeconds*fScale);
+		JsonNumber("channel_setup_us_mean", sum.channelSetupSeconds*fScale);
+		JsonNumber("total_us_mean", sum.totalSeconds*fScale);
+		JsonNumber("total_us_p50", Percentile(totals, 0.5));
+		JsonNumber("total_us_max", totals.empty() ? 0.0 : totals.back());
+		JsonEndObject();
+	}
+	JsonEndArray();
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+// sample
+
+static void BenchSample(void)
+{
+	std::vector<gtype_int32> buf(BENCH_READ_BUF_SIZE);
+	std::vector<gtype_int32> samples;
+	long long nReadSamples = 0;
+	unsigned long long readUs = 0;
+
+	fprintf(stderr, "sample\n");
+	SetSimulatorConfig("golink=1,period_us=1,fill=3");
+	GOIO_SENSOR_HANDLE hSensor = OpenFirstDevice(SKIP_DEFAULT_PRODUCT_ID, "sim:");
+	if (!hSensor)
+		return;
+
+	//Let the GoIO Measurement Buffer fill up while measuring, then time draining it.
+	unsigned long long endUs = BenchNowUs() + (unsigned long long) (options.fSectionSeconds*1000000.0);
+	while (BenchNowUs() < endUs)
+	{
+		GoIO_Sensor_SendCmdAndGetResponse(hSensor, SKIP_CMD_ID_START_MEASUREMENTS, NULL, 0, NULL, NULL, SKIP_TIMEOUT_MS_DEFAULT);
+		unsigned long long fillEndUs = BenchNowUs() + 100000;
+		while ((GoIO_Sensor_GetNumMeasurementsAvailable(hSensor) < BENCH_READ_BUF_SIZE) && (BenchNowUs() < fillEndUs))
+			usleep(1000);
+		GoIO_Sensor_SendCmdAndGetResponse(hSensor, SKIP_CMD_ID_STOP_MEASUREMENTS, NULL, 0, NULL, NULL, SKIP_TIMEOUT_MS_DEFAULT);
+
+		unsigned long long startUs = BenchNowUs();
+		int nCount = GoIO_Sensor_ReadRawMeasurements(hSensor, &buf[0], BENCH_READ_BUF_SIZE);
+		readUs += BenchNowUs() - startUs;
+		if (nCount > 0)
+		{
+			nReadSamples += nCount;
+			if (samples.size() < BENCH_READ_BUF_SIZE)
+				samples.insert(samples.end(), buf.begin(), buf.begin() + nCount);
+		}
+	}
+
+	//Convert and calibrate the same samples over and over until fSectionSeconds have passed.
+	long long nConverted = 0;
+	unsigned long long convertUs = 0;
+	long long nCalibrated = 0;
+	unsigned long long calibrateUs = 0;
+	for (int pass = 0; (pass < 2) && !samples.empty(); pass++)
+	{
+		unsigned long long startUs = BenchNowUs();
+		unsigned long long passEndUs = startUs + (unsigned long long) (options.fSectionSeconds*500000.0);
+		long long nCount = 0;
+		double fSum = 0.0;
+		do
+		{
+			for (size_t i = 0; i < samples.size(); i++)
+			{
+				double fVolts = GoIO_Sensor_ConvertToVoltage(hSensor, samples[i]);
+				fSum += (0 == pass) ? fVolts : GoIO_Sensor_CalibrateData(hSensor, fVolts);
+			}
+			nCount += samples.size();
+		}
+		while (BenchNowUs() < passEndUs);
+		sink = fSum;
+		if (0 == pass)
+		{
+			nConverted = nCount;
+			convertUs = BenchNowUs() - startUs;
+		}
+		else
+		{
+			nCalibrated = nCount;
+			calibrateUs = BenchNowUs() - startUs;
+		}
+	}
+	GoIO_Sensor_Close(hSensor);
+
+	//The calibrate pass converts each sample as well, so subtract the conversion cost.
+	double fConvertNs = nConverted ? (convertUs*1000.0)/nConverted : 0.0;
+	double fCalibrateNs = nCalibrated ? (calibrateUs*1000.0)/nCalibrated - fConvertNs : 0.0;
+	JsonBeginObject("per_sample");
+	JsonString("device", "sim Go! Link");
+	JsonInteger("read_samples", nReadSamples);
+	JsonNumber("read_raw_ns", nReadSamples ? (readUs*1000.0)/nReadSamples : 0.0);
+	JsonInteger("convert_samples", nConverted);
+	JsonNumber("convert_ns", fConvertNs);
+	JsonInteger("calibrate_samples", nCalibrated);
+	JsonNumber("calibrate_ns", fCalibrateNs);
+	JsonEndObject();
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+// scaling
+
+static void BenchScalingStep(int nDevices)
+{
+	char config[64];
+	std::vector<GOIO_SENSOR_HANDLE> sensors;
+
+	fprintf(stderr, "scaling: %d\n", nDevices);
+	sprintf(config, "golink=%d,period_us=1000", nDevices);
+	SetSimulatorConfig(config);
+	std::vector<std::string> names = GetDeviceNames(SKIP_DEFAULT_PRODUCT_ID);
+
+	unsigned long long startUs = BenchNowUs();
+	for (size_t i = 0; (i < names.size()) && ((int) sensors.size() < nDevices); i++)
+	{
+		GOIO_SENSOR_HANDLE hSensor = GoIO_Sensor_Open(names[i].c_str(), VERNIER_DEFAULT_VENDOR_ID, SKIP_DEFAULT_PRODUCT_ID, 0);
+		if (hSensor)
+			sensors.push_back(hSensor);
+	}
+	double fOpenSeconds = (BenchNowUs() - startUs)/1000000.0;
+	int nOpened = (int) sensors.size();
+
+	for (int i = 0; i < nOpened; i++)
+	{
+		GoIO_Sensor_SetMeasurementPeriod(sensors[i], 0.001, SKIP_TIMEOUT_MS_DEFAULT);
+		GoIO_Sensor_SendCmdAndGetResponse(sensors[i], SKIP_CMD_ID_START_MEASUREMENTS, NULL, 0, NULL, NULL, SKIP_TIMEOUT_MS_DEFAULT);
+	}
+
+	std::vector<std::vector<gtype_int32> > bufs(nOpened, std::vector<gtype_int32>(BENCH_READ_BUF_SIZE));
+	std::vector<gtype_int32 *> pBufs(nOpened);
+	std::vector<gtype_int32> maxCounts(nOpened, BENCH_READ_BUF_SIZE);
+	std::vector<gtype_int32> counts(nOpened);
+	std::vector<GapCounter> gaps(nOpened);
+	for (int i = 0; i < nOpened; i++)
+		pBufs[i] = &bufs[i][0];
+
+	long long nMeasurements = 0;
+	double fCpuStart = BenchCpuSeconds();
+	startUs = BenchNowUs();
+	unsigned long long endUs = startUs + (unsigned long long) (options.fSectionSeconds*1000000.0);
+	while ((nOpened > 0) && (BenchNowUs() < endUs))
+	{
+		int nCount = GoIO_ReadRawMeasurementsMulti(&sensors[0], nOpened, &pBufs[0], &maxCounts[0], &counts[0]);
+		if (nCount > 0)
+		{
+			nMeasurements += nCount;
+			for (int i = 0; i < nOpened; i++)
+				gaps[i].Add(pBufs[i], counts[i]);
+		}
+		usleep(1000);
+	}
+	double fSeconds = (BenchNowUs() - startUs)/1000000.0;
+	double fCpuSeconds = BenchCpuSeconds() - fCpuStart;
+
+	long long nGaps = 0;
+	for (int i = 0; i < nOpened; i++)
+	{
+		nGaps += gaps[i].nGaps;
+		GoIO_Sensor_SendCmdAndGetResponse(sensors[i], SKIP_CMD_ID_STOP_MEASUREMENTS, NULL, 0, NULL, NULL, SKIP_TIMEOUT_MS_DEFAULT);
+		GoIO_Sensor_Close(sensors[i]);
+	}
+
+	JsonBeginObject(NULL);
+	JsonInteger("devices", nDevices);
+	JsonInteger("opened", nOpened);
+	JsonNumber("open_seconds", fOpenSeconds);
+	JsonNumber("measurements_per_second", (fSeconds > 0.0) ? nMeasurements/fSeconds : 0.0);
+	JsonNumber("expected_per_second", 1000.0*nOpened);
+	JsonInteger("gaps", nGaps);
+	JsonNumber("cpu_percent", (fSeconds > 0.0) ? 100.0*fCpuSeconds/fSeconds : 0.0);
+	JsonEndObject();
+}
+
+static void BenchScaling(void)
+{
+	JsonBeginArray("scaling");
+	for (int nDevices = 1; nDevices <= options.nMaxDevices; nDevices *= 2)
+		BenchScalingStep(nDevices);
+	JsonEndArray();
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+static void PrintUsage(void)
+{
+	fprintf(stderr, "usage: GoIO_Bench [-d seconds] [-n max_devices] [-c cmd_iterations] [-i open_iterations]\n"
+		"                  [-s sections] [-o output.json]\n"
+		"  -d  seconds spent in each timed measurement(default 2).\n"
+		"  -n  largest number of simulated devices in the scaling section(default 256, max 256).\n"
+		"  -c  commands sent for each latency measurement(default 2000).\n"
+		"  -i  opens of each device type in the open section(default 20).\n"
+		"  -s  comma separated list of ingest,cmd,open,sample,scaling(default all).\n"
+		"  -o  write the JSON report here instead of stdout.\n");
+}
+
+int main(int argc, char* argv[])
+{
+	const char *pOutputPath = NULL;
+	int opt;
+
+	options.fSectionSeconds = 2.0;
+	options.nMaxDevices = BENCH_MAX_DEVICES;
+	options.nCmdIterations = 2000;
+	options.nOpenIterations = 20;
+	options.sSections = "all";
+	while (-1 != (opt = getopt(argc, argv, "d:n:c:i:s:o:h")))
+	{
+		switch (opt)
+		{
+			case 'd': options.fSectionSeconds = atof(optarg); break;
+			case 'n': options.nMaxDevices = atoi(optarg); break;
+			case 'c': options.nCmdIterations = atoi(optarg); break;
+			case 'i': options.nOpenIterations = atoi(optarg); break;
+			case 's': options.sSections = optarg; break;
+			case 'o': pOutputPath = optarg; break;
+			default:
+				PrintUsage();
+				return ('h' == opt) ? 0 : 1;
+		}
+	}
+	if ((options.fSectionSeconds <= 0.0) || (options.nMaxDevices < 1) || (options.nMaxDevices > BENCH_MAX_DEVICES) ||
+		(options.nCmdIterations < 1) || (options.nOpenIterations < 1))
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	char prefix[64];
+	sprintf(prefix, "/tmp/goio_bench_%d", (int) getpid());
+	options.sCapturePrefix = prefix;
+
+	jsonFile = pOutputPath ? fopen(pOutputPath, "w") : stdout;
+	if (!jsonFile)
+	{
+		fprintf(stderr, "GoIO_Bench: cannot open %s\n", pOutputPath);
+		return 1;
+	}
+
+	if (0 != GoIO_Init())
+	{
+		fprintf(stderr, "GoIO_Bench: GoIO_Init() failed\n");
+		return 1;
+	}
+
+	gtype_uint16 majorVersion = 0, minorVersion = 0;
+	char version[32];
+	GoIO_GetDLLVersion(&majorVersion, &minorVersion);
+	sprintf(version, "%d.%02d", majorVersion, minorVersion);
+
+	JsonBeginObject(NULL);
+	JsonString("benchmark", "GoIO_Bench");
+	JsonString("dll_version", version);
+	JsonInteger("timestamp", (long long) time(NULL));
+	JsonNumber("section_seconds", options.fSectionSeconds);
+	if (IsSectionEnabled("ingest"))
+		BenchIngest();
+	if (IsSectionEnabled("cmd"))
+		BenchCmd();
+	if (IsSectionEnabled("open"))
+		BenchOpen();
+	if (IsSectionEnabled("sample"))
+		BenchSample();
+	if (IsSectionEnabled("scaling"))
+		BenchScaling();
+	JsonEndObject();
+	fprintf(jsonFile, "\n");
+
+	SetSimulatorConfig("");
+	GoIO_Uninit();
+
+	if (pOutputPath)
+		fclose(jsonFile);
+
+	return 0;
+}
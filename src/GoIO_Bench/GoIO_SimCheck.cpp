@@ -0,0 +1,452 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GoIO_SimCheck.cpp
+//
+// GoIO_SimCheck runs the acquisition paths of the GoIO lib against a simulated Go! Link(see
+// GoIO_Diags_SetSimulatorConfig()) and checks what comes out. Simulated measurements ramp up by one each, so every
+// check also verifies that no measurement is lost or reordered. Like GoIO_Bench, it only uses the public GoIO_DLL
+// interface. It prints PASS or FAIL for each check, and exits with 1 if any check failed.
+//
+// Checks:
+//		leftovers	GoIO_ReadRawMeasurementsMulti() with a buffer that ends part way through a packet, while the queue
+//					holds packets of 3 and then 1 measurements. The measurements that do not fit come back next time.
+//		spill		a queue of 50 packets spills to disk at 40 while nothing is read for 1.5 seconds, and every
+//					measurement is read back in order.
+//		batches		push mode callbacks: with no latency limit only full batches are delivered, and with a latency
+//					limit partial batches are flushed.
+//		waits		GoIO_Sensor_WaitForMeasurements() returns once enough measurements arrive, and GoIO_WaitAny() times out.
+//		readiness	a poll() loop on GoIO_Sensor_GetReadinessFd() that reads only part of the queue each time never
+//					misses a wakeup.
+//		broadcast	a GOIO_CONSUMER_POLICY_BLOCK consumer that stops reading does not hold up the app's calls.
+//
+// "make check" in the top level build directory runs every check. 'GoIO_SimCheck check ...' runs the named ones.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <unistd.h>
+#include <poll.h>
+#include <vector>
+
+#include "GoIO_DLL_interface.h"
+
+#define CHECK_READ_BUF_SIZE 6000	//Enough to drain a full GoIO Measurement Buffer in one call.
+#define CHECK_SKIPPED 77			//Tells automake's test driver that the check could not run here.
+
+//--------------------------------------------------------------------------------------------------------------------------
+// Helpers.
+
+static unsigned long long CheckNowMs(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((unsigned long long) ts.tv_sec)*1000ULL + ts.tv_nsec/1000000;
+}
+
+static bool Report(const char *pCheck, bool bPassed, const char *pFormat, ...)
+{
+	va_list args;
+	printf("%s %s: ", bPassed ? "PASS" : "FAIL", pCheck);
+	va_start(args, pFormat);
+	vprintf(pFormat, args);
+	va_end(args);
+	printf("\n");
+	fflush(stdout);
+	return bPassed;
+}
+
+static GOIO_SENSOR_HANDLE OpenSimulatedGoLink(void)
+{
+	char name[GOIO_MAX_SIZE_DEVICE_NAME];
+	if (GoIO_UpdateListOfAvailableDevices(VERNIER_DEFAULT_VENDOR_ID, SKIP_DEFAULT_PRODUCT_ID) < 1)
+		return NULL;
+	if (0 != GoIO_GetNthAvailableDeviceName(name, sizeof(name), VERNIER_DEFAULT_VENDOR_ID, SKIP_DEFAULT_PRODUCT_ID, 0))
+		return NULL;
+	return GoIO_Sensor_Open(name, VERNIER_DEFAULT_VENDOR_ID, SKIP_DEFAULT_PRODUCT_ID, 0);
+}
+
+static bool StartMeasurements(GOIO_SENSOR_HANDLE hSensor, double fPeriod)
+{
+	if (0 != GoIO_Sensor_SetMeasurementPeriod(hSensor, fPeriod, SKIP_TIMEOUT_MS_DEFAULT))
+		return false;
+	return (0 == GoIO_Sensor_SendCmdAndGetResponse(hSensor, SKIP_CMD_ID_START_MEASUREMENTS, NULL, 0, NULL, NULL, 
+		SKIP_TIMEOUT_MS_DEFAULT));
+}
+
+static void StopMeasurements(GOIO_SENSOR_HANDLE hSensor)
+{
+	GoIO_Sensor_SendCmdAndGetResponse(hSensor, SKIP_CMD_ID_STOP_MEASUREMENTS, NULL, 0, NULL, NULL, SKIP_TIMEOUT_MS_DEFAULT);
+}
+
+//Simulated Go! Links ramp up by one per measurement, so any other step is a lost or reordered measurement.
+struct GapCounter
+{
+	GapCounter() : bHavePrev(false), prev(0), nGaps(0) {}
+	void Add(const gtype_int32 *pMeasurements, int nCount)
+	{
+		for (int i = 0; i < nCount; i++)
+		{
+			if (bHavePrev && (((pMeasurements[i] - prev) & 0xFFFF) != 1))
+				nGaps++;
+			prev = pMeasurements[i];
+			bHavePrev = true;
+		}
+	}
+	bool bHavePrev;
+	gtype_int32 prev;
+	long long nGaps;
+};
+
+//Read everything in the GoIO Measurement Buffer, nMaxPerRead measurements at a time.
+static long long DrainSensor(GOIO_SENSOR_HANDLE hSensor, int nMaxPerRead, GapCounter *pGaps)
+{
+	std::vector<gtype_int32> buf(CHECK_READ_BUF_SIZE);
+	gtype_int32 *pBufs[1] = { &buf[0] };
+	gtype_int32 maxCounts[1] = { nMaxPerRead };
+	gtype_int32 counts[1];
+	long long nTotal = 0;
+	int nCount;
+
+	while ((nCount = GoIO_ReadRawMeasurementsMulti(&hSensor, 1, pBufs, maxCounts, counts)) > 0)
+	{
+		pGaps->Add(&buf[0], nCount);
+		nTotal += nCount;
+	}
+	return nTotal;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+// leftovers
+
+static bool CheckLeftovers(GOIO_SENSOR_HANDLE hSensor)
+{
+	//At 5 ms the simulator packs 3 measurements per packet, at 50 ms only 1. A read is sized from the newest 
+	//packet's fill, so 5 slot reads of the 3 measurement packets keep ending part way through one.
+	//The period cannot be changed while measuring, so the second run starts with the queue still full, 
+	//which GSkipBaseDevice::SendCmd() reports with an assert message.
+	bool bStarted = StartMeasurements(hSensor, 0.005);
+	usleep(300000);
+	StopMeasurements(hSensor);
+	bStarted = bStarted && StartMeasurements(hSensor, 0.05);
+	usleep(300000);
+	StopMeasurements(hSensor);
+
+	int nAvailable = GoIO_Sensor_GetNumMeasurementsAvailable(hSensor);
+	GapCounter gaps;
+	long long nRead = DrainSensor(hSensor, 5, &gaps);
+	return Report("leftovers", bStarted && (nAvailable > 0) && (nRead == nAvailable) && (0 == gaps.nGaps),
+		"%d measurements available, %lld read, %lld gaps", nAvailable, nRead, gaps.nGaps);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+// spill
+
+static bool CheckSpill(GOIO_SENSOR_HANDLE hSensor)
+{
+	char fileName[64];
+	sprintf(fileName, "/tmp/goio_simcheck_%d.spill", (int) getpid());
+
+	bool bConfigured = (0 == GoIO_Sensor_SetMeasurementQueueConfig(hSensor, 50, GOIO_QUEUE_OVERFLOW_DROP_OLDEST, 0)) &&
+		(0 == GoIO_Sensor_SetMeasurementSpillFile(hSensor, fileName, 40));
+	bool bStarted = bConfigured && StartMeasurements(hSensor, 0.001);
+	usleep(1500000);
+	StopMeasurements(hSensor);
+
+	int nAvailable = GoIO_Sensor_GetNumMeasurementsAvailable(hSensor);
+	GapCounter gaps;
+	long long nRead = DrainSensor(hSensor, CHECK_READ_BUF_SIZE, &gaps);
+	GoIOCounters counters;
+	memset(&counters, 0, sizeof(counters));
+	GoIO_Diags_GetCounters(hSensor, &counters);
+	bool bStopped = (0 == GoIO_Sensor_SetMeasurementSpillFile(hSensor, NULL, 0));
+	GoIO_Sensor_SetMeasurementQueueConfig(hSensor, 1999, GOIO_QUEUE_OVERFLOW_DROP_OLDEST, 0);
+
+	return Report("spill", bStarted && bStopped && (nRead >= 1000) && (nRead == nAvailable) && (0 == gaps.nGaps) &&
+		(counters.packetsSpilled > 0) && (0 == counters.packetsDropped) && (0 == counters.spillErrors),
+		"%lld read of %d available, %lld gaps, %llu packets spilled, %llu dropped, %llu spill errors", nRead, nAvailable,
+		gaps.nGaps, (unsigned long long) counters.packetsSpilled, (unsigned long long) counters.packetsDropped, 
+		(unsigned long long) counters.spillErrors);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+// batches
+
+struct BatchLog
+{
+	GapCounter gaps;
+	std::vector<int> sizes;
+};
+
+static void OnBatch(GOIO_SENSOR_HANDLE /*hSensor*/, void *pContext, const gtype_int32 *pMeasurements, gtype_int32 numMeasurements)
+{
+	BatchLog *pLog = (BatchLog *) pContext;
+	pLog->gaps.Add(pMeasurements, numMeasurements);
+	pLog->sizes.push_back(numMeasurements);
+}
+
+//Collect callback batches for fSeconds at 10 ms, where the simulator packs 2 measurements per packet.
+static bool CollectBatches(GOIO_SENSOR_HANDLE hSensor, int minBatchSize, int maxLatencyMs, double fSeconds, BatchLog *pLog)
+{
+	if (0 != GoIO_Sensor_SetMeasurementCallback(hSensor, OnBatch, pLog, minBatchSize, maxLatencyMs))
+		return false;
+	bool bStarted = StartMeasurements(hSensor, 0.01);
+	usleep((useconds_t) (fSeconds*1000000.0));
+	StopMeasurements(hSensor);
+	size_t nBeforeFlush = pLog->sizes.size();
+	GoIO_Sensor_SetMeasurementCallback(hSensor, NULL, NULL, 0, 0);
+	if (pLog->sizes.size() > nBeforeFlush)
+		pLog->sizes.pop_back();//The partial batch handed over when the callback was removed.
+	return bStarted;
+}
+
+static bool CheckBatches(GOIO_SENSOR_HANDLE hSensor)
+{
+	size_t i;
+
+	BatchLog unbounded;
+	bool bUnboundedOK = CollectBatches(hSensor, 50, 0, 1.6, &unbounded) && (unbounded.sizes.size() >= 2);
+	for (i = 0; i < unbounded.sizes.size(); i++)
+		bUnboundedOK = bUnboundedOK && (unbounded.sizes[i] >= 50) && (unbounded.sizes[i] < 50 + 2);
+	bUnboundedOK = Report("batches", bUnboundedOK && (0 == unbounded.gaps.nGaps), 
+		"min 50, no latency limit: %d full batches of 50..51, %lld gaps", (int) unbounded.sizes.size(), unbounded.gaps.nGaps);
+
+	BatchLog bounded;
+	bool bBoundedOK = CollectBatches(hSensor, 1000, 100, 1.0, &bounded) && (bounded.sizes.size() >= 3);
+	for (i = 0; i < bounded.sizes.size(); i++)
+		bBoundedOK = bBoundedOK && (bounded.sizes[i] < 1000);
+	bBoundedOK = Report("batches", bBoundedOK && (0 == bounded.gaps.nGaps),
+		"min 1000, latency 100 ms: %d partial batches, %lld gaps", (int) bounded.sizes.size(), bounded.gaps.nGaps);
+
+	return bUnboundedOK && bBoundedOK;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+// waits
+
+static bool CheckWaits(GOIO_SENSOR_HANDLE hSensor)
+{
+	GoIO_Sensor_ClearIO(hSensor);
+	bool bStarted = StartMeasurements(hSensor, 0.01);
+	unsigned long long startMs = CheckNowMs();
+	int nAvailable = GoIO_Sensor_WaitForMeasurements(hSensor, 20, 2000);
+	unsigned long long waitMs = CheckNowMs() - startMs;
+
+	//20 measurements take 200 ms to arrive, so a wait that returns much sooner did not really wait.
+	bool bWaitOK = Report("waits", bStarted && (nAvailable >= 20) && (waitMs >= 100) && (waitMs < 1500),
+		"waiting for 20 measurements at 10 ms returned %d after %llu ms", nAvailable, waitMs);
+
+	startMs = CheckNowMs();
+	int nReady = GoIO_WaitAny(&hSensor, 1, 1000000, 300);
+	unsigned long long waitAnyMs = CheckNowMs() - startMs;
+	StopMeasurements(hSensor);
+	GoIO_Sensor_ClearIO(hSensor);
+
+	bool bWaitAnyOK = Report("waits", (-1 == nReady) && (waitAnyMs >= 250) && (waitAnyMs < 1500),
+		"GoIO_WaitAny() for 1000000 measurements returned %d after %llu ms, timeout 300 ms", nReady, waitAnyMs);
+
+	return bWaitOK && bWaitAnyOK;
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+// readiness
+
+static bool CheckReadiness(GOIO_SENSOR_HANDLE hSensor)
+{
+	std::vector<gtype_int32> buf(CHECK_READ_BUF_SIZE);
+	GapCounter gaps;
+	int nWakeups = 0, nTimeouts = 0;
+
+	struct pollfd pfd;
+	pfd.fd = GoIO_Sensor_GetReadinessFd(hSensor);
+	pfd.events = POLLIN;
+	bool bStarted = (pfd.fd >= 0) && (0 == GoIO_Sensor_SetReadinessWatermark(hSensor, 10)) && 
+		StartMeasurements(hSensor, 0.001);
+	unsigned long long endMs = CheckNowMs() + 2000;
+	while (bStarted && (CheckNowMs() < endMs))
+	{
+		pfd.revents = 0;
+		if (poll(&pfd, 1, 1000) <= 0)
+		{
+			nTimeouts++;
+			continue;
+		}
+		gtype_uint64 signalCount;
+		if (read(pfd.fd, &signalCount, sizeof(signalCount)) != sizeof(signalCount))
+			continue;
+		nWakeups++;
+
+		//Leave half the queue behind, so the fd is rearmed while measurements are still waiting.
+		int nCount = GoIO_Sensor_GetNumMeasurementsAvailable(hSensor)/2;
+		if (nCount < 1)
+			nCount = 1;
+		nCount = GoIO_Sensor_ReadRawMeasurements(hSensor, &buf[0], (nCount < CHECK_READ_BUF_SIZE) ? nCount : CHECK_READ_BUF_SIZE);
+		if (nCount > 0)
+			gaps.Add(&buf[0], nCount);
+	}
+	StopMeasurements(hSensor);
+	GoIO_Sensor_SetReadinessWatermark(hSensor, 1);
+	GoIO_Sensor_ClearIO(hSensor);
+
+	return Report("readiness", bStarted && (nWakeups >= 100) && (0 == nTimeouts) && (0 == gaps.nGaps),
+		"%d wakeups, %d poll timeouts, %lld gaps", nWakeups, nTimeouts, gaps.nGaps);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+// broadcast
+
+static bool CheckBroadcast(GOIO_SENSOR_HANDLE hSensor)
+{
+	std::vector<gtype_int32> buf(CHECK_READ_BUF_SIZE);
+	GapCounter gaps;
+	unsigned long long worstMs = 0;
+	gtype_int32 measurement;
+
+	//The consumer never reads, so its ring fills up and the listener has to give up waiting for it.
+	GOIO_CONSUMER_HANDLE hConsumer = GoIO_Sensor_AddConsumer(hSensor, GOIO_CONSUMER_POLICY_BLOCK, 64);
+	bool bStarted = hConsumer && StartMeasurements(hSensor, 0.001);
+	for (int i = 0; bStarted && (i < 15); i++)
+	{
+		usleep(100000);
+		int nCount = GoIO_Sensor_ReadRawMeasurements(hSensor, &buf[0], CHECK_READ_BUF_SIZE);
+		if (nCount > 0)
+			gaps.Add(&buf[0], nCount);
+	}
+
+	for (int i = 0; bStarted && (i < 5); i++)
+	{
+		//Reading one measurement makes the listener wait for the consumer again, with m_pCallbackMutex free.
+		GoIO_Consumer_ReadRawMeasurements(hConsumer, &measurement, NULL, 1);
+		usleep(20000);
+		unsigned long long startMs = CheckNowMs();
+		GoIO_Sensor_SetMeasurementCallback(hSensor, NULL, NULL, 0, 0);
+		unsigned long long callMs = CheckNowMs() - startMs;
+		if (callMs > worstMs)
+			worstMs = callMs;
+	}
+	StopMeasurements(hSensor);
+	GoIO_Sensor_ClearIO(hSensor);
+	if (hConsumer)
+	{
+		GoIO_Consumer_ReadRawMeasurements(hConsumer, &measurement, NULL, 1);
+		GoIO_Consumer_Remove(hConsumer);
+	}
+
+	return Report("broadcast", bStarted && (worstMs < 250) && (0 == gaps.nGaps),
+		"GoIO_Sensor_SetMeasurementCallback() took up to %llu ms behind a stalled consumer, %lld gaps", worstMs, gaps.nGaps);
+}
+
+//--------------------------------------------------------------------------------------------------------------------------
+
+typedef bool (*CheckFunc)(GOIO_SENSOR_HANDLE hSensor);
+
+struct CheckEntry
+{
+	const char *pName;
+	CheckFunc pFunc;
+	const char *pSimulatorConfig;
+};
+
+//The simulated Go! Link will not measure faster than every 5 ms, so the 1 kHz checks override the period.
+static const CheckEntry checks[] =
+{
+	{ "leftovers", CheckLeftovers, "golink=1" },
+	{ "spill", CheckSpill, "golink=1,period_us=1000" },
+	{ "batches", CheckBatches, "golink=1" },
+	{ "waits", CheckWaits, "golink=1" },
+	{ "readiness", CheckReadiness, "golink=1,period_us=1000" },
+	{ "broadcast", CheckBroadcast, "golink=1,period_us=1000" },
+};
+#define NUM_CHECKS ((int) (sizeof(checks)/sizeof(checks[0])))
+
+static bool IsCheckSelected(const char *pName, int argc, char* argv[])
+{
+	if (argc < 2)
+		return true;
+	for (int i = 1; i < argc; i++)
+	{
+		if (0 == strcmp(pName, argv[i]))
+			return true;
+	}
+	return false;
+}
+
+int main(int argc, char* argv[])
+{
+	int i, j, nFailed = 0;
+
+	for (i = 1; i < argc; i++)
+	{
+		for (j = 0; (j < NUM_CHECKS) && strcmp(argv[i], checks[j].pName); j++)
+			;
+		if (NUM_CHECKS == j)
+		{
+			fprintf(stderr, "usage: GoIO_SimCheck [check ...]\n  checks:");
+			for (j = 0; j < NUM_CHECKS; j++)
+				fprintf(stderr, " %s", checks[j].pName);
+			fprintf(stderr, "\n");
+			return 1;
+		}
+	}
+
+	if (0 != GoIO_Init())
+	{
+		fprintf(stderr, "GoIO_SimCheck: GoIO_Init() failed\n");
+		return 1;
+	}
+	GoIO_Diags_SetReplayConfig("");
+	if (0 != GoIO_Diags_SetSimulatorConfig("golink=1"))
+	{
+		printf("SKIP: the simulator is not supported on this platform\n");
+		GoIO_Uninit();
+		return CHECK_SKIPPED;
+	}
+
+	for (i = 0; i < NUM_CHECKS; i++)
+	{
+		if (!IsCheckSelected(checks[i].pName, argc, argv))
+			continue;
+
+		//Each check gets a freshly opened sensor, so one that fails cannot upset the next.
+		GoIO_Diags_SetSimulatorConfig(checks[i].pSimulatorConfig);
+		GOIO_SENSOR_HANDLE hSensor = OpenSimulatedGoLink();
+		if (!hSensor)
+			Report(checks[i].pName, false, "cannot open a simulated Go! Link");
+		if ((!hSensor) || !checks[i].pFunc(hSensor))
+			nFailed++;
+		if (hSensor)
+			GoIO_Sensor_Close(hSensor);
+	}
+
+	GoIO_Diags_SetSimulatorConfig("");
+	GoIO_Uninit();
+
+	return (nFailed > 0) ? 1 : 0;
+}
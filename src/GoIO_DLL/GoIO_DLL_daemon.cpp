@@ -0,0 +1,655 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GoIO_DLL_daemon.cpp : Client side of goiod. See GoIO_DLL_daemon.h.
+//
+
+#ifdef TARGET_OS_LINUX
+
+#include "GTypes.h"
+#include "GUtils.h"
+#include "GThread.h"
+#include "GSkipStream.h"
+#include "GMBLSensor.h"
+#include "GoIO_DLL_daemon.h"
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+class CGoIODaemonSensor
+{
+public:
+	CGoIODaemonSensor()
+	{
+		m_sensorId = 0;
+		m_vendorId = 0;
+		m_productId = 0;
+		memset(&m_openResponse, 0, sizeof(m_openResponse));
+		memset(&m_metadata, 0, sizeof(m_metadata));
+		m_pMutex = GThread::OSCreateMutex(GSTD_S(""));
+	}
+	~CGoIODaemonSensor()
+	{
+		if (m_pMutex)
+			GThread::OSDestroyMutex(m_pMutex);
+	}
+
+	gtype_uint64 m_sensorId;
+	cppstring m_sDeviceName;
+	gtype_int32 m_vendorId;
+	gtype_int32 m_productId;
+	GoIODaemonOpenResponse m_openResponse;
+	GSkipRecordingMetadata m_metadata;//as published when the sensor was opened.
+	GMBLSensor m_mblSensor;//only used to calibrate.
+	GSkipStreamReader m_reader;//this client's cursor into the published measurements.
+	OSMutex m_pMutex;//serializes use of m_reader.
+};
+
+static int daemonSocket = -1;
+//Lock order: daemonMutex, then a sensor's m_pMutex. daemonSocketMutex is never held along with either of them, so
+//the calls that only read the published measurements never wait behind a round trip to the daemon.
+static OSMutex daemonSocketMutex = NULL;//one request at a time on daemonSocket.
+static OSMutex daemonMutex = NULL;//protects daemonSensors and daemonDeviceLists.
+static std::vector<CGoIODaemonSensor *> daemonSensors;
+static std::map<gtype_int32, StringVector> daemonDeviceLists;//by product id, from the last device list update.
+
+static bool SendAll(int fd, const void *pBytes, size_t nNumBytes)
+{
+	const char *pNext = (const char *) pBytes;
+	while (nNumBytes > 0)
+	{
+		ssize_t nSent = send(fd, pNext, nNumBytes, MSG_NOSIGNAL);
+		if (nSent < 0)
+		{
+			if (EINTR == errno)
+				continue;
+			return false;
+		}
+		pNext += nSent;
+		nNumBytes -= nSent;
+	}
+	return true;
+}
+
+static bool RecvAll(int fd, void *pBytes, size_t nNumBytes)
+{
+	char *pNext = (char *) pBytes;
+	while (nNumBytes > 0)
+	{
+		ssize_t nReceived = recv(fd, pNext, nNumBytes, 0);
+		if (nReceived <= 0)
+		{
+			if ((nReceived < 0) && (EINTR == errno))
+				continue;
+			return false;
+		}
+		pNext += nReceived;
+		nNumBytes -= nReceived;
+	}
+	return true;
+}
+
+//Send a request and wait for the response. Caller must hold daemonSocketMutex, and no other client mutex. Returns 
+//the result from the daemon, or -1 if the daemon could not be reached. Up to nMaxRespBytes of the response payload
+//are copied to pRespBuf, and the full payload size is stored in (*pnRespBytes).
+static gtype_int32 CallDaemon(
+	gtype_uint32 op,				//[in] EGoIODaemonOp
+	gtype_uint64 sensorId,			//[in]
+	const void *pParams,			//[in] fixed size params, may be NULL.
+	gtype_uint32 nParamBytes,		//[in]
+	const void *pExtra,				//[in] variable size params that follow pParams, may be NULL.
+	gtype_uint32 nExtraBytes,		//[in]
+	void *pRespBuf,					//[out] may be NULL.
+	gtype_uint32 nMaxRespBytes,		//[in]
+	gtype_uint32 *pnRespBytes)		//[out] may be NULL.
+{
+	if (pnRespBytes)
+		(*pnRespBytes) = 0;
+	if ((daemonSocket < 0) || (nParamBytes + nExtraBytes > GOIO_DAEMON_MAX_PAYLOAD))
+		return -1;
+
+	GoIODaemonRequestHeader request;
+	request.op = op;
+	request.payloadBytes = nParamBytes + nExtraBytes;
+	request.sensorId = sensorId;
+	GoIODaemonResponseHeader response;
+	bool bOK = SendAll(daemonSocket, &request, sizeof(request)) &&
+		((0 == nParamBytes) || SendAll(daemonSocket, pParams, nParamBytes)) &&
+		((0 == nExtraBytes) || SendAll(daemonSocket, pExtra, nExtraBytes)) &&
+		RecvAll(daemonSocket, &response, sizeof(response)) &&
+		(response.payloadBytes <= GOIO_DAEMON_MAX_PAYLOAD);
+	if (bOK && (response.payloadBytes > 0))
+	{
+		std::vector<char> payload(response.payloadBytes);
+		bOK = RecvAll(daemonSocket, &payload[0], response.payloadBytes);
+		if (bOK && pRespBuf)
+			memcpy(pRespBuf, &payload[0], (response.payloadBytes < nMaxRespBytes) ? response.payloadBytes : nMaxRespBytes);
+	}
+	if (!bOK)
+	{
+		//The stream is out of step now, so give up on the daemon; the calls that follow fail.
+		GSTD_TRACEX(TRACE_SEVERITY_HIGH, "CallDaemon - lost the connection to goiod.");
+		close(daemonSocket);
+		daemonSocket = -1;
+		return -1;
+	}
+
+	if (pnRespBytes)
+		(*pnRespBytes) = response.payloadBytes;
+	return response.result;
+}
+
+//Return the sensor with its mutex locked, or NULL if hSensor is not open.
+static CGoIODaemonSensor *FindAndLockSensor(GOIO_SENSOR_HANDLE hSensor)
+{
+	CGoIODaemonSensor *pSensor = NULL;
+	if (daemonMutex && GThread::OSLockMutex(daemonMutex))
+	{
+		std::vector<CGoIODaemonSensor *>::iterator iter = std::find(daemonSensors.begin(), daemonSensors.end(), 
+			(CGoIODaemonSensor *) hSensor);
+		if (iter != daemonSensors.end())
+		{
+			pSensor = (*iter);
+			GThread::OSLockMutex(pSensor->m_pMutex);
+		}
+		GThread::OSUnlockMutex(daemonMutex);
+	}
+
+	return pSensor;
+}
+
+static void UnlockSensor(CGoIODaemonSensor *pSensor)
+{
+	GThread::OSUnlockMutex(pSensor->m_pMutex);
+}
+
+gtype_int32 DaemonClient_Init(const char *pSocketPath)
+{
+	DaemonClient_Uninit();
+
+	struct sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	if (strlen(pSocketPath) >= sizeof(addr.sun_path))
+		return -1;
+	strcpy(addr.sun_path, pSocketPath);
+
+	int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd < 0)
+		return -1;
+	if (0 != connect(fd, (struct sockaddr *) &addr, sizeof(addr)))
+	{
+		cppsstream ss;
+		ss << GSTD_S("DaemonClient_Init - unable to connect to goiod at ") << pSocketPath << GSTD_S(", errno = ") << errno;
+		GSTD_TRACEX(TRACE_SEVERITY_HIGH, ss.str());
+		close(fd);
+		return -1;
+	}
+
+	daemonSocketMutex = GThread::OSCreateMutex(GSTD_S(""));
+	daemonMutex = GThread::OSCreateMutex(GSTD_S(""));
+	daemonSocket = fd;
+	return 0;
+}
+
+void DaemonClient_Uninit(void)
+{
+	//The daemon closes whatever this client left open when the connection goes away.
+	for (size_t i = 0; i < daemonSensors.size(); i++)
+		delete daemonSensors[i];
+	daemonSensors.clear();
+	daemonDeviceLists.clear();
+
+	if (daemonSocket >= 0)
+		close(daemonSocket);
+	daemonSocket = -1;
+
+	if (daemonMutex)
+		GThread::OSDestroyMutex(daemonMutex);
+	daemonMutex = NULL;
+	if (daemonSocketMutex)
+		GThread::OSDestroyMutex(daemonSocketMutex);
+	daemonSocketMutex = NULL;
+}
+
+bool DaemonClient_IsConnected(void)
+{
+	return (NULL != daemonMutex);//stays true after the connection is lost, so the calls fail rather than going to USB.
+}
+
+gtype_int32 DaemonClient_UpdateListOfAvailableDevices(gtype_int32 vendorId, gtype_int32 productId)
+{
+	gtype_int32 numDevices = 0;
+	GoIODaemonDeviceListParams params;
+	params.vendorId = vendorId;
+	params.productId = productId;
+	std::vector<char> names(GOIO_DAEMON_MAX_PAYLOAD + 1, 0);
+	gtype_uint32 nNumBytes = 0;
+	gtype_int32 nResult = -1;
+	if (GThread::OSLockMutex(daemonSocketMutex))
+	{
+		nResult = CallDaemon(kGoIODaemonOp_UpdateListOfAvailableDevices, 0, &params, sizeof(params), NULL, 0,
+			&names[0], GOIO_DAEMON_MAX_PAYLOAD, &nNumBytes);
+		GThread::OSUnlockMutex(daemonSocketMutex);
+	}
+
+	if (GThread::OSLockMutex(daemonMutex))
+	{
+		StringVector &deviceVec = daemonDeviceLists[productId];
+		deviceVec.clear();
+		for (gtype_uint32 nOffset = 0; (nResult > 0) && (nOffset < nNumBytes); )
+		{
+			cppstring sName(&names[nOffset]);
+			nOffset += sName.length() + 1;
+			deviceVec.push_back(sName);
+		}
+		numDevices = deviceVec.size();
+		GThread::OSUnlockMutex(daemonMutex);
+	}
+
+	return numDevices;
+}
+
+gtype_int32 DaemonClient_GetNthAvailableDeviceName(char *pBuf, gtype_int32 bufSize, gtype_int32 vendorId, 
+	gtype_int32 productId, gtype_int32 N)
+{
+	gtype_int32 nResult = -1;
+	if ((VERNIER_DEFAULT_VENDOR_ID == vendorId) && (N >= 0) && GThread::OSLockMutex(daemonMutex))
+	{
+		const StringVector &deviceVec = daemonDeviceLists[productId];
+		if (((gtype_int32) deviceVec.size() > N) && ((gtype_int32) deviceVec[N].length() < bufSize))
+		{
+			strcpy(pBuf, deviceVec[N].c_str());
+			nResult = 0;
+		}
+		GThread::OSUnlockMutex(daemonMutex);
+	}
+
+	return nResult;
+}
+
+GOIO_SENSOR_HANDLE DaemonClient_SensorOpen(const char *pDeviceName, gtype_int32 vendorId, gtype_int32 productId,
+	gtype_int32 strictDDSValidationFlag)
+{
+	if ((NULL == pDeviceName) || (strlen(pDeviceName) >= GOIO_DAEMON_MAX_DEVICE_NAME) || !GThread::OSLockMutex(daemonSocketMutex))
+		return NULL;
+
+	CGoIODaemonSensor *pSensor = new CGoIODaemonSensor();
+	GoIODaemonOpenParams params;
+	memset(&params, 0, sizeof(params));
+	params.vendorId = vendorId;
+	params.productId = productId;
+	params.strictDDSValidationFlag = strictDDSValidationFlag;
+	gtype_uint32 nRespBytes = 0;
+	gtype_int32 nResult = CallDaemon(kGoIODaemonOp_SensorOpen, 0, &params, sizeof(params), pDeviceName, strlen(pDeviceName) + 1,
+		&pSensor->m_openResponse, sizeof(pSensor->m_openResponse), &nRespBytes);
+	GThread::OSUnlockMutex(daemonSocketMutex);
+	if ((0 == nResult) && (sizeof(pSensor->m_openResponse) == nRespBytes))
+	{
+		pSensor->m_sensorId = pSensor->m_openResponse.sensorId;
+		pSensor->m_sDeviceName = pDeviceName;
+		pSensor->m_vendorId = vendorId;
+		pSensor->m_productId = productId;
+		//The daemon starts publishing before it replies, so the stream is there already.
+		if (pSensor->m_reader.Open(pSensor->m_sDeviceName) && pSensor->m_reader.GetMetadata(&pSensor->m_metadata))
+		{
+			pSensor->m_mblSensor.SetDDSRec(pSensor->m_metadata.ddsRec, false);
+			if (GThread::OSLockMutex(daemonMutex))
+			{
+				daemonSensors.push_back(pSensor);
+				GThread::OSUnlockMutex(daemonMutex);
+			}
+			else
+				nResult = -1;
+		}
+		else
+			nResult = -1;
+
+		if ((0 != nResult) && GThread::OSLockMutex(daemonSocketMutex))
+		{
+			CallDaemon(kGoIODaemonOp_SensorClose, pSensor->m_sensorId, NULL, 0, NULL, 0, NULL, 0, NULL);
+			GThread::OSUnlockMutex(daemonSocketMutex);
+		}
+	}
+	else
+		nResult = -1;
+
+	if (0 != nResult)
+	{
+		delete pSensor;
+		pSensor = NULL;
+	}
+
+	return pSensor;
+}
+
+gtype_int32 DaemonClient_SensorClose(GOIO_SENSOR_HANDLE hSensor)
+{
+	//Unlink the sensor first, so that no other call can find it, then wait for any call that already has it.
+	CGoIODaemonSensor *pSensor = NULL;
+	if (daemonMutex && GThread::OSLockMutex(daemonMutex))
+	{
+		std::vector<CGoIODaemonSensor *>::iterator iter = std::find(daemonSensors.begin(), daemonSensors.end(), 
+			(CGoIODaemonSensor *) hSensor);
+		if (iter != daemonSensors.end())
+		{
+			pSensor = (*iter);
+			daemonSensors.erase(iter);
+		}
+		GThread::OSUnlockMutex(daemonMutex);
+	}
+	if (NULL == pSensor)
+		return -1;
+
+	GThread::OSLockMutex(pSensor->m_pMutex);
+	UnlockSensor(pSensor);
+
+	if (GThread::OSLockMutex(daemonSocketMutex))
+	{
+		CallDaemon(kGoIODaemonOp_SensorClose, pSensor->m_sensorId, NULL, 0, NULL, 0, NULL, 0, NULL);
+		GThread::OSUnlockMutex(daemonSocketMutex);
+	}
+	delete pSensor;
+
+	return 0;
+}
+
+gtype_int32 DaemonClient_GetOpenDeviceName(GOIO_SENSOR_HANDLE hSensor, char *pBuf, gtype_int32 bufSize, 
+	gtype_int32 *pVendorId, gtype_int32 *pProductId)
+{
+	gtype_int32 nResult = -1;
+	CGoIODaemonSensor *pSensor = FindAndLockSensor(hSensor);
+	if (pSensor)
+	{
+		if ((gtype_int32) pSensor->m_sDeviceName.length() < bufSize)
+		{
+			strcpy(pBuf, pSensor->m_sDeviceName.c_str());
+			(*pVendorId) = pSensor->m_vendorId;
+			(*pProductId) = pSensor->m_productId;
+			nResult = 0;
+		}
+		UnlockSensor(pSensor);
+	}
+
+	return nResult;
+}
+
+gtype_int32 DaemonClient_ClearIO(GOIO_SENSOR_HANDLE hSensor)
+{
+	CGoIODaemonSensor *pSensor = FindAndLockSensor(hSensor);
+	if (NULL == pSensor)
+		return -1;
+
+	//Only this client's measurements are discarded; the other clients of the device keep theirs.
+	pSensor->m_reader.SkipToNewest();
+	UnlockSensor(pSensor);
+	return 0;
+}
+
+gtype_int32 DaemonClient_SendCmdAndGetResponse(GOIO_SENSOR_HANDLE hSensor, unsigned char cmd, void *pParams, 
+	gtype_int32 nParamBytes, void *pRespBuf, gtype_int32 *pnRespBytes, gtype_int32 timeoutMs)
+{
+	gtype_uint64 sensorId = 0;
+	CGoIODaemonSensor *pSensor = FindAndLockSensor(hSensor);
+	if (pSensor)
+	{
+		sensorId = pSensor->m_sensorId;
+		UnlockSensor(pSensor);
+	}
+	if ((0 == sensorId) || (nParamBytes < 0) || ((nParamBytes > 0) && (NULL == pParams)))
+		return -1;
+
+	GoIODaemonCmdParams params;
+	params.cmd = cmd;
+	params.paramBytes = nParamBytes;
+	params.respBufBytes = (pRespBuf && pnRespBytes) ? (*pnRespBytes) : -1;
+	params.timeoutMs = timeoutMs;
+	gtype_int32 nResult = -1;
+	if (GThread::OSLockMutex(daemonSocketMutex))
+	{
+		gtype_uint32 nRespBytes = 0;
+		nResult = CallDaemon(kGoIODaemonOp_SendCmdAndGetResponse, sensorId, &params, sizeof(params), pParams, nParamBytes,
+			pRespBuf, (params.respBufBytes > 0) ? params.respBufBytes : 0, &nRespBytes);
+		if (params.respBufBytes >= 0)
+			(*pnRespBytes) = nRespBytes;
+		GThread::OSUnlockMutex(daemonSocketMutex);
+	}
+
+	//Like the in process GoIO Measurement Buffer, only the measurements that arrive after the start command count.
+	if ((0 == nResult) && (SKIP_CMD_ID_START_MEASUREMENTS == cmd))
+		DaemonClient_ClearIO(hSensor);
+
+	return nResult;
+}
+
+gtype_real64 DaemonClient_GetMeasurementTickInSeconds(GOIO_SENSOR_HANDLE hSensor)
+{
+	gtype_real64 tickTime = -1.0;
+	CGoIODaemonSensor *pSensor = FindAndLockSensor(hSensor);
+	if (pSensor)
+	{
+		tickTime = pSensor->m_openResponse.measurementTickInSeconds;
+		UnlockSensor(pSensor);
+	}
+
+	return tickTime;
+}
+
+gtype_real64 DaemonClient_GetMinimumMeasurementPeriod(GOIO_SENSOR_HANDLE hSensor)
+{
+	gtype_real64 period = -1.0;
+	CGoIODaemonSensor *pSensor = FindAndLockSensor(hSensor);
+	if (pSensor)
+	{
+		period = pSensor->m_openResponse.minimumMeasurementPeriod;
+		UnlockSensor(pSensor);
+	}
+
+	return period;
+}
+
+gtype_real64 DaemonClient_GetMaximumMeasurementPeriod(GOIO_SENSOR_HANDLE hSensor)
+{
+	gtype_real64 period = -1.0;
+	CGoIODaemonSensor *pSensor = FindAndLockSensor(hSensor);
+	if (pSensor)
+	{
+		period = pSensor->m_openResponse.maximumMeasurementPeriod;
+		UnlockSensor(pSensor);
+	}
+
+	return period;
+}
+
+gtype_int32 DaemonClient_SetMeasurementPeriod(GOIO_SENSOR_HANDLE hSensor, gtype_real64 desiredPeriod, gtype_int32 timeoutMs)
+{
+	gtype_uint64 sensorId = 0;
+	CGoIODaemonSensor *pSensor = FindAndLockSensor(hSensor);
+	if (pSensor)
+	{
+		sensorId = pSensor->m_sensorId;
+		UnlockSensor(pSensor);
+	}
+
+	gtype_int32 nResult = -1;
+	if ((0 != sensorId) && GThread::OSLockMutex(daemonSocketMutex))
+	{
+		GoIODaemonPeriodParams params;
+		memset(&params, 0, sizeof(params));
+		params.period = desiredPeriod;
+		params.timeoutMs = timeoutMs;
+		nResult = CallDaemon(kGoIODaemonOp_SetMeasurementPeriod, sensorId, &params, sizeof(params), NULL, 0, NULL, 0, NULL);
+		GThread::OSUnlockMutex(daemonSocketMutex);
+	}
+
+	return nResult;
+}
+
+gtype_real64 DaemonClient_GetMeasurementPeriod(GOIO_SENSOR_HANDLE hSensor, gtype_int32 timeoutMs)
+{
+	gtype_uint64 sensorId = 0;
+	CGoIODaemonSensor *pSensor = FindAndLockSensor(hSensor);
+	if (pSensor)
+	{
+		sensorId = pSensor->m_sensorId;
+		UnlockSensor(pSensor);
+	}
+
+	gtype_real64 period = -1.0;
+	if ((0 != sensorId) && GThread::OSLockMutex(daemonSocketMutex))
+	{
+		GoIODaemonPeriodParams params;
+		memset(&params, 0, sizeof(params));
+		params.timeoutMs = timeoutMs;
+		gtype_real64 respPeriod = -1.0;
+		gtype_uint32 nRespBytes = 0;
+		if ((0 == CallDaemon(kGoIODaemonOp_GetMeasurementPeriod, sensorId, &params, sizeof(params), NULL, 0, 
+				&respPeriod, sizeof(respPeriod), &nRespBytes)) && (sizeof(respPeriod) == nRespBytes))
+			period = respPeriod;
+		GThread::OSUnlockMutex(daemonSocketMutex);
+	}
+
+	return period;
+}
+
+gtype_int32 DaemonClient_GetNumMeasurementsAvailable(GOIO_SENSOR_HANDLE hSensor)
+{
+	gtype_int32 nResult = 0;
+	CGoIODaemonSensor *pSensor = FindAndLockSensor(hSensor);
+	if (pSensor)
+	{
+		nResult = pSensor->m_reader.GetNumAvailable();
+		UnlockSensor(pSensor);
+	}
+
+	return nResult;
+}
+
+gtype_int32 DaemonClient_ReadRawMeasurements(GOIO_SENSOR_HANDLE hSensor, gtype_int32 *pMeasurementsBuf, gtype_int32 maxCount)
+{
+	CGoIODaemonSensor *pSensor = FindAndLockSensor(hSensor);
+	if (NULL == pSensor)
+		return -1;
+
+	//Pick the raw values straight out of the shared memory, a contiguous run at a time.
+	gtype_int32 nNumRead = 0;
+	while (nNumRead < maxCount)
+	{
+		const GSkipStreamSample *pSamples = NULL;
+		int nNumSamples = pSensor->m_reader.Peek(&pSamples, maxCount - nNumRead);
+		if (nNumSamples <= 0)
+			break;
+		for (int i = 0; i < nNumSamples; i++)
+			pMeasurementsBuf[nNumRead + i] = pSamples[i].nRawMeasurement;
+		int nNumOverwritten = pSensor->m_reader.Consume(nNumSamples);
+		if (nNumOverwritten > 0)
+			memmove(&pMeasurementsBuf[nNumRead], &pMeasurementsBuf[nNumRead + nNumOverwritten],
+				(nNumSamples - nNumOverwritten)*sizeof(gtype_int32));
+		nNumRead += nNumSamples - nNumOverwritten;
+	}
+	UnlockSensor(pSensor);
+
+	return nNumRead;
+}
+
+gtype_int32 DaemonClient_GetLatestRawMeasurement(GOIO_SENSOR_HANDLE hSensor)
+{
+	gtype_int32 nResult = 0;
+	CGoIODaemonSensor *pSensor = FindAndLockSensor(hSensor);
+	if (pSensor)
+	{
+		GSkipStreamSample sample;
+		if (pSensor->m_reader.GetNewest(&sample))
+			nResult = sample.nRawMeasurement;
+		UnlockSensor(pSensor);
+	}
+
+	return nResult;
+}
+
+gtype_real64 DaemonClient_ConvertToVoltage(GOIO_SENSOR_HANDLE hSensor, gtype_int32 rawMeasurement)
+{
+	gtype_real64 volts = 0.0;
+	CGoIODaemonSensor *pSensor = FindAndLockSensor(hSensor);
+	if (pSensor)
+	{
+		volts = rawMeasurement*pSensor->m_metadata.fVoltsPerBit + pSensor->m_metadata.fVoltsOffset;
+		UnlockSensor(pSensor);
+	}
+
+	return volts;
+}
+
+gtype_real64 DaemonClient_CalibrateData(GOIO_SENSOR_HANDLE hSensor, gtype_real64 volts)
+{
+	gtype_real64 measurement = 0.0;
+	CGoIODaemonSensor *pSensor = FindAndLockSensor(hSensor);
+	if (pSensor)
+	{
+		measurement = pSensor->m_mblSensor.CalibrateData(volts);
+		UnlockSensor(pSensor);
+	}
+
+	return measurement;
+}
+
+gtype_int32 DaemonClient_GetProbeType(GOIO_SENSOR_HANDLE hSensor)
+{
+	gtype_int32 nResult = kProbeTypeAnalog5V;
+	CGoIODaemonSensor *pSensor = FindAndLockSensor(hSensor);
+	if (pSensor)
+	{
+		nResult = pSensor->m_metadata.nProbeType;
+		UnlockSensor(pSensor);
+	}
+
+	return nResult;
+}
+
+gtype_int32 DaemonClient_DDSMem_GetRecord(GOIO_SENSOR_HANDLE hSensor, GSensorDDSRec *pRec)
+{
+	CGoIODaemonSensor *pSensor = FindAndLockSensor(hSensor);
+	if (NULL == pSensor)
+		return -1;
+
+	(*pRec) = pSensor->m_metadata.ddsRec;
+	UnlockSensor(pSensor);
+	return 0;
+}
+
+#ifdef LIB_NAMESPACE
+}
+#endif
+
+#endif // TARGET_OS_LINUX
@@ -0,0 +1,175 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GoIO_DLL_daemon.h
+//
+// goiod(see GoIO_Daemon/goiod.cpp) owns the Go! devices on a computer, and lets any number of client processes share
+// them. When GoIO_Init() finds a daemon socket path(GoIO_SetDaemonSocketPath() or the GOIO_DAEMON environment
+// variable), the lib runs in client mode: it does not touch USB at all, and the GoIO_* routines listed below are
+// passed to the daemon instead of being handled in process.
+//
+// Commands travel over a Unix domain socket, one request and one response at a time per client. The daemon handles
+// each client on its own thread, and serializes the requests for each device, so a slow command from one client
+// holds up the other clients of that device, but not the clients of other devices.
+//
+// Measurements do not travel over the socket. The daemon publishes every open device(see GSkipStream.h), and each
+// client reads the shared memory ring directly with its own cursor, so GoIO_Sensor_ReadRawMeasurements() and friends
+// cost about as much as they do in process, and clients cannot slow each other down. A client that falls more than
+// a ring behind loses the oldest measurements instead.
+//
+// The routines that are passed to the daemon are listed with GoIO_SetDaemonSocketPath(). Of those, the conversion and
+// calibration routines use the metadata published with the measurements, so they do not need the daemon either.
+//
+// Devices are shared: every client that opens a device sees all of its measurements, and commands such as
+// SKIP_CMD_ID_START_MEASUREMENTS or GoIO_Sensor_SetMeasurementPeriod() affect all of its clients. The daemon opens
+// a device when its first client opens it, and closes it when its last client closes it or disconnects.
+//
+// Messages are in native byte order, since both ends are on the same computer: a GoIODaemonRequestHeader followed 
+// by payloadBytes of payload, answered with a GoIODaemonResponseHeader followed by payloadBytes of payload.
+
+#ifndef _GOIO_DLL_DAEMON_H_
+#define _GOIO_DLL_DAEMON_H_
+
+#include <stdlib.h>
+#include <string>
+#include "GoIO_DLL_interface.h"
+
+#define GOIO_DAEMON_MAX_PAYLOAD 65536
+#define GOIO_DAEMON_MAX_DEVICE_NAME 256
+
+// The socket that GoIO_Init() and goiod use when they are not given a path: in the user's private runtime directory 
+// if there is one, otherwise in GOIO_DAEMON_DEFAULT_SOCKET_DIR. Inline because goiod cannot see the lib's internals.
+inline std::string GoIODaemon_GetDefaultSocketPath(void)
+{
+	const char *pRuntimeDir = getenv("XDG_RUNTIME_DIR");
+	std::string sDir = (pRuntimeDir && pRuntimeDir[0]) ? pRuntimeDir : GOIO_DAEMON_DEFAULT_SOCKET_DIR;
+	return sDir + "/" GOIO_DAEMON_SOCKET_NAME;
+}
+
+enum EGoIODaemonOp
+{
+	kGoIODaemonOp_UpdateListOfAvailableDevices = 1,	//GoIODaemonDeviceListParams -> # of devices, NULL terminated names.
+	kGoIODaemonOp_SensorOpen,						//GoIODaemonOpenParams, then the NULL terminated name -> 
+													//GoIODaemonOpenResponse.
+	kGoIODaemonOp_SensorClose,
+	kGoIODaemonOp_SendCmdAndGetResponse,			//GoIODaemonCmdParams, then the cmd params -> the response bytes.
+	kGoIODaemonOp_SetMeasurementPeriod,				//GoIODaemonPeriodParams
+	kGoIODaemonOp_GetMeasurementPeriod				//GoIODaemonPeriodParams -> gtype_real64 period.
+};
+
+typedef struct
+{
+	gtype_uint32 op;				//EGoIODaemonOp
+	gtype_uint32 payloadBytes;
+	gtype_uint64 sensorId;			//from GoIODaemonOpenResponse, 0 for ops that do not take a sensor.
+} GoIODaemonRequestHeader;
+
+typedef struct
+{
+	gtype_int32 result;				//what the GoIO_* routine returned, -1 if the request was invalid.
+	gtype_uint32 payloadBytes;
+} GoIODaemonResponseHeader;
+
+typedef struct
+{
+	gtype_int32 vendorId;
+	gtype_int32 productId;
+} GoIODaemonDeviceListParams;
+
+typedef struct
+{
+	gtype_int32 vendorId;
+	gtype_int32 productId;
+	gtype_int32 strictDDSValidationFlag;
+	gtype_int32 reserved;
+} GoIODaemonOpenParams;
+
+typedef struct
+{
+	gtype_uint64 sensorId;
+	gtype_real64 measurementTickInSeconds;
+	gtype_real64 minimumMeasurementPeriod;
+	gtype_real64 maximumMeasurementPeriod;
+} GoIODaemonOpenResponse;
+
+typedef struct
+{
+	gtype_int32 cmd;
+	gtype_int32 paramBytes;
+	gtype_int32 respBufBytes;		//-1 if the caller passed no response buffer.
+	gtype_int32 timeoutMs;
+} GoIODaemonCmdParams;
+
+typedef struct
+{
+	gtype_real64 period;
+	gtype_int32 timeoutMs;
+	gtype_int32 reserved;
+} GoIODaemonPeriodParams;
+
+#ifdef TARGET_OS_LINUX
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+// Client side, called by the GoIO_* routines of the same names while DaemonClient_IsConnected().
+gtype_int32 DaemonClient_Init(const char *pSocketPath);
+void DaemonClient_Uninit(void);
+bool DaemonClient_IsConnected(void);
+gtype_int32 DaemonClient_UpdateListOfAvailableDevices(gtype_int32 vendorId, gtype_int32 productId);
+gtype_int32 DaemonClient_GetNthAvailableDeviceName(char *pBuf, gtype_int32 bufSize, gtype_int32 vendorId, 
+	gtype_int32 productId, gtype_int32 N);
+GOIO_SENSOR_HANDLE DaemonClient_SensorOpen(const char *pDeviceName, gtype_int32 vendorId, gtype_int32 productId,
+	gtype_int32 strictDDSValidationFlag);
+gtype_int32 DaemonClient_SensorClose(GOIO_SENSOR_HANDLE hSensor);
+gtype_int32 DaemonClient_GetOpenDeviceName(GOIO_SENSOR_HANDLE hSensor, char *pBuf, gtype_int32 bufSize, 
+	gtype_int32 *pVendorId, gtype_int32 *pProductId);
+gtype_int32 DaemonClient_ClearIO(GOIO_SENSOR_HANDLE hSensor);
+gtype_int32 DaemonClient_SendCmdAndGetResponse(GOIO_SENSOR_HANDLE hSensor, unsigned char cmd, void *pParams, 
+	gtype_int32 nParamBytes, void *pRespBuf, gtype_int32 *pnRespBytes, gtype_int32 timeoutMs);
+gtype_real64 DaemonClient_GetMeasurementTickInSeconds(GOIO_SENSOR_HANDLE hSensor);
+gtype_real64 DaemonClient_GetMinimumMeasurementPeriod(GOIO_SENSOR_HANDLE hSensor);
+gtype_real64 DaemonClient_GetMaximumMeasurementPeriod(GOIO_SENSOR_HANDLE hSensor);
+gtype_int32 DaemonClient_SetMeasurementPeriod(GOIO_SENSOR_HANDLE hSensor, gtype_real64 desiredPeriod, gtype_int32 timeoutMs);
+gtype_real64 DaemonClient_GetMeasurementPeriod(GOIO_SENSOR_HANDLE hSensor, gtype_int32 timeoutMs);
+gtype_int32 DaemonClient_GetNumMeasurementsAvailable(GOIO_SENSOR_HANDLE hSensor);
+gtype_int32 DaemonClient_ReadRawMeasurements(GOIO_SENSOR_HANDLE hSensor, gtype_int32 *pMeasurementsBuf, gtype_int32 maxCount);
+gtype_int32 DaemonClient_GetLatestRawMeasurement(GOIO_SENSOR_HANDLE hSensor);
+gtype_real64 DaemonClient_ConvertToVoltage(GOIO_SENSOR_HANDLE hSensor, gtype_int32 rawMeasurement);
+gtype_real64 DaemonClient_CalibrateData(GOIO_SENSOR_HANDLE hSensor, gtype_real64 volts);
+gtype_int32 DaemonClient_GetProbeType(GOIO_SENSOR_HANDLE hSensor);
+gtype_int32 DaemonClient_DDSMem_GetRecord(GOIO_SENSOR_HANDLE hSensor, GSensorDDSRec *pRec);
+
+#ifdef LIB_NAMESPACE
+}
+#endif
+
+#endif // TARGET_OS_LINUX
+
+#endif // _GOIO_DLL_DAEMON_H_
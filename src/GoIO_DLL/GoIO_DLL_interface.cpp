@@ -1,2819 +1,4686 @@
-/*********************************************************************************
-
-Copyright (c) 2010, Vernier Software & Technology
-All rights reserved.
-
-Redistribution and use in source and binary forms, with or without
-modification, are permitted provided that the following conditions are met:
-    * Redistributions of source code must retain the above copyright
-      notice, this list of conditions and the following disclaimer.
-    * Redistributions in binary form must reproduce the above copyright
-      notice, this list of conditions and the following disclaimer in the
-      documentation and/or other materials provided with the distribution.
-    * Neither the name of Vernier Software & Technology nor the
-      names of its contributors may be used to endorse or promote products
-      derived from this software without specific prior written permission.
-
-THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
-ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
-WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
-DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
-(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
-LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
-ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
-(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-**********************************************************************************/
-// GoIO_DLL_interface.cpp : Defines the exported methods for the GoIO_DLL .
-//
-
-#ifdef TARGET_OS_WIN
-	#include "stdafx.h"
-	#include "GoIO_DLL.h"
-	#include "WinEnumDevices.h"
-	
-	extern CGoIO_DLLApp theApp;
-#endif
-
-#ifdef LIB_NAMESPACE
-namespace LIB_NAMESPACE
-{
-}
-
-using namespace LIB_NAMESPACE;
-/****************************************************************************************************************
-So what is this LIB_NAMESPACE nonsense all about??
-
-We discovered empirically that some Linux versions of gcc 4.x had an unbelievably heinous bug. A call to a local
-function Z in shared library A might actually jump to local function Z in shared library B! We tried various compiler
-options(eg -fvisibility=hidden -fvisibility-inlines-hidden) but we could not prevent namespace pollution across 
-libraries.
-
-So, on Linux builds only, we define LIB_NAMESPACE, and in so doing put the bulk of the code in each shared library 
-in its own C++ namespace. For libGoIO, we define LIB_NAMESPACE to be GoIO.
-****************************************************************************************************************/
-#endif
-
-#include "GSkipDevice.h"
-#include "GCyclopsDevice.h"
-#include "GMiniGCDevice.h"
-#include "GUSBDirectTempDevice.h"
-#include "GMBLSensor.h"
-#include "GUtils.h"
-#include "NonSmartSensorDDSRecs.h"
-#include "GoIO_DLL_interface.h"
-
-#ifdef USE_LIB_USB
-#include "libusb-1.0/libusb.h"
-libusb_context *pGoIO_libusbContext = NULL;   
-#endif
-
-#define SKIP_TIMEOUT_MS_READ_FLASH 2000
-#define SKIP_LIB_MNG_MUTEX_TIMEOUT_MS 500
-
-GPtrVector openSensorVector;//list of CGoIOSensors
-OSMutex openSensorVectorMutex = NULL;
-OSMutex multipleInstanceDeviceMutex = NULL;
-bool bMultipleInstanceDeviceMutexLocked = false;
-gtype_bool GoIOTraceEnableFlag = 0;
-
-class CGoIOSensor
-{
-public:
-	CGoIOSensor(GPortRef *pPortRef)
-	{
-		if (SKIP_DEFAULT_PRODUCT_ID == pPortRef->GetUSBProductID())
-			m_pInterface = new GSkipDevice(pPortRef);
-		else
-		if (USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID == pPortRef->GetUSBProductID())
-			m_pInterface = new GUSBDirectTempDevice(pPortRef);
-		else
-		if (CYCLOPS_DEFAULT_PRODUCT_ID == pPortRef->GetUSBProductID())
-			m_pInterface = new GCyclopsDevice(pPortRef);
-		else
-		if (MINI_GC_DEFAULT_PRODUCT_ID == pPortRef->GetUSBProductID())
-			m_pInterface = new GMiniGCDevice(pPortRef);
-		else
-			GSTD_ASSERT(false);
-		m_pMBLSensor = new GMBLSensor;
-	}
-	~CGoIOSensor()
-	{
-		if (m_pMBLSensor)
-			delete m_pMBLSensor;
-		if (m_pInterface)
-			delete m_pInterface;
-	}
-
-	GSkipBaseDevice *m_pInterface;
-	GMBLSensor *m_pMBLSensor;
-};
-
-static void OpenSensorVector_Clear()
-{
-	if (openSensorVectorMutex)
-	{
-		if (GThread::OSTryLockMutex(openSensorVectorMutex, 1))
-		{
-			while (openSensorVector.size() != 0)
-				GoIO_Sensor_Close(openSensorVector[0]);
-
-			GThread::OSUnlockMutex(openSensorVectorMutex);
-		}
-	}
-}
-
-static bool OpenSensorVector_FindAndLockSensor(GOIO_SENSOR_HANDLE hSensor)
-{
-	bool bFound = false;
-	if (openSensorVectorMutex)
-	{
-		if (GThread::OSTryLockMutex(openSensorVectorMutex, SKIP_LIB_MNG_MUTEX_TIMEOUT_MS))
-		{
-			GPtrVectorIterator iter = std::find(openSensorVector.begin(), openSensorVector.end(), hSensor);
-			if (iter != openSensorVector.end())
-			{
-				CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-				bFound = pGoIOSensor->m_pInterface->LockDevice(1);
-			}
-
-			GThread::OSUnlockMutex(openSensorVectorMutex);
-		}
-	}
-
-	return bFound;
-}
-
-static bool UnlockSensor(GOIO_SENSOR_HANDLE hSensor)
-{
-	CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-	return pGoIOSensor->m_pInterface->UnlockDevice();
-}
-
-static bool OpenSensorVector_FindSensorByName(
-	const char *pDeviceName,			//[in] NULL terminated string that uniquely identifies the device.
-	gtype_int32 vendorId,				//[in] USB vendor id
-	gtype_int32 productId)				//[in] USB product id
-{
-	bool bFound = false;
-	if (openSensorVectorMutex)
-	{
-		if (GThread::OSTryLockMutex(openSensorVectorMutex, SKIP_LIB_MNG_MUTEX_TIMEOUT_MS))
-		{
-			cppstring deviceName = pDeviceName;
-			GPortRef oldPortRef;
-
-			GPtrVectorIterator iter = openSensorVector.begin();
-			while (iter != openSensorVector.end())
-			{
-				CGoIOSensor *pGoIOSensor = (CGoIOSensor *) (*iter);
-				oldPortRef = pGoIOSensor->m_pInterface->GetPortRef();
-				if (((gtype_int32)oldPortRef.GetUSBVendorID() == vendorId) && ((gtype_int32)oldPortRef.GetUSBProductID() == productId))
-				{
-					if (deviceName == oldPortRef.GetLocation())
-					{
-						bFound = true;
-						break;
-					}
-				}
-				iter++;
-			}
-
-			GThread::OSUnlockMutex(openSensorVectorMutex);
-		}
-	}
-
-	return bFound;
-}
-
-static bool OpenSensorVector_AddSensor(GOIO_SENSOR_HANDLE hSensor)
-{
-	bool bSuccess = false;
-	if (openSensorVectorMutex)
-	{
-		if (GThread::OSTryLockMutex(openSensorVectorMutex, SKIP_LIB_MNG_MUTEX_TIMEOUT_MS))
-		{
-			bSuccess = true;
-			openSensorVector.push_back(hSensor);
-
-			GThread::OSUnlockMutex(openSensorVectorMutex);
-		}
-	}
-
-	return bSuccess;
-}
-
-
-static bool OpenSensorVector_RemoveSensor(GOIO_SENSOR_HANDLE hSensor)
-{
-	bool bSuccess = false;
-	if (openSensorVectorMutex)
-	{
-		if (GThread::OSTryLockMutex(openSensorVectorMutex, SKIP_LIB_MNG_MUTEX_TIMEOUT_MS))
-		{
-			GPtrVectorIterator iter = std::find(openSensorVector.begin(), openSensorVector.end(), hSensor);
-			if (iter != openSensorVector.end())
-			{
-				openSensorVector.erase(iter);
-				bSuccess = true;
-			}
-
-			GThread::OSUnlockMutex(openSensorVectorMutex);
-		}
-	}
-
-	return bSuccess;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_GetDLLVersion()
-		Added in version 2.00.
-	
-	Purpose:	This routine returns the major and minor version numbers for the instance of GoIO_DLL that is
-				currently running.
-
-				If a function is not guaranteed to be present in all supported versions of GoIO_DLL, then the line
-				"Added in version 'major.minor'" will appear in the function description in this file.
-
-				It is our intention that all versions of GoIO_DLL created subsequent to a given version, will be
-				backwards compatible with the older version. You should be able to replace an old version of GoIO_DLL
-				with a newer version and everything should still work without rebuilding your application.
-
-				Note that version major2.minor2 is later than version major1.minor1 
-				iff. ((major2 > major1) || ((major2 == major1) && (minor2 > minor1))).
-				
-				Backwards compatibility is definitely our intention, but we do not absolutely guarantee it. If you think
-				that you have detected a backwards compatibility bug, then please report it to Vernier Software & Technology.
-				Calling GoIO_GetVersion() from your application is a way to identify precisely which version of
-				GoIO_DLL you are actually using.
-
-
-	Return:		0 iff successful, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_GetDLLVersion(
-	gtype_uint16 *pMajorVersion, //[o]
-	gtype_uint16 *pMinorVersion) //[o]
-{
-	*pMajorVersion = 2;
-	*pMinorVersion = 54;
-	return 0;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Init()
-	
-	Purpose:	Call GoIO_Init() once before making any other GoIO function calls.
-				GoIO_Init() and GoIO_Uninit() should be called from the same thread.
-
-				This routine attempts to grab the mutex that controls access to Vernier
-				sensors. If Logger Pro, Logger Lite, or another GoIO application is currently
-				running, then this routine will fail to grab the device control mutex, so it
-				will return -1. Subsequent calls to GoIO functions will also fail until
-				the application is able to run GoIO_Init() successfully.
-
-	Return:		0 iff successful, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Init()
-{
-	InitSensorDefaultDDSRecs();
-
-	#ifdef TARGET_OS_WIN // If this is Windows...
-		if (!hWinSetupApiLibrary)
-			hWinSetupApiLibrary = WinLoadSetupApiLibrary();
-		if (!hWinHidDLibrary)
-			hWinHidDLibrary = WinLoadHidDLibrary();
-
-		if (!openSensorVectorMutex)
-		{
-			if (!bMultipleInstanceDeviceMutexLocked)
-			{
-				if (!multipleInstanceDeviceMutex)
-					multipleInstanceDeviceMutex = GThread::OSCreateMutex(GSTD_S("MultipleInstanceDeviceMutex"));
-				if (multipleInstanceDeviceMutex)
-					bMultipleInstanceDeviceMutexLocked = GThread::OSTryLockMutex(multipleInstanceDeviceMutex, 1);
-			}
-			if (bMultipleInstanceDeviceMutexLocked)
-				openSensorVectorMutex = GThread::OSCreateMutex(GSTD_S("GoIO_DLL_DeviceListMutex"));
-		}
-
-		if ((!openSensorVectorMutex) || (!hWinSetupApiLibrary) || (!hWinHidDLibrary))
-		{
-			GoIO_Uninit();
-			GSTD_TRACEX(TRACE_SEVERITY_HIGH, "GoIO_Init() failed - another GoIO client may be already running.");
-		}
-	#endif
-
-	#if defined (TARGET_OS_MAC) || defined (TARGET_OS_LINUX)
-		int status = 0; 
-	#ifdef USE_LIB_USB
-		if (pGoIO_libusbContext != NULL)
-			status = -1;
-		else
-			status = libusb_init(&pGoIO_libusbContext);
-		if (0 != status)
-		{
-			cppsstream ss1;
-			ss1 << GSTD_S("failed to init libusb (error %d)") << status;
-			GSTD_TRACE(ss1.str());
-		}
-
-		// libusb_set_debug(pGoIO_libusbContext, 3);
-	#endif
-
-		if (0 == status)
-		{
-			if (!openSensorVectorMutex)
-				openSensorVectorMutex = GThread::OSCreateMutex(GSTD_S("GoIO_DLL_DeviceListMutex"));
-		}
-
-		if (!openSensorVectorMutex)
-		{
-			GoIO_Uninit();
-			GSTD_TRACEX(TRACE_SEVERITY_HIGH, "GoIO_Init() failed - another GoIO client may be already running.");
-		}
-	#endif
-
-	return (openSensorVectorMutex != NULL) ? 0 : -1;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Uninit()
-	
-	Purpose:	Call GoIO_Uninit() once to 'undo' GoIO_Init().
-				GoIO_Init() and GoIO_Uninit() should be called from the same thread.
-
-	Return:		0 iff successful, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Uninit()
-{
-	gtype_int32 nResult = 0;
-	
-	OpenSensorVector_Clear();
-
-	if (openSensorVectorMutex)
-		GThread::OSDestroyMutex(openSensorVectorMutex);
-	openSensorVectorMutex = NULL;
-
-	#ifdef TARGET_OS_LINUX
-	#ifdef USE_LIB_USB // Only use this on Linux desktop builds for now
-		// Cleanup libusb
-		if (pGoIO_libusbContext != NULL)
-			libusb_exit(pGoIO_libusbContext);
-		pGoIO_libusbContext = NULL;
-	#endif
-	#endif
-
-	#ifdef TARGET_OS_WIN
-		if (bMultipleInstanceDeviceMutexLocked)
-		{
-			if (GThread::OSUnlockMutex(multipleInstanceDeviceMutex))
-				bMultipleInstanceDeviceMutexLocked = false;
-			else
-				nResult = -1;
-		}
-
-		if ((!bMultipleInstanceDeviceMutexLocked) && multipleInstanceDeviceMutex)
-		{
-			GThread::OSDestroyMutex(multipleInstanceDeviceMutex);
-			multipleInstanceDeviceMutex = NULL;
-		}
-
-		if (hWinHidDLibrary)
-			FreeLibrary(hWinHidDLibrary);
-		hWinHidDLibrary = NULL;
-
-		if (hWinSetupApiLibrary)
-			FreeLibrary(hWinSetupApiLibrary);
-		hWinSetupApiLibrary = NULL;
-	#endif
-
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Diags_SetDebugTraceThreshold()
-	
-	Purpose:	GoIO lib generates a variety of debugging messages when it runs. Each message is assigned a severity
-				when it is generated. Only messages that are assigned a priority >= the debug trace threshold are actually
-				sent to the debug output. Call GoIO_Diags_SetDebugTraceThreshold(GOIO_TRACE_SEVERITY_LOWEST) for max
-				debug output.
-				
-				On windows systems, these messages are passed to the OutputDebugString() function.
-				On Mac and Linux systems, these messages are sent to STDOUT and/or STDERR.
-
-	Return:		0 iff successful, else -1.
-
-****************************************************************************************************************************/
-#define GOIO_TRACE_SEVERITY_LOWEST 1
-#define GOIO_TRACE_SEVERITY_LOW 10
-#define GOIO_TRACE_SEVERITY_MEDIUM 50
-#define GOIO_TRACE_SEVERITY_HIGH 100
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_SetDebugTraceThreshold(
-	gtype_int32 threshold)	//[in] Only trace messages marked with a severity >= threshold are actually sent to the debug output.
-{
-	SUBSYS_TRACE_THRESH = threshold;
-	return 0;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_GetDebugTraceThreshold(
-	gtype_int32 *pThreshold)//[out]
-{
-	(*pThreshold) = SUBSYS_TRACE_THRESH;
-	return 0;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_UpdateListOfAvailableDevices()
-	
-	Purpose:	This routine queries the operating system to build a list of available devices
-				that have the specified USB vendor id and product id. Only Go! Link, Go! Temp, and Go! Motion
-				vendor and product id's are supported.
-
-	Return:		number of devices found.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_UpdateListOfAvailableDevices(
-	gtype_int32 vendorId,	//[in]
-	gtype_int32 productId)	//[in]
-{
-	gtype_int32 numDevices = 0;
-	if (VERNIER_DEFAULT_VENDOR_ID == vendorId)
-	{
-		StringVector deviceVec;
-		if (SKIP_DEFAULT_PRODUCT_ID == productId)
-		{
-			deviceVec = GSkipDevice::GetAvailableDevices();
-			GSkipDevice::StoreSnapshotOfAvailableDevices(deviceVec);
-		}
-		else
-		if (USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID == productId)
-		{
-			deviceVec = GUSBDirectTempDevice::GetAvailableDevices();
-			GUSBDirectTempDevice::StoreSnapshotOfAvailableDevices(deviceVec);
-		}
-		else
-		if (CYCLOPS_DEFAULT_PRODUCT_ID == productId)
-		{
-			deviceVec = GCyclopsDevice::GetAvailableDevices();
-			GCyclopsDevice::StoreSnapshotOfAvailableDevices(deviceVec);
-		}
-		else
-		if (MINI_GC_DEFAULT_PRODUCT_ID == productId)
-		{
-			deviceVec = GMiniGCDevice::GetAvailableDevices();
-			GMiniGCDevice::StoreSnapshotOfAvailableDevices(deviceVec);
-		}
-		numDevices = deviceVec.size();
-	}
-
-	return numDevices;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_GetNthAvailableDeviceName()
-	
-	Purpose:	Get a unique device name string for the n'th device in the list of known devices with a specified
-				USB vendor id and product id. This routine will only succeed if GoIO_UpdateListOfAvailableDevices()
-				has been called previously.
-
-	Return:		0 iff successful, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_GetNthAvailableDeviceName(
-	char *pBuf,		//[out] ptr to buffer to store device name string.
-	gtype_int32 bufSize,	//[in] number of bytes in buffer pointed to by pBuf. Strlen(pBuf) < bufSize, because the string is NULL terminated.
-	gtype_int32 vendorId,	//[in]
-	gtype_int32 productId,	//[in]
-	gtype_int32 N)			//[in] index into list of known devices, 0 => first device in list.
-{
-	gtype_int32 nResult = -1;
-	GSTD_ASSERT(pBuf != NULL);
-	GSTD_ASSERT(bufSize > 0);
-	cppstring deviceName;
-	if (VERNIER_DEFAULT_VENDOR_ID == vendorId)
-	{
-		if (SKIP_DEFAULT_PRODUCT_ID == productId)
-		{
-			const StringVector &skipDeviceVec = GSkipDevice::GetSnapshotOfAvailableDevices();
-			if ((gtype_int32)skipDeviceVec.size() > N)
-				deviceName = skipDeviceVec[N];
-		}
-		else
-		if (USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID == productId)
-		{
-			const StringVector &jonahDeviceVec = GUSBDirectTempDevice::GetSnapshotOfAvailableDevices();
-			if ((gtype_int32)jonahDeviceVec.size() > N)
-				deviceName = jonahDeviceVec[N];
-		}
-        else
-		if (CYCLOPS_DEFAULT_PRODUCT_ID == productId)
-		{
-			const StringVector &cyclopsDeviceVec = GCyclopsDevice::GetSnapshotOfAvailableDevices();
-			if ((gtype_int32)cyclopsDeviceVec.size() > N)
-				deviceName = cyclopsDeviceVec[N];
-		}
-        else
-		if (MINI_GC_DEFAULT_PRODUCT_ID == productId)
-		{
-			const StringVector &MiniGCDeviceVec = GMiniGCDevice::GetSnapshotOfAvailableDevices();
-			if ((gtype_int32)MiniGCDeviceVec.size() > N)
-				deviceName = MiniGCDeviceVec[N];
-		}
-		strncpy(pBuf, deviceName.c_str(), bufSize);
-		pBuf[bufSize - 1] = 0;
-		if ((strlen(pBuf) == deviceName.size()) && (strlen(pBuf) > 0))
-			nResult = 0;
-	}
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_Open()
-	
-	Purpose:	Open a specified Go! device and the attached sensor.. 
-	
-				If the device is already open, then this routine will fail.
-
-				In addition to establishing basic communication with the device, this routine will initialize the
-				device. If a smart sensor is attached to the Go! device, then this routine will query the device for
-				the DDS sensor configuration parameters.
-
-				The following commands are sent to Go! Temp devices:
-					SKIP_CMD_ID_INIT,
-					SKIP_CMD_ID_READ_LOCAL_NV_MEM. - read DDS record
-
-				The following commands are sent to Go! Link devices:
-					SKIP_CMD_ID_INIT,
-					SKIP_CMD_ID_GET_SENSOR_ID,
-					SKIP_CMD_ID_READ_REMOTE_NV_MEM, - read DDS record if this is a 'smart' sensor
-					SKIP_CMD_ID_SET_ANALOG_INPUT_CHANNEL. - based on sensor EProbeType
-
-				Since the device stops sending measurements in response to SKIP_CMD_ID_INIT, an application must send
-				SKIP_CMD_ID_START_MEASUREMENTS to the device in order to receive measurements.
-
-				At any given time, a sensor is 'owned' by only one thread. The thread that calls this routine is the
-				initial owner of the sensor. If a GoIO() call is made from a thread that does not own the sensor object
-				that is passed in, then the call will generally fail. To allow another thread to access a sensor,
-				the owning thread should call GoIO_Sensor_Unlock(), and then the new thread must call GoIO_Sensor_Lock().
-  
-	Return:		handle to open sensor device if successful, else NULL.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL GOIO_SENSOR_HANDLE GoIO_Sensor_Open(
-	const char *pDeviceName,			//[in] NULL terminated string that uniquely identifies the device.
-	gtype_int32 vendorId,				//[in] USB vendor id
-	gtype_int32 productId,				//[in] USB product id
-	gtype_int32 strictDDSValidationFlag)//[in] insist on exactly valid checksum if 1, else use a more lax validation test.
-{
-	//First find out if this device is already open.
-	CGoIOSensor *pNewSensor = NULL;
-	GPortRef newPortRef(kPortType_USB, pDeviceName, pDeviceName, vendorId, productId);
-	int nResult = 0;
-	GSensorDDSRec DDSRec;
-	int nBytesRead;
-
-	bool bFound = OpenSensorVector_FindSensorByName(pDeviceName, vendorId, productId);
-
-	if (bFound)
-		nResult = -1;
-	else
-	if (!openSensorVectorMutex)
-		nResult = -1;
-	else
-	if (VERNIER_DEFAULT_VENDOR_ID != vendorId)
-		nResult = -1;
-	else
-	if ((USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID != productId) && (SKIP_DEFAULT_PRODUCT_ID != productId) &&
-        (CYCLOPS_DEFAULT_PRODUCT_ID != productId) && (MINI_GC_DEFAULT_PRODUCT_ID != productId))
-		nResult = -1;
-
-	if (0 == nResult)
-	{
-		pNewSensor = new CGoIOSensor(&newPortRef);
-		pNewSensor->m_pInterface->SetDiagnosticsFlag(GoIOTraceEnableFlag != 0);
-		nResult = pNewSensor->m_pInterface->Open(&newPortRef);
-	}
-
-	if (0 == nResult)
-    {
-        GCyclopsInitParams initParams;
-        int initParamsSize = 0;
-        void *pInitParams = NULL;
-		int timeoutMs = SKIP_TIMEOUT_MS_DEFAULT;
-		if (CYCLOPS_DEFAULT_PRODUCT_ID == productId)
-		{
-			memset(&initParams, 0, sizeof(initParams));
-#ifdef TARGET_HANDHELD
-			initParams.hostType = SKIP_HOST_TYPE_CALCULATOR;
-#else
-			initParams.hostType = SKIP_HOST_TYPE_COMPUTER;
-#endif
-			pInitParams = &initParams;
-			initParamsSize = sizeof(initParams);
-        }
-		else if (SKIP_DEFAULT_PRODUCT_ID == productId)
-			timeoutMs = SKIP_TIMEOUT_MS_CMD_ID_INIT_WO_BUSY_STATUS;
-		else if (MINI_GC_DEFAULT_PRODUCT_ID == productId)
-			timeoutMs = SKIP_TIMEOUT_MS_CMD_ID_INIT_WO_BUSY_STATUS;
-
-
-		nResult = pNewSensor->m_pInterface->SendCmdAndGetResponse(SKIP_CMD_ID_INIT, pInitParams, initParamsSize, 
-								  NULL, NULL, timeoutMs);
-	}
-
-	if (0 == nResult)
-	{
-		pNewSensor->m_pInterface->OSClearMeasurementPacketQueue();
-
-		if (USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID == productId)
-		{
-			//This is a Jonah.
-			//Read the DDS memory.
-			nResult = pNewSensor->m_pInterface->ReadSensorDDSMemory((unsigned char *) &DDSRec, 0, sizeof(DDSRec), 
-				SKIP_TIMEOUT_MS_READ_DDSMEMBLOCK);
-			if (0 == nResult)
-			{
-				if (!GMBLSensor::VerifyDDSChecksum(DDSRec, (strictDDSValidationFlag != 0)))
-					nResult = -2;
-			}
-			if (0 == nResult)
-				pNewSensor->m_pMBLSensor->SetDDSRec(DDSRec, true);
-		}
-        else
-		if (CYCLOPS_DEFAULT_PRODUCT_ID == productId)
-		{
-			//This is Cyclops..
-			//Read the DDS memory. This is a fake read - we generate a Cyclops specific DDS record here. spam
-			pNewSensor->m_pInterface->ReadSensorDDSMemory((unsigned char *) &DDSRec, 0, sizeof(DDSRec), 
-				SKIP_TIMEOUT_MS_READ_DDSMEMBLOCK);
-			pNewSensor->m_pMBLSensor->SetDDSRec(DDSRec, true);
-		}
-		else
-		{
-			//This is a Skip or a Mini GC.
-			GSkipFlashMemoryRecord flashRec;
-			GSkipGetSensorIdCmdResponsePayload getSensorIdResponsePayload;
-
-			nResult = ((GSkipDevice *) pNewSensor->m_pInterface)->ReadSkipFlashRecord(&flashRec, SKIP_TIMEOUT_MS_READ_FLASH);
-			if (0 == nResult)
-				((GSkipDevice *) pNewSensor->m_pInterface)->SetSkipFlashRecord(flashRec);//Do this so that measurements are properly calibrated in ConvertToVoltage().
-
-			//Find out what sensor is connected.
-			if (0 == nResult)
-			{
-				nBytesRead = sizeof(GSkipGetSensorIdCmdResponsePayload);
-				nResult = pNewSensor->m_pInterface->SendCmdAndGetResponse(SKIP_CMD_ID_GET_SENSOR_ID, NULL, 0, 
-					&getSensorIdResponsePayload, &nBytesRead);
-			}
-			if (0 == nResult)
-			{
-				//Parse out sensor id.
-				int nSensorId;
-				GUtils::OSConvertBytesToInt(getSensorIdResponsePayload.lsbyteLswordSensorId, 
-					getSensorIdResponsePayload.msbyteLswordSensorId, getSensorIdResponsePayload.lsbyteMswordSensorId, 
-					getSensorIdResponsePayload.msbyteMswordSensorId, &nSensorId);
-
-				if (nSensorId < 0)
-					nSensorId = 0;
-				else
-				if (nSensorId > 255)
-					nSensorId = 0;
-
-				pNewSensor->m_pMBLSensor->SetID(nSensorId);
-				if (pNewSensor->m_pMBLSensor->IsSmartSensor())
-				{
-					//Read the DDS memory.
-					nResult = pNewSensor->m_pInterface->ReadSensorDDSMemory((unsigned char *) &DDSRec, 0, sizeof(DDSRec), 
-						SKIP_TIMEOUT_MS_READ_DDSMEMBLOCK);
-					if (0 == nResult)
-					{
-						if (!GMBLSensor::VerifyDDSChecksum(DDSRec, (strictDDSValidationFlag != 0)))
-							nResult = -2;
-					}
-					if (0 == nResult)
-						pNewSensor->m_pMBLSensor->SetDDSRec(DDSRec, true);
-				}
-			}
-			if (0 == nResult)
-			{
-				//Setup the analog input channel based on the sensor's probe type.
-				GSkipSetAnalogInputChannelParams setAnalogInputChannelParams;
-				setAnalogInputChannelParams.analogInputChannel = (pNewSensor->m_pMBLSensor->GetProbeType() == kProbeTypeAnalog10V) ? 
-					SKIP_ANALOG_INPUT_CHANNEL_VIN : SKIP_ANALOG_INPUT_CHANNEL_VIN_LOW;
-
-				nResult = pNewSensor->m_pInterface->SendCmdAndGetResponse(SKIP_CMD_ID_SET_ANALOG_INPUT_CHANNEL, 
-					&setAnalogInputChannelParams, sizeof(GSkipSetAnalogInputChannelParams), NULL, NULL);
-			}
-		}
-	}
-
-	if (0 != nResult)
-	{
-		if (pNewSensor)
-			delete pNewSensor;
-		pNewSensor = NULL;
-	}
-	else
-		//Add new sensor to list of open devices.
-		OpenSensorVector_AddSensor(pNewSensor);
-
-	return pNewSensor;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_Close()
-	
-	Purpose:	Close a specified sensor. After this routine succeeds the hSensor handle is no longer valid.
-	
-	Return:		0 if successful, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_Close(
-	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-
-		if (0 == (pGoIOSensor->m_pInterface->GetHostIOStatus() & SKIP_HOST_IO_STATUS_TIMED_OUT))
-		{
-			GSkipSetLedStateParams ledParams;		//Set the LED back to orange.
-			ledParams.color = kLEDOrange;
-			ledParams.brightness = kSkipOrangeLedBrightness;
-			pGoIOSensor->m_pInterface->SendCmdAndGetResponse(SKIP_CMD_ID_SET_LED_STATE, &ledParams, sizeof(ledParams), NULL, NULL);
-
-			if (pGoIOSensor->m_pInterface->AreMeasurementsEnabled())
-				pGoIOSensor->m_pInterface->SendCmd(SKIP_CMD_ID_STOP_MEASUREMENTS, NULL, 0);
-		}
-
-		pGoIOSensor->m_pInterface->Close();
-
-		OpenSensorVector_RemoveSensor(hSensor);
-
-		UnlockSensor(hSensor);
-
-		delete pGoIOSensor;
-	}
-
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_GetOpenDeviceName()
-	
-	Purpose:	Get the unique device name string and USB id's for a specified open device.
-
-	Return:		0 iff successful, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetOpenDeviceName(
-	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
-	char *pBuf,				//[out] ptr to buffer to store device name string.
-	gtype_int32 bufSize,	//[in] number of bytes in buffer pointed to by pBuf. Strlen(pBuf) < bufSize, because the string is NULL terminated.
-	gtype_int32 *pVendorId,	//[out]
-	gtype_int32 *pProductId)//[out]
-{
-	GSTD_ASSERT(pBuf != NULL);
-	GSTD_ASSERT(bufSize > 0);
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		GPortRef portRef = pGoIOSensor->m_pInterface->GetPortRef();
-		*pVendorId = portRef.GetUSBVendorID();
-		*pProductId = portRef.GetUSBProductID();
-		cppstring deviceName = portRef.GetLocation();
-		strncpy(pBuf, deviceName.c_str(), bufSize);
-		pBuf[bufSize - 1] = 0;
-		if ((strlen(pBuf) != deviceName.size()) || (strlen(pBuf) == 0))
-			nResult = -1;
-
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_Lock()
-	
-	Purpose:	Lock a specified sensor so that no other thread can access it. This routine will fail if the sensor
-				is currently locked by another thread.
-
-				GoIO_Sensor_Lock() increments the lock count for the specified sensor by 1. In order for a second
-				thread to acquire access to the sensor, the first thread must call GoIO_Sensor_Unlock() until the lock
-				count reaches 0. Note that the lock count is set to 1 by GoIO_Sensor_Open().
-				
-				It is ok for the lock count to be greater than 1 when GoIO_Sensor_Close() is called.
-
-				This is an advanced routine that most users should not use. It is only necessary if an application
-				needs to access a single sensor from multiple threads.
-	
-	Return:		0 if successful, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_Lock(
-	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
-	gtype_int32 timeoutMs)		//[in] wait this long to acquire the lock before failing.
-{
-	unsigned int nStartTime = GUtils::OSGetTimeStamp();
-	bool bLocked = false;
-	do
-	{
-		bLocked = OpenSensorVector_FindAndLockSensor(hSensor);
-		if (bLocked)
-			break;
-		else
-		{
-			int sleepTimeMs = nStartTime + timeoutMs - 10 - GUtils::OSGetTimeStamp();
-			if (sleepTimeMs <= 0)
-				break;
-			else
-			{
-				if (sleepTimeMs > 50)
-					sleepTimeMs = 50;
-				GUtils::Sleep(sleepTimeMs);
-			}
-		}
-	}
-	while ((GUtils::OSGetTimeStamp() - nStartTime) <= (unsigned int)timeoutMs);
-
-	return bLocked ? 0 : -1;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_Unlock()
-	
-	Purpose:	Decrement the lock count for the specified sensor by 1. This routine will fail if the sensor
-				is not currently locked by the calling thread.
-
-				In order for a second thread to acquire access to the sensor, the first thread must call 
-				GoIO_Sensor_Unlock() until the lock count reaches 0. Note that the lock count is set to 1 by 
-				GoIO_Sensor_Open().
-
-				If the lock count reaches zero, it is important to make a call to GoIO_Sensor_Lock() to lock the
-				device. This will prevent multiple threads from simultaneously accessing the device, which can cause
-				unpredictable results.
-				
-				It is ok for the lock count to be greater than 1 when GoIO_Sensor_Close() is called.
-
-				This is an advanced routine that most users should not use. It is only necessary if an application
-				needs to access a single sensor from multiple threads.
-	
-	Return:		0 if successful, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_Unlock(
-	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		UnlockSensor(hSensor); //Undo the FindAndLock.
-
-		if (!pGoIOSensor->m_pInterface->UnlockDevice())
-			nResult = -1;
-	}
-
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_ClearIO()
-	
-	Purpose:	Clear the input/output communication buffers for a specified sensor. 
-				This also expties the GoIO Measurement Buffer, which holds measurements that have been retrieved from 
-				the sensor.
-	
-	Return:		0 if successful, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_ClearIO(
-	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		nResult = pGoIOSensor->m_pInterface->ClearIO();
-
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_SendCmdAndGetResponse()
-	
-	Purpose:	Send a command to the specified Go! device and wait for a response. 
-	
-	Return:		0 if successful, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_SendCmdAndGetResponse(
-	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
-	unsigned char cmd,			//[in] command code. See SKIP_CMD_ID_* in GSkipCommExt.h.
-	void *pParams,				//[in] ptr to cmd specific parameter block, may be NULL. See GSkipCommExt.h.
-	gtype_int32 nParamBytes,	//[in] # of bytes in (*pParams).
-	void *pRespBuf,				//[out] ptr to destination buffer, may be NULL. See GSkipCommExt.h.
-	gtype_int32 *pnRespBytes,	//[in, out] ptr to size of of pRespBuf buffer on input, size of response on output, may be NULL if pRespBuf is NULL.
-	gtype_int32 timeoutMs)		//[in] # of milliseconds to wait for a reply before giving up. Go! devices should reply to almost all the 
-								//currently defined commands within SKIP_DEFAULT_TIMEOUT_MS(1000) milliseconds. In fact, typical response
-								//times are less than 50 milliseconds. See SKIP_TIMEOUT_MS_* definitions.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		GSTD_ASSERT(sizeof(gtype_int32) == sizeof(int));
-		nResult = pGoIOSensor->m_pInterface->SendCmdAndGetResponse(cmd, pParams, nParamBytes, pRespBuf, (int *) pnRespBytes, timeoutMs);
-
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_GetLastCmdResponseStatus()
-	
-	Purpose:	Get error information for the device. 
-	
-				In principle, any command sent to the device can result in an error. 
-				If GoIO_Sensor_SendCmdAndGetResponse() ever fails and returns a non-zero return code,
-				you can gather additional info about what went wrong by calling GoIO_Sensor_GetLastCmdResponseStatus().
-
-	Return:		0 if successful, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetLastCmdResponseStatus(
-	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
-	unsigned char *pLastCmd,	//[out] last cmd sent to the sensor
-	unsigned char *pLastCmdStatus,//[out] status of last command sent to the sensor.
-								  //If command ran successfully and the device reported good status, then this will be be SKIP_STATUS_SUCCESS(aka 0).
-								  //If no response has been reported back from the device, then this will be SKIP_STATUS_ERROR_COMMUNICATION.
-								  //If the device reported a failure, then this will be a cmd specific error, eg SKIP_STATUS_ERROR_...
-	unsigned char *pLastCmdWithErrorRespSentOvertheWire, //[out] last cmd sent that caused the device to report back an error.
-	unsigned char *pLastErrorSentOvertheWire)//[out] last error that came back from the device 'over the wire'.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pInterface->GetLastCmdResponseStatus(pLastCmd, pLastCmdStatus, pLastCmdWithErrorRespSentOvertheWire, pLastErrorSentOvertheWire);
-
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_SendCmd()
-	
-	Purpose:	GoIO_Sensor_SendCmd() is an advanced function. You should usually use 
-				GoIO_Sensor_SendCmdAndGetResponse() instead. After calling GoIO_Sensor_SendCmd(), you must call
-				GoIO_Sensor_GetNextResponse() before sending any more commands to the device.
-
-				The main reason that GoIO_Sensor_SendCmd() is made available to the user is to allow a program to send
-				SKIP_CMD_ID_START_MEASUREMENTS commands to several different devices as close together as possible so that
-				measurements start at about the same time on separate devices.
-	
-	Return:		0 if successful, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_SendCmd(
-	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
-	unsigned char cmd,	//[in] command code
-	void *pParams,			//[in] ptr to cmd specific parameter block, may be NULL. See GSkipCommExt.h.
-	gtype_int32 nParamBytes)//[in] # of bytes in (*pParams).
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		GSTD_ASSERT(sizeof(gtype_int32) == sizeof(int));
-		nResult = pGoIOSensor->m_pInterface->SendCmd(cmd, pParams, nParamBytes);
-
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_GetNextResponse()
-	
-	Purpose:	GoIO_Sensor_GetNextResponse() is an advanced function. You should usually use 
-				GoIO_Sensor_SendCmdAndGetResponse() instead. After calling GoIO_Sensor_SendCmd(), you must call
-				GoIO_Sensor_GetNextResponse() before sending any more commands to the device.
-
-
-	Return:		0 if successful, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetNextResponse(
-	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
-	void *pRespBuf,				//[out] ptr to destination buffer, may be NULL. See GSkipCommExt.h.
-	gtype_int32 *pnRespBytes,	//[in, out] ptr to size of of pRespBuf buffer on input, size of response on output, may be NULL if pRespBuf is NULL.
-	unsigned char *pCmd,		//[out] identifies which command this response is for. Ptr must NOT be NULL!
-	gtype_int32 *pErrRespFlag,	//[out] flag(1 or 0) indicating that the response contains error info. Ptr must NOT be NULL!
-	gtype_int32 nTimeoutMs)		//[in] # of milliseconds to wait before giving up.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		GSTD_ASSERT(sizeof(gtype_int32) == sizeof(int));
-		bool errRespFlag = false;
-		nResult = pGoIOSensor->m_pInterface->GetNextResponse(pRespBuf, (int *) pnRespBytes, pCmd, &errRespFlag, nTimeoutMs);
-		if (0 == nResult)
-			(*pErrRespFlag) = errRespFlag ? 1 : 0;
-
-
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_GetMeasurementTickInSeconds()
-	
-	Purpose:	The measurement period for Go! devices is specified in discrete 'ticks', so the actual time between 
-				measurements is an integer multiple of the tick time. The length of time between ticks is different 
-				for Go! Link versus Go! Temp. 
-	
-	Return:		If hSensor is not valid, then this routine returns -1.0, else the return value = the length of time
-				in seconds between ticks.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_real64 GoIO_Sensor_GetMeasurementTickInSeconds(
-	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
-{
-	gtype_real64 tickTime;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		tickTime = -1.0;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		tickTime = pGoIOSensor->m_pInterface->GetMeasurementTickInSeconds();
-
-		UnlockSensor(hSensor);
-	}
-
-	return tickTime;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_GetMinimumMeasurementPeriod()
-	
-	Return:		If hSensor is not valid, then this routine returns -1.0, else the return value = minimum measurement
-				period in seconds that is supported by the device.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_real64 GoIO_Sensor_GetMinimumMeasurementPeriod(
-	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
-{
-	gtype_real64 minPeriod;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		minPeriod = -1.0;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		minPeriod = pGoIOSensor->m_pInterface->GetMinimumMeasurementPeriodInSeconds();
-
-		UnlockSensor(hSensor);
-	}
-
-	return minPeriod;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_GetMaximumMeasurementPeriod()
-	
-	Return:		If hSensor is not valid, then this routine returns -1.0, else the return value = maximum measurement
-				period in seconds that is supported by the device.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_real64 GoIO_Sensor_GetMaximumMeasurementPeriod(
-	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
-{
-	gtype_real64 maxPeriod;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		maxPeriod = -1.0;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		maxPeriod = pGoIOSensor->m_pInterface->GetMaximumMeasurementPeriodInSeconds();
-
-		UnlockSensor(hSensor);
-	}
-
-	return maxPeriod;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_SetMeasurementPeriod()
-	
-	Purpose:	Set the measurement period to a specified number of seconds. The Go! sensor will report measurements
-				to the computer at the measurement period interval once measurements have been started. These 
-				measurements are held in the GoIO Measurement Buffer. 
-				See documentation for GoIO_Sensor_GetNumMeasurementsAvailable().
-
-				This routine sends SKIP_CMD_ID_SET_MEASUREMENT_PERIOD to the sensor with the parameter block configured 
-				for the desiredPeriod.
-
-				Because the measurement period is constrained to be a multiple of the tick returned by
-				GoIO_Sensor_GetMeasurementTickInSeconds(), and because it must be 
-					>= GoIO_Sensor_GetMinimumMeasurementPeriod(), and
-					<= GoIO_Sensor_GetMaximumMeasurementPeriod(), 
-				the actual period is slightly different than the desiredPeriod.
-
-				You can determine the actual period by calling GoIO_Sensor_GetMeasurementPeriod().
-
-				This routine will fail if we are currently collecting measurements from the sensor. Note that collection
-				is started by sending SKIP_CMD_ID_START_MEASUREMENTS to the sensor, and stopped by sending 
-				SKIP_CMD_ID_STOP_MEASUREMENTS.
-	
-	Return:		0 if successful, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_SetMeasurementPeriod(
-	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
-	gtype_real64 desiredPeriod,	//[in] desired measurement period in seconds.
-	gtype_int32 timeoutMs)		//[in] # of milliseconds to wait for a reply before giving up. SKIP_TIMEOUT_MS_DEFAULT is recommended.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		nResult = pGoIOSensor->m_pInterface->SetMeasurementPeriod(desiredPeriod, timeoutMs);
-
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_GetMeasurementPeriod()
-	
-	Return:		1000000.0 if not successful, else the measurement period in seconds.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_real64 GoIO_Sensor_GetMeasurementPeriod(
-	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
-	gtype_int32 timeoutMs)		//[in] # of milliseconds to wait for a reply before giving up. SKIP_TIMEOUT_MS_DEFAULT is recommended.
-{
-	gtype_real64 period;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		period = -1.0;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		period = pGoIOSensor->m_pInterface->GetMeasurementPeriod(timeoutMs);
-
-		UnlockSensor(hSensor);
-	}
-
-	return period;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_GetNumMeasurementsAvailable()
-	
-	Purpose:	Report the number of measurements currently stored in the GoIO Measurement Buffer. 
-
-				After SKIP_CMD_ID_START_MEASUREMENTS has been sent to the sensor, the sensor starts
-				sending measurements to the host computer. These measurements are stored in the 
-				GoIO Measurement Buffer. A separate GoIO Measurement Buffer is maintained for each
-				open sensor.
-
-				The first measurement is sent almost immediatedly after SKIP_CMD_ID_START_MEASUREMENTS
-				is issued. Subsequent measurements are sent at the currently configured measurement
-				period interval. See GoIO_Sensor_SetMeasurementPeriod().
-
-				Call GoIO_Sensor_ReadRawMeasurements() to retrieve measurements from the
-				GoIO Measurement Buffer. The GoIO Measurement Buffer is guaranteed to hold up to 1000
-				measurements. The buffer is circular, so if you do not service it often enough, the
-				oldest measurements in the buffer are lost. If you wish to capture all the 
-				measurements coming from the sensor, you must call GoIO_Sensor_ReadRawMeasurements()
-				often enough so that the GoIO_Sensor_GetNumMeasurementsAvailable() does not reach 1000.
-
-				Each of the following actions clears the GoIO Measurement Buffer:
-					1) Call GoIO_Sensor_ReadRawMeasurements() with count set to GoIO_Sensor_GetNumMeasurementsAvailable(), or
-					2) Call GoIO_Sensor_GetLatestRawMeasurement(), or
-					3) Call GoIO_Sensor_ClearIO().
-
-				The GoIO Measurement Buffer is empty after GoIO_Sensor_Open() is called. It does not
-				start filling up until SKIP_CMD_ID_START_MEASUREMENTS is sent to the sensor.
-
-				Note that the sensor stops sending measurements to the host computer after
-				SKIP_CMD_ID_STOP_MEASUREMENTS or SKIP_CMD_ID_INIT is sent, but sending these commands
-				does not clear the GoIO Measurement Buffer.
-
-	Return:		number of measurements currently stored in the GoIO Measurement Buffer. 
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetNumMeasurementsAvailable(
-GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
-{
-	gtype_int32 nResult = 0;
-	if (OpenSensorVector_FindAndLockSensor(hSensor))
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		nResult = pGoIOSensor->m_pInterface->MeasurementsAvailable();
-
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_ReadRawMeasurements()
-	
-	Purpose:	Retrieve measurements from the GoIO Measurement Buffer. The measurements reported
-				by this routine are actually removed from the GoIO Measurement Buffer.
-
-				After SKIP_CMD_ID_START_MEASUREMENTS has been sent to the sensor, the sensor starts
-				sending measurements to the host computer. These measurements are stored in the 
-				GoIO Measurement Buffer. A separate GoIO Measurement Buffer is maintained for each
-				open sensor. See the description of GoIO_Sensor_GetNumMeasurementsAvailable().
-
-				Even though a raw measurement is reported as an int32, it can be stored in a short 
-				integer: it ranges in value from -32768 to 32767.
-
-				To convert a raw measurement to a voltage use GoIO_Sensor_ConvertToVoltage().
-				To convert a voltage to a sensor specific calibrated unit, use GoIO_Sensor_CalibrateData().
-
-	Return:		number of measurements retrieved from the GoIO Measurement Buffer. This routine
-				returns immediately, so the return value may be less than maxCount.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_ReadRawMeasurements(
-	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
-	gtype_int32 *pMeasurementsBuf,	//[out] ptr to loc to store measurements.
-	gtype_int32 maxCount)			//[in] maximum number of measurements to copy to pMeasurementsBuf.
-{
-	gtype_int32 nResult = 0;
-	if (OpenSensorVector_FindAndLockSensor(hSensor))
-	{
-		intVector vec;
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		vec = pGoIOSensor->m_pInterface->ReadRawMeasurements(maxCount);
-		for (nResult = 0; (nResult < (gtype_int32)vec.size()) && (nResult < maxCount); nResult++)
-			pMeasurementsBuf[nResult] = vec[nResult];
-
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_GetLatestRawMeasurement()
-	
-	Purpose:	Report the most recent measurement put in the GoIO Measurement Buffer. If no 
-				measurements have been placed in the GoIO Measurement Buffer since it was
-				created byGoIO_Sensor_Open(), then report a value of 0. 
-				
-				This routine also empties the GoIO Measurement Buffer, so GoIO_Sensor_GetNumMeasurementsAvailable()
-				will report 0 after calling GoIO_Sensor_GetLatestRawMeasurement().
-
-				After SKIP_CMD_ID_START_MEASUREMENTS has been sent to the sensor, the sensor starts
-				sending measurements to the host computer. These measurements are stored in the 
-				GoIO Measurement Buffer. A separate GoIO Measurement Buffer is maintained for each
-				open sensor. See the description of GoIO_Sensor_GetNumMeasurementsAvailable().
-
-				Even though a raw measurement is reported as an int32, it can be stored in a short 
-				integer: it ranges in value from -32768 to 32767.
-
-				To convert a raw measurement to a voltage use GoIO_Sensor_ConvertToVoltage().
-				To convert a voltage to a sensor specific calibrated unit, use GoIO_Sensor_CalibrateData().
-
-	Return:		most recent measurement put in the GoIO Measurement Buffer. If no 
-				measurements have been placed in the GoIO Measurement Buffer since it was
-				created byGoIO_Sensor_Open(), then report a value of 0.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetLatestRawMeasurement(
-	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
-{
-	gtype_int32 nResult = 0;
-	if (OpenSensorVector_FindAndLockSensor(hSensor))
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		nResult = pGoIOSensor->m_pInterface->GetLatestRawMeasurement();
-
-		UnlockSensor(hSensor);
-	}
-	
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_ConvertToVoltage()
-	
-	Purpose:	Convert a raw measurement in the range -32768 to 32767 into a voltage value.
-				Depending on the type of sensor(see GoIO_Sensor_GetProbeType()), the voltage
-				may range from 0.0 to 5.0, or from -10.0 to 10.0 . For Go! Motion, voltage returned is simply distance
-				in meters.
-
-	Return:		voltage corresponding to a specified raw measurement value.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_real64 GoIO_Sensor_ConvertToVoltage(
-	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
-	gtype_int32 rawMeasurement)	//[in] raw measurement obtained from GoIO_Sensor_GetLatestRawMeasurement() or 
-								//GoIO_Sensor_ReadRawMeasurements().
-{
-	gtype_real64 volts = 0.0;
-	if (OpenSensorVector_FindAndLockSensor(hSensor))
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		volts = pGoIOSensor->m_pInterface->ConvertToVoltage(rawMeasurement, pGoIOSensor->m_pMBLSensor->GetProbeType());
-
-		UnlockSensor(hSensor);
-	}
-
-	return volts;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_CalibrateData()
-	
-	Purpose:	Convert a voltage value into a sensor specific unit.
-				What units this routine produces can be determined by calling
-				GoIO_Sensor_DDSMem_GetCalPage(hSensor, GoIO_Sensor_DDSMem_GetActiveCalPage(),...) .
-
-	Return:		value in sensor specific units corresponding to a specified voltage. Just return input volts
-				unless GoIO_Sensor_DDSMem_GetCalibrationEquation() indicates kEquationType_Linear.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_real64 GoIO_Sensor_CalibrateData(
-	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
-	gtype_real64 volts)			//[in] voltage value obtained from GoIO_Sensor_ConvertToVoltage();
-{
-	gtype_real64 measurement = 0.0;
-	if (OpenSensorVector_FindAndLockSensor(hSensor))
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		measurement = pGoIOSensor->m_pMBLSensor->CalibrateData(volts);
-
-		UnlockSensor(hSensor);
-	}
-
-	return measurement;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_GetProbeType()
-	
-	Purpose:	Find out if the probe type is kProbeTypeAnalog5V or kProbeTypeAnalog10V.
-
-				This attribute is dependent on the OperationType in the SensorDDSRecord. 
-				See GoIO_Sensor_DDSMem_GetOperationType().
-				If (2 == OperationType) then the sensor is kProbeTypeAnalog10V, else kProbeTypeAnalog5V.
-
-				Note that for Go! Link devices, SKIP_CMD_ID_SET_ANALOG_INPUT_CHANNEL must be sent to the device with
-				the analogInputChannel parameter set to SKIP_ANALOG_INPUT_CHANNEL_VIN_LOW for kProbeTypeAnalog5V,
-				or set to SKIP_ANALOG_INPUT_CHANNEL_VIN for kProbeTypeAnalog10V devices. Generally, application
-				programs do not have to deal with this, because GoIO_Sensor_Open() automatically sends
-				SKIP_CMD_ID_SET_ANALOG_INPUT_CHANNEL to the device with the appropriate parameters.
-
-	Return:		kProbeTypeAnalog5V or kProbeTypeAnalog10V.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetProbeType(
-	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
-{
-	gtype_int32 nResult = kProbeTypeAnalog5V;
-	if (OpenSensorVector_FindAndLockSensor(hSensor))
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		nResult = pGoIOSensor->m_pMBLSensor->GetProbeType();
-
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-
-/***************************************************************************************************************************/
-/***************************************************************************************************************************/
-/***************************************************************************************************************************
-GoIO_Sensor_DDSMem_* routines:
-
-Each GoIO sensor object maintains a SensorDDSRecord of type GSensorDDSRec. The fields in this record describe the sensor.
-The GoIO_Sensor_DDSMem_* routines allow an application program to access the SensorDDSRecord.
-See GSensorDDSMem.h for the declaration of GSensorDDSRec.
-
-Sensors come in 3 basic flavors:
-1) Smart sensors,
-2) AutoId capable sensors that are not smart, and
-3) Legacy sensors.
-
-Smart sensors store the entire 128 byte GSensorDDSRec record on the actual sensor hardware. This allows calibration
-data that is specific to a given sensor to be stored on the sensor. Smart sensors report an AutoId number
-in response to the SKIP_CMD_ID_GET_SENSOR_ID command that is >= kSensorIdNumber_FirstSmartSensor. 
-
-If a sensor reports an AutoId >= kSensorIdNumber_FirstSmartSensor, then GoIO_Sensor_Open() will get the GSensorDDSRec 
-info from the sensor hardware and store in the GoIO sensor object's SensorDDSRecord.
-
-AutoId capable sensors that are not smart report an AutoId value > 0 and < kSensorIdNumber_FirstSmartSensor. 
-
-Legacy (aka Dumb) sensors report an AutoId = 0.
-
-Non smart sensors just get default values for most of the fields in the SensorDDSRecord. The default calibration 
-parameters are configured so that GoIO_Sensor_CalibrateData() just reports volts.
-
-For all 3 types of sensors, SensorDDSRecord.SensorNumber = AutoId after GoIO_Sensor_Open().
-
-****************************************************************************************************************************/
-/***************************************************************************************************************************/
-/***************************************************************************************************************************/
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_DDSMem_WriteRecord()
-	
-	Purpose:	Write the SensorDDSRecord into a smart sensor's DDS memory hardware. 
-				Before the record is written to the sensor, SensorDDSRecord.Checksum is recalculated.
-				Before the record is written to the sensor, a copy of the record is marshalled into little endian format,
-				and then this copy is actually written to the sensor.
-
-				WARNING: Be careful about using this routine. Changing a smart sensor's DDS memory can cause the sensor
-				to stop working with Logger Pro.
-	
-	Return:		0 if successful, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_WriteRecord(
-	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
-	gtype_int32 timeoutMs)		//[in] # of milliseconds to wait for a reply before giving up. SKIP_TIMEOUT_MS_WRITE_DDSMEMBLOCK is recommended.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-
-		if (SKIP_DEFAULT_PRODUCT_ID == pGoIOSensor->m_pInterface->GetProductID())
-		{
-			//Verify that we are dealing with a smart sensor.
-			//Do not try to write the SensorDDSRecord unless this is a smart sensor because old versions of Go! Link(ver. 1.5426)
-			//will hang if we try to write the SensorDDSRecord when no smart sensor is connected.
-			GSkipGetSensorIdCmdResponsePayload getSensorIdResponsePayload;
-			int nBytesRead = sizeof(GSkipGetSensorIdCmdResponsePayload);
-			nResult = pGoIOSensor->m_pInterface->SendCmdAndGetResponse(SKIP_CMD_ID_GET_SENSOR_ID, NULL, 0, 
-				&getSensorIdResponsePayload, &nBytesRead);
-			if (0 == nResult)
-			{
-				//Parse out sensor id.
-				int nSensorId;
-				GUtils::OSConvertBytesToInt(getSensorIdResponsePayload.lsbyteLswordSensorId, 
-					getSensorIdResponsePayload.msbyteLswordSensorId, getSensorIdResponsePayload.lsbyteMswordSensorId, 
-					getSensorIdResponsePayload.msbyteMswordSensorId, &nSensorId);
-
-				if (nSensorId < 0)
-					nSensorId = 0;
-				else
-				if (nSensorId > 255)
-					nSensorId = 0;
-
-				if (nSensorId < kSensorIdNumber_FirstSmartSensor)
-					nResult = -1;
-			}
-		}
-		else if (USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID == pGoIOSensor->m_pInterface->GetProductID())
-			nResult = 0;
-		else if (MINI_GC_DEFAULT_PRODUCT_ID == pGoIOSensor->m_pInterface->GetProductID())
-			nResult = 0;
-		else
-			nResult = -1;
-
-		if (0 == nResult)
-		{
-			//Update checksum.
-			pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->Checksum = 
-				GMBLSensor::CalculateDDSDataChecksum(*pGoIOSensor->m_pMBLSensor->GetDDSRecPtr());
-
-			//Marshall the SensorDDSRecord data so that it is in little-endian format.
-			GSensorDDSRec littleEndianRec;
-			GMBLSensor::MarshallDDSRec(&littleEndianRec, *pGoIOSensor->m_pMBLSensor->GetDDSRecPtr());
-
-			//Write the data to the sensor!
-			nResult = pGoIOSensor->m_pInterface->WriteSensorDDSMemory((unsigned char *) &littleEndianRec, 0, 
-				sizeof(littleEndianRec), timeoutMs);
-		}
-
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_DDSMem_ReadRecord()
-	
-	Purpose:	Read the SensorDDSRecord from a smart sensor's DDS memory hardware. 
-
-				After the record is read from the sensor, it is unmarshalled from little endian format into processor
-				specific format.
-	
-	Return:		0 if successful, 
-				else if data validation fails then -2,
-				else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_ReadRecord(
-	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
-	gtype_int32 strictDDSValidationFlag,//[in] insist on exactly valid checksum if 1, else use a more lax validation test.
-	gtype_int32 timeoutMs)	//[in] # of milliseconds to wait for a reply before giving up. SKIP_TIMEOUT_MS_READ_DDSMEMBLOCK is recommended.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		GSensorDDSRec littleEndianRec;
-
-		if (SKIP_DEFAULT_PRODUCT_ID == pGoIOSensor->m_pInterface->GetProductID())
-		{
-			//Verify that we are dealing with a smart sensor.
-			//Do not try to read the SensorDDSRecord unless this is a smart sensor because old versions of Go! Link(ver. 1.5426)
-			//will hang if we try to read the SensorDDSRecord when no smart sensor is connected.
-			GSkipGetSensorIdCmdResponsePayload getSensorIdResponsePayload;
-			int nBytesRead = sizeof(GSkipGetSensorIdCmdResponsePayload);
-			nResult = pGoIOSensor->m_pInterface->SendCmdAndGetResponse(SKIP_CMD_ID_GET_SENSOR_ID, NULL, 0, 
-				&getSensorIdResponsePayload, &nBytesRead);
-			if (0 == nResult)
-			{
-				//Parse out sensor id.
-				int nSensorId;
-				GUtils::OSConvertBytesToInt(getSensorIdResponsePayload.lsbyteLswordSensorId, 
-					getSensorIdResponsePayload.msbyteLswordSensorId, getSensorIdResponsePayload.lsbyteMswordSensorId, 
-					getSensorIdResponsePayload.msbyteMswordSensorId, &nSensorId);
-
-				if (nSensorId < 0)
-					nSensorId = 0;
-				else
-				if (nSensorId > 255)
-					nSensorId = 0;
-
-				if (nSensorId < kSensorIdNumber_FirstSmartSensor)
-					nResult = -1;
-			}
-		}
-		else
-			nResult = 0;	//Let the following code catch errors.
-
-		if (0 == nResult)
-		{
-			nResult = pGoIOSensor->m_pInterface->ReadSensorDDSMemory((unsigned char *) &littleEndianRec, 0, 
-				sizeof(littleEndianRec), timeoutMs);
-		}
-
-		if (0 == nResult)
-		{
-			if (!GMBLSensor::VerifyDDSChecksum(littleEndianRec, (strictDDSValidationFlag != 0)))
-				nResult = -2;
-		}
-
-		if (0 == nResult)
-			pGoIOSensor->m_pMBLSensor->SetDDSRec(littleEndianRec, true);
-
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_DDSMem_SetRecord()
-	
-	Purpose:	Update the SensorDDSRecord. 
-				This routine does not send data to the sensor's DDS memory hardware - use GoIO_Sensor_DDSMem_WriteRecord for that.
-
-	Return:		0 if hSensor is valid, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetRecord(
-	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
-	const GSensorDDSRec *pRec)	//[in] ptr to data to copy into the SensorDDSRecord.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-
-
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->SetDDSRec(*pRec, false);
-
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_DDSMem_GetRecord()
-	
-	Purpose:	Get a copy of the SensorDDSRecord. 
-				This routine does not read data from the sensor's DDS memory hardware - use GoIO_Sensor_DDSMem_ReadRecord for that.
-
-	Return:		0 if hSensor is valid, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetRecord(
-	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
-	GSensorDDSRec *pRec)		//[out] ptr to dest buf to copy the SensorDDSRecord into.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRec(pRec);
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_DDSMem_CalculateChecksum()
-	
-	Return:		0 if hSensor is valid, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_CalculateChecksum(
-	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
-	unsigned char *pChecksum)	//[out] ptr to checksum calculated by XOR'ing the first 127 bytes of the SensorDDSRecord.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pChecksum = GMBLSensor::CalculateDDSDataChecksum(*pGoIOSensor->m_pMBLSensor->GetDDSRecPtr());
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_DDSMem_ClearRecord()
-	
-	Purpose:	Clear the DDS record for the specified sensor. This puts default values in the record's fields.
-				The sensor name fields are set to blank. The sensor id is set to 0, and a single linear calibration is
-				set up with a gain of 1.0 and an offest of 0. The calibration units field is set to "volts".
-				The OperationType is set to imply a probe type of kProbeTypeAnalog5V.
-
-	Return:		0 if hSensor is valid, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_ClearRecord(
-	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
-{
-	gtype_int32 nResult = -1;
-	if (OpenSensorVector_FindAndLockSensor(hSensor))
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		GMBLSensor *pSensor = pGoIOSensor->m_pMBLSensor;
-		GSensorDDSRec DDSRec;
-
-		GMBLSensor *pTempSensor = new GMBLSensor();
-		pTempSensor->GetDDSRec(&DDSRec);
-		pSensor->SetDDSRec(DDSRec, false);
-		delete pTempSensor;
-
-		nResult = 0;
-
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-
-/***************************************************************************************************************************/
-/***************************************************************************************************************************/
-/***************************************************************************************************************************
-Languages that can handle GSensorDDSRec can access the DDS fields using GoIO_Sensor_DDSMem_SetRecord and GetRecord.
-Languages such as Basic are unlikely to be able to handle a complex record like GSensorDDSRec, especially because of
-byte alignment issues. The individual field level API's defined below provide an alternate way to access the SensorDDSRecord.
-****************************************************************************************************************************/
-/***************************************************************************************************************************/
-/***************************************************************************************************************************/
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetMemMapVersion(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char MemMapVersion)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->MemMapVersion = MemMapVersion;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetMemMapVersion(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char *pMemMapVersion)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pMemMapVersion = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->MemMapVersion;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_DDSMem_SetSensorNumber()
-	
-	Purpose:	Normally SensorDDSRecord.SensorNumber is automatically set inside GoIO_Sensor_Open().
-				However, if the current sensor is a legacy version, then SensorDDSRecord.SensorNumber = 0, so
-				you might want to use GoIO_Sensor_DDSMem_SetSensorNumber() to change it.
-
-				
-	SIDE EFFECTS:	
-				If the new SensorDDSRecord.SensorNumber is set to an (id < kSensorIdNumber_FirstSmartSensor) and (id > 0),
-				then the rest of the fields in the DDS record are  populated with default values appropriate for the
-				new sensor id.
-
-				If the GoIO_Sensor_DDSMem_SetSensorNumber() causes the probeType to change, then you should
-				send a SKIP_CMD_ID_SET_ANALOG_INPUT_CHANNEL command to the sensor. See GoIO_Sensor_GetProbeType().
-
-	Return:		0 if hSensor is valid and sensor is connected to a Go! Link, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetSensorNumber(
-	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
-	unsigned char SensorNumber)	//[in]
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		GSkipDevice *pSkip = dynamic_cast<GSkipDevice *>(pGoIOSensor->m_pInterface);
-		if (!pSkip)
-			nResult = -1;
-		else
-		{
-			pGoIOSensor->m_pMBLSensor->SetID(SensorNumber);//This may cause GetDDSRecPtr()->OperationType to change also!
-		}
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-/***************************************************************************************************************************
-	Function Name: GoIO_Sensor_DDSMem_GetSensorNumber()
-	
-	Purpose:	Retrieve SensorDDSRecord.SensorNumber. 
-	
-				If sendQueryToHardwareflag != 0, then send a SKIP_CMD_ID_GET_SENSOR_ID to the sensor hardware
-				 - sendQueryToHardwareflag is ignored for Go! Temp.
-
-				If the sensor hardware reports a new SensorNumber, then a user has probably changed what sensor is
-				plugged into a Go! Link. The simplest course of action in this case is to call
-				GoIO_Sensor_GetOpenDeviceName() to get the device id, call GoIO_Sensor_Close(), and then
-				call GoIO_Sensor_Open() with the values obtained from GoIO_Sensor_GetOpenDeviceName() to reopen the
-				device. This will cause the GoIO_Sensor object to be properly configured for the new sensor.
-
-	Return:		0 if successful, else -1.
-
-****************************************************************************************************************************/
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetSensorNumber(
-	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor. 
-	unsigned char *pSensorNumber,	//[out] ptr to SensorNumber.
-	gtype_int32 sendQueryToHardwareflag,//[in] If sendQueryToHardwareflag != 0, then send a SKIP_CMD_ID_GET_SENSOR_ID to the sensor hardware. 
-	gtype_int32 timeoutMs)//[in] # of milliseconds to wait for a reply before giving up. SKIP_TIMEOUT_MS_DEFAULT is recommended.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		if ((0 == sendQueryToHardwareflag) 
-			|| (USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID == pGoIOSensor->m_pInterface->GetPortRefPtr()->GetUSBProductID())
-			|| (CYCLOPS_DEFAULT_PRODUCT_ID == pGoIOSensor->m_pInterface->GetPortRefPtr()->GetUSBProductID()))
-			*pSensorNumber = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorNumber;
-		else
-		{
-			//Send command to the sensor.
-			GSkipGetSensorIdCmdResponsePayload getSensorIdResponsePayload;
-			int nBytesRead = sizeof(GSkipGetSensorIdCmdResponsePayload);
-			int nResult = pGoIOSensor->m_pInterface->SendCmdAndGetResponse(SKIP_CMD_ID_GET_SENSOR_ID, NULL, 0, 
-				&getSensorIdResponsePayload, &nBytesRead, timeoutMs);
-			if (0 == nResult)
-			{
-				//Parse out sensor id.
-				int nSensorId;
-				GUtils::OSConvertBytesToInt(getSensorIdResponsePayload.lsbyteLswordSensorId, 
-					getSensorIdResponsePayload.msbyteLswordSensorId, getSensorIdResponsePayload.lsbyteMswordSensorId, 
-					getSensorIdResponsePayload.msbyteMswordSensorId, &nSensorId);
-
-				if (nSensorId < 0)
-					nSensorId = 0;
-				else
-				if (nSensorId > 255)
-					nSensorId = 0;
-				
-				pGoIOSensor->m_pMBLSensor->SetID(nSensorId);
-				*pSensorNumber = (unsigned char) nSensorId;
-			}
-		}
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetSerialNumber(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char leastSigByte_SerialNumber,
-	unsigned char midSigByte_SerialNumber,
-	unsigned char mostSigByte_SerialNumber)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorSerialNumber[0] = leastSigByte_SerialNumber;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorSerialNumber[1] = midSigByte_SerialNumber;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorSerialNumber[2] = mostSigByte_SerialNumber;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetSerialNumber(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char *pLeastSigByte_SerialNumber,
-	unsigned char *pMidSigByte_SerialNumber,
-	unsigned char *pMostSigByte_SerialNumber)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pLeastSigByte_SerialNumber = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorSerialNumber[0];
-		*pMidSigByte_SerialNumber = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorSerialNumber[1];
-		*pMostSigByte_SerialNumber = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorSerialNumber[2];
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetLotCode(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char YY_BCD,
-	unsigned char WW_BCD)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorLotCode[0] = YY_BCD;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorLotCode[1] = WW_BCD;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetLotCode(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char *pYY_BCD,
-	unsigned char *pWW_BCD)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pYY_BCD = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorLotCode[0];
-		*pWW_BCD = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorLotCode[1];
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetManufacturerID(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char ManufacturerID)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->ManufacturerID = ManufacturerID;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetManufacturerID(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char *pManufacturerID)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pManufacturerID = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->ManufacturerID;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetLongName(
-	GOIO_SENSOR_HANDLE hSensor,
-	const char *pLongName)//[in] ptr to NULL terminated string.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		strncpy(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorLongName, pLongName, 
-			sizeof(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorLongName));
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetLongName(
-	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor. 
-	char *pLongName,				//[out] ptr to buffer for NULL terminated output string.
-	gtype_uint16 maxNumBytesToCopy)	//[in] size of pLongName buffer.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		char tmpstring[30];
-		GSTD_ASSERT(sizeof(tmpstring) > sizeof(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorLongName));
-		memset(tmpstring, 0, sizeof(tmpstring));
-		memcpy(tmpstring, pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorLongName, 
-			sizeof(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorLongName));
-		strncpy(pLongName, tmpstring, maxNumBytesToCopy);
-		pLongName[maxNumBytesToCopy - 1] = 0;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetShortName(
-	GOIO_SENSOR_HANDLE hSensor,
-	const char *pShortName)//[in] ptr to NULL terminated string.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		strncpy(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorShortName, pShortName, 
-			sizeof(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorShortName));
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetShortName(
-	GOIO_SENSOR_HANDLE hSensor,			//[in] handle to open sensor. 
-	char *pShortName,					//[out] ptr to buffer for NULL terminated output string. 
-	gtype_uint16 maxNumBytesToCopy)		//[in] size of pShortName buffer.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		char tmpstring[30];
-		GSTD_ASSERT(sizeof(tmpstring) > sizeof(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorShortName));
-		memset(tmpstring, 0, sizeof(tmpstring));
-		memcpy(tmpstring, pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorShortName, 
-			sizeof(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorShortName));
-		strncpy(pShortName, tmpstring, maxNumBytesToCopy);
-		pShortName[maxNumBytesToCopy - 1] = 0;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetUncertainty(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char Uncertainty)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->Uncertainty = Uncertainty;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetUncertainty(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char *pUncertainty)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pUncertainty = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->Uncertainty;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetSignificantFigures(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char SignificantFigures)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SignificantFigures = SignificantFigures;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetSignificantFigures(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char *pSignificantFigures)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pSignificantFigures = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SignificantFigures;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetCurrentRequirement(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char CurrentRequirement)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->CurrentRequirement = CurrentRequirement;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetCurrentRequirement(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char *pCurrentRequirement)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pCurrentRequirement = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->CurrentRequirement;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetAveraging(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char Averaging)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->Averaging = Averaging;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetAveraging(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char *pAveraging)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pAveraging = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->Averaging;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetMinSamplePeriod(
-	GOIO_SENSOR_HANDLE hSensor,
-	gtype_real32 MinSamplePeriod)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->MinSamplePeriod = MinSamplePeriod;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetMinSamplePeriod(
-	GOIO_SENSOR_HANDLE hSensor,
-	gtype_real32 *pMinSamplePeriod)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pMinSamplePeriod = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->MinSamplePeriod;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetTypSamplePeriod(
-	GOIO_SENSOR_HANDLE hSensor,
-	gtype_real32 TypSamplePeriod)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->TypSamplePeriod = TypSamplePeriod;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetTypSamplePeriod(
-	GOIO_SENSOR_HANDLE hSensor,
-	gtype_real32 *pTypSamplePeriod)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pTypSamplePeriod = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->TypSamplePeriod;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetTypNumberofSamples(
-	GOIO_SENSOR_HANDLE hSensor,
-	gtype_uint16 TypNumberofSamples)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->TypNumberofSamples = TypNumberofSamples;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetTypNumberofSamples(
-	GOIO_SENSOR_HANDLE hSensor,
-	gtype_uint16 *pTypNumberofSamples)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pTypNumberofSamples = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->TypNumberofSamples;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetWarmUpTime(
-	GOIO_SENSOR_HANDLE hSensor,
-	gtype_uint16 WarmUpTime)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->WarmUpTime = WarmUpTime;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetWarmUpTime(
-	GOIO_SENSOR_HANDLE hSensor,
-	gtype_uint16 *pWarmUpTime)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pWarmUpTime = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->WarmUpTime;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetExperimentType(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char ExperimentType)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->ExperimentType = ExperimentType;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetExperimentType(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char *pExperimentType)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pExperimentType = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->ExperimentType;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetOperationType(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char OperationType)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->OperationType = OperationType;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetOperationType(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char *pOperationType)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pOperationType = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->OperationType;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetCalibrationEquation(
-	GOIO_SENSOR_HANDLE hSensor,
-	char CalibrationEquation)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->CalibrationEquation = CalibrationEquation;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetCalibrationEquation(
-	GOIO_SENSOR_HANDLE hSensor,
-	char *pCalibrationEquation)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pCalibrationEquation = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->CalibrationEquation;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetYminValue(
-	GOIO_SENSOR_HANDLE hSensor,
-	gtype_real32 YminValue)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->YminValue = YminValue;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetYminValue(
-	GOIO_SENSOR_HANDLE hSensor,
-	gtype_real32 *pYminValue)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pYminValue = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->YminValue;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetYmaxValue(
-	GOIO_SENSOR_HANDLE hSensor,
-	gtype_real32 YmaxValue)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->YmaxValue = YmaxValue;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetYmaxValue(
-	GOIO_SENSOR_HANDLE hSensor,
-	gtype_real32 *pYmaxValue)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pYmaxValue = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->YmaxValue;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetYscale(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char Yscale)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->Yscale = Yscale;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetYscale(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char *pYscale)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pYscale = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->Yscale;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetHighestValidCalPageIndex(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char HighestValidCalPageIndex)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->HighestValidCalPageIndex = HighestValidCalPageIndex;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetHighestValidCalPageIndex(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char *pHighestValidCalPageIndex)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pHighestValidCalPageIndex = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->HighestValidCalPageIndex;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetActiveCalPage(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char ActiveCalPage)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->ActiveCalPage = ActiveCalPage;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetActiveCalPage(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char *pActiveCalPage)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pActiveCalPage = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->ActiveCalPage;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetCalPage(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char CalPageIndex,
-	gtype_real32 CalibrationCoefficientA,
-	gtype_real32 CalibrationCoefficientB,
-	gtype_real32 CalibrationCoefficientC,
-	const char *pUnits)//[in] ptr to NULL terminated string.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		if (CalPageIndex < 3)
-		{
-			GCalibrationPage *pCalPage = &(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->CalibrationPage[CalPageIndex]);
-			pCalPage->CalibrationCoefficientA = CalibrationCoefficientA;
-			pCalPage->CalibrationCoefficientB = CalibrationCoefficientB;
-			pCalPage->CalibrationCoefficientC = CalibrationCoefficientC;
-			strncpy(pCalPage->Units, pUnits, sizeof(pCalPage->Units));
-		}
-		else
-			nResult = -1;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetCalPage(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char CalPageIndex,
-	gtype_real32 *pCalibrationCoefficientA,
-	gtype_real32 *pCalibrationCoefficientB,
-	gtype_real32 *pCalibrationCoefficientC,
-	char *pUnits,						//[out] ptr to buffer for NULL terminated output string. 
-	gtype_uint16 maxNumBytesToCopy)	//[in] size of pUnits buffer.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		if (CalPageIndex < 3)
-		{
-			GCalibrationPage *pCalPage = &(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->CalibrationPage[CalPageIndex]);
-			char tmpstring[30];
-			GSTD_ASSERT(sizeof(tmpstring) > sizeof(pCalPage->Units));
-			memset(tmpstring, 0, sizeof(tmpstring));
-			memcpy(tmpstring, pCalPage->Units, sizeof(pCalPage->Units));
-			strncpy(pUnits, tmpstring, maxNumBytesToCopy);
-			pUnits[maxNumBytesToCopy - 1] = 0;
-
-			*pCalibrationCoefficientA = pCalPage->CalibrationCoefficientA;
-			*pCalibrationCoefficientB = pCalPage->CalibrationCoefficientB;
-			*pCalibrationCoefficientC = pCalPage->CalibrationCoefficientC;
-		}
-		else
-			nResult = -1;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetChecksum(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char Checksum)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->Checksum = Checksum;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetChecksum(
-	GOIO_SENSOR_HANDLE hSensor,
-	unsigned char *pChecksum)
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = -1;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		*pChecksum = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->Checksum;
-		UnlockSensor(hSensor);
-	}
-
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL void GoIO_Diags_SetIOTraceEnableFlag(
-	gtype_bool flag)
-{
-	GoIOTraceEnableFlag = flag;
-}
-
-GOIO_DLL_INTERFACE_DECL void GoIO_Diags_GetIOTraceEnableFlag(
-	gtype_bool *pFlag)			//[out] ptr to loc to store IO trace enable flag. Note that IO tracing is enabled by default.
-{
-	*pFlag = GoIOTraceEnableFlag;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_GetNumInputTraceBytesAvailable(
-	GOIO_SENSOR_HANDLE hSensor)//[in] handle to open device.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = 0;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		if (pGoIOSensor->m_pInterface->GetDiagnosticInputBufferPtr())
-		{
-			nResult = pGoIOSensor->m_pInterface->GetDiagnosticInputBufferPtr()->NumBytesAvailable();
-		}
-
-		UnlockSensor(hSensor);
-	}
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_ReadInputTraceBytes(
-	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
-	unsigned char *pInputTraceBuf,	//[out] ptr to loc to store trace info.
-	gtype_int32 maxCount)			//[in] maximum number of bytes to copy into pInputTraceBuf.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = 0;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		if (pGoIOSensor->m_pInterface->GetDiagnosticInputBufferPtr())
-		{
-			nResult = pGoIOSensor->m_pInterface->GetDiagnosticInputBufferPtr()->RetrieveBytes(pInputTraceBuf, maxCount);
-		}
-
-		UnlockSensor(hSensor);
-	}
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_GetNumOutputTraceBytesAvailable(
-	GOIO_SENSOR_HANDLE hSensor)//[in] handle to open device.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = 0;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		if (pGoIOSensor->m_pInterface->GetDiagnosticOutputBufferPtr())
-		{
-			nResult = pGoIOSensor->m_pInterface->GetDiagnosticOutputBufferPtr()->NumBytesAvailable();
-		}
-
-		UnlockSensor(hSensor);
-	}
-	return nResult;
-}
-
-GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_ReadOutputTraceBytes(
-	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
-	unsigned char *pOutputTraceBuf,	//[out] ptr to loc to store trace info.
-	gtype_int32 maxCount)			//[in] maximum number of bytes to copy into pOutputTraceBuf.
-{
-	gtype_int32 nResult = 0;
-	if (!OpenSensorVector_FindAndLockSensor(hSensor))
-		nResult = 0;
-	else
-	{
-		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
-		if (pGoIOSensor->m_pInterface->GetDiagnosticOutputBufferPtr())
-		{
-			nResult = pGoIOSensor->m_pInterface->GetDiagnosticOutputBufferPtr()->RetrieveBytes(pOutputTraceBuf, maxCount);
-		}
-
-		UnlockSensor(hSensor);
-	}
-	return nResult;
-}
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GoIO_DLL_interface.cpp : Defines the exported methods for the GoIO_DLL .
+//
+
+#ifdef TARGET_OS_WIN
+	#include "stdafx.h"
+	#include "GoIO_DLL.h"
+	#include "WinEnumDevices.h"
+	
+	extern CGoIO_DLLApp theApp;
+#endif
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE
+{
+}
+
+using namespace LIB_NAMESPACE;
+/****************************************************************************************************************
+So what is this LIB_NAMESPACE nonsense all about??
+
+We discovered empirically that some Linux versions of gcc 4.x had an unbelievably heinous bug. A call to a local
+function Z in shared library A might actually jump to local function Z in shared library B! We tried various compiler
+options(eg -fvisibility=hidden -fvisibility-inlines-hidden) but we could not prevent namespace pollution across 
+libraries.
+
+So, on Linux builds only, we define LIB_NAMESPACE, and in so doing put the bulk of the code in each shared library 
+in its own C++ namespace. For libGoIO, we define LIB_NAMESPACE to be GoIO.
+****************************************************************************************************************/
+#endif
+
+#include "GSkipDevice.h"
+#include "GCyclopsDevice.h"
+#include "GMiniGCDevice.h"
+#include "GUSBDirectTempDevice.h"
+#include "GMBLSensor.h"
+#include "GUtils.h"
+#include "GBinaryLog.h"
+#include "GTimeline.h"
+#include "NonSmartSensorDDSRecs.h"
+#include "GoIO_DLL_interface.h"
+#ifdef TARGET_OS_LINUX
+#include "GSkipSimulator.h"
+#include "GSkipPacketCapture.h"
+#include "GSkipPacketReplay.h"
+#include "GoIO_DLL_daemon.h"
+#endif
+
+#ifdef USE_LIB_USB
+#include "libusb-1.0/libusb.h"
+libusb_context *pGoIO_libusbContext = NULL;   
+#endif
+
+#define SKIP_TIMEOUT_MS_READ_FLASH 2000
+#define SKIP_LIB_MNG_MUTEX_TIMEOUT_MS 500
+
+GPtrVector openSensorVector;//list of CGoIOSensors
+OSMutex openSensorVectorMutex = NULL;
+OSMutex multipleInstanceDeviceMutex = NULL;
+bool bMultipleInstanceDeviceMutexLocked = false;
+gtype_bool GoIOTraceEnableFlag = 0;
+GoIOCounters closedSensorCounters;//totals for the sensors closed since GoIO_Init(), protected by openSensorVectorMutex.
+std::map<cppstring, GSkipQueueConfig> pendingQueueConfigs;//GoIO_SetMeasurementQueueConfig(), protected by openSensorVectorMutex.
+#ifdef TARGET_OS_LINUX
+std::string daemonSocketPath;//GoIO_SetDaemonSocketPath(), empty => open devices directly.
+bool bDaemonSocketPathSet = false;//else GoIO_Init() uses GOIO_DAEMON.
+#endif
+
+class CGoIOSensor
+{
+public:
+	CGoIOSensor(GPortRef *pPortRef)
+	{
+		if (SKIP_DEFAULT_PRODUCT_ID == pPortRef->GetUSBProductID())
+			m_pInterface = new GSkipDevice(pPortRef);
+		else
+		if (USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID == pPortRef->GetUSBProductID())
+			m_pInterface = new GUSBDirectTempDevice(pPortRef);
+		else
+		if (CYCLOPS_DEFAULT_PRODUCT_ID == pPortRef->GetUSBProductID())
+			m_pInterface = new GCyclopsDevice(pPortRef);
+		else
+		if (MINI_GC_DEFAULT_PRODUCT_ID == pPortRef->GetUSBProductID())
+			m_pInterface = new GMiniGCDevice(pPortRef);
+		else
+			GSTD_ASSERT(false);
+		m_pMBLSensor = new GMBLSensor;
+		m_pMeasurementCallback = NULL;
+		m_pMeasurementCallbackContext = NULL;
+		m_pBorrowConsumer = NULL;
+		memset(&m_openTimings, 0, sizeof(m_openTimings));
+	}
+	~CGoIOSensor()
+	{
+		if (m_pBorrowConsumer)
+			GSkipBroadcastBuffer::RemoveConsumer(m_pBorrowConsumer);
+		if (m_pMBLSensor)
+			delete m_pMBLSensor;
+		if (m_pInterface)
+			delete m_pInterface;
+	}
+
+	GSkipBaseDevice *m_pInterface;
+	GMBLSensor *m_pMBLSensor;
+	GOIO_MEASUREMENT_CALLBACK m_pMeasurementCallback;
+	void *m_pMeasurementCallbackContext;
+	GSkipBroadcastConsumer *m_pBorrowConsumer;//used by GoIO_Sensor_BorrowMeasurements().
+	GoIOSensorOpenTimings m_openTimings;
+};
+
+//Return the seconds elapsed since *pPhaseStartUs, and restart the clock for the next phase.
+static gtype_real64 GoIOSensor_EndOpenPhase(unsigned long long *pPhaseStartUs)
+{
+	unsigned long long nowUs = GUtils::OSGetTimeStampMicroseconds();
+	gtype_real64 seconds = ((gtype_real64) (nowUs - *pPhaseStartUs))/1000000.0;
+	*pPhaseStartUs = nowUs;
+	return seconds;
+}
+
+static void GoIOSensor_MeasurementCallback(void *pContext, const int *pMeasurements, int nNumMeasurements)
+{
+	CGoIOSensor *pGoIOSensor = (CGoIOSensor *) pContext;
+	if (pGoIOSensor->m_pMeasurementCallback)
+		(*pGoIOSensor->m_pMeasurementCallback)((GOIO_SENSOR_HANDLE) pGoIOSensor, pGoIOSensor->m_pMeasurementCallbackContext, 
+			(const gtype_int32 *) pMeasurements, nNumMeasurements);
+}
+
+static void GoIOCounters_Add(
+	GoIOCounters *pTotals,				//[in,out]
+	const GSkipIOCounters &counters)	//[in]
+{
+	pTotals->measurementPacketsReceived += counters.nMeasurementPacketsReceived;
+	pTotals->cmdRespPacketsReceived += counters.nCmdRespPacketsReceived;
+	pTotals->initRespPacketsReceived += counters.nInitRespPacketsReceived;
+	pTotals->packetsDropped += counters.nPacketsDropped;
+	pTotals->rollingCounterGaps += counters.nRollingCounterGaps;
+	pTotals->transferErrors += counters.nReadErrors + counters.nWriteErrors;
+	pTotals->transferTimeouts += counters.nWriteTimeouts;
+	pTotals->bytesWritten += counters.nBytesWritten;
+	if ((gtype_uint32) counters.nQueueHighWaterMark > pTotals->queueHighWaterMark)
+		pTotals->queueHighWaterMark = counters.nQueueHighWaterMark;
+	pTotals->consumerLagMeasurements += counters.nConsumerLagMeasurements;
+	if (counters.nConsumerLagMs > pTotals->consumerLagMs)
+		pTotals->consumerLagMs = counters.nConsumerLagMs;
+	pTotals->queueOverflows += counters.nQueueOverflows;
+	pTotals->producerBlockedMs += counters.nProducerBlockedMs;
+	pTotals->packetsSpilled += counters.nPacketsSpilled;
+	pTotals->spillErrors += counters.nSpillErrors;
+}
+
+static void GoIOSensor_ApplyPendingQueueConfig(
+	CGoIOSensor *pGoIOSensor,	//[in] sensor that has not been opened yet.
+	const char *pDeviceName)	//[in]
+{
+	if (GThread::OSTryLockMutex(openSensorVectorMutex, SKIP_LIB_MNG_MUTEX_TIMEOUT_MS))
+	{
+		std::map<cppstring, GSkipQueueConfig>::iterator iter = pendingQueueConfigs.find(pDeviceName);
+		if (iter == pendingQueueConfigs.end())
+			iter = pendingQueueConfigs.find(cppstring());
+		if (iter != pendingQueueConfigs.end())
+		{
+			if (kResponse_OK != pGoIOSensor->m_pInterface->SetMeasurementQueueConfig(iter->second))
+				GSTD_TRACE("GoIO_Sensor_Open() could not apply the measurement queue config.");
+		}
+
+		GThread::OSUnlockMutex(openSensorVectorMutex);
+	}
+}
+
+static void OpenSensorVector_Clear()
+{
+	if (openSensorVectorMutex)
+	{
+		if (GThread::OSTryLockMutex(openSensorVectorMutex, 1))
+		{
+			while (openSensorVector.size() != 0)
+				GoIO_Sensor_Close(openSensorVector[0]);
+
+			GThread::OSUnlockMutex(openSensorVectorMutex);
+		}
+	}
+}
+
+static bool OpenSensorVector_FindAndLockSensor(GOIO_SENSOR_HANDLE hSensor)
+{
+	bool bFound = false;
+	if (openSensorVectorMutex)
+	{
+		if (GThread::OSTryLockMutex(openSensorVectorMutex, SKIP_LIB_MNG_MUTEX_TIMEOUT_MS))
+		{
+			GPtrVectorIterator iter = std::find(openSensorVector.begin(), openSensorVector.end(), hSensor);
+			if (iter != openSensorVector.end())
+			{
+				CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+				bFound = pGoIOSensor->m_pInterface->LockDevice(1);
+			}
+
+			GThread::OSUnlockMutex(openSensorVectorMutex);
+		}
+	}
+
+	return bFound;
+}
+
+//Validate and lock a whole set of sensors while holding openSensorVectorMutex just once.
+//Either all the sensors are locked and true is returned, or none are.
+static bool OpenSensorVector_FindAndLockSensors(const GOIO_SENSOR_HANDLE *pSensors, gtype_int32 numSensors)
+{
+	bool bFound = false;
+	if (openSensorVectorMutex && pSensors && (numSensors > 0))
+	{
+		if (GThread::OSTryLockMutex(openSensorVectorMutex, SKIP_LIB_MNG_MUTEX_TIMEOUT_MS))
+		{
+			gtype_int32 nNumLocked;
+			for (nNumLocked = 0; nNumLocked < numSensors; nNumLocked++)
+			{
+				GPtrVectorIterator iter = std::find(openSensorVector.begin(), openSensorVector.end(), pSensors[nNumLocked]);
+				if (iter == openSensorVector.end())
+					break;
+				CGoIOSensor *pGoIOSensor = (CGoIOSensor *) pSensors[nNumLocked];
+				if (!pGoIOSensor->m_pInterface->LockDevice(1))
+					break;
+			}
+
+			bFound = (nNumLocked == numSensors);
+			if (!bFound)
+			{
+				while (nNumLocked > 0)
+				{
+					nNumLocked--;
+					((CGoIOSensor *) pSensors[nNumLocked])->m_pInterface->UnlockDevice();
+				}
+			}
+
+			GThread::OSUnlockMutex(openSensorVectorMutex);
+		}
+	}
+
+	return bFound;
+}
+
+//Validate hSensor without locking the sensor itself, for diagnostics that must work while another thread owns it.
+//If true is returned, the sensor cannot be closed until OpenSensorVector_UnlockList() is called.
+static bool OpenSensorVector_FindSensorAndLockList(GOIO_SENSOR_HANDLE hSensor)
+{
+	bool bFound = false;
+	if (openSensorVectorMutex)
+	{
+		if (GThread::OSTryLockMutex(openSensorVectorMutex, SKIP_LIB_MNG_MUTEX_TIMEOUT_MS))
+		{
+			GPtrVectorIterator iter = std::find(openSensorVector.begin(), openSensorVector.end(), hSensor);
+			bFound = (iter != openSensorVector.end());
+			if (!bFound)
+				GThread::OSUnlockMutex(openSensorVectorMutex);
+		}
+	}
+
+	return bFound;
+}
+
+static void OpenSensorVector_UnlockList()
+{
+	GThread::OSUnlockMutex(openSensorVectorMutex);
+}
+
+static bool UnlockSensor(GOIO_SENSOR_HANDLE hSensor)
+{
+	CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+	return pGoIOSensor->m_pInterface->UnlockDevice();
+}
+
+static bool OpenSensorVector_FindSensorByName(
+	const char *pDeviceName,			//[in] NULL terminated string that uniquely identifies the device.
+	gtype_int32 vendorId,				//[in] USB vendor id
+	gtype_int32 productId)				//[in] USB product id
+{
+	bool bFound = false;
+	if (openSensorVectorMutex)
+	{
+		if (GThread::OSTryLockMutex(openSensorVectorMutex, SKIP_LIB_MNG_MUTEX_TIMEOUT_MS))
+		{
+			cppstring deviceName = pDeviceName;
+			GPortRef oldPortRef;
+
+			GPtrVectorIterator iter = openSensorVector.begin();
+			while (iter != openSensorVector.end())
+			{
+				CGoIOSensor *pGoIOSensor = (CGoIOSensor *) (*iter);
+				oldPortRef = pGoIOSensor->m_pInterface->GetPortRef();
+				if (((gtype_int32)oldPortRef.GetUSBVendorID() == vendorId) && ((gtype_int32)oldPortRef.GetUSBProductID() == productId))
+				{
+					if (deviceName == oldPortRef.GetLocation())
+					{
+						bFound = true;
+						break;
+					}
+				}
+				iter++;
+			}
+
+			GThread::OSUnlockMutex(openSensorVectorMutex);
+		}
+	}
+
+	return bFound;
+}
+
+static bool OpenSensorVector_AddSensor(GOIO_SENSOR_HANDLE hSensor)
+{
+	bool bSuccess = false;
+	if (openSensorVectorMutex)
+	{
+		if (GThread::OSTryLockMutex(openSensorVectorMutex, SKIP_LIB_MNG_MUTEX_TIMEOUT_MS))
+		{
+			bSuccess = true;
+			openSensorVector.push_back(hSensor);
+
+			GThread::OSUnlockMutex(openSensorVectorMutex);
+		}
+	}
+
+	return bSuccess;
+}
+
+
+static bool OpenSensorVector_RemoveSensor(GOIO_SENSOR_HANDLE hSensor)
+{
+	bool bSuccess = false;
+	if (openSensorVectorMutex)
+	{
+		if (GThread::OSTryLockMutex(openSensorVectorMutex, SKIP_LIB_MNG_MUTEX_TIMEOUT_MS))
+		{
+			GPtrVectorIterator iter = std::find(openSensorVector.begin(), openSensorVector.end(), hSensor);
+			if (iter != openSensorVector.end())
+			{
+				//Keep the closed sensor's counts in GoIO_Diags_GetAggregateCounters().
+				GSkipIOCounters counters;
+				((CGoIOSensor *) hSensor)->m_pInterface->GetIOCounters(&counters);
+				counters.nConsumerLagMeasurements = 0;
+				counters.nConsumerLagMs = 0;
+				GoIOCounters_Add(&closedSensorCounters, counters);
+
+				openSensorVector.erase(iter);
+				bSuccess = true;
+			}
+
+			GThread::OSUnlockMutex(openSensorVectorMutex);
+		}
+	}
+
+	return bSuccess;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_GetDLLVersion()
+		Added in version 2.00.
+	
+	Purpose:	This routine returns the major and minor version numbers for the instance of GoIO_DLL that is
+				currently running.
+
+				If a function is not guaranteed to be present in all supported versions of GoIO_DLL, then the line
+				"Added in version 'major.minor'" will appear in the function description in this file.
+
+				It is our intention that all versions of GoIO_DLL created subsequent to a given version, will be
+				backwards compatible with the older version. You should be able to replace an old version of GoIO_DLL
+				with a newer version and everything should still work without rebuilding your application.
+
+				Note that version major2.minor2 is later than version major1.minor1 
+				iff. ((major2 > major1) || ((major2 == major1) && (minor2 > minor1))).
+				
+				Backwards compatibility is definitely our intention, but we do not absolutely guarantee it. If you think
+				that you have detected a backwards compatibility bug, then please report it to Vernier Software & Technology.
+				Calling GoIO_GetVersion() from your application is a way to identify precisely which version of
+				GoIO_DLL you are actually using.
+
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_GetDLLVersion(
+	gtype_uint16 *pMajorVersion, //[o]
+	gtype_uint16 *pMinorVersion) //[o]
+{
+	*pMajorVersion = 2;
+	*pMinorVersion = 54;
+	return 0;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Init()
+	
+	Purpose:	Call GoIO_Init() once before making any other GoIO function calls.
+				GoIO_Init() and GoIO_Uninit() should be called from the same thread.
+
+				This routine attempts to grab the mutex that controls access to Vernier
+				sensors. If Logger Pro, Logger Lite, or another GoIO application is currently
+				running, then this routine will fail to grab the device control mutex, so it
+				will return -1. Subsequent calls to GoIO functions will also fail until
+				the application is able to run GoIO_Init() successfully.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Init()
+{
+	InitSensorDefaultDDSRecs();
+	memset(&closedSensorCounters, 0, sizeof(closedSensorCounters));
+	pendingQueueConfigs.clear();
+
+	#ifdef TARGET_OS_LINUX
+		//In client mode the daemon owns the devices, so leave USB alone.
+		std::string sDaemonSocketPath = daemonSocketPath;
+		const char *pDaemonSocketPath = getenv("GOIO_DAEMON");
+		if ((!bDaemonSocketPathSet) && pDaemonSocketPath)
+			sDaemonSocketPath = (0 != pDaemonSocketPath[0]) ? pDaemonSocketPath : GoIODaemon_GetDefaultSocketPath();
+		if (!sDaemonSocketPath.empty())
+			return DaemonClient_Init(sDaemonSocketPath.c_str());
+	#endif
+
+	#ifdef TARGET_OS_WIN // If this is Windows...
+		if (!hWinSetupApiLibrary)
+			hWinSetupApiLibrary = WinLoadSetupApiLibrary();
+		if (!hWinHidDLibrary)
+			hWinHidDLibrary = WinLoadHidDLibrary();
+
+		if (!openSensorVectorMutex)
+		{
+			if (!bMultipleInstanceDeviceMutexLocked)
+			{
+				if (!multipleInstanceDeviceMutex)
+					multipleInstanceDeviceMutex = GThread::OSCreateMutex(GSTD_S("MultipleInstanceDeviceMutex"));
+				if (multipleInstanceDeviceMutex)
+					bMultipleInstanceDeviceMutexLocked = GThread::OSTryLockMutex(multipleInstanceDeviceMutex, 1);
+			}
+			if (bMultipleInstanceDeviceMutexLocked)
+				openSensorVectorMutex = GThread::OSCreateMutex(GSTD_S("GoIO_DLL_DeviceListMutex"));
+		}
+
+		if ((!openSensorVectorMutex) || (!hWinSetupApiLibrary) || (!hWinHidDLibrary))
+		{
+			GoIO_Uninit();
+			GSTD_TRACEX(TRACE_SEVERITY_HIGH, "GoIO_Init() failed - another GoIO client may be already running.");
+		}
+	#endif
+
+	#if defined (TARGET_OS_MAC) || defined (TARGET_OS_LINUX)
+		int status = 0; 
+	#ifdef USE_LIB_USB
+		if (pGoIO_libusbContext != NULL)
+			status = -1;
+		else
+			status = libusb_init(&pGoIO_libusbContext);
+		if (0 != status)
+		{
+			cppsstream ss1;
+			ss1 << GSTD_S("failed to init libusb (error %d)") << status;
+			GSTD_TRACE(ss1.str());
+		}
+
+		// libusb_set_debug(pGoIO_libusbContext, 3);
+	#endif
+
+		if (0 == status)
+		{
+			if (!openSensorVectorMutex)
+				openSensorVectorMutex = GThread::OSCreateMutex(GSTD_S("GoIO_DLL_DeviceListMutex"));
+		}
+
+	#ifdef TARGET_OS_LINUX
+		const char *pSimulatorConfig = getenv("GOIO_SIMULATOR");
+		if (pSimulatorConfig)
+			GoIO_Diags_SetSimulatorConfig(pSimulatorConfig);
+		const char *pCapturePrefix = getenv("GOIO_CAPTURE");
+		if (pCapturePrefix)
+			GoIO_Diags_SetPacketCapturePrefix(pCapturePrefix);
+		const char *pReplayConfig = getenv("GOIO_REPLAY");
+		if (pReplayConfig)
+			GoIO_Diags_SetReplayConfig(pReplayConfig);
+		const char *pBinaryLogName = getenv("GOIO_BINLOG");
+		if (pBinaryLogName)
+			GoIO_Diags_OpenBinaryLog(pBinaryLogName, GOIO_TRACE_SEVERITY_LOW);
+		if (getenv("GOIO_TIMELINE"))
+			GoIO_Diags_StartTimeline(0);
+	#endif
+
+		if (!openSensorVectorMutex)
+		{
+			GoIO_Uninit();
+			GSTD_TRACEX(TRACE_SEVERITY_HIGH, "GoIO_Init() failed - another GoIO client may be already running.");
+		}
+	#endif
+
+	return (openSensorVectorMutex != NULL) ? 0 : -1;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Uninit()
+	
+	Purpose:	Call GoIO_Uninit() once to 'undo' GoIO_Init().
+				GoIO_Init() and GoIO_Uninit() should be called from the same thread.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Uninit()
+{
+	gtype_int32 nResult = 0;
+	
+	#ifdef TARGET_OS_LINUX
+		DaemonClient_Uninit();
+	#endif
+	OpenSensorVector_Clear();
+	GBinaryLog::Close();
+
+	#ifdef TARGET_OS_LINUX
+		const char *pTimelineName = getenv("GOIO_TIMELINE");
+		if (pTimelineName && GTimeline::IsRunning())
+		{
+			GTimeline::Stop();
+			GTimeline::WriteChromeTrace(pTimelineName);
+		}
+	#endif
+
+	if (openSensorVectorMutex)
+		GThread::OSDestroyMutex(openSensorVectorMutex);
+	openSensorVectorMutex = NULL;
+
+	#ifdef TARGET_OS_LINUX
+	#ifdef USE_LIB_USB // Only use this on Linux desktop builds for now
+		// Cleanup libusb
+		if (pGoIO_libusbContext != NULL)
+			libusb_exit(pGoIO_libusbContext);
+		pGoIO_libusbContext = NULL;
+	#endif
+	#endif
+
+	#ifdef TARGET_OS_WIN
+		if (bMultipleInstanceDeviceMutexLocked)
+		{
+			if (GThread::OSUnlockMutex(multipleInstanceDeviceMutex))
+				bMultipleInstanceDeviceMutexLocked = false;
+			else
+				nResult = -1;
+		}
+
+		if ((!bMultipleInstanceDeviceMutexLocked) && multipleInstanceDeviceMutex)
+		{
+			GThread::OSDestroyMutex(multipleInstanceDeviceMutex);
+			multipleInstanceDeviceMutex = NULL;
+		}
+
+		if (hWinHidDLibrary)
+			FreeLibrary(hWinHidDLibrary);
+		hWinHidDLibrary = NULL;
+
+		if (hWinSetupApiLibrary)
+			FreeLibrary(hWinSetupApiLibrary);
+		hWinSetupApiLibrary = NULL;
+	#endif
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_SetDaemonSocketPath()
+	
+	Purpose:	Make the following GoIO_Init() connect to the goiod daemon listening on the Unix domain socket at pPath, 
+				instead of opening USB devices itself. goiod owns the devices, so any number of processes can use the 
+				same sensor at once: each one opens it with GoIO_Sensor_Open() as usual, and the daemon only opens the 
+				device for the first of them. The daemon publishes the measurements to shared memory(see 
+				GoIO_Sensor_StartPublishing()), and every client reads them from there with its own read position, so 
+				measurements never pass through the socket and clients do not slow each other down. Commands from all
+				the clients of a device are queued by the daemon and sent to it one at a time.
+
+				The following routines are supported through the daemon: GoIO_UpdateListOfAvailableDevices(),
+				GoIO_GetNthAvailableDeviceName(), GoIO_Sensor_Open(), GoIO_Sensor_Close(), GoIO_Sensor_GetOpenDeviceName(),
+				GoIO_Sensor_ClearIO(), GoIO_Sensor_SendCmdAndGetResponse(), GoIO_Sensor_GetMeasurementTickInSeconds(),
+				GoIO_Sensor_GetMinimumMeasurementPeriod(), GoIO_Sensor_GetMaximumMeasurementPeriod(),
+				GoIO_Sensor_SetMeasurementPeriod(), GoIO_Sensor_GetMeasurementPeriod(), 
+				GoIO_Sensor_GetNumMeasurementsAvailable(), GoIO_Sensor_ReadRawMeasurements(), 
+				GoIO_Sensor_GetLatestRawMeasurement(), GoIO_Sensor_ConvertToVoltage(), GoIO_Sensor_CalibrateData(),
+				GoIO_Sensor_GetProbeType() and GoIO_Sensor_DDSMem_GetRecord(). The other GoIO_Sensor_* routines fail.
+				GoIO_Stream_Open() works as usual. Measurement period and sensor DDS changes made by one client affect
+				all the clients of the device, and GoIO_Sensor_ClearIO() only discards the calling client's measurements.
+
+				If this is not called, GoIO_Init() uses the GOIO_DAEMON environment variable, if it is set, as the socket 
+				path. If it is empty, the socket is GOIO_DAEMON_SOCKET_NAME in $XDG_RUNTIME_DIR, or in 
+				GOIO_DAEMON_DEFAULT_SOCKET_DIR if XDG_RUNTIME_DIR is not set, which is also where goiod listens by 
+				default. Pass NULL to go back to opening devices directly.
+
+				goiod only accepts clients running as the same user as itself, as root, or in the group given with 
+				'goiod -g', and keeps its socket in a directory that other users cannot write to.
+
+				Currently only supported on Linux.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_SetDaemonSocketPath(
+	const char *pPath)//[in] NULL terminated path.
+{
+#ifdef TARGET_OS_LINUX
+	daemonSocketPath = pPath ? pPath : "";
+	bDaemonSocketPathSet = true;
+	return 0;
+#else
+	return -1;
+#endif
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_SetIOThreadPolicy()
+
+	Purpose:	Set the scheduling priority and the cpus used by the threads that GoIO creates to read from devices(one
+				per open sensor) and to write the binary log. Raising the priority of these threads, or giving them cpus
+				of their own, stops them from being starved of cpu time by busy app threads, which causes measurement
+				packets to be dropped.
+
+				The policy applies to threads that are already running as well as to threads created later. The
+				threads pick it up within a few milliseconds.
+
+				On Linux, GOIO_THREAD_PRIORITY_HIGH and GOIO_THREAD_PRIORITY_TIME_CRITICAL use the SCHED_FIFO real time
+				policy if the process is permitted to(it runs as root, has CAP_SYS_NICE, or has a nonzero RLIMIT_RTPRIO).
+				Otherwise, and for the lower priorities, nice levels are used. Nice levels below 0 also need CAP_SYS_NICE
+				or a suitable RLIMIT_NICE; without them the threads run at the highest priority that they are allowed.
+				
+				cpuMask is ignored on Mac OS X.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_SetIOThreadPolicy(
+	gtype_int32 priority,	//[in] GOIO_THREAD_PRIORITY_*. The default is GOIO_THREAD_PRIORITY_NORMAL.
+	gtype_uint64 cpuMask)	//[in] bit n set allows the threads to run on cpu n. 0(the default) allows any cpu.
+{
+	if ((priority < GOIO_THREAD_PRIORITY_BELOW_NORMAL) || (priority > GOIO_THREAD_PRIORITY_TIME_CRITICAL))
+		return -1;
+
+	GThread::SetIOThreadPolicy((EThreadPriority) (kThreadPriority_BelowNormal + priority - GOIO_THREAD_PRIORITY_BELOW_NORMAL), cpuMask);
+	return 0;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_SetDebugTraceThreshold()
+	
+	Purpose:	GoIO lib generates a variety of debugging messages when it runs. Each message is assigned a severity
+				when it is generated. Only messages that are assigned a priority >= the debug trace threshold are actually
+				sent to the debug output. Call GoIO_Diags_SetDebugTraceThreshold(GOIO_TRACE_SEVERITY_LOWEST) for max
+				debug output.
+				
+				On windows systems, these messages are passed to the OutputDebugString() function.
+				On Mac and Linux systems, these messages are sent to STDOUT and/or STDERR.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+#define GOIO_TRACE_SEVERITY_LOWEST 1
+#define GOIO_TRACE_SEVERITY_LOW 10
+#define GOIO_TRACE_SEVERITY_MEDIUM 50
+#define GOIO_TRACE_SEVERITY_HIGH 100
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_SetDebugTraceThreshold(
+	gtype_int32 threshold)	//[in] Only trace messages marked with a severity >= threshold are actually sent to the debug output.
+{
+	SUBSYS_TRACE_THRESH = threshold;
+	return 0;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_GetDebugTraceThreshold(
+	gtype_int32 *pThreshold)//[out]
+{
+	(*pThreshold) = SUBSYS_TRACE_THRESH;
+	return 0;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_SetSimulatorConfig()
+	
+	Purpose:	Enable simulated Go! devices, so that applications and the lib itself can be exercised and load tested
+				without hardware. Simulated devices show up in GoIO_UpdateListOfAvailableDevices() alongside real ones, with
+				names of the form "sim:<product id>:<index>", and they support the full GoIO_Sensor_* API. They speak the
+				same packet protocol as real devices, so everything above the USB transport runs unchanged.
+
+				pConfig is a comma separated list of key=value pairs:
+					golink=N, gotemp=N, gomotion=N, minigc=N	number of simulated devices of each type.
+					period_us=N		override the measurement period requested by the app(0 => honour it).
+					fill=N			measurements per packet, 1 to 3(0 => choose from the period like Go! Link does).
+					loss=N			drop packets out of every N generated(0 => no loss).
+					burst=N			number of consecutive packets dropped each time(default 1).
+					sensor_id=N		sensor id reported by simulated Go! Links and Mini GCs(default 20, a smart sensor).
+				Keys that are left out take their default values, so an empty string disables the simulator.
+				Raw measurements ramp up by one per measurement, so consumers can check ordering and detect lost packets.
+
+				GoIO_Init() applies the GOIO_SIMULATOR environment variable, if it is set, in the same format.
+				Call this before GoIO_UpdateListOfAvailableDevices(). Sensors that are already open are not affected.
+
+				Currently only supported on Linux.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_SetSimulatorConfig(
+	const char *pConfig)//[in] NULL terminated config string.
+{
+	gtype_int32 nResult = -1;
+#ifdef TARGET_OS_LINUX
+	if (pConfig && GSkipSimulator::SetConfig(pConfig))
+		nResult = 0;
+#endif
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_SetPacketCapturePrefix()
+	
+	Purpose:	Record the raw 8 byte packets exchanged with each Go! device, with host time stamps, so that field
+				problems can be reproduced offline with GoIO_Diags_SetReplayConfig().
+
+				Every sensor opened while a non-empty prefix is set records to a file named
+				"<pPrefix>-<product id>-<n>.gcap", where n counts the capture files created by this process.
+				Recording starts when the sensor is opened and stops when it is closed, so the capture includes
+				the commands that GoIO_Sensor_Open() sends. Existing files with the same name are overwritten.
+				Pass NULL or an empty string to disable capture for sensors opened afterwards.
+
+				GoIO_Init() applies the GOIO_CAPTURE environment variable, if it is set.
+
+				Currently only supported on Linux.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_SetPacketCapturePrefix(
+	const char *pPrefix)//[in] NULL terminated path prefix, e.g. "/tmp/golink_session".
+{
+	gtype_int32 nResult = -1;
+#ifdef TARGET_OS_LINUX
+	GSkipPacketCaptureWriter::SetCapturePrefix(pPrefix ? pPrefix : "");
+	nResult = 0;
+#endif
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_SetReplayConfig()
+	
+	Purpose:	Replay packet capture files recorded with GoIO_Diags_SetPacketCapturePrefix(). Each capture file shows up
+				in GoIO_UpdateListOfAvailableDevices() as a device of the captured type, named "replay:<product id>:<index>",
+				and packets from the file are fed to the lib as if they were being read from the device.
+
+				pConfig is a comma separated list of key=value pairs:
+					speed=X			playback speed relative to the original timing, e.g. 1, 10 or 0.5(default 1).
+									0 delivers packets as fast as the lib's queues accept them.
+					file=PATH		capture file to replay. Repeat the key to replay several files at once.
+									PATH may not contain commas.
+				An empty string disables replay.
+
+				Commands in the capture act as gates: replay does not move past a captured command until the app
+				sends a command of its own, and the timing restarts from that point. So the app should issue the same
+				sequence of GoIO calls as the captured session did, starting from GoIO_Sensor_Open().
+
+				GoIO_Init() applies the GOIO_REPLAY environment variable, if it is set, in the same format.
+				Call this before GoIO_UpdateListOfAvailableDevices(). Sensors that are already open are not affected.
+
+				Currently only supported on Linux.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_SetReplayConfig(
+	const char *pConfig)//[in] NULL terminated config string.
+{
+	gtype_int32 nResult = -1;
+#ifdef TARGET_OS_LINUX
+	if (pConfig && GSkipPacketReplay::SetConfig(pConfig))
+		nResult = 0;
+#endif
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_GetSensorOpenTimings()
+
+	Purpose:	Report how long each phase of GoIO_Sensor_Open() took for hSensor. This is mainly useful for tracking down
+				slow startup with many devices attached, and for benchmarking the lib between releases.
+
+				Phases that do not apply to the device type, e.g. flashReadSeconds for a Go! Temp, are set to 0.
+				The phase times add up to a little less than totalSeconds, because validating the request
+				and registering the new sensor are not counted in any phase.
+
+	Return:		0 if hSensor is valid, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_GetSensorOpenTimings(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
+	GoIOSensorOpenTimings *pTimings)//[out]
+{
+	gtype_int32 nResult = 0;
+	if ((!pTimings) || (!OpenSensorVector_FindAndLockSensor(hSensor)))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pTimings = pGoIOSensor->m_openTimings;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_GetCmdLatencyStats()
+
+	Purpose:	Retrieve latency statistics for one command id, accumulated over all the GoIO_Sensor_SendCmdAndGetResponse()
+				calls for hSensor, including the ones the lib makes internally, e.g. in GoIO_Sensor_Open(). This is meant 
+				for tracking down sporadic slow responses, which GoIO_Sensor_GetLastCmdResponseStatus() cannot show.
+
+				Two latencies are recorded for each command, and each is counted in a histogram with logarithmic buckets:
+				histogram bucket k counts latencies from 2^k to 2^(k+1) - 1 microseconds, except that bucket 0 also 
+				counts anything faster, and bucket GOIO_CMD_LATENCY_NUM_BUCKETS - 1 counts anything slower.
+					firstPacketHistogram	cmd sent -> first response packet read by the lib.
+					completeHistogram		cmd first sent -> complete response, including any retries.
+				Commands that time out are counted in numTimeouts rather than completeHistogram.
+
+				Recording only costs a few atomic increments, and this routine does not lock the sensor, so it may be 
+				called from any thread, even while the owning thread is stuck waiting for a response.
+
+	Return:		0 if successful, else -1(invalid hSensor or cmd out of range).
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_GetCmdLatencyStats(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
+	unsigned char cmd,				//[in] command code. See SKIP_CMD_ID_* in GSkipCommExt.h.
+	GoIOCmdLatencyStats *pStats)//[out]
+{
+	gtype_int32 nResult = -1;
+	GSkipCmdLatencyStats stats;
+	if (pStats && OpenSensorVector_FindSensorAndLockList(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		if (pGoIOSensor->m_pInterface->GetCmdLatencyStats(cmd, &stats))
+		{
+			pStats->numCmds = stats.nNumCmds;
+			pStats->numTimeouts = stats.nNumTimeouts;
+			pStats->numErrors = stats.nNumErrors;
+			pStats->numRetries = stats.nNumRetries;
+			for (int i = 0; i < GOIO_CMD_LATENCY_NUM_BUCKETS; i++)
+			{
+				pStats->firstPacketHistogram[i] = stats.firstPacketHistogram[i];
+				pStats->completeHistogram[i] = stats.completeHistogram[i];
+			}
+			nResult = 0;
+		}
+
+		OpenSensorVector_UnlockList();
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_ResetCmdLatencyStats()
+
+	Purpose:	Zero the statistics reported by GoIO_Diags_GetCmdLatencyStats() for all command ids on hSensor.
+				Like GoIO_Diags_GetCmdLatencyStats(), this does not lock the sensor.
+
+	Return:		0 if successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_ResetCmdLatencyStats(
+	GOIO_SENSOR_HANDLE hSensor)//[in] handle to open sensor.
+{
+	gtype_int32 nResult = -1;
+	if (OpenSensorVector_FindSensorAndLockList(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pInterface->ResetCmdLatencyStats();
+		nResult = 0;
+
+		OpenSensorVector_UnlockList();
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_GetCounters()
+
+	Purpose:	Retrieve the I/O counters for hSensor. The counters are always on, and cost an increment or two per packet,
+				so they can be polled in production to spot flaky cables, overloaded hosts and apps that fall behind.
+
+					measurementPacketsReceived	measurement packets read from the device.
+					cmdRespPacketsReceived		command response packets read, including initRespPacketsReceived.
+					initRespPacketsReceived		responses to SKIP_CMD_ID_INIT.
+					packetsDropped				packets discarded because the lib's queue was full when they arrived.
+					rollingCounterGaps			measurement packets whose rolling counter did not follow on from the 
+												previous packet, i.e. the device or the USB stack lost packets.
+					transferErrors				failed USB reads and writes, including transferTimeouts.
+					transferTimeouts			USB writes that timed out.
+					bytesWritten				command bytes written to the device.
+					queueHighWaterMark			most measurements ever waiting in the measurement queue.
+					consumerLagMeasurements		measurements waiting in the queue right now.
+					consumerLagMs				ms since the app last read measurements, or 0 if none are waiting.
+					numSensors					1.
+
+				Like GoIO_Diags_GetCmdLatencyStats(), this does not lock the sensor, so it may be called from any thread.
+				The counters are read without synchronization, so counters that are related may be off by a packet.
+
+	Return:		0 if hSensor is valid, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_GetCounters(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
+	GoIOCounters *pCounters)//[out]
+{
+	gtype_int32 nResult = -1;
+	GSkipIOCounters counters;
+	if (pCounters && OpenSensorVector_FindSensorAndLockList(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pInterface->GetIOCounters(&counters);
+		memset(pCounters, 0, sizeof(*pCounters));
+		GoIOCounters_Add(pCounters, counters);
+		pCounters->numSensors = 1;
+		nResult = 0;
+
+		OpenSensorVector_UnlockList();
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_GetAggregateCounters()
+
+	Purpose:	Add up the GoIO_Diags_GetCounters() counters for all the sensors opened since GoIO_Init(), including 
+				ones that have been closed. queueHighWaterMark and consumerLagMs are the largest values of any open
+				sensor, consumerLagMeasurements is summed over open sensors, and numSensors is the number of open sensors.
+
+	Return:		0 if successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_GetAggregateCounters(
+	GoIOCounters *pCounters)//[out]
+{
+	gtype_int32 nResult = -1;
+	GSkipIOCounters counters;
+	if (pCounters && openSensorVectorMutex)
+	{
+		if (GThread::OSTryLockMutex(openSensorVectorMutex, SKIP_LIB_MNG_MUTEX_TIMEOUT_MS))
+		{
+			(*pCounters) = closedSensorCounters;
+			for (size_t i = 0; i < openSensorVector.size(); i++)
+			{
+				((CGoIOSensor *) openSensorVector[i])->m_pInterface->GetIOCounters(&counters);
+				GoIOCounters_Add(pCounters, counters);
+			}
+			pCounters->numSensors = (gtype_uint32) openSensorVector.size();
+			nResult = 0;
+
+			GThread::OSUnlockMutex(openSensorVectorMutex);
+		}
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_OpenBinaryLog()
+
+	Purpose:	Start recording lib events, e.g. commands sent, errors and (at GOIO_TRACE_SEVERITY_LOWEST) every packet 
+				received, to a compact binary log file. Use the GoIO_LogDecode tool to convert the file to text.
+
+				Unlike the debug trace output controlled by GoIO_Diags_SetDebugTraceThreshold(), events are not
+				formatted when they are recorded. Each thread copies its events into its own ring buffer, and a 
+				background thread writes them to the file, so logging costs well under a microsecond per event
+				and never waits on disk I/O. If the background thread falls behind, events are discarded and the
+				number discarded is recorded in the log.
+
+				Opening a log closes any log that is already open. On Linux, GoIO_Init() opens a log with 
+				threshold GOIO_TRACE_SEVERITY_LOW if the GOIO_BINLOG environment variable names the file.
+
+	Return:		0 if the file was created, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_OpenBinaryLog(
+	const char *pFileName,	//[in] NULL terminated file name.
+	gtype_int32 threshold)//[in] Only events with a severity >= threshold are recorded.
+{
+	return GBinaryLog::Open(pFileName, threshold) ? 0 : -1;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_CloseBinaryLog()
+
+	Purpose:	Stop recording events, write out any that are still queued, and close the file opened by
+				GoIO_Diags_OpenBinaryLog(). GoIO_Uninit() calls this.
+
+	Return:		0.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_CloseBinaryLog()
+{
+	GBinaryLog::Close();
+	return 0;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_StartTimeline()
+
+	Purpose:	Start recording a timeline of what the lib is doing, for viewing in chrome://tracing or 
+				https://ui.perfetto.dev. Spans are recorded for the GoIO_Sensor_*() calls that talk to devices, 
+				SendCmdAndGetResponse(), packet reads and queueing on the listener threads, and(on Linux) waits for
+				locks. The depth of each measurement queue is recorded as a counter.
+
+				Each thread records into its own ring of eventsPerThread events, so the timeline holds the most 
+				recent events and recording never blocks. When the timeline is not running, the cost is one test
+				of a flag per instrumented call. Call GoIO_Diags_WriteTimeline() to save the events.
+
+				Restarting the timeline discards the events already recorded. On Linux, GoIO_Init() starts the
+				timeline if the GOIO_TIMELINE environment variable names a file, and GoIO_Uninit() writes it.
+
+	Return:		0 if successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_StartTimeline(
+	gtype_int32 eventsPerThread)//[in] ring size, 0 for the default(16384 events).
+{
+	if (0 == eventsPerThread)
+		eventsPerThread = GTIMELINE_DEFAULT_EVENTS_PER_THREAD;
+	return GTimeline::Start(eventsPerThread) ? 0 : -1;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_StopTimeline()
+
+	Purpose:	Stop recording the timeline started by GoIO_Diags_StartTimeline(). The events already recorded 
+				are kept until the timeline is restarted.
+
+	Return:		0.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_StopTimeline()
+{
+	GTimeline::Stop();
+	return 0;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Diags_WriteTimeline()
+
+	Purpose:	Write the recorded timeline to a file in the Chrome trace event JSON format. Timestamps are in
+				microseconds since GoIO_Diags_StartTimeline(). Events carry the device they relate to(0 if none)
+				as args.device. Counters are named "<counter> <device>".
+
+				This may be called while the timeline is running, but then the oldest events of each thread are
+				left out, since they may be being overwritten.
+
+	Return:		0 if the file was written, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_WriteTimeline(
+	const char *pFileName)	//[in] NULL terminated file name.
+{
+	if (NULL == pFileName)
+		return -1;
+	return GTimeline::WriteChromeTrace(pFileName) ? 0 : -1;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_UpdateListOfAvailableDevices()
+	
+	Purpose:	This routine queries the operating system to build a list of available devices
+				that have the specified USB vendor id and product id. Only Go! Link, Go! Temp, and Go! Motion
+				vendor and product id's are supported.
+
+	Return:		number of devices found.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_UpdateListOfAvailableDevices(
+	gtype_int32 vendorId,	//[in]
+	gtype_int32 productId)	//[in]
+{
+#ifdef TARGET_OS_LINUX
+	if (DaemonClient_IsConnected())
+		return DaemonClient_UpdateListOfAvailableDevices(vendorId, productId);
+#endif
+
+	GSTD_TIMELINE_SPAN("GoIO_UpdateListOfAvailableDevices", 0, productId);
+	gtype_int32 numDevices = 0;
+	if (VERNIER_DEFAULT_VENDOR_ID == vendorId)
+	{
+		StringVector deviceVec;
+		if (SKIP_DEFAULT_PRODUCT_ID == productId)
+		{
+			deviceVec = GSkipDevice::GetAvailableDevices();
+			GSkipDevice::StoreSnapshotOfAvailableDevices(deviceVec);
+		}
+		else
+		if (USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID == productId)
+		{
+			deviceVec = GUSBDirectTempDevice::GetAvailableDevices();
+			GUSBDirectTempDevice::StoreSnapshotOfAvailableDevices(deviceVec);
+		}
+		else
+		if (CYCLOPS_DEFAULT_PRODUCT_ID == productId)
+		{
+			deviceVec = GCyclopsDevice::GetAvailableDevices();
+			GCyclopsDevice::StoreSnapshotOfAvailableDevices(deviceVec);
+		}
+		else
+		if (MINI_GC_DEFAULT_PRODUCT_ID == productId)
+		{
+			deviceVec = GMiniGCDevice::GetAvailableDevices();
+			GMiniGCDevice::StoreSnapshotOfAvailableDevices(deviceVec);
+		}
+		numDevices = deviceVec.size();
+	}
+
+	return numDevices;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_GetNthAvailableDeviceName()
+	
+	Purpose:	Get a unique device name string for the n'th device in the list of known devices with a specified
+				USB vendor id and product id. This routine will only succeed if GoIO_UpdateListOfAvailableDevices()
+				has been called previously.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_GetNthAvailableDeviceName(
+	char *pBuf,		//[out] ptr to buffer to store device name string.
+	gtype_int32 bufSize,	//[in] number of bytes in buffer pointed to by pBuf. Strlen(pBuf) < bufSize, because the string is NULL terminated.
+	gtype_int32 vendorId,	//[in]
+	gtype_int32 productId,	//[in]
+	gtype_int32 N)			//[in] index into list of known devices, 0 => first device in list.
+{
+#ifdef TARGET_OS_LINUX
+	if (DaemonClient_IsConnected())
+		return DaemonClient_GetNthAvailableDeviceName(pBuf, bufSize, vendorId, productId, N);
+#endif
+
+	gtype_int32 nResult = -1;
+	GSTD_ASSERT(pBuf != NULL);
+	GSTD_ASSERT(bufSize > 0);
+	cppstring deviceName;
+	if (VERNIER_DEFAULT_VENDOR_ID == vendorId)
+	{
+		if (SKIP_DEFAULT_PRODUCT_ID == productId)
+		{
+			const StringVector &skipDeviceVec = GSkipDevice::GetSnapshotOfAvailableDevices();
+			if ((gtype_int32)skipDeviceVec.size() > N)
+				deviceName = skipDeviceVec[N];
+		}
+		else
+		if (USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID == productId)
+		{
+			const StringVector &jonahDeviceVec = GUSBDirectTempDevice::GetSnapshotOfAvailableDevices();
+			if ((gtype_int32)jonahDeviceVec.size() > N)
+				deviceName = jonahDeviceVec[N];
+		}
+        else
+		if (CYCLOPS_DEFAULT_PRODUCT_ID == productId)
+		{
+			const StringVector &cyclopsDeviceVec = GCyclopsDevice::GetSnapshotOfAvailableDevices();
+			if ((gtype_int32)cyclopsDeviceVec.size() > N)
+				deviceName = cyclopsDeviceVec[N];
+		}
+        else
+		if (MINI_GC_DEFAULT_PRODUCT_ID == productId)
+		{
+			const StringVector &MiniGCDeviceVec = GMiniGCDevice::GetSnapshotOfAvailableDevices();
+			if ((gtype_int32)MiniGCDeviceVec.size() > N)
+				deviceName = MiniGCDeviceVec[N];
+		}
+		strncpy(pBuf, deviceName.c_str(), bufSize);
+		pBuf[bufSize - 1] = 0;
+		if ((strlen(pBuf) == deviceName.size()) && (strlen(pBuf) > 0))
+			nResult = 0;
+	}
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_Open()
+	
+	Purpose:	Open a specified Go! device and the attached sensor.. 
+	
+				If the device is already open, then this routine will fail.
+
+				In addition to establishing basic communication with the device, this routine will initialize the
+				device. If a smart sensor is attached to the Go! device, then this routine will query the device for
+				the DDS sensor configuration parameters.
+
+				The following commands are sent to Go! Temp devices:
+					SKIP_CMD_ID_INIT,
+					SKIP_CMD_ID_READ_LOCAL_NV_MEM. - read DDS record
+
+				The following commands are sent to Go! Link devices:
+					SKIP_CMD_ID_INIT,
+					SKIP_CMD_ID_GET_SENSOR_ID,
+					SKIP_CMD_ID_READ_REMOTE_NV_MEM, - read DDS record if this is a 'smart' sensor
+					SKIP_CMD_ID_SET_ANALOG_INPUT_CHANNEL. - based on sensor EProbeType
+
+				Since the device stops sending measurements in response to SKIP_CMD_ID_INIT, an application must send
+				SKIP_CMD_ID_START_MEASUREMENTS to the device in order to receive measurements.
+
+				At any given time, a sensor is 'owned' by only one thread. The thread that calls this routine is the
+				initial owner of the sensor. If a GoIO() call is made from a thread that does not own the sensor object
+				that is passed in, then the call will generally fail. To allow another thread to access a sensor,
+				the owning thread should call GoIO_Sensor_Unlock(), and then the new thread must call GoIO_Sensor_Lock().
+  
+	Return:		handle to open sensor device if successful, else NULL.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL GOIO_SENSOR_HANDLE GoIO_Sensor_Open(
+	const char *pDeviceName,			//[in] NULL terminated string that uniquely identifies the device.
+	gtype_int32 vendorId,				//[in] USB vendor id
+	gtype_int32 productId,				//[in] USB product id
+	gtype_int32 strictDDSValidationFlag)//[in] insist on exactly valid checksum if 1, else use a more lax validation test.
+{
+#ifdef TARGET_OS_LINUX
+	if (DaemonClient_IsConnected())
+		return DaemonClient_SensorOpen(pDeviceName, vendorId, productId, strictDDSValidationFlag);
+#endif
+
+	GSTD_TIMELINE_SPAN("GoIO_Sensor_Open", 0, productId);
+	//First find out if this device is already open.
+	CGoIOSensor *pNewSensor = NULL;
+	GPortRef newPortRef(kPortType_USB, pDeviceName, pDeviceName, vendorId, productId);
+	int nResult = 0;
+	GSensorDDSRec DDSRec;
+	int nBytesRead;
+	GoIOSensorOpenTimings openTimings;
+	unsigned long long openStartUs = GUtils::OSGetTimeStampMicroseconds();
+	unsigned long long phaseStartUs = openStartUs;
+
+	memset(&openTimings, 0, sizeof(openTimings));
+	bool bFound = OpenSensorVector_FindSensorByName(pDeviceName, vendorId, productId);
+
+	if (bFound)
+		nResult = -1;
+	else
+	if (!openSensorVectorMutex)
+		nResult = -1;
+	else
+	if (VERNIER_DEFAULT_VENDOR_ID != vendorId)
+		nResult = -1;
+	else
+	if ((USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID != productId) && (SKIP_DEFAULT_PRODUCT_ID != productId) &&
+        (CYCLOPS_DEFAULT_PRODUCT_ID != productId) && (MINI_GC_DEFAULT_PRODUCT_ID != productId))
+		nResult = -1;
+
+	if (0 == nResult)
+	{
+		GoIOSensor_EndOpenPhase(&phaseStartUs);
+		pNewSensor = new CGoIOSensor(&newPortRef);
+		pNewSensor->m_pInterface->SetDiagnosticsFlag(GoIOTraceEnableFlag != 0);
+		GoIOSensor_ApplyPendingQueueConfig(pNewSensor, pDeviceName);
+		nResult = pNewSensor->m_pInterface->Open(&newPortRef);
+		openTimings.portOpenSeconds = GoIOSensor_EndOpenPhase(&phaseStartUs);
+	}
+
+	if (0 == nResult)
+    {
+        GCyclopsInitParams initParams;
+        int initParamsSize = 0;
+        void *pInitParams = NULL;
+		int timeoutMs = SKIP_TIMEOUT_MS_DEFAULT;
+		if (CYCLOPS_DEFAULT_PRODUCT_ID == productId)
+		{
+			memset(&initParams, 0, sizeof(initParams));
+#ifdef TARGET_HANDHELD
+			initParams.hostType = SKIP_HOST_TYPE_CALCULATOR;
+#else
+			initParams.hostType = SKIP_HOST_TYPE_COMPUTER;
+#endif
+			pInitParams = &initParams;
+			initParamsSize = sizeof(initParams);
+        }
+		else if (SKIP_DEFAULT_PRODUCT_ID == productId)
+			timeoutMs = SKIP_TIMEOUT_MS_CMD_ID_INIT_WO_BUSY_STATUS;
+		else if (MINI_GC_DEFAULT_PRODUCT_ID == productId)
+			timeoutMs = SKIP_TIMEOUT_MS_CMD_ID_INIT_WO_BUSY_STATUS;
+
+
+		nResult = pNewSensor->m_pInterface->SendCmdAndGetResponse(SKIP_CMD_ID_INIT, pInitParams, initParamsSize, 
+								  NULL, NULL, timeoutMs);
+	}
+
+	if (0 == nResult)
+	{
+		pNewSensor->m_pInterface->OSClearMeasurementPacketQueue();
+		openTimings.initSeconds = GoIOSensor_EndOpenPhase(&phaseStartUs);
+
+		if (USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID == productId)
+		{
+			//This is a Jonah.
+			//Read the DDS memory.
+			nResult = pNewSensor->m_pInterface->ReadSensorDDSMemory((unsigned char *) &DDSRec, 0, sizeof(DDSRec), 
+				SKIP_TIMEOUT_MS_READ_DDSMEMBLOCK);
+			if (0 == nResult)
+			{
+				if (!GMBLSensor::VerifyDDSChecksum(DDSRec, (strictDDSValidationFlag != 0)))
+					nResult = -2;
+			}
+			if (0 == nResult)
+				pNewSensor->m_pMBLSensor->SetDDSRec(DDSRec, true);
+			openTimings.ddsReadSeconds = GoIOSensor_EndOpenPhase(&phaseStartUs);
+		}
+        else
+		if (CYCLOPS_DEFAULT_PRODUCT_ID == productId)
+		{
+			//This is Cyclops..
+			//Read the DDS memory. This is a fake read - we generate a Cyclops specific DDS record here. spam
+			pNewSensor->m_pInterface->ReadSensorDDSMemory((unsigned char *) &DDSRec, 0, sizeof(DDSRec), 
+				SKIP_TIMEOUT_MS_READ_DDSMEMBLOCK);
+			pNewSensor->m_pMBLSensor->SetDDSRec(DDSRec, true);
+			openTimings.ddsReadSeconds = GoIOSensor_EndOpenPhase(&phaseStartUs);
+		}
+		else
+		{
+			//This is a Skip or a Mini GC.
+			GSkipFlashMemoryRecord flashRec;
+			GSkipGetSensorIdCmdResponsePayload getSensorIdResponsePayload;
+
+			nResult = ((GSkipDevice *) pNewSensor->m_pInterface)->ReadSkipFlashRecord(&flashRec, SKIP_TIMEOUT_MS_READ_FLASH);
+			if (0 == nResult)
+				((GSkipDevice *) pNewSensor->m_pInterface)->SetSkipFlashRecord(flashRec);//Do this so that measurements are properly calibrated in ConvertToVoltage().
+			openTimings.flashReadSeconds = GoIOSensor_EndOpenPhase(&phaseStartUs);
+
+			//Find out what sensor is connected.
+			if (0 == nResult)
+			{
+				nBytesRead = sizeof(GSkipGetSensorIdCmdResponsePayload);
+				nResult = pNewSensor->m_pInterface->SendCmdAndGetResponse(SKIP_CMD_ID_GET_SENSOR_ID, NULL, 0, 
+					&getSensorIdResponsePayload, &nBytesRead);
+				openTimings.sensorIdSeconds = GoIOSensor_EndOpenPhase(&phaseStartUs);
+			}
+			if (0 == nResult)
+			{
+				//Parse out sensor id.
+				int nSensorId;
+				GUtils::OSConvertBytesToInt(getSensorIdResponsePayload.lsbyteLswordSensorId, 
+					getSensorIdResponsePayload.msbyteLswordSensorId, getSensorIdResponsePayload.lsbyteMswordSensorId, 
+					getSensorIdResponsePayload.msbyteMswordSensorId, &nSensorId);
+
+				if (nSensorId < 0)
+					nSensorId = 0;
+				else
+				if (nSensorId > 255)
+					nSensorId = 0;
+
+				pNewSensor->m_pMBLSensor->SetID(nSensorId);
+				if (pNewSensor->m_pMBLSensor->IsSmartSensor())
+				{
+					//Read the DDS memory.
+					nResult = pNewSensor->m_pInterface->ReadSensorDDSMemory((unsigned char *) &DDSRec, 0, sizeof(DDSRec), 
+						SKIP_TIMEOUT_MS_READ_DDSMEMBLOCK);
+					if (0 == nResult)
+					{
+						if (!GMBLSensor::VerifyDDSChecksum(DDSRec, (strictDDSValidationFlag != 0)))
+							nResult = -2;
+					}
+					if (0 == nResult)
+						pNewSensor->m_pMBLSensor->SetDDSRec(DDSRec, true);
+					openTimings.ddsReadSeconds = GoIOSensor_EndOpenPhase(&phaseStartUs);
+				}
+			}
+			if (0 == nResult)
+			{
+				//Setup the analog input channel based on the sensor's probe type.
+				GSkipSetAnalogInputChannelParams setAnalogInputChannelParams;
+				setAnalogInputChannelParams.analogInputChannel = (pNewSensor->m_pMBLSensor->GetProbeType() == kProbeTypeAnalog10V) ? 
+					SKIP_ANALOG_INPUT_CHANNEL_VIN : SKIP_ANALOG_INPUT_CHANNEL_VIN_LOW;
+
+				nResult = pNewSensor->m_pInterface->SendCmdAndGetResponse(SKIP_CMD_ID_SET_ANALOG_INPUT_CHANNEL, 
+					&setAnalogInputChannelParams, sizeof(GSkipSetAnalogInputChannelParams), NULL, NULL);
+				openTimings.channelSetupSeconds = GoIOSensor_EndOpenPhase(&phaseStartUs);
+			}
+		}
+	}
+
+	if (0 != nResult)
+	{
+		if (pNewSensor)
+			delete pNewSensor;
+		pNewSensor = NULL;
+	}
+	else
+	{
+		openTimings.totalSeconds = ((gtype_real64) (GUtils::OSGetTimeStampMicroseconds() - openStartUs))/1000000.0;
+		pNewSensor->m_openTimings = openTimings;
+
+		//Add new sensor to list of open devices.
+		OpenSensorVector_AddSensor(pNewSensor);
+	}
+
+	return pNewSensor;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_Close()
+	
+	Purpose:	Close a specified sensor. After this routine succeeds the hSensor handle is no longer valid.
+	
+	Return:		0 if successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_Close(
+	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
+{
+#ifdef TARGET_OS_LINUX
+	if (DaemonClient_IsConnected())
+		return DaemonClient_SensorClose(hSensor);
+#endif
+
+	GSTD_TIMELINE_SPAN("GoIO_Sensor_Close", 0, 0);
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+
+		if (0 == (pGoIOSensor->m_pInterface->GetHostIOStatus() & SKIP_HOST_IO_STATUS_TIMED_OUT))
+		{
+			GSkipSetLedStateParams ledParams;		//Set the LED back to orange.
+			ledParams.color = kLEDOrange;
+			ledParams.brightness = kSkipOrangeLedBrightness;
+			pGoIOSensor->m_pInterface->SendCmdAndGetResponse(SKIP_CMD_ID_SET_LED_STATE, &ledParams, sizeof(ledParams), NULL, NULL);
+
+			if (pGoIOSensor->m_pInterface->AreMeasurementsEnabled())
+				pGoIOSensor->m_pInterface->SendCmd(SKIP_CMD_ID_STOP_MEASUREMENTS, NULL, 0);
+		}
+
+		pGoIOSensor->m_pInterface->SetMeasurementCallback(NULL, NULL);
+		pGoIOSensor->m_pInterface->ReleaseMeasurementWaiters();
+		pGoIOSensor->m_pInterface->Close();
+
+		OpenSensorVector_RemoveSensor(hSensor);
+
+		UnlockSensor(hSensor);
+
+		delete pGoIOSensor;
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_GetOpenDeviceName()
+	
+	Purpose:	Get the unique device name string and USB id's for a specified open device.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetOpenDeviceName(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	char *pBuf,				//[out] ptr to buffer to store device name string.
+	gtype_int32 bufSize,	//[in] number of bytes in buffer pointed to by pBuf. Strlen(pBuf) < bufSize, because the string is NULL terminated.
+	gtype_int32 *pVendorId,	//[out]
+	gtype_int32 *pProductId)//[out]
+{
+#ifdef TARGET_OS_LINUX
+	if (DaemonClient_IsConnected())
+		return DaemonClient_GetOpenDeviceName(hSensor, pBuf, bufSize, pVendorId, pProductId);
+#endif
+
+	GSTD_ASSERT(pBuf != NULL);
+	GSTD_ASSERT(bufSize > 0);
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		GPortRef portRef = pGoIOSensor->m_pInterface->GetPortRef();
+		*pVendorId = portRef.GetUSBVendorID();
+		*pProductId = portRef.GetUSBProductID();
+		cppstring deviceName = portRef.GetLocation();
+		strncpy(pBuf, deviceName.c_str(), bufSize);
+		pBuf[bufSize - 1] = 0;
+		if ((strlen(pBuf) != deviceName.size()) || (strlen(pBuf) == 0))
+			nResult = -1;
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_Lock()
+	
+	Purpose:	Lock a specified sensor so that no other thread can access it. This routine will fail if the sensor
+				is currently locked by another thread.
+
+				GoIO_Sensor_Lock() increments the lock count for the specified sensor by 1. In order for a second
+				thread to acquire access to the sensor, the first thread must call GoIO_Sensor_Unlock() until the lock
+				count reaches 0. Note that the lock count is set to 1 by GoIO_Sensor_Open().
+				
+				It is ok for the lock count to be greater than 1 when GoIO_Sensor_Close() is called.
+
+				This is an advanced routine that most users should not use. It is only necessary if an application
+				needs to access a single sensor from multiple threads.
+	
+	Return:		0 if successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_Lock(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	gtype_int32 timeoutMs)		//[in] wait this long to acquire the lock before failing.
+{
+	unsigned int nStartTime = GUtils::OSGetTimeStamp();
+	bool bLocked = false;
+	do
+	{
+		bLocked = OpenSensorVector_FindAndLockSensor(hSensor);
+		if (bLocked)
+			break;
+		else
+		{
+			int sleepTimeMs = nStartTime + timeoutMs - 10 - GUtils::OSGetTimeStamp();
+			if (sleepTimeMs <= 0)
+				break;
+			else
+			{
+				if (sleepTimeMs > 50)
+					sleepTimeMs = 50;
+				GUtils::Sleep(sleepTimeMs);
+			}
+		}
+	}
+	while ((GUtils::OSGetTimeStamp() - nStartTime) <= (unsigned int)timeoutMs);
+
+	return bLocked ? 0 : -1;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_Unlock()
+	
+	Purpose:	Decrement the lock count for the specified sensor by 1. This routine will fail if the sensor
+				is not currently locked by the calling thread.
+
+				In order for a second thread to acquire access to the sensor, the first thread must call 
+				GoIO_Sensor_Unlock() until the lock count reaches 0. Note that the lock count is set to 1 by 
+				GoIO_Sensor_Open().
+
+				If the lock count reaches zero, it is important to make a call to GoIO_Sensor_Lock() to lock the
+				device. This will prevent multiple threads from simultaneously accessing the device, which can cause
+				unpredictable results.
+				
+				It is ok for the lock count to be greater than 1 when GoIO_Sensor_Close() is called.
+
+				This is an advanced routine that most users should not use. It is only necessary if an application
+				needs to access a single sensor from multiple threads.
+	
+	Return:		0 if successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_Unlock(
+	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		UnlockSensor(hSensor); //Undo the FindAndLock.
+
+		if (!pGoIOSensor->m_pInterface->UnlockDevice())
+			nResult = -1;
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_ClearIO()
+	
+	Purpose:	Clear the input/output communication buffers for a specified sensor. 
+				This also expties the GoIO Measurement Buffer, which holds measurements that have been retrieved from 
+				the sensor.
+	
+	Return:		0 if successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_ClearIO(
+	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
+{
+#ifdef TARGET_OS_LINUX
+	if (DaemonClient_IsConnected())
+		return DaemonClient_ClearIO(hSensor);
+#endif
+
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		nResult = pGoIOSensor->m_pInterface->ClearIO();
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_SendCmdAndGetResponse()
+	
+	Purpose:	Send a command to the specified Go! device and wait for a response. 
+	
+	Return:		0 if successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_SendCmdAndGetResponse(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	unsigned char cmd,			//[in] command code. See SKIP_CMD_ID_* in GSkipCommExt.h.
+	void *pParams,				//[in] ptr to cmd specific parameter block, may be NULL. See GSkipCommExt.h.
+	gtype_int32 nParamBytes,	//[in] # of bytes in (*pParams).
+	void *pRespBuf,				//[out] ptr to destination buffer, may be NULL. See GSkipCommExt.h.
+	gtype_int32 *pnRespBytes,	//[in, out] ptr to size of of pRespBuf buffer on input, size of response on output, may be NULL if pRespBuf is NULL.
+	gtype_int32 timeoutMs)		//[in] # of milliseconds to wait for a reply before giving up. Go! devices should reply to almost all the 
+								//currently defined commands within SKIP_DEFAULT_TIMEOUT_MS(1000) milliseconds. In fact, typical response
+								//times are less than 50 milliseconds. See SKIP_TIMEOUT_MS_* definitions.
+{
+#ifdef TARGET_OS_LINUX
+	if (DaemonClient_IsConnected())
+		return DaemonClient_SendCmdAndGetResponse(hSensor, cmd, pParams, nParamBytes, pRespBuf, pnRespBytes, timeoutMs);
+#endif
+
+	GSTD_TIMELINE_SPAN("GoIO_Sensor_SendCmdAndGetResponse", 0, cmd);
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		GSTD_ASSERT(sizeof(gtype_int32) == sizeof(int));
+		nResult = pGoIOSensor->m_pInterface->SendCmdAndGetResponse(cmd, pParams, nParamBytes, pRespBuf, (int *) pnRespBytes, timeoutMs);
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_GetLastCmdResponseStatus()
+	
+	Purpose:	Get error information for the device. 
+	
+				In principle, any command sent to the device can result in an error. 
+				If GoIO_Sensor_SendCmdAndGetResponse() ever fails and returns a non-zero return code,
+				you can gather additional info about what went wrong by calling GoIO_Sensor_GetLastCmdResponseStatus().
+
+	Return:		0 if successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetLastCmdResponseStatus(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	unsigned char *pLastCmd,	//[out] last cmd sent to the sensor
+	unsigned char *pLastCmdStatus,//[out] status of last command sent to the sensor.
+								  //If command ran successfully and the device reported good status, then this will be be SKIP_STATUS_SUCCESS(aka 0).
+								  //If no response has been reported back from the device, then this will be SKIP_STATUS_ERROR_COMMUNICATION.
+								  //If the device reported a failure, then this will be a cmd specific error, eg SKIP_STATUS_ERROR_...
+	unsigned char *pLastCmdWithErrorRespSentOvertheWire, //[out] last cmd sent that caused the device to report back an error.
+	unsigned char *pLastErrorSentOvertheWire)//[out] last error that came back from the device 'over the wire'.
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pInterface->GetLastCmdResponseStatus(pLastCmd, pLastCmdStatus, pLastCmdWithErrorRespSentOvertheWire, pLastErrorSentOvertheWire);
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_SendCmd()
+	
+	Purpose:	GoIO_Sensor_SendCmd() is an advanced function. You should usually use 
+				GoIO_Sensor_SendCmdAndGetResponse() instead. After calling GoIO_Sensor_SendCmd(), you must call
+				GoIO_Sensor_GetNextResponse() before sending any more commands to the device.
+
+				The main reason that GoIO_Sensor_SendCmd() is made available to the user is to allow a program to send
+				SKIP_CMD_ID_START_MEASUREMENTS commands to several different devices as close together as possible so that
+				measurements start at about the same time on separate devices.
+	
+	Return:		0 if successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_SendCmd(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	unsigned char cmd,	//[in] command code
+	void *pParams,			//[in] ptr to cmd specific parameter block, may be NULL. See GSkipCommExt.h.
+	gtype_int32 nParamBytes)//[in] # of bytes in (*pParams).
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		GSTD_ASSERT(sizeof(gtype_int32) == sizeof(int));
+		nResult = pGoIOSensor->m_pInterface->SendCmd(cmd, pParams, nParamBytes);
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_GetNextResponse()
+	
+	Purpose:	GoIO_Sensor_GetNextResponse() is an advanced function. You should usually use 
+				GoIO_Sensor_SendCmdAndGetResponse() instead. After calling GoIO_Sensor_SendCmd(), you must call
+				GoIO_Sensor_GetNextResponse() before sending any more commands to the device.
+
+
+	Return:		0 if successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetNextResponse(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	void *pRespBuf,				//[out] ptr to destination buffer, may be NULL. See GSkipCommExt.h.
+	gtype_int32 *pnRespBytes,	//[in, out] ptr to size of of pRespBuf buffer on input, size of response on output, may be NULL if pRespBuf is NULL.
+	unsigned char *pCmd,		//[out] identifies which command this response is for. Ptr must NOT be NULL!
+	gtype_int32 *pErrRespFlag,	//[out] flag(1 or 0) indicating that the response contains error info. Ptr must NOT be NULL!
+	gtype_int32 nTimeoutMs)		//[in] # of milliseconds to wait before giving up.
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		GSTD_ASSERT(sizeof(gtype_int32) == sizeof(int));
+		bool errRespFlag = false;
+		nResult = pGoIOSensor->m_pInterface->GetNextResponse(pRespBuf, (int *) pnRespBytes, pCmd, &errRespFlag, nTimeoutMs);
+		if (0 == nResult)
+			(*pErrRespFlag) = errRespFlag ? 1 : 0;
+
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_GetMeasurementTickInSeconds()
+	
+	Purpose:	The measurement period for Go! devices is specified in discrete 'ticks', so the actual time between 
+				measurements is an integer multiple of the tick time. The length of time between ticks is different 
+				for Go! Link versus Go! Temp. 
+	
+	Return:		If hSensor is not valid, then this routine returns -1.0, else the return value = the length of time
+				in seconds between ticks.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_real64 GoIO_Sensor_GetMeasurementTickInSeconds(
+	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
+{
+#ifdef TARGET_OS_LINUX
+	if (DaemonClient_IsConnected())
+		return DaemonClient_GetMeasurementTickInSeconds(hSensor);
+#endif
+
+	gtype_real64 tickTime;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		tickTime = -1.0;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		tickTime = pGoIOSensor->m_pInterface->GetMeasurementTickInSeconds();
+
+		UnlockSensor(hSensor);
+	}
+
+	return tickTime;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_GetMinimumMeasurementPeriod()
+	
+	Return:		If hSensor is not valid, then this routine returns -1.0, else the return value = minimum measurement
+				period in seconds that is supported by the device.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_real64 GoIO_Sensor_GetMinimumMeasurementPeriod(
+	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
+{
+#ifdef TARGET_OS_LINUX
+	if (DaemonClient_IsConnected())
+		return DaemonClient_GetMinimumMeasurementPeriod(hSensor);
+#endif
+
+	gtype_real64 minPeriod;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		minPeriod = -1.0;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		minPeriod = pGoIOSensor->m_pInterface->GetMinimumMeasurementPeriodInSeconds();
+
+		UnlockSensor(hSensor);
+	}
+
+	return minPeriod;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_GetMaximumMeasurementPeriod()
+	
+	Return:		If hSensor is not valid, then this routine returns -1.0, else the return value = maximum measurement
+				period in seconds that is supported by the device.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_real64 GoIO_Sensor_GetMaximumMeasurementPeriod(
+	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
+{
+#ifdef TARGET_OS_LINUX
+	if (DaemonClient_IsConnected())
+		return DaemonClient_GetMaximumMeasurementPeriod(hSensor);
+#endif
+
+	gtype_real64 maxPeriod;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		maxPeriod = -1.0;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		maxPeriod = pGoIOSensor->m_pInterface->GetMaximumMeasurementPeriodInSeconds();
+
+		UnlockSensor(hSensor);
+	}
+
+	return maxPeriod;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_SetMeasurementPeriod()
+	
+	Purpose:	Set the measurement period to a specified number of seconds. The Go! sensor will report measurements
+				to the computer at the measurement period interval once measurements have been started. These 
+				measurements are held in the GoIO Measurement Buffer. 
+				See documentation for GoIO_Sensor_GetNumMeasurementsAvailable().
+
+				This routine sends SKIP_CMD_ID_SET_MEASUREMENT_PERIOD to the sensor with the parameter block configured 
+				for the desiredPeriod.
+
+				Because the measurement period is constrained to be a multiple of the tick returned by
+				GoIO_Sensor_GetMeasurementTickInSeconds(), and because it must be 
+					>= GoIO_Sensor_GetMinimumMeasurementPeriod(), and
+					<= GoIO_Sensor_GetMaximumMeasurementPeriod(), 
+				the actual period is slightly different than the desiredPeriod.
+
+				You can determine the actual period by calling GoIO_Sensor_GetMeasurementPeriod().
+
+				This routine will fail if we are currently collecting measurements from the sensor. Note that collection
+				is started by sending SKIP_CMD_ID_START_MEASUREMENTS to the sensor, and stopped by sending 
+				SKIP_CMD_ID_STOP_MEASUREMENTS.
+	
+	Return:		0 if successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_SetMeasurementPeriod(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	gtype_real64 desiredPeriod,	//[in] desired measurement period in seconds.
+	gtype_int32 timeoutMs)		//[in] # of milliseconds to wait for a reply before giving up. SKIP_TIMEOUT_MS_DEFAULT is recommended.
+{
+#ifdef TARGET_OS_LINUX
+	if (DaemonClient_IsConnected())
+		return DaemonClient_SetMeasurementPeriod(hSensor, desiredPeriod, timeoutMs);
+#endif
+
+	GSTD_TIMELINE_SPAN("GoIO_Sensor_SetMeasurementPeriod", 0, 0);
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		nResult = pGoIOSensor->m_pInterface->SetMeasurementPeriod(desiredPeriod, timeoutMs);
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_GetMeasurementPeriod()
+	
+	Return:		1000000.0 if not successful, else the measurement period in seconds.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_real64 GoIO_Sensor_GetMeasurementPeriod(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	gtype_int32 timeoutMs)		//[in] # of milliseconds to wait for a reply before giving up. SKIP_TIMEOUT_MS_DEFAULT is recommended.
+{
+#ifdef TARGET_OS_LINUX
+	if (DaemonClient_IsConnected())
+		return DaemonClient_GetMeasurementPeriod(hSensor, timeoutMs);
+#endif
+
+	gtype_real64 period;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		period = -1.0;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		period = pGoIOSensor->m_pInterface->GetMeasurementPeriod(timeoutMs);
+
+		UnlockSensor(hSensor);
+	}
+
+	return period;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_GetNumMeasurementsAvailable()
+	
+	Purpose:	Report the number of measurements currently stored in the GoIO Measurement Buffer. 
+
+				After SKIP_CMD_ID_START_MEASUREMENTS has been sent to the sensor, the sensor starts
+				sending measurements to the host computer. These measurements are stored in the 
+				GoIO Measurement Buffer. A separate GoIO Measurement Buffer is maintained for each
+				open sensor.
+
+				The first measurement is sent almost immediatedly after SKIP_CMD_ID_START_MEASUREMENTS
+				is issued. Subsequent measurements are sent at the currently configured measurement
+				period interval. See GoIO_Sensor_SetMeasurementPeriod().
+
+				Call GoIO_Sensor_ReadRawMeasurements() to retrieve measurements from the
+				GoIO Measurement Buffer. The GoIO Measurement Buffer is guaranteed to hold up to 1000
+				measurements. The buffer is circular, so if you do not service it often enough, the
+				oldest measurements in the buffer are lost. If you wish to capture all the 
+				measurements coming from the sensor, you must call GoIO_Sensor_ReadRawMeasurements()
+				often enough so that the GoIO_Sensor_GetNumMeasurementsAvailable() does not reach 1000.
+
+				Each of the following actions clears the GoIO Measurement Buffer:
+					1) Call GoIO_Sensor_ReadRawMeasurements() with count set to GoIO_Sensor_GetNumMeasurementsAvailable(), or
+					2) Call GoIO_Sensor_GetLatestRawMeasurementEx() with drainBuffer set, or
+					3) Call GoIO_Sensor_ClearIO().
+
+				The GoIO Measurement Buffer is empty after GoIO_Sensor_Open() is called. It does not
+				start filling up until SKIP_CMD_ID_START_MEASUREMENTS is sent to the sensor.
+
+				Note that the sensor stops sending measurements to the host computer after
+				SKIP_CMD_ID_STOP_MEASUREMENTS or SKIP_CMD_ID_INIT is sent, but sending these commands
+				does not clear the GoIO Measurement Buffer.
+
+	Return:		number of measurements currently stored in the GoIO Measurement Buffer. 
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetNumMeasurementsAvailable(
+GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
+{
+#ifdef TARGET_OS_LINUX
+	if (DaemonClient_IsConnected())
+		return DaemonClient_GetNumMeasurementsAvailable(hSensor);
+#endif
+
+	GSTD_TIMELINE_SPAN("GoIO_Sensor_GetNumMeasurementsAvailable", 0, 0);
+	gtype_int32 nResult = 0;
+	if (OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		nResult = pGoIOSensor->m_pInterface->MeasurementsAvailable();
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_SetMeasurementQueueConfig()
+	
+	Purpose:	Configure the GoIO Measurement Buffer of a sensor before it is opened. The config is applied by
+				GoIO_Sensor_Open() when pDeviceName is opened. If pDeviceName is NULL, the config becomes the default
+				for devices that have not been given a config of their own. Configs are forgotten by GoIO_Init().
+				Use GoIO_Sensor_SetMeasurementQueueConfig() to change the config of a sensor that is already open.
+
+				capacity is in packets. Each packet holds 1 to 3 measurements. The default is 1999.
+
+				overflowPolicy decides what happens to a packet that arrives when the buffer is full:
+					GOIO_QUEUE_OVERFLOW_DROP_OLDEST		discard the oldest packet in the buffer. This is the default.
+					GOIO_QUEUE_OVERFLOW_DROP_NEWEST		discard the new packet.
+					GOIO_QUEUE_OVERFLOW_BLOCK_PRODUCER	stop reading from the device for up to blockTimeoutMs to give the
+														app time to make space, then discard the new packet. While the
+														device is not being read, packets back up in the USB stack, which
+														may drop them. The wait is skipped while a command is waiting for
+														its response, and after a wait times out until the app next reads.
+				Each full buffer event is counted in queueOverflows by GoIO_Diags_GetCounters(), and each discarded packet
+				in packetsDropped.
+
+				Only Linux supports configuring the GoIO Measurement Buffer. On other platforms the config is rejected
+				when the sensor is opened, but the open still succeeds.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+#define GOIO_QUEUE_OVERFLOW_DROP_OLDEST 0
+#define GOIO_QUEUE_OVERFLOW_DROP_NEWEST 1
+#define GOIO_QUEUE_OVERFLOW_BLOCK_PRODUCER 2
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_SetMeasurementQueueConfig(
+	const char *pDeviceName,	//[in] NULL terminated string that uniquely identifies the device, or NULL for all devices.
+	gtype_int32 capacity,		//[in] in packets.
+	gtype_int32 overflowPolicy,	//[in] GOIO_QUEUE_OVERFLOW_*.
+	gtype_int32 blockTimeoutMs)	//[in] only used by GOIO_QUEUE_OVERFLOW_BLOCK_PRODUCER.
+{
+	gtype_int32 nResult = -1;
+	GSkipQueueConfig config;
+	config.nCapacity = capacity;
+	config.eOverflowPolicy = (ESkipQueueOverflowPolicy) overflowPolicy;
+	config.nBlockTimeoutMs = blockTimeoutMs;
+	if ((capacity < 1) || (capacity > SKIP_MAX_MEASUREMENT_QUEUE_CAPACITY) || (blockTimeoutMs < 0) ||
+		(overflowPolicy < GOIO_QUEUE_OVERFLOW_DROP_OLDEST) || (overflowPolicy > GOIO_QUEUE_OVERFLOW_BLOCK_PRODUCER))
+		nResult = -1;
+	else
+	if (openSensorVectorMutex && GThread::OSTryLockMutex(openSensorVectorMutex, SKIP_LIB_MNG_MUTEX_TIMEOUT_MS))
+	{
+		pendingQueueConfigs[(pDeviceName != NULL) ? cppstring(pDeviceName) : cppstring()] = config;
+		nResult = 0;
+
+		GThread::OSUnlockMutex(openSensorVectorMutex);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_SetMeasurementQueueConfig()
+	
+	Purpose:	Change the capacity and overflow policy of the GoIO Measurement Buffer of an open sensor. This may be called 
+				while measurements are being collected. If the buffer shrinks, the newest measurements are kept.
+				See GoIO_SetMeasurementQueueConfig().
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_SetMeasurementQueueConfig(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	gtype_int32 capacity,		//[in] in packets.
+	gtype_int32 overflowPolicy,	//[in] GOIO_QUEUE_OVERFLOW_*.
+	gtype_int32 blockTimeoutMs)	//[in] only used by GOIO_QUEUE_OVERFLOW_BLOCK_PRODUCER.
+{
+	gtype_int32 nResult = -1;
+	if (OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		GSkipQueueConfig config;
+		config.nCapacity = capacity;
+		config.eOverflowPolicy = (ESkipQueueOverflowPolicy) overflowPolicy;
+		config.nBlockTimeoutMs = blockTimeoutMs;
+		if (kResponse_OK == pGoIOSensor->m_pInterface->SetMeasurementQueueConfig(config))
+			nResult = 0;
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_GetMeasurementQueueConfig()
+	
+	Purpose:	Get the capacity and overflow policy of the GoIO Measurement Buffer of an open sensor.
+				See GoIO_SetMeasurementQueueConfig().
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetMeasurementQueueConfig(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
+	gtype_int32 *pCapacity,			//[out] in packets.
+	gtype_int32 *pOverflowPolicy,	//[out] GOIO_QUEUE_OVERFLOW_*.
+	gtype_int32 *pBlockTimeoutMs)	//[out]
+{
+	gtype_int32 nResult = -1;
+	if (OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		GSkipQueueConfig config;
+		pGoIOSensor->m_pInterface->GetMeasurementQueueConfig(&config);
+		(*pCapacity) = config.nCapacity;
+		(*pOverflowPolicy) = config.eOverflowPolicy;
+		(*pBlockTimeoutMs) = config.nBlockTimeoutMs;
+		nResult = 0;
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_SetMeasurementSpillFile()
+	
+	Purpose:	Let the GoIO Measurement Buffer overflow to disk, for long captures where the app may sometimes fall far
+				behind. Once highWatermark packets are waiting in the buffer, further packets are appended to pFileName
+				instead, until the app has read all of them. GoIO_Sensor_ReadRawMeasurements() returns the spilled 
+				measurements in order after the ones that were in memory, and GoIO_Sensor_GetNumMeasurementsAvailable()
+				counts them. So a slow app costs disk space rather than measurements.
+
+				The file is created(or overwritten) by this call, reused from the start whenever the app catches up, and 
+				deleted when the sensor is closed or spilling is stopped. Pass a NULL or empty pFileName to stop spilling. 
+				This fails while spilled measurements are still waiting to be read.
+
+				highWatermark is in packets, and is capped at the buffer capacity(see GoIO_SetMeasurementQueueConfig()).
+				Packets written to the file are counted in packetsSpilled by GoIO_Diags_GetCounters(), and packets lost
+				because the file could not be written in spillErrors.
+
+				Only Linux supports spilling.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_SetMeasurementSpillFile(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	const char *pFileName,		//[in] NULL terminated file name, or NULL to stop spilling.
+	gtype_int32 highWatermark)	//[in] in packets.
+{
+	gtype_int32 nResult = -1;
+	if ((highWatermark >= 0) && OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		if (kResponse_OK == pGoIOSensor->m_pInterface->SetMeasurementSpillFile((pFileName != NULL) ? cppstring(pFileName) : cppstring(), 
+				highWatermark))
+			nResult = 0;
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+//Sensor and conversion info for recording or publishing. The device fills in the rest. Caller must hold the sensor lock.
+static void GetRecordingMetadata(
+	CGoIOSensor *pGoIOSensor,			//[in]
+	GSkipRecordingMetadata *pMetadata)	//[out]
+{
+	memset(pMetadata, 0, sizeof(GSkipRecordingMetadata));
+	EProbeType eProbeType = pGoIOSensor->m_pMBLSensor->GetProbeType();
+	pMetadata->nProbeType = eProbeType;
+	pMetadata->fVoltsOffset = pGoIOSensor->m_pInterface->ConvertToVoltage(0, eProbeType);
+	pMetadata->fVoltsPerBit = (pGoIOSensor->m_pInterface->ConvertToVoltage(1000, eProbeType) - pMetadata->fVoltsOffset)/1000.0;
+	pGoIOSensor->m_pMBLSensor->GetDDSRec(&pMetadata->ddsRec);
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Recorder_Start()
+	
+	Purpose:	Record every measurement that arrives from the sensor to pFileName, for captures that must be kept intact.
+				Measurements are still delivered to the GoIO Measurement Buffer(or the measurement callback) as usual.
+				The recording holds the raw measurements with their sample indices, host arrival times, the gaps where
+				measurements were lost on the way from the sensor, and the sensor's DDS record(including the calibration
+				pages), probe type, measurement period and voltage conversion. If the measurement period is changed
+				while recording, the new period is recorded too.
+
+				A background thread writes the file in large aligned blocks, and the listener thread only hands it a batch
+				of measurements every few hundred measurements or 250 milliseconds, so recording does not slow down 
+				acquisition. The file is written at least once a second, and every chunk in it is checksummed. The file 
+				layout is described in GSkipRecorder.h, and the GoIO_RecordingDump tool converts recordings to text.
+
+				The measurements are compressed(see GoIO_Recorder_StartEx()), which typically makes the file several
+				times smaller than the raw measurements.
+
+				The file is created(or overwritten) by this call. Only one recording per sensor may be in progress.
+				Call GoIO_Recorder_Stop() to finish the recording; closing the sensor also finishes it.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Recorder_Start(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	const char *pFileName)		//[in] NULL terminated file name.
+{
+	return GoIO_Recorder_StartEx(hSensor, pFileName, GOIO_RECORDER_OPTION_COMPRESS);
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Recorder_StartEx()
+	
+	Purpose:	Same as GoIO_Recorder_Start(), but with options:
+
+				GOIO_RECORDER_OPTION_COMPRESS stores each batch of measurements as the first measurement followed by 
+				the zigzag encoded differences between neighbouring measurements, bit packed per frame of 64 at the width
+				of the largest difference in the frame. Slowly changing signals need only a few bits per measurement.
+
+				GOIO_RECORDER_OPTION_CALIBRATED also stores the calibrated value of every measurement, computed with the
+				calibration in the sensor's DDS record when the measurement was recorded. Each value is XORed with the 
+				previous one and only the bits that changed are stored, so repeated or slowly changing values take a 
+				few bits each. Implies GOIO_RECORDER_OPTION_COMPRESS.
+
+				Each batch is compressed on its own, so batches that are waiting for the background writer are 
+				compressed in parallel on a pool of threads, and readers can decompress them in parallel too.
+				Pass 0 for options to record the raw measurements uncompressed.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Recorder_StartEx(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	const char *pFileName,		//[in] NULL terminated file name.
+	gtype_int32 options)		//[in] GOIO_RECORDER_OPTION_* flags.
+{
+	gtype_int32 nResult = -1;
+	if ((NULL != pFileName) && (0 != pFileName[0]) && OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		GSkipRecordingMetadata metadata;
+		GetRecordingMetadata(pGoIOSensor, &metadata);
+		int nOptions = 0;
+		if (options & GOIO_RECORDER_OPTION_COMPRESS)
+			nOptions |= kSkipRecorderOption_Compress;
+		if (options & GOIO_RECORDER_OPTION_CALIBRATED)
+			nOptions |= kSkipRecorderOption_Calibrated;
+		if (kResponse_OK == pGoIOSensor->m_pInterface->StartRecording(pFileName, metadata, nOptions))
+			nResult = 0;
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Recorder_Stop()
+	
+	Purpose:	Write out the measurements still waiting to be recorded, end the recording started by GoIO_Recorder_Start(),
+				and close the file.
+
+	Return:		0 iff successful, else -1(e.g. if nothing was being recorded).
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Recorder_Stop(
+	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
+{
+	gtype_int32 nResult = -1;
+	if (OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		if (kResponse_OK == pGoIOSensor->m_pInterface->StopRecording())
+			nResult = 0;
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Recorder_GetStats()
+	
+	Purpose:	Report on the recording started by GoIO_Recorder_Start(). samplesLost counts measurements that were 
+				discarded because the disk could not keep up. If writeFailed is set, the disk reported an error and
+				nothing further is being written.
+
+	Return:		0 iff successful, else -1(e.g. if nothing is being recorded).
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Recorder_GetStats(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
+	gtype_uint64 *pSamplesRecorded,	//[out] measurements handed to the background writer.
+	gtype_uint64 *pSamplesMissing,	//[out] measurements lost between the sensor and the computer.
+	gtype_uint64 *pSamplesLost,		//[out] measurements discarded by the recorder.
+	gtype_uint64 *pBytesWritten,	//[out]
+	gtype_bool *pWriteFailed)		//[out]
+{
+	gtype_int32 nResult = -1;
+	if (OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		GSkipRecorderStats stats;
+		if (pGoIOSensor->m_pInterface->GetRecordingStats(&stats))
+		{
+			(*pSamplesRecorded) = stats.nSamplesRecorded;
+			(*pSamplesMissing) = stats.nSamplesMissing;
+			(*pSamplesLost) = stats.nSamplesLost;
+			(*pBytesWritten) = stats.nBytesWritten;
+			(*pWriteFailed) = stats.bWriteFailed ? 1 : 0;
+			nResult = 0;
+		}
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_StartPublishing()
+	
+	Purpose:	Publish every measurement that arrives from the sensor to a ring in named shared memory, so that any number
+				of other processes(or other parts of this one) can follow the sensor with GoIO_Stream_Open(), without
+				going through the process that owns it. Measurements are still delivered to the GoIO Measurement Buffer
+				(or the measurement callback) as usual.
+
+				Each measurement is published as a GoIOStreamSample, with its sample index, host arrival time, raw 
+				value, voltage and calibrated value(computed with the calibration in the sensor's DDS record), so 
+				readers do not need access to the sensor. The ring holds the newest numSlots measurements. Publishing
+				costs the listener thread a few stores per measurement, no matter how many readers there are, and 
+				readers never slow it down: a reader that falls more than numSlots measurements behind loses the oldest
+				ones, and GoIO_Stream_GetStatus() reports how many.
+
+				Only one process may publish a given device. Call GoIO_Sensor_StopPublishing() to stop; closing the 
+				sensor also stops publishing.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_StartPublishing(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	gtype_int32 numSlots)		//[in] # of measurements the ring holds, rounded up to a power of 2. 
+								//0 means GOIO_STREAM_DEFAULT_NUM_SLOTS.
+{
+	gtype_int32 nResult = -1;
+	if ((numSlots >= 0) && OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		GSkipRecordingMetadata metadata;
+		GetRecordingMetadata(pGoIOSensor, &metadata);
+		if (kResponse_OK == pGoIOSensor->m_pInterface->StartPublishing(metadata, 
+				(numSlots > 0) ? numSlots : GOIO_STREAM_DEFAULT_NUM_SLOTS))
+			nResult = 0;
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_StopPublishing()
+	
+	Purpose:	Stop publishing the measurements from the sensor. Readers that are attached can still read the 
+				measurements that were published, and GoIO_Stream_GetStatus() tells them that publishing stopped.
+
+	Return:		0 iff successful, else -1(e.g. if nothing was being published).
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_StopPublishing(
+	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
+{
+	gtype_int32 nResult = -1;
+	if (OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		if (kResponse_OK == pGoIOSensor->m_pInterface->StopPublishing())
+			nResult = 0;
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Stream_Open()
+	
+	Purpose:	Attach to the measurements that some process is publishing for pDeviceName with 
+				GoIO_Sensor_StartPublishing(). The device does not need to be opened in this process, and GoIO_Init() is
+				not required. Each stream handle has its own read position, which starts at the newest measurement, or 
+				at the oldest one still in the ring if fromOldest is set.
+
+				Reading is plain memory access, without system calls, so poll with GoIO_Stream_Read() as often as needed.
+				A stream handle may only be used by one thread at a time.
+
+	Return:		handle to the stream if successful, else NULL(e.g. if nothing is being published for pDeviceName).
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL GOIO_STREAM_HANDLE GoIO_Stream_Open(
+	const char *pDeviceName,	//[in] NULL terminated string that identifies the device, as passed to GoIO_Sensor_Open().
+	gtype_bool fromOldest)		//[in]
+{
+	GSkipStreamReader *pReader = NULL;
+	if ((NULL != pDeviceName) && (0 != pDeviceName[0]))
+	{
+		pReader = new GSkipStreamReader();
+		if (!pReader->Open(cppstring(pDeviceName), (0 != fromOldest)))
+		{
+			delete pReader;
+			pReader = NULL;
+		}
+	}
+
+	return pReader;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Stream_Close()
+	
+	Purpose:	Detach from the stream, and invalidate hStream.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Stream_Close(
+	GOIO_STREAM_HANDLE hStream)	//[in] handle from GoIO_Stream_Open().
+{
+	if (NULL == hStream)
+		return -1;
+
+	delete ((GSkipStreamReader *) hStream);
+	return 0;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Stream_Read()
+	
+	Purpose:	Copy up to maxCount measurements, oldest first, from the stream's read position, and advance it past them.
+
+	Return:		# of measurements copied, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Stream_Read(
+	GOIO_STREAM_HANDLE hStream,		//[in] handle from GoIO_Stream_Open().
+	GoIOStreamSample *pSamples,		//[out] buffer with room for maxCount samples.
+	gtype_int32 maxCount)			//[in]
+{
+	if ((NULL == hStream) || (NULL == pSamples) || (maxCount < 0))
+		return -1;
+
+	return ((GSkipStreamReader *) hStream)->Read((GSkipStreamSample *) pSamples, maxCount);
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Stream_Peek()
+	
+	Purpose:	Zero copy alternative to GoIO_Stream_Read(): point (*ppSamples) at up to maxCount measurements in the 
+				shared memory, from the stream's read position on, without advancing it. Fewer than maxCount may be 
+				returned when the measurements wrap around the end of the ring, even if more are available.
+
+				Once done with them, call GoIO_Stream_Consume() with the # used. The publisher does not wait for readers,
+				so it may overwrite the oldest of them meanwhile if the reader is nearly a ring behind. 
+				GoIO_Stream_Consume() reports how many were overwritten, so the caller can discard what it got from them.
+
+	Return:		# of measurements at (*ppSamples), else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Stream_Peek(
+	GOIO_STREAM_HANDLE hStream,			//[in] handle from GoIO_Stream_Open().
+	const GoIOStreamSample **ppSamples,	//[out] read only.
+	gtype_int32 maxCount)				//[in]
+{
+	if ((NULL == hStream) || (NULL == ppSamples) || (maxCount < 0))
+		return -1;
+
+	const GSkipStreamSample *pSamples = NULL;
+	gtype_int32 nNumSamples = ((GSkipStreamReader *) hStream)->Peek(&pSamples, maxCount);
+	(*ppSamples) = (const GoIOStreamSample *) pSamples;
+	return nNumSamples;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Stream_Consume()
+	
+	Purpose:	Advance the stream's read position past count measurements returned by GoIO_Stream_Peek().
+
+	Return:		# of the measurements, counting from the first one, that were overwritten before this call and must
+				be discarded(usually 0), else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Stream_Consume(
+	GOIO_STREAM_HANDLE hStream,	//[in] handle from GoIO_Stream_Open().
+	gtype_int32 count)			//[in]
+{
+	if ((NULL == hStream) || (count < 0))
+		return -1;
+
+	return ((GSkipStreamReader *) hStream)->Consume(count);
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Stream_GetStatus()
+	
+	Purpose:	Report on the stream. isPublishing is cleared once the publisher stops. samplesLost counts measurements
+				that were overwritten before this handle read them. measurementPeriod applies from sample index
+				periodFirstSampleIndex on; it is 0.0 if the publisher did not know it.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Stream_GetStatus(
+	GOIO_STREAM_HANDLE hStream,			//[in] handle from GoIO_Stream_Open().
+	gtype_bool *pIsPublishing,			//[out]
+	gtype_int32 *pNumAvailable,			//[out] measurements after the read position.
+	gtype_uint64 *pSamplesLost,			//[out]
+	gtype_real64 *pMeasurementPeriod,	//[out] in seconds.
+	gtype_uint64 *pPeriodFirstSampleIndex)//[out]
+{
+	GSkipStreamReader *pReader = (GSkipStreamReader *) hStream;
+	GSkipRecordingMetadata metadata;
+	if ((NULL == pReader) || !pReader->GetMetadata(&metadata))
+		return -1;
+
+	(*pIsPublishing) = pReader->IsPublishing() ? 1 : 0;
+	(*pNumAvailable) = pReader->GetNumAvailable();
+	(*pSamplesLost) = pReader->GetNumLost();
+	(*pMeasurementPeriod) = metadata.fMeasurementPeriod;
+	(*pPeriodFirstSampleIndex) = metadata.firstSampleIndex;
+	return 0;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_AddConsumer()
+	
+	Purpose:	Register a consumer of the sensor's measurements within this process. GoIO_Sensor_ReadRawMeasurements() 
+				removes the measurements it returns, so only one part of an app can use it; consumers let several parts,
+				such as a logger and a live display, each see every measurement, at their own pace, with no need for one
+				of them to pass the measurements on to the others.
+
+				The measurements are kept once, in a ring of numSlots measurements per sensor shared by all its consumers,
+				and each consumer has its own read position in it, so a second consumer costs no extra copies. The ring
+				is created along with the first consumer. New consumers start at the newest measurement. Measurements are
+				still delivered to the GoIO Measurement Buffer(or the measurement callback) as usual.
+
+				policy says what happens when the consumer falls numSlots measurements behind:
+					GOIO_CONSUMER_POLICY_SKIP	the oldest measurements are overwritten, and the consumer loses them.
+					GOIO_CONSUMER_POLICY_BLOCK	GoIO waits for the consumer to read, so it does not lose any. No
+												measurements are read from the sensor meanwhile, so a blocking consumer
+												that falls behind slows the sensor down for everyone, and the sensor
+												drops measurements if it is held up for long. GoIO stops waiting for a 
+												consumer that has not read anything for a second, until it reads again.
+				GoIO_Consumer_GetStatus() reports the lag of the slowest consumer, so apps can see how close they are to
+				losing measurements or to holding up the sensor.
+
+				The GoIO_Consumer_* routines do not lock the sensor, so each consumer can be used on a thread of its own.
+				A consumer handle may only be used by one thread at a time. Consumers remain valid after the sensor is 
+				closed, and must be removed with GoIO_Consumer_Remove().
+
+	Return:		handle to the consumer if successful, else NULL.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL GOIO_CONSUMER_HANDLE GoIO_Sensor_AddConsumer(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	gtype_int32 policy,			//[in] GOIO_CONSUMER_POLICY_*
+	gtype_int32 numSlots)		//[in] # of measurements the ring holds, rounded up to a power of 2(and to a whole
+								//number of memory pages if the ring is mapped twice). Only used by the first consumer
+								//of the sensor. 0 means GOIO_CONSUMER_DEFAULT_NUM_SLOTS.
+{
+	GOIO_CONSUMER_HANDLE hConsumer = NULL;
+	if ((GOIO_CONSUMER_POLICY_SKIP != policy) && (GOIO_CONSUMER_POLICY_BLOCK != policy))
+		return NULL;
+	if ((numSlots >= 0) && OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		hConsumer = pGoIOSensor->m_pInterface->AddBroadcastConsumer(
+			(GOIO_CONSUMER_POLICY_BLOCK == policy) ? kSkipBroadcastPolicy_Block : kSkipBroadcastPolicy_Skip,
+			(numSlots > 0) ? numSlots : GOIO_CONSUMER_DEFAULT_NUM_SLOTS);
+
+		UnlockSensor(hSensor);
+	}
+
+	return hConsumer;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Consumer_Remove()
+	
+	Purpose:	Unregister a consumer, and invalidate hConsumer. A blocking consumer must be removed once it stops 
+				reading, or GoIO keeps waiting for it.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Consumer_Remove(
+	GOIO_CONSUMER_HANDLE hConsumer)	//[in] handle from GoIO_Sensor_AddConsumer().
+{
+	if (NULL == hConsumer)
+		return -1;
+
+	GSkipBroadcastBuffer::RemoveConsumer((GSkipBroadcastConsumer *) hConsumer);
+	return 0;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Consumer_ReadRawMeasurements()
+	
+	Purpose:	Copy up to maxCount measurements, oldest first, from the consumer's read position, and advance it past 
+				them. Other consumers still get the measurements. The raw measurements are the same as the ones from 
+				GoIO_Sensor_ReadRawMeasurements().
+
+	Return:		# of measurements copied, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Consumer_ReadRawMeasurements(
+	GOIO_CONSUMER_HANDLE hConsumer,	//[in] handle from GoIO_Sensor_AddConsumer().
+	gtype_int32 *pMeasurementsBuf,	//[out] buffer with room for maxCount measurements.
+	gtype_uint64 *pTimeStampsUs,	//[out] host time stamps in microseconds when the measurements arrived, may be NULL.
+	gtype_int32 maxCount)			//[in]
+{
+	if ((NULL == hConsumer) || (NULL == pMeasurementsBuf) || (maxCount < 0))
+		return -1;
+
+	return ((GSkipBroadcastConsumer *) hConsumer)->Read(pMeasurementsBuf, pTimeStampsUs, maxCount);
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Consumer_PeekRawMeasurements()
+	
+	Purpose:	Copy up to maxCount measurements, starting firstIndex measurements after the consumer's read position,
+				without advancing it, so the same measurements can be looked at again, or read later.
+
+	Return:		# of measurements copied, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Consumer_PeekRawMeasurements(
+	GOIO_CONSUMER_HANDLE hConsumer,	//[in] handle from GoIO_Sensor_AddConsumer().
+	gtype_int32 *pMeasurementsBuf,	//[out] buffer with room for maxCount measurements.
+	gtype_int32 firstIndex,			//[in] 0 => the measurement at the read position.
+	gtype_int32 maxCount)			//[in]
+{
+	if ((NULL == hConsumer) || (NULL == pMeasurementsBuf) || (firstIndex < 0) || (maxCount < 0))
+		return -1;
+
+	return ((GSkipBroadcastConsumer *) hConsumer)->Peek(pMeasurementsBuf, firstIndex, maxCount);
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Consumer_GetStatus()
+	
+	Purpose:	Report on the consumer, and on all the consumers of its sensor.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Consumer_GetStatus(
+	GOIO_CONSUMER_HANDLE hConsumer,	//[in] handle from GoIO_Sensor_AddConsumer().
+	GoIOConsumerStatus *pStatus)	//[out]
+{
+	if ((NULL == hConsumer) || (NULL == pStatus))
+		return -1;
+
+	GSkipBroadcastConsumer *pConsumer = (GSkipBroadcastConsumer *) hConsumer;
+	GSkipBroadcastStats stats;
+	pConsumer->GetStats(&stats);
+	memset(pStatus, 0, sizeof(GoIOConsumerStatus));
+	pStatus->numLost = pConsumer->GetNumLost();
+	pStatus->numWritten = stats.nNumWritten;
+	pStatus->blockedUs = stats.nBlockedUs;
+	pStatus->numBlockTimeouts = stats.nNumBlockTimeouts;
+	pStatus->numAvailable = pConsumer->GetNumAvailable();
+	pStatus->numConsumers = stats.nNumConsumers;
+	pStatus->slowestLag = stats.nSlowestLag;
+	pStatus->maxSlowestLag = stats.nMaxSlowestLag;
+	pStatus->isSensorOpen = pConsumer->IsAttached() ? 1 : 0;
+	return 0;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Consumer_BorrowMeasurements()
+	
+	Purpose:	Zero copy alternative to GoIO_Consumer_ReadRawMeasurements(): point (*ppMeasurements), and 
+				(*ppTimeStampsUs) if it is not NULL, at the measurements after the consumer's read position, where GoIO
+				keeps them, without copying them or advancing the read position. The pointers are read only, and stay
+				valid until the consumer is removed. Bindings can wrap them as arrays without a copy.
+
+				GoIO maps the ring twice back to back in memory where the OS allows, so all the available measurements
+				are returned, contiguously, even when they wrap around the end of the ring. Otherwise (*pCount) may be
+				less than the number available when they wrap; the rest are returned by the next call.
+
+				Once done with them, call GoIO_Consumer_ReleaseMeasurements() with the # used. GoIO does not overwrite
+				the borrowed measurements of a GOIO_CONSUMER_POLICY_BLOCK consumer, unless it gives up waiting for it. 
+				GoIO may overwrite the oldest of the borrowed measurements of a GOIO_CONSUMER_POLICY_SKIP consumer that 
+				is nearly a ring behind, and GoIO_Consumer_ReleaseMeasurements() reports how many, so the caller can 
+				discard what it got from them.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Consumer_BorrowMeasurements(
+	GOIO_CONSUMER_HANDLE hConsumer,			//[in] handle from GoIO_Sensor_AddConsumer().
+	const gtype_int32 **ppMeasurements,		//[out] read only, NULL if (*pCount) is 0.
+	gtype_int32 *pCount,					//[out] # of measurements at (*ppMeasurements).
+	const gtype_uint64 **ppTimeStampsUs)	//[out] host arrival times in microseconds, may be NULL.
+{
+	if ((NULL == hConsumer) || (NULL == ppMeasurements) || (NULL == pCount))
+		return -1;
+
+	(*pCount) = ((GSkipBroadcastConsumer *) hConsumer)->GetSpan((const int **) ppMeasurements, 
+		(const unsigned long long **) ppTimeStampsUs, 0x7fffffff);
+	return 0;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Consumer_ReleaseMeasurements()
+	
+	Purpose:	Advance the consumer's read position past count measurements returned by GoIO_Consumer_BorrowMeasurements().
+
+	Return:		# of the measurements, counting from the first one, that were overwritten before this call and must
+				be discarded(usually 0), else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Consumer_ReleaseMeasurements(
+	GOIO_CONSUMER_HANDLE hConsumer,	//[in] handle from GoIO_Sensor_AddConsumer().
+	gtype_int32 count)				//[in] at most the (*pCount) reported by GoIO_Consumer_BorrowMeasurements().
+{
+	if ((NULL == hConsumer) || (count < 0))
+		return -1;
+
+	return ((GSkipBroadcastConsumer *) hConsumer)->Consume(count);
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_BorrowMeasurements()
+	
+	Purpose:	Same as GoIO_Consumer_BorrowMeasurements(), for callers that do not want to manage a consumer: the first
+				call adds a GOIO_CONSUMER_POLICY_SKIP consumer of GOIO_CONSUMER_DEFAULT_NUM_SLOTS for the sensor, which 
+				this routine and GoIO_Sensor_ReleaseMeasurements() then use until the sensor is closed. 
+
+				The consumer sees the measurements that arrive after the first call, so call this once before sending
+				SKIP_CMD_ID_START_MEASUREMENTS. Its measurements are separate from those in the GoIO Measurement Buffer: 
+				releasing them does not remove them from the GoIO Measurement Buffer, and vice versa.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_BorrowMeasurements(
+	GOIO_SENSOR_HANDLE hSensor,				//[in] handle to open sensor.
+	const gtype_int32 **ppMeasurements,		//[out] read only, NULL if (*pCount) is 0.
+	gtype_int32 *pCount,					//[out] # of measurements at (*ppMeasurements).
+	const gtype_uint64 **ppTimeStampsUs)	//[out] host arrival times in microseconds, may be NULL.
+{
+	gtype_int32 nResult = -1;
+	if ((NULL != ppMeasurements) && (NULL != pCount) && OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		if (NULL == pGoIOSensor->m_pBorrowConsumer)
+			pGoIOSensor->m_pBorrowConsumer = pGoIOSensor->m_pInterface->AddBroadcastConsumer(kSkipBroadcastPolicy_Skip);
+		if (pGoIOSensor->m_pBorrowConsumer)
+			nResult = GoIO_Consumer_BorrowMeasurements(pGoIOSensor->m_pBorrowConsumer, ppMeasurements, pCount, 
+				ppTimeStampsUs);
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_ReleaseMeasurements()
+	
+	Purpose:	Same as GoIO_Consumer_ReleaseMeasurements(), for measurements from GoIO_Sensor_BorrowMeasurements().
+
+	Return:		# of the measurements, counting from the first one, that were overwritten before this call and must
+				be discarded(usually 0), else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_ReleaseMeasurements(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	gtype_int32 count)			//[in] at most the (*pCount) reported by GoIO_Sensor_BorrowMeasurements().
+{
+	gtype_int32 nResult = -1;
+	if (OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		if (pGoIOSensor->m_pBorrowConsumer)
+			nResult = GoIO_Consumer_ReleaseMeasurements(pGoIOSensor->m_pBorrowConsumer, count);
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_ReadRawMeasurements()
+	
+	Purpose:	Retrieve measurements from the GoIO Measurement Buffer. The measurements reported
+				by this routine are actually removed from the GoIO Measurement Buffer.
+
+				After SKIP_CMD_ID_START_MEASUREMENTS has been sent to the sensor, the sensor starts
+				sending measurements to the host computer. These measurements are stored in the 
+				GoIO Measurement Buffer. A separate GoIO Measurement Buffer is maintained for each
+				open sensor. See the description of GoIO_Sensor_GetNumMeasurementsAvailable().
+
+				Even though a raw measurement is reported as an int32, it can be stored in a short 
+				integer: it ranges in value from -32768 to 32767.
+
+				To convert a raw measurement to a voltage use GoIO_Sensor_ConvertToVoltage().
+				To convert a voltage to a sensor specific calibrated unit, use GoIO_Sensor_CalibrateData().
+
+	Return:		number of measurements retrieved from the GoIO Measurement Buffer. This routine
+				returns immediately, so the return value may be less than maxCount.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_ReadRawMeasurements(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
+	gtype_int32 *pMeasurementsBuf,	//[out] ptr to loc to store measurements.
+	gtype_int32 maxCount)			//[in] maximum number of measurements to copy to pMeasurementsBuf.
+{
+#ifdef TARGET_OS_LINUX
+	if (DaemonClient_IsConnected())
+		return DaemonClient_ReadRawMeasurements(hSensor, pMeasurementsBuf, maxCount);
+#endif
+
+	GSTD_TIMELINE_SPAN("GoIO_Sensor_ReadRawMeasurements", 0, maxCount);
+	gtype_int32 nResult = 0;
+	if (OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		intVector vec;
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		vec = pGoIOSensor->m_pInterface->ReadRawMeasurements(maxCount);
+		for (nResult = 0; (nResult < (gtype_int32)vec.size()) && (nResult < maxCount); nResult++)
+			pMeasurementsBuf[nResult] = vec[nResult];
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_GetLatestRawMeasurement()
+	
+	Purpose:	Report the most recent measurement put in the GoIO Measurement Buffer. If no 
+				measurements have been placed in the GoIO Measurement Buffer since it was
+				created byGoIO_Sensor_Open(), then report a value of 0. 
+				
+				This routine leaves the GoIO Measurement Buffer untouched. The most recent measurement is recorded
+				as it arrives, so this routine is cheap enough to call as often as a display needs refreshing.
+				Call GoIO_Sensor_GetLatestRawMeasurementEx() to empty the GoIO Measurement Buffer as well.
+
+				After SKIP_CMD_ID_START_MEASUREMENTS has been sent to the sensor, the sensor starts
+				sending measurements to the host computer. These measurements are stored in the 
+				GoIO Measurement Buffer. A separate GoIO Measurement Buffer is maintained for each
+				open sensor. See the description of GoIO_Sensor_GetNumMeasurementsAvailable().
+
+				Even though a raw measurement is reported as an int32, it can be stored in a short 
+				integer: it ranges in value from -32768 to 32767.
+
+				To convert a raw measurement to a voltage use GoIO_Sensor_ConvertToVoltage().
+				To convert a voltage to a sensor specific calibrated unit, use GoIO_Sensor_CalibrateData().
+
+	Return:		most recent measurement put in the GoIO Measurement Buffer. If no 
+				measurements have been placed in the GoIO Measurement Buffer since it was
+				created byGoIO_Sensor_Open(), then report a value of 0.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetLatestRawMeasurement(
+	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
+{
+#ifdef TARGET_OS_LINUX
+	if (DaemonClient_IsConnected())
+		return DaemonClient_GetLatestRawMeasurement(hSensor);
+#endif
+
+	GSTD_TIMELINE_SPAN("GoIO_Sensor_GetLatestRawMeasurement", 0, 0);
+	gtype_int32 nResult = 0;
+	if (OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		nResult = pGoIOSensor->m_pInterface->GetLatestRawMeasurement();
+
+		UnlockSensor(hSensor);
+	}
+	
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_GetLatestRawMeasurementEx()
+	
+	Purpose:	Same as GoIO_Sensor_GetLatestRawMeasurement(), but also report when the most recent measurement arrived,
+				and optionally empty the GoIO Measurement Buffer.
+
+				The timestamp is the host's millisecond tick count at the moment the packet containing the measurement
+				was received. It wraps around, and only differences between timestamps are meaningful.
+
+				If drainBuffer is non zero, the GoIO Measurement Buffer is emptied, so GoIO_Sensor_GetNumMeasurementsAvailable()
+				will report 0 afterwards. This is what GoIO_Sensor_GetLatestRawMeasurement() did in older versions of GoIO.
+
+	Return:		0 if successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetLatestRawMeasurementEx(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
+	gtype_int32 *pMeasurement,		//[out] most recent measurement, 0 if none have arrived since GoIO_Sensor_Open().
+	gtype_uint32 *pTimeStampMs,		//[out] host time in milliseconds when the measurement arrived, may be NULL.
+	gtype_bool drainBuffer)		//[in] if non zero, empty the GoIO Measurement Buffer as well.
+{
+	gtype_int32 nResult = -1;
+	if (pMeasurement && OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		unsigned int timeStampMs;
+		(*pMeasurement) = pGoIOSensor->m_pInterface->GetLatestRawMeasurement(&timeStampMs, (0 != drainBuffer));
+		if (pTimeStampMs)
+			(*pTimeStampMs) = timeStampMs;
+		nResult = 0;
+
+		UnlockSensor(hSensor);
+	}
+	
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_SetMeasurementCallback()
+	
+	Purpose:	Switch a sensor between queued mode and push mode.
+
+				By default, measurements are stored in the GoIO Measurement Buffer until the application retrieves
+				them with GoIO_Sensor_ReadRawMeasurements(). If pCallback is not NULL, the sensor is placed in push mode:
+				measurements are decoded as they arrive from the device and passed to pCallback in batches. 
+				They are not stored in the GoIO Measurement Buffer, so GoIO_Sensor_GetNumMeasurementsAvailable() stays at 0.
+				GoIO_Sensor_GetLatestRawMeasurement() still reports the most recent measurement.
+
+				pCallback is invoked on the internal thread that receives data from the device, not on the thread
+				that called GoIO_Sensor_SetMeasurementCallback(). Calls for a given sensor never overlap. Each call
+				receives a contiguous array of raw measurements in the order they were taken. The array is only valid
+				for the duration of the call.
+
+				A batch is delivered as soon as it holds at least minBatchSize measurements, or when its oldest
+				measurement is maxLatencyMs old, whichever comes first. The latency bound is approximate: it is checked
+				when packets arrive and when the receiving thread wakes up, typically every 20 to 100 milliseconds.
+				maxLatencyMs = 0 means no latency limit: a batch is only delivered once it holds minBatchSize 
+				measurements, or when the callback is replaced. minBatchSize = 1 delivers every packet immediately.
+
+				pCallback should return quickly. While it runs, no other measurements are received from the sensor.
+				pCallback must not call GoIO_Sensor_* routines for the same sensor.
+
+				Call GoIO_Sensor_SetMeasurementCallback(hSensor, NULL, NULL, 0, 0) to return to queued mode. Any measurements
+				held in a partial batch are delivered to the old callback before this routine returns.
+				GoIO_Sensor_Close() does this automatically.
+
+				Push mode is supported on Windows and Linux.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_SetMeasurementCallback(
+	GOIO_SENSOR_HANDLE hSensor,				//[in] handle to open sensor.
+	GOIO_MEASUREMENT_CALLBACK pCallback,	//[in] routine to receive measurements, or NULL for queued mode.
+	void *pContext,							//[in] passed to pCallback unchanged.
+	gtype_int32 minBatchSize,				//[in] deliver a batch once it holds this many measurements.
+	gtype_int32 maxLatencyMs)				//[in] deliver a partial batch once its oldest measurement is this old, 0 for no limit.
+{
+	gtype_int32 nResult = -1;
+	if (OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+
+		//Detach first so a pending partial batch goes to the old callback.
+		if (kResponse_OK == pGoIOSensor->m_pInterface->SetMeasurementCallback(NULL, NULL))
+		{
+			pGoIOSensor->m_pMeasurementCallback = pCallback;
+			pGoIOSensor->m_pMeasurementCallbackContext = pContext;
+			if (NULL == pCallback)
+				nResult = 0;
+			else
+			if (kResponse_OK == pGoIOSensor->m_pInterface->SetMeasurementCallback(GoIOSensor_MeasurementCallback, 
+				pGoIOSensor, minBatchSize, maxLatencyMs))
+				nResult = 0;
+		}
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_GetReadinessFd()
+	
+	Purpose:	Get a file descriptor that becomes readable when the sensor has something for the application, so
+				that a program can wait on many sensors with a single select(), poll(), or epoll_wait() call.
+
+				The descriptor is signalled when:
+					1) the number of measurements in the GoIO Measurement Buffer reaches the readiness watermark, 
+						see GoIO_Sensor_SetReadinessWatermark(), or
+					2) a command response packet arrives from the sensor.
+
+				The descriptor is an eventfd opened in nonblocking mode. After it becomes readable, read 8 bytes from it
+				to reset it, then call GoIO_Sensor_ReadRawMeasurements() and/or GoIO_Sensor_GetNextResponse().
+				The watermark signal fires once each time the GoIO Measurement Buffer fills up to the watermark. It is
+				rearmed when measurements are removed from the buffer; if the buffer is still at or above the watermark
+				afterwards, the descriptor is signalled again right away.
+
+				The descriptor is created by the first call to this routine and is owned by the sensor: do not close it.
+				It is closed by GoIO_Sensor_Close().
+
+				Measurements delivered through GoIO_Sensor_SetMeasurementCallback() do not signal the descriptor.
+
+				This routine is only supported on Linux.
+
+	Return:		file descriptor, or -1 if not supported or an error occurred.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetReadinessFd(
+	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
+{
+	gtype_int32 nResult = -1;
+	if (OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		nResult = pGoIOSensor->m_pInterface->GetReadinessFd();
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_SetReadinessWatermark()
+	
+	Purpose:	Set the number of measurements that must be in the GoIO Measurement Buffer before the descriptor
+				returned by GoIO_Sensor_GetReadinessFd() is signalled. The default is 1.
+
+	Return:		0 iff successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_SetReadinessWatermark(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
+	gtype_int32 minMeasurements)	//[in] watermark, in measurements.
+{
+	gtype_int32 nResult = -1;
+	if (OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pInterface->SetReadinessWatermark(minMeasurements);
+		nResult = 0;
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_WaitForMeasurements()
+	
+	Purpose:	Block until the GoIO Measurement Buffer holds at least minCount measurements, or until timeoutMs
+				milliseconds have elapsed. 
+
+				The calling thread sleeps until the thread that receives data from the sensor reports that enough
+				measurements have arrived, so this is much cheaper than calling GoIO_Sensor_GetNumMeasurementsAvailable() 
+				in a loop. See GoIO_WaitAny() to wait on several sensors at once.
+
+				The sensor is not locked while we wait, so other threads may read measurements or send commands to it
+				meanwhile. If another thread closes the sensor, the wait ends at once and -1 is returned.
+
+				Measurements delivered through GoIO_Sensor_SetMeasurementCallback() never reach the GoIO Measurement
+				Buffer, so waiting on a sensor in push mode always times out.
+
+	Return:		number of measurements in the GoIO Measurement Buffer. If this is less than minCount, the wait timed out.
+				-1 if hSensor is not valid or was closed during the wait.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_WaitForMeasurements(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
+	gtype_int32 minCount,			//[in] # of measurements to wait for.
+	gtype_int32 timeoutMs)				//[in] # of milliseconds to wait before giving up.
+{
+	gtype_int32 nResult = -1;
+	if (OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		//WaitForMeasurements() unlocks the sensor.
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		int nNumAvailable = -1;
+		GSkipBaseDevice::WaitForMeasurements(&pGoIOSensor->m_pInterface, 1, minCount, timeoutMs, &nNumAvailable);
+		nResult = nNumAvailable;
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_WaitAny()
+	
+	Purpose:	Block until the GoIO Measurement Buffer of at least one of the specified sensors holds minCount or more 
+				measurements, or until timeoutMs milliseconds have elapsed. See GoIO_Sensor_WaitForMeasurements().
+
+				The sensors are not locked while we wait. If another thread closes one of them, the wait ends at once.
+
+	Return:		index into pSensors of a sensor that has at least minCount measurements available. If several sensors are
+				ready, the one with the lowest index is reported. -1 if the wait timed out, if any handle is not valid, or
+				if a sensor was closed during the wait.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_WaitAny(
+	const GOIO_SENSOR_HANDLE *pSensors,	//[in] array of handles to open sensors.
+	gtype_int32 numSensors,			//[in] # of handles in pSensors.
+	gtype_int32 minCount,			//[in] # of measurements to wait for.
+	gtype_int32 timeoutMs)				//[in] # of milliseconds to wait before giving up.
+{
+	gtype_int32 nResult = -1;
+	if (OpenSensorVector_FindAndLockSensors(pSensors, numSensors))
+	{
+		std::vector<GSkipBaseDevice *> devices;
+		gtype_int32 i;
+		for (i = 0; i < numSensors; i++)
+			devices.push_back(((CGoIOSensor *) pSensors[i])->m_pInterface);
+
+		//WaitForMeasurements() unlocks the sensors.
+		nResult = GSkipBaseDevice::WaitForMeasurements(&devices[0], numSensors, minCount, timeoutMs);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_ReadRawMeasurementsMulti()
+	
+	Purpose:	Retrieve measurements from the GoIO Measurement Buffers of several sensors in one call. This is equivalent 
+				to calling GoIO_Sensor_ReadRawMeasurements(pSensors[i], pMeasurementsBufs[i], maxCounts[i]) for each
+				sensor, but all the handles are validated together and every buffer is drained in a single pass, which
+				is considerably cheaper when many sensors are open.
+
+				Unlike GoIO_Sensor_ReadRawMeasurements(), this routine never loses measurements: if the packet fill
+				changes part way through a call, the measurements that did not fit are returned by the next read.
+
+				pCounts[i] is set to the number of measurements copied into pMeasurementsBufs[i].
+
+	Return:		total number of measurements retrieved from all the sensors. This routine returns immediately.
+				-1 if any handle is not valid, in which case no measurements are retrieved.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_ReadRawMeasurementsMulti(
+	const GOIO_SENSOR_HANDLE *pSensors,	//[in] array of handles to open sensors.
+	gtype_int32 numSensors,			//[in] # of handles in pSensors.
+	gtype_int32 **pMeasurementsBufs,	//[out] array of numSensors ptrs to locs to store measurements.
+	const gtype_int32 *maxCounts,		//[in] array of numSensors maximum number of measurements to copy to each buffer.
+	gtype_int32 *pCounts)			//[out] array of numSensors counts of measurements retrieved.
+{
+	gtype_int32 nResult = -1;
+	if (pMeasurementsBufs && maxCounts && pCounts && OpenSensorVector_FindAndLockSensors(pSensors, numSensors))
+	{
+		nResult = 0;
+		for (gtype_int32 i = 0; i < numSensors; i++)
+		{
+			CGoIOSensor *pGoIOSensor = (CGoIOSensor *) pSensors[i];
+			pCounts[i] = 0;
+			if (pMeasurementsBufs[i] && (maxCounts[i] > 0))
+				pCounts[i] = pGoIOSensor->m_pInterface->ReadRawMeasurementsToBuffer((int *) pMeasurementsBufs[i], maxCounts[i]);
+			nResult += pCounts[i];
+
+			UnlockSensor(pSensors[i]);
+		}
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_ConvertToVoltage()
+	
+	Purpose:	Convert a raw measurement in the range -32768 to 32767 into a voltage value.
+				Depending on the type of sensor(see GoIO_Sensor_GetProbeType()), the voltage
+				may range from 0.0 to 5.0, or from -10.0 to 10.0 . For Go! Motion, voltage returned is simply distance
+				in meters.
+
+	Return:		voltage corresponding to a specified raw measurement value.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_real64 GoIO_Sensor_ConvertToVoltage(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	gtype_int32 rawMeasurement)	//[in] raw measurement obtained from GoIO_Sensor_GetLatestRawMeasurement() or 
+								//GoIO_Sensor_ReadRawMeasurements().
+{
+#ifdef TARGET_OS_LINUX
+	if (DaemonClient_IsConnected())
+		return DaemonClient_ConvertToVoltage(hSensor, rawMeasurement);
+#endif
+
+	gtype_real64 volts = 0.0;
+	if (OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		volts = pGoIOSensor->m_pInterface->ConvertToVoltage(rawMeasurement, pGoIOSensor->m_pMBLSensor->GetProbeType());
+
+		UnlockSensor(hSensor);
+	}
+
+	return volts;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_CalibrateData()
+	
+	Purpose:	Convert a voltage value into a sensor specific unit.
+				What units this routine produces can be determined by calling
+				GoIO_Sensor_DDSMem_GetCalPage(hSensor, GoIO_Sensor_DDSMem_GetActiveCalPage(),...) .
+
+	Return:		value in sensor specific units corresponding to a specified voltage. Just return input volts
+				unless GoIO_Sensor_DDSMem_GetCalibrationEquation() indicates kEquationType_Linear.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_real64 GoIO_Sensor_CalibrateData(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	gtype_real64 volts)			//[in] voltage value obtained from GoIO_Sensor_ConvertToVoltage();
+{
+#ifdef TARGET_OS_LINUX
+	if (DaemonClient_IsConnected())
+		return DaemonClient_CalibrateData(hSensor, volts);
+#endif
+
+	gtype_real64 measurement = 0.0;
+	if (OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		measurement = pGoIOSensor->m_pMBLSensor->CalibrateData(volts);
+
+		UnlockSensor(hSensor);
+	}
+
+	return measurement;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_GetProbeType()
+	
+	Purpose:	Find out if the probe type is kProbeTypeAnalog5V or kProbeTypeAnalog10V.
+
+				This attribute is dependent on the OperationType in the SensorDDSRecord. 
+				See GoIO_Sensor_DDSMem_GetOperationType().
+				If (2 == OperationType) then the sensor is kProbeTypeAnalog10V, else kProbeTypeAnalog5V.
+
+				Note that for Go! Link devices, SKIP_CMD_ID_SET_ANALOG_INPUT_CHANNEL must be sent to the device with
+				the analogInputChannel parameter set to SKIP_ANALOG_INPUT_CHANNEL_VIN_LOW for kProbeTypeAnalog5V,
+				or set to SKIP_ANALOG_INPUT_CHANNEL_VIN for kProbeTypeAnalog10V devices. Generally, application
+				programs do not have to deal with this, because GoIO_Sensor_Open() automatically sends
+				SKIP_CMD_ID_SET_ANALOG_INPUT_CHANNEL to the device with the appropriate parameters.
+
+	Return:		kProbeTypeAnalog5V or kProbeTypeAnalog10V.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_GetProbeType(
+	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
+{
+#ifdef TARGET_OS_LINUX
+	if (DaemonClient_IsConnected())
+		return DaemonClient_GetProbeType(hSensor);
+#endif
+
+	gtype_int32 nResult = kProbeTypeAnalog5V;
+	if (OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		nResult = pGoIOSensor->m_pMBLSensor->GetProbeType();
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+
+/***************************************************************************************************************************/
+/***************************************************************************************************************************/
+/***************************************************************************************************************************
+GoIO_Sensor_DDSMem_* routines:
+
+Each GoIO sensor object maintains a SensorDDSRecord of type GSensorDDSRec. The fields in this record describe the sensor.
+The GoIO_Sensor_DDSMem_* routines allow an application program to access the SensorDDSRecord.
+See GSensorDDSMem.h for the declaration of GSensorDDSRec.
+
+Sensors come in 3 basic flavors:
+1) Smart sensors,
+2) AutoId capable sensors that are not smart, and
+3) Legacy sensors.
+
+Smart sensors store the entire 128 byte GSensorDDSRec record on the actual sensor hardware. This allows calibration
+data that is specific to a given sensor to be stored on the sensor. Smart sensors report an AutoId number
+in response to the SKIP_CMD_ID_GET_SENSOR_ID command that is >= kSensorIdNumber_FirstSmartSensor. 
+
+If a sensor reports an AutoId >= kSensorIdNumber_FirstSmartSensor, then GoIO_Sensor_Open() will get the GSensorDDSRec 
+info from the sensor hardware and store in the GoIO sensor object's SensorDDSRecord.
+
+AutoId capable sensors that are not smart report an AutoId value > 0 and < kSensorIdNumber_FirstSmartSensor. 
+
+Legacy (aka Dumb) sensors report an AutoId = 0.
+
+Non smart sensors just get default values for most of the fields in the SensorDDSRecord. The default calibration 
+parameters are configured so that GoIO_Sensor_CalibrateData() just reports volts.
+
+For all 3 types of sensors, SensorDDSRecord.SensorNumber = AutoId after GoIO_Sensor_Open().
+
+****************************************************************************************************************************/
+/***************************************************************************************************************************/
+/***************************************************************************************************************************/
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_DDSMem_WriteRecord()
+	
+	Purpose:	Write the SensorDDSRecord into a smart sensor's DDS memory hardware. 
+				Before the record is written to the sensor, SensorDDSRecord.Checksum is recalculated.
+				Before the record is written to the sensor, a copy of the record is marshalled into little endian format,
+				and then this copy is actually written to the sensor.
+
+				WARNING: Be careful about using this routine. Changing a smart sensor's DDS memory can cause the sensor
+				to stop working with Logger Pro.
+	
+	Return:		0 if successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_WriteRecord(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	gtype_int32 timeoutMs)		//[in] # of milliseconds to wait for a reply before giving up. SKIP_TIMEOUT_MS_WRITE_DDSMEMBLOCK is recommended.
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+
+		if (SKIP_DEFAULT_PRODUCT_ID == pGoIOSensor->m_pInterface->GetProductID())
+		{
+			//Verify that we are dealing with a smart sensor.
+			//Do not try to write the SensorDDSRecord unless this is a smart sensor because old versions of Go! Link(ver. 1.5426)
+			//will hang if we try to write the SensorDDSRecord when no smart sensor is connected.
+			GSkipGetSensorIdCmdResponsePayload getSensorIdResponsePayload;
+			int nBytesRead = sizeof(GSkipGetSensorIdCmdResponsePayload);
+			nResult = pGoIOSensor->m_pInterface->SendCmdAndGetResponse(SKIP_CMD_ID_GET_SENSOR_ID, NULL, 0, 
+				&getSensorIdResponsePayload, &nBytesRead);
+			if (0 == nResult)
+			{
+				//Parse out sensor id.
+				int nSensorId;
+				GUtils::OSConvertBytesToInt(getSensorIdResponsePayload.lsbyteLswordSensorId, 
+					getSensorIdResponsePayload.msbyteLswordSensorId, getSensorIdResponsePayload.lsbyteMswordSensorId, 
+					getSensorIdResponsePayload.msbyteMswordSensorId, &nSensorId);
+
+				if (nSensorId < 0)
+					nSensorId = 0;
+				else
+				if (nSensorId > 255)
+					nSensorId = 0;
+
+				if (nSensorId < kSensorIdNumber_FirstSmartSensor)
+					nResult = -1;
+			}
+		}
+		else if (USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID == pGoIOSensor->m_pInterface->GetProductID())
+			nResult = 0;
+		else if (MINI_GC_DEFAULT_PRODUCT_ID == pGoIOSensor->m_pInterface->GetProductID())
+			nResult = 0;
+		else
+			nResult = -1;
+
+		if (0 == nResult)
+		{
+			//Update checksum.
+			pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->Checksum = 
+				GMBLSensor::CalculateDDSDataChecksum(*pGoIOSensor->m_pMBLSensor->GetDDSRecPtr());
+
+			//Marshall the SensorDDSRecord data so that it is in little-endian format.
+			GSensorDDSRec littleEndianRec;
+			GMBLSensor::MarshallDDSRec(&littleEndianRec, *pGoIOSensor->m_pMBLSensor->GetDDSRecPtr());
+
+			//Write the data to the sensor!
+			nResult = pGoIOSensor->m_pInterface->WriteSensorDDSMemory((unsigned char *) &littleEndianRec, 0, 
+				sizeof(littleEndianRec), timeoutMs);
+		}
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_DDSMem_ReadRecord()
+	
+	Purpose:	Read the SensorDDSRecord from a smart sensor's DDS memory hardware. 
+
+				After the record is read from the sensor, it is unmarshalled from little endian format into processor
+				specific format.
+	
+	Return:		0 if successful, 
+				else if data validation fails then -2,
+				else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_ReadRecord(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	gtype_int32 strictDDSValidationFlag,//[in] insist on exactly valid checksum if 1, else use a more lax validation test.
+	gtype_int32 timeoutMs)	//[in] # of milliseconds to wait for a reply before giving up. SKIP_TIMEOUT_MS_READ_DDSMEMBLOCK is recommended.
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		GSensorDDSRec littleEndianRec;
+
+		if (SKIP_DEFAULT_PRODUCT_ID == pGoIOSensor->m_pInterface->GetProductID())
+		{
+			//Verify that we are dealing with a smart sensor.
+			//Do not try to read the SensorDDSRecord unless this is a smart sensor because old versions of Go! Link(ver. 1.5426)
+			//will hang if we try to read the SensorDDSRecord when no smart sensor is connected.
+			GSkipGetSensorIdCmdResponsePayload getSensorIdResponsePayload;
+			int nBytesRead = sizeof(GSkipGetSensorIdCmdResponsePayload);
+			nResult = pGoIOSensor->m_pInterface->SendCmdAndGetResponse(SKIP_CMD_ID_GET_SENSOR_ID, NULL, 0, 
+				&getSensorIdResponsePayload, &nBytesRead);
+			if (0 == nResult)
+			{
+				//Parse out sensor id.
+				int nSensorId;
+				GUtils::OSConvertBytesToInt(getSensorIdResponsePayload.lsbyteLswordSensorId, 
+					getSensorIdResponsePayload.msbyteLswordSensorId, getSensorIdResponsePayload.lsbyteMswordSensorId, 
+					getSensorIdResponsePayload.msbyteMswordSensorId, &nSensorId);
+
+				if (nSensorId < 0)
+					nSensorId = 0;
+				else
+				if (nSensorId > 255)
+					nSensorId = 0;
+
+				if (nSensorId < kSensorIdNumber_FirstSmartSensor)
+					nResult = -1;
+			}
+		}
+		else
+			nResult = 0;	//Let the following code catch errors.
+
+		if (0 == nResult)
+		{
+			nResult = pGoIOSensor->m_pInterface->ReadSensorDDSMemory((unsigned char *) &littleEndianRec, 0, 
+				sizeof(littleEndianRec), timeoutMs);
+		}
+
+		if (0 == nResult)
+		{
+			if (!GMBLSensor::VerifyDDSChecksum(littleEndianRec, (strictDDSValidationFlag != 0)))
+				nResult = -2;
+		}
+
+		if (0 == nResult)
+			pGoIOSensor->m_pMBLSensor->SetDDSRec(littleEndianRec, true);
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_DDSMem_SetRecord()
+	
+	Purpose:	Update the SensorDDSRecord. 
+				This routine does not send data to the sensor's DDS memory hardware - use GoIO_Sensor_DDSMem_WriteRecord for that.
+
+	Return:		0 if hSensor is valid, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetRecord(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	const GSensorDDSRec *pRec)	//[in] ptr to data to copy into the SensorDDSRecord.
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+
+
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->SetDDSRec(*pRec, false);
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_DDSMem_GetRecord()
+	
+	Purpose:	Get a copy of the SensorDDSRecord. 
+				This routine does not read data from the sensor's DDS memory hardware - use GoIO_Sensor_DDSMem_ReadRecord for that.
+
+	Return:		0 if hSensor is valid, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetRecord(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	GSensorDDSRec *pRec)		//[out] ptr to dest buf to copy the SensorDDSRecord into.
+{
+#ifdef TARGET_OS_LINUX
+	if (DaemonClient_IsConnected())
+		return DaemonClient_DDSMem_GetRecord(hSensor, pRec);
+#endif
+
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRec(pRec);
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_DDSMem_CalculateChecksum()
+	
+	Return:		0 if hSensor is valid, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_CalculateChecksum(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	unsigned char *pChecksum)	//[out] ptr to checksum calculated by XOR'ing the first 127 bytes of the SensorDDSRecord.
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pChecksum = GMBLSensor::CalculateDDSDataChecksum(*pGoIOSensor->m_pMBLSensor->GetDDSRecPtr());
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_DDSMem_ClearRecord()
+	
+	Purpose:	Clear the DDS record for the specified sensor. This puts default values in the record's fields.
+				The sensor name fields are set to blank. The sensor id is set to 0, and a single linear calibration is
+				set up with a gain of 1.0 and an offest of 0. The calibration units field is set to "volts".
+				The OperationType is set to imply a probe type of kProbeTypeAnalog5V.
+
+	Return:		0 if hSensor is valid, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_ClearRecord(
+	GOIO_SENSOR_HANDLE hSensor)	//[in] handle to open sensor.
+{
+	gtype_int32 nResult = -1;
+	if (OpenSensorVector_FindAndLockSensor(hSensor))
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		GMBLSensor *pSensor = pGoIOSensor->m_pMBLSensor;
+		GSensorDDSRec DDSRec;
+
+		GMBLSensor *pTempSensor = new GMBLSensor();
+		pTempSensor->GetDDSRec(&DDSRec);
+		pSensor->SetDDSRec(DDSRec, false);
+		delete pTempSensor;
+
+		nResult = 0;
+
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+
+/***************************************************************************************************************************/
+/***************************************************************************************************************************/
+/***************************************************************************************************************************
+Languages that can handle GSensorDDSRec can access the DDS fields using GoIO_Sensor_DDSMem_SetRecord and GetRecord.
+Languages such as Basic are unlikely to be able to handle a complex record like GSensorDDSRec, especially because of
+byte alignment issues. The individual field level API's defined below provide an alternate way to access the SensorDDSRecord.
+****************************************************************************************************************************/
+/***************************************************************************************************************************/
+/***************************************************************************************************************************/
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetMemMapVersion(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char MemMapVersion)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->MemMapVersion = MemMapVersion;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetMemMapVersion(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char *pMemMapVersion)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pMemMapVersion = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->MemMapVersion;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_DDSMem_SetSensorNumber()
+	
+	Purpose:	Normally SensorDDSRecord.SensorNumber is automatically set inside GoIO_Sensor_Open().
+				However, if the current sensor is a legacy version, then SensorDDSRecord.SensorNumber = 0, so
+				you might want to use GoIO_Sensor_DDSMem_SetSensorNumber() to change it.
+
+				
+	SIDE EFFECTS:	
+				If the new SensorDDSRecord.SensorNumber is set to an (id < kSensorIdNumber_FirstSmartSensor) and (id > 0),
+				then the rest of the fields in the DDS record are  populated with default values appropriate for the
+				new sensor id.
+
+				If the GoIO_Sensor_DDSMem_SetSensorNumber() causes the probeType to change, then you should
+				send a SKIP_CMD_ID_SET_ANALOG_INPUT_CHANNEL command to the sensor. See GoIO_Sensor_GetProbeType().
+
+	Return:		0 if hSensor is valid and sensor is connected to a Go! Link, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetSensorNumber(
+	GOIO_SENSOR_HANDLE hSensor,	//[in] handle to open sensor.
+	unsigned char SensorNumber)	//[in]
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		GSkipDevice *pSkip = dynamic_cast<GSkipDevice *>(pGoIOSensor->m_pInterface);
+		if (!pSkip)
+			nResult = -1;
+		else
+		{
+			pGoIOSensor->m_pMBLSensor->SetID(SensorNumber);//This may cause GetDDSRecPtr()->OperationType to change also!
+		}
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+/***************************************************************************************************************************
+	Function Name: GoIO_Sensor_DDSMem_GetSensorNumber()
+	
+	Purpose:	Retrieve SensorDDSRecord.SensorNumber. 
+	
+				If sendQueryToHardwareflag != 0, then send a SKIP_CMD_ID_GET_SENSOR_ID to the sensor hardware
+				 - sendQueryToHardwareflag is ignored for Go! Temp.
+
+				If the sensor hardware reports a new SensorNumber, then a user has probably changed what sensor is
+				plugged into a Go! Link. The simplest course of action in this case is to call
+				GoIO_Sensor_GetOpenDeviceName() to get the device id, call GoIO_Sensor_Close(), and then
+				call GoIO_Sensor_Open() with the values obtained from GoIO_Sensor_GetOpenDeviceName() to reopen the
+				device. This will cause the GoIO_Sensor object to be properly configured for the new sensor.
+
+	Return:		0 if successful, else -1.
+
+****************************************************************************************************************************/
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetSensorNumber(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor. 
+	unsigned char *pSensorNumber,	//[out] ptr to SensorNumber.
+	gtype_int32 sendQueryToHardwareflag,//[in] If sendQueryToHardwareflag != 0, then send a SKIP_CMD_ID_GET_SENSOR_ID to the sensor hardware. 
+	gtype_int32 timeoutMs)//[in] # of milliseconds to wait for a reply before giving up. SKIP_TIMEOUT_MS_DEFAULT is recommended.
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		if ((0 == sendQueryToHardwareflag) 
+			|| (USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID == pGoIOSensor->m_pInterface->GetPortRefPtr()->GetUSBProductID())
+			|| (CYCLOPS_DEFAULT_PRODUCT_ID == pGoIOSensor->m_pInterface->GetPortRefPtr()->GetUSBProductID()))
+			*pSensorNumber = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorNumber;
+		else
+		{
+			//Send command to the sensor.
+			GSkipGetSensorIdCmdResponsePayload getSensorIdResponsePayload;
+			int nBytesRead = sizeof(GSkipGetSensorIdCmdResponsePayload);
+			int nResult = pGoIOSensor->m_pInterface->SendCmdAndGetResponse(SKIP_CMD_ID_GET_SENSOR_ID, NULL, 0, 
+				&getSensorIdResponsePayload, &nBytesRead, timeoutMs);
+			if (0 == nResult)
+			{
+				//Parse out sensor id.
+				int nSensorId;
+				GUtils::OSConvertBytesToInt(getSensorIdResponsePayload.lsbyteLswordSensorId, 
+					getSensorIdResponsePayload.msbyteLswordSensorId, getSensorIdResponsePayload.lsbyteMswordSensorId, 
+					getSensorIdResponsePayload.msbyteMswordSensorId, &nSensorId);
+
+				if (nSensorId < 0)
+					nSensorId = 0;
+				else
+				if (nSensorId > 255)
+					nSensorId = 0;
+				
+				pGoIOSensor->m_pMBLSensor->SetID(nSensorId);
+				*pSensorNumber = (unsigned char) nSensorId;
+			}
+		}
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetSerialNumber(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char leastSigByte_SerialNumber,
+	unsigned char midSigByte_SerialNumber,
+	unsigned char mostSigByte_SerialNumber)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorSerialNumber[0] = leastSigByte_SerialNumber;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorSerialNumber[1] = midSigByte_SerialNumber;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorSerialNumber[2] = mostSigByte_SerialNumber;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetSerialNumber(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char *pLeastSigByte_SerialNumber,
+	unsigned char *pMidSigByte_SerialNumber,
+	unsigned char *pMostSigByte_SerialNumber)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pLeastSigByte_SerialNumber = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorSerialNumber[0];
+		*pMidSigByte_SerialNumber = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorSerialNumber[1];
+		*pMostSigByte_SerialNumber = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorSerialNumber[2];
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetLotCode(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char YY_BCD,
+	unsigned char WW_BCD)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorLotCode[0] = YY_BCD;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorLotCode[1] = WW_BCD;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetLotCode(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char *pYY_BCD,
+	unsigned char *pWW_BCD)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pYY_BCD = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorLotCode[0];
+		*pWW_BCD = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorLotCode[1];
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetManufacturerID(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char ManufacturerID)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->ManufacturerID = ManufacturerID;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetManufacturerID(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char *pManufacturerID)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pManufacturerID = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->ManufacturerID;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetLongName(
+	GOIO_SENSOR_HANDLE hSensor,
+	const char *pLongName)//[in] ptr to NULL terminated string.
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		strncpy(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorLongName, pLongName, 
+			sizeof(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorLongName));
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetLongName(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor. 
+	char *pLongName,				//[out] ptr to buffer for NULL terminated output string.
+	gtype_uint16 maxNumBytesToCopy)	//[in] size of pLongName buffer.
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		char tmpstring[30];
+		GSTD_ASSERT(sizeof(tmpstring) > sizeof(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorLongName));
+		memset(tmpstring, 0, sizeof(tmpstring));
+		memcpy(tmpstring, pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorLongName, 
+			sizeof(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorLongName));
+		strncpy(pLongName, tmpstring, maxNumBytesToCopy);
+		pLongName[maxNumBytesToCopy - 1] = 0;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetShortName(
+	GOIO_SENSOR_HANDLE hSensor,
+	const char *pShortName)//[in] ptr to NULL terminated string.
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		strncpy(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorShortName, pShortName, 
+			sizeof(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorShortName));
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetShortName(
+	GOIO_SENSOR_HANDLE hSensor,			//[in] handle to open sensor. 
+	char *pShortName,					//[out] ptr to buffer for NULL terminated output string. 
+	gtype_uint16 maxNumBytesToCopy)		//[in] size of pShortName buffer.
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		char tmpstring[30];
+		GSTD_ASSERT(sizeof(tmpstring) > sizeof(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorShortName));
+		memset(tmpstring, 0, sizeof(tmpstring));
+		memcpy(tmpstring, pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorShortName, 
+			sizeof(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SensorShortName));
+		strncpy(pShortName, tmpstring, maxNumBytesToCopy);
+		pShortName[maxNumBytesToCopy - 1] = 0;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetUncertainty(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char Uncertainty)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->Uncertainty = Uncertainty;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetUncertainty(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char *pUncertainty)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pUncertainty = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->Uncertainty;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetSignificantFigures(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char SignificantFigures)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SignificantFigures = SignificantFigures;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetSignificantFigures(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char *pSignificantFigures)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pSignificantFigures = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->SignificantFigures;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetCurrentRequirement(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char CurrentRequirement)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->CurrentRequirement = CurrentRequirement;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetCurrentRequirement(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char *pCurrentRequirement)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pCurrentRequirement = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->CurrentRequirement;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetAveraging(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char Averaging)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->Averaging = Averaging;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetAveraging(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char *pAveraging)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pAveraging = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->Averaging;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetMinSamplePeriod(
+	GOIO_SENSOR_HANDLE hSensor,
+	gtype_real32 MinSamplePeriod)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->MinSamplePeriod = MinSamplePeriod;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetMinSamplePeriod(
+	GOIO_SENSOR_HANDLE hSensor,
+	gtype_real32 *pMinSamplePeriod)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pMinSamplePeriod = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->MinSamplePeriod;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetTypSamplePeriod(
+	GOIO_SENSOR_HANDLE hSensor,
+	gtype_real32 TypSamplePeriod)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->TypSamplePeriod = TypSamplePeriod;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetTypSamplePeriod(
+	GOIO_SENSOR_HANDLE hSensor,
+	gtype_real32 *pTypSamplePeriod)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pTypSamplePeriod = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->TypSamplePeriod;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetTypNumberofSamples(
+	GOIO_SENSOR_HANDLE hSensor,
+	gtype_uint16 TypNumberofSamples)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->TypNumberofSamples = TypNumberofSamples;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetTypNumberofSamples(
+	GOIO_SENSOR_HANDLE hSensor,
+	gtype_uint16 *pTypNumberofSamples)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pTypNumberofSamples = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->TypNumberofSamples;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetWarmUpTime(
+	GOIO_SENSOR_HANDLE hSensor,
+	gtype_uint16 WarmUpTime)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->WarmUpTime = WarmUpTime;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetWarmUpTime(
+	GOIO_SENSOR_HANDLE hSensor,
+	gtype_uint16 *pWarmUpTime)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pWarmUpTime = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->WarmUpTime;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetExperimentType(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char ExperimentType)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->ExperimentType = ExperimentType;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetExperimentType(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char *pExperimentType)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pExperimentType = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->ExperimentType;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetOperationType(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char OperationType)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->OperationType = OperationType;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetOperationType(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char *pOperationType)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pOperationType = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->OperationType;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetCalibrationEquation(
+	GOIO_SENSOR_HANDLE hSensor,
+	char CalibrationEquation)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->CalibrationEquation = CalibrationEquation;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetCalibrationEquation(
+	GOIO_SENSOR_HANDLE hSensor,
+	char *pCalibrationEquation)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pCalibrationEquation = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->CalibrationEquation;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetYminValue(
+	GOIO_SENSOR_HANDLE hSensor,
+	gtype_real32 YminValue)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->YminValue = YminValue;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetYminValue(
+	GOIO_SENSOR_HANDLE hSensor,
+	gtype_real32 *pYminValue)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pYminValue = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->YminValue;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetYmaxValue(
+	GOIO_SENSOR_HANDLE hSensor,
+	gtype_real32 YmaxValue)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->YmaxValue = YmaxValue;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetYmaxValue(
+	GOIO_SENSOR_HANDLE hSensor,
+	gtype_real32 *pYmaxValue)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pYmaxValue = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->YmaxValue;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetYscale(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char Yscale)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->Yscale = Yscale;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetYscale(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char *pYscale)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pYscale = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->Yscale;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetHighestValidCalPageIndex(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char HighestValidCalPageIndex)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->HighestValidCalPageIndex = HighestValidCalPageIndex;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetHighestValidCalPageIndex(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char *pHighestValidCalPageIndex)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pHighestValidCalPageIndex = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->HighestValidCalPageIndex;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetActiveCalPage(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char ActiveCalPage)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->ActiveCalPage = ActiveCalPage;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetActiveCalPage(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char *pActiveCalPage)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pActiveCalPage = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->ActiveCalPage;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetCalPage(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char CalPageIndex,
+	gtype_real32 CalibrationCoefficientA,
+	gtype_real32 CalibrationCoefficientB,
+	gtype_real32 CalibrationCoefficientC,
+	const char *pUnits)//[in] ptr to NULL terminated string.
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		if (CalPageIndex < 3)
+		{
+			GCalibrationPage *pCalPage = &(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->CalibrationPage[CalPageIndex]);
+			pCalPage->CalibrationCoefficientA = CalibrationCoefficientA;
+			pCalPage->CalibrationCoefficientB = CalibrationCoefficientB;
+			pCalPage->CalibrationCoefficientC = CalibrationCoefficientC;
+			strncpy(pCalPage->Units, pUnits, sizeof(pCalPage->Units));
+		}
+		else
+			nResult = -1;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetCalPage(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char CalPageIndex,
+	gtype_real32 *pCalibrationCoefficientA,
+	gtype_real32 *pCalibrationCoefficientB,
+	gtype_real32 *pCalibrationCoefficientC,
+	char *pUnits,						//[out] ptr to buffer for NULL terminated output string. 
+	gtype_uint16 maxNumBytesToCopy)	//[in] size of pUnits buffer.
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		if (CalPageIndex < 3)
+		{
+			GCalibrationPage *pCalPage = &(pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->CalibrationPage[CalPageIndex]);
+			char tmpstring[30];
+			GSTD_ASSERT(sizeof(tmpstring) > sizeof(pCalPage->Units));
+			memset(tmpstring, 0, sizeof(tmpstring));
+			memcpy(tmpstring, pCalPage->Units, sizeof(pCalPage->Units));
+			strncpy(pUnits, tmpstring, maxNumBytesToCopy);
+			pUnits[maxNumBytesToCopy - 1] = 0;
+
+			*pCalibrationCoefficientA = pCalPage->CalibrationCoefficientA;
+			*pCalibrationCoefficientB = pCalPage->CalibrationCoefficientB;
+			*pCalibrationCoefficientC = pCalPage->CalibrationCoefficientC;
+		}
+		else
+			nResult = -1;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_SetChecksum(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char Checksum)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->Checksum = Checksum;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Sensor_DDSMem_GetChecksum(
+	GOIO_SENSOR_HANDLE hSensor,
+	unsigned char *pChecksum)
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = -1;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		*pChecksum = pGoIOSensor->m_pMBLSensor->GetDDSRecPtr()->Checksum;
+		UnlockSensor(hSensor);
+	}
+
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL void GoIO_Diags_SetIOTraceEnableFlag(
+	gtype_bool flag)
+{
+	GoIOTraceEnableFlag = flag;
+}
+
+GOIO_DLL_INTERFACE_DECL void GoIO_Diags_GetIOTraceEnableFlag(
+	gtype_bool *pFlag)			//[out] ptr to loc to store IO trace enable flag. Note that IO tracing is enabled by default.
+{
+	*pFlag = GoIOTraceEnableFlag;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_GetNumInputTraceBytesAvailable(
+	GOIO_SENSOR_HANDLE hSensor)//[in] handle to open device.
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = 0;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		if (pGoIOSensor->m_pInterface->GetDiagnosticInputBufferPtr())
+		{
+			nResult = pGoIOSensor->m_pInterface->GetDiagnosticInputBufferPtr()->NumBytesAvailable();
+		}
+
+		UnlockSensor(hSensor);
+	}
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_ReadInputTraceBytes(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
+	unsigned char *pInputTraceBuf,	//[out] ptr to loc to store trace info.
+	gtype_int32 maxCount)			//[in] maximum number of bytes to copy into pInputTraceBuf.
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = 0;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		if (pGoIOSensor->m_pInterface->GetDiagnosticInputBufferPtr())
+		{
+			nResult = pGoIOSensor->m_pInterface->GetDiagnosticInputBufferPtr()->RetrieveBytes(pInputTraceBuf, maxCount);
+		}
+
+		UnlockSensor(hSensor);
+	}
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_GetNumOutputTraceBytesAvailable(
+	GOIO_SENSOR_HANDLE hSensor)//[in] handle to open device.
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = 0;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		if (pGoIOSensor->m_pInterface->GetDiagnosticOutputBufferPtr())
+		{
+			nResult = pGoIOSensor->m_pInterface->GetDiagnosticOutputBufferPtr()->NumBytesAvailable();
+		}
+
+		UnlockSensor(hSensor);
+	}
+	return nResult;
+}
+
+GOIO_DLL_INTERFACE_DECL gtype_int32 GoIO_Diags_ReadOutputTraceBytes(
+	GOIO_SENSOR_HANDLE hSensor,		//[in] handle to open sensor.
+	unsigned char *pOutputTraceBuf,	//[out] ptr to loc to store trace info.
+	gtype_int32 maxCount)			//[in] maximum number of bytes to copy into pOutputTraceBuf.
+{
+	gtype_int32 nResult = 0;
+	if (!OpenSensorVector_FindAndLockSensor(hSensor))
+		nResult = 0;
+	else
+	{
+		CGoIOSensor *pGoIOSensor = (CGoIOSensor *) hSensor;
+		if (pGoIOSensor->m_pInterface->GetDiagnosticOutputBufferPtr())
+		{
+			nResult = pGoIOSensor->m_pInterface->GetDiagnosticOutputBufferPtr()->RetrieveBytes(pOutputTraceBuf, maxCount);
+		}
+
+		UnlockSensor(hSensor);
+	}
+	return nResult;
+}
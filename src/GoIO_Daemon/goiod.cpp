@@ -0,0 +1,765 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// goiod.cpp
+//
+// goiod owns the Go! devices on a computer, so that several processes can use the same sensors at once. Apps use it
+// through the ordinary GoIO lib, after GoIO_SetDaemonSocketPath() or with the GOIO_DAEMON environment variable set.
+// The protocol is described in GoIO_DLL/GoIO_DLL_daemon.h.
+//
+// Each client connection is served by its own thread. A device is opened when its first client opens it, published
+// to shared memory(see GoIO_Sensor_StartPublishing()) so that the clients can read its measurements directly, and
+// closed when its last client closes it or disconnects. Each open device also has a thread of its own, which makes
+// all the GoIO_Sensor_* calls for it, since the lib only lets the thread that opened a device use it. The device
+// thread handles one request at a time, so a long command from one client queues the requests of the other clients
+// of that device behind it, rather than failing them with a busy device.
+//
+// goiod runs in the foreground until it gets SIGINT or SIGTERM. It is built on the GoIO lib, so GOIO_SIMULATOR and
+// the other GoIO_Init() environment variables work as usual.
+//
+// Anyone who can connect to the socket can drive every device, so goiod only listens in a directory that nobody else
+// can write to(creating GOIO_DAEMON_DEFAULT_SOCKET_DIR if that is where the socket goes), makes the socket readable
+// and writable by its own user only(and by the group given with -g), and checks each client's credentials as well.
+// It replaces a socket left behind by a goiod that is gone, but refuses to start if a live one answers on it.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <pwd.h>
+#include <grp.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <vector>
+#include <string>
+#include <map>
+#include <algorithm>
+
+#include "GoIO_DLL_interface.h"
+#include "GoIO_DLL_daemon.h"
+
+#define GOIOD_MEASUREMENT_BATCH_SIZE 1000
+#define GOIOD_MEASUREMENT_BATCH_LATENCY_MS 1000
+
+struct GoIODaemonJob
+{
+	gtype_uint32 op;//EGoIODaemonOp
+	const GoIODaemonOpenParams *pOpenParams;
+	const char *pDeviceName;
+	const GoIODaemonCmdParams *pCmdParams;
+	void *pCmdParamBytes;
+	const GoIODaemonPeriodParams *pPeriodParams;
+	gtype_int32 nResult;
+	std::vector<char> response;
+	bool bDone;
+};
+
+enum EGoIODaemonDeviceState
+{
+	kGoIODaemonDeviceState_Opening = 0,
+	kGoIODaemonDeviceState_Open,
+	kGoIODaemonDeviceState_Closing
+};
+
+struct GoIODaemonDevice
+{
+	GOIO_SENSOR_HANDLE hSensor;//only used by thread.
+	std::string sName;
+	int nRefCount;//# of opens by clients, protected by devicesMutex.
+	EGoIODaemonDeviceState state;//protected by devicesMutex.
+	GoIODaemonOpenResponse info;
+	pthread_t thread;
+	pthread_mutex_t queueMutex;//held by a client thread from posting a job until it is done, so jobs run one at a time.
+	pthread_mutex_t jobMutex;//protects pJob.
+	pthread_cond_t jobCond;//signalled when a job is posted and when it is done.
+	GoIODaemonJob *pJob;
+};
+
+struct GoIODaemonClient
+{
+	int fd;
+	pthread_t thread;
+	volatile bool bDone;
+	std::multimap<gtype_uint64, GoIODaemonDevice *> openDevices;//one entry per open, only used by the client's thread.
+};
+
+static int listenSocket = -1;
+static volatile sig_atomic_t bQuit = 0;
+static gtype_int32 numSlots = 0;
+static bool bSocketGroupSet = false;
+static gid_t socketGroup = 0;//with bSocketGroupSet, members of this group may connect as well.
+
+static pthread_mutex_t devicesMutex = PTHREAD_MUTEX_INITIALIZER;//protects devices, nextSensorId and clients.
+static pthread_cond_t devicesCond = PTHREAD_COND_INITIALIZER;//signalled when a device stops opening or closing.
+static pthread_mutex_t deviceListMutex = PTHREAD_MUTEX_INITIALIZER;//serializes updates of the lib's device list.
+static std::map<gtype_uint64, GoIODaemonDevice *> devices;
+static gtype_uint64 nextSensorId = 1;
+static std::vector<GoIODaemonClient *> clients;
+
+static void OnSignal(int)
+{
+	bQuit = 1;
+	//Wake up accept().
+	if (listenSocket >= 0)
+		shutdown(listenSocket, SHUT_RDWR);
+}
+
+static void DiscardMeasurements(GOIO_SENSOR_HANDLE, void *, const gtype_int32 *, gtype_int32)
+{
+	//The clients read the published measurements, so there is no point queueing them here too.
+}
+
+static bool SendAll(int fd, const void *pBytes, size_t nNumBytes)
+{
+	const char *pNext = (const char *) pBytes;
+	while (nNumBytes > 0)
+	{
+		ssize_t nSent = send(fd, pNext, nNumBytes, MSG_NOSIGNAL);
+		if (nSent < 0)
+		{
+			if (EINTR == errno)
+				continue;
+			return false;
+		}
+		pNext += nSent;
+		nNumBytes -= nSent;
+	}
+	return true;
+}
+
+static bool RecvAll(int fd, void *pBytes, size_t nNumBytes)
+{
+	char *pNext = (char *) pBytes;
+	while (nNumBytes > 0)
+	{
+		ssize_t nReceived = recv(fd, pNext, nNumBytes, 0);
+		if (nReceived <= 0)
+		{
+			if ((nReceived < 0) && (EINTR == errno))
+				continue;
+			return false;
+		}
+		pNext += nReceived;
+		nNumBytes -= nReceived;
+	}
+	return true;
+}
+
+static bool SendResponse(int fd, gtype_int32 result, const void *pPayload, gtype_uint32 nPayloadBytes)
+{
+	GoIODaemonResponseHeader response;
+	response.result = result;
+	response.payloadBytes = nPayloadBytes;
+	return SendAll(fd, &response, sizeof(response)) && ((0 == nPayloadBytes) || SendAll(fd, pPayload, nPayloadBytes));
+}
+
+//Runs on the device thread.
+static void RunJob(GoIODaemonDevice *pDevice, GoIODaemonJob *pJob)
+{
+	pJob->nResult = -1;
+	switch (pJob->op)
+	{
+		case kGoIODaemonOp_SensorOpen:
+			pDevice->hSensor = GoIO_Sensor_Open(pJob->pDeviceName, pJob->pOpenParams->vendorId, 
+				pJob->pOpenParams->productId, pJob->pOpenParams->strictDDSValidationFlag);
+			if (pDevice->hSensor)
+			{
+				if ((0 == GoIO_Sensor_StartPublishing(pDevice->hSensor, numSlots)) &&
+					(0 == GoIO_Sensor_SetMeasurementCallback(pDevice->hSensor, DiscardMeasurements, NULL, 
+						GOIOD_MEASUREMENT_BATCH_SIZE, GOIOD_MEASUREMENT_BATCH_LATENCY_MS)))
+				{
+					pDevice->info.measurementTickInSeconds = GoIO_Sensor_GetMeasurementTickInSeconds(pDevice->hSensor);
+					pDevice->info.minimumMeasurementPeriod = GoIO_Sensor_GetMinimumMeasurementPeriod(pDevice->hSensor);
+					pDevice->info.maximumMeasurementPeriod = GoIO_Sensor_GetMaximumMeasurementPeriod(pDevice->hSensor);
+					pJob->nResult = 0;
+					printf("goiod: opened %s\n", pJob->pDeviceName);
+				}
+				else
+				{
+					fprintf(stderr, "goiod: unable to publish %s\n", pJob->pDeviceName);
+					GoIO_Sensor_Close(pDevice->hSensor);
+				}
+			}
+			break;
+
+		case kGoIODaemonOp_SensorClose:
+			pJob->nResult = GoIO_Sensor_Close(pDevice->hSensor);
+			printf("goiod: closed %s\n", pDevice->sName.c_str());
+			break;
+
+		case kGoIODaemonOp_SendCmdAndGetResponse:
+		{
+			const GoIODaemonCmdParams *pParams = pJob->pCmdParams;
+			gtype_int32 nRespBytes = (pParams->respBufBytes > 0) ? pParams->respBufBytes : 0;
+			std::vector<char> respBuf(nRespBytes + 1);
+			pJob->nResult = GoIO_Sensor_SendCmdAndGetResponse(pDevice->hSensor, (unsigned char) pParams->cmd, 
+				pJob->pCmdParamBytes, pParams->paramBytes, (pParams->respBufBytes >= 0) ? &respBuf[0] : NULL, 
+				(pParams->respBufBytes >= 0) ? &nRespBytes : NULL, pParams->timeoutMs);
+			if ((pParams->respBufBytes >= 0) && (nRespBytes > 0))
+				pJob->response.assign(respBuf.begin(), respBuf.begin() + nRespBytes);
+			break;
+		}
+
+		case kGoIODaemonOp_SetMeasurementPeriod:
+			pJob->nResult = GoIO_Sensor_SetMeasurementPeriod(pDevice->hSensor, pJob->pPeriodParams->period, 
+				pJob->pPeriodParams->timeoutMs);
+			break;
+
+		case kGoIODaemonOp_GetMeasurementPeriod:
+		{
+			gtype_real64 period = GoIO_Sensor_GetMeasurementPeriod(pDevice->hSensor, pJob->pPeriodParams->timeoutMs);
+			pJob->nResult = (period > 0.0) ? 0 : -1;
+			pJob->response.assign((const char *) &period, ((const char *) &period) + sizeof(period));
+			break;
+		}
+	}
+}
+
+static void *DeviceThread(void *pContext)
+{
+	GoIODaemonDevice *pDevice = (GoIODaemonDevice *) pContext;
+	bool bExit = false;
+	pthread_mutex_lock(&pDevice->jobMutex);
+	while (!bExit)
+	{
+		while (NULL == pDevice->pJob)
+			pthread_cond_wait(&pDevice->jobCond, &pDevice->jobMutex);
+
+		GoIODaemonJob *pJob = pDevice->pJob;
+		RunJob(pDevice, pJob);
+		bExit = (kGoIODaemonOp_SensorClose == pJob->op) || ((kGoIODaemonOp_SensorOpen == pJob->op) && (0 != pJob->nResult));
+		pDevice->pJob = NULL;
+		pJob->bDone = true;
+		pthread_cond_broadcast(&pDevice->jobCond);
+	}
+	pthread_mutex_unlock(&pDevice->jobMutex);
+
+	return NULL;
+}
+
+//Run pJob on the device thread, after the jobs that other clients posted first.
+static void CallDevice(GoIODaemonDevice *pDevice, GoIODaemonJob *pJob)
+{
+	pthread_mutex_lock(&pDevice->queueMutex);
+	pthread_mutex_lock(&pDevice->jobMutex);
+	pJob->bDone = false;
+	pDevice->pJob = pJob;
+	pthread_cond_broadcast(&pDevice->jobCond);
+	while (!pJob->bDone)
+		pthread_cond_wait(&pDevice->jobCond, &pDevice->jobMutex);
+	pthread_mutex_unlock(&pDevice->jobMutex);
+	pthread_mutex_unlock(&pDevice->queueMutex);
+}
+
+static void DestroyDevice(GoIODaemonDevice *pDevice)
+{
+	pthread_join(pDevice->thread, NULL);
+	pthread_cond_destroy(&pDevice->jobCond);
+	pthread_mutex_destroy(&pDevice->jobMutex);
+	pthread_mutex_destroy(&pDevice->queueMutex);
+	delete pDevice;
+}
+
+static GoIODaemonDevice *FindDevice(GoIODaemonClient *pClient, gtype_uint64 sensorId)
+{
+	//The client's reference keeps the device open, so devicesMutex is not needed.
+	std::multimap<gtype_uint64, GoIODaemonDevice *>::iterator iter = pClient->openDevices.find(sensorId);
+	return (iter != pClient->openDevices.end()) ? iter->second : NULL;
+}
+
+static gtype_int32 OpenDevice(GoIODaemonClient *pClient, const GoIODaemonOpenParams &params, const std::string &sName,
+	GoIODaemonOpenResponse *pInfo)
+{
+	//Opening takes a while, so the device is entered in devices in the opening state and devicesMutex is released 
+	//while the device thread opens it. Other clients asking for the same device wait for the open to finish, 
+	//requests for other devices are not held up.
+	gtype_int32 nResult = -1;
+	pthread_mutex_lock(&devicesMutex);
+	GoIODaemonDevice *pDevice = NULL;
+	bool bWait = true;
+	while (bWait)
+	{
+		pDevice = NULL;
+		std::map<gtype_uint64, GoIODaemonDevice *>::iterator iter;
+		for (iter = devices.begin(); (iter != devices.end()) && (NULL == pDevice); iter++)
+		{
+			if (iter->second->sName == sName)
+				pDevice = iter->second;
+		}
+		bWait = pDevice && (kGoIODaemonDeviceState_Open != pDevice->state);
+		if (bWait)
+			pthread_cond_wait(&devicesCond, &devicesMutex);
+	}
+	if (pDevice)
+	{
+		pDevice->nRefCount++;
+		nResult = 0;
+	}
+	else
+	{
+		pDevice = new GoIODaemonDevice();
+		pDevice->hSensor = NULL;
+		pDevice->sName = sName;
+		pDevice->nRefCount = 1;
+		pDevice->state = kGoIODaemonDeviceState_Opening;
+		memset(&pDevice->info, 0, sizeof(pDevice->info));
+		pDevice->info.sensorId = nextSensorId++;
+		pthread_mutex_init(&pDevice->queueMutex, NULL);
+		pthread_mutex_init(&pDevice->jobMutex, NULL);
+		pthread_cond_init(&pDevice->jobCond, NULL);
+		pDevice->pJob = NULL;
+		GoIODaemonJob job;
+		job.op = kGoIODaemonOp_SensorOpen;
+		job.pOpenParams = &params;
+		job.pDeviceName = sName.c_str();
+		if (0 == pthread_create(&pDevice->thread, NULL, DeviceThread, pDevice))
+		{
+			gtype_uint64 sensorId = pDevice->info.sensorId;
+			devices[sensorId] = pDevice;
+			pthread_mutex_unlock(&devicesMutex);
+			CallDevice(pDevice, &job);
+			nResult = job.nResult;
+			if (0 != nResult)
+				DestroyDevice(pDevice);
+			pthread_mutex_lock(&devicesMutex);
+			if (0 == nResult)
+				pDevice->state = kGoIODaemonDeviceState_Open;
+			else
+				devices.erase(sensorId);
+			pthread_cond_broadcast(&devicesCond);
+		}
+		else
+		{
+			pthread_cond_destroy(&pDevice->jobCond);
+			pthread_mutex_destroy(&pDevice->jobMutex);
+			pthread_mutex_destroy(&pDevice->queueMutex);
+			delete pDevice;
+		}
+	}
+	if (0 == nResult)
+	{
+		pClient->openDevices.insert(std::make_pair(pDevice->info.sensorId, pDevice));
+		(*pInfo) = pDevice->info;
+	}
+	pthread_mutex_unlock(&devicesMutex);
+
+	return nResult;
+}
+
+static gtype_int32 CloseDevice(GoIODaemonClient *pClient, gtype_uint64 sensorId)
+{
+	std::multimap<gtype_uint64, GoIODaemonDevice *>::iterator iter = pClient->openDevices.find(sensorId);
+	if (iter == pClient->openDevices.end())
+		return -1;
+	GoIODaemonDevice *pDevice = iter->second;
+	pClient->openDevices.erase(iter);
+
+	//The device stays in devices in the closing state until it is really closed, so a client that reopens it 
+	//meanwhile waits instead of racing the close with a second open of the same USB device.
+	pthread_mutex_lock(&devicesMutex);
+	bool bLastClient = (0 == --pDevice->nRefCount);
+	if (bLastClient)
+		pDevice->state = kGoIODaemonDeviceState_Closing;
+	pthread_mutex_unlock(&devicesMutex);
+
+	if (bLastClient)
+	{
+		//No other client has it open, so this is the last job for the device thread.
+		GoIODaemonJob job;
+		job.op = kGoIODaemonOp_SensorClose;
+		CallDevice(pDevice, &job);
+		DestroyDevice(pDevice);
+
+		pthread_mutex_lock(&devicesMutex);
+		devices.erase(sensorId);
+		pthread_cond_broadcast(&devicesCond);
+		pthread_mutex_unlock(&devicesMutex);
+	}
+
+	return 0;
+}
+
+//Handle one request. Returns false if the connection should be dropped.
+static bool HandleRequest(GoIODaemonClient *pClient, const GoIODaemonRequestHeader &request, std::vector<char> &payload)
+{
+	gtype_int32 nResult = -1;
+	std::vector<char> response;
+	GoIODaemonDevice *pDevice = NULL;
+	switch (request.op)
+	{
+		case kGoIODaemonOp_UpdateListOfAvailableDevices:
+			if (payload.size() == sizeof(GoIODaemonDeviceListParams))
+			{
+				GoIODaemonDeviceListParams params;
+				memcpy(&params, &payload[0], sizeof(params));
+				//The device list is per process state in the lib, so keep clients from updating it concurrently.
+				pthread_mutex_lock(&deviceListMutex);
+				nResult = GoIO_UpdateListOfAvailableDevices(params.vendorId, params.productId);
+				char name[GOIO_MAX_SIZE_DEVICE_NAME];
+				for (gtype_int32 N = 0; N < nResult; N++)
+				{
+					if (0 == GoIO_GetNthAvailableDeviceName(name, sizeof(name), params.vendorId, params.productId, N))
+						response.insert(response.end(), name, name + strlen(name) + 1);
+				}
+				pthread_mutex_unlock(&deviceListMutex);
+			}
+			break;
+
+		case kGoIODaemonOp_SensorOpen:
+			if ((payload.size() > sizeof(GoIODaemonOpenParams)) && (0 == payload.back()))
+			{
+				GoIODaemonOpenParams params;
+				memcpy(&params, &payload[0], sizeof(params));
+				GoIODaemonOpenResponse info;
+				nResult = OpenDevice(pClient, params, std::string(&payload[sizeof(params)]), &info);
+				if (0 == nResult)
+					response.assign((const char *) &info, ((const char *) &info) + sizeof(info));
+			}
+			break;
+
+		case kGoIODaemonOp_SensorClose:
+			nResult = CloseDevice(pClient, request.sensorId);
+			break;
+
+		case kGoIODaemonOp_SendCmdAndGetResponse:
+			if ((payload.size() >= sizeof(GoIODaemonCmdParams)) && (NULL != (pDevice = FindDevice(pClient, request.sensorId))))
+			{
+				GoIODaemonCmdParams params;
+				memcpy(&params, &payload[0], sizeof(params));
+				if ((params.paramBytes == (gtype_int32) (payload.size() - sizeof(params))) && 
+					(params.respBufBytes <= GOIO_DAEMON_MAX_PAYLOAD))
+				{
+					GoIODaemonJob job;
+					job.op = request.op;
+					job.pCmdParams = &params;
+					job.pCmdParamBytes = (params.paramBytes > 0) ? &payload[sizeof(params)] : NULL;
+					CallDevice(pDevice, &job);
+					nResult = job.nResult;
+					response.swap(job.response);
+				}
+			}
+			break;
+
+		case kGoIODaemonOp_SetMeasurementPeriod:
+		case kGoIODaemonOp_GetMeasurementPeriod:
+			if ((payload.size() == sizeof(GoIODaemonPeriodParams)) && (NULL != (pDevice = FindDevice(pClient, request.sensorId))))
+			{
+				GoIODaemonPeriodParams params;
+				memcpy(&params, &payload[0], sizeof(params));
+				GoIODaemonJob job;
+				job.op = request.op;
+				job.pPeriodParams = &params;
+				CallDevice(pDevice, &job);
+				nResult = job.nResult;
+				response.swap(job.response);
+			}
+			break;
+
+		default:
+			fprintf(stderr, "goiod: unknown request %u\n", request.op);
+			break;
+	}
+
+	return SendResponse(pClient->fd, nResult, response.empty() ? NULL : &response[0], response.size());
+}
+
+static void *ClientThread(void *pContext)
+{
+	GoIODaemonClient *pClient = (GoIODaemonClient *) pContext;
+	GoIODaemonRequestHeader request;
+	std::vector<char> payload;
+	while (RecvAll(pClient->fd, &request, sizeof(request)) && (request.payloadBytes <= GOIO_DAEMON_MAX_PAYLOAD))
+	{
+		payload.resize(request.payloadBytes);
+		if ((request.payloadBytes > 0) && !RecvAll(pClient->fd, &payload[0], request.payloadBytes))
+			break;
+		if (!HandleRequest(pClient, request, payload))
+			break;
+	}
+
+	//Release whatever the client left open.
+	while (!pClient->openDevices.empty())
+		CloseDevice(pClient, pClient->openDevices.begin()->first);
+	close(pClient->fd);
+	pClient->bDone = true;
+	return NULL;
+}
+
+static bool IsClientAllowed(int fd)
+{
+	struct ucred cred;
+	socklen_t nCredBytes = sizeof(cred);
+	if (0 != getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &nCredBytes))
+		return false;
+	if ((0 == cred.uid) || (geteuid() == cred.uid))
+		return true;
+
+	bool bAllowed = false;
+	if (bSocketGroupSet)
+	{
+		bAllowed = (socketGroup == cred.gid);
+		if (!bAllowed)
+		{
+			//The credentials only hold the primary group, so look up the others.
+			struct passwd pwd;
+			struct passwd *pPwd = NULL;
+			std::vector<char> pwdBuf(16384);
+			if ((0 == getpwuid_r(cred.uid, &pwd, &pwdBuf[0], pwdBuf.size(), &pPwd)) && pPwd)
+			{
+				int nNumGroups = 256;
+				std::vector<gid_t> groups(nNumGroups);
+				if (getgrouplist(pPwd->pw_name, pPwd->pw_gid, &groups[0], &nNumGroups) >= 0)
+					bAllowed = (groups.begin() + nNumGroups) != std::find(groups.begin(), groups.begin() + nNumGroups, socketGroup);
+			}
+		}
+	}
+	if (!bAllowed)
+		fprintf(stderr, "goiod: refused a client running as uid %d\n", (int) cred.uid);
+
+	return bAllowed;
+}
+
+//Check that nobody else can replace the socket, creating the directory first if bCreate is set.
+static bool PrepareSocketDir(const std::string &sDir, bool bCreate)
+{
+	if (bCreate)
+	{
+		if (0 == mkdir(sDir.c_str(), 0700))
+		{
+			if (bSocketGroupSet && ((0 != chown(sDir.c_str(), (uid_t) -1, socketGroup)) || (0 != chmod(sDir.c_str(), 0710))))
+			{
+				fprintf(stderr, "goiod: cannot give the group access to %s: %s\n", sDir.c_str(), strerror(errno));
+				return false;
+			}
+		}
+		else
+		if (EEXIST != errno)
+		{
+			fprintf(stderr, "goiod: cannot create %s: %s\n", sDir.c_str(), strerror(errno));
+			return false;
+		}
+	}
+
+	struct stat dirStat;
+	if ((0 != lstat(sDir.c_str(), &dirStat)) || !S_ISDIR(dirStat.st_mode) || 
+		((geteuid() != dirStat.st_uid) && (0 != dirStat.st_uid)) || (0 != (dirStat.st_mode & (S_IWGRP | S_IWOTH))))
+	{
+		fprintf(stderr, "goiod: %s must be a directory, owned by this user or root, that nobody else can write to\n", 
+			sDir.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+//Remove the socket of a goiod that has gone, so that this one can bind to the path. Fails if a goiod still answers.
+static bool RemoveStaleSocket(const struct sockaddr_un &addr)
+{
+	struct stat pathStat;
+	if (0 != lstat(addr.sun_path, &pathStat))
+		return (ENOENT == errno);
+	if (!S_ISSOCK(pathStat.st_mode))
+	{
+		fprintf(stderr, "goiod: %s is not a socket\n", addr.sun_path);
+		return false;
+	}
+
+	int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	int nResult = (fd >= 0) ? connect(fd, (const struct sockaddr *) &addr, sizeof(addr)) : -1;
+	int nError = errno;
+	if (fd >= 0)
+		close(fd);
+	if (0 == nResult)
+	{
+		fprintf(stderr, "goiod: another goiod is already listening on %s\n", addr.sun_path);
+		return false;
+	}
+	if ((ECONNREFUSED != nError) || ((0 != unlink(addr.sun_path)) && (ENOENT != errno)))
+	{
+		fprintf(stderr, "goiod: cannot replace %s: %s\n", addr.sun_path, strerror(nError));
+		return false;
+	}
+
+	return true;
+}
+
+//Join the threads of clients that have disconnected. Pass true to wait for all of them.
+static void ReapClients(bool bAll)
+{
+	pthread_mutex_lock(&devicesMutex);
+	std::vector<GoIODaemonClient *> doneClients;
+	for (size_t i = 0; i < clients.size(); )
+	{
+		if (bAll || clients[i]->bDone)
+		{
+			if (bAll)
+				shutdown(clients[i]->fd, SHUT_RDWR);
+			doneClients.push_back(clients[i]);
+			clients.erase(clients.begin() + i);
+		}
+		else
+			i++;
+	}
+	pthread_mutex_unlock(&devicesMutex);
+
+	for (size_t i = 0; i < doneClients.size(); i++)
+	{
+		pthread_join(doneClients[i]->thread, NULL);
+		delete doneClients[i];
+	}
+}
+
+static void PrintUsage(void)
+{
+	fprintf(stderr, "usage: goiod [-s socket_path] [-g group] [-n num_slots]\n"
+		"  -s  Unix domain socket to listen on(default $XDG_RUNTIME_DIR/" GOIO_DAEMON_SOCKET_NAME ", or\n"
+		"      " GOIO_DAEMON_DEFAULT_SOCKET_DIR "/" GOIO_DAEMON_SOCKET_NAME " without XDG_RUNTIME_DIR). Its directory must not be\n"
+		"      writable by other users.\n"
+		"  -g  let members of this group connect, as well as this user and root.\n"
+		"  -n  # of measurements in each device's shared memory ring(default %d).\n", GOIO_STREAM_DEFAULT_NUM_SLOTS);
+}
+
+int main(int argc, char* argv[])
+{
+	std::string sDefaultSocketPath = GoIODaemon_GetDefaultSocketPath();
+	const char *pSocketPath = sDefaultSocketPath.c_str();
+	struct group *pGroup;
+	int opt;
+
+	while (-1 != (opt = getopt(argc, argv, "s:g:n:h")))
+	{
+		switch (opt)
+		{
+			case 's': pSocketPath = optarg; break;
+			case 'g':
+				pGroup = getgrnam(optarg);
+				if (NULL == pGroup)
+				{
+					fprintf(stderr, "goiod: unknown group %s\n", optarg);
+					return 1;
+				}
+				socketGroup = pGroup->gr_gid;
+				bSocketGroupSet = true;
+				break;
+			case 'n': numSlots = atoi(optarg); break;
+			default:
+				PrintUsage();
+				return ('h' == opt) ? 0 : 1;
+		}
+	}
+	struct sockaddr_un addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	if ((numSlots < 0) || (strlen(pSocketPath) >= sizeof(addr.sun_path)))
+	{
+		PrintUsage();
+		return 1;
+	}
+	strcpy(addr.sun_path, pSocketPath);
+	std::string sSocketDir = pSocketPath;
+	size_t nLastSlash = sSocketDir.rfind('/');
+	sSocketDir = (std::string::npos == nLastSlash) ? "." : sSocketDir.substr(0, (0 == nLastSlash) ? 1 : nLastSlash);
+	if (!PrepareSocketDir(sSocketDir, sDefaultSocketPath == pSocketPath) || !RemoveStaleSocket(addr))
+		return 1;
+
+	//goiod is the one process that talks to the devices, so it must not become a client of itself.
+	unsetenv("GOIO_DAEMON");
+	if (0 != GoIO_Init())
+	{
+		fprintf(stderr, "goiod: GoIO_Init() failed\n");
+		return 1;
+	}
+
+	//Create the socket without access for anybody else, then open it up to the group if there is one.
+	listenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+	mode_t oldUmask = umask(0077);
+	bool bBound = (listenSocket >= 0) && (0 == bind(listenSocket, (struct sockaddr *) &addr, sizeof(addr)));
+	umask(oldUmask);
+	if ((!bBound) || (bSocketGroupSet && (0 != chown(pSocketPath, (uid_t) -1, socketGroup))) ||
+		(0 != chmod(pSocketPath, bSocketGroupSet ? 0660 : 0600)) || (0 != listen(listenSocket, 16)))
+	{
+		int nError = errno;
+		if (bBound)
+			unlink(pSocketPath);
+		fprintf(stderr, "goiod: cannot listen on %s: %s\n", pSocketPath, strerror(nError));
+		GoIO_Uninit();
+		return 1;
+	}
+
+	struct sigaction action;
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = OnSignal;
+	sigaction(SIGINT, &action, NULL);
+	sigaction(SIGTERM, &action, NULL);
+	signal(SIGPIPE, SIG_IGN);
+	printf("goiod: listening on %s\n", pSocketPath);
+	fflush(stdout);
+
+	while (!bQuit)
+	{
+		int fd = accept(listenSocket, NULL, NULL);
+		ReapClients(false);
+		if (fd < 0)
+		{
+			if ((EINTR == errno) || bQuit)
+				continue;
+			fprintf(stderr, "goiod: accept failed: %s\n", strerror(errno));
+			break;
+		}
+		if (!IsClientAllowed(fd))
+		{
+			close(fd);
+			continue;
+		}
+
+		GoIODaemonClient *pClient = new GoIODaemonClient();
+		pClient->fd = fd;
+		pClient->bDone = false;
+		pthread_mutex_lock(&devicesMutex);
+		if (0 == pthread_create(&pClient->thread, NULL, ClientThread, pClient))
+			clients.push_back(pClient);
+		else
+		{
+			close(fd);
+			delete pClient;
+		}
+		pthread_mutex_unlock(&devicesMutex);
+	}
+
+	ReapClients(true);
+	close(listenSocket);
+	unlink(pSocketPath);
+	GoIO_Uninit();
+	printf("goiod: stopped\n");
+
+	return 0;
+}
@@ -0,0 +1,587 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GoIO_GadgetEmulator.cpp
+//
+// GoIO_GadgetEmulator presents a simulated Go! device to the local USB stack through the Linux raw-gadget
+// interface, so the real ldusb and libusb backends(kernel driver binding and detach, libusb transfers, and the
+// 8 byte HID report framing) can be exercised and benchmarked end to end on a machine without Vernier hardware.
+// The device side of the protocol is handled by GSkipSimulator, the same engine behind "sim:" devices:
+// command packets arrive as HID SET_REPORT requests on endpoint 0, and response and measurement packets are
+// sent on interrupt endpoint 0x81, just like a real Go! Link, Go! Temp, Go! Motion or Mini GC.
+//
+// Setup(as root, on a kernel built with CONFIG_USB_DUMMY_HCD and CONFIG_USB_RAW_GADGET):
+//		modprobe dummy_hcd
+//		modprobe raw_gadget
+//		GoIO_GadgetEmulator -p 3
+// Then run any GoIO app as usual. Each emulator process presents one device on one dummy UDC; load dummy_hcd
+// with num=N and pass -u dummy_udc.1 etc. to present several devices at once.
+
+#include "stdafx.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <deque>
+#include <sys/ioctl.h>
+#include <linux/usb/ch9.h>
+#include <linux/usb/raw_gadget.h>
+
+#include "GSkipSimulator.h"
+#include "GVernierUSB.h"
+#include "GUtils.h"
+
+#ifdef LIB_NAMESPACE
+using namespace LIB_NAMESPACE;
+#endif
+
+#define EMULATOR_MAX_QUEUED_PACKETS 4096
+#define EMULATOR_EP0_MAX_DATA 256
+
+#define HID_DESCRIPTOR_TYPE 0x21
+#define HID_REPORT_DESCRIPTOR_TYPE 0x22
+#define HID_REQ_GET_REPORT 0x01
+#define HID_REQ_SET_REPORT 0x09
+#define HID_REQ_SET_IDLE 0x0A
+#define HID_REQ_SET_PROTOCOL 0x0B
+
+//The raw-gadget structs end in flexible arrays, so allocate them in suitably aligned buffers.
+#define EMULATOR_IO_BUFFER_WORDS(nDataBytes) ((sizeof(struct usb_raw_ep_io) + (nDataBytes) + 7)/8)
+
+struct EmulatorState
+{
+	int						fd;			//raw-gadget file descriptor
+	int						nProductID;
+	int						nEndpointNum;	//address of the interrupt IN endpoint, without the direction bit
+	int						nEpInHandle;	//-1 until the host sets the configuration
+	GSkipSimulator			*pSimulator;
+
+	pthread_mutex_t			mutex;
+	pthread_cond_t			packetsQueued;
+	std::deque<GSkipPacket>	inPackets;	//waiting for the host to read them from the interrupt pipe
+
+	unsigned int			nCmdsReceived;
+	unsigned int			nPacketsSent;
+	unsigned int			nPacketsDropped;
+};
+
+static EmulatorState gState;
+static volatile bool gbExit = false;
+
+static const unsigned char kHidReportDescriptor[] =
+{
+	0x06, 0x00, 0xFF,	// Usage Page (Vendor Defined 0xFF00)
+	0x09, 0x01,			// Usage (1)
+	0xA1, 0x01,			// Collection (Application)
+	0x15, 0x00,			//   Logical Minimum (0)
+	0x26, 0xFF, 0x00,	//   Logical Maximum (255)
+	0x75, 0x08,			//   Report Size (8)
+	0x95, 0x08,			//   Report Count (8)
+	0x09, 0x01,			//   Usage (1)
+	0x81, 0x02,			//   Input (Data, Var, Abs)
+	0x95, 0x08,			//   Report Count (8)
+	0x09, 0x01,			//   Usage (1)
+	0x91, 0x02,			//   Output (Data, Var, Abs)
+	0xC0				// End Collection
+};
+
+static void PutShort(unsigned char *pDest, int value)
+{
+	pDest[0] = (unsigned char) (value & 0xFF);
+	pDest[1] = (unsigned char) ((value >> 8) & 0xFF);
+}
+
+static int BuildDeviceDescriptor(unsigned char *pDesc)
+{
+	memset(pDesc, 0, USB_DT_DEVICE_SIZE);
+	pDesc[0] = USB_DT_DEVICE_SIZE;
+	pDesc[1] = USB_DT_DEVICE;
+	PutShort(&pDesc[2], 0x0110);	//bcdUSB
+	pDesc[7] = 64;					//bMaxPacketSize0
+	PutShort(&pDesc[8], VERNIER_DEFAULT_VENDOR_ID);
+	PutShort(&pDesc[10], gState.nProductID);
+	PutShort(&pDesc[12], 0x0100);	//bcdDevice
+	pDesc[14] = 1;					//iManufacturer
+	pDesc[15] = 2;					//iProduct
+	pDesc[16] = 3;					//iSerialNumber
+	pDesc[17] = 1;					//bNumConfigurations
+	return USB_DT_DEVICE_SIZE;
+}
+
+static void BuildEndpointDescriptor(struct usb_endpoint_descriptor *pDesc)
+{
+	memset(pDesc, 0, sizeof(*pDesc));
+	pDesc->bLength = USB_DT_ENDPOINT_SIZE;
+	pDesc->bDescriptorType = USB_DT_ENDPOINT;
+	pDesc->bEndpointAddress = USB_DIR_IN | gState.nEndpointNum;
+	pDesc->bmAttributes = USB_ENDPOINT_XFER_INT;
+	pDesc->wMaxPacketSize = sizeof(GSkipPacket);//Little endian hosts only.
+	pDesc->bInterval = 1;
+}
+
+static int BuildConfigDescriptor(unsigned char *pDesc)
+{
+	int nLength = 0;
+
+	//Configuration
+	unsigned char *pConfig = &pDesc[nLength];
+	pConfig[0] = USB_DT_CONFIG_SIZE;
+	pConfig[1] = USB_DT_CONFIG;
+	pConfig[4] = 1;					//bNumInterfaces
+	pConfig[5] = 1;					//bConfigurationValue
+	pConfig[6] = 0;					//iConfiguration
+	pConfig[7] = USB_CONFIG_ATT_ONE;
+	pConfig[8] = 50;				//bMaxPower, in 2 mA units
+	nLength += USB_DT_CONFIG_SIZE;
+
+	//Interface
+	unsigned char *pInterface = &pDesc[nLength];
+	memset(pInterface, 0, USB_DT_INTERFACE_SIZE);
+	pInterface[0] = USB_DT_INTERFACE_SIZE;
+	pInterface[1] = USB_DT_INTERFACE;
+	pInterface[4] = 1;				//bNumEndpoints
+	pInterface[5] = USB_CLASS_HID;
+	nLength += USB_DT_INTERFACE_SIZE;
+
+	//HID
+	unsigned char *pHid = &pDesc[nLength];
+	pHid[0] = 9;
+	pHid[1] = HID_DESCRIPTOR_TYPE;
+	PutShort(&pHid[2], 0x0110);		//bcdHID
+	pHid[4] = 0;					//bCountryCode
+	pHid[5] = 1;					//bNumDescriptors
+	pHid[6] = HID_REPORT_DESCRIPTOR_TYPE;
+	PutShort(&pHid[7], sizeof(kHidReportDescriptor));
+	nLength += 9;
+
+	//Endpoint
+	struct usb_endpoint_descriptor endpoint;
+	BuildEndpointDescriptor(&endpoint);
+	memcpy(&pDesc[nLength], &endpoint, USB_DT_ENDPOINT_SIZE);
+	nLength += USB_DT_ENDPOINT_SIZE;
+
+	PutShort(&pConfig[2], nLength);	//wTotalLength
+	return nLength;
+}
+
+static int BuildStringDescriptor(int nIndex, unsigned char *pDesc)
+{
+	const char *pString = NULL;
+	char serialNumber[20];
+	switch (nIndex)
+	{
+		case 0:
+			pDesc[0] = 4;
+			pDesc[1] = USB_DT_STRING;
+			PutShort(&pDesc[2], 0x0409);//English(US)
+			return 4;
+		case 1:
+			pString = "Vernier Software & Technology";
+			break;
+		case 2:
+			if (USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID == gState.nProductID)
+				pString = "Go! Temp";
+			else
+			if (CYCLOPS_DEFAULT_PRODUCT_ID == gState.nProductID)
+				pString = "Go! Motion";
+			else
+			if (MINI_GC_DEFAULT_PRODUCT_ID == gState.nProductID)
+				pString = "Mini GC";
+			else
+				pString = "Go! Link";
+			break;
+		case 3:
+			snprintf(serialNumber, sizeof(serialNumber), "EMU%05d", (int) getpid());
+			pString = serialNumber;
+			break;
+		default:
+			return -1;
+	}
+
+	int nChars = strlen(pString);
+	pDesc[0] = (unsigned char) (2 + 2*nChars);
+	pDesc[1] = USB_DT_STRING;
+	for (int i = 0; i < nChars; i++)
+		PutShort(&pDesc[2 + 2*i], (unsigned char) pString[i]);
+	return 2 + 2*nChars;
+}
+
+static void QueueInPacket(void * /*pContext*/, GSkipPacket *pPacket)
+{
+	pthread_mutex_lock(&gState.mutex);
+	if (gState.inPackets.size() >= EMULATOR_MAX_QUEUED_PACKETS)
+	{
+		//The host is not reading the interrupt pipe fast enough, so lose the oldest packet like a real device would.
+		gState.inPackets.pop_front();
+		gState.nPacketsDropped++;
+	}
+	gState.inPackets.push_back(*pPacket);
+	pthread_cond_signal(&gState.packetsQueued);
+	pthread_mutex_unlock(&gState.mutex);
+}
+
+static bool FindInterruptInEndpoint(void)
+{
+	struct usb_raw_eps_info info;
+	memset(&info, 0, sizeof(info));
+	int nNumEps = ioctl(gState.fd, USB_RAW_IOCTL_EPS_INFO, &info);
+	for (int i = 0; i < nNumEps; i++)
+	{
+		if (info.eps[i].caps.type_int && info.eps[i].caps.dir_in)
+		{
+			//The libusb backend expects 0x81, so use endpoint 1 whenever the UDC lets us choose.
+			gState.nEndpointNum = (USB_RAW_EP_ADDR_ANY == info.eps[i].addr) ? 1 : info.eps[i].addr;
+			if (1 != gState.nEndpointNum)
+				printf("Warning: UDC only offers endpoint %d for interrupt IN, the libusb backend expects 1.\n", gState.nEndpointNum);
+			return true;
+		}
+	}
+
+	printf("UDC has no interrupt IN endpoint.\n");
+	return false;
+}
+
+static bool Ep0Write(const unsigned char *pData, int nLength, int nMaxLength)
+{
+	unsigned long long buf[EMULATOR_IO_BUFFER_WORDS(EMULATOR_EP0_MAX_DATA)];
+	struct usb_raw_ep_io *pIo = (struct usb_raw_ep_io *) buf;
+	if (nLength > nMaxLength)
+		nLength = nMaxLength;
+	pIo->ep = 0;
+	pIo->flags = 0;
+	pIo->length = nLength;
+	memcpy(pIo->data, pData, nLength);
+	return (ioctl(gState.fd, USB_RAW_IOCTL_EP0_WRITE, pIo) >= 0);
+}
+
+static int Ep0Read(unsigned char *pData, int nLength)
+{
+	unsigned long long buf[EMULATOR_IO_BUFFER_WORDS(EMULATOR_EP0_MAX_DATA)];
+	struct usb_raw_ep_io *pIo = (struct usb_raw_ep_io *) buf;
+	if (nLength > EMULATOR_EP0_MAX_DATA)
+		nLength = EMULATOR_EP0_MAX_DATA;
+	pIo->ep = 0;
+	pIo->flags = 0;
+	pIo->length = nLength;
+	int nBytesRead = ioctl(gState.fd, USB_RAW_IOCTL_EP0_READ, pIo);
+	if ((nBytesRead > 0) && pData)
+		memcpy(pData, pIo->data, nBytesRead);
+	return nBytesRead;
+}
+
+static void Ep0Stall(void)
+{
+	ioctl(gState.fd, USB_RAW_IOCTL_EP0_STALL, 0);
+}
+
+static void HandleControlRequest(const struct usb_ctrlrequest *pRequest)
+{
+	unsigned char desc[EMULATOR_EP0_MAX_DATA];
+	int nLength = -1;
+	int wValue = pRequest->wValue;
+	int wLength = pRequest->wLength;
+
+	if (USB_TYPE_STANDARD == (pRequest->bRequestType & USB_TYPE_MASK))
+	{
+		switch (pRequest->bRequest)
+		{
+			case USB_REQ_GET_DESCRIPTOR:
+				switch (wValue >> 8)
+				{
+					case USB_DT_DEVICE:
+						nLength = BuildDeviceDescriptor(desc);
+						break;
+					case USB_DT_CONFIG:
+						nLength = BuildConfigDescriptor(desc);
+						break;
+					case USB_DT_STRING:
+						nLength = BuildStringDescriptor(wValue & 0xFF, desc);
+						break;
+					case HID_REPORT_DESCRIPTOR_TYPE:
+						nLength = sizeof(kHidReportDescriptor);
+						memcpy(desc, kHidReportDescriptor, nLength);
+						break;
+				}
+				if (nLength >= 0)
+					Ep0Write(desc, nLength, wLength);
+				else
+					Ep0Stall();
+				break;
+
+			case USB_REQ_SET_CONFIGURATION:
+				if (gState.nEpInHandle < 0)
+				{
+					struct usb_endpoint_descriptor endpoint;
+					BuildEndpointDescriptor(&endpoint);
+					int nHandle = ioctl(gState.fd, USB_RAW_IOCTL_EP_ENABLE, &endpoint);
+					if (nHandle < 0)
+						printf("Failed to enable the interrupt endpoint: %s\n", strerror(errno));
+					else
+					{
+						ioctl(gState.fd, USB_RAW_IOCTL_VBUS_DRAW, 50);
+						ioctl(gState.fd, USB_RAW_IOCTL_CONFIGURE, 0);
+						pthread_mutex_lock(&gState.mutex);
+						gState.nEpInHandle = nHandle;
+						pthread_cond_signal(&gState.packetsQueued);
+						pthread_mutex_unlock(&gState.mutex);
+						printf("Host configured the device.\n");
+					}
+				}
+				Ep0Read(NULL, 0);
+				break;
+
+			case USB_REQ_SET_INTERFACE:
+				Ep0Read(NULL, 0);
+				break;
+
+			case USB_REQ_GET_STATUS:
+				memset(desc, 0, 2);
+				Ep0Write(desc, 2, wLength);
+				break;
+
+			default:
+				Ep0Stall();
+				break;
+		}
+	}
+	else
+	if (USB_TYPE_CLASS == (pRequest->bRequestType & USB_TYPE_MASK))
+	{
+		switch (pRequest->bRequest)
+		{
+			case HID_REQ_SET_REPORT:
+			{
+				//This is how both backends send Skip command packets.
+				GSkipPacket packet;
+				memset(&packet, 0, sizeof(packet));
+				int nBytesRead = Ep0Read(desc, wLength);
+				if (nBytesRead > 0)
+				{
+					memcpy(&packet, desc, (nBytesRead < (int) sizeof(packet)) ? nBytesRead : sizeof(packet));
+					gState.nCmdsReceived++;
+					gState.pSimulator->WriteCmdPacket(&packet);
+				}
+				break;
+			}
+
+			case HID_REQ_SET_IDLE:
+			case HID_REQ_SET_PROTOCOL:
+				Ep0Read(NULL, 0);
+				break;
+
+			default:
+				Ep0Stall();
+				break;
+		}
+	}
+	else
+		Ep0Stall();
+}
+
+static void *InterruptInThread(void * /*pParam*/)
+{
+	while (!gbExit)
+	{
+		unsigned long long buf[EMULATOR_IO_BUFFER_WORDS(sizeof(GSkipPacket))];
+		struct usb_raw_ep_io *pIo = (struct usb_raw_ep_io *) buf;
+		bool bHavePacket = false;
+
+		pthread_mutex_lock(&gState.mutex);
+		while (!gbExit && ((gState.nEpInHandle < 0) || gState.inPackets.empty()))
+			pthread_cond_wait(&gState.packetsQueued, &gState.mutex);
+		if (!gbExit)
+		{
+			pIo->ep = gState.nEpInHandle;
+			pIo->flags = 0;
+			pIo->length = sizeof(GSkipPacket);
+			memcpy(pIo->data, &gState.inPackets.front(), sizeof(GSkipPacket));
+			gState.inPackets.pop_front();
+			bHavePacket = true;
+		}
+		pthread_mutex_unlock(&gState.mutex);
+
+		//Blocks until the host polls the endpoint, which is what paces a real device too.
+		if (bHavePacket)
+		{
+			if (ioctl(gState.fd, USB_RAW_IOCTL_EP_WRITE, pIo) == (int) sizeof(GSkipPacket))
+				gState.nPacketsSent++;
+			else
+				gState.nPacketsDropped++;
+		}
+	}
+
+	return NULL;
+}
+
+static void *PumpThread(void * /*pParam*/)
+{
+	unsigned int lastReportTimeMs = GUtils::OSGetTimeStamp();
+	while (!gbExit)
+	{
+		gState.pSimulator->Pump();
+		GUtils::OSSleep(1);
+
+		if ((GUtils::OSGetTimeStamp() - lastReportTimeMs) >= 5000)
+		{
+			lastReportTimeMs = GUtils::OSGetTimeStamp();
+			printf("cmds received %u, packets sent %u, packets dropped %u\n",
+				gState.nCmdsReceived, gState.nPacketsSent, gState.nPacketsDropped);
+		}
+	}
+
+	return NULL;
+}
+
+static void OnSignal(int /*signal*/)
+{
+	gbExit = true;
+}
+
+static void PrintUsage(void)
+{
+	printf("usage: GoIO_GadgetEmulator [-p product id] [-c simulator config] [-d udc driver] [-u udc device]\n");
+	printf("	-p	USB product id to present: 2 Go! Temp, 3 Go! Link(default), 4 Go! Motion, 7 Mini GC.\n");
+	printf("	-c	GSkipSimulator config, e.g. \"fill=3,sensor_id=20\"(see GoIO_Diags_SetSimulatorConfig()).\n");
+	printf("	-d	raw-gadget UDC driver name, default dummy_udc.\n");
+	printf("	-u	raw-gadget UDC device name, default dummy_udc.0.\n");
+}
+
+int main(int argc, char* argv[])
+{
+	const char *pDriverName = "dummy_udc";
+	const char *pDeviceName = "dummy_udc.0";
+	const char *pSimulatorConfig = "";
+	int opt;
+
+	gState.nProductID = SKIP_DEFAULT_PRODUCT_ID;
+	while ((opt = getopt(argc, argv, "p:c:d:u:h")) != -1)
+	{
+		switch (opt)
+		{
+			case 'p': gState.nProductID = atoi(optarg); break;
+			case 'c': pSimulatorConfig = optarg; break;
+			case 'd': pDriverName = optarg; break;
+			case 'u': pDeviceName = optarg; break;
+			default: PrintUsage(); return 1;
+		}
+	}
+
+	if (!GSkipSimulator::SetConfig(pSimulatorConfig))
+	{
+		printf("Invalid simulator config '%s'.\n", pSimulatorConfig);
+		return 1;
+	}
+
+	gState.nEndpointNum = 1;
+	gState.nEpInHandle = -1;
+	gState.nCmdsReceived = 0;
+	gState.nPacketsSent = 0;
+	gState.nPacketsDropped = 0;
+	pthread_mutex_init(&gState.mutex, NULL);
+	pthread_cond_init(&gState.packetsQueued, NULL);
+
+	cppsstream ssName;
+	ssName << GSTD_S("sim:") << gState.nProductID << GSTD_S(":0");
+	gState.pSimulator = GSkipSimulator::CreateSimulator(ssName.str(), QueueInPacket, QueueInPacket, NULL);
+	if (NULL == gState.pSimulator)
+	{
+		printf("Product id %d is not supported.\n", gState.nProductID);
+		return 1;
+	}
+
+	gState.fd = open("/dev/raw-gadget", O_RDWR);
+	if (gState.fd < 0)
+	{
+		printf("Failed to open /dev/raw-gadget(%s). Load the dummy_hcd and raw_gadget modules and run as root.\n", strerror(errno));
+		return 1;
+	}
+
+	struct usb_raw_init init;
+	memset(&init, 0, sizeof(init));
+	strncpy((char *) init.driver_name, pDriverName, UDC_NAME_LENGTH_MAX - 1);
+	strncpy((char *) init.device_name, pDeviceName, UDC_NAME_LENGTH_MAX - 1);
+	init.speed = USB_SPEED_FULL;
+	if ((ioctl(gState.fd, USB_RAW_IOCTL_INIT, &init) < 0) || (ioctl(gState.fd, USB_RAW_IOCTL_RUN, 0) < 0))
+	{
+		printf("Failed to bind to UDC %s/%s(%s).\n", pDriverName, pDeviceName, strerror(errno));
+		return 1;
+	}
+
+	//No SA_RESTART, so that a signal interrupts the blocking event fetch.
+	struct sigaction action;
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = OnSignal;
+	sigaction(SIGINT, &action, NULL);
+	sigaction(SIGTERM, &action, NULL);
+
+	pthread_t inThread, pumpThread;
+	pthread_create(&inThread, NULL, InterruptInThread, NULL);
+	pthread_create(&pumpThread, NULL, PumpThread, NULL);
+	printf("Presenting product id %d on %s. Press Ctrl-C to exit.\n", gState.nProductID, pDeviceName);
+
+	while (!gbExit)
+	{
+		unsigned long long buf[(sizeof(struct usb_raw_event) + sizeof(struct usb_ctrlrequest) + 7)/8];
+		struct usb_raw_event *pEvent = (struct usb_raw_event *) buf;
+		memset(buf, 0, sizeof(buf));
+		pEvent->type = USB_RAW_EVENT_INVALID;
+		pEvent->length = sizeof(struct usb_ctrlrequest);
+
+		if (ioctl(gState.fd, USB_RAW_IOCTL_EVENT_FETCH, pEvent) < 0)
+		{
+			if (EINTR != errno)
+				printf("Event fetch failed(%s).\n", strerror(errno));
+			break;
+		}
+
+		if (USB_RAW_EVENT_CONNECT == pEvent->type)
+		{
+			if (!FindInterruptInEndpoint())
+				break;
+		}
+		else
+		if (USB_RAW_EVENT_CONTROL == pEvent->type)
+			HandleControlRequest((struct usb_ctrlrequest *) pEvent->data);
+	}
+
+	//The interrupt IN thread may be blocked in the kernel waiting for the host, so do not wait for it.
+	gbExit = true;
+	pthread_mutex_lock(&gState.mutex);
+	pthread_cond_broadcast(&gState.packetsQueued);
+	pthread_mutex_unlock(&gState.mutex);
+	pthread_join(pumpThread, NULL);
+	close(gState.fd);
+
+	printf("cmds received %u, packets sent %u, packets dropped %u\n",
+		gState.nCmdsReceived, gState.nPacketsSent, gState.nPacketsDropped);
+	return 0;
+}
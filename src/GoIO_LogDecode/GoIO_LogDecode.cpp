@@ -0,0 +1,151 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GoIO_LogDecode.cpp
+//
+// GoIO_LogDecode converts a binary log recorded with GoIO_Diags_OpenBinaryLog()(or the GOIO_BINLOG environment
+// variable) to text, one line per event:
+//		<seconds since the log was opened> <thread index> <severity> <event name>: <message>
+// Each thread's events are written to the file in batches, so by default the events are sorted by time stamp
+// before they are printed. Use -u to print them in file order instead, e.g. for very large logs.
+
+#include "stdafx.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <algorithm>
+#include <vector>
+
+#include "GBinaryLog.h"
+#include "GUtils.h"
+
+#ifdef LIB_NAMESPACE
+using namespace LIB_NAMESPACE;
+#endif
+
+static unsigned long long gStartTimeUs = 0;
+static int gnMinSeverity = 0;
+static unsigned int gnThreadIndex = 0;
+
+static bool IsEarlier(const GBinaryLogRecord &record1, const GBinaryLogRecord &record2)
+{
+	return (record1.timeUs < record2.timeUs);
+}
+
+static const char *GetSeverityName(int nSeverity)
+{
+	if (nSeverity >= TRACE_SEVERITY_HIGH)
+		return "HIGH";
+	if (nSeverity >= TRACE_SEVERITY_MEDIUM)
+		return "MED";
+	if (nSeverity >= TRACE_SEVERITY_LOW)
+		return "LOW";
+	return "LOWEST";
+}
+
+static void PrintRecord(const GBinaryLogRecord &record)
+{
+	if ((record.severity < gnMinSeverity) || ((gnThreadIndex != 0) && (record.threadIndex != gnThreadIndex)))
+		return;
+
+	char message[256];
+	const char *pName = GBinaryLog::GetEventName(record.eventId);
+	const char *pFormat = GBinaryLog::GetEventFormat(record.eventId);
+	if (pFormat)
+		snprintf(message, sizeof(message), pFormat, record.args[0], record.args[1], record.args[2], record.args[3]);
+	else
+	{
+		//Written by a newer version of the lib.
+		pName = "Unknown";
+		snprintf(message, sizeof(message), "event %u, args %u %u %u %u", (unsigned int) record.eventId, 
+			record.args[0], record.args[1], record.args[2], record.args[3]);
+	}
+
+	long long deltaUs = (long long) (record.timeUs - gStartTimeUs);
+	printf("%12.6f T%-3u %-6s %s: %s\n", deltaUs/1000000.0, record.threadIndex, GetSeverityName(record.severity), pName, message);
+}
+
+static void PrintUsage(void)
+{
+	printf("usage: GoIO_LogDecode [-u] [-s severity] [-t thread index] log file\n");
+	printf("	-u	print events in file order, rather than sorted by time stamp.\n");
+	printf("	-s	only print events with at least this severity: 1 lowest, 10 low, 50 medium, 100 high.\n");
+	printf("	-t	only print events recorded by this thread.\n");
+}
+
+int main(int argc, char* argv[])
+{
+	bool bSort = true;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "us:t:h")) != -1)
+	{
+		switch (opt)
+		{
+			case 'u': bSort = false; break;
+			case 's': gnMinSeverity = atoi(optarg); break;
+			case 't': gnThreadIndex = (unsigned int) atoi(optarg); break;
+			default: PrintUsage(); return 1;
+		}
+	}
+
+	if (optind != (argc - 1))
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	GBinaryLogReader reader;
+	if (!reader.Open(argv[optind]))
+	{
+		printf("%s is not a GoIO binary log.\n", argv[optind]);
+		return 1;
+	}
+
+	gStartTimeUs = reader.GetStartTimeUs();
+	time_t startTime = (time_t) reader.GetStartTime();
+	printf("Log opened %s", ctime(&startTime));
+
+	GBinaryLogRecord record;
+	if (bSort)
+	{
+		std::vector<GBinaryLogRecord> records;
+		while (reader.ReadRecord(&record))
+			records.push_back(record);
+		std::stable_sort(records.begin(), records.end(), IsEarlier);
+		for (size_t i = 0; i < records.size(); i++)
+			PrintRecord(records[i]);
+	}
+	else
+	{
+		while (reader.ReadRecord(&record))
+			PrintRecord(record);
+	}
+
+	return 0;
+}
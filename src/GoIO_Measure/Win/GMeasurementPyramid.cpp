@@ -0,0 +1,220 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+#include "stdafx.h"
+#include "GMeasurementPyramid.h"
+
+GMeasurementPyramid::GMeasurementPyramid(
+	int maxNumMeasurements)//should match the number of measurements that the circular buffer holds.
+{
+	m_maxNumMeasurements = maxNumMeasurements;
+	Clear();
+}
+
+GMeasurementPyramid::~GMeasurementPyramid()
+{
+}
+
+void GMeasurementPyramid::Clear()
+{
+	m_firstIndex = 0;
+	m_nextIndex = 0;
+	m_levels.clear();
+	m_firstGroups.clear();
+}
+
+void GMeasurementPyramid::SetMaxNumMeasurements(int maxNum)
+{
+	m_maxNumMeasurements = maxNum;
+	Clear();
+}
+
+int GMeasurementPyramid::NumMeasurements()
+{
+	return (int) (m_nextIndex - m_firstIndex);
+}
+
+void GMeasurementPyramid::MergeCell(GCell *pCell, const GCell &source)
+{
+	if (0 == source.count)
+		return;
+	if ((0 == pCell->count) || (source.min < pCell->min))
+		pCell->min = source.min;
+	if ((0 == pCell->count) || (source.max > pCell->max))
+		pCell->max = source.max;
+	pCell->sum += source.sum;
+	pCell->count += source.count;
+}
+
+void GMeasurementPyramid::AddMeasurement(double measurement)
+{
+	GCell cell;
+	cell.min = measurement;
+	cell.max = measurement;
+	cell.sum = measurement;
+	cell.count = 1;
+
+	//Add a level whenever the top level needs a second group, so that the top level always has one group that
+	//covers everything since the last Clear().
+	if ((0 == m_levels.size()) || ((m_nextIndex >> (m_levels.size() - 1)) > 0))
+	{
+		int level = (int) m_levels.size();
+		m_levels.push_back(std::deque<GCell>());
+		m_firstGroups.push_back(0);
+		if (level > 0)
+		{
+			//The new level starts at group 0, which is the whole of the level below it, so far.
+			GCell top;
+			memset(&top, 0, sizeof(top));
+			for (size_t i = 0; i < m_levels[level - 1].size(); i++)
+				MergeCell(&top, m_levels[level - 1][i]);
+			m_levels[level].push_back(top);
+		}
+	}
+
+	for (size_t level = 0; level < m_levels.size(); level++)
+	{
+		std::deque<GCell> &cells = m_levels[level];
+		unsigned __int64 group = m_nextIndex >> level;
+		if ((0 == cells.size()) || ((m_firstGroups[level] + cells.size()) <= group))
+		{
+			if (0 == cells.size())
+				m_firstGroups[level] = group;
+			GCell empty;
+			memset(&empty, 0, sizeof(empty));
+			cells.push_back(empty);
+		}
+		MergeCell(&cells.back(), cell);
+	}
+	m_nextIndex++;
+
+	//Drop the groups that only hold measurements that have rolled out of the circular buffer.
+	if ((m_maxNumMeasurements > 0) && ((m_nextIndex - m_firstIndex) > (unsigned __int64) m_maxNumMeasurements))
+	{
+		m_firstIndex = m_nextIndex - m_maxNumMeasurements;
+		for (size_t level = 0; level < m_levels.size(); level++)
+		{
+			std::deque<GCell> &cells = m_levels[level];
+			while ((cells.size() > 0) && (((m_firstGroups[level] + 1) << level) <= m_firstIndex))
+			{
+				cells.pop_front();
+				m_firstGroups[level]++;
+			}
+		}
+	}
+}
+
+GMeasurementPyramid::GCell *GMeasurementPyramid::GetCell(int level, unsigned __int64 group)
+{
+	std::deque<GCell> &cells = m_levels[level];
+	if ((group < m_firstGroups[level]) || ((group - m_firstGroups[level]) >= cells.size()))
+		return NULL;
+	return &cells[(size_t) (group - m_firstGroups[level])];
+}
+
+bool GMeasurementPyramid::GetRange(int firstN, int lastN, GMeasurementBucket *pRange)
+{
+	if (firstN < 0)
+		firstN = 0;
+	if (lastN >= NumMeasurements())
+		lastN = NumMeasurements() - 1;
+	if (firstN > lastN)
+		return false;
+
+	//Take the largest group that starts at index and fits in the range each time, so about 2 groups per level.
+	GCell range;
+	memset(&range, 0, sizeof(range));
+	unsigned __int64 index = m_firstIndex + firstN;
+	unsigned __int64 lastIndex = m_firstIndex + lastN;
+	int topLevel = (int) m_levels.size() - 1;
+	while (index <= lastIndex)
+	{
+		int level = 0;
+		while ((level < topLevel) && (0 == (index & ((((unsigned __int64) 2) << level) - 1))) &&
+			((index + (((unsigned __int64) 2) << level) - 1) <= lastIndex))
+			level++;
+
+		GCell *pCell = GetCell(level, index >> level);
+		if (pCell)
+			MergeCell(&range, *pCell);
+		index += ((unsigned __int64) 1) << level;
+	}
+
+	pRange->firstN = firstN;
+	pRange->numMeasurements = range.count;
+	pRange->min = range.min;
+	pRange->max = range.max;
+	pRange->mean = (range.count > 0) ? (range.sum/range.count) : 0.0;
+	return (range.count > 0);
+}
+
+int GMeasurementPyramid::GetEnvelope(int maxNumBuckets, std::vector<GMeasurementBucket> *pBuckets)
+{
+	pBuckets->clear();
+	int numMeasurements = NumMeasurements();
+	if ((numMeasurements <= 0) || (maxNumBuckets <= 0))
+		return 0;
+
+	//The finest level at which the measurements span no more than maxNumBuckets groups.
+	int topLevel = (int) m_levels.size() - 1;
+	int level = 0;
+	while ((level < topLevel) && 
+		((((m_nextIndex - 1) >> level) - (m_firstIndex >> level) + 1) > (unsigned __int64) maxNumBuckets))
+		level++;
+
+	for (unsigned __int64 group = m_firstIndex >> level; group <= ((m_nextIndex - 1) >> level); group++)
+	{
+		GMeasurementBucket bucket;
+		unsigned __int64 groupStart = group << level;
+		unsigned __int64 groupEnd = groupStart + (((unsigned __int64) 1) << level) - 1;
+		if ((groupStart < m_firstIndex) || (groupEnd >= m_nextIndex))
+		{
+			//The first and last groups can stick out of the buffer, so work those out exactly.
+			if (groupStart < m_firstIndex)
+				groupStart = m_firstIndex;
+			if (groupEnd >= m_nextIndex)
+				groupEnd = m_nextIndex - 1;
+			if (!GetRange((int) (groupStart - m_firstIndex), (int) (groupEnd - m_firstIndex), &bucket))
+				continue;
+		}
+		else
+		{
+			GCell *pCell = GetCell(level, group);
+			if ((NULL == pCell) || (0 == pCell->count))
+				continue;
+			bucket.firstN = (int) (groupStart - m_firstIndex);
+			bucket.numMeasurements = pCell->count;
+			bucket.min = pCell->min;
+			bucket.max = pCell->max;
+			bucket.mean = pCell->sum/pCell->count;
+		}
+		pBuckets->push_back(bucket);
+	}
+
+	return (int) pBuckets->size();
+}
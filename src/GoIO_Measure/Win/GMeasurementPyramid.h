@@ -0,0 +1,86 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GMeasurementPyramid.h
+//
+// Min/max/mean of the measurements in a circular buffer, for every power of two sized, aligned group of them, 
+// kept up to date as measurements are added. The view uses it to find the y range, and to draw about one min/max
+// line per pixel, without touching every measurement when the buffer holds far more measurements than the graph
+// is wide.
+#ifndef _GMEASUREMENTPYRAMID_H_
+#define _GMEASUREMENTPYRAMID_H_
+
+#include <vector>
+#include <deque>
+
+struct GMeasurementBucket
+{
+	int firstN;				//(N == 0) => first measurement in the buffer, as in GetNthMeasurementInCirbuf().
+	int numMeasurements;
+	double min;
+	double max;
+	double mean;
+};
+
+class GMeasurementPyramid
+{
+public:
+	GMeasurementPyramid(int maxNumMeasurements);
+	virtual ~GMeasurementPyramid();
+
+	void AddMeasurement(double measurement);
+	void Clear();
+	void SetMaxNumMeasurements(int maxNum);//Clears the pyramid.
+	int NumMeasurements();
+
+	//Get the min/max/mean of measurements firstN to lastN inclusive. Takes O(log(number of measurements)) time.
+	bool GetRange(int firstN, int lastN, GMeasurementBucket *pRange);
+	//Split all the measurements into at most maxNumBuckets buckets, using the coarsest groups that are needed.
+	//Takes O(maxNumBuckets) time.
+	int GetEnvelope(int maxNumBuckets, std::vector<GMeasurementBucket> *pBuckets);
+
+protected:
+	struct GCell
+	{
+		double min;
+		double max;
+		double sum;
+		int count;
+	};
+
+	void MergeCell(GCell *pCell, const GCell &source);
+	GCell *GetCell(int level, unsigned __int64 group);//NULL if the group has been dropped.
+
+	int m_maxNumMeasurements;
+	unsigned __int64 m_firstIndex;//of the oldest measurement still in the buffer, counting from the last Clear().
+	unsigned __int64 m_nextIndex;
+	std::vector<std::deque<GCell> > m_levels;//m_levels[k] holds groups of 2^k measurements.
+	std::vector<unsigned __int64> m_firstGroups;//group number of m_levels[k].front().
+};
+
+#endif // _GMEASUREMENTPYRAMID_H_
@@ -1,88 +1,88 @@
-/*********************************************************************************
-
-Copyright (c) 2010, Vernier Software & Technology
-All rights reserved.
-
-Redistribution and use in source and binary forms, with or without
-modification, are permitted provided that the following conditions are met:
-    * Redistributions of source code must retain the above copyright
-      notice, this list of conditions and the following disclaimer.
-    * Redistributions in binary form must reproduce the above copyright
-      notice, this list of conditions and the following disclaimer in the
-      documentation and/or other materials provided with the distribution.
-    * Neither the name of Vernier Software & Technology nor the
-      names of its contributors may be used to endorse or promote products
-      derived from this software without specific prior written permission.
-
-THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
-ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
-WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
-DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
-(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
-LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
-ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
-(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-**********************************************************************************/
-// SetMeasPeriodDlg.cpp : implementation file
-//
-
-#include "stdafx.h"
-#include "GoIO_Measure.h"
-#include "SetMeasPeriodDlg.h"
-
-#ifdef _DEBUG
-#define new DEBUG_NEW
-#undef THIS_FILE
-static char THIS_FILE[] = __FILE__;
-#endif
-
-/////////////////////////////////////////////////////////////////////////////
-// CSetMeasPeriodDlg dialog
-
-
-CSetMeasPeriodDlg::CSetMeasPeriodDlg(CWnd* pParent /*=NULL*/)
-	: CDialog(CSetMeasPeriodDlg::IDD, pParent)
-{
-	//{{AFX_DATA_INIT(CSetMeasPeriodDlg)
-	m_period = 0;
-	//}}AFX_DATA_INIT
-
-	m_measurementUnits = "ms";
-}
-
-
-void CSetMeasPeriodDlg::DoDataExchange(CDataExchange* pDX)
-{
-	CDialog::DoDataExchange(pDX);
-	//{{AFX_DATA_MAP(CSetMeasPeriodDlg)
-	DDX_Text(pDX, IDC_PERIOD, m_period);
-	//}}AFX_DATA_MAP
-}
-
-
-BEGIN_MESSAGE_MAP(CSetMeasPeriodDlg, CDialog)
-	//{{AFX_MSG_MAP(CSetMeasPeriodDlg)
-	//}}AFX_MSG_MAP
-END_MESSAGE_MAP()
-
-/////////////////////////////////////////////////////////////////////////////
-// CSetMeasPeriodDlg message handlers
-
-BOOL CSetMeasPeriodDlg::OnInitDialog() 
-{
-	CDialog::OnInitDialog();
-	
-	CWnd *pWnd = GetDlgItem(IDC_PERIOD_LABEL);
-	if (pWnd)
-	{
-		char tmpstring[100];
-		wsprintf(tmpstring, "Measurement Period ( %s )", m_measurementUnits);
-		pWnd->SetWindowText(tmpstring);
-	}
-
-	return TRUE;  // return TRUE unless you set the focus to a control
-	              // EXCEPTION: OCX Property Pages should return FALSE
-}
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// SetMeasPeriodDlg.cpp : implementation file
+//
+
+#include "stdafx.h"
+#include "GoIO_Measure.h"
+#include "SetMeasPeriodDlg.h"
+
+#ifdef _DEBUG
+#define new DEBUG_NEW
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif
+
+/////////////////////////////////////////////////////////////////////////////
+// CSetMeasPeriodDlg dialog
+
+
+CSetMeasPeriodDlg::CSetMeasPeriodDlg(CWnd* pParent /*=NULL*/)
+	: CDialog(CSetMeasPeriodDlg::IDD, pParent)
+{
+	//{{AFX_DATA_INIT(CSetMeasPeriodDlg)
+	m_period = 0;
+	//}}AFX_DATA_INIT
+
+	m_measurementUnits = "ms";
+}
+
+
+void CSetMeasPeriodDlg::DoDataExchange(CDataExchange* pDX)
+{
+	CDialog::DoDataExchange(pDX);
+	//{{AFX_DATA_MAP(CSetMeasPeriodDlg)
+	DDX_Text(pDX, IDC_PERIOD, m_period);
+	//}}AFX_DATA_MAP
+}
+
+
+BEGIN_MESSAGE_MAP(CSetMeasPeriodDlg, CDialog)
+	//{{AFX_MSG_MAP(CSetMeasPeriodDlg)
+	//}}AFX_MSG_MAP
+END_MESSAGE_MAP()
+
+/////////////////////////////////////////////////////////////////////////////
+// CSetMeasPeriodDlg message handlers
+
+BOOL CSetMeasPeriodDlg::OnInitDialog() 
+{
+	CDialog::OnInitDialog();
+	
+	CWnd *pWnd = GetDlgItem(IDC_PERIOD_LABEL);
+	if (pWnd)
+	{
+		char tmpstring[100];
+		wsprintf(tmpstring, "Measurement Period ( %s )", m_measurementUnits);
+		pWnd->SetWindowText(tmpstring);
+	}
+
+	return TRUE;  // return TRUE unless you set the focus to a control
+	              // EXCEPTION: OCX Property Pages should return FALSE
+}
@@ -1,60 +1,60 @@
-//{{NO_DEPENDENCIES}}
-// Microsoft Visual C++ generated include file.
-// Used by GoIO_Measure.rc
-//
-#define VS_VERSION_INFO1                2
-#define IDD_COLLECT_BAR                 9
-#define IDD_ABOUTBOX                    100
-#define IDR_MAINFRAME                   128
-#define IDR_GoIO_MeasureTYPE            129
-#define IDD_SET_MEASUREMENT_PERIOD      130
-#define IDD_SET_DISPLAY_DEPTH           131
-#define IDM_START_MEAS                  1000
-#define IDC_EDIT1                       1000
-#define IDC_PERIOD                      1000
-#define IDM_STOP_MEAS                   1001
-#define IDC_MEAS                        1003
-#define IDC_UNITS                       1004
-#define IDC_PERIOD_LABEL                1014
-#define IDC_LIB_VERSION                 1014
-#define IDC_DEPTH_LABEL                 1015
-#define IDC_DEPTH                       1016
-#define IDM_DEVICE0                     32771
-#define IDM_DEVICE1                     32772
-#define IDM_DEVICE2                     32773
-#define IDM_DEVICE3                     32774
-#define IDM_DEVICE4                     32775
-#define IDM_DEVICE5                     32776
-#define IDM_DEVICE6                     32777
-#define IDM_DEVICE7                     32778
-#define IDM_CALIB0                      32779
-#define IDM_CALIB1                      32780
-#define IDM_CALIB2                      32781
-#define IDM_GET_STATUS                  32782
-#define IDM_SET_MEAS_PERIOD             32783
-#define ID_ACTION_SETDISPLAYDEPTH       32784
-#define IDM_ACTIVATE_PIC24_BOOTLDR      32785
-#define ID_ACTION_GETSENSORID           32786
-#define IDM_GET_SENSOR_ID               32787
-#define ID_ACTION_SETLED                32788
-#define ID_SETLED_GREEN                 32789
-#define ID_SETLED_RED                   32790
-#define ID_SETLED_ORANGE                32791
-#define ID_SETLED_OFF                   32792
-#define IDM_GREEN                       32793
-#define IDM_RED                         32794
-#define IDM_ORANGE                      32795
-#define IDM_LED_OFF                     32796
-#define ID_HELP_GOIOLIBVERBOSE          32797
-#define IDM_GOIO_LIB_VERBOSE            32798
-
-// Next default values for new objects
-// 
-#ifdef APSTUDIO_INVOKED
-#ifndef APSTUDIO_READONLY_SYMBOLS
-#define _APS_NEXT_RESOURCE_VALUE        134
-#define _APS_NEXT_COMMAND_VALUE         32799
-#define _APS_NEXT_CONTROL_VALUE         1017
-#define _APS_NEXT_SYMED_VALUE           101
-#endif
-#endif
+//{{NO_DEPENDENCIES}}
+// Microsoft Visual C++ generated include file.
+// Used by GoIO_Measure.rc
+//
+#define VS_VERSION_INFO1                2
+#define IDD_COLLECT_BAR                 9
+#define IDD_ABOUTBOX                    100
+#define IDR_MAINFRAME                   128
+#define IDR_GoIO_MeasureTYPE            129
+#define IDD_SET_MEASUREMENT_PERIOD      130
+#define IDD_SET_DISPLAY_DEPTH           131
+#define IDM_START_MEAS                  1000
+#define IDC_EDIT1                       1000
+#define IDC_PERIOD                      1000
+#define IDM_STOP_MEAS                   1001
+#define IDC_MEAS                        1003
+#define IDC_UNITS                       1004
+#define IDC_PERIOD_LABEL                1014
+#define IDC_LIB_VERSION                 1014
+#define IDC_DEPTH_LABEL                 1015
+#define IDC_DEPTH                       1016
+#define IDM_DEVICE0                     32771
+#define IDM_DEVICE1                     32772
+#define IDM_DEVICE2                     32773
+#define IDM_DEVICE3                     32774
+#define IDM_DEVICE4                     32775
+#define IDM_DEVICE5                     32776
+#define IDM_DEVICE6                     32777
+#define IDM_DEVICE7                     32778
+#define IDM_CALIB0                      32779
+#define IDM_CALIB1                      32780
+#define IDM_CALIB2                      32781
+#define IDM_GET_STATUS                  32782
+#define IDM_SET_MEAS_PERIOD             32783
+#define ID_ACTION_SETDISPLAYDEPTH       32784
+#define IDM_ACTIVATE_PIC24_BOOTLDR      32785
+#define ID_ACTION_GETSENSORID           32786
+#define IDM_GET_SENSOR_ID               32787
+#define ID_ACTION_SETLED                32788
+#define ID_SETLED_GREEN                 32789
+#define ID_SETLED_RED                   32790
+#define ID_SETLED_ORANGE                32791
+#define ID_SETLED_OFF                   32792
+#define IDM_GREEN                       32793
+#define IDM_RED                         32794
+#define IDM_ORANGE                      32795
+#define IDM_LED_OFF                     32796
+#define ID_HELP_GOIOLIBVERBOSE          32797
+#define IDM_GOIO_LIB_VERBOSE            32798
+
+// Next default values for new objects
+// 
+#ifdef APSTUDIO_INVOKED
+#ifndef APSTUDIO_READONLY_SYMBOLS
+#define _APS_NEXT_RESOURCE_VALUE        134
+#define _APS_NEXT_COMMAND_VALUE         32799
+#define _APS_NEXT_CONTROL_VALUE         1017
+#define _APS_NEXT_SYMED_VALUE           101
+#endif
+#endif
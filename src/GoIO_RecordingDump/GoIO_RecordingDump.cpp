@@ -0,0 +1,275 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GoIO_RecordingDump.cpp
+//
+// GoIO_RecordingDump converts a recording made with GoIO_Recorder_Start() to comma separated text, one line per
+// measurement:
+//		<sample index>,<seconds since the first sample>,<raw measurement>,<volts>[,<calibrated value>]
+// The calibrated value is only present in recordings made with GOIO_RECORDER_OPTION_CALIBRATED.
+// Metadata, gaps where measurements were lost, and the end of recording totals are printed as lines starting 
+// with '#'. Use -s to print only a summary, e.g. to check a recording for gaps and damaged chunks, and -r to print
+// just a window of a long recording, which only reads the part of the file that holds the window. Use -e n to
+// print at most about n min/max/mean lines for the recording(or for the -r window) instead of the measurements,
+// as a plot n pixels wide would draw them:
+//		<first sample index>,<seconds since the first sample>,<# of samples>,<min>,<max>,<mean>
+// with raw measurement values.
+
+#include "stdafx.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "GSkipRecorder.h"
+#include "GSkipRecordingMap.h"
+#include "GUtils.h"
+
+#ifdef LIB_NAMESPACE
+using namespace LIB_NAMESPACE;
+#endif
+
+static void PrintUsage(void)
+{
+	printf("usage: GoIO_RecordingDump [-s] [-r t0:t1] [-e n] recording file\n");
+	printf("	-s	only print a summary, not the measurements.\n");
+	printf("	-r t0:t1	only print the measurements from t0 to t1 seconds.\n");
+	printf("	-e n	print about n min/max/mean buckets instead of the measurements.\n");
+}
+
+static int DumpEnvelope(const char *pFileName, int nMaxBuckets, bool bTimeRange, real fStartTime, real fEndTime)
+{
+	GSkipRecordingMap map;
+	if (!map.Open(pFileName))
+	{
+		printf("%s is not a GoIO recording.\n", pFileName);
+		return 1;
+	}
+
+	unsigned long long startUs = GUtils::OSGetTimeStampMicroseconds();
+	std::vector<GSamplePyramidBucket> buckets;
+	int nLevel = bTimeRange ? map.GetEnvelopeInTimeRange(fStartTime, fEndTime, nMaxBuckets, &buckets) : 
+		map.GetEnvelope(0, ~0ULL, nMaxBuckets, &buckets);
+	unsigned long long elapsedUs = GUtils::OSGetTimeStampMicroseconds() - startUs;
+
+	time_t startTime = (time_t) map.GetStartTime();
+	printf("# Recording started %s", ctime(&startTime));
+	if (nLevel >= 0)
+		printf("# %d buckets of %llu slots, found in %.3f ms.\n", (int) buckets.size(), 1ULL << nLevel, elapsedUs/1000.0);
+	for (size_t i = 0; i < buckets.size(); i++)
+	{
+		const GSamplePyramidBucket &bucket = buckets[i];
+		printf("%llu,%.6f,%u,%g,%g,%.6g\n", bucket.firstSampleIndex, map.GetSampleTime(bucket.firstSampleIndex), 
+			bucket.nNumSamples, bucket.fMin, bucket.fMax, bucket.fMean);
+	}
+	if (map.GetNumCorruptChunks() > 0)
+		printf("# %d damaged chunks.\n", map.GetNumCorruptChunks());
+
+	return 0;
+}
+
+static int DumpTimeRange(const char *pFileName, real fStartTime, real fEndTime)
+{
+	GSkipRecordingMap map;
+	if (!map.Open(pFileName))
+	{
+		printf("%s is not a GoIO recording.\n", pFileName);
+		return 1;
+	}
+
+	unsigned long long startUs = GUtils::OSGetTimeStampMicroseconds();
+	std::vector<GSkipRecordingView> views;
+	int nNumSamples = map.GetSamplesInTimeRange(fStartTime, fEndTime, &views);
+	unsigned long long elapsedUs = GUtils::OSGetTimeStampMicroseconds() - startUs;
+
+	time_t startTime = (time_t) map.GetStartTime();
+	printf("# Recording started %s", ctime(&startTime));
+	printf("# %d samples from %g to %g s, found in %.3f ms%s.\n", nNumSamples, fStartTime, fEndTime, elapsedUs/1000.0, 
+		map.HasIndex() ? "" : " without an index");
+	for (size_t i = 0; i < views.size(); i++)
+	{
+		const GSkipRecordingView &view = views[i];
+		if ((i > 0) && (view.firstSampleIndex != (views[i - 1].firstSampleIndex + views[i - 1].nNumSamples)))
+		{
+			unsigned long long nextSampleIndex = views[i - 1].firstSampleIndex + views[i - 1].nNumSamples;
+			printf("# %llu samples from index %llu are missing.\n", view.firstSampleIndex - nextSampleIndex, nextSampleIndex);
+		}
+
+		const GSkipRecordingMetadata *pMetadata = map.GetMetadataForSample(view.firstSampleIndex);
+		for (int j = 0; j < view.nNumSamples; j++)
+		{
+			unsigned long long sampleIndex = view.firstSampleIndex + j;
+			printf("%llu,%.6f,%d,%.6f", sampleIndex, map.GetSampleTime(sampleIndex), (int) view.pSamples[j],
+				pMetadata ? (view.pSamples[j]*pMetadata->fVoltsPerBit + pMetadata->fVoltsOffset) : 0.0);
+			if (view.pCalibrated)
+				printf(",%.9g", view.pCalibrated[j]);
+			printf("\n");
+		}
+	}
+	if (map.GetNumCorruptChunks() > 0)
+		printf("# %d damaged chunks.\n", map.GetNumCorruptChunks());
+
+	return 0;
+}
+
+int main(int argc, char* argv[])
+{
+	bool bSummaryOnly = false;
+	bool bTimeRange = false;
+	int nMaxBuckets = 0;
+	double fStartTime = 0.0, fEndTime = 0.0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "sr:e:h")) != -1)
+	{
+		switch (opt)
+		{
+			case 's': bSummaryOnly = true; break;
+			case 'r':
+				if (2 != sscanf(optarg, "%lf:%lf", &fStartTime, &fEndTime))
+				{
+					PrintUsage();
+					return 1;
+				}
+				bTimeRange = true;
+				break;
+			case 'e':
+				nMaxBuckets = atoi(optarg);
+				if (nMaxBuckets < 1)
+				{
+					PrintUsage();
+					return 1;
+				}
+				break;
+			default: PrintUsage(); return 1;
+		}
+	}
+
+	if (optind != (argc - 1))
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	if (nMaxBuckets > 0)
+		return DumpEnvelope(argv[optind], nMaxBuckets, bTimeRange, fStartTime, fEndTime);
+	if (bTimeRange)
+		return DumpTimeRange(argv[optind], fStartTime, fEndTime);
+
+	GSkipRecordingReader reader;
+	if (!reader.Open(argv[optind]))
+	{
+		printf("%s is not a GoIO recording.\n", argv[optind]);
+		return 1;
+	}
+
+	time_t startTime = (time_t) reader.GetStartTime();
+	printf("# Recording started %s", ctime(&startTime));
+
+	GSkipRecordingChunk chunk;
+	GSkipRecordingMetadata metadata;
+	memset(&metadata, 0, sizeof(metadata));
+	unsigned long long nextSampleIndex = 0;
+	unsigned long long nNumSamples = 0;
+	unsigned long long nNumMissing = 0;
+	unsigned long long nNumSkipped = 0;//whole chunks that never made it into the file.
+	unsigned int nNextSequence = 0;
+	unsigned int nNumMissingChunks = 0;
+	bool bEnded = false;
+
+	while (reader.ReadChunk(&chunk))
+	{
+		if (chunk.nSequence != nNextSequence)
+			nNumMissingChunks += chunk.nSequence - nNextSequence;
+		nNextSequence = chunk.nSequence + 1;
+
+		if (kSkipRecordingChunk_Metadata == chunk.nType)
+		{
+			metadata = chunk.metadata;
+			char longName[sizeof(metadata.ddsRec.SensorLongName) + 1];
+			memcpy(longName, metadata.ddsRec.SensorLongName, sizeof(metadata.ddsRec.SensorLongName));
+			longName[sizeof(metadata.ddsRec.SensorLongName)] = 0;
+			printf("# From sample %llu: device %04x:%04x, sensor %d '%s', probe type %d, period %g s, volts = raw*%g + %g\n",
+				metadata.firstSampleIndex, metadata.nVendorId, metadata.nProductId, (int) metadata.ddsRec.SensorNumber, 
+				longName, metadata.nProbeType, metadata.fMeasurementPeriod, metadata.fVoltsPerBit, metadata.fVoltsOffset);
+		}
+		else
+		if (kSkipRecordingChunk_Samples == chunk.nType)
+		{
+			if (chunk.firstSampleIndex != nextSampleIndex)
+			{
+				nNumSkipped += chunk.firstSampleIndex - nextSampleIndex;
+				printf("# %llu samples from index %llu were not recorded.\n", chunk.firstSampleIndex - nextSampleIndex, nextSampleIndex);
+			}
+
+			unsigned long long sampleIndex = chunk.firstSampleIndex;
+			size_t nGap = 0;
+			for (size_t i = 0; i <= chunk.samples.size(); i++)
+			{
+				while ((nGap < chunk.gaps.size()) && (chunk.gaps[nGap].nSampleOffset == i))
+				{
+					nNumMissing += chunk.gaps[nGap].nNumMissing;
+					if (!bSummaryOnly)
+						printf("# %u samples from index %llu were lost before reaching the computer.\n", chunk.gaps[nGap].nNumMissing, sampleIndex);
+					sampleIndex += chunk.gaps[nGap].nNumMissing;
+					nGap++;
+				}
+
+				if (i < chunk.samples.size())
+				{
+					if (!bSummaryOnly)
+					{
+						printf("%llu,%.6f,%d,%.6f", sampleIndex, reader.GetSampleTime(sampleIndex), (int) chunk.samples[i],
+							chunk.samples[i]*metadata.fVoltsPerBit + metadata.fVoltsOffset);
+						if (chunk.calibrated.size() > 0)
+							printf(",%.9g", chunk.calibrated[i]);
+						printf("\n");
+					}
+					sampleIndex++;
+				}
+			}
+			nNumSamples += chunk.samples.size();
+			nextSampleIndex = sampleIndex;
+		}
+		else
+		if (kSkipRecordingChunk_End == chunk.nType)
+		{
+			printf("# End of recording: %llu sample slots, %llu recorded, %llu discarded by the recorder.\n", 
+				chunk.nNumSlots, chunk.nNumRecorded, chunk.nNumLost);
+			bEnded = true;
+		}
+	}
+
+	printf("# %llu samples read, %llu lost before reaching the computer, %llu not recorded.\n", nNumSamples, nNumMissing, nNumSkipped);
+	if ((reader.GetNumCorruptChunks() > 0) || (nNumMissingChunks > 0))
+		printf("# %d damaged chunks, %u missing chunks.\n", reader.GetNumCorruptChunks(), nNumMissingChunks);
+	if (!bEnded)
+		printf("# The recording was not ended cleanly.\n");
+
+	return 0;
+}
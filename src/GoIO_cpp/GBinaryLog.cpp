@@ -0,0 +1,451 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GBinaryLog.cpp
+
+#include "stdafx.h"
+#include "GBinaryLog.h"
+#include "GUtils.h"
+
+#include <time.h>
+
+#ifdef _DEBUG
+#include "GPlatformDebug.h" // for DEBUG_NEW definition
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+//Single producer(the owning thread), single consumer(the writer thread) ring of records.
+struct GBinaryLogRing
+{
+	GBinaryLogRecord	records[GBINARYLOG_RING_SIZE];
+	volatile unsigned int	nHead;//only advanced by the owning thread.
+	volatile unsigned int	nTail;//only advanced by the writer thread.
+	volatile int		nNumDropped;
+	unsigned int		nThreadIndex;
+	volatile bool		bThreadExited;
+	bool				bFree;
+};
+
+struct GBinaryLogEventDesc
+{
+	int					nEventId;
+	const char *		pName;
+	const char *		pFormat;
+};
+
+static const GBinaryLogEventDesc binaryLogEventDescs[] =
+{
+	{ kBinaryLogEvent_ThreadStart,			"ThreadStart",			"Thread started, OS thread id %u." },
+	{ kBinaryLogEvent_EventsDropped,		"EventsDropped",		"%u events from thread %u dropped because the log ring was full." },
+	{ kBinaryLogEvent_SkipCmdSent,			"SkipCmdSent",			"Skip cmd sent: %xh, params %08xh %06xh, result %d." },
+	{ kBinaryLogEvent_SkipCmdWriteFailed,	"SkipCmdWriteFailed",	"Error writing %xh cmd to skip." },
+	{ kBinaryLogEvent_SkipCmdTimeout,		"SkipCmdTimeout",		"Error waiting for response to %xh cmd from Skip. Timeout??" },
+	{ kBinaryLogEvent_SkipCmdErrorResponse,	"SkipCmdErrorResponse",	"Skip reported an error over the wire. cmd sent = %xh. Error returned = %xh." },
+	{ kBinaryLogEvent_SkipCmdMismatch,		"SkipCmdMismatch",		"Skip reported cmd response mismatch. cmd sent = %xh. cmd returned = %xh." },
+	{ kBinaryLogEvent_SkipInitFailed,		"SkipInitFailed",		"SKIP_CMD_ID_INIT failed with response %xh." },
+	{ kBinaryLogEvent_MeasurementPacket,	"MeasurementPacket",	"Measurement packet: %u measurements, rolling counter %u." },
+	{ kBinaryLogEvent_RollingCounterGap,	"RollingCounterGap",	"Measurement rolling counter gap: expected %u, got %u." },
+	{ kBinaryLogEvent_CmdRespPacket,		"CmdRespPacket",		"Cmd response packet: header %02xh, cmd %02xh." },
+	{ kBinaryLogEvent_PacketsDropped,		"PacketsDropped",		"%u packets dropped because the queue was full." },
+	{ kBinaryLogEvent_MeasurementQueueFull,	"MeasurementQueueFull",	"Measurement queue full, overflow policy %u, waited %u ms for space." }
+};
+
+volatile int GBinaryLog::m_nThreshold = GBINARYLOG_DISABLED;
+FILE *GBinaryLog::m_pFile = NULL;
+bool GBinaryLog::m_bWriteFailed = false;
+OSMutex GBinaryLog::m_pRingsMutex = NULL;
+OSEvent GBinaryLog::m_pWakeWriterEvent = NULL;
+GLiteThread *GBinaryLog::m_pWriterThread = NULL;
+volatile bool GBinaryLog::m_bStopWriter = false;
+
+//Rings are never deleted, because a thread may still be writing to its ring after the log is closed.
+//Rings belonging to threads that have exited are reused by new threads.
+static std::vector<GBinaryLogRing *> binaryLogRings;
+static unsigned int nNumBinaryLogThreads = 0;
+
+//Windows does not tell us when a thread exits, so rings are not reused there.
+static OSThreadLocal binaryLogRingKey;
+static bool bBinaryLogRingKeyCreated = false;
+
+static void OnBinaryLogThreadExit(void *pRing)
+{
+	((GBinaryLogRing *) pRing)->bThreadExited = true;
+}
+
+static void PutLittleEndian(unsigned char *pDest, unsigned long long value, int nBytes)
+{
+	for (int i = 0; i < nBytes; i++)
+	{
+		pDest[i] = (unsigned char) (value & 0xFF);
+		value = value >> 8;
+	}
+}
+
+static unsigned long long GetLittleEndian(const unsigned char *pSrc, int nBytes)
+{
+	unsigned long long value = 0;
+	for (int i = nBytes - 1; i >= 0; i--)
+		value = (value << 8) | pSrc[i];
+	return value;
+}
+
+bool GBinaryLog::Open(
+	const cppstring &sFileName,	//[in]
+	int nThreshold)				//[in] only events with severity >= nThreshold are recorded.
+{
+	Close();
+
+	if (NULL == m_pRingsMutex)
+	{
+		m_pRingsMutex = GThread::OSCreateMutex(GSTD_S(""));
+		m_pWakeWriterEvent = GThread::OSCreateEvent();
+		bBinaryLogRingKeyCreated = GThread::OSCreateThreadLocal(&binaryLogRingKey, OnBinaryLogThreadExit);
+	}
+
+	unsigned char header[GBINARYLOG_HEADER_SIZE];
+	memset(header, 0, sizeof(header));
+	memcpy(header, GBINARYLOG_SIGNATURE, 8);
+	PutLittleEndian(&header[8], GBINARYLOG_VERSION, 4);
+	PutLittleEndian(&header[16], (unsigned long long) time(NULL), 8);
+	PutLittleEndian(&header[24], GUtils::OSGetTimeStampMicroseconds(), 8);
+
+	if (m_pRingsMutex && m_pWakeWriterEvent)
+		m_pFile = fopen(sFileName.c_str(), "wb");
+	if (m_pFile && (1 != fwrite(header, sizeof(header), 1, m_pFile)))
+	{
+		fclose(m_pFile);
+		m_pFile = NULL;
+	}
+
+	if (m_pFile)
+	{
+		m_bWriteFailed = false;
+		m_bStopWriter = false;
+
+		//Discard anything recorded after the previous log was closed.
+		if (GThread::OSLockMutex(m_pRingsMutex))
+		{
+			for (size_t i = 0; i < binaryLogRings.size(); i++)
+				binaryLogRings[i]->nTail = binaryLogRings[i]->nHead;
+			GThread::OSUnlockMutex(m_pRingsMutex);
+		}
+
+		m_pWriterThread = new GLiteThread((StdThreadFunctionPtr) WriterThreadFunc, (StdThreadFunctionPtr) StopWriterThreadFunc, NULL);
+		if (!m_pWriterThread->OSStartThread())
+		{
+			delete m_pWriterThread;
+			m_pWriterThread = NULL;
+			fclose(m_pFile);
+			m_pFile = NULL;
+		}
+	}
+
+	if (m_pFile)
+	{
+		GThread::OSMemoryBarrier();
+		m_nThreshold = nThreshold;
+	}
+	else
+	{
+		cppsstream ss;
+		ss << GSTD_S("GBinaryLog::Open() could not create '") << sFileName << GSTD_S("'.");
+		GSTD_TRACE(ss.str());
+	}
+
+	return (NULL != m_pFile);
+}
+
+void GBinaryLog::Close(void)
+{
+	m_nThreshold = GBINARYLOG_DISABLED;
+
+	if (m_pWriterThread)
+	{
+		delete m_pWriterThread;//Stops the thread, which drains the rings on the way out.
+		m_pWriterThread = NULL;
+	}
+
+	if (m_pFile)
+		fclose(m_pFile);
+	m_pFile = NULL;
+}
+
+void GBinaryLog::Record(
+	int nSeverity,			//[in]
+	int nEventId,			//[in] EBinaryLogEvent
+	unsigned int arg0,		//[in]
+	unsigned int arg1,		//[in]
+	unsigned int arg2,		//[in]
+	unsigned int arg3)		//[in]
+{
+	GBinaryLogRing *pRing = GetThreadRing();
+	if (pRing)
+	{
+		unsigned int nHead = pRing->nHead;
+		unsigned int nNumQueued = nHead - pRing->nTail;
+		if (nNumQueued >= GBINARYLOG_RING_SIZE)
+			GThread::OSAtomicAdd(&pRing->nNumDropped, 1);
+		else
+		{
+			GBinaryLogRecord *pRecord = &pRing->records[nHead & (GBINARYLOG_RING_SIZE - 1)];
+			pRecord->timeUs = GUtils::OSGetTimeStampMicroseconds();
+			pRecord->eventId = (unsigned short) nEventId;
+			pRecord->severity = (unsigned char) nSeverity;
+			pRecord->reserved = 0;
+			pRecord->threadIndex = pRing->nThreadIndex;
+			pRecord->args[0] = arg0;
+			pRecord->args[1] = arg1;
+			pRecord->args[2] = arg2;
+			pRecord->args[3] = arg3;
+
+			//Publish the record only after it is complete.
+			GThread::OSMemoryBarrier();
+			pRing->nHead = nHead + 1;
+
+			//Wake the writer early rather than let a busy thread fill its ring.
+			if (nNumQueued == (GBINARYLOG_RING_SIZE/2))
+				GThread::OSSetEvent(m_pWakeWriterEvent);
+		}
+	}
+}
+
+GBinaryLogRing *GBinaryLog::GetThreadRing(void)
+{
+	if (!bBinaryLogRingKeyCreated)
+		return NULL;
+	GBinaryLogRing *pRing = (GBinaryLogRing *) GThread::OSGetThreadLocal(binaryLogRingKey);
+
+	if ((NULL == pRing) && GThread::OSLockMutex(m_pRingsMutex))
+	{
+		for (size_t i = 0; i < binaryLogRings.size(); i++)
+		{
+			if (binaryLogRings[i]->bFree)
+			{
+				pRing = binaryLogRings[i];
+				break;
+			}
+		}
+
+		if (NULL == pRing)
+		{
+			pRing = new GBinaryLogRing;
+			pRing->nHead = 0;
+			pRing->nTail = 0;
+			binaryLogRings.push_back(pRing);
+		}
+		pRing->nNumDropped = 0;
+		pRing->nThreadIndex = ++nNumBinaryLogThreads;
+		pRing->bThreadExited = false;
+		pRing->bFree = false;
+
+		GThread::OSUnlockMutex(m_pRingsMutex);
+
+		GThread::OSSetThreadLocal(binaryLogRingKey, pRing);
+		Record(TRACE_SEVERITY_HIGH, kBinaryLogEvent_ThreadStart, GThread::OSGetCurrentThreadId());
+	}
+
+	return pRing;
+}
+
+void GBinaryLog::WriteRecord(const GBinaryLogRecord *pRecord)
+{
+	if (m_pFile && !m_bWriteFailed)
+	{
+		unsigned char buf[GBINARYLOG_RECORD_SIZE];
+		PutLittleEndian(&buf[0], pRecord->timeUs, 8);
+		PutLittleEndian(&buf[8], pRecord->eventId, 2);
+		buf[10] = pRecord->severity;
+		buf[11] = 0;
+		PutLittleEndian(&buf[12], pRecord->threadIndex, 4);
+		for (int i = 0; i < GBINARYLOG_MAX_ARGS; i++)
+			PutLittleEndian(&buf[16 + 4*i], pRecord->args[i], 4);
+
+		if (1 != fwrite(buf, sizeof(buf), 1, m_pFile))
+		{
+			m_bWriteFailed = true;
+			GSTD_TRACE(GSTD_S("GBinaryLog::WriteRecord() write failed, logging stopped."));
+		}
+	}
+}
+
+void GBinaryLog::DrainRings(void)
+{
+	if (GThread::OSLockMutex(m_pRingsMutex))
+	{
+		for (size_t i = 0; i < binaryLogRings.size(); i++)
+		{
+			GBinaryLogRing *pRing = binaryLogRings[i];
+			if (pRing->bFree)
+				continue;
+
+			//Read the thread exit flag first, so that every record it wrote is visible below.
+			bool bThreadExited = pRing->bThreadExited;
+			GThread::OSMemoryBarrier();
+			unsigned int nHead = pRing->nHead;
+			GThread::OSMemoryBarrier();
+			for (unsigned int nTail = pRing->nTail; nTail != nHead; nTail++)
+				WriteRecord(&pRing->records[nTail & (GBINARYLOG_RING_SIZE - 1)]);
+			GThread::OSMemoryBarrier();
+			pRing->nTail = nHead;
+
+			int nNumDropped = pRing->nNumDropped;
+			if (nNumDropped > 0)
+			{
+				GThread::OSAtomicAdd(&pRing->nNumDropped, -nNumDropped);
+
+				GBinaryLogRecord record;
+				memset(&record, 0, sizeof(record));
+				record.timeUs = GUtils::OSGetTimeStampMicroseconds();
+				record.eventId = kBinaryLogEvent_EventsDropped;
+				record.severity = TRACE_SEVERITY_HIGH;
+				record.args[0] = nNumDropped;
+				record.args[1] = pRing->nThreadIndex;
+				WriteRecord(&record);
+			}
+
+			if (bThreadExited)
+				pRing->bFree = true;
+		}
+
+		GThread::OSUnlockMutex(m_pRingsMutex);
+	}
+
+	if (m_pFile)
+		fflush(m_pFile);
+}
+
+int GBinaryLog::WriterThreadFunc(void * /* pParam */)
+{
+	int nIOThreadPolicy = 0;
+	while (!m_bStopWriter)
+	{
+		GThread::ApplyIOThreadPolicy(&nIOThreadPolicy);
+		DrainRings();
+		GThread::OSWaitEvent(m_pWakeWriterEvent, 50);
+	}
+	DrainRings();
+
+	return 0;
+}
+
+int GBinaryLog::StopWriterThreadFunc(void * /* pParam */)
+{
+	m_bStopWriter = true;
+	GThread::OSSetEvent(m_pWakeWriterEvent);
+	return 0;
+}
+
+const char *GBinaryLog::GetEventName(int nEventId)
+{
+	for (size_t i = 0; i < (sizeof(binaryLogEventDescs)/sizeof(binaryLogEventDescs[0])); i++)
+	{
+		if (binaryLogEventDescs[i].nEventId == nEventId)
+			return binaryLogEventDescs[i].pName;
+	}
+	return NULL;
+}
+
+const char *GBinaryLog::GetEventFormat(int nEventId)
+{
+	for (size_t i = 0; i < (sizeof(binaryLogEventDescs)/sizeof(binaryLogEventDescs[0])); i++)
+	{
+		if (binaryLogEventDescs[i].nEventId == nEventId)
+			return binaryLogEventDescs[i].pFormat;
+	}
+	return NULL;
+}
+
+GBinaryLogReader::GBinaryLogReader()
+{
+	m_pFile = NULL;
+	m_startTime = 0;
+	m_startTimeUs = 0;
+}
+
+GBinaryLogReader::~GBinaryLogReader()
+{
+	Close();
+}
+
+bool GBinaryLogReader::Open(const cppstring &sFileName)
+{
+	bool bResult = false;
+	Close();
+
+	m_pFile = fopen(sFileName.c_str(), "rb");
+	if (m_pFile)
+	{
+		unsigned char header[GBINARYLOG_HEADER_SIZE];
+		if ((1 == fread(header, sizeof(header), 1, m_pFile)) &&
+			(0 == memcmp(header, GBINARYLOG_SIGNATURE, 8)) &&
+			(GBINARYLOG_VERSION == GetLittleEndian(&header[8], 4)))
+		{
+			m_startTime = GetLittleEndian(&header[16], 8);
+			m_startTimeUs = GetLittleEndian(&header[24], 8);
+			bResult = true;
+		}
+	}
+
+	if (!bResult)
+		Close();
+
+	return bResult;
+}
+
+void GBinaryLogReader::Close(void)
+{
+	if (m_pFile)
+		fclose(m_pFile);
+	m_pFile = NULL;
+}
+
+bool GBinaryLogReader::ReadRecord(GBinaryLogRecord *pRecord)
+{
+	unsigned char buf[GBINARYLOG_RECORD_SIZE];
+	if ((NULL == m_pFile) || (1 != fread(buf, sizeof(buf), 1, m_pFile)))
+		return false;
+
+	pRecord->timeUs = GetLittleEndian(&buf[0], 8);
+	pRecord->eventId = (unsigned short) GetLittleEndian(&buf[8], 2);
+	pRecord->severity = buf[10];
+	pRecord->reserved = buf[11];
+	pRecord->threadIndex = (unsigned int) GetLittleEndian(&buf[12], 4);
+	for (int i = 0; i < GBINARYLOG_MAX_ARGS; i++)
+		pRecord->args[i] = (unsigned int) GetLittleEndian(&buf[16 + 4*i], 4);
+
+	return true;
+}
+
+#ifdef LIB_NAMESPACE
+}
+#endif
@@ -0,0 +1,166 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GBinaryLog.h
+//
+// GBinaryLog is a low overhead event log for the acquisition paths. Each event is a fixed size binary record
+// (event id, severity, time stamp and up to 4 integer arguments) that is copied into a ring owned by the calling
+// thread, without locks or formatting. A background writer thread drains the rings to a file, and the
+// GoIO_LogDecode tool turns the file into text later, using the format strings listed in GBinaryLog.cpp.
+//
+// Use GSTD_BINLOG() to record events, so the severity check happens before the arguments are even evaluated.
+// If a ring fills up because the writer thread falls behind, further events from that thread are counted and
+// discarded, and the writer records a kBinaryLogEvent_EventsDropped event in their place.
+//
+// File layout(all multi-byte fields are little endian):
+//		header(32 bytes):
+//			signature		8 bytes, "GOIOBLG1"
+//			version			4 bytes, currently 1
+//			reserved		4 bytes
+//			start time		8 bytes, host wall clock time when the log was opened, in seconds since 1970
+//			start time us	8 bytes, GUtils::OSGetTimeStampMicroseconds() when the log was opened
+//		followed by one 32 byte record per event:
+//			time us			8 bytes, GUtils::OSGetTimeStampMicroseconds() when the event was recorded
+//			event id		2 bytes, see EBinaryLogEvent
+//			severity		1 byte, TRACE_SEVERITY_*
+//			reserved		1 byte
+//			thread index	4 bytes, small integer assigned to each thread when it records its first event
+//			args			4 x 4 bytes
+// Records from different threads are not in time order in the file.
+
+#ifndef _GBINARYLOG_H_
+#define _GBINARYLOG_H_
+
+#include <stdio.h>
+#include "GTypes.h"
+#include "GThread.h"
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+#define GBINARYLOG_SIGNATURE "GOIOBLG1"
+#define GBINARYLOG_VERSION 1
+#define GBINARYLOG_HEADER_SIZE 32
+#define GBINARYLOG_RECORD_SIZE 32
+#define GBINARYLOG_MAX_ARGS 4
+#define GBINARYLOG_RING_SIZE 1024 //records per thread, must be a power of 2.
+#define GBINARYLOG_DISABLED 0x7FFFFFFF //threshold when the log is closed.
+
+enum EBinaryLogEvent
+{
+	kBinaryLogEvent_ThreadStart = 1,		//OS thread id
+	kBinaryLogEvent_EventsDropped,			//# of events, thread index they were dropped from
+	kBinaryLogEvent_SkipCmdSent,			//cmd, params 0-3, params 4-6, result
+	kBinaryLogEvent_SkipCmdWriteFailed,		//cmd
+	kBinaryLogEvent_SkipCmdTimeout,			//cmd
+	kBinaryLogEvent_SkipCmdErrorResponse,	//cmd, error status
+	kBinaryLogEvent_SkipCmdMismatch,		//cmd sent, cmd returned
+	kBinaryLogEvent_SkipInitFailed,			//error status, 0 if no response arrived
+	kBinaryLogEvent_MeasurementPacket,		//# of measurements, rolling counter
+	kBinaryLogEvent_RollingCounterGap,		//expected rolling counter, actual rolling counter
+	kBinaryLogEvent_CmdRespPacket,			//header, cmd
+	kBinaryLogEvent_PacketsDropped,			//# of packets discarded because a queue was full
+	kBinaryLogEvent_MeasurementQueueFull,	//overflow policy, ms spent waiting for space
+	kBinaryLogEvent_NumEvents
+};
+
+struct GBinaryLogRecord
+{
+	unsigned long long	timeUs;
+	unsigned short		eventId;
+	unsigned char		severity;
+	unsigned char		reserved;
+	unsigned int		threadIndex;
+	unsigned int		args[GBINARYLOG_MAX_ARGS];
+};
+
+struct GBinaryLogRing;
+
+class GBinaryLog
+{
+public:
+	// Start logging events with severity >= nThreshold to sFileName, replacing any log that is already open.
+	static bool			Open(const cppstring &sFileName, int nThreshold);
+	// Stop logging, write out the events that are still queued, and close the file.
+	static void			Close(void);
+	static bool			IsOpen(void) { return (m_nThreshold != GBINARYLOG_DISABLED); }
+
+	// Use GSTD_BINLOG() rather than calling this directly.
+	static void			Record(int nSeverity, int nEventId, unsigned int arg0 = 0, unsigned int arg1 = 0, 
+							unsigned int arg2 = 0, unsigned int arg3 = 0);
+
+	static const char *	GetEventName(int nEventId);//NULL if nEventId is unknown.
+	static const char *	GetEventFormat(int nEventId);//printf style format for the 4 args, NULL if nEventId is unknown.
+
+	static volatile int	m_nThreshold;
+
+private:
+	static GBinaryLogRing *	GetThreadRing(void);
+	static void			DrainRings(void);
+	static void			WriteRecord(const GBinaryLogRecord *pRecord);
+	static int			WriterThreadFunc(void *pParam);
+	static int			StopWriterThreadFunc(void *pParam);
+
+	static FILE *		m_pFile;
+	static bool			m_bWriteFailed;
+	static OSMutex		m_pRingsMutex;
+	static OSEvent		m_pWakeWriterEvent;
+	static GLiteThread *	m_pWriterThread;
+	static volatile bool	m_bStopWriter;
+};
+
+class GBinaryLogReader
+{
+public:
+						GBinaryLogReader();
+						~GBinaryLogReader();
+
+	bool				Open(const cppstring &sFileName);//Reads and validates the header.
+	void				Close(void);
+
+	unsigned long long	GetStartTime(void) { return m_startTime; }
+	unsigned long long	GetStartTimeUs(void) { return m_startTimeUs; }
+
+	// Read the next record, return false at the end of the file(or if the file is truncated).
+	bool				ReadRecord(GBinaryLogRecord *pRecord);
+
+private:
+	FILE *				m_pFile;
+	unsigned long long	m_startTime;
+	unsigned long long	m_startTimeUs;
+};
+
+// Record an event if nSeverity passes the threshold. The arguments are not evaluated otherwise.
+#define GSTD_BINLOG(severity, eventId, arg0, arg1, arg2, arg3) if ((severity) >= GBinaryLog::m_nThreshold) GBinaryLog::Record((severity), (eventId), (arg0), (arg1), (arg2), (arg3))
+
+#ifdef LIB_NAMESPACE
+}
+#endif
+
+#endif // _GBINARYLOG_H_
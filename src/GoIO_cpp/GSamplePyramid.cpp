@@ -0,0 +1,362 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSamplePyramid.cpp
+
+#include "stdafx.h"
+#include "GSamplePyramid.h"
+
+#ifdef _DEBUG
+#include "GPlatformDebug.h" // for DEBUG_NEW definition
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+GSamplePyramid::GSamplePyramid(
+	int nBaseLevel /* = 0 */,				//[in] log2 of the slots per bucket at the finest level kept.
+	unsigned long long nMaxSamples /* = 0 */)//[in] 0 to keep everything.
+{
+	if (nBaseLevel < 0)
+		nBaseLevel = 0;
+	if (nBaseLevel > GSAMPLEPYRAMID_MAX_LEVEL)
+		nBaseLevel = GSAMPLEPYRAMID_MAX_LEVEL;
+	m_nBaseLevel = nBaseLevel;
+	m_nMaxSamples = nMaxSamples;
+	Clear(0);
+}
+
+void GSamplePyramid::Clear(
+	unsigned long long firstSampleIndex /* = 0 */)	//[in]
+{
+	m_firstSampleIndex = firstSampleIndex;
+	m_nextSampleIndex = firstSampleIndex;
+	m_levels.clear();
+	m_firstBuckets.clear();
+	AddLevel();
+}
+
+void GSamplePyramid::SetMaxSamples(unsigned long long nMaxSamples)
+{
+	m_nMaxSamples = nMaxSamples;
+	DropOldBuckets();
+}
+
+void GSamplePyramid::MergeCell(
+	GSamplePyramidCell *pCell,	//[in,out]
+	real fMin,					//[in]
+	real fMax,					//[in]
+	real fSum,					//[in]
+	unsigned int nNumSamples)	//[in]
+{
+	if (0 == nNumSamples)
+		return;
+
+	if (0 == pCell->nNumSamples)
+	{
+		pCell->fMin = fMin;
+		pCell->fMax = fMax;
+	}
+	else
+	{
+		if (fMin < pCell->fMin)
+			pCell->fMin = fMin;
+		if (fMax > pCell->fMax)
+			pCell->fMax = fMax;
+	}
+	pCell->fSum += fSum;
+	pCell->nNumSamples += nNumSamples;
+}
+
+void GSamplePyramid::AddLevel(void)
+{
+	size_t nLevel = m_levels.size();
+	m_levels.push_back(std::deque<GSamplePyramidCell>());
+	if (0 == nLevel)
+	{
+		m_firstBuckets.push_back(m_firstSampleIndex >> m_nBaseLevel);
+		return;
+	}
+
+	//Derive the new level from the one below it, which still holds everything that the new level covers.
+	const std::deque<GSamplePyramidCell> &below = m_levels[nLevel - 1];
+	std::deque<GSamplePyramidCell> &cells = m_levels[nLevel];
+	unsigned long long firstBucket = m_firstBuckets[nLevel - 1] >> 1;
+	m_firstBuckets.push_back(firstBucket);
+	GSamplePyramidCell empty;
+	memset(&empty, 0, sizeof(empty));
+	for (size_t i = 0; i < below.size(); i++)
+	{
+		size_t nCell = (size_t) (((m_firstBuckets[nLevel - 1] + i) >> 1) - firstBucket);
+		while (cells.size() <= nCell)
+			cells.push_back(empty);
+		MergeCell(&cells[nCell], below[i].fMin, below[i].fMax, below[i].fSum, below[i].nNumSamples);
+	}
+}
+
+void GSamplePyramid::GrowLevels(unsigned long long sampleIndex)
+{
+	while ((GetTopLevel() < GSAMPLEPYRAMID_MAX_LEVEL) && 
+		((sampleIndex >> GetTopLevel()) != (m_firstSampleIndex >> GetTopLevel())))
+		AddLevel();
+}
+
+void GSamplePyramid::AddToLevels(
+	unsigned long long sampleIndex,	//[in] of the first slot added, which must be at or after GetNextSampleIndex().
+	real fMin,						//[in]
+	real fMax,						//[in]
+	real fSum,						//[in]
+	unsigned int nNumSamples)		//[in] all in the same base level bucket.
+{
+	GrowLevels(sampleIndex);
+
+	GSamplePyramidCell empty;
+	memset(&empty, 0, sizeof(empty));
+	for (size_t i = 0; i < m_levels.size(); i++)
+	{
+		std::deque<GSamplePyramidCell> &cells = m_levels[i];
+		unsigned long long nBucket = sampleIndex >> (m_nBaseLevel + i);
+		if (0 == cells.size())
+			m_firstBuckets[i] = nBucket;
+		while ((m_firstBuckets[i] + cells.size()) <= nBucket)
+			cells.push_back(empty);
+		MergeCell(&cells.back(), fMin, fMax, fSum, nNumSamples);
+	}
+}
+
+void GSamplePyramid::DropOldBuckets(void)
+{
+	if ((0 == m_nMaxSamples) || (m_nextSampleIndex <= m_nMaxSamples) || 
+		((m_nextSampleIndex - m_nMaxSamples) <= m_firstSampleIndex))
+		return;
+
+	m_firstSampleIndex = m_nextSampleIndex - m_nMaxSamples;
+	for (size_t i = 0; i < m_levels.size(); i++)
+	{
+		std::deque<GSamplePyramidCell> &cells = m_levels[i];
+		int nShift = m_nBaseLevel + (int) i;
+		while ((cells.size() > 0) && (((m_firstBuckets[i] + 1) << nShift) <= m_firstSampleIndex))
+		{
+			cells.pop_front();
+			m_firstBuckets[i]++;
+		}
+	}
+}
+
+void GSamplePyramid::AddSamples(
+	const real *pValues,	//[in]
+	int nNumValues)			//[in]
+{
+	//Summarize the values a base level bucket at a time, so that the levels are only touched once per bucket.
+	int i = 0;
+	while (i < nNumValues)
+	{
+		unsigned long long bucketEnd = ((m_nextSampleIndex >> m_nBaseLevel) + 1) << m_nBaseLevel;
+		int nNumInBucket = nNumValues - i;
+		if ((unsigned long long) nNumInBucket > (bucketEnd - m_nextSampleIndex))
+			nNumInBucket = (int) (bucketEnd - m_nextSampleIndex);
+
+		real fMin = pValues[i];
+		real fMax = pValues[i];
+		real fSum = 0.0;
+		for (int j = i; j < (i + nNumInBucket); j++)
+		{
+			if (pValues[j] < fMin)
+				fMin = pValues[j];
+			if (pValues[j] > fMax)
+				fMax = pValues[j];
+			fSum += pValues[j];
+		}
+
+		AddToLevels(m_nextSampleIndex, fMin, fMax, fSum, nNumInBucket);
+		m_nextSampleIndex += nNumInBucket;
+		i += nNumInBucket;
+	}
+
+	DropOldBuckets();
+}
+
+void GSamplePyramid::SkipSamples(unsigned long long nNumSlots)
+{
+	if (nNumSlots > 0)
+	{
+		m_nextSampleIndex += nNumSlots;
+		GrowLevels(m_nextSampleIndex - 1);
+		DropOldBuckets();
+	}
+}
+
+void GSamplePyramid::AddBaseBucket(
+	const GSamplePyramidBucket &bucket)	//[in] should start at GetNextSampleIndex(), on a base level bucket boundary.
+{
+	if (bucket.nNumSamples > 0)
+		AddToLevels(m_nextSampleIndex, bucket.fMin, bucket.fMax, bucket.fMean*bucket.nNumSamples, bucket.nNumSamples);
+	SkipSamples(1ULL << m_nBaseLevel);
+}
+
+const GSamplePyramid::GSamplePyramidCell *GSamplePyramid::GetCell(
+	int nLevel,					//[in] kept.
+	unsigned long long nBucket)	//[in]
+{
+	size_t i = (size_t) (nLevel - m_nBaseLevel);
+	const std::deque<GSamplePyramidCell> &cells = m_levels[i];
+	if ((nBucket < m_firstBuckets[i]) || ((nBucket - m_firstBuckets[i]) >= cells.size()))
+		return NULL;
+	const GSamplePyramidCell *pCell = &cells[(size_t) (nBucket - m_firstBuckets[i])];
+	return (pCell->nNumSamples > 0) ? pCell : NULL;
+}
+
+bool GSamplePyramid::GetBucket(
+	int nLevel,						//[in]
+	unsigned long long sampleIndex,	//[in]
+	GSamplePyramidBucket *pBucket)	//[out]
+{
+	if ((nLevel < m_nBaseLevel) || (nLevel > GetTopLevel()))
+		return false;
+
+	unsigned long long nBucket = sampleIndex >> nLevel;
+	unsigned long long bucketStart = nBucket << nLevel;
+	unsigned long long bucketEnd = bucketStart + (1ULL << nLevel);
+	if ((bucketEnd <= m_firstSampleIndex) || (bucketStart >= m_nextSampleIndex))
+		return false;
+
+	const GSamplePyramidCell *pCell = GetCell(nLevel, nBucket);
+	pBucket->firstSampleIndex = bucketStart;
+	pBucket->nNumSamples = pCell ? pCell->nNumSamples : 0;
+	pBucket->fMin = pCell ? pCell->fMin : 0.0;
+	pBucket->fMax = pCell ? pCell->fMax : 0.0;
+	pBucket->fMean = pCell ? (pCell->fSum/pCell->nNumSamples) : 0.0;
+	return true;
+}
+
+void GSamplePyramid::GetBuckets(
+	int nLevel,									//[in]
+	unsigned long long firstSampleIndex,		//[in]
+	unsigned long long lastSampleIndex,			//[in] inclusive.
+	std::vector<GSamplePyramidBucket> *pBuckets)//[out]
+{
+	pBuckets->clear();
+	if ((nLevel < m_nBaseLevel) || (nLevel > GetTopLevel()) || (firstSampleIndex > lastSampleIndex))
+		return;
+
+	GSamplePyramidBucket bucket;
+	for (unsigned long long nBucket = firstSampleIndex >> nLevel; nBucket <= (lastSampleIndex >> nLevel); nBucket++)
+	{
+		if (GetBucket(nLevel, nBucket << nLevel, &bucket))
+			pBuckets->push_back(bucket);
+	}
+}
+
+int GSamplePyramid::ChooseLevel(
+	unsigned long long nNumSlots,	//[in]
+	int nMaxBuckets)				//[in]
+{
+	//A range of n slots touches at most ((n - 1) >> level) + 2 buckets.
+	int nLevel = 0;
+	if (nNumSlots > 0)
+	{
+		while ((nLevel < GSAMPLEPYRAMID_MAX_LEVEL) && ((((nNumSlots - 1) >> nLevel) + 2) > (unsigned long long) nMaxBuckets))
+			nLevel++;
+	}
+	return nLevel;
+}
+
+int GSamplePyramid::GetEnvelope(
+	unsigned long long firstSampleIndex,		//[in]
+	unsigned long long lastSampleIndex,			//[in] inclusive.
+	int nMaxBuckets,							//[in] e.g. the width of the plot in pixels.
+	std::vector<GSamplePyramidBucket> *pBuckets)//[out]
+{
+	if (firstSampleIndex < m_firstSampleIndex)
+		firstSampleIndex = m_firstSampleIndex;
+	if (lastSampleIndex >= m_nextSampleIndex)
+		lastSampleIndex = m_nextSampleIndex - 1;
+
+	int nLevel = m_nBaseLevel;
+	if ((m_nextSampleIndex > m_firstSampleIndex) && (firstSampleIndex <= lastSampleIndex))
+		nLevel = ChooseLevel(lastSampleIndex - firstSampleIndex + 1, nMaxBuckets);
+	if (nLevel < m_nBaseLevel)
+		nLevel = m_nBaseLevel;
+	if (nLevel > GetTopLevel())
+		nLevel = GetTopLevel();
+
+	if (m_nextSampleIndex > m_firstSampleIndex)
+		GetBuckets(nLevel, firstSampleIndex, lastSampleIndex, pBuckets);
+	else
+		pBuckets->clear();
+	return nLevel;
+}
+
+bool GSamplePyramid::GetRange(
+	unsigned long long firstSampleIndex,	//[in]
+	unsigned long long lastSampleIndex,		//[in] inclusive.
+	GSamplePyramidBucket *pRange)			//[out] firstSampleIndex is set to the clipped start of the range.
+{
+	if (firstSampleIndex < m_firstSampleIndex)
+		firstSampleIndex = m_firstSampleIndex;
+	if ((m_nextSampleIndex > 0) && (lastSampleIndex >= m_nextSampleIndex))
+		lastSampleIndex = m_nextSampleIndex - 1;
+	if ((m_nextSampleIndex <= m_firstSampleIndex) || (firstSampleIndex > lastSampleIndex))
+		return false;
+
+	//Walk along the range taking the largest aligned bucket that fits each time, as in a segment tree.
+	GSamplePyramidCell range;
+	memset(&range, 0, sizeof(range));
+	unsigned long long sampleIndex = firstSampleIndex;
+	int nTopLevel = GetTopLevel();
+	while (sampleIndex <= lastSampleIndex)
+	{
+		int nLevel = m_nBaseLevel;
+		while ((nLevel < nTopLevel) && (0 == (sampleIndex & ((2ULL << nLevel) - 1))) &&
+			((sampleIndex + (2ULL << nLevel) - 1) <= lastSampleIndex))
+			nLevel++;
+
+		const GSamplePyramidCell *pCell = GetCell(nLevel, sampleIndex >> nLevel);
+		if (pCell)
+			MergeCell(&range, pCell->fMin, pCell->fMax, pCell->fSum, pCell->nNumSamples);
+
+		unsigned long long nextIndex = ((sampleIndex >> nLevel) + 1) << nLevel;
+		if (nextIndex <= sampleIndex)
+			break;//wrapped around.
+		sampleIndex = nextIndex;
+	}
+
+	pRange->firstSampleIndex = firstSampleIndex;
+	pRange->nNumSamples = range.nNumSamples;
+	pRange->fMin = range.fMin;
+	pRange->fMax = range.fMax;
+	pRange->fMean = (range.nNumSamples > 0) ? (range.fSum/range.nNumSamples) : 0.0;
+	return true;
+}
+
+#ifdef LIB_NAMESPACE
+}
+#endif
@@ -0,0 +1,126 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSamplePyramid.h
+//
+// Min/max/mean summaries of a stream of samples at every power of two: a level k bucket summarizes the 2^k sample
+// slots from a multiple of 2^k on. Slots without a sample(e.g. lost measurements) are skipped, so every bucket
+// counts the samples that it summarizes. The buckets are updated as samples arrive, so a plot at any zoom can fetch
+// about one bucket per pixel, in time proportional to the plot width rather than to the number of samples.
+
+#ifndef _GSAMPLEPYRAMID_H_
+#define _GSAMPLEPYRAMID_H_
+
+#include <deque>
+#include "GTypes.h"
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+#define GSAMPLEPYRAMID_MAX_LEVEL 62
+
+struct GSamplePyramidBucket
+{
+	unsigned long long	firstSampleIndex;
+	unsigned int		nNumSamples;//0 if every slot in the bucket is empty, and then the values are meaningless.
+	real				fMin;
+	real				fMax;
+	real				fMean;
+};
+
+class GSamplePyramid
+{
+public:
+	// Levels below nBaseLevel are not kept. If nMaxSamples > 0, buckets are dropped once they end more than 
+	// nMaxSamples slots before the next sample, e.g. to match a circular buffer of the most recent samples.
+						GSamplePyramid(int nBaseLevel = 0, unsigned long long nMaxSamples = 0);
+
+	void				Clear(unsigned long long firstSampleIndex = 0);//the next sample gets firstSampleIndex.
+	void				SetMaxSamples(unsigned long long nMaxSamples);
+	void				AddSamples(const real *pValues, int nNumValues);
+	void				AddSample(real value) { AddSamples(&value, 1); }
+	void				SkipSamples(unsigned long long nNumSlots);//empty slots.
+	// Add a summary of the next 2^GetBaseLevel() slots, e.g. one read back from a file. firstSampleIndex is ignored.
+	void				AddBaseBucket(const GSamplePyramidBucket &bucket);
+
+	int					GetBaseLevel(void) { return m_nBaseLevel; }
+	int					GetTopLevel(void) { return m_nBaseLevel + ((int) m_levels.size()) - 1; }//one bucket covers all.
+	unsigned long long	GetFirstSampleIndex(void) { return m_firstSampleIndex; }//of the oldest slot summarized.
+	unsigned long long	GetNextSampleIndex(void) { return m_nextSampleIndex; }
+
+	// Get the bucket that holds sampleIndex at nLevel. Returns false if nLevel is not kept, or if the bucket holds
+	// no slots from GetFirstSampleIndex() to GetNextSampleIndex() - 1.
+	bool				GetBucket(int nLevel, unsigned long long sampleIndex, GSamplePyramidBucket *pBucket);
+	// Get the buckets at nLevel that hold firstSampleIndex to lastSampleIndex.
+	void				GetBuckets(int nLevel, unsigned long long firstSampleIndex, unsigned long long lastSampleIndex,
+							std::vector<GSamplePyramidBucket> *pBuckets);
+	// Combine the fewest buckets that exactly cover firstSampleIndex to lastSampleIndex, e.g. for the y range of a
+	// plot. Ends that are not on base level bucket boundaries take in their whole base level bucket. Returns false
+	// if the range holds no kept slots.
+	bool				GetRange(unsigned long long firstSampleIndex, unsigned long long lastSampleIndex, 
+							GSamplePyramidBucket *pRange);
+
+	// Get the buckets that cover firstSampleIndex to lastSampleIndex at the finest level that needs no more than
+	// nMaxBuckets of them(or at the top level). The first and last buckets may extend past the range, and empty
+	// buckets are included so that gaps show. Returns the level.
+	int					GetEnvelope(unsigned long long firstSampleIndex, unsigned long long lastSampleIndex, 
+							int nMaxBuckets, std::vector<GSamplePyramidBucket> *pBuckets);
+
+	// The level GetEnvelope() would pick for a range of nNumSlots slots, for pyramids that start at level 0.
+	static int			ChooseLevel(unsigned long long nNumSlots, int nMaxBuckets);
+
+private:
+	struct GSamplePyramidCell
+	{
+		real			fMin;
+		real			fMax;
+		real			fSum;
+		unsigned int	nNumSamples;
+	};
+
+	static void			MergeCell(GSamplePyramidCell *pCell, real fMin, real fMax, real fSum, unsigned int nNumSamples);
+	const GSamplePyramidCell *GetCell(int nLevel, unsigned long long nBucket);//NULL if the bucket is empty.
+	void				AddToLevels(unsigned long long sampleIndex, real fMin, real fMax, real fSum, unsigned int nNumSamples);
+	void				GrowLevels(unsigned long long sampleIndex);//so that the top level bucket covers sampleIndex.
+	void				AddLevel(void);
+	void				DropOldBuckets(void);
+
+	int					m_nBaseLevel;
+	unsigned long long	m_nMaxSamples;
+	unsigned long long	m_firstSampleIndex;
+	unsigned long long	m_nextSampleIndex;
+	std::vector<std::deque<GSamplePyramidCell> > m_levels;//m_levels[i] holds level m_nBaseLevel + i.
+	std::vector<unsigned long long> m_firstBuckets;//bucket number of m_levels[i].front().
+};
+
+#ifdef LIB_NAMESPACE
+}
+#endif
+
+#endif // _GSAMPLEPYRAMID_H_
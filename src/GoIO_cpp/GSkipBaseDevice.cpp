@@ -1,721 +1,1560 @@
-/*********************************************************************************
-
-Copyright (c) 2010, Vernier Software & Technology
-All rights reserved.
-
-Redistribution and use in source and binary forms, with or without
-modification, are permitted provided that the following conditions are met:
-    * Redistributions of source code must retain the above copyright
-      notice, this list of conditions and the following disclaimer.
-    * Redistributions in binary form must reproduce the above copyright
-      notice, this list of conditions and the following disclaimer in the
-      documentation and/or other materials provided with the distribution.
-    * Neither the name of Vernier Software & Technology nor the
-      names of its contributors may be used to endorse or promote products
-      derived from this software without specific prior written permission.
-
-THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
-ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
-WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
-DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
-(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
-LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
-ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
-(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-**********************************************************************************/
-// GSkipBaseDevice.cpp
-
-#include "stdafx.h"
-#include "GSkipBaseDevice.h"
-#include "GCyclopsDevice.h" //Just used to see if SKIP_CMD_ID_START_MEASUREMENTS is starting real time measurements.
-
-#include "GUtils.h"
-
-#ifdef _DEBUG
-#include "GPlatformDebug.h" // for DEBUG_NEW definition
-#undef THIS_FILE
-static char THIS_FILE[] = __FILE__;
-#endif
-
-#ifdef LIB_NAMESPACE
-namespace LIB_NAMESPACE {
-#endif
-
-real GSkipBaseDevice::kVoltsPerBit_ProbeTypeAnalog5V = 2.5/0x8000;
-real GSkipBaseDevice::kVoltsOffset_ProbeTypeAnalog5V = 2.5;
-real GSkipBaseDevice::kVoltsPerBit_ProbeTypeAnalog10V = 10.0/0x8000;
-real GSkipBaseDevice::kVoltsOffset_ProbeTypeAnalog10V = 0.0;
-
-#define NUM_PACKETS_IN_RETRIEVAL_BUFFER 25
-
-#define DIAGNOSTIC_IO_BUFFER_SIZE 10000
-
-/*******************************************************************************
- GSkipBaseDevice:
-*******************************************************************************/
-GSkipBaseDevice::GSkipBaseDevice(GPortRef *pPortRef)
-: TBaseClass(pPortRef)
-{
-	m_nLatestRawMeasurement = 0;
-    m_bIsMeasuring = false;
-	m_hostIOStatus = 0;
-	m_lastCmd = 0;
-	m_lastCmdRespStatus = 0;
-	m_lastCmdWithErrorRespSentOvertheWire = 0;
-	m_lastErrorSentOvertheWire = 0;
-	m_bDiagnosticsEnabled = false;
-	m_diagnosticInputBufferPtr = NULL;
-	m_diagnosticOutputBufferPtr = NULL;
-	m_pTraceQueueAccessMutex = NULL;
-}
-
-GSkipBaseDevice::~GSkipBaseDevice()
-{
-	if (IsOpen())
-		Close();
-	OSDestroy();
-
-	if (m_diagnosticOutputBufferPtr)
-		delete m_diagnosticOutputBufferPtr;
-	m_diagnosticOutputBufferPtr = NULL;
-
-	if (m_diagnosticInputBufferPtr)
-		delete m_diagnosticInputBufferPtr;
-	m_diagnosticInputBufferPtr = NULL;
-
-	if (m_pTraceQueueAccessMutex)
-		delete m_pTraceQueueAccessMutex;
-	m_pTraceQueueAccessMutex = NULL;
-}
-
-int GSkipBaseDevice::Open(GPortRef *pPortRef)
-{
-	if (m_bDiagnosticsEnabled)
-	{
-		if (!m_pTraceQueueAccessMutex)
-			GSTD_NEW(m_pTraceQueueAccessMutex, (GPriorityMutex *), GPriorityMutex(kThreadPriority_TimeCritical, GSTD_S("")));
-
-		if (m_pTraceQueueAccessMutex->m_OSMutex)
-		{
-			if (!m_diagnosticInputBufferPtr)
-			{
-				GSTD_NEW(m_diagnosticInputBufferPtr, (GCircularBuffer *), GCircularBuffer(DIAGNOSTIC_IO_BUFFER_SIZE));
-				m_diagnosticInputBufferPtr->SetQueueAccessMutex(m_pTraceQueueAccessMutex);
-			}
-
-			if (!m_diagnosticOutputBufferPtr)
-			{
-				GSTD_NEW(m_diagnosticOutputBufferPtr, (GCircularBuffer *), GCircularBuffer(DIAGNOSTIC_IO_BUFFER_SIZE));
-				m_diagnosticOutputBufferPtr->SetQueueAccessMutex(m_pTraceQueueAccessMutex);
-			}
-		}
-	}
-
-	int nResult = TBaseClass::Open(pPortRef);
-
-	return nResult;
-}
-
-int GSkipBaseDevice::OSBytesAvailable(void)
-{
-	GSTD_ASSERT(false); //not used!
-	return 0;
-}
-
-int GSkipBaseDevice::OSRead(void * /*pBuffer*/, int * /*pIONumBytes*/, int /*nBufferSize*/)
-{
-	GSTD_ASSERT(false); //not used!
-	return 0;
-}
-
-int GSkipBaseDevice::OSWrite(void * /*pBuffer*/, int * /*pIONumBytes*/)
-{
-	GSTD_ASSERT(false); //not used!
-	return 0;
-}
-
-int GSkipBaseDevice::MeasurementsAvailable(void)
-{
-	unsigned char nNumMeasurementsInLastPacket;
-	int nNumMeasurements = OSMeasurementPacketsAvailable(&nNumMeasurementsInLastPacket);
-	return (nNumMeasurements*nNumMeasurementsInLastPacket);
-}
-
-intVector GSkipBaseDevice::ReadRawMeasurements(int desiredCount /*=-1*/) // Optional -- can limit the number that will be returned
-{
-	intVector result;
-	int count = desiredCount;
-	GSkipMeasurementPacket packets[NUM_PACKETS_IN_RETRIEVAL_BUFFER];
-
-	if (LockDevice(1) && IsOKToUse())
-	{ // Make sure we're the only thread that has acces to this device
-		int nNumMeasurementsInVec = 0;
-		int nNumPacketsJustRead, nNumPacketsToAskFor;
-		int measurement;
-		if (count < 0)
-			count = MeasurementsAvailable();
-		while (nNumMeasurementsInVec < count)
-		{
-			unsigned char nNumMeasurementsInLastPacket;
-			nNumPacketsToAskFor = OSMeasurementPacketsAvailable(&nNumMeasurementsInLastPacket);
-			if ((nNumMeasurementsInVec + nNumPacketsToAskFor*nNumMeasurementsInLastPacket) > count)
-				nNumPacketsToAskFor = (count - nNumMeasurementsInVec)/nNumMeasurementsInLastPacket;
-			if (0 == nNumPacketsToAskFor)
-				break;
-
-			nNumPacketsJustRead = nNumPacketsToAskFor;
-			OSReadMeasurementPackets(&packets, &nNumPacketsJustRead, NUM_PACKETS_IN_RETRIEVAL_BUFFER);
-
-			if (0 == nNumPacketsJustRead)
-				break;
-			else
-			{
-				int nPacket;
-				for (nPacket = 0; nPacket < nNumPacketsJustRead; nPacket++)
-				{
-					unsigned char nMeasInPacket = 0;
-					unsigned char *pMeasInPacket = &packets[nPacket].meas0LsByte;
-					while (nMeasInPacket < packets[nPacket].nMeasurementsInPacket) //Return all the measurements in the packet.
-					{
-						short shortMeas;
-						GUtils::OSConvertBytesToShort(pMeasInPacket[0], pMeasInPacket[1], &shortMeas);
-						measurement = shortMeas;
-						result.push_back(measurement);
-						nNumMeasurementsInVec++;
-						nMeasInPacket++;
-						pMeasInPacket += 2;
-					}
-				}
-			}
-		}
-
-		if ((desiredCount > 0) && (count > desiredCount))
-			GSTD_TRACE(GSTD_S("ReadRawMeasurements() is returning more measurements than were asked for."));
-
-		UnlockDevice();
-	}
-	else
-		GSTD_ASSERT(0);
-
-	if (result.size() > 0)
-		m_nLatestRawMeasurement = result[result.size() - 1];
-
-	return result;
-}
-
-int	GSkipBaseDevice::GetLatestRawMeasurement()
-{
-	intVector vec;
-	int count = MeasurementsAvailable();
-
-	while (count > 0)
-	{
-		vec = ReadRawMeasurements(200);
-		if (0 == vec.size())
-			break;
-		else
-			count -= vec.size();
-	}
-
-	return m_nLatestRawMeasurement;
-}
-
-int GSkipBaseDevice::SendCmd(
-	unsigned char cmd,	//[in] command code
-	void *pParams,		//[in] ptr to cmd specific parameter block, may be NULL.
-	int nParamBytes)	//[in] # of bytes in (*pParams).
-{
-	int nResult;
-	GSkipOutputPacket packet;
-
-	if (SKIP_CMD_ID_START_MEASUREMENTS == cmd)
-		GSTD_ASSERT((0 == MeasurementsAvailable()) || pParams);
-    else if ((SKIP_CMD_ID_STOP_MEASUREMENTS == cmd) || (SKIP_CMD_ID_INIT == cmd))
-        m_bIsMeasuring = false;
-
-	memset(&packet, 0, sizeof(packet));
-	packet.cmd = cmd;
-	if (pParams != NULL)
-		memcpy(packet.params, pParams, nParamBytes);
-
-	nResult = OSWriteCmdPackets(&packet, 1);
-
-	if (GetDiagnosticOutputBufferPtr())
-		GetDiagnosticOutputBufferPtr()->AddBytes((unsigned char *) &packet, sizeof(packet));
-
-	if (GUtils::IsLogOpen())
-	{
-		cppsstream ssCmd;
-		ssCmd << GSTD_S("Skip cmd sent: ") << hex << ((unsigned short) packet.cmd) << GSTD_S("h ");
-		ssCmd << ((unsigned short) packet.params[0]) << GSTD_S("h ");
-		ssCmd << ((unsigned short) packet.params[1]) << GSTD_S("h ");
-		ssCmd << ((unsigned short) packet.params[2]) << GSTD_S("h ");
-		ssCmd << ((unsigned short) packet.params[3]) << GSTD_S("h ");
-		ssCmd << ((unsigned short) packet.params[4]) << GSTD_S("h "); 
-		ssCmd << ((unsigned short) packet.params[5]) << GSTD_S("h ");
-		ssCmd << ((unsigned short) packet.params[6]) << GSTD_S("h ");
-		GSTD_TRACE(ssCmd.str());
-	}
-
-	if (kResponse_OK != nResult)
-	{
-		cppsstream ss;
-		ss << GSTD_S("Error writing ") << hex << ((unsigned short) cmd) << GSTD_S("h cmd to skip.");
-		GSTD_TRACE(ss.str());
-	}
-
-	return nResult;
-}
-
-int GSkipBaseDevice::GetNextResponse(
-	void *pRespBuf,		//[out] ptr to destination buffer, may be NULL.
-	int *pnRespBytes,  //[in, out] size of of dest buffer on input, size of response on output, may be NULL if pRespBuf is NULL.
-	unsigned char *pCmd,//[out] identifies which command this response is for.
-	bool *pErrRespFlag, //[out] flag indicating that the response contains error info
-	int nTimeoutMs /* = 1000 */,//[in] # of milliseconds to wait before giving up.
-	bool *pExitFlag /* = NULL */)//[in] ptr to flag that another thread can set to force early exit. 
-						//		THIS FLAG MUST BE FALSE FOR THIS ROUTINE TO RUN.
-						//		Ignore this if NULL.
-{
-	int nResult = kResponse_OK;
-	char *pRespCharBuf = static_cast<char *>(pRespBuf);
-	(*pErrRespFlag) = false;
-	GSkipGenericResponsePacket packet;
-	bool bResponseComplete = false;
-	bool bFirstPacketFound = false;
-	int nBufSize = 0;
-	if (pnRespBytes != NULL)
-		nBufSize = (*pnRespBytes);
-	int nRespSize = 0;
-	int nBytesInPacket, nBytesRemainingInBuffer;
-	bool *pMyExitFlag;
-	bool myExitFlag = false;
-	if (NULL == pExitFlag)
-		pMyExitFlag = &myExitFlag;
-	else
-		pMyExitFlag = pExitFlag;
-	unsigned char *packetPayload;
-
-	unsigned int nStartTime = GUtils::OSGetTimeStamp();
-
-	while (((GUtils::OSGetTimeStamp() - nStartTime) <= ((unsigned int) nTimeoutMs)) &&
-			(!(*pMyExitFlag)) &&
-			(!bResponseComplete) &&
-			(kResponse_OK == nResult))
-	{
-		while (	(!bResponseComplete) &&
-				(kResponse_OK == nResult) &&
-				(OSCmdRespPacketsAvailable() > 0))
-		{
-			int transactionPacketCount = 1;
-			nResult = OSReadCmdRespPackets(&packet, &transactionPacketCount, 1);
-			if (kResponse_OK == nResult)
-			{
-				nBytesInPacket = packet.header & SKIP_MASK_CMD_RESP_NUMBYTES ;
-				packetPayload = &packet.cmd;
-				if (packet.header & SKIP_MASK_CMD_RESP_1ST_PACKET_FLAG)
-				{
-					if (nBytesInPacket > 0)
-					{
-						nBytesInPacket--;//Don't copy cmd id into response buffer.
-						packetPayload++;
-						(*pCmd) = packet.cmd;
-					}
-					else
-						(*pCmd) = 0; //This should never happen!!!!
-					if (bFirstPacketFound && (0 == (packet.header & SKIP_MASK_INPUT_PACKET_ERROR_FLAG)))
-						nResult = kResponse_Error; //Two first packets found! - ok if second packet is error packet.
-					bFirstPacketFound = true;
-				}
-				if (packet.header & SKIP_MASK_INPUT_PACKET_ERROR_FLAG)
-				{
-					//Early exit - we have an error packet.
-					bResponseComplete = true;
-					(*pErrRespFlag) = true;
-					nRespSize = min(nBytesInPacket, nBufSize);
-					if (pRespCharBuf && (nRespSize > 0))
-						memcpy(pRespCharBuf, packetPayload, nRespSize);
-
-					m_lastCmdRespStatus = *packetPayload;
-					m_lastCmdWithErrorRespSentOvertheWire = m_lastCmd;
-					m_lastErrorSentOvertheWire = m_lastCmdRespStatus;
-				}
-				if ((!bResponseComplete) && (kResponse_OK == nResult))
-				{
-					//Copy packet payload.
-					nBytesRemainingInBuffer = nBufSize - nRespSize;
-					nBytesInPacket = min(nBytesInPacket, nBytesRemainingInBuffer);
-					if (pRespCharBuf && (nBytesInPacket > 0))
-					{
-						memcpy(&pRespCharBuf[nRespSize], packetPayload, nBytesInPacket);
-						nRespSize += nBytesInPacket;
-					}
-
-					//Is this the last packet?
-					if (packet.header & SKIP_MASK_CMD_RESP_LAST_PACKET_FLAG)
-						bResponseComplete = true;
-				}
-			}
-		}//while
-
-		if ((!bResponseComplete) && (kResponse_OK == nResult))
-			GUtils::Sleep(10);
-	}//while
-
-	if (pnRespBytes)
-		(*pnRespBytes) = nRespSize;
-
-	if ((kResponse_OK == nResult) && (!bResponseComplete))
-		nResult = kResponse_Error; 
-
-	return nResult;
-}
-
-int GSkipBaseDevice::GetInitCmdResponse(
-	void *pRespBuf,		//[out] ptr to destination buffer, may be NULL.
-	int *pnRespBytes,  //[in, out] size of of dest buffer on input, size of response on output, may be NULL if pRespBuf is NULL.
-	int nTimeoutMs /* = 1000 */,//[in] # of milliseconds to wait before giving up.
-	bool *pExitFlag /* = NULL */)//[in] ptr to flag that another thread can set to force early exit. 
-						//		THIS FLAG MUST BE FALSE FOR THIS ROUTINE TO RUN.
-						//		Ignore this if NULL.
-{
-	/* This routine keeps looking at response packets until it sees an INIT cmd response, or times out. */
-	/* Skip will respond to an INIT command at almost any time, so this allows us to recover from weird situations. */
-	int nResult = kResponse_OK;
-	GSkipDefaultResponsePacket packet;
-	bool bResponseComplete = false;
-	int nBufSize = 0;
-	if (pnRespBytes != NULL)
-		nBufSize = (*pnRespBytes);
-	int nRespSize = 0;
-	bool *pMyExitFlag;
-	bool myExitFlag = false;
-	if (NULL == pExitFlag)
-		pMyExitFlag = &myExitFlag;
-	else
-		pMyExitFlag = pExitFlag;
-
-	unsigned int nStartTime = GUtils::OSGetTimeStamp();
-
-	while (((GUtils::OSGetTimeStamp() - nStartTime) <= ((unsigned int) nTimeoutMs)) &&
-			(!(*pMyExitFlag)) &&
-			(!bResponseComplete) &&
-			(kResponse_OK == nResult))
-	{
-		while (	(!bResponseComplete) &&
-				(kResponse_OK == nResult) &&
-				(OSCmdRespPacketsAvailable() > 0))
-		{
-			int transactionPacketCount = 1;
-			nResult = OSReadCmdRespPackets(&packet, &transactionPacketCount, 1);
-			if (kResponse_OK == nResult)
-			{
-				if (packet.header & SKIP_INPUT_PACKET_INIT_RESP)
-				{
-					//We found it..
-					bResponseComplete = true;
-					nRespSize = min((unsigned int)sizeof(packet.errorStatus), (unsigned int)nBufSize);
-					if (pRespBuf && (nRespSize > 0))
-						memcpy(pRespBuf, &packet.errorStatus, nRespSize);
-
-					if (packet.header & SKIP_MASK_INPUT_PACKET_ERROR_FLAG)
-					{
-						nResult = kResponse_Error;
-						cppsstream sss;
-						sss << GSTD_S("SKIP_CMD_ID_INIT failed with response ") << hex ;
-						sss << ((unsigned short) packet.errorStatus) << GSTD_S("h.");
-						GSTD_TRACE(sss.str());
-					}
-				}
-			}
-		}//while
-
-		if ((!bResponseComplete) && (kResponse_OK == nResult))
-			GUtils::Sleep(10);
-	}//while
-
-	if (pnRespBytes)
-		(*pnRespBytes) = nRespSize;
-
-	if ((kResponse_OK == nResult) && (!bResponseComplete))
-		nResult = kResponse_Error; 
-
-	if (kResponse_Error == nResult)
-	{
-		cppsstream ss;
-		ss << GSTD_S("Error waiting for response to SKIP_CMD_ID_INIT.");
-		GSTD_TRACE(ss.str());
-	}
-
-	return nResult;
-}
-
-int GSkipBaseDevice::SendCmdAndGetResponse(
-	unsigned char cmd,	//[in] command code
-	void *pParams,		//[in] ptr to cmd specific parameter block, may be NULL.
-	int nParamBytes,	//[in] # of bytes in (*pParams).
-	void *pRespBuf,		//[out] ptr to destination buffer, may be NULL.
-	int *pnRespBytes,  //[in, out] size of of dest buffer on input, size of response on output, may be NULL if pRespBuf is NULL.
-	int nTimeoutMs /* = 1000 */,//[in] # of milliseconds to wait before giving up.
-	bool *pExitFlag /* = NULL */)//[in] ptr to flag that another thread can set to force early exit. 
-						//		THIS FLAG MUST BE FALSE FOR THIS ROUTINE TO RUN.
-						//		Ignore this if NULL.
-{
-	int nResult = kResponse_Error;
-	bool bTimeout = false;
-
-	m_lastCmd = cmd;
-	m_lastCmdRespStatus = 0;
-
-	if (LockDevice(1) && IsOKToUse())
-	{ // Make sure we're the only thread that has access to this device
-		nResult = SendCmd(cmd,	pParams, nParamBytes);
-
-		if (kResponse_OK == nResult)
-		{
-			if (SKIP_CMD_ID_INIT == cmd)
-				nResult = GetInitCmdResponse(pRespBuf,	pnRespBytes, nTimeoutMs, pExitFlag);
-			else
-			{
-				unsigned char responseCmd;
-				bool bError;
-				cppsstream ss;
-				nResult = GetNextResponse(pRespBuf,	pnRespBytes, &responseCmd, &bError, nTimeoutMs, pExitFlag);
-				if (kResponse_OK != nResult)
-				{
-					bTimeout = true;
-					m_hostIOStatus = m_hostIOStatus | SKIP_HOST_IO_STATUS_TIMED_OUT;
-					ss << GSTD_S("Error waiting for response to ") << hex << ((unsigned short) cmd) << GSTD_S("h cmd from Skip. Timeout??");
-					GSTD_TRACE(ss.str());
-					if (pnRespBytes)
-						(*pnRespBytes) = 0;//Only 'over the wire' errors have response data.
-				}
-				else
-				if (bError)
-				{
-					ss << GSTD_S("Skip reported an error over the wire. cmd sent = ") << hex << ((unsigned short) cmd) << GSTD_S("h. Error returned = ");
-					ss << ((unsigned short) m_lastErrorSentOvertheWire) << GSTD_S("h.");
-					GSTD_TRACE(ss.str());
-					nResult = kResponse_Error;
-				}
-				else
-				if (cmd != responseCmd)
-				{
-					ss << GSTD_S("Skip reported cmd response mismatch. cmd sent = ") << hex << ((unsigned short) cmd) << GSTD_S("h. cmd returned = ");
-					ss << ((unsigned short) responseCmd) << GSTD_S("h.");
-					GSTD_TRACE(ss.str());
-					nResult = kResponse_Error;
-					if (pnRespBytes)
-						(*pnRespBytes) = 0;//Only 'over the wire' errors have response data.
-				}
-			}
-		}
-
-		UnlockDevice();
-	}
-	else
-		GSTD_ASSERT(0);	// Can't use this device -- some other thread has it open!
-
-    if (kResponse_OK == nResult)
-    {
-		//Keep track if we are starting measurements.
-	    if (SKIP_CMD_ID_START_MEASUREMENTS == cmd) //Check for STOP in SendCmd().
-			m_bIsMeasuring = true;
-    }
-	else
-	if (bTimeout)
-	{
-		//The Skip/Jonah firmware does not recover from DDS memory failures very well, so we will send an INIT command
-		//if we timed out trying to read or write nonvolatile memory.
-		switch (cmd)
-		{
-			case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_1BYTE:
-			case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_2BYTES:
-			case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_3BYTES:
-			case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_4BYTES:
-			case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_5BYTES:
-			case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_6BYTES:
-			case SKIP_CMD_ID_READ_LOCAL_NV_MEM:
-			case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_1BYTE:
-			case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_2BYTES:
-			case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_3BYTES:
-			case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_4BYTES:
-			case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_5BYTES:
-			case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_6BYTES:
-			case SKIP_CMD_ID_READ_REMOTE_NV_MEM:
-				{
-					bool bWasMeasuring = m_bIsMeasuring;
-					int status2 = SendCmdAndGetResponse(SKIP_CMD_ID_INIT, NULL, 0, NULL, NULL, SKIP_TIMEOUT_MS_CMD_ID_INIT_WO_BUSY_STATUS);
-					if ((kResponse_OK == status2) && bWasMeasuring)
-					{
-						//SKIP_CMD_ID_INIT turned off measurements - turn them back on.
-						OSClearMeasurementPacketQueue();//Not supposed to turn on measurements with old measurements pending.
-						SendCmdAndGetResponse(SKIP_CMD_ID_START_MEASUREMENTS, NULL, 0, NULL, NULL);
-					}
-				}
-				break;
-			default:
-				break;
-		}
-	}
-
-	if ((kResponse_OK != nResult) && (0 == m_lastCmdRespStatus))
-		m_lastCmdRespStatus = SKIP_STATUS_ERROR_COMMUNICATION;
-
-	return nResult;
-}
-
-void GSkipBaseDevice::GetLastCmdResponseStatus(
-	unsigned char *pLastCmd, 
-	unsigned char *pLastCmdStatus,
-	unsigned char *pLastCmdWithErrorRespSentOvertheWire, 
-	unsigned char *pLastErrorSentOvertheWire)
-{
-	*pLastCmd = m_lastCmd;
-	*pLastCmdStatus = m_lastCmdRespStatus;
-	*pLastCmdWithErrorRespSentOvertheWire = m_lastCmdWithErrorRespSentOvertheWire;
-	*pLastErrorSentOvertheWire = m_lastErrorSentOvertheWire;
-}
-
-int GSkipBaseDevice::ReadNonVolatileMemory(
-	bool bLocal,		//[in] Send SKIP_CMD_ID_READ_LOCAL_NV_MEM if true, else send SKIP_CMD_ID_READ_REMOTE_NV_MEM.
-	void *pBuf,			//[out] ptr to destination buffer.
-	unsigned int addr, //[in] addr of the first location in the NV memory to read.
-	unsigned int nBytesToRead,//[in]
-	int nTimeoutMs /* = 1000 */,//[in] # of milliseconds to wait before giving up.
-	bool *pExitFlag /* = NULL */)//[in] ptr to flag that another thread can set to force early exit. 
-						//		THIS FLAG MUST BE FALSE FOR THIS ROUTINE TO RUN.
-						//		Ignore this if NULL.
-{
-	unsigned int nMaxValidAddr = bLocal ? GetMaxLocalNonVolatileMemAddr() : GetMaxRemoteNonVolatileMemAddr();
-	GSTD_ASSERT((addr + nBytesToRead - 1) <= nMaxValidAddr);
-	GSkipReadI2CMemParams params;
-	params.addr = static_cast<unsigned char>(addr);
-	params.count = static_cast<unsigned char>(nBytesToRead);
-	int nBytesRead = nBytesToRead;
-
-	int nResult = SendCmdAndGetResponse(bLocal ? SKIP_CMD_ID_READ_LOCAL_NV_MEM : SKIP_CMD_ID_READ_REMOTE_NV_MEM,
-		&params, sizeof(params), pBuf, &nBytesRead, nTimeoutMs, pExitFlag);
-
-	if ((kResponse_OK == nResult) && (nBytesRead != (int)nBytesToRead))
-		nResult = kResponse_Error;
-
-	return nResult;
-}
-
-int GSkipBaseDevice::WriteNonVolatileMemory(
-	bool bLocal,		//[in] Send SKIP_CMD_ID_WRITE_NV_MEM if true, else send SKIP_CMD_ID_WRITE_REMOTE_NV_MEM
-	void *pBuf,			//[out] ptr to source buffer
-	unsigned int addr, //[in] addr of the first location in the NV memory to write.
-	unsigned int nBytesToWrite,//[in]
-	int nTimeoutMs /* = 1000 */,//[in] # of milliseconds to wait before giving up.
-	bool *pExitFlag /* = NULL */)//[in] ptr to flag that another thread can set to force early exit. 
-						//		THIS FLAG MUST BE FALSE FOR THIS ROUTINE TO RUN.
-						//		Ignore this if NULL.
-{
-	int nResult = kResponse_OK;
-	unsigned int nMaxValidAddr = bLocal ? GetMaxLocalNonVolatileMemAddr() : GetMaxRemoteNonVolatileMemAddr();
-	GSTD_ASSERT((addr + nBytesToWrite - 1) <= nMaxValidAddr);
-	GSkipWriteI2CMemParams params;
-	char *pSrcBuf = static_cast<char *>(pBuf);
-	bool *pMyExitFlag;
-	bool myExitFlag = false;
-	if (NULL == pExitFlag)
-		pMyExitFlag = &myExitFlag;
-	else
-		pMyExitFlag = pExitFlag;
-	unsigned char baseCmd = bLocal ? SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_1BYTE : SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_1BYTE;
-	unsigned char cmd;
-	unsigned int nBytesWritten = 0;
-	unsigned int nBytesToWriteThisPacket;
-
-	unsigned int nStartTime = GUtils::OSGetTimeStamp();
-	unsigned int nCurrentTime = GUtils::OSGetTimeStamp();
-
-	while (((nCurrentTime - nStartTime) <= ((unsigned int) nTimeoutMs)) &&
-			(!(*pMyExitFlag)) &&
-			(nBytesWritten < nBytesToWrite) &&
-			(kResponse_OK == nResult))
-	{
-		nBytesToWriteThisPacket = nBytesToWrite - nBytesWritten;
-		if (nBytesToWriteThisPacket > 6)
-			nBytesToWriteThisPacket = 6;
-		cmd = static_cast<unsigned char>(baseCmd + nBytesToWriteThisPacket - 1);
-		params.addr = static_cast<unsigned char>(addr + nBytesWritten);
-		memcpy(params.payload, &pSrcBuf[nBytesWritten], static_cast<size_t>(nBytesToWriteThisPacket));
-
-		nResult = SendCmdAndGetResponse(cmd, &params, sizeof(params), NULL, NULL, 
-			nTimeoutMs - (nCurrentTime - nStartTime), pMyExitFlag);
-
-		if (kResponse_OK == nResult)
-		{
-			nBytesWritten += nBytesToWriteThisPacket;
-			nCurrentTime = GUtils::OSGetTimeStamp();
-		}
-	}
-
-	if ((kResponse_OK == nResult) && (nBytesWritten != nBytesToWrite))
-		nResult = kResponse_Error;
-
-	return nResult;
-}
-
-int GSkipBaseDevice::SetMeasurementPeriod(real fPeriodInSeconds, int nTimeoutMs/* = 1000*/)
-{
-	GSTD_ASSERT(fPeriodInSeconds >= 0.0);
-	if (fPeriodInSeconds < GetMinimumMeasurementPeriodInSeconds())
-		fPeriodInSeconds = GetMinimumMeasurementPeriodInSeconds();
-	else
-	if (fPeriodInSeconds > GetMaximumMeasurementPeriodInSeconds())
-		fPeriodInSeconds = GetMaximumMeasurementPeriodInSeconds();
-
-	GSkipSetMeasurementPeriodParams params;
-	int	nNumTicks = (int) floor(fPeriodInSeconds/GetMeasurementTickInSeconds() + 0.5);
-	GUtils::OSConvertIntToBytes(nNumTicks, &params.lsbyteLswordMeasurementPeriod, &params.msbyteLswordMeasurementPeriod,
-		&params.lsbyteMswordMeasurementPeriod, &params.msbyteMswordMeasurementPeriod);
-
-	int nResult = SendCmdAndGetResponse(SKIP_CMD_ID_SET_MEASUREMENT_PERIOD, &params, sizeof(params), NULL, NULL, nTimeoutMs);
-
-	return nResult;
-}
-
-real GSkipBaseDevice::GetMeasurementPeriod(int nTimeoutMs/* = 1000*/)
-{
-	real fPeriodInSeconds = 1000000.0;
-	GSkipGetMeasurementPeriodCmdResponsePayload payload;
-	int nBytesRead = sizeof(payload);
-	int nResult = SendCmdAndGetResponse(SKIP_CMD_ID_GET_MEASUREMENT_PERIOD, NULL, 0, &payload, &nBytesRead, nTimeoutMs);
-	if (kResponse_OK == nResult)
-	{
-		int nNumTicks;
-		GUtils::OSConvertBytesToInt(payload.lsbyteLswordMeasurementPeriod, payload.msbyteLswordMeasurementPeriod,
-			payload.lsbyteMswordMeasurementPeriod, payload.msbyteMswordMeasurementPeriod, &nNumTicks);
-
-		fPeriodInSeconds = GetMeasurementTickInSeconds() * nNumTicks;
-	}
-
-	return fPeriodInSeconds;
-}
-
-real GSkipBaseDevice::CalculateNearestLegalMeasurementPeriod(real fPeriodInSeconds)
-{
-	GSTD_ASSERT(fPeriodInSeconds >= 0.0);
-	real fAdjustedPeriod = fPeriodInSeconds;
-	int	nNumTicks = (int) floor(fPeriodInSeconds/GetMeasurementTickInSeconds() + 0.5);
-	fAdjustedPeriod = GetMeasurementTickInSeconds() * nNumTicks;
-
-	if (fAdjustedPeriod < GetMinimumMeasurementPeriodInSeconds())
-		fAdjustedPeriod = GetMinimumMeasurementPeriodInSeconds();
-	else
-	if (fAdjustedPeriod > GetMaximumMeasurementPeriodInSeconds())
-		fAdjustedPeriod = GetMaximumMeasurementPeriodInSeconds();
-
-	return fAdjustedPeriod;
-}
-
-#ifdef LIB_NAMESPACE
-}
-#endif
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipBaseDevice.cpp
+
+#include "stdafx.h"
+#include "GSkipBaseDevice.h"
+#include "GCyclopsDevice.h" //Just used to see if SKIP_CMD_ID_START_MEASUREMENTS is starting real time measurements.
+
+#include "GUtils.h"
+#include "GBinaryLog.h"
+#include "GTimeline.h"
+
+#ifdef _DEBUG
+#include "GPlatformDebug.h" // for DEBUG_NEW definition
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+real GSkipBaseDevice::kVoltsPerBit_ProbeTypeAnalog5V = 2.5/0x8000;
+real GSkipBaseDevice::kVoltsOffset_ProbeTypeAnalog5V = 2.5;
+real GSkipBaseDevice::kVoltsPerBit_ProbeTypeAnalog10V = 10.0/0x8000;
+real GSkipBaseDevice::kVoltsOffset_ProbeTypeAnalog10V = 0.0;
+
+#define NUM_PACKETS_IN_RETRIEVAL_BUFFER 25
+
+#define DIAGNOSTIC_IO_BUFFER_SIZE 10000
+
+static volatile int lastTimelineId = 0;
+
+/*******************************************************************************
+ GSkipBaseDevice:
+*******************************************************************************/
+GSkipBaseDevice::GSkipBaseDevice(GPortRef *pPortRef)
+: TBaseClass(pPortRef)
+{
+	m_nLatestRawMeasurementSeq = 0;
+	m_nLatestRawMeasurement = 0;
+	m_latestRawMeasurementTimeMs = 0;
+    m_bIsMeasuring = false;
+	m_hostIOStatus = 0;
+	m_lastCmd = 0;
+	m_lastCmdRespStatus = 0;
+	m_lastCmdWithErrorRespSentOvertheWire = 0;
+	m_lastErrorSentOvertheWire = 0;
+	m_cmdStartTimeUs = 0;
+	m_cmdSentTimeUs = 0;
+	m_bCmdFirstPacketRecorded = false;
+	memset(m_cmdLatencyStats, 0, sizeof(m_cmdLatencyStats));
+	memset(&m_ioCounters, 0, sizeof(m_ioCounters));
+	m_queueConfig.nCapacity = SKIP_DEFAULT_MEASUREMENT_QUEUE_CAPACITY;
+	m_queueConfig.eOverflowPolicy = kSkipQueueOverflow_DropOldest;
+	m_queueConfig.nBlockTimeoutMs = 0;
+	m_nextRollingCounter = 0;
+	m_bRollingCounterValid = false;
+	m_lastMeasurementsRetrievedTimeMs = GUtils::OSGetTimeStamp();
+	m_nTimelineId = (unsigned int) GThread::OSAtomicAdd(&lastTimelineId, 1);
+	m_bDiagnosticsEnabled = false;
+	m_diagnosticInputBufferPtr = NULL;
+	m_diagnosticOutputBufferPtr = NULL;
+	m_pTraceQueueAccessMutex = NULL;
+
+	m_pCallbackMutex = GThread::OSCreateMutex(GSTD_S(""));
+	m_pMeasurementCallback = NULL;
+	m_pMeasurementCallbackContext = NULL;
+	m_nCallbackMinBatchSize = 1;
+	m_nCallbackMaxLatencyMs = 0;
+	m_callbackBatchStartTimeMs = 0;
+	m_pRecorder = NULL;
+	m_pPublisher = NULL;
+	m_pBroadcast = NULL;
+	m_fMeasurementPeriod = 0.0;
+
+	m_readinessFd = -1;
+	m_nReadinessWatermark = 1;
+	m_bReadinessArmed = true;
+
+	m_pWaitersMutex = GThread::OSCreateMutex(GSTD_S(""));
+	m_nNumMeasurementWaiters = 0;
+	m_nNumLeftoverMeasurements = 0;
+	m_bMeasurementWaitersReleased = false;
+}
+
+GSkipBaseDevice::~GSkipBaseDevice()
+{
+	if (IsOpen())
+		Close();
+	OSDestroy();
+
+	if (m_diagnosticOutputBufferPtr)
+		delete m_diagnosticOutputBufferPtr;
+	m_diagnosticOutputBufferPtr = NULL;
+
+	if (m_diagnosticInputBufferPtr)
+		delete m_diagnosticInputBufferPtr;
+	m_diagnosticInputBufferPtr = NULL;
+
+	if (m_pTraceQueueAccessMutex)
+		delete m_pTraceQueueAccessMutex;
+	m_pTraceQueueAccessMutex = NULL;
+
+	if (m_pRecorder)
+		StopRecording();
+	if (m_pPublisher)
+		StopPublishing();
+	if (m_pBroadcast)
+	{
+		m_pBroadcast->Detach();
+		m_pBroadcast->Release();
+	}
+	m_pBroadcast = NULL;
+
+	if (m_pCallbackMutex)
+		GThread::OSDestroyMutex(m_pCallbackMutex);
+	m_pCallbackMutex = NULL;
+
+	GThread::OSDestroyReadinessFd(m_readinessFd);
+	m_readinessFd = -1;
+
+	if (m_pWaitersMutex)
+		GThread::OSDestroyMutex(m_pWaitersMutex);
+	m_pWaitersMutex = NULL;
+}
+
+int GSkipBaseDevice::Open(GPortRef *pPortRef)
+{
+	if (m_bDiagnosticsEnabled)
+	{
+		if (!m_pTraceQueueAccessMutex)
+			GSTD_NEW(m_pTraceQueueAccessMutex, (GPriorityMutex *), GPriorityMutex(kThreadPriority_TimeCritical, GSTD_S("")));
+
+		if (m_pTraceQueueAccessMutex->m_OSMutex)
+		{
+			if (!m_diagnosticInputBufferPtr)
+			{
+				GSTD_NEW(m_diagnosticInputBufferPtr, (GCircularBuffer *), GCircularBuffer(DIAGNOSTIC_IO_BUFFER_SIZE));
+				m_diagnosticInputBufferPtr->SetQueueAccessMutex(m_pTraceQueueAccessMutex);
+			}
+
+			if (!m_diagnosticOutputBufferPtr)
+			{
+				GSTD_NEW(m_diagnosticOutputBufferPtr, (GCircularBuffer *), GCircularBuffer(DIAGNOSTIC_IO_BUFFER_SIZE));
+				m_diagnosticOutputBufferPtr->SetQueueAccessMutex(m_pTraceQueueAccessMutex);
+			}
+		}
+	}
+
+	int nResult = TBaseClass::Open(pPortRef);
+
+	return nResult;
+}
+
+int GSkipBaseDevice::OSBytesAvailable(void)
+{
+	GSTD_ASSERT(false); //not used!
+	return 0;
+}
+
+int GSkipBaseDevice::OSRead(void * /*pBuffer*/, int * /*pIONumBytes*/, int /*nBufferSize*/)
+{
+	GSTD_ASSERT(false); //not used!
+	return 0;
+}
+
+int GSkipBaseDevice::OSWrite(void * /*pBuffer*/, int * /*pIONumBytes*/)
+{
+	GSTD_ASSERT(false); //not used!
+	return 0;
+}
+
+int GSkipBaseDevice::MeasurementsAvailable(void)
+{
+	//The queue keeps an exact count, so packets holding different numbers of measurements are counted correctly.
+	return OSMeasurementsAvailable() + m_nNumLeftoverMeasurements;
+}
+
+int GSkipBaseDevice::ClearIO(void)
+{
+	int nResult = kResponse_Error;
+	if (LockDevice(1))
+	{
+		DiscardLeftoverMeasurements();
+		nResult = TBaseClass::ClearIO();
+		UnlockDevice();
+	}
+
+	return nResult;
+}
+
+int GSkipBaseDevice::TakeLeftoverMeasurements(
+	int *pMeasurementsBuf,	//[out] ptr to loc to store measurements.
+	int nMaxCount)			//[in] maximum number of measurements to copy to pMeasurementsBuf.
+{
+	int nNumTaken = (int) m_leftoverMeasurements.size();
+	if (nNumTaken > nMaxCount)
+		nNumTaken = (nMaxCount > 0) ? nMaxCount : 0;
+	if (nNumTaken > 0)
+	{
+		std::copy(m_leftoverMeasurements.begin(), m_leftoverMeasurements.begin() + nNumTaken, pMeasurementsBuf);
+		m_leftoverMeasurements.erase(m_leftoverMeasurements.begin(), m_leftoverMeasurements.begin() + nNumTaken);
+		m_nNumLeftoverMeasurements = (int) m_leftoverMeasurements.size();
+	}
+
+	return nNumTaken;
+}
+
+intVector GSkipBaseDevice::ReadRawMeasurements(int desiredCount /*=-1*/) // Optional -- can limit the number that will be returned
+{
+	intVector result;
+	int count = desiredCount;
+	GSkipMeasurementPacket packets[NUM_PACKETS_IN_RETRIEVAL_BUFFER];
+
+	if (LockDevice(1) && IsOKToUse())
+	{ // Make sure we're the only thread that has acces to this device
+		int nNumMeasurementsInVec = 0;
+		int nNumPacketsJustRead, nNumPacketsToAskFor;
+		int measurement;
+		if (count < 0)
+			count = MeasurementsAvailable();
+		if (m_nNumLeftoverMeasurements > 0)
+		{
+			result.resize(m_nNumLeftoverMeasurements);
+			nNumMeasurementsInVec = TakeLeftoverMeasurements(&result[0], (count > 0) ? count : 0);
+			result.resize(nNumMeasurementsInVec);
+		}
+		while (nNumMeasurementsInVec < count)
+		{
+			unsigned char nNumMeasurementsInLastPacket;
+			nNumPacketsToAskFor = OSMeasurementPacketsAvailable(&nNumMeasurementsInLastPacket);
+			if ((nNumMeasurementsInVec + nNumPacketsToAskFor*nNumMeasurementsInLastPacket) > count)
+				nNumPacketsToAskFor = (count - nNumMeasurementsInVec)/nNumMeasurementsInLastPacket;
+			if (0 == nNumPacketsToAskFor)
+				break;
+
+			nNumPacketsJustRead = nNumPacketsToAskFor;
+			OSReadMeasurementPackets(&packets, &nNumPacketsJustRead, NUM_PACKETS_IN_RETRIEVAL_BUFFER);
+
+			if (0 == nNumPacketsJustRead)
+				break;
+			else
+			{
+				int nPacket;
+				for (nPacket = 0; nPacket < nNumPacketsJustRead; nPacket++)
+				{
+					unsigned char nMeasInPacket = 0;
+					unsigned char *pMeasInPacket = &packets[nPacket].meas0LsByte;
+					while (nMeasInPacket < packets[nPacket].nMeasurementsInPacket) //Return all the measurements in the packet.
+					{
+						short shortMeas;
+						GUtils::OSConvertBytesToShort(pMeasInPacket[0], pMeasInPacket[1], &shortMeas);
+						measurement = shortMeas;
+						result.push_back(measurement);
+						nNumMeasurementsInVec++;
+						nMeasInPacket++;
+						pMeasInPacket += 2;
+					}
+				}
+			}
+		}
+
+		if ((desiredCount > 0) && (count > desiredCount))
+			GSTD_TRACE(GSTD_S("ReadRawMeasurements() is returning more measurements than were asked for."));
+
+		UnlockDevice();
+	}
+	else
+		GSTD_ASSERT(0);
+
+	return result;
+}
+
+int GSkipBaseDevice::ReadRawMeasurementsToBuffer(
+	int *pMeasurementsBuf,	//[out] ptr to loc to store measurements.
+	int nMaxCount)			//[in] maximum number of measurements to copy to pMeasurementsBuf.
+{
+	//Same as ReadRawMeasurements(), but decodes straight into the caller's buffer and never returns more than
+	//nMaxCount measurements.
+	int nNumMeasurements = 0;
+	GSkipPacket packets[NUM_PACKETS_IN_RETRIEVAL_BUFFER];
+
+	if (LockDevice(1) && IsOKToUse())
+	{ // Make sure we're the only thread that has acces to this device
+		nNumMeasurements = TakeLeftoverMeasurements(pMeasurementsBuf, nMaxCount);
+		while (nNumMeasurements < nMaxCount)
+		{
+			unsigned char nNumMeasurementsInLastPacket;
+			int nNumPackets = OSMeasurementPacketsAvailable(&nNumMeasurementsInLastPacket);
+			if (0 == nNumMeasurementsInLastPacket)
+				nNumMeasurementsInLastPacket = 1;
+			if (nNumPackets > (nMaxCount - nNumMeasurements)/nNumMeasurementsInLastPacket)
+				nNumPackets = (nMaxCount - nNumMeasurements)/nNumMeasurementsInLastPacket;
+			if (nNumPackets > NUM_PACKETS_IN_RETRIEVAL_BUFFER)
+				nNumPackets = NUM_PACKETS_IN_RETRIEVAL_BUFFER;
+			if (0 == nNumPackets)
+				break;
+
+			OSReadMeasurementPackets(packets, &nNumPackets, NUM_PACKETS_IN_RETRIEVAL_BUFFER);
+			if (0 == nNumPackets)
+				break;
+
+			for (int nPacket = 0; nPacket < nNumPackets; nPacket++)
+			{
+				int measurements[SKIP_MAX_MEASUREMENTS_PER_PACKET];
+				int nMeasInPacket = DecodeMeasurementPacket(&packets[nPacket], measurements);
+				int nNumToCopy = nMeasInPacket;
+				if (nNumToCopy > (nMaxCount - nNumMeasurements))
+					nNumToCopy = nMaxCount - nNumMeasurements;
+				for (int i = 0; i < nNumToCopy; i++)
+					pMeasurementsBuf[nNumMeasurements++] = measurements[i];
+
+				//Packet fill changed under us, so the tail of this packet does not fit. Keep it for the next read.
+				if (nNumToCopy < nMeasInPacket)
+				{
+					m_leftoverMeasurements.insert(m_leftoverMeasurements.end(), measurements + nNumToCopy, measurements + nMeasInPacket);
+					m_nNumLeftoverMeasurements = (int) m_leftoverMeasurements.size();
+				}
+			}
+		}
+
+		UnlockDevice();
+	}
+	else
+		GSTD_ASSERT(0);
+
+	return nNumMeasurements;
+}
+
+int	GSkipBaseDevice::GetLatestRawMeasurement(
+	unsigned int *pTimeStampMs /* = NULL */,//[out] GUtils::OSGetTimeStamp() when the measurement arrived, may be NULL.
+	bool bDrainQueue /* = false */)			//[in] empty the measurement queue as well.
+{
+#ifdef TARGET_OS_MAC
+	//The VST_USB backend only publishes measurements as they are read from the queue, so read them all.
+	int measurements[200];
+	while (ReadRawMeasurementsToBuffer(measurements, 200) > 0)
+		;
+#else
+	if (bDrainQueue)
+	{
+		DiscardLeftoverMeasurements();
+		OSClearMeasurementPacketQueue();
+	}
+#endif
+
+	int nMeasurement;
+	unsigned int timeStampMs;
+	int nSeq;
+	do
+	{
+		nSeq = m_nLatestRawMeasurementSeq;
+		GThread::OSMemoryBarrier();
+		nMeasurement = m_nLatestRawMeasurement;
+		timeStampMs = m_latestRawMeasurementTimeMs;
+		GThread::OSMemoryBarrier();
+	}
+	while ((nSeq & 1) || (nSeq != m_nLatestRawMeasurementSeq));
+
+	if (pTimeStampMs)
+		(*pTimeStampMs) = timeStampMs;
+
+	return nMeasurement;
+}
+
+void GSkipBaseDevice::PublishLatestRawMeasurement(int nMeasurement, unsigned int timeStampMs)
+{
+	m_nLatestRawMeasurementSeq = m_nLatestRawMeasurementSeq + 1;
+	GThread::OSMemoryBarrier();
+	m_nLatestRawMeasurement = nMeasurement;
+	m_latestRawMeasurementTimeMs = timeStampMs;
+	GThread::OSMemoryBarrier();
+	m_nLatestRawMeasurementSeq = m_nLatestRawMeasurementSeq + 1;
+}
+
+int GSkipBaseDevice::GetReadinessFd(void)
+{
+	if (m_readinessFd < 0)
+		m_readinessFd = GThread::OSCreateReadinessFd();
+
+	return m_readinessFd;
+}
+
+int GSkipBaseDevice::SetMeasurementCallback(
+	GSkipMeasurementCallbackPtr pCallback,	//[in] routine to call with new measurements, NULL to return to queued mode.
+	void *pContext,							//[in] passed back to pCallback unchanged.
+	int nMinBatchSize /* = 1 */,			//[in] # of measurements to accumulate before calling pCallback.
+	int nMaxLatencyMs /* = 0 */)			//[in] deliver a partial batch once its oldest measurement is this old, 0 for no limit.
+{
+	int nResult = kResponse_Error;
+
+	if (m_pCallbackMutex && GThread::OSLockMutex(m_pCallbackMutex))
+	{
+		//Measurements collected for the old callback belong to the old callback.
+		FlushMeasurementCallbackBatch();
+
+		m_pMeasurementCallbackContext = pContext;
+		m_nCallbackMinBatchSize = (nMinBatchSize > 0) ? nMinBatchSize : 1;
+		m_nCallbackMaxLatencyMs = (nMaxLatencyMs > 0) ? nMaxLatencyMs : 0;
+		m_callbackBatch.clear();
+		if (pCallback)
+			m_callbackBatch.reserve(m_nCallbackMinBatchSize + SKIP_MAX_MEASUREMENTS_PER_PACKET);
+		m_pMeasurementCallback = pCallback;
+		nResult = kResponse_OK;
+
+		GThread::OSUnlockMutex(m_pCallbackMutex);
+	}
+
+	return nResult;
+}
+
+int GSkipBaseDevice::DecodeMeasurementPacket(
+	const GSkipPacket *pPacket,	//[in] measurement packet
+	int *pMeasurements)			//[out] room for SKIP_MAX_MEASUREMENTS_PER_PACKET measurements.
+{
+	const GSkipMeasurementPacket *pMeasPacket = (const GSkipMeasurementPacket *) pPacket;
+	const unsigned char *pMeasInPacket = &pMeasPacket->meas0LsByte;
+	int nNumMeasurements = pMeasPacket->nMeasurementsInPacket;
+	if (nNumMeasurements > SKIP_MAX_MEASUREMENTS_PER_PACKET)
+		nNumMeasurements = SKIP_MAX_MEASUREMENTS_PER_PACKET;
+
+	for (int i = 0; i < nNumMeasurements; i++)
+	{
+		short shortMeas;
+		GUtils::OSConvertBytesToShort(pMeasInPacket[0], pMeasInPacket[1], &shortMeas);
+		pMeasurements[i] = shortMeas;
+		pMeasInPacket += 2;
+	}
+
+	return nNumMeasurements;
+}
+
+bool GSkipBaseDevice::OnMeasurementPacketReceived(
+	GSkipPacket *pPacket,			//[in] measurement packet
+	int *pNumMeasurementsInPacket)	//[out] # of measurements decoded from the packet.
+{
+	bool bConsumed = false;
+
+	int measurements[SKIP_MAX_MEASUREMENTS_PER_PACKET];
+	int nNumMeasurements = DecodeMeasurementPacket(pPacket, measurements);
+	(*pNumMeasurementsInPacket) = nNumMeasurements;
+
+	//The rolling counter advances by the number of measurements in each packet, for Go! Motion as well.
+	const GSkipMeasurementPacket *pMeasPacket = (const GSkipMeasurementPacket *) pPacket;
+	m_ioCounters.nMeasurementPacketsReceived++;
+	GSTD_BINLOG(TRACE_SEVERITY_LOWEST, kBinaryLogEvent_MeasurementPacket, pMeasPacket->nMeasurementsInPacket, pMeasPacket->nRollingCounter, 0, 0);
+	int nNumMissing = 0;
+	if (m_bRollingCounterValid && (pMeasPacket->nRollingCounter != m_nextRollingCounter))
+	{
+		nNumMissing = (unsigned char) (pMeasPacket->nRollingCounter - m_nextRollingCounter);
+		m_ioCounters.nRollingCounterGaps++;
+		GSTD_BINLOG(TRACE_SEVERITY_MEDIUM, kBinaryLogEvent_RollingCounterGap, m_nextRollingCounter, pMeasPacket->nRollingCounter, 0, 0);
+	}
+	m_nextRollingCounter = (unsigned char) (pMeasPacket->nRollingCounter + pMeasPacket->nMeasurementsInPacket);
+	m_bRollingCounterValid = true;
+
+	if (nNumMeasurements > 0)
+		PublishLatestRawMeasurement(measurements[nNumMeasurements - 1], GUtils::OSGetTimeStamp());
+
+	//The broadcast buffer may wait for blocking consumers, so write to it without holding m_pCallbackMutex.
+	GSkipBroadcastBuffer *pBroadcast = m_pBroadcast;
+	if (pBroadcast)
+		pBroadcast->AddMeasurements(measurements, nNumMeasurements);
+
+	//Test without the mutex first so queued mode does not pay for push mode, recording or publishing.
+	if ((m_pMeasurementCallback || m_pRecorder || m_pPublisher) && GThread::OSLockMutex(m_pCallbackMutex))
+	{
+		if (m_pRecorder)
+			m_pRecorder->AddMeasurements(measurements, nNumMeasurements, nNumMissing);
+		if (m_pPublisher)
+			m_pPublisher->AddMeasurements(measurements, nNumMeasurements, nNumMissing);
+
+		if (m_pMeasurementCallback)
+		{
+			if (nNumMeasurements > 0)
+			{
+				if (m_callbackBatch.empty())
+					m_callbackBatchStartTimeMs = GUtils::OSGetTimeStamp();
+				m_callbackBatch.insert(m_callbackBatch.end(), measurements, measurements + nNumMeasurements);
+			}
+
+			if (((int) m_callbackBatch.size() >= m_nCallbackMinBatchSize) || IsCallbackBatchStale())
+				FlushMeasurementCallbackBatch();
+
+			bConsumed = true;
+		}
+
+		GThread::OSUnlockMutex(m_pCallbackMutex);
+	}
+
+	return bConsumed;
+}
+
+void GSkipBaseDevice::OnMeasurementPacketQueued(int nMeasurementsQueued)
+{
+	if (nMeasurementsQueued > m_ioCounters.nQueueHighWaterMark)
+		m_ioCounters.nQueueHighWaterMark = nMeasurementsQueued;
+	GSTD_TIMELINE_COUNTER("measurement queue", m_nTimelineId, nMeasurementsQueued);
+
+	if ((m_nNumMeasurementWaiters > 0) && GThread::OSLockMutex(m_pWaitersMutex))
+	{
+		for (size_t i = 0; i < m_measurementWaiters.size(); i++)
+		{
+			if (nMeasurementsQueued >= m_measurementWaiters[i]->nMinMeasurements)
+				GThread::OSSetEvent(m_measurementWaiters[i]->event);
+		}
+		GThread::OSUnlockMutex(m_pWaitersMutex);
+	}
+
+	//Signal once per crossing of the watermark; OnMeasurementPacketsRetrieved() rearms.
+	//The barrier pairs with the one in OnMeasurementPacketsRetrieved(): either we see the rearm, or it sees our packet.
+	GThread::OSMemoryBarrier();
+	if ((m_readinessFd >= 0) && m_bReadinessArmed && (nMeasurementsQueued >= m_nReadinessWatermark))
+		FireReadinessFd();
+}
+
+void GSkipBaseDevice::FireReadinessFd(void)
+{
+	//Both the listener and the consumer may try to fire, so test and clear under a lock to signal only once.
+	if (GThread::OSLockMutex(m_pWaitersMutex))
+	{
+		if (m_bReadinessArmed)
+		{
+			m_bReadinessArmed = false;
+			GThread::OSSignalReadinessFd(m_readinessFd);
+		}
+		GThread::OSUnlockMutex(m_pWaitersMutex);
+	}
+}
+
+void GSkipBaseDevice::AddMeasurementWaiter(GMeasurementWaiter *pWaiter)
+{
+	if (GThread::OSLockMutex(m_pWaitersMutex))
+	{
+		m_measurementWaiters.push_back(pWaiter);
+		m_nNumMeasurementWaiters = (int) m_measurementWaiters.size();
+		GThread::OSUnlockMutex(m_pWaitersMutex);
+	}
+}
+
+void GSkipBaseDevice::RemoveMeasurementWaiter(GMeasurementWaiter *pWaiter)
+{
+	if (GThread::OSLockMutex(m_pWaitersMutex))
+	{
+		std::vector<GMeasurementWaiter *>::iterator iter = std::find(m_measurementWaiters.begin(), m_measurementWaiters.end(), pWaiter);
+		if (iter != m_measurementWaiters.end())
+			m_measurementWaiters.erase(iter);
+		m_nNumMeasurementWaiters = (int) m_measurementWaiters.size();
+		GThread::OSUnlockMutex(m_pWaitersMutex);
+	}
+}
+
+int GSkipBaseDevice::WaitForMeasurements(
+	GSkipBaseDevice **ppDevices,	//[in] devices to wait on; caller must hold their device locks.
+	int nNumDevices,				//[in] # of entries in ppDevices.
+	int nMinMeasurements,			//[in] # of queued measurements that satisfies the wait.
+	int nTimeoutMs,					//[in] # of milliseconds to wait before giving up.
+	int *pNumAvailable /* = NULL */)//[out] # of measurements queued for ppDevices[0], may be NULL.
+{
+	int nReadyIndex = -1;
+	GMeasurementWaiter waiter;
+	waiter.event = GThread::OSCreateEvent();
+	waiter.nMinMeasurements = (nMinMeasurements > 0) ? nMinMeasurements : 1;
+
+	int i;
+	bool bReleased = (NULL == waiter.event);//give up at once if there is nothing to wait on.
+	for (i = 0; (i < nNumDevices) && waiter.event; i++)
+	{
+		ppDevices[i]->AddMeasurementWaiter(&waiter);
+		bReleased = bReleased || ppDevices[i]->m_bMeasurementWaitersReleased;
+	}
+
+	//Once registered, ReleaseMeasurementWaiters() keeps the devices alive until we leave, so other threads may 
+	//use them while we sleep.
+	for (i = 0; i < nNumDevices; i++)
+		ppDevices[i]->UnlockDevice();
+
+	//The listeners only wake us up; always check the queues after registering so no signal is missed.
+	unsigned int nStartTime = GUtils::OSGetTimeStamp();
+	while (!bReleased)
+	{
+		for (i = 0; (i < nNumDevices) && (nReadyIndex < 0); i++)
+		{
+			if (ppDevices[i]->MeasurementsAvailable() >= waiter.nMinMeasurements)
+				nReadyIndex = i;
+		}
+
+		unsigned int nElapsedMs = GUtils::OSGetTimeStamp() - nStartTime;
+		if ((nReadyIndex >= 0) || (nElapsedMs >= (unsigned int) nTimeoutMs))
+			break;
+
+		int nWaitMs = nTimeoutMs - nElapsedMs;
+#ifdef TARGET_OS_MAC
+		//The VST_USB backend does not notify us when packets arrive, so poll.
+		if (nWaitMs > 10)
+			nWaitMs = 10;
+#endif
+		GThread::OSWaitEvent(waiter.event, nWaitMs);
+
+		for (i = 0; i < nNumDevices; i++)
+			bReleased = bReleased || ppDevices[i]->m_bMeasurementWaitersReleased;
+	}
+
+	if (bReleased)
+		nReadyIndex = -1;
+	else
+	if (pNumAvailable)
+		(*pNumAvailable) = ppDevices[0]->MeasurementsAvailable();
+
+	if (waiter.event)
+	{
+		for (i = 0; i < nNumDevices; i++)
+			ppDevices[i]->RemoveMeasurementWaiter(&waiter);
+		GThread::OSDestroyEvent(waiter.event);
+	}
+
+	return nReadyIndex;
+}
+
+void GSkipBaseDevice::ReleaseMeasurementWaiters(void)
+{
+	if (GThread::OSLockMutex(m_pWaitersMutex))
+	{
+		m_bMeasurementWaitersReleased = true;
+		for (size_t i = 0; i < m_measurementWaiters.size(); i++)
+			GThread::OSSetEvent(m_measurementWaiters[i]->event);
+		GThread::OSUnlockMutex(m_pWaitersMutex);
+	}
+
+	//The waiters see the flag as soon as they wake up, and they need neither the device lock nor the queue to leave.
+	while (m_nNumMeasurementWaiters > 0)
+		GUtils::OSSleep(1);
+}
+
+void GSkipBaseDevice::OnCmdRespPacketQueued(
+	const GSkipPacket *pPacket)//[in] cmd response packet
+{
+	const GSkipGenericResponsePacket *pRespPacket = (const GSkipGenericResponsePacket *) pPacket;
+	m_ioCounters.nCmdRespPacketsReceived++;
+	GSTD_BINLOG(TRACE_SEVERITY_LOWEST, kBinaryLogEvent_CmdRespPacket, pRespPacket->header, pRespPacket->cmd, 0, 0);
+	if (pRespPacket->header & SKIP_INPUT_PACKET_INIT_RESP)
+	{
+		m_ioCounters.nInitRespPacketsReceived++;
+		m_bRollingCounterValid = false;//SKIP_CMD_ID_INIT stops measurements.
+	}
+	else
+	if ((pRespPacket->header & SKIP_MASK_CMD_RESP_1ST_PACKET_FLAG) && (SKIP_CMD_ID_STOP_MEASUREMENTS == pRespPacket->cmd))
+		m_bRollingCounterValid = false;
+
+	if (m_readinessFd >= 0)
+		GThread::OSSignalReadinessFd(m_readinessFd);
+}
+
+void GSkipBaseDevice::OnPacketsDropped(
+	int nNumPackets)//[in] # of packets discarded because a queue was full.
+{
+	m_ioCounters.nPacketsDropped += nNumPackets;
+	GSTD_BINLOG(TRACE_SEVERITY_MEDIUM, kBinaryLogEvent_PacketsDropped, nNumPackets, 0, 0, 0);
+}
+
+void GSkipBaseDevice::OnMeasurementQueueFull(
+	unsigned int nWaitMs)//[in] time spent waiting for space.
+{
+	m_ioCounters.nQueueOverflows++;
+	m_ioCounters.nProducerBlockedMs += nWaitMs;
+	GSTD_BINLOG(TRACE_SEVERITY_MEDIUM, kBinaryLogEvent_MeasurementQueueFull, m_queueConfig.eOverflowPolicy, nWaitMs, 0, 0);
+}
+
+void GSkipBaseDevice::OnMeasurementPacketsRetrieved(void)
+{
+	m_lastMeasurementsRetrievedTimeMs = GUtils::OSGetTimeStamp();
+
+	if (m_readinessFd >= 0)
+	{
+		//Rearm before looking at the queue, so a packet queued after the look finds us armed and signals.
+		//If the consumer left the queue above the watermark, nothing new may arrive to trigger the signal,
+		//so signal now.
+		m_bReadinessArmed = true;
+		GThread::OSMemoryBarrier();
+		int nMeasurementsQueued = OSMeasurementsAvailable();
+		if ((nMeasurementsQueued > 0) && (nMeasurementsQueued >= m_nReadinessWatermark))
+			FireReadinessFd();
+	}
+}
+
+void GSkipBaseDevice::OnListenerIdle(void)
+{
+	if ((m_pMeasurementCallback || m_pRecorder) && GThread::OSLockMutex(m_pCallbackMutex))
+	{
+		if (m_pRecorder)
+			m_pRecorder->FlushIfStale();
+
+		if (IsCallbackBatchStale())
+			FlushMeasurementCallbackBatch();
+
+		GThread::OSUnlockMutex(m_pCallbackMutex);
+	}
+}
+
+void GSkipBaseDevice::FlushMeasurementCallbackBatch(void)
+{
+	if (m_pMeasurementCallback && (m_callbackBatch.size() > 0))
+		(*m_pMeasurementCallback)(m_pMeasurementCallbackContext, &m_callbackBatch[0], (int) m_callbackBatch.size());
+	m_callbackBatch.clear();
+}
+
+bool GSkipBaseDevice::IsCallbackBatchStale(void)
+{
+	//A max latency of 0 means no limit, so only m_nCallbackMinBatchSize triggers delivery.
+	return (m_nCallbackMaxLatencyMs > 0) && !m_callbackBatch.empty() &&
+		((GUtils::OSGetTimeStamp() - m_callbackBatchStartTimeMs) >= (unsigned int) m_nCallbackMaxLatencyMs);
+}
+
+int GSkipBaseDevice::SendCmd(
+	unsigned char cmd,	//[in] command code
+	void *pParams,		//[in] ptr to cmd specific parameter block, may be NULL.
+	int nParamBytes)	//[in] # of bytes in (*pParams).
+{
+	int nResult;
+	GSkipOutputPacket packet;
+
+	if (SKIP_CMD_ID_START_MEASUREMENTS == cmd)
+		GSTD_ASSERT((0 == MeasurementsAvailable()) || pParams);
+    else if ((SKIP_CMD_ID_STOP_MEASUREMENTS == cmd) || (SKIP_CMD_ID_INIT == cmd))
+        m_bIsMeasuring = false;
+
+	memset(&packet, 0, sizeof(packet));
+	packet.cmd = cmd;
+	if (pParams != NULL)
+		memcpy(packet.params, pParams, nParamBytes);
+
+	StopWaitingForBroadcastConsumers();
+	m_cmdSentTimeUs = GUtils::OSGetTimeStampMicroseconds();
+	m_bCmdFirstPacketRecorded = false;
+	nResult = OSWriteCmdPackets(&packet, 1);
+	if (kResponse_OK == nResult)
+		m_ioCounters.nBytesWritten += sizeof(packet);
+	else
+		m_ioCounters.nWriteErrors++;
+
+	if (GetDiagnosticOutputBufferPtr())
+		GetDiagnosticOutputBufferPtr()->AddBytes((unsigned char *) &packet, sizeof(packet));
+
+	GSTD_BINLOG(TRACE_SEVERITY_LOW, kBinaryLogEvent_SkipCmdSent, cmd, 
+		(packet.params[0] << 24) | (packet.params[1] << 16) | (packet.params[2] << 8) | packet.params[3],
+		(packet.params[4] << 16) | (packet.params[5] << 8) | packet.params[6], nResult);
+	if (GSTD_TRACE_ENABLED(TRACE_SEVERITY_LOW))
+	{
+		cppsstream ssCmd;
+		ssCmd << GSTD_S("Skip cmd sent: ") << hex << ((unsigned short) packet.cmd) << GSTD_S("h ");
+		ssCmd << ((unsigned short) packet.params[0]) << GSTD_S("h ");
+		ssCmd << ((unsigned short) packet.params[1]) << GSTD_S("h ");
+		ssCmd << ((unsigned short) packet.params[2]) << GSTD_S("h ");
+		ssCmd << ((unsigned short) packet.params[3]) << GSTD_S("h ");
+		ssCmd << ((unsigned short) packet.params[4]) << GSTD_S("h "); 
+		ssCmd << ((unsigned short) packet.params[5]) << GSTD_S("h ");
+		ssCmd << ((unsigned short) packet.params[6]) << GSTD_S("h ");
+		GSTD_TRACE(ssCmd.str());
+	}
+
+	if (kResponse_OK != nResult)
+	{
+		GSTD_BINLOG(TRACE_SEVERITY_MEDIUM, kBinaryLogEvent_SkipCmdWriteFailed, cmd, 0, 0, 0);
+		if (GSTD_TRACE_ENABLED(TRACE_SEVERITY_LOW))
+		{
+			cppsstream ss;
+			ss << GSTD_S("Error writing ") << hex << ((unsigned short) cmd) << GSTD_S("h cmd to skip.");
+			GSTD_TRACE(ss.str());
+		}
+	}
+
+	return nResult;
+}
+
+int GSkipBaseDevice::GetNextResponse(
+	void *pRespBuf,		//[out] ptr to destination buffer, may be NULL.
+	int *pnRespBytes,  //[in, out] size of of dest buffer on input, size of response on output, may be NULL if pRespBuf is NULL.
+	unsigned char *pCmd,//[out] identifies which command this response is for.
+	bool *pErrRespFlag, //[out] flag indicating that the response contains error info
+	int nTimeoutMs /* = 1000 */,//[in] # of milliseconds to wait before giving up.
+	bool *pExitFlag /* = NULL */)//[in] ptr to flag that another thread can set to force early exit. 
+						//		THIS FLAG MUST BE FALSE FOR THIS ROUTINE TO RUN.
+						//		Ignore this if NULL.
+{
+	int nResult = kResponse_OK;
+	char *pRespCharBuf = static_cast<char *>(pRespBuf);
+	(*pErrRespFlag) = false;
+	GSkipGenericResponsePacket packet;
+	bool bResponseComplete = false;
+	bool bFirstPacketFound = false;
+	int nBufSize = 0;
+	if (pnRespBytes != NULL)
+		nBufSize = (*pnRespBytes);
+	int nRespSize = 0;
+	int nBytesInPacket, nBytesRemainingInBuffer;
+	bool *pMyExitFlag;
+	bool myExitFlag = false;
+	if (NULL == pExitFlag)
+		pMyExitFlag = &myExitFlag;
+	else
+		pMyExitFlag = pExitFlag;
+	unsigned char *packetPayload;
+
+	unsigned int nStartTime = GUtils::OSGetTimeStamp();
+
+	while (((GUtils::OSGetTimeStamp() - nStartTime) <= ((unsigned int) nTimeoutMs)) &&
+			(!(*pMyExitFlag)) &&
+			(!bResponseComplete) &&
+			(kResponse_OK == nResult))
+	{
+		while (	(!bResponseComplete) &&
+				(kResponse_OK == nResult) &&
+				(OSCmdRespPacketsAvailable() > 0))
+		{
+			int transactionPacketCount = 1;
+			nResult = OSReadCmdRespPackets(&packet, &transactionPacketCount, 1);
+			if (kResponse_OK == nResult)
+			{
+				RecordCmdFirstPacket();
+				nBytesInPacket = packet.header & SKIP_MASK_CMD_RESP_NUMBYTES ;
+				packetPayload = &packet.cmd;
+				if (packet.header & SKIP_MASK_CMD_RESP_1ST_PACKET_FLAG)
+				{
+					if (nBytesInPacket > 0)
+					{
+						nBytesInPacket--;//Don't copy cmd id into response buffer.
+						packetPayload++;
+						(*pCmd) = packet.cmd;
+					}
+					else
+						(*pCmd) = 0; //This should never happen!!!!
+					if (bFirstPacketFound && (0 == (packet.header & SKIP_MASK_INPUT_PACKET_ERROR_FLAG)))
+						nResult = kResponse_Error; //Two first packets found! - ok if second packet is error packet.
+					bFirstPacketFound = true;
+				}
+				if (packet.header & SKIP_MASK_INPUT_PACKET_ERROR_FLAG)
+				{
+					//Early exit - we have an error packet.
+					bResponseComplete = true;
+					(*pErrRespFlag) = true;
+					nRespSize = min(nBytesInPacket, nBufSize);
+					if (pRespCharBuf && (nRespSize > 0))
+						memcpy(pRespCharBuf, packetPayload, nRespSize);
+
+					m_lastCmdRespStatus = *packetPayload;
+					m_lastCmdWithErrorRespSentOvertheWire = m_lastCmd;
+					m_lastErrorSentOvertheWire = m_lastCmdRespStatus;
+				}
+				if ((!bResponseComplete) && (kResponse_OK == nResult))
+				{
+					//Copy packet payload.
+					nBytesRemainingInBuffer = nBufSize - nRespSize;
+					nBytesInPacket = min(nBytesInPacket, nBytesRemainingInBuffer);
+					if (pRespCharBuf && (nBytesInPacket > 0))
+					{
+						memcpy(&pRespCharBuf[nRespSize], packetPayload, nBytesInPacket);
+						nRespSize += nBytesInPacket;
+					}
+
+					//Is this the last packet?
+					if (packet.header & SKIP_MASK_CMD_RESP_LAST_PACKET_FLAG)
+						bResponseComplete = true;
+				}
+			}
+		}//while
+
+		if ((!bResponseComplete) && (kResponse_OK == nResult))
+			GUtils::Sleep(10);
+	}//while
+
+	if (pnRespBytes)
+		(*pnRespBytes) = nRespSize;
+
+	if ((kResponse_OK == nResult) && (!bResponseComplete))
+		nResult = kResponse_Error; 
+
+	return nResult;
+}
+
+int GSkipBaseDevice::GetInitCmdResponse(
+	void *pRespBuf,		//[out] ptr to destination buffer, may be NULL.
+	int *pnRespBytes,  //[in, out] size of of dest buffer on input, size of response on output, may be NULL if pRespBuf is NULL.
+	int nTimeoutMs /* = 1000 */,//[in] # of milliseconds to wait before giving up.
+	bool *pExitFlag /* = NULL */)//[in] ptr to flag that another thread can set to force early exit. 
+						//		THIS FLAG MUST BE FALSE FOR THIS ROUTINE TO RUN.
+						//		Ignore this if NULL.
+{
+	/* This routine keeps looking at response packets until it sees an INIT cmd response, or times out. */
+	/* Skip will respond to an INIT command at almost any time, so this allows us to recover from weird situations. */
+	int nResult = kResponse_OK;
+	GSkipDefaultResponsePacket packet;
+	bool bResponseComplete = false;
+	int nBufSize = 0;
+	if (pnRespBytes != NULL)
+		nBufSize = (*pnRespBytes);
+	int nRespSize = 0;
+	bool *pMyExitFlag;
+	bool myExitFlag = false;
+	if (NULL == pExitFlag)
+		pMyExitFlag = &myExitFlag;
+	else
+		pMyExitFlag = pExitFlag;
+
+	unsigned int nStartTime = GUtils::OSGetTimeStamp();
+
+	while (((GUtils::OSGetTimeStamp() - nStartTime) <= ((unsigned int) nTimeoutMs)) &&
+			(!(*pMyExitFlag)) &&
+			(!bResponseComplete) &&
+			(kResponse_OK == nResult))
+	{
+		while (	(!bResponseComplete) &&
+				(kResponse_OK == nResult) &&
+				(OSCmdRespPacketsAvailable() > 0))
+		{
+			int transactionPacketCount = 1;
+			nResult = OSReadCmdRespPackets(&packet, &transactionPacketCount, 1);
+			if (kResponse_OK == nResult)
+			{
+				if (packet.header & SKIP_INPUT_PACKET_INIT_RESP)
+				{
+					//We found it..
+					RecordCmdFirstPacket();
+					bResponseComplete = true;
+					nRespSize = min((unsigned int)sizeof(packet.errorStatus), (unsigned int)nBufSize);
+					if (pRespBuf && (nRespSize > 0))
+						memcpy(pRespBuf, &packet.errorStatus, nRespSize);
+
+					if (packet.header & SKIP_MASK_INPUT_PACKET_ERROR_FLAG)
+					{
+						nResult = kResponse_Error;
+						GSTD_BINLOG(TRACE_SEVERITY_MEDIUM, kBinaryLogEvent_SkipInitFailed, packet.errorStatus, 0, 0, 0);
+						if (GSTD_TRACE_ENABLED(TRACE_SEVERITY_LOW))
+						{
+							cppsstream sss;
+							sss << GSTD_S("SKIP_CMD_ID_INIT failed with response ") << hex ;
+							sss << ((unsigned short) packet.errorStatus) << GSTD_S("h.");
+							GSTD_TRACE(sss.str());
+						}
+					}
+				}
+			}
+		}//while
+
+		if ((!bResponseComplete) && (kResponse_OK == nResult))
+			GUtils::Sleep(10);
+	}//while
+
+	if (pnRespBytes)
+		(*pnRespBytes) = nRespSize;
+
+	if ((kResponse_OK == nResult) && (!bResponseComplete))
+		nResult = kResponse_Error; 
+
+	if (kResponse_Error == nResult)
+	{
+		GSTD_BINLOG(TRACE_SEVERITY_MEDIUM, kBinaryLogEvent_SkipCmdTimeout, SKIP_CMD_ID_INIT, 0, 0, 0);
+		GSTD_TRACE(GSTD_S("Error waiting for response to SKIP_CMD_ID_INIT."));
+	}
+
+	return nResult;
+}
+
+int GSkipBaseDevice::SendCmdAndGetResponse(
+	unsigned char cmd,	//[in] command code
+	void *pParams,		//[in] ptr to cmd specific parameter block, may be NULL.
+	int nParamBytes,	//[in] # of bytes in (*pParams).
+	void *pRespBuf,		//[out] ptr to destination buffer, may be NULL.
+	int *pnRespBytes,  //[in, out] size of of dest buffer on input, size of response on output, may be NULL if pRespBuf is NULL.
+	int nTimeoutMs /* = 1000 */,//[in] # of milliseconds to wait before giving up.
+	bool *pExitFlag /* = NULL */)//[in] ptr to flag that another thread can set to force early exit. 
+						//		THIS FLAG MUST BE FALSE FOR THIS ROUTINE TO RUN.
+						//		Ignore this if NULL.
+{
+	int nResult = kResponse_Error;
+	bool bTimeout = false;
+	GSTD_TIMELINE_SPAN("SendCmdAndGetResponse", m_nTimelineId, cmd);
+
+	m_lastCmd = cmd;
+	m_lastCmdRespStatus = 0;
+
+	if (LockDevice(1) && IsOKToUse())
+	{ // Make sure we're the only thread that has access to this device
+		m_cmdStartTimeUs = GUtils::OSGetTimeStampMicroseconds();
+		nResult = SendCmd(cmd,	pParams, nParamBytes);
+
+		if (kResponse_OK == nResult)
+		{
+			if (SKIP_CMD_ID_INIT == cmd)
+			{
+				nResult = GetInitCmdResponse(pRespBuf,	pnRespBytes, nTimeoutMs, pExitFlag);
+				bTimeout = (kResponse_OK != nResult) && (!m_bCmdFirstPacketRecorded);
+			}
+			else
+			{
+				unsigned char responseCmd;
+				bool bError;
+				nResult = GetNextResponse(pRespBuf,	pnRespBytes, &responseCmd, &bError, nTimeoutMs, pExitFlag);
+				if (kResponse_OK != nResult)
+				{
+					bTimeout = true;
+					m_hostIOStatus = m_hostIOStatus | SKIP_HOST_IO_STATUS_TIMED_OUT;
+					GSTD_BINLOG(TRACE_SEVERITY_MEDIUM, kBinaryLogEvent_SkipCmdTimeout, cmd, 0, 0, 0);
+					if (GSTD_TRACE_ENABLED(TRACE_SEVERITY_LOW))
+					{
+						cppsstream ss;
+						ss << GSTD_S("Error waiting for response to ") << hex << ((unsigned short) cmd) << GSTD_S("h cmd from Skip. Timeout??");
+						GSTD_TRACE(ss.str());
+					}
+					if (pnRespBytes)
+						(*pnRespBytes) = 0;//Only 'over the wire' errors have response data.
+				}
+				else
+				if (bError)
+				{
+					GSTD_BINLOG(TRACE_SEVERITY_MEDIUM, kBinaryLogEvent_SkipCmdErrorResponse, cmd, m_lastErrorSentOvertheWire, 0, 0);
+					if (GSTD_TRACE_ENABLED(TRACE_SEVERITY_LOW))
+					{
+						cppsstream ss;
+						ss << GSTD_S("Skip reported an error over the wire. cmd sent = ") << hex << ((unsigned short) cmd) << GSTD_S("h. Error returned = ");
+						ss << ((unsigned short) m_lastErrorSentOvertheWire) << GSTD_S("h.");
+						GSTD_TRACE(ss.str());
+					}
+					nResult = kResponse_Error;
+				}
+				else
+				if (cmd != responseCmd)
+				{
+					GSTD_BINLOG(TRACE_SEVERITY_MEDIUM, kBinaryLogEvent_SkipCmdMismatch, cmd, responseCmd, 0, 0);
+					if (GSTD_TRACE_ENABLED(TRACE_SEVERITY_LOW))
+					{
+						cppsstream ss;
+						ss << GSTD_S("Skip reported cmd response mismatch. cmd sent = ") << hex << ((unsigned short) cmd) << GSTD_S("h. cmd returned = ");
+						ss << ((unsigned short) responseCmd) << GSTD_S("h.");
+						GSTD_TRACE(ss.str());
+					}
+					nResult = kResponse_Error;
+					if (pnRespBytes)
+						(*pnRespBytes) = 0;//Only 'over the wire' errors have response data.
+				}
+			}
+		}
+		RecordCmdResult(cmd, nResult, bTimeout);
+
+		UnlockDevice();
+	}
+	else
+		GSTD_ASSERT(0);	// Can't use this device -- some other thread has it open!
+
+    if (kResponse_OK == nResult)
+    {
+		//Keep track if we are starting measurements.
+	    if (SKIP_CMD_ID_START_MEASUREMENTS == cmd) //Check for STOP in SendCmd().
+			m_bIsMeasuring = true;
+    }
+	else
+	if (bTimeout)
+	{
+		//The Skip/Jonah firmware does not recover from DDS memory failures very well, so we will send an INIT command
+		//if we timed out trying to read or write nonvolatile memory.
+		switch (cmd)
+		{
+			case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_1BYTE:
+			case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_2BYTES:
+			case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_3BYTES:
+			case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_4BYTES:
+			case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_5BYTES:
+			case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_6BYTES:
+			case SKIP_CMD_ID_READ_LOCAL_NV_MEM:
+			case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_1BYTE:
+			case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_2BYTES:
+			case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_3BYTES:
+			case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_4BYTES:
+			case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_5BYTES:
+			case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_6BYTES:
+			case SKIP_CMD_ID_READ_REMOTE_NV_MEM:
+				{
+					bool bWasMeasuring = m_bIsMeasuring;
+					int status2 = SendCmdAndGetResponse(SKIP_CMD_ID_INIT, NULL, 0, NULL, NULL, SKIP_TIMEOUT_MS_CMD_ID_INIT_WO_BUSY_STATUS);
+					if ((kResponse_OK == status2) && bWasMeasuring)
+					{
+						//SKIP_CMD_ID_INIT turned off measurements - turn them back on.
+						DiscardLeftoverMeasurements();
+						OSClearMeasurementPacketQueue();//Not supposed to turn on measurements with old measurements pending.
+						SendCmdAndGetResponse(SKIP_CMD_ID_START_MEASUREMENTS, NULL, 0, NULL, NULL);
+					}
+				}
+				break;
+			default:
+				break;
+		}
+	}
+
+	if ((kResponse_OK != nResult) && (0 == m_lastCmdRespStatus))
+		m_lastCmdRespStatus = SKIP_STATUS_ERROR_COMMUNICATION;
+
+	return nResult;
+}
+
+int GSkipBaseDevice::GetCmdLatencyBucket(
+	unsigned long long latencyUs)//[in]
+{
+	int nBucket = 0;
+	while ((latencyUs > 1) && (nBucket < (SKIP_CMD_LATENCY_NUM_BUCKETS - 1)))
+	{
+		latencyUs = latencyUs >> 1;
+		nBucket++;
+	}
+	return nBucket;
+}
+
+void GSkipBaseDevice::RecordCmdFirstPacket(void)
+{
+	if ((!m_bCmdFirstPacketRecorded) && (m_lastCmd >= FIRST_SKIP_CMD_ID) && (m_lastCmd <= SKIP_CMD_LATENCY_LAST_CMD_ID))
+	{
+		GSkipCmdLatencyStats *pStats = &m_cmdLatencyStats[m_lastCmd - FIRST_SKIP_CMD_ID];
+		int nBucket = GetCmdLatencyBucket(GUtils::OSGetTimeStampMicroseconds() - m_cmdSentTimeUs);
+		GThread::OSAtomicAdd(&pStats->firstPacketHistogram[nBucket], 1);
+	}
+	m_bCmdFirstPacketRecorded = true;
+}
+
+void GSkipBaseDevice::RecordCmdResult(
+	unsigned char cmd,	//[in]
+	int nResult,		//[in] result of SendCmdAndGetResponse().
+	bool bTimedOut,		//[in] true if nResult reflects a missing response rather than a bad one.
+	int nNumRetries /* = 0 */)//[in]
+{
+	if ((cmd >= FIRST_SKIP_CMD_ID) && (cmd <= SKIP_CMD_LATENCY_LAST_CMD_ID))
+	{
+		GSkipCmdLatencyStats *pStats = &m_cmdLatencyStats[cmd - FIRST_SKIP_CMD_ID];
+		GThread::OSAtomicAdd(&pStats->nNumCmds, 1);
+		if (nNumRetries > 0)
+			GThread::OSAtomicAdd(&pStats->nNumRetries, nNumRetries);
+		if (bTimedOut && (kResponse_OK != nResult))
+			GThread::OSAtomicAdd(&pStats->nNumTimeouts, 1);
+		else
+		{
+			int nBucket = GetCmdLatencyBucket(GUtils::OSGetTimeStampMicroseconds() - m_cmdStartTimeUs);
+			GThread::OSAtomicAdd(&pStats->completeHistogram[nBucket], 1);
+			if (kResponse_OK != nResult)
+				GThread::OSAtomicAdd(&pStats->nNumErrors, 1);
+		}
+	}
+}
+
+bool GSkipBaseDevice::GetCmdLatencyStats(
+	unsigned char cmd,				//[in]
+	GSkipCmdLatencyStats *pStats)	//[out]
+{
+	if ((cmd < FIRST_SKIP_CMD_ID) || (cmd > SKIP_CMD_LATENCY_LAST_CMD_ID))
+		return false;
+
+	//Each counter is read atomically, but the snapshot as a whole may straddle a cmd that is being recorded.
+	(*pStats) = m_cmdLatencyStats[cmd - FIRST_SKIP_CMD_ID];
+	return true;
+}
+
+void GSkipBaseDevice::ResetCmdLatencyStats(void)
+{
+	//Subtract what we saw rather than storing 0, so increments that race with the reset are not lost.
+	int *pCounters = (int *) m_cmdLatencyStats;
+	int nNumCounters = (int) (sizeof(m_cmdLatencyStats)/(sizeof(int)));
+	for (int i = 0; i < nNumCounters; i++)
+	{
+		int nValue = pCounters[i];
+		if (nValue != 0)
+			GThread::OSAtomicAdd(&pCounters[i], -nValue);
+	}
+}
+
+void GSkipBaseDevice::GetIOCounters(
+	GSkipIOCounters *pCounters)//[out]
+{
+	(*pCounters) = m_ioCounters;
+	pCounters->nConsumerLagMeasurements = OSMeasurementsAvailable();
+	pCounters->nConsumerLagMs = 0;
+	if (pCounters->nConsumerLagMeasurements > 0)
+		pCounters->nConsumerLagMs = GUtils::OSGetTimeStamp() - m_lastMeasurementsRetrievedTimeMs;
+}
+
+int GSkipBaseDevice::SetMeasurementQueueConfig(
+	const GSkipQueueConfig &config)//[in]
+{
+	int nResult = kResponse_Error;
+	if ((config.nCapacity < 1) || (config.nCapacity > SKIP_MAX_MEASUREMENT_QUEUE_CAPACITY))
+		GSTD_TRACE("GSkipBaseDevice::SetMeasurementQueueConfig - invalid capacity.");
+	else
+	if ((config.eOverflowPolicy < kSkipQueueOverflow_DropOldest) || (config.eOverflowPolicy >= kSkipQueueOverflow_NumPolicies))
+		GSTD_TRACE("GSkipBaseDevice::SetMeasurementQueueConfig - invalid overflow policy.");
+	else
+	if (config.nBlockTimeoutMs < 0)
+		GSTD_TRACE("GSkipBaseDevice::SetMeasurementQueueConfig - invalid block timeout.");
+	else
+	{
+		nResult = OSSetMeasurementQueueConfig(config);
+		if (kResponse_OK == nResult)
+			m_queueConfig = config;
+	}
+
+	return nResult;
+}
+
+int GSkipBaseDevice::SetMeasurementSpillFile(
+	const cppstring &sFileName,	//[in] empty to stop spilling.
+	int nHighWatermark)			//[in] in packets.
+{
+	int nResult = kResponse_Error;
+	if (nHighWatermark < 0)
+		GSTD_TRACE("GSkipBaseDevice::SetMeasurementSpillFile - invalid high watermark.");
+	else
+		nResult = OSSetMeasurementSpillFile(sFileName, nHighWatermark);
+
+	return nResult;
+}
+
+int GSkipBaseDevice::StartRecording(
+	const cppstring &sFileName,				//[in]
+	const GSkipRecordingMetadata &metadata,	//[in] sensor and conversion info for the file.
+	int nOptions /* = 0 */)					//[in] ESkipRecorderOption flags.
+{
+	if ((NULL == m_pCallbackMutex) || m_pRecorder)
+		return kResponse_Error;
+
+	GSkipRecordingMetadata fullMetadata = metadata;
+	fullMetadata.nVendorId = GetPortRefPtr()->GetUSBVendorID();
+	fullMetadata.nProductId = GetPortRefPtr()->GetUSBProductID();
+	if (m_fMeasurementPeriod <= 0.0)
+		GetMeasurementPeriod();
+	fullMetadata.fMeasurementPeriod = m_fMeasurementPeriod;
+
+	GSkipRecorder *pRecorder = GSkipRecorder::Create(sFileName, fullMetadata, nOptions);
+	if (NULL == pRecorder)
+		return kResponse_Error;
+
+	int nResult = kResponse_Error;
+	if (GThread::OSLockMutex(m_pCallbackMutex))
+	{
+		if (NULL == m_pRecorder)
+		{
+			m_pRecorder = pRecorder;
+			pRecorder = NULL;
+			nResult = kResponse_OK;
+		}
+		GThread::OSUnlockMutex(m_pCallbackMutex);
+	}
+
+	if (pRecorder)
+		delete pRecorder;
+
+	return nResult;
+}
+
+int GSkipBaseDevice::StopRecording(void)
+{
+	GSkipRecorder *pRecorder = NULL;
+	if (m_pRecorder && GThread::OSLockMutex(m_pCallbackMutex))
+	{
+		pRecorder = m_pRecorder;
+		m_pRecorder = NULL;
+		GThread::OSUnlockMutex(m_pCallbackMutex);
+	}
+
+	//The listener thread no longer sees the recorder, so it can be finished off without holding up measurements.
+	if (pRecorder)
+		delete pRecorder;
+
+	return pRecorder ? kResponse_OK : kResponse_Error;
+}
+
+bool GSkipBaseDevice::GetRecordingStats(
+	GSkipRecorderStats *pStats)	//[out]
+{
+	bool bRecording = false;
+	if (m_pRecorder && GThread::OSLockMutex(m_pCallbackMutex))
+	{
+		if (m_pRecorder)
+		{
+			m_pRecorder->GetStats(pStats);
+			bRecording = true;
+		}
+		GThread::OSUnlockMutex(m_pCallbackMutex);
+	}
+
+	return bRecording;
+}
+
+int GSkipBaseDevice::StartPublishing(
+	const GSkipRecordingMetadata &metadata,	//[in] sensor and conversion info for the readers.
+	int nNumSlots /* = GSKIP_STREAM_DEFAULT_SLOTS */)	//[in] # of measurements the shared memory ring holds.
+{
+	if ((NULL == m_pCallbackMutex) || m_pPublisher)
+		return kResponse_Error;
+
+	GSkipRecordingMetadata fullMetadata = metadata;
+	fullMetadata.nVendorId = GetPortRefPtr()->GetUSBVendorID();
+	fullMetadata.nProductId = GetPortRefPtr()->GetUSBProductID();
+	if (m_fMeasurementPeriod <= 0.0)
+		GetMeasurementPeriod();
+	fullMetadata.fMeasurementPeriod = m_fMeasurementPeriod;
+
+	GSkipStreamPublisher *pPublisher = GSkipStreamPublisher::Create(GetPortRefPtr()->GetLocation(), fullMetadata, nNumSlots);
+	if (NULL == pPublisher)
+		return kResponse_Error;
+
+	int nResult = kResponse_Error;
+	if (GThread::OSLockMutex(m_pCallbackMutex))
+	{
+		if (NULL == m_pPublisher)
+		{
+			m_pPublisher = pPublisher;
+			pPublisher = NULL;
+			nResult = kResponse_OK;
+		}
+		GThread::OSUnlockMutex(m_pCallbackMutex);
+	}
+
+	if (pPublisher)
+		delete pPublisher;
+
+	return nResult;
+}
+
+int GSkipBaseDevice::StopPublishing(void)
+{
+	GSkipStreamPublisher *pPublisher = NULL;
+	if (m_pPublisher && GThread::OSLockMutex(m_pCallbackMutex))
+	{
+		pPublisher = m_pPublisher;
+		m_pPublisher = NULL;
+		GThread::OSUnlockMutex(m_pCallbackMutex);
+	}
+
+	if (pPublisher)
+		delete pPublisher;
+
+	return pPublisher ? kResponse_OK : kResponse_Error;
+}
+
+GSkipBroadcastConsumer *GSkipBaseDevice::AddBroadcastConsumer(
+	ESkipBroadcastPolicy ePolicy,	//[in]
+	int nNumSlots /* = GSKIP_BROADCAST_DEFAULT_SLOTS */)	//[in] only used by the first consumer.
+{
+	GSkipBroadcastConsumer *pConsumer = NULL;
+	if (m_pCallbackMutex && GThread::OSLockMutex(m_pCallbackMutex))
+	{
+		if (NULL == m_pBroadcast)
+		{
+			GSkipBroadcastBuffer *pBroadcast = new GSkipBroadcastBuffer(nNumSlots);
+			if (pBroadcast->IsValid())
+				m_pBroadcast = pBroadcast;
+			else
+				pBroadcast->Release();
+		}
+		if (m_pBroadcast)
+			pConsumer = m_pBroadcast->AddConsumer(ePolicy);
+		GThread::OSUnlockMutex(m_pCallbackMutex);
+	}
+
+	return pConsumer;
+}
+
+void GSkipBaseDevice::StopWaitingForBroadcastConsumers(void)
+{
+	//m_pBroadcast is never replaced or released while the device is open, so the mutex is not needed to read it.
+	GSkipBroadcastBuffer *pBroadcast = m_pBroadcast;
+	if (pBroadcast)
+		pBroadcast->StopWaitingForRoom();
+}
+
+void GSkipBaseDevice::GetLastCmdResponseStatus(
+	unsigned char *pLastCmd, 
+	unsigned char *pLastCmdStatus,
+	unsigned char *pLastCmdWithErrorRespSentOvertheWire, 
+	unsigned char *pLastErrorSentOvertheWire)
+{
+	*pLastCmd = m_lastCmd;
+	*pLastCmdStatus = m_lastCmdRespStatus;
+	*pLastCmdWithErrorRespSentOvertheWire = m_lastCmdWithErrorRespSentOvertheWire;
+	*pLastErrorSentOvertheWire = m_lastErrorSentOvertheWire;
+}
+
+int GSkipBaseDevice::ReadNonVolatileMemory(
+	bool bLocal,		//[in] Send SKIP_CMD_ID_READ_LOCAL_NV_MEM if true, else send SKIP_CMD_ID_READ_REMOTE_NV_MEM.
+	void *pBuf,			//[out] ptr to destination buffer.
+	unsigned int addr, //[in] addr of the first location in the NV memory to read.
+	unsigned int nBytesToRead,//[in]
+	int nTimeoutMs /* = 1000 */,//[in] # of milliseconds to wait before giving up.
+	bool *pExitFlag /* = NULL */)//[in] ptr to flag that another thread can set to force early exit. 
+						//		THIS FLAG MUST BE FALSE FOR THIS ROUTINE TO RUN.
+						//		Ignore this if NULL.
+{
+	unsigned int nMaxValidAddr = bLocal ? GetMaxLocalNonVolatileMemAddr() : GetMaxRemoteNonVolatileMemAddr();
+	GSTD_ASSERT((addr + nBytesToRead - 1) <= nMaxValidAddr);
+	GSkipReadI2CMemParams params;
+	params.addr = static_cast<unsigned char>(addr);
+	params.count = static_cast<unsigned char>(nBytesToRead);
+	int nBytesRead = nBytesToRead;
+
+	int nResult = SendCmdAndGetResponse(bLocal ? SKIP_CMD_ID_READ_LOCAL_NV_MEM : SKIP_CMD_ID_READ_REMOTE_NV_MEM,
+		&params, sizeof(params), pBuf, &nBytesRead, nTimeoutMs, pExitFlag);
+
+	if ((kResponse_OK == nResult) && (nBytesRead != (int)nBytesToRead))
+		nResult = kResponse_Error;
+
+	return nResult;
+}
+
+int GSkipBaseDevice::WriteNonVolatileMemory(
+	bool bLocal,		//[in] Send SKIP_CMD_ID_WRITE_NV_MEM if true, else send SKIP_CMD_ID_WRITE_REMOTE_NV_MEM
+	void *pBuf,			//[out] ptr to source buffer
+	unsigned int addr, //[in] addr of the first location in the NV memory to write.
+	unsigned int nBytesToWrite,//[in]
+	int nTimeoutMs /* = 1000 */,//[in] # of milliseconds to wait before giving up.
+	bool *pExitFlag /* = NULL */)//[in] ptr to flag that another thread can set to force early exit. 
+						//		THIS FLAG MUST BE FALSE FOR THIS ROUTINE TO RUN.
+						//		Ignore this if NULL.
+{
+	int nResult = kResponse_OK;
+	unsigned int nMaxValidAddr = bLocal ? GetMaxLocalNonVolatileMemAddr() : GetMaxRemoteNonVolatileMemAddr();
+	GSTD_ASSERT((addr + nBytesToWrite - 1) <= nMaxValidAddr);
+	GSkipWriteI2CMemParams params;
+	char *pSrcBuf = static_cast<char *>(pBuf);
+	bool *pMyExitFlag;
+	bool myExitFlag = false;
+	if (NULL == pExitFlag)
+		pMyExitFlag = &myExitFlag;
+	else
+		pMyExitFlag = pExitFlag;
+	unsigned char baseCmd = bLocal ? SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_1BYTE : SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_1BYTE;
+	unsigned char cmd;
+	unsigned int nBytesWritten = 0;
+	unsigned int nBytesToWriteThisPacket;
+
+	unsigned int nStartTime = GUtils::OSGetTimeStamp();
+	unsigned int nCurrentTime = GUtils::OSGetTimeStamp();
+
+	while (((nCurrentTime - nStartTime) <= ((unsigned int) nTimeoutMs)) &&
+			(!(*pMyExitFlag)) &&
+			(nBytesWritten < nBytesToWrite) &&
+			(kResponse_OK == nResult))
+	{
+		nBytesToWriteThisPacket = nBytesToWrite - nBytesWritten;
+		if (nBytesToWriteThisPacket > 6)
+			nBytesToWriteThisPacket = 6;
+		cmd = static_cast<unsigned char>(baseCmd + nBytesToWriteThisPacket - 1);
+		params.addr = static_cast<unsigned char>(addr + nBytesWritten);
+		memcpy(params.payload, &pSrcBuf[nBytesWritten], static_cast<size_t>(nBytesToWriteThisPacket));
+
+		nResult = SendCmdAndGetResponse(cmd, &params, sizeof(params), NULL, NULL, 
+			nTimeoutMs - (nCurrentTime - nStartTime), pMyExitFlag);
+
+		if (kResponse_OK == nResult)
+		{
+			nBytesWritten += nBytesToWriteThisPacket;
+			nCurrentTime = GUtils::OSGetTimeStamp();
+		}
+	}
+
+	if ((kResponse_OK == nResult) && (nBytesWritten != nBytesToWrite))
+		nResult = kResponse_Error;
+
+	return nResult;
+}
+
+int GSkipBaseDevice::SetMeasurementPeriod(real fPeriodInSeconds, int nTimeoutMs/* = 1000*/)
+{
+	GSTD_ASSERT(fPeriodInSeconds >= 0.0);
+	if (fPeriodInSeconds < GetMinimumMeasurementPeriodInSeconds())
+		fPeriodInSeconds = GetMinimumMeasurementPeriodInSeconds();
+	else
+	if (fPeriodInSeconds > GetMaximumMeasurementPeriodInSeconds())
+		fPeriodInSeconds = GetMaximumMeasurementPeriodInSeconds();
+
+	GSkipSetMeasurementPeriodParams params;
+	int	nNumTicks = (int) floor(fPeriodInSeconds/GetMeasurementTickInSeconds() + 0.5);
+	GUtils::OSConvertIntToBytes(nNumTicks, &params.lsbyteLswordMeasurementPeriod, &params.msbyteLswordMeasurementPeriod,
+		&params.lsbyteMswordMeasurementPeriod, &params.msbyteMswordMeasurementPeriod);
+
+	int nResult = SendCmdAndGetResponse(SKIP_CMD_ID_SET_MEASUREMENT_PERIOD, &params, sizeof(params), NULL, NULL, nTimeoutMs);
+	if (kResponse_OK == nResult)
+	{
+		m_fMeasurementPeriod = GetMeasurementTickInSeconds() * nNumTicks;
+		if ((m_pRecorder || m_pPublisher) && GThread::OSLockMutex(m_pCallbackMutex))
+		{
+			if (m_pRecorder)
+				m_pRecorder->SetMeasurementPeriod(m_fMeasurementPeriod);
+			if (m_pPublisher)
+				m_pPublisher->SetMeasurementPeriod(m_fMeasurementPeriod);
+			GThread::OSUnlockMutex(m_pCallbackMutex);
+		}
+	}
+
+	return nResult;
+}
+
+real GSkipBaseDevice::GetMeasurementPeriod(int nTimeoutMs/* = 1000*/)
+{
+	real fPeriodInSeconds = 1000000.0;
+	GSkipGetMeasurementPeriodCmdResponsePayload payload;
+	int nBytesRead = sizeof(payload);
+	int nResult = SendCmdAndGetResponse(SKIP_CMD_ID_GET_MEASUREMENT_PERIOD, NULL, 0, &payload, &nBytesRead, nTimeoutMs);
+	if (kResponse_OK == nResult)
+	{
+		int nNumTicks;
+		GUtils::OSConvertBytesToInt(payload.lsbyteLswordMeasurementPeriod, payload.msbyteLswordMeasurementPeriod,
+			payload.lsbyteMswordMeasurementPeriod, payload.msbyteMswordMeasurementPeriod, &nNumTicks);
+
+		fPeriodInSeconds = GetMeasurementTickInSeconds() * nNumTicks;
+		m_fMeasurementPeriod = fPeriodInSeconds;
+	}
+
+	return fPeriodInSeconds;
+}
+
+real GSkipBaseDevice::CalculateNearestLegalMeasurementPeriod(real fPeriodInSeconds)
+{
+	GSTD_ASSERT(fPeriodInSeconds >= 0.0);
+	real fAdjustedPeriod = fPeriodInSeconds;
+	int	nNumTicks = (int) floor(fPeriodInSeconds/GetMeasurementTickInSeconds() + 0.5);
+	fAdjustedPeriod = GetMeasurementTickInSeconds() * nNumTicks;
+
+	if (fAdjustedPeriod < GetMinimumMeasurementPeriodInSeconds())
+		fAdjustedPeriod = GetMinimumMeasurementPeriodInSeconds();
+	else
+	if (fAdjustedPeriod > GetMaximumMeasurementPeriodInSeconds())
+		fAdjustedPeriod = GetMaximumMeasurementPeriodInSeconds();
+
+	return fAdjustedPeriod;
+}
+
+#ifdef LIB_NAMESPACE
+}
+#endif
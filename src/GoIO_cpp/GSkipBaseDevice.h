@@ -1,165 +1,375 @@
-/*********************************************************************************
-
-Copyright (c) 2010, Vernier Software & Technology
-All rights reserved.
-
-Redistribution and use in source and binary forms, with or without
-modification, are permitted provided that the following conditions are met:
-    * Redistributions of source code must retain the above copyright
-      notice, this list of conditions and the following disclaimer.
-    * Redistributions in binary form must reproduce the above copyright
-      notice, this list of conditions and the following disclaimer in the
-      documentation and/or other materials provided with the distribution.
-    * Neither the name of Vernier Software & Technology nor the
-      names of its contributors may be used to endorse or promote products
-      derived from this software without specific prior written permission.
-
-THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
-ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
-WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
-DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
-(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
-LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
-ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
-(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-**********************************************************************************/
-// GSkipBaseDevice.h
-//
-
-#ifndef _GSKIPBASEDEVICE_H_
-#define _GSKIPBASEDEVICE_H_
-
-#include "GDeviceIO.h"
-
-#include "GSkipCommExt.h"
-#include "GCyclopsCommExt.h"
-#include "GSkipComm.h"
-#include "GMBLSensor.h"
-#include "GVernierUSB.h"
-#include "GCircularBuffer.h"
-
-#define SKIP_HOST_IO_STATUS_TIMED_OUT	1
-
-#ifdef LIB_NAMESPACE
-namespace LIB_NAMESPACE {
-#endif
-
-class GSkipBaseDevice : public GDeviceIO
-{
-public:
-						GSkipBaseDevice(GPortRef *pPortRef);
-
-	virtual				~GSkipBaseDevice(); 
-
-	virtual int			GetVendorID(void) = 0;
-	virtual int			GetProductID(void) = 0;
-
-	int 				Open(GPortRef *pPortRef);// override from GDeviceIO
-
-	// Platform specific routines:
-
-	// overrides from GDeviceIO:
-	bool				OSInitialize(void);
-	int 				OSOpen(GPortRef *pPortRef);
-	int					OSClose(void);
-	void				OSDestroy(void);
-
-	// Note that these are packet oriented, rather than byte oriented.
-	int					OSReadMeasurementPackets(void * pBuffer, int * pIONumPackets, int nBufferSizeInPackets);
-	int					OSReadCmdRespPackets(void * pBuffer, int * pIONumPackets, int nBufferSizeInPackets);
-	int 				OSWriteCmdPackets(void * pBuffer, int nNumPackets);
-
-	int					OSMeasurementPacketsAvailable(unsigned char *pNumMeasurementsInLastPacket = NULL);
-	int					OSCmdRespPacketsAvailable(void);
-
-	int 				OSClearIO(void);
-	int					OSClearMeasurementPacketQueue();
-	int					OSClearCmdRespPacketQueue();
-
-	int 				OSBytesAvailable(void); //not used - will assert!
-	int 				OSRead(void * /*pBuffer*/, int * /*pIONumBytes*/, int /*nBufferSize*/); //not used - will assert!
-	int 				OSWrite(void * /*pBuffer*/, int * /*pIONumBytes*/); //not used - will assert!
-
-	// End of platform specific routines.
-
-	int					SendCmd(unsigned char cmd, void *pParams, int nParamBytes);
-	int					GetNextResponse(void *pRespBuf, int *pnRespBytes, unsigned char *pCmd, bool *pErrRespFlag, 
-							int nTimeoutMs = 1000, bool *pExitFlag = NULL);
-	virtual int			SendCmdAndGetResponse(unsigned char cmd, void *pParams, int nParamBytes, void *pRespBuf, int *pnRespBytes, 
-							int nTimeoutMs = 1000, bool *pExitFlag = NULL);
-
-	void				GetLastCmdResponseStatus(unsigned char *pLastCmd, unsigned char *pLastCmdStatus,
-							unsigned char *pLastCmdWithErrorRespSentOvertheWire, unsigned char *pLastErrorSentOvertheWire);
-
-	int					ReadNonVolatileMemory(bool bLocal, void *pBuf, unsigned int addr, unsigned int nBytesToRead,
-							int nTimeoutMs = 1000, bool *pExitFlag = NULL);
-	int					WriteNonVolatileMemory(bool bLocal, void *pBuf, unsigned int addr, unsigned int nBytesToRead,
-							int nTimeoutMs = 1000, bool *pExitFlag = NULL);
-
-	virtual unsigned int	GetMaxLocalNonVolatileMemAddr(void) = 0;
-	virtual unsigned int	GetMaxRemoteNonVolatileMemAddr(void) = 0;
-
-	virtual	int			ReadSensorDDSMemory(unsigned char * /*pBuf*/, unsigned int /*ddsAddr*/, unsigned int /*nBytesToRead*/, 
-							int nTimeoutMs = 1000, bool *pExitFlag = NULL) = 0;
-	virtual	int			WriteSensorDDSMemory(unsigned char * /*pBuf*/, unsigned int /*ddsAddr*/, unsigned int /*nBytesToWrites*/,
-							int nTimeoutMs = 1000, bool *pExitFlag = NULL) = 0;
-
-	virtual real		GetMeasurementTickInSeconds(void) = 0; 
-	real				CalculateNearestLegalMeasurementPeriod(real fPeriodInSeconds);
-	int					SetMeasurementPeriod(real fPeriodInSeconds, int nTimeoutMs = 1000);
-	real				GetMeasurementPeriod(int nTimeoutMs = 1000);
-
-	virtual real		GetMinimumMeasurementPeriodInSeconds(void) = 0;
-	virtual real		GetMaximumMeasurementPeriodInSeconds(void) = 0;
-
-	int					MeasurementsAvailable(void);
-	virtual intVector	ReadRawMeasurements(int count = -1);
-    bool                AreMeasurementsEnabled() { return m_bIsMeasuring; }
-
-	int					GetLatestRawMeasurement(void);
-
-	unsigned int		GetHostIOStatus() { return m_hostIOStatus;}
-
-	virtual real		ConvertToVoltage(int raw, EProbeType eProbeType, bool bCalibrateADCReading = true) = 0;
-
-	void				SetDiagnosticsFlag(bool bFlag) { m_bDiagnosticsEnabled = bFlag; }
-	bool				GetDiagnosticsFlag() { return m_bDiagnosticsEnabled; }
-	GCircularBuffer		*GetDiagnosticInputBufferPtr() { return m_diagnosticInputBufferPtr; }
-	GCircularBuffer		*GetDiagnosticOutputBufferPtr() { return m_diagnosticOutputBufferPtr; }
-
-	static StringVector OSGetAvailableDevicesOfType(int nVendorID, int nProductID);
-
-protected:
-	virtual int			GetInitCmdResponse(void *pRespBuf, int *pnRespBytes, int nTimeoutMs = 1000, bool *pExitFlag = NULL);
-
-	static real			kVoltsPerBit_ProbeTypeAnalog5V;
-	static real			kVoltsOffset_ProbeTypeAnalog5V;
-	static real			kVoltsPerBit_ProbeTypeAnalog10V;
-	static real			kVoltsOffset_ProbeTypeAnalog10V;
-
-	int					m_nLatestRawMeasurement;
-    bool                m_bIsMeasuring;
-	unsigned int		m_hostIOStatus;
-	unsigned char		m_lastCmd;
-	unsigned char		m_lastCmdRespStatus;
-	unsigned char		m_lastCmdWithErrorRespSentOvertheWire;
-	unsigned char		m_lastErrorSentOvertheWire;
-	bool				m_bDiagnosticsEnabled;
-	GCircularBuffer		*m_diagnosticInputBufferPtr;
-	GCircularBuffer		*m_diagnosticOutputBufferPtr;
-	GPriorityMutex		*m_pTraceQueueAccessMutex;
-		
-private:
-	typedef GDeviceIO TBaseClass;
-	
-};
-
-#ifdef LIB_NAMESPACE
-}
-#endif
-
-#endif // _GSKIPBASEDEVICE_H_
-
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipBaseDevice.h
+//
+
+#ifndef _GSKIPBASEDEVICE_H_
+#define _GSKIPBASEDEVICE_H_
+
+#include "GDeviceIO.h"
+
+#include "GSkipCommExt.h"
+#include "GCyclopsCommExt.h"
+#include "GSkipComm.h"
+#include "GMBLSensor.h"
+#include "GVernierUSB.h"
+#include "GCircularBuffer.h"
+#include "GSkipRecorder.h"
+#include "GSkipStream.h"
+#include "GSkipBroadcast.h"
+
+#define SKIP_HOST_IO_STATUS_TIMED_OUT	1
+
+#define SKIP_MAX_MEASUREMENTS_PER_PACKET 3
+
+#define SKIP_DEFAULT_MEASUREMENT_QUEUE_CAPACITY 1999 //packets
+#define SKIP_MAX_MEASUREMENT_QUEUE_CAPACITY 1000000 //packets
+#define SKIP_SPILL_REFILL_RECS 256 //max packets moved from a spill file back to the measurement queue at once
+
+#define SKIP_CMD_LATENCY_NUM_BUCKETS 24
+#define SKIP_CMD_LATENCY_LAST_CMD_ID SKIP_CMD_ID_GET_TEMPERATURE //Includes the Go! Motion specific cmds.
+#define SKIP_CMD_LATENCY_NUM_CMDS (SKIP_CMD_LATENCY_LAST_CMD_ID - FIRST_SKIP_CMD_ID + 1)
+
+// SendCmdAndGetResponse() statistics for one command id. Histogram bucket k counts latencies from 2^k to 2^(k+1) - 1
+// microseconds, except that bucket 0 also counts anything faster and the last bucket anything slower.
+struct GSkipCmdLatencyStats
+{
+	int nNumCmds;
+	int nNumTimeouts;//no complete response arrived in time.
+	int nNumErrors;//the device reported an error, or the response did not match the cmd.
+	int nNumRetries;//extra copies of the cmd sent, e.g. SKIP_CMD_ID_INIT while a Go! Link powers up.
+	int firstPacketHistogram[SKIP_CMD_LATENCY_NUM_BUCKETS];//cmd sent -> first response packet read.
+	int completeHistogram[SKIP_CMD_LATENCY_NUM_BUCKETS];//cmd first sent -> response complete, including retries.
+};
+
+// What the listener does with a measurement packet that arrives when the measurement queue is full.
+enum ESkipQueueOverflowPolicy
+{
+	kSkipQueueOverflow_DropOldest = 0,//discard the oldest queued packet.
+	kSkipQueueOverflow_DropNewest,//discard the new packet.
+	kSkipQueueOverflow_BlockProducer,//wait up to nBlockTimeoutMs for space, then discard the new packet.
+	kSkipQueueOverflow_NumPolicies
+};
+
+struct GSkipQueueConfig
+{
+	int nCapacity;//in packets.
+	ESkipQueueOverflowPolicy eOverflowPolicy;
+	int nBlockTimeoutMs;//only used by kSkipQueueOverflow_BlockProducer.
+};
+
+// Always on I/O counters for one device. Each counter has a single writer(the listener thread, or the thread that
+// holds the device lock), so they are maintained without locks or atomics.
+struct GSkipIOCounters
+{
+	unsigned long long nMeasurementPacketsReceived;
+	unsigned long long nCmdRespPacketsReceived;
+	unsigned long long nInitRespPacketsReceived;//subset of nCmdRespPacketsReceived.
+	unsigned long long nPacketsDropped;//discarded because the measurement or cmd response queue was full.
+	unsigned long long nRollingCounterGaps;//measurement packets that did not follow on from the previous one.
+	unsigned long long nReadErrors;
+	unsigned long long nWriteErrors;
+	unsigned long long nWriteTimeouts;//subset of nWriteErrors.
+	unsigned long long nBytesWritten;
+	unsigned long long nQueueOverflows;//measurement packets that arrived while the measurement queue was full.
+	unsigned long long nProducerBlockedMs;//total time the listener waited for measurement queue space.
+	unsigned long long nPacketsSpilled;//measurement packets written to the spill file.
+	unsigned long long nSpillErrors;//measurement packets lost because the spill file could not be written.
+	int nQueueHighWaterMark;//most measurements queued at once.
+	int nConsumerLagMeasurements;//measurements queued right now, filled in by GetIOCounters().
+	unsigned int nConsumerLagMs;//ms since the app last retrieved measurements, 0 if none are queued.
+};
+
+// Routine called from the device's listener thread with a batch of decoded raw measurements.
+// See GSkipBaseDevice::SetMeasurementCallback().
+typedef void (*GSkipMeasurementCallbackPtr)(void *pContext, const int *pMeasurements, int nNumMeasurements);
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+class GSkipBaseDevice : public GDeviceIO
+{
+public:
+						GSkipBaseDevice(GPortRef *pPortRef);
+
+	virtual				~GSkipBaseDevice(); 
+
+	virtual int			GetVendorID(void) = 0;
+	virtual int			GetProductID(void) = 0;
+
+	int 				Open(GPortRef *pPortRef);// override from GDeviceIO
+	int					ClearIO(void);// override from GDeviceIO
+
+	// Platform specific routines:
+
+	// overrides from GDeviceIO:
+	bool				OSInitialize(void);
+	int 				OSOpen(GPortRef *pPortRef);
+	int					OSClose(void);
+	void				OSDestroy(void);
+
+	// Note that these are packet oriented, rather than byte oriented.
+	int					OSReadMeasurementPackets(void * pBuffer, int * pIONumPackets, int nBufferSizeInPackets);
+	int					OSReadCmdRespPackets(void * pBuffer, int * pIONumPackets, int nBufferSizeInPackets);
+	int 				OSWriteCmdPackets(void * pBuffer, int nNumPackets);
+
+	int					OSMeasurementPacketsAvailable(unsigned char *pNumMeasurementsInLastPacket = NULL);
+	int					OSCmdRespPacketsAvailable(void);
+	int					OSMeasurementsAvailable(void);//exact # of measurements in the queue, does not lock the device.
+	int					OSSetMeasurementQueueConfig(const GSkipQueueConfig &config);
+	int					OSSetMeasurementSpillFile(const cppstring &sFileName, int nHighWatermark);
+
+	int 				OSClearIO(void);
+	int					OSClearMeasurementPacketQueue();
+	int					OSClearCmdRespPacketQueue();
+
+	int 				OSBytesAvailable(void); //not used - will assert!
+	int 				OSRead(void * /*pBuffer*/, int * /*pIONumBytes*/, int /*nBufferSize*/); //not used - will assert!
+	int 				OSWrite(void * /*pBuffer*/, int * /*pIONumBytes*/); //not used - will assert!
+
+	// End of platform specific routines.
+
+	int					SendCmd(unsigned char cmd, void *pParams, int nParamBytes);
+	int					GetNextResponse(void *pRespBuf, int *pnRespBytes, unsigned char *pCmd, bool *pErrRespFlag, 
+							int nTimeoutMs = 1000, bool *pExitFlag = NULL);
+	virtual int			SendCmdAndGetResponse(unsigned char cmd, void *pParams, int nParamBytes, void *pRespBuf, int *pnRespBytes, 
+							int nTimeoutMs = 1000, bool *pExitFlag = NULL);
+
+	void				GetLastCmdResponseStatus(unsigned char *pLastCmd, unsigned char *pLastCmdStatus,
+							unsigned char *pLastCmdWithErrorRespSentOvertheWire, unsigned char *pLastErrorSentOvertheWire);
+
+	// Recording only uses atomic increments, so these may be called from any thread without locking the device,
+	// even while another thread is blocked in SendCmdAndGetResponse().
+	bool				GetCmdLatencyStats(unsigned char cmd, GSkipCmdLatencyStats *pStats);//false if cmd is not a known cmd id.
+	void				ResetCmdLatencyStats(void);
+	static int			GetCmdLatencyBucket(unsigned long long latencyUs);
+
+	// Like the cmd latency stats, these may be read from any thread without locking the device.
+	void				GetIOCounters(GSkipIOCounters *pCounters);
+
+	// The measurement queue may be reconfigured before or after Open(). Shrinking it keeps the newest packets.
+	// Returns kResponse_Error if the config is invalid or the platform does not support it.
+	int					SetMeasurementQueueConfig(const GSkipQueueConfig &config);
+	void				GetMeasurementQueueConfig(GSkipQueueConfig *pConfig) { (*pConfig) = m_queueConfig; }
+
+	// Once nHighWatermark packets are queued, further packets are appended to sFileName until the app has read
+	// them all, so a slow app costs disk space instead of measurements. An empty sFileName stops spilling, which
+	// fails while spilled packets are still waiting to be read. Returns kResponse_Error if the file cannot be created
+	// or the platform does not support spilling.
+	int					SetMeasurementSpillFile(const cppstring &sFileName, int nHighWatermark);
+
+	// Stream every measurement that arrives to a recording file(see GSkipRecorder.h), as well as delivering it as
+	// usual. The vendor id, product id and measurement period in metadata are filled in here. Returns kResponse_Error
+	// if a recording is already in progress or the file cannot be created. nOptions are ESkipRecorderOption flags.
+	int					StartRecording(const cppstring &sFileName, const GSkipRecordingMetadata &metadata, int nOptions = 0);
+	int					StopRecording(void);//kResponse_Error if nothing was being recorded.
+	bool				GetRecordingStats(GSkipRecorderStats *pStats);//false if nothing is being recorded.
+
+	// Publish every measurement that arrives to shared memory named after the device(see GSkipStream.h), so that
+	// other processes can read it with GSkipStreamReader, as well as delivering it as usual. The vendor id, product
+	// id and measurement period in metadata are filled in here. Returns kResponse_Error if the device is already
+	// being published or the shared memory cannot be created.
+	int					StartPublishing(const GSkipRecordingMetadata &metadata, int nNumSlots = GSKIP_STREAM_DEFAULT_SLOTS);
+	int					StopPublishing(void);//kResponse_Error if nothing was being published.
+	bool				IsPublishing(void) { return (NULL != m_pPublisher); }
+
+	// Fan the measurements out to consumers in this process, each with its own cursor(see GSkipBroadcast.h), as
+	// well as delivering them as usual. The broadcast buffer is created with nNumSlots slots along with the first
+	// consumer, and stays until the device is destroyed. Consumers outlive the device, and are removed with 
+	// GSkipBroadcastBuffer::RemoveConsumer(). Returns NULL if the buffer cannot be created.
+	GSkipBroadcastConsumer *AddBroadcastConsumer(ESkipBroadcastPolicy ePolicy, int nNumSlots = GSKIP_BROADCAST_DEFAULT_SLOTS);
+	// The listener has to get command responses past the broadcast buffer, so SendCmd() and OSClose() call this to
+	// stop it waiting for kSkipBroadcastPolicy_Block consumers(see GSkipBroadcastBuffer::StopWaitingForRoom()).
+	void				StopWaitingForBroadcastConsumers(void);
+
+	// Identifies this device in GTimeline events. Unique for the life of the process.
+	unsigned int		GetTimelineId(void) { return m_nTimelineId; }
+
+	int					ReadNonVolatileMemory(bool bLocal, void *pBuf, unsigned int addr, unsigned int nBytesToRead,
+							int nTimeoutMs = 1000, bool *pExitFlag = NULL);
+	int					WriteNonVolatileMemory(bool bLocal, void *pBuf, unsigned int addr, unsigned int nBytesToRead,
+							int nTimeoutMs = 1000, bool *pExitFlag = NULL);
+
+	virtual unsigned int	GetMaxLocalNonVolatileMemAddr(void) = 0;
+	virtual unsigned int	GetMaxRemoteNonVolatileMemAddr(void) = 0;
+
+	virtual	int			ReadSensorDDSMemory(unsigned char * /*pBuf*/, unsigned int /*ddsAddr*/, unsigned int /*nBytesToRead*/, 
+							int nTimeoutMs = 1000, bool *pExitFlag = NULL) = 0;
+	virtual	int			WriteSensorDDSMemory(unsigned char * /*pBuf*/, unsigned int /*ddsAddr*/, unsigned int /*nBytesToWrites*/,
+							int nTimeoutMs = 1000, bool *pExitFlag = NULL) = 0;
+
+	virtual real		GetMeasurementTickInSeconds(void) = 0; 
+	real				CalculateNearestLegalMeasurementPeriod(real fPeriodInSeconds);
+	int					SetMeasurementPeriod(real fPeriodInSeconds, int nTimeoutMs = 1000);
+	real				GetMeasurementPeriod(int nTimeoutMs = 1000);
+
+	virtual real		GetMinimumMeasurementPeriodInSeconds(void) = 0;
+	virtual real		GetMaximumMeasurementPeriodInSeconds(void) = 0;
+
+	int					MeasurementsAvailable(void);//exact count of queued measurements, does not lock the queue.
+	virtual intVector	ReadRawMeasurements(int count = -1);
+	int					ReadRawMeasurementsToBuffer(int *pMeasurementsBuf, int nMaxCount);//returns # of measurements copied.
+    bool                AreMeasurementsEnabled() { return m_bIsMeasuring; }
+
+	// The listener thread publishes each measurement as it arrives, so by default this does not touch the 
+	// measurement queue. Set bDrainQueue to also empty the queue, as older versions of this routine did.
+	int					GetLatestRawMeasurement(unsigned int *pTimeStampMs = NULL, bool bDrainQueue = false);
+
+	// Push mode: while a callback is installed, measurement packets are decoded on the listener thread and handed
+	// to the callback instead of being stored in the measurement packet queue. Callbacks for a device never overlap.
+	int					SetMeasurementCallback(GSkipMeasurementCallbackPtr pCallback, void *pContext, 
+							int nMinBatchSize = 1, int nMaxLatencyMs = 0);
+	bool				IsMeasurementCallbackInstalled() { return (NULL != m_pMeasurementCallback); }
+	virtual int			DecodeMeasurementPacket(const GSkipPacket *pPacket, int *pMeasurements);//returns # of measurements.
+
+	// Readiness fd: signalled when the measurement queue reaches the watermark or a cmd response arrives.
+	int					GetReadinessFd(void);//Created on first use, -1 if not supported.
+	void				SetReadinessWatermark(int nMinMeasurements) { m_nReadinessWatermark = (nMinMeasurements > 0) ? nMinMeasurements : 1; }
+
+	// Block until at least nMinMeasurements are queued for any one of the specified devices, or nTimeoutMs elapses.
+	// Caller must hold the device locks on entry. They are released while waiting and are not held on return.
+	// Returns the index of the first ready device, or -1 on timeout or if a device is being closed.
+	// If pNumAvailable is not NULL, it is set to the # of measurements queued for the first device.
+	static int			WaitForMeasurements(GSkipBaseDevice **ppDevices, int nNumDevices, int nMinMeasurements, int nTimeoutMs,
+							int *pNumAvailable = NULL);
+	// Wake up the threads in WaitForMeasurements() on this device and wait for them to leave. 
+	// Caller must hold the device lock, and call this before closing the device.
+	void				ReleaseMeasurementWaiters(void);
+
+	// Called by the platform specific listener thread only:
+	bool				OnMeasurementPacketReceived(GSkipPacket *pPacket, int *pNumMeasurementsInPacket);//returns true if the packet was consumed.
+	void				OnMeasurementPacketQueued(int nMeasurementsQueued);
+	void				OnCmdRespPacketQueued(const GSkipPacket *pPacket);
+	void				OnListenerIdle(void);
+	void				OnPacketsDropped(int nNumPackets);
+	void				OnMeasurementQueueFull(unsigned int nWaitMs);
+	void				OnMeasurementPacketSpilled(bool bSuccess) { if (bSuccess) m_ioCounters.nPacketsSpilled++; else m_ioCounters.nSpillErrors++; }
+	void				OnReadError(void) { m_ioCounters.nReadErrors++; }
+	// Called by the platform specific routines that remove measurement packets from the queue:
+	void				OnMeasurementPacketsRetrieved(void);
+
+	unsigned int		GetHostIOStatus() { return m_hostIOStatus;}
+
+	virtual real		ConvertToVoltage(int raw, EProbeType eProbeType, bool bCalibrateADCReading = true) = 0;
+
+	void				SetDiagnosticsFlag(bool bFlag) { m_bDiagnosticsEnabled = bFlag; }
+	bool				GetDiagnosticsFlag() { return m_bDiagnosticsEnabled; }
+	GCircularBuffer		*GetDiagnosticInputBufferPtr() { return m_diagnosticInputBufferPtr; }
+	GCircularBuffer		*GetDiagnosticOutputBufferPtr() { return m_diagnosticOutputBufferPtr; }
+
+	static StringVector OSGetAvailableDevicesOfType(int nVendorID, int nProductID);
+
+protected:
+	virtual int			GetInitCmdResponse(void *pRespBuf, int *pnRespBytes, int nTimeoutMs = 1000, bool *pExitFlag = NULL);
+	void				FlushMeasurementCallbackBatch(void);//Caller must hold m_pCallbackMutex.
+	bool				IsCallbackBatchStale(void);//Caller must hold m_pCallbackMutex.
+	void				PublishLatestRawMeasurement(int nMeasurement, unsigned int timeStampMs);//Single writer only.
+	void				RecordCmdFirstPacket(void);//Call as each response packet is read, only the first one per cmd counts.
+	void				RecordCmdResult(unsigned char cmd, int nResult, bool bTimedOut, int nNumRetries = 0);
+	int					TakeLeftoverMeasurements(int *pMeasurementsBuf, int nMaxCount);//Caller must hold the device lock.
+	void				DiscardLeftoverMeasurements(void) { m_leftoverMeasurements.clear(); m_nNumLeftoverMeasurements = 0; }
+
+	static real			kVoltsPerBit_ProbeTypeAnalog5V;
+	static real			kVoltsOffset_ProbeTypeAnalog5V;
+	static real			kVoltsPerBit_ProbeTypeAnalog10V;
+	static real			kVoltsOffset_ProbeTypeAnalog10V;
+
+	// Seqlock: m_nLatestRawMeasurementSeq is odd while an update is in progress.
+	volatile int		m_nLatestRawMeasurementSeq;
+	volatile int		m_nLatestRawMeasurement;
+	volatile unsigned int m_latestRawMeasurementTimeMs;
+    bool                m_bIsMeasuring;
+	unsigned int		m_hostIOStatus;
+	unsigned char		m_lastCmd;
+	unsigned char		m_lastCmdRespStatus;
+	unsigned char		m_lastCmdWithErrorRespSentOvertheWire;
+	unsigned char		m_lastErrorSentOvertheWire;
+	unsigned long long	m_cmdStartTimeUs;//when SendCmdAndGetResponse() first sent the current cmd.
+	unsigned long long	m_cmdSentTimeUs;//when SendCmd() last sent a cmd.
+	bool				m_bCmdFirstPacketRecorded;
+	GSkipCmdLatencyStats m_cmdLatencyStats[SKIP_CMD_LATENCY_NUM_CMDS];
+	GSkipIOCounters		m_ioCounters;
+	GSkipQueueConfig	m_queueConfig;
+	unsigned char		m_nextRollingCounter;
+	bool				m_bRollingCounterValid;//false until a measurement packet arrives after measurements (re)start.
+	volatile unsigned int m_lastMeasurementsRetrievedTimeMs;
+	unsigned int		m_nTimelineId;
+	bool				m_bDiagnosticsEnabled;
+	GCircularBuffer		*m_diagnosticInputBufferPtr;
+	GCircularBuffer		*m_diagnosticOutputBufferPtr;
+	GPriorityMutex		*m_pTraceQueueAccessMutex;
+
+	OSMutex				m_pCallbackMutex;
+	GSkipMeasurementCallbackPtr m_pMeasurementCallback;
+	void				*m_pMeasurementCallbackContext;
+	int					m_nCallbackMinBatchSize;
+	int					m_nCallbackMaxLatencyMs;
+	intVector			m_callbackBatch;
+	unsigned int		m_callbackBatchStartTimeMs;
+	GSkipRecorder		*m_pRecorder;//also protected by m_pCallbackMutex.
+	GSkipStreamPublisher *m_pPublisher;//also protected by m_pCallbackMutex.
+	GSkipBroadcastBuffer *m_pBroadcast;//set under m_pCallbackMutex, then kept until the device is destroyed.
+	real				m_fMeasurementPeriod;//last period set or read, 0.0 until then.
+
+	// Tail of a packet that ReadRawMeasurementsToBuffer() decoded but could not fit in the caller's buffer. It is
+	// returned ahead of the queue by the next read. Protected by the device lock, MeasurementsAvailable() reads the count.
+	intVector			m_leftoverMeasurements;
+	volatile int		m_nNumLeftoverMeasurements;
+
+	struct GMeasurementWaiter
+	{
+		OSEvent			event;
+		int				nMinMeasurements;
+	};
+	void				AddMeasurementWaiter(GMeasurementWaiter *pWaiter);
+	void				RemoveMeasurementWaiter(GMeasurementWaiter *pWaiter);
+
+	OSMutex				m_pWaitersMutex;
+	std::vector<GMeasurementWaiter *> m_measurementWaiters;
+	volatile int		m_nNumMeasurementWaiters;
+	volatile bool		m_bMeasurementWaitersReleased;//set by ReleaseMeasurementWaiters().
+
+	void				FireReadinessFd(void);//signal m_readinessFd if armed, and disarm it.
+
+	int					m_readinessFd;
+	int					m_nReadinessWatermark;
+	volatile bool		m_bReadinessArmed;//test and clear under m_pWaitersMutex.
+		
+private:
+	typedef GDeviceIO TBaseClass;
+	
+};
+
+#ifdef LIB_NAMESPACE
+}
+#endif
+
+#endif // _GSKIPBASEDEVICE_H_
+
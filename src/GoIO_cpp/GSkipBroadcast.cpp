@@ -0,0 +1,484 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipBroadcast.cpp
+
+#include "stdafx.h"
+#include "GSkipBroadcast.h"
+#include "GUtils.h"
+
+#ifdef _DEBUG
+#include "GPlatformDebug.h" // for DEBUG_NEW definition
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+#define GSKIP_BROADCAST_WAIT_POLL_MS 10
+
+GSkipBroadcastBuffer::GSkipBroadcastBuffer(
+	int nNumSlots /* = GSKIP_BROADCAST_DEFAULT_SLOTS */)	//[in]
+{
+	m_pMeasurements = NULL;
+	m_pTimesUs = NULL;
+	m_nNumSlots = 0;
+	m_bMirrored = false;
+	m_pMeasurementsMapping = NULL;
+	m_pTimesMapping = NULL;
+	m_nWriteStart = 0;
+	m_nWriteEnd = 0;
+	m_bAttached = true;
+	m_pMutex = GThread::OSCreateMutex(GSTD_S(""));
+	m_nNumConsumers = 0;
+	m_nNumBlockingConsumers = 0;
+	m_nRefCount = 1;
+	m_roomEvent = GThread::OSCreateEvent();
+	m_bWriterWaiting = 0;
+	m_bStopWaiting = 0;
+	m_nMaxSlowestLag = 0;
+	m_nNumWritten = 0;
+	m_nBlockedUs = 0;
+	m_nNumBlockTimeouts = 0;
+
+	if ((nNumSlots > 0) && (nNumSlots <= GSKIP_BROADCAST_MAX_SLOTS) && m_pMutex && m_roomEvent)
+	{
+		m_nNumSlots = 1;
+		while (m_nNumSlots < (unsigned int) nNumSlots)
+			m_nNumSlots <<= 1;
+
+		//Map the rings twice where the OS allows, so that consumers get contiguous spans across the wrap. The 
+		//mapping unit is a power of 2 too, so a small ring just grows to fill it.
+		unsigned int nNumBytes = 0;
+		m_pMeasurements = (int *) GUtils::OSAllocMirroredMemory(m_nNumSlots*sizeof(int), &nNumBytes, 
+			&m_pMeasurementsMapping);
+		if (m_pMeasurements)
+		{
+			m_nNumSlots = nNumBytes/sizeof(int);
+			m_pTimesUs = (unsigned long long *) GUtils::OSAllocMirroredMemory(m_nNumSlots*sizeof(unsigned long long), 
+				&nNumBytes, &m_pTimesMapping);
+			if (m_pTimesUs && (nNumBytes == m_nNumSlots*sizeof(unsigned long long)))
+				m_bMirrored = true;
+			else
+			{
+				if (m_pTimesUs)
+					GUtils::OSFreeMirroredMemory((unsigned char *) m_pTimesUs, nNumBytes, m_pTimesMapping);
+				GUtils::OSFreeMirroredMemory((unsigned char *) m_pMeasurements, m_nNumSlots*sizeof(int), 
+					m_pMeasurementsMapping);
+				m_pTimesUs = NULL;
+				m_pMeasurements = NULL;
+			}
+		}
+		if (!m_bMirrored)
+		{
+			m_pMeasurements = new int[m_nNumSlots];
+			m_pTimesUs = new unsigned long long[m_nNumSlots];
+		}
+	}
+}
+
+GSkipBroadcastBuffer::~GSkipBroadcastBuffer()
+{
+	GSTD_ASSERT(m_consumers.empty());
+	if (m_bMirrored)
+	{
+		GUtils::OSFreeMirroredMemory((unsigned char *) m_pMeasurements, m_nNumSlots*sizeof(int), m_pMeasurementsMapping);
+		GUtils::OSFreeMirroredMemory((unsigned char *) m_pTimesUs, m_nNumSlots*sizeof(unsigned long long), m_pTimesMapping);
+	}
+	else
+	{
+		delete [] m_pMeasurements;
+		delete [] m_pTimesUs;
+	}
+	if (m_roomEvent)
+		GThread::OSDestroyEvent(m_roomEvent);
+	if (m_pMutex)
+		GThread::OSDestroyMutex(m_pMutex);
+}
+
+void GSkipBroadcastBuffer::AddRef(void)
+{
+	GThread::OSLockMutex(m_pMutex);
+	m_nRefCount++;
+	GThread::OSUnlockMutex(m_pMutex);
+}
+
+void GSkipBroadcastBuffer::Release(void)
+{
+	GThread::OSLockMutex(m_pMutex);
+	bool bDelete = (0 == --m_nRefCount);
+	GThread::OSUnlockMutex(m_pMutex);
+	if (bDelete)
+		delete this;
+}
+
+unsigned int GSkipBroadcastBuffer::GetSlowestReadPos(
+	bool bBlockingOnly)	//[in] only count blocking consumers that the writer is still waiting for.
+{
+	unsigned int nWriteEnd = m_nWriteEnd;
+	unsigned int nMaxLag = 0;
+	for (size_t i = 0; i < m_consumers.size(); i++)
+	{
+		GSkipBroadcastConsumer *pConsumer = m_consumers[i];
+		if (bBlockingOnly && ((kSkipBroadcastPolicy_Block != pConsumer->m_ePolicy) || pConsumer->m_bStalled))
+			continue;
+		unsigned int nLag = nWriteEnd - pConsumer->m_nReadPos;
+		if (nLag > m_nNumSlots)
+			nLag = m_nNumSlots;//the rest are lost rather than pending.
+		if (nLag > nMaxLag)
+			nMaxLag = nLag;
+	}
+
+	return nWriteEnd - nMaxLag;
+}
+
+void GSkipBroadcastBuffer::WaitForRoom(
+	int nNumMeasurements)	//[in]
+{
+	unsigned long long startTimeUs = GUtils::OSGetTimeStampMicroseconds();
+	bool bWaited = false;
+	for (;;)
+	{
+		GThread::OSLockMutex(m_pMutex);
+		unsigned int nLag = m_nWriteEnd - GetSlowestReadPos(true);
+		bool bRoom = ((nLag + nNumMeasurements) <= m_nNumSlots);
+		unsigned long long elapsedUs = GUtils::OSGetTimeStampMicroseconds() - startTimeUs;
+		if ((!bRoom) && (m_bStopWaiting || (elapsedUs >= GSKIP_BROADCAST_BLOCK_TIMEOUT_MS*1000ULL)))
+		{
+			//Stop waiting for the consumers in the way until they read again.
+			for (size_t i = 0; i < m_consumers.size(); i++)
+			{
+				GSkipBroadcastConsumer *pConsumer = m_consumers[i];
+				if ((kSkipBroadcastPolicy_Block == pConsumer->m_ePolicy) && 
+						((m_nWriteEnd - pConsumer->m_nReadPos + nNumMeasurements) > m_nNumSlots))
+					pConsumer->m_bStalled = true;
+			}
+			m_nNumBlockTimeouts++;
+			m_bStopWaiting = 0;
+			GSTD_TRACE(GSTD_S("GSkipBroadcastBuffer::WaitForRoom - gave up waiting for a blocking consumer."));
+			bRoom = true;
+		}
+		if (bRoom && bWaited)
+			m_nBlockedUs += elapsedUs;
+		GThread::OSUnlockMutex(m_pMutex);
+		if (bRoom)
+			break;
+
+		//Consumers only set the event while m_bWriterWaiting is set, so poll as well in case they just missed it.
+		m_bWriterWaiting = 1;
+		bWaited = true;
+		GThread::OSMemoryBarrier();
+		GThread::OSWaitEvent(m_roomEvent, GSKIP_BROADCAST_WAIT_POLL_MS);
+	}
+	m_bWriterWaiting = 0;
+}
+
+void GSkipBroadcastBuffer::AddMeasurements(
+	const int *pMeasurements,	//[in]
+	int nNumMeasurements)		//[in]
+{
+	if ((nNumMeasurements <= 0) || (0 == m_nNumConsumers))
+		return;
+	if (nNumMeasurements > (int) m_nNumSlots)
+	{
+		pMeasurements += nNumMeasurements - m_nNumSlots;
+		nNumMeasurements = m_nNumSlots;
+	}
+	if (m_nNumBlockingConsumers > 0)
+		WaitForRoom(nNumMeasurements);
+
+	unsigned long long timeUs = GUtils::OSGetTimeStampMicroseconds();
+	unsigned int nMask = m_nNumSlots - 1;
+	unsigned int nStart = m_nWriteEnd;
+	unsigned int nEnd = nStart + nNumMeasurements;
+
+	//Claim the slots before touching them, so that consumers can tell which of their copies may be torn.
+	m_nWriteStart = nEnd;
+	GThread::OSMemoryBarrier();
+	for (int i = 0; i < nNumMeasurements; i++)
+	{
+		unsigned int nSlot = (nStart + i) & nMask;
+		m_pMeasurements[nSlot] = pMeasurements[i];
+		m_pTimesUs[nSlot] = timeUs;
+	}
+	GThread::OSMemoryBarrier();
+	m_nWriteEnd = nEnd;
+
+	GThread::OSLockMutex(m_pMutex);
+	m_nNumWritten += nNumMeasurements;
+	unsigned int nSlowestLag = nEnd - GetSlowestReadPos(false);
+	if (nSlowestLag > m_nMaxSlowestLag)
+		m_nMaxSlowestLag = nSlowestLag;
+	GThread::OSUnlockMutex(m_pMutex);
+}
+
+void GSkipBroadcastBuffer::Detach(void)
+{
+	m_bAttached = false;
+}
+
+void GSkipBroadcastBuffer::StopWaitingForRoom(void)
+{
+	m_bStopWaiting = 1;
+	GThread::OSMemoryBarrier();
+	if (m_bWriterWaiting)
+		GThread::OSSetEvent(m_roomEvent);
+}
+
+GSkipBroadcastConsumer *GSkipBroadcastBuffer::AddConsumer(
+	ESkipBroadcastPolicy ePolicy)	//[in]
+{
+	GSkipBroadcastConsumer *pConsumer = new GSkipBroadcastConsumer(this, ePolicy);
+	GThread::OSLockMutex(m_pMutex);
+	m_nRefCount++;
+	pConsumer->m_nReadPos = m_nWriteEnd;
+	m_consumers.push_back(pConsumer);
+	m_nNumConsumers = m_consumers.size();
+	if (kSkipBroadcastPolicy_Block == ePolicy)
+		m_nNumBlockingConsumers++;
+	GThread::OSUnlockMutex(m_pMutex);
+
+	return pConsumer;
+}
+
+void GSkipBroadcastBuffer::RemoveConsumer(
+	GSkipBroadcastConsumer *pConsumer)	//[in]
+{
+	GSkipBroadcastBuffer *pBuffer = pConsumer->m_pBuffer;
+	GThread::OSLockMutex(pBuffer->m_pMutex);
+	std::vector<GSkipBroadcastConsumer *>::iterator iter = std::find(pBuffer->m_consumers.begin(), 
+		pBuffer->m_consumers.end(), pConsumer);
+	if (iter != pBuffer->m_consumers.end())
+		pBuffer->m_consumers.erase(iter);
+	pBuffer->m_nNumConsumers = pBuffer->m_consumers.size();
+	if (kSkipBroadcastPolicy_Block == pConsumer->m_ePolicy)
+		pBuffer->m_nNumBlockingConsumers--;
+	GThread::OSUnlockMutex(pBuffer->m_pMutex);
+
+	pBuffer->OnConsumed();
+	delete pConsumer;
+	pBuffer->Release();
+}
+
+void GSkipBroadcastBuffer::GetStats(
+	GSkipBroadcastStats *pStats)	//[out]
+{
+	GThread::OSLockMutex(m_pMutex);
+	pStats->nNumConsumers = m_consumers.size();
+	pStats->nSlowestLag = m_nWriteEnd - GetSlowestReadPos(false);
+	pStats->nMaxSlowestLag = m_nMaxSlowestLag;
+	pStats->nNumWritten = m_nNumWritten;
+	pStats->nBlockedUs = m_nBlockedUs;
+	pStats->nNumBlockTimeouts = m_nNumBlockTimeouts;
+	GThread::OSUnlockMutex(m_pMutex);
+}
+
+void GSkipBroadcastBuffer::OnConsumed(void)
+{
+	GThread::OSMemoryBarrier();
+	if (m_bWriterWaiting)
+		GThread::OSSetEvent(m_roomEvent);
+}
+
+GSkipBroadcastConsumer::GSkipBroadcastConsumer(
+	GSkipBroadcastBuffer *pBuffer,	//[in]
+	ESkipBroadcastPolicy ePolicy)	//[in]
+{
+	m_pBuffer = pBuffer;
+	m_ePolicy = ePolicy;
+	m_nReadPos = 0;
+	m_bStalled = false;
+	m_nNumLost = 0;
+}
+
+unsigned int GSkipBroadcastConsumer::CatchUp(void)
+{
+	unsigned int nWriteEnd = m_pBuffer->m_nWriteEnd;
+	GThread::OSMemoryBarrier();
+	unsigned int nBehind = nWriteEnd - m_nReadPos;
+	if (nBehind > m_pBuffer->m_nNumSlots)
+	{
+		m_nNumLost += nBehind - m_pBuffer->m_nNumSlots;
+		m_nReadPos = nWriteEnd - m_pBuffer->m_nNumSlots;
+	}
+
+	return nWriteEnd;
+}
+
+int GSkipBroadcastConsumer::CountOverwritten(
+	unsigned int nFirstPos,	//[in]
+	int nNumMeasurements)	//[in]
+{
+	GThread::OSMemoryBarrier();
+	unsigned int nAhead = m_pBuffer->m_nWriteStart - nFirstPos;
+	if (nAhead <= m_pBuffer->m_nNumSlots)
+		return 0;
+
+	unsigned int nOverwritten = nAhead - m_pBuffer->m_nNumSlots;
+	return (nOverwritten < (unsigned int) nNumMeasurements) ? (int) nOverwritten : nNumMeasurements;
+}
+
+void GSkipBroadcastConsumer::CopySlots(
+	unsigned int nFirstPos,			//[in]
+	int *pMeasurements,				//[out]
+	unsigned long long *pTimesUs,	//[out] may be NULL.
+	int nNumMeasurements)			//[in] at most a ring's worth.
+{
+	unsigned int nNumSlots = m_pBuffer->m_nNumSlots;
+	unsigned int nFirstSlot = nFirstPos & (nNumSlots - 1);
+	unsigned int nFirstRun = nNumSlots - nFirstSlot;
+	if (m_pBuffer->m_bMirrored || (nFirstRun > (unsigned int) nNumMeasurements))
+		nFirstRun = nNumMeasurements;
+	memcpy(pMeasurements, &m_pBuffer->m_pMeasurements[nFirstSlot], nFirstRun*sizeof(int));
+	if ((int) nFirstRun < nNumMeasurements)
+		memcpy(&pMeasurements[nFirstRun], &m_pBuffer->m_pMeasurements[0], (nNumMeasurements - nFirstRun)*sizeof(int));
+	if (pTimesUs)
+	{
+		memcpy(pTimesUs, &m_pBuffer->m_pTimesUs[nFirstSlot], nFirstRun*sizeof(unsigned long long));
+		if ((int) nFirstRun < nNumMeasurements)
+			memcpy(&pTimesUs[nFirstRun], &m_pBuffer->m_pTimesUs[0], (nNumMeasurements - nFirstRun)*sizeof(unsigned long long));
+	}
+}
+
+unsigned long long GSkipBroadcastConsumer::GetNumLost(void)
+{
+	unsigned int nBehind = m_pBuffer->m_nWriteEnd - m_nReadPos;
+	return m_nNumLost + ((nBehind > m_pBuffer->m_nNumSlots) ? (nBehind - m_pBuffer->m_nNumSlots) : 0);
+}
+
+int GSkipBroadcastConsumer::GetNumAvailable(void)
+{
+	unsigned int nBehind = m_pBuffer->m_nWriteEnd - m_nReadPos;
+	return (int) ((nBehind < m_pBuffer->m_nNumSlots) ? nBehind : m_pBuffer->m_nNumSlots);
+}
+
+int GSkipBroadcastConsumer::Read(
+	int *pMeasurements,				//[out]
+	unsigned long long *pTimesUs,	//[out] may be NULL.
+	int nMaxMeasurements)			//[in]
+{
+	if (nMaxMeasurements <= 0)
+		return 0;
+
+	unsigned int nAvailable = CatchUp() - m_nReadPos;
+	m_bStalled = false;
+	int nNumMeasurements = (nAvailable < (unsigned int) nMaxMeasurements) ? (int) nAvailable : nMaxMeasurements;
+	if (0 == nNumMeasurements)
+		return 0;
+
+	unsigned int nReadPos = m_nReadPos;
+	CopySlots(nReadPos, pMeasurements, pTimesUs, nNumMeasurements);
+
+	//Drop the copies of any slots that the writer started on while they were being copied.
+	int nOverwritten = CountOverwritten(nReadPos, nNumMeasurements);
+	if (nOverwritten > 0)
+	{
+		nNumMeasurements -= nOverwritten;
+		memmove(pMeasurements, &pMeasurements[nOverwritten], nNumMeasurements*sizeof(int));
+		if (pTimesUs)
+			memmove(pTimesUs, &pTimesUs[nOverwritten], nNumMeasurements*sizeof(unsigned long long));
+		m_nNumLost += nOverwritten;
+	}
+	m_nReadPos = nReadPos + nOverwritten + nNumMeasurements;
+	m_pBuffer->OnConsumed();
+
+	return nNumMeasurements;
+}
+
+int GSkipBroadcastConsumer::Peek(
+	int *pMeasurements,		//[out]
+	int nFirstIndex,		//[in] 0 => the measurement at the cursor.
+	int nMaxMeasurements)	//[in]
+{
+	if ((nFirstIndex < 0) || (nMaxMeasurements <= 0))
+		return 0;
+
+	//Retry if the writer overwrites the slots while they are being copied; CatchUp() moves past them next time.
+	for (;;)
+	{
+		unsigned int nAvailable = CatchUp() - m_nReadPos;
+		if ((unsigned int) nFirstIndex >= nAvailable)
+			return 0;
+		nAvailable -= nFirstIndex;
+		int nNumMeasurements = (nAvailable < (unsigned int) nMaxMeasurements) ? (int) nAvailable : nMaxMeasurements;
+		unsigned int nFirstPos = m_nReadPos + nFirstIndex;
+		CopySlots(nFirstPos, pMeasurements, NULL, nNumMeasurements);
+		if (0 == CountOverwritten(nFirstPos, nNumMeasurements))
+			return nNumMeasurements;
+	}
+}
+
+int GSkipBroadcastConsumer::GetSpan(
+	const int **ppMeasurements,				//[out]
+	const unsigned long long **ppTimesUs,	//[out] may be NULL.
+	int nMaxMeasurements)					//[in]
+{
+	(*ppMeasurements) = NULL;
+	if (ppTimesUs)
+		(*ppTimesUs) = NULL;
+	if (nMaxMeasurements <= 0)
+		return 0;
+
+	unsigned int nAvailable = CatchUp() - m_nReadPos;
+	m_bStalled = false;
+	unsigned int nFirstSlot = m_nReadPos & (m_pBuffer->m_nNumSlots - 1);
+	if ((!m_pBuffer->m_bMirrored) && (nAvailable > m_pBuffer->m_nNumSlots - nFirstSlot))
+		nAvailable = m_pBuffer->m_nNumSlots - nFirstSlot;//stop at the end of the ring.
+	int nNumMeasurements = (nAvailable < (unsigned int) nMaxMeasurements) ? (int) nAvailable : nMaxMeasurements;
+	if (nNumMeasurements > 0)
+	{
+		(*ppMeasurements) = &m_pBuffer->m_pMeasurements[nFirstSlot];
+		if (ppTimesUs)
+			(*ppTimesUs) = &m_pBuffer->m_pTimesUs[nFirstSlot];
+	}
+
+	return nNumMeasurements;
+}
+
+int GSkipBroadcastConsumer::Consume(
+	int nNumMeasurements)	//[in] # of the measurements returned by GetSpan() that the caller used.
+{
+	if (nNumMeasurements <= 0)
+		return 0;
+	unsigned int nAvailable = m_pBuffer->m_nWriteEnd - m_nReadPos;
+	if ((unsigned int) nNumMeasurements > nAvailable)
+		nNumMeasurements = nAvailable;//never move past the writer.
+
+	int nOverwritten = CountOverwritten(m_nReadPos, nNumMeasurements);
+	m_nNumLost += nOverwritten;
+	m_nReadPos = m_nReadPos + nNumMeasurements;
+	m_pBuffer->OnConsumed();
+
+	return nOverwritten;
+}
+
+#ifdef LIB_NAMESPACE
+}
+#endif
@@ -0,0 +1,198 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipBroadcast.h
+//
+// GSkipBroadcastBuffer fans the measurements from one device out to any number of consumers in the same process, 
+// such as a logger and a live display, without either of them having to pass the measurements on to the other.
+// The device's listener thread writes each measurement, with its arrival time, into the ring once, and every
+// GSkipBroadcastConsumer reads the same slots with its own cursor, so adding a consumer costs a cursor, not a copy.
+// Consumers may read with a copy(Read(), and Peek(), which does not move the cursor), or in place(GetSpan() and
+// Consume()).
+//
+// Each consumer chooses what happens when it falls a ring behind:
+//		kSkipBroadcastPolicy_Skip	the writer carries on, and the consumer loses the oldest measurements, which are 
+//									counted. Torn copies are detected the same way as in GSkipStreamReader.
+//		kSkipBroadcastPolicy_Block	the writer waits for the consumer to make room, so it does not lose anything. The
+//									listener thread stops reading from the device meanwhile, so this pushes back on
+//									the device rather than on the other consumers. If the consumer makes no room for
+//									GSKIP_BROADCAST_BLOCK_TIMEOUT_MS, the writer stops waiting for it until it reads 
+//									again, so a consumer that stops reading cannot stall the device indefinitely.
+//									The device also cuts the wait short(StopWaitingForRoom()) when it sends a command 
+//									or closes, so command responses are not held up behind a slow consumer.
+//
+// The writer tracks the lag of the slowest consumer, and the highest lag seen, so apps can see how close they are
+// to losing measurements or to blocking the device.
+//
+// Positions are 32 bit counters that wrap, like those of GSkipStreamPublisher. Measurement number n(counting from 0
+// when the buffer was created) is in slot n % nNumSlots.
+//
+// Where the OS allows, both rings are mapped twice back to back(see GUtils::OSAllocMirroredMemory()), so that every
+// copy out is a single memcpy() and GetSpan() returns all the available measurements, even across the wrap. 
+// Otherwise GetSpan() stops at the end of the ring, and callers come back for the rest.
+
+#ifndef _GSKIPBROADCAST_H_
+#define _GSKIPBROADCAST_H_
+
+#include "GTypes.h"
+#include "GThread.h"
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+#define GSKIP_BROADCAST_DEFAULT_SLOTS 65536
+#define GSKIP_BROADCAST_MAX_SLOTS 0x1000000
+#define GSKIP_BROADCAST_BLOCK_TIMEOUT_MS 1000
+
+enum ESkipBroadcastPolicy
+{
+	kSkipBroadcastPolicy_Skip = 0,
+	kSkipBroadcastPolicy_Block
+};
+
+struct GSkipBroadcastStats
+{
+	int					nNumConsumers;
+	unsigned int		nSlowestLag;//# of measurements the slowest consumer has yet to read(more than a ring if it lost some).
+	unsigned int		nMaxSlowestLag;//highest nSlowestLag seen by the writer.
+	unsigned long long	nNumWritten;
+	unsigned long long	nBlockedUs;//total time the writer spent waiting for blocking consumers.
+	unsigned long long	nNumBlockTimeouts;//# of times the writer gave up waiting for a blocking consumer.
+};
+
+class GSkipBroadcastConsumer;
+
+class GSkipBroadcastBuffer
+{
+public:
+	// nNumSlots is rounded up to a power of 2, and to a whole number of memory pages when the rings are mirrored. 
+	// Check IsValid() afterwards. The creator holds the first reference.
+						GSkipBroadcastBuffer(int nNumSlots = GSKIP_BROADCAST_DEFAULT_SLOTS);
+	bool				IsValid(void) { return (NULL != m_pMeasurements); }
+
+	// The device holds one reference, and each consumer holds another, so consumers stay usable after the device
+	// is closed. Release() deletes the buffer along with the last reference.
+	void				AddRef(void);
+	void				Release(void);
+
+	// Single writer(the device's listener thread). Calls must be serialized with each other and with Detach().
+	void				AddMeasurements(const int *pMeasurements, int nNumMeasurements);
+	void				Detach(void);//the device is going away, nothing more will be written.
+
+	// May be called from any thread. The next time the writer runs out of room, or right away if it is waiting, it
+	// gives up on the blocking consumers in its way as if it had timed out.
+	void				StopWaitingForRoom(void);
+	bool				IsAttached(void) { return m_bAttached; }
+
+	// New consumers start at the newest measurement. May be called from any thread. 
+	GSkipBroadcastConsumer *AddConsumer(ESkipBroadcastPolicy ePolicy);
+	static void			RemoveConsumer(GSkipBroadcastConsumer *pConsumer);//deletes it, and releases its reference.
+	void				GetStats(GSkipBroadcastStats *pStats);
+
+	int					GetNumSlots(void) { return (int) m_nNumSlots; }
+	bool				IsMirrored(void) { return m_bMirrored; }
+
+private:
+						~GSkipBroadcastBuffer();
+	unsigned int		GetSlowestReadPos(bool bBlockingOnly);//Caller must hold m_pMutex.
+	void				WaitForRoom(int nNumMeasurements);
+	void				OnConsumed(void);//called by consumers after they move their cursors.
+
+	friend class GSkipBroadcastConsumer;
+
+	int					*m_pMeasurements;
+	unsigned long long	*m_pTimesUs;//GUtils::OSGetTimeStampMicroseconds() when the packet holding the measurement arrived.
+	unsigned int		m_nNumSlots;//a power of 2.
+	bool				m_bMirrored;//slot i + m_nNumSlots is slot i, in both rings.
+	void				*m_pMeasurementsMapping;
+	void				*m_pTimesMapping;
+	volatile unsigned int m_nWriteStart;//# of measurements that have been started, slots below m_nWriteStart - m_nNumSlots are gone.
+	volatile unsigned int m_nWriteEnd;//# of measurements that are complete.
+	volatile bool		m_bAttached;
+
+	OSMutex				m_pMutex;//protects m_consumers, m_nRefCount and the stats.
+	std::vector<GSkipBroadcastConsumer *> m_consumers;
+	volatile int		m_nNumConsumers;//so the writer can skip everything while there are none.
+	volatile int		m_nNumBlockingConsumers;
+	int					m_nRefCount;
+	OSEvent				m_roomEvent;//set by consumers while the writer is waiting for room.
+	volatile int		m_bWriterWaiting;
+	volatile int		m_bStopWaiting;//set by StopWaitingForRoom(), cleared by the writer once it has given up.
+	unsigned int		m_nMaxSlowestLag;
+	unsigned long long	m_nNumWritten;
+	unsigned long long	m_nBlockedUs;
+	unsigned long long	m_nNumBlockTimeouts;
+};
+
+// Each consumer must only be used by one thread at a time. Different consumers may be used by different threads.
+class GSkipBroadcastConsumer
+{
+public:
+	ESkipBroadcastPolicy GetPolicy(void) { return m_ePolicy; }
+	bool				IsAttached(void) { return m_pBuffer->IsAttached(); }//false once the device is closed.
+	int					GetNumAvailable(void);//# of measurements after the cursor, at most a ring's worth.
+	unsigned long long	GetNumLost(void);//measurements overwritten before this consumer got to them.
+	void				GetStats(GSkipBroadcastStats *pStats) { m_pBuffer->GetStats(pStats); }
+
+	// Copy up to nMaxMeasurements measurements, and their arrival times if pTimesUs is not NULL, from the cursor
+	// and advance the cursor past them. Returns the # copied.
+	int					Read(int *pMeasurements, unsigned long long *pTimesUs, int nMaxMeasurements);
+
+	// Like GCircularBuffer::CopyBytes(): copy up to nMaxMeasurements measurements, starting nFirstIndex after the 
+	// cursor, without moving the cursor(except past measurements that have already been overwritten, which are lost).
+	int					Peek(int *pMeasurements, int nFirstIndex, int nMaxMeasurements);
+
+	// Zero copy alternative to Read(), with the same contract as GSkipStreamReader::Peek() and Consume(): point 
+	// (*ppMeasurements) and (*ppTimesUs) at up to nMaxMeasurements contiguous slots from the cursor on. Consume() 
+	// advances the cursor, and returns the # of them, counting from the first, that were overwritten meanwhile.
+	// Measurements are never overwritten under a kSkipBroadcastPolicy_Block consumer, unless the writer timed out.
+	int					GetSpan(const int **ppMeasurements, const unsigned long long **ppTimesUs, int nMaxMeasurements);
+	int					Consume(int nNumMeasurements);
+
+private:
+						GSkipBroadcastConsumer(GSkipBroadcastBuffer *pBuffer, ESkipBroadcastPolicy ePolicy);
+						~GSkipBroadcastConsumer() {}
+	unsigned int		CatchUp(void);//skips any measurements that have been overwritten, returns m_nWriteEnd.
+	int					CountOverwritten(unsigned int nFirstPos, int nNumMeasurements);
+	void				CopySlots(unsigned int nFirstPos, int *pMeasurements, unsigned long long *pTimesUs, int nNumMeasurements);
+
+	friend class GSkipBroadcastBuffer;
+
+	GSkipBroadcastBuffer *m_pBuffer;
+	ESkipBroadcastPolicy m_ePolicy;
+	volatile unsigned int m_nReadPos;
+	volatile bool		m_bStalled;//set by the writer when it gives up waiting, cleared when the consumer reads.
+	unsigned long long	m_nNumLost;
+};
+
+#ifdef LIB_NAMESPACE
+}
+#endif
+
+#endif // _GSKIPBROADCAST_H_
@@ -0,0 +1,257 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipPacketCapture.cpp
+
+#include "stdafx.h"
+#include "GSkipPacketCapture.h"
+#include "GUtils.h"
+
+#include <time.h>
+
+#ifdef _DEBUG
+#include "GPlatformDebug.h" // for DEBUG_NEW definition
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+cppstring GSkipPacketCaptureWriter::m_sCapturePrefix;
+volatile int GSkipPacketCaptureWriter::m_nNumCaptureFilesCreated = 0;
+
+static void PutLittleEndian(unsigned char *pDest, unsigned long long value, int nBytes)
+{
+	for (int i = 0; i < nBytes; i++)
+	{
+		pDest[i] = (unsigned char) (value & 0xFF);
+		value = value >> 8;
+	}
+}
+
+static unsigned long long GetLittleEndian(const unsigned char *pSrc, int nBytes)
+{
+	unsigned long long value = 0;
+	for (int i = nBytes - 1; i >= 0; i--)
+		value = (value << 8) | pSrc[i];
+	return value;
+}
+
+GSkipPacketCaptureWriter::GSkipPacketCaptureWriter(FILE *pFile)
+{
+	m_pFile = pFile;
+	m_pFileMutex = GThread::OSCreateMutex(GSTD_S(""));
+	m_startTimeUs = GUtils::OSGetTimeStampMicroseconds();
+	m_lastRecordTimeUs = m_startTimeUs;
+	m_bWriteFailed = false;
+}
+
+GSkipPacketCaptureWriter::~GSkipPacketCaptureWriter()
+{
+	if (m_pFile)
+		fclose(m_pFile);
+	m_pFile = NULL;
+	if (m_pFileMutex)
+		GThread::OSDestroyMutex(m_pFileMutex);
+	m_pFileMutex = NULL;
+}
+
+GSkipPacketCaptureWriter *GSkipPacketCaptureWriter::Create(
+	const cppstring &sFileName,
+	int nVendorID,
+	int nProductID)
+{
+	GSkipPacketCaptureWriter *pWriter = NULL;
+	FILE *pFile = fopen(sFileName.c_str(), "wb");
+	if (pFile)
+	{
+		unsigned char header[GSKIP_CAPTURE_HEADER_SIZE];
+		memset(header, 0, sizeof(header));
+		memcpy(header, GSKIP_CAPTURE_SIGNATURE, 8);
+		PutLittleEndian(&header[8], GSKIP_CAPTURE_VERSION, 4);
+		PutLittleEndian(&header[12], (unsigned int) nVendorID, 4);
+		PutLittleEndian(&header[16], (unsigned int) nProductID, 4);
+		PutLittleEndian(&header[20], (unsigned long long) time(NULL), 8);
+
+		if (1 == fwrite(header, sizeof(header), 1, pFile))
+			pWriter = new GSkipPacketCaptureWriter(pFile);
+		else
+			fclose(pFile);
+	}
+
+	if (NULL == pWriter)
+	{
+		cppsstream ss;
+		ss << GSTD_S("GSkipPacketCaptureWriter::Create() could not create '") << sFileName << GSTD_S("'.");
+		GSTD_TRACE(ss.str());
+	}
+
+	return pWriter;
+}
+
+void GSkipPacketCaptureWriter::RecordPacket(
+	bool bOutput,				//[in] true if the packet is being sent to the device.
+	const GSkipPacket *pPacket)	//[in]
+{
+	if (GThread::OSLockMutex(m_pFileMutex))
+	{
+		if (!m_bWriteFailed)
+		{
+			unsigned char record[1 + 10 + sizeof(GSkipPacket)];
+			int nRecordBytes = 0;
+			unsigned long long nowUs = GUtils::OSGetTimeStampMicroseconds();
+			unsigned long long deltaUs = (nowUs > m_lastRecordTimeUs) ? (nowUs - m_lastRecordTimeUs) : 0;
+			m_lastRecordTimeUs += deltaUs;
+
+			record[nRecordBytes++] = bOutput ? GSKIP_CAPTURE_FLAG_OUTPUT : 0;
+			do
+			{
+				unsigned char group = (unsigned char) (deltaUs & 0x7F);
+				deltaUs = deltaUs >> 7;
+				record[nRecordBytes++] = (deltaUs != 0) ? (group | 0x80) : group;
+			}
+			while (deltaUs != 0);
+			memcpy(&record[nRecordBytes], pPacket, sizeof(GSkipPacket));
+			nRecordBytes += sizeof(GSkipPacket);
+
+			if (1 != fwrite(record, nRecordBytes, 1, m_pFile))
+			{
+				m_bWriteFailed = true;
+				GSTD_TRACE(GSTD_S("GSkipPacketCaptureWriter::RecordPacket() write failed, capture stopped."));
+			}
+		}
+		GThread::OSUnlockMutex(m_pFileMutex);
+	}
+}
+
+void GSkipPacketCaptureWriter::SetCapturePrefix(const cppstring &sPrefix)
+{
+	m_sCapturePrefix = sPrefix;
+}
+
+cppstring GSkipPacketCaptureWriter::GetCapturePrefix(void)
+{
+	return m_sCapturePrefix;
+}
+
+GSkipPacketCaptureWriter *GSkipPacketCaptureWriter::CreateForDevice(int nVendorID, int nProductID)
+{
+	GSkipPacketCaptureWriter *pWriter = NULL;
+	cppstring sPrefix = m_sCapturePrefix;
+	if (sPrefix.size() > 0)
+	{
+		int nFileIndex = GThread::OSAtomicAdd(&m_nNumCaptureFilesCreated, 1) - 1;
+		cppsstream ss;
+		ss << sPrefix << GSTD_S("-") << nProductID << GSTD_S("-") << nFileIndex << GSTD_S(".gcap");
+		pWriter = Create(ss.str(), nVendorID, nProductID);
+	}
+
+	return pWriter;
+}
+
+GSkipPacketCaptureReader::GSkipPacketCaptureReader()
+{
+	m_pFile = NULL;
+	m_nVendorID = 0;
+	m_nProductID = 0;
+	m_startTime = 0;
+	m_lastRecordTimeUs = 0;
+}
+
+GSkipPacketCaptureReader::~GSkipPacketCaptureReader()
+{
+	Close();
+}
+
+bool GSkipPacketCaptureReader::Open(const cppstring &sFileName)
+{
+	bool bResult = false;
+	Close();
+
+	m_pFile = fopen(sFileName.c_str(), "rb");
+	if (m_pFile)
+	{
+		unsigned char header[GSKIP_CAPTURE_HEADER_SIZE];
+		if ((1 == fread(header, sizeof(header), 1, m_pFile)) && (0 == memcmp(header, GSKIP_CAPTURE_SIGNATURE, 8)) &&
+			(GSKIP_CAPTURE_VERSION == GetLittleEndian(&header[8], 4)))
+		{
+			m_nVendorID = (int) GetLittleEndian(&header[12], 4);
+			m_nProductID = (int) GetLittleEndian(&header[16], 4);
+			m_startTime = GetLittleEndian(&header[20], 8);
+			m_lastRecordTimeUs = 0;
+			bResult = true;
+		}
+		else
+			Close();
+	}
+
+	return bResult;
+}
+
+void GSkipPacketCaptureReader::Close(void)
+{
+	if (m_pFile)
+		fclose(m_pFile);
+	m_pFile = NULL;
+}
+
+bool GSkipPacketCaptureReader::ReadRecord(GSkipPacketCaptureRecord *pRecord)
+{
+	bool bResult = false;
+	if (m_pFile)
+	{
+		int flags = getc(m_pFile);
+		unsigned long long deltaUs = 0;
+		int nShift = 0;
+		int group = 0x80;
+		while ((EOF != flags) && (group & 0x80) && (nShift < 64))
+		{
+			group = getc(m_pFile);
+			if (EOF == group)
+				break;
+			deltaUs |= ((unsigned long long) (group & 0x7F)) << nShift;
+			nShift += 7;
+		}
+
+		if ((EOF != flags) && (EOF != group) && !(group & 0x80) && (1 == fread(&pRecord->packet, sizeof(GSkipPacket), 1, m_pFile)))
+		{
+			m_lastRecordTimeUs += deltaUs;
+			pRecord->bOutput = (0 != (flags & GSKIP_CAPTURE_FLAG_OUTPUT));
+			pRecord->timeUs = m_lastRecordTimeUs;
+			bResult = true;
+		}
+	}
+
+	return bResult;
+}
+
+#ifdef LIB_NAMESPACE
+}
+#endif
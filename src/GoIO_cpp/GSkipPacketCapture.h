@@ -0,0 +1,130 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipPacketCapture.h
+//
+// Packet capture files record the raw 8 byte packets exchanged with a Go! device, with host time stamps,
+// so that a session can be replayed later by GSkipPacketReplay.
+//
+// File layout(all multi-byte fields are little endian):
+//		header(32 bytes):
+//			signature		8 bytes, "GOIOCAP1"
+//			version			4 bytes, currently 1
+//			vendor id		4 bytes
+//			product id		4 bytes
+//			start time		8 bytes, host wall clock time when the capture started, in seconds since 1970
+//			reserved		4 bytes
+//		followed by one record per packet:
+//			flags			1 byte, GSKIP_CAPTURE_FLAG_OUTPUT is set for packets sent to the device
+//			delta time		1 to 10 bytes, microseconds since the previous record(or since the start of the capture),
+//							7 bits per byte with the least significant group first, bit 7 set on all but the last byte.
+//			packet			8 bytes
+// A measurement packet every few ms takes 11 bytes.
+
+#ifndef _GSKIPPACKETCAPTURE_H_
+#define _GSKIPPACKETCAPTURE_H_
+
+#include <stdio.h>
+#include "GTypes.h"
+#include "GThread.h"
+#include "GSkipComm.h"
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+#define GSKIP_CAPTURE_SIGNATURE "GOIOCAP1"
+#define GSKIP_CAPTURE_VERSION 1
+#define GSKIP_CAPTURE_HEADER_SIZE 32
+#define GSKIP_CAPTURE_FLAG_OUTPUT 0x01
+
+struct GSkipPacketCaptureRecord
+{
+	bool				bOutput;		//true if the packet was sent to the device
+	unsigned long long	timeUs;			//microseconds since the start of the capture
+	GSkipPacket			packet;
+};
+
+class GSkipPacketCaptureWriter
+{
+public:
+	// Create a capture file, return NULL on failure.
+	static GSkipPacketCaptureWriter *	Create(const cppstring &sFileName, int nVendorID, int nProductID);
+						~GSkipPacketCaptureWriter();//Flushes and closes the file.
+
+	// Thread safe, so the listener thread can record input packets while the caller records output packets.
+	void				RecordPacket(bool bOutput, const GSkipPacket *pPacket);
+
+	// Devices opened while a capture prefix is set record their traffic to "<prefix>-<product id>-<n>.gcap".
+	// An empty prefix disables capture. Existing files with the same name are overwritten.
+	static void			SetCapturePrefix(const cppstring &sPrefix);
+	static cppstring	GetCapturePrefix(void);
+	static GSkipPacketCaptureWriter *	CreateForDevice(int nVendorID, int nProductID);//NULL if capture is disabled.
+
+private:
+						GSkipPacketCaptureWriter(FILE *pFile);
+
+	FILE *				m_pFile;
+	OSMutex				m_pFileMutex;
+	unsigned long long	m_startTimeUs;
+	unsigned long long	m_lastRecordTimeUs;
+	bool				m_bWriteFailed;
+
+	static cppstring	m_sCapturePrefix;
+	static volatile int	m_nNumCaptureFilesCreated;
+};
+
+class GSkipPacketCaptureReader
+{
+public:
+						GSkipPacketCaptureReader();
+						~GSkipPacketCaptureReader();
+
+	bool				Open(const cppstring &sFileName);//Reads and validates the header.
+	void				Close(void);
+
+	int					GetVendorID(void) { return m_nVendorID; }
+	int					GetProductID(void) { return m_nProductID; }
+	unsigned long long	GetStartTime(void) { return m_startTime; }
+
+	// Read the next record, return false at the end of the file(or if the file is truncated).
+	bool				ReadRecord(GSkipPacketCaptureRecord *pRecord);
+
+private:
+	FILE *				m_pFile;
+	int					m_nVendorID;
+	int					m_nProductID;
+	unsigned long long	m_startTime;
+	unsigned long long	m_lastRecordTimeUs;
+};
+
+#ifdef LIB_NAMESPACE
+}
+#endif
+
+#endif // _GSKIPPACKETCAPTURE_H_
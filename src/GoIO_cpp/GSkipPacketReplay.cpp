@@ -0,0 +1,315 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipPacketReplay.cpp
+
+#include "stdafx.h"
+#include "GSkipPacketReplay.h"
+#include "GUtils.h"
+
+#include <stdlib.h>
+
+#ifdef _DEBUG
+#include "GPlatformDebug.h" // for DEBUG_NEW definition
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+#define REPLAY_MAX_PACKETS_PER_PUMP 256
+
+real GSkipPacketReplay::m_fConfigSpeed = 1.0;
+StringVector GSkipPacketReplay::m_vConfigFileNames;
+intVector GSkipPacketReplay::m_vConfigVendorIDs;
+intVector GSkipPacketReplay::m_vConfigProductIDs;
+
+GSkipPacketReplay::GSkipPacketReplay(
+	real fSpeed,		//[in] playback speed relative to the original timing, 0 => as fast as possible.
+	GSkipVirtualDevicePacketSinkPtr pCmdRespSink,		//[in] receives command response packets.
+	GSkipVirtualDevicePacketSinkPtr pMeasurementSink,	//[in] receives measurement packets.
+	void *pSinkContext)	//[in] passed back to the sinks.
+{
+	m_fSpeed = fSpeed;
+	m_pCmdRespSink = pCmdRespSink;
+	m_pMeasurementSink = pMeasurementSink;
+	m_pSinkContext = pSinkContext;
+	m_pStateMutex = GThread::OSCreateMutex(GSTD_S(""));
+	m_pDeliveryMutex = GThread::OSCreateMutex(GSTD_S(""));
+	m_bNextRecordValid = false;
+	m_captureBaseTimeUs = 0;
+	m_hostBaseTimeUs = GUtils::OSGetTimeStampMicroseconds();
+}
+
+GSkipPacketReplay::~GSkipPacketReplay()
+{
+	if (m_pStateMutex)
+		GThread::OSDestroyMutex(m_pStateMutex);
+	m_pStateMutex = NULL;
+	if (m_pDeliveryMutex)
+		GThread::OSDestroyMutex(m_pDeliveryMutex);
+	m_pDeliveryMutex = NULL;
+}
+
+GSkipPacketReplay *GSkipPacketReplay::CreateReplay(
+	const cppstring &sDeviceName,
+	GSkipVirtualDevicePacketSinkPtr pCmdRespSink,
+	GSkipVirtualDevicePacketSinkPtr pMeasurementSink,
+	void *pSinkContext)
+{
+	GSkipPacketReplay *pReplay = NULL;
+	if (IsReplayDeviceName(sDeviceName))
+	{
+		//Name is "replay:<product id>:<index>".
+		size_t i = sDeviceName.find(':', 7);
+		unsigned int nFileIndex = 0;
+		bool bIndexFound = false;
+		if (cppstring::npos != i)
+		{
+			for (i++; (i < sDeviceName.size()) && (sDeviceName[i] >= '0') && (sDeviceName[i] <= '9'); i++)
+			{
+				nFileIndex = nFileIndex*10 + (sDeviceName[i] - '0');
+				bIndexFound = true;
+			}
+		}
+
+		if (bIndexFound && (nFileIndex < m_vConfigFileNames.size()))
+		{
+			pReplay = new GSkipPacketReplay(m_fConfigSpeed, pCmdRespSink, pMeasurementSink, pSinkContext);
+			if (!pReplay->Open(m_vConfigFileNames[nFileIndex]))
+			{
+				delete pReplay;
+				pReplay = NULL;
+			}
+		}
+	}
+
+	return pReplay;
+}
+
+bool GSkipPacketReplay::Open(const cppstring &sFileName)
+{
+	bool bResult = false;
+	if (GThread::OSLockMutex(m_pStateMutex))
+	{
+		bResult = m_reader.Open(sFileName);
+		m_releasedCmds.clear();
+		m_captureBaseTimeUs = 0;
+		m_hostBaseTimeUs = GUtils::OSGetTimeStampMicroseconds();
+		m_bNextRecordValid = false;
+		if (bResult)
+			ReadNextRecord();
+		GThread::OSUnlockMutex(m_pStateMutex);
+	}
+
+	return bResult;
+}
+
+bool GSkipPacketReplay::IsReplayDeviceName(const cppstring &sDeviceName)
+{
+	return (0 == sDeviceName.compare(0, 7, GSTD_S("replay:")));
+}
+
+StringVector GSkipPacketReplay::GetAvailableDevices(int nVendorID, int nProductID)
+{
+	StringVector vPortNames;
+	for (unsigned int i = 0; i < m_vConfigFileNames.size(); i++)
+	{
+		if ((m_vConfigVendorIDs[i] == nVendorID) && (m_vConfigProductIDs[i] == nProductID))
+		{
+			cppsstream ss;
+			ss << GSTD_S("replay:") << nProductID << GSTD_S(":") << i;
+			vPortNames.push_back(ss.str());
+		}
+	}
+
+	return vPortNames;
+}
+
+bool GSkipPacketReplay::SetConfig(const cppstring &sConfig)
+{
+	bool bResult = true;
+	real fSpeed = 1.0;
+	StringVector vFileNames;
+	intVector vVendorIDs;
+	intVector vProductIDs;
+	size_t i = 0;
+
+	while (bResult && (i < sConfig.size()))
+	{
+		//Parse "key=value", skipping white space and separators.
+		cppstring sKey;
+		cppstring sValue;
+		while ((i < sConfig.size()) && ((',' == sConfig[i]) || (';' == sConfig[i]) || (' ' == sConfig[i])))
+			i++;
+		while ((i < sConfig.size()) && ('=' != sConfig[i]) && (',' != sConfig[i]) && (';' != sConfig[i]))
+			sKey += sConfig[i++];
+		if ((i < sConfig.size()) && ('=' == sConfig[i]))
+		{
+			i++;
+			while ((i < sConfig.size()) && (',' != sConfig[i]) && (';' != sConfig[i]))
+				sValue += sConfig[i++];
+		}
+
+		if (0 == sKey.size())
+			continue;
+		if (0 == sValue.size())
+			bResult = false;
+		else
+		if (GSTD_S("speed") == sKey)
+		{
+			char *pEnd = NULL;
+			fSpeed = strtod(sValue.c_str(), &pEnd);
+			if ((*pEnd != 0) || (fSpeed < 0.0))
+				bResult = false;
+		}
+		else
+		if (GSTD_S("file") == sKey)
+		{
+			GSkipPacketCaptureReader reader;
+			if (reader.Open(sValue))
+			{
+				vFileNames.push_back(sValue);
+				vVendorIDs.push_back(reader.GetVendorID());
+				vProductIDs.push_back(reader.GetProductID());
+			}
+			else
+				bResult = false;
+		}
+		else
+			bResult = false;
+	}
+
+	if (bResult)
+	{
+		m_fConfigSpeed = fSpeed;
+		m_vConfigFileNames = vFileNames;
+		m_vConfigVendorIDs = vVendorIDs;
+		m_vConfigProductIDs = vProductIDs;
+	}
+	else
+	{
+		cppsstream ss;
+		ss << GSTD_S("GSkipPacketReplay::SetConfig() rejected '") << sConfig << GSTD_S("'.");
+		GSTD_TRACE(ss.str());
+	}
+
+	return bResult;
+}
+
+void GSkipPacketReplay::ReadNextRecord(void)
+{
+	bool bWasValid = m_bNextRecordValid;
+	m_bNextRecordValid = m_reader.ReadRecord(&m_nextRecord);
+	if (bWasValid && !m_bNextRecordValid)
+		GSTD_TRACE(GSTD_S("GSkipPacketReplay reached the end of the capture."));
+}
+
+void GSkipPacketReplay::WriteCmdPacket(const GSkipPacket *pPacket)
+{
+	if (GThread::OSLockMutex(m_pStateMutex))
+	{
+		m_releasedCmds.push_back(pPacket->data[0]);
+		GThread::OSUnlockMutex(m_pStateMutex);
+	}
+
+	//Deliver the responses that are already due without waiting for the listener thread.
+	Pump();
+}
+
+void GSkipPacketReplay::Pump(void)
+{
+	GSkipPacket packets[REPLAY_MAX_PACKETS_PER_PUMP];
+	bool bMoreDue = true;
+
+	//Pump() runs on both the listener thread and the thread sending commands, so serialize delivery to keep the packets in order.
+	if (!GThread::OSLockMutex(m_pDeliveryMutex))
+		return;
+
+	while (bMoreDue)
+	{
+		int nNumPackets = 0;
+		bMoreDue = false;
+
+		if (GThread::OSLockMutex(m_pStateMutex))
+		{
+			unsigned long long nowUs = GUtils::OSGetTimeStampMicroseconds();
+			while (m_bNextRecordValid && (nNumPackets < REPLAY_MAX_PACKETS_PER_PUMP))
+			{
+				if (m_nextRecord.bOutput)
+				{
+					//Wait here until the host sends its own command, then restart the clock from this point in the capture.
+					if (m_releasedCmds.empty())
+						break;
+					if (m_releasedCmds.front() != m_nextRecord.packet.data[0])
+					{
+						cppsstream ss;
+						ss << GSTD_S("GSkipPacketReplay: host sent cmd ") << (int) m_releasedCmds.front() << GSTD_S(", capture has cmd ") << (int) m_nextRecord.packet.data[0] << GSTD_S(".");
+						GSTD_TRACE(ss.str());
+					}
+					m_releasedCmds.pop_front();
+					m_captureBaseTimeUs = m_nextRecord.timeUs;
+					m_hostBaseTimeUs = nowUs;
+				}
+				else
+				{
+					//If the host has already moved on to its next command, everything before that command is due now.
+					if ((m_fSpeed > 0.0) && m_releasedCmds.empty())
+					{
+						real fDueUs = ((real) (m_nextRecord.timeUs - m_captureBaseTimeUs))/m_fSpeed;
+						if (fDueUs > (real) (nowUs - m_hostBaseTimeUs))
+							break;
+					}
+					packets[nNumPackets++] = m_nextRecord.packet;
+				}
+				ReadNextRecord();
+			}
+
+			//When replaying as fast as possible, give the consumer a chance to drain the queues between batches.
+			bMoreDue = (REPLAY_MAX_PACKETS_PER_PUMP == nNumPackets) && (m_fSpeed > 0.0);
+
+			GThread::OSUnlockMutex(m_pStateMutex);
+		}
+
+		for (int i = 0; i < nNumPackets; i++)
+		{
+			if (packets[i].data[0] & SKIP_MASK_INPUT_PACKET_TYPE)
+				(*m_pCmdRespSink)(m_pSinkContext, &packets[i]);
+			else
+				(*m_pMeasurementSink)(m_pSinkContext, &packets[i]);
+		}
+	}
+
+	GThread::OSUnlockMutex(m_pDeliveryMutex);
+}
+
+#ifdef LIB_NAMESPACE
+}
+#endif
@@ -0,0 +1,114 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipPacketReplay.h
+//
+// GSkipPacketReplay feeds a packet capture file(see GSkipPacketCapture.h) back to the library as if the
+// captured device were attached, so that field problems can be reproduced offline and decode and calibration
+// changes can be benchmarked against real traffic.
+//
+// Packets read from the device are delivered at their original spacing, scaled by the configured speed.
+// Packets that the host sent to the device act as gates: replay does not proceed past a captured command
+// until the host sends a command of its own, and the timing restarts from that point. So the application
+// being replayed should issue the same sequence of commands as the one that was captured, which is what
+// happens when a capture is made from GoIO_Sensor_Open() onwards.
+//
+// Replay is enabled by SetConfig(), which takes a comma separated list of key=value pairs:
+//		speed=X			playback speed relative to the original timing, e.g. 1, 10 or 0.5(default 1).
+//						0 delivers packets as fast as the queues accept them.
+//		file=PATH		capture file to replay. Repeat the key to replay several files at once.
+//
+// Replayed devices are named "replay:<product id>:<index>", where index is the position of the file in the
+// config string.
+
+#ifndef _GSKIPPACKETREPLAY_H_
+#define _GSKIPPACKETREPLAY_H_
+
+#include <deque>
+#include "GTypes.h"
+#include "GThread.h"
+#include "GSkipComm.h"
+#include "GSkipVirtualDevice.h"
+#include "GSkipPacketCapture.h"
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+class GSkipPacketReplay : public GSkipVirtualDevice
+{
+public:
+						GSkipPacketReplay(real fSpeed,
+							GSkipVirtualDevicePacketSinkPtr pCmdRespSink, GSkipVirtualDevicePacketSinkPtr pMeasurementSink, void *pSinkContext);
+	virtual				~GSkipPacketReplay();
+
+	// Create a replay for sDeviceName if it names a configured capture file, else return NULL.
+	static GSkipPacketReplay *	CreateReplay(const cppstring &sDeviceName,
+							GSkipVirtualDevicePacketSinkPtr pCmdRespSink, GSkipVirtualDevicePacketSinkPtr pMeasurementSink, void *pSinkContext);
+
+	bool				Open(const cppstring &sFileName);
+
+	// Releases the next captured command gate, and delivers any captured responses that are already due.
+	virtual void		WriteCmdPacket(const GSkipPacket *pPacket);
+
+	// Deliver any captured input packets that have come due since the last call.
+	virtual void		Pump(void);
+
+	// Configuration is global, and should be set before the list of available devices is updated.
+	static bool			SetConfig(const cppstring &sConfig);
+	static StringVector	GetAvailableDevices(int nVendorID, int nProductID);
+	static bool			IsReplayDeviceName(const cppstring &sDeviceName);
+
+private:
+	void				ReadNextRecord(void);//Caller must hold m_pStateMutex.
+
+	real				m_fSpeed;
+	GSkipVirtualDevicePacketSinkPtr	m_pCmdRespSink;
+	GSkipVirtualDevicePacketSinkPtr	m_pMeasurementSink;
+	void *				m_pSinkContext;
+	OSMutex				m_pStateMutex;
+	OSMutex				m_pDeliveryMutex;//held while packets are passed to the sinks
+
+	GSkipPacketCaptureReader	m_reader;
+	GSkipPacketCaptureRecord	m_nextRecord;
+	bool				m_bNextRecordValid;
+	std::deque<unsigned char>	m_releasedCmds;//cmds sent by the host that have not yet been matched against the capture
+	unsigned long long	m_captureBaseTimeUs;//capture time that corresponds to m_hostBaseTimeUs
+	unsigned long long	m_hostBaseTimeUs;
+
+	static real			m_fConfigSpeed;
+	static StringVector	m_vConfigFileNames;
+	static intVector	m_vConfigVendorIDs;
+	static intVector	m_vConfigProductIDs;
+};
+
+#ifdef LIB_NAMESPACE
+}
+#endif
+
+#endif // _GSKIPPACKETREPLAY_H_
@@ -0,0 +1,1228 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipRecorder.cpp
+
+#include "stdafx.h"
+#include "GSkipRecorder.h"
+#include "GUtils.h"
+#include "GTimeline.h"
+#include "GSkipSampleCodec.h"
+
+#include <time.h>
+
+#ifdef _DEBUG
+#include "GPlatformDebug.h" // for DEBUG_NEW definition
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+#define GSKIP_RECORDING_METADATA_FIXED_SIZE 48
+#define GSKIP_RECORDING_SAMPLES_FIXED_SIZE 32
+#define GSKIP_RECORDING_END_SIZE 24
+
+//Table for the reflected CRC-32 polynomial used by zip and ethernet, built before main() runs.
+struct GCrc32Table
+{
+	GCrc32Table()
+	{
+		for (unsigned int i = 0; i < 256; i++)
+		{
+			unsigned int crc = i;
+			for (int j = 0; j < 8; j++)
+				crc = (crc & 1) ? ((crc >> 1) ^ 0xEDB88320) : (crc >> 1);
+			entries[i] = crc;
+		}
+	}
+	unsigned int		entries[256];
+};
+static const GCrc32Table crc32Table;
+
+static void PutLittleEndian(unsigned char *pDest, unsigned long long value, int nBytes)
+{
+	for (int i = 0; i < nBytes; i++)
+	{
+		pDest[i] = (unsigned char) (value & 0xFF);
+		value = value >> 8;
+	}
+}
+
+static unsigned long long GetLittleEndian(const unsigned char *pSrc, int nBytes)
+{
+	unsigned long long value = 0;
+	for (int i = nBytes - 1; i >= 0; i--)
+		value = (value << 8) | pSrc[i];
+	return value;
+}
+
+static void PutDouble(unsigned char *pDest, real value)
+{
+	unsigned long long bits;
+	memcpy(&bits, &value, sizeof(bits));
+	PutLittleEndian(pDest, bits, 8);
+}
+
+static real GetDouble(const unsigned char *pSrc)
+{
+	unsigned long long bits = GetLittleEndian(pSrc, 8);
+	real value;
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+unsigned int GSkipRecorder::CalculateCrc32(
+	const unsigned char *pBytes,	//[in]
+	size_t nNumBytes,				//[in]
+	unsigned int crc /* = 0 */)		//[in] crc of the preceding bytes, to continue a calculation.
+{
+	crc = ~crc;
+	for (size_t i = 0; i < nNumBytes; i++)
+		crc = crc32Table.entries[(crc ^ pBytes[i]) & 0xFF] ^ (crc >> 8);
+	return ~crc;
+}
+
+GSkipRecorder::GSkipRecorder(FILE *pFile, const cppstring &sFileName, const GSkipRecordingMetadata &metadata, 
+	int nOptions)
+{
+	m_sFileName = sFileName;
+	m_metadata = metadata;
+	m_metadata.firstSampleIndex = 0;
+	m_nOptions = nOptions;
+	if (m_nOptions & kSkipRecorderOption_Calibrated)
+		m_nOptions |= kSkipRecorderOption_Compress;
+	m_calibrationSensor.SetDDSRec(metadata.ddsRec, false);
+	m_fVoltsPerBit = metadata.fVoltsPerBit;
+	m_fVoltsOffset = metadata.fVoltsOffset;
+
+	m_pBatch = NULL;
+	m_pSpareChunk = NULL;
+	m_batchStartTimeMs = 0;
+	m_nextSampleIndex = 0;
+
+	m_pQueueMutex = GThread::OSCreateMutex(GSTD_S(""));
+	memset(&m_stats, 0, sizeof(m_stats));
+
+	m_pWakeWriterEvent = GThread::OSCreateEvent();
+	m_pWriterThread = NULL;
+	m_bStopWriter = false;
+	m_pFile = pFile;
+	m_pBlock = new unsigned char[GSKIP_RECORDER_BLOCK_SIZE];
+	memset(m_pBlock, 0, GSKIP_RECORDER_BLOCK_SIZE);
+	m_nBlockBytes = 0;
+	m_blockOffset = 0;
+	m_bBlockDirty = false;
+	m_lastFlushTimeMs = GUtils::OSGetTimeStamp();
+	m_nNextSequence = 0;
+	m_summary = GSamplePyramid(GSKIP_RECORDING_SUMMARY_BASE_LEVEL);
+	m_bSummaryPending = false;
+	m_indexOffset = 0;
+
+	unsigned char header[GSKIP_RECORDING_HEADER_SIZE];
+	memset(header, 0, sizeof(header));
+	memcpy(header, GSKIP_RECORDING_SIGNATURE, 8);
+	PutLittleEndian(&header[8], GSKIP_RECORDING_VERSION, 4);
+	PutLittleEndian(&header[16], (unsigned long long) time(NULL), 8);
+	PutLittleEndian(&header[24], GUtils::OSGetTimeStampMicroseconds(), 8);
+	AppendBytes(header, sizeof(header));
+
+	GSkipRecordingChunk *pChunk = AllocChunk(kSkipRecordingChunk_Metadata);
+	pChunk->metadata = m_metadata;
+	EnqueueChunk(pChunk, false);
+}
+
+GSkipRecorder *GSkipRecorder::Create(
+	const cppstring &sFileName,				//[in]
+	const GSkipRecordingMetadata &metadata,	//[in] firstSampleIndex is ignored.
+	int nOptions /* = 0 */)					//[in] ESkipRecorderOption flags.
+{
+	GSkipRecorder *pRecorder = NULL;
+
+	FILE *pFile = fopen(sFileName.c_str(), "wb");
+	if (pFile)
+	{
+		//The recorder does its own buffering, so that every write is a whole block or page.
+		setvbuf(pFile, NULL, _IONBF, 0);
+
+		pRecorder = new GSkipRecorder(pFile, sFileName, metadata, nOptions);
+		if (pRecorder->m_pQueueMutex && pRecorder->m_pWakeWriterEvent)
+		{
+			pRecorder->m_pWriterThread = new GLiteThread((StdThreadFunctionPtr) WriterThreadFunc, 
+				(StdThreadFunctionPtr) StopWriterThreadFunc, pRecorder);
+			if (!pRecorder->m_pWriterThread->OSStartThread())
+			{
+				delete pRecorder->m_pWriterThread;
+				pRecorder->m_pWriterThread = NULL;
+			}
+		}
+
+		if (NULL == pRecorder->m_pWriterThread)
+		{
+			delete pRecorder;
+			pRecorder = NULL;
+			remove(sFileName.c_str());
+		}
+	}
+
+	if (NULL == pRecorder)
+	{
+		cppsstream ss;
+		ss << GSTD_S("GSkipRecorder::Create() could not create '") << sFileName << GSTD_S("'.");
+		GSTD_TRACE(ss.str());
+	}
+
+	return pRecorder;
+}
+
+GSkipRecorder::~GSkipRecorder()
+{
+	if (m_pWriterThread)
+	{
+		HandOffBatch();
+
+		GSkipRecordingChunk *pEnd = AllocChunk(kSkipRecordingChunk_End);
+		pEnd->nNumSlots = m_nextSampleIndex;
+		if (GThread::OSLockMutex(m_pQueueMutex))
+		{
+			pEnd->nNumRecorded = m_stats.nSamplesRecorded;
+			pEnd->nNumLost = m_stats.nSamplesLost;
+			GThread::OSUnlockMutex(m_pQueueMutex);
+		}
+		EnqueueChunk(pEnd, false);
+
+		delete m_pWriterThread;//Stops the thread, which writes out the queue on the way out.
+		m_pWriterThread = NULL;
+	}
+
+	if (m_pBatch)
+		delete m_pBatch;
+	if (m_pSpareChunk)
+		delete m_pSpareChunk;
+	while (m_queue.size() > 0)
+	{
+		delete m_queue.front();
+		m_queue.pop_front();
+	}
+	for (size_t i = 0; i < m_freeChunks.size(); i++)
+		delete m_freeChunks[i];
+	m_freeChunks.clear();
+
+	if (m_pFile)
+		fclose(m_pFile);
+	m_pFile = NULL;
+	delete [] m_pBlock;
+
+	if (m_pQueueMutex)
+		GThread::OSDestroyMutex(m_pQueueMutex);
+	m_pQueueMutex = NULL;
+	if (m_pWakeWriterEvent)
+		GThread::OSDestroyEvent(m_pWakeWriterEvent);
+	m_pWakeWriterEvent = NULL;
+}
+
+GSkipRecordingChunk *GSkipRecorder::AllocChunk(int nType)
+{
+	GSkipRecordingChunk *pChunk = m_pSpareChunk;
+	m_pSpareChunk = NULL;
+
+	if ((NULL == pChunk) && GThread::OSLockMutex(m_pQueueMutex))
+	{
+		if (m_freeChunks.size() > 0)
+		{
+			pChunk = m_freeChunks.back();
+			m_freeChunks.pop_back();
+		}
+		GThread::OSUnlockMutex(m_pQueueMutex);
+	}
+
+	if (NULL == pChunk)
+	{
+		pChunk = new GSkipRecordingChunk;
+		pChunk->samples.reserve(GSKIP_RECORDER_BATCH_SAMPLES + 16);//room for the packet that fills the batch.
+	}
+
+	pChunk->nType = nType;
+	pChunk->nFlags = 0;
+	pChunk->nSequence = 0;
+	pChunk->firstSampleIndex = 0;
+	pChunk->firstTimeUs = 0;
+	pChunk->lastTimeUs = 0;
+	pChunk->samples.clear();
+	pChunk->gaps.clear();
+	pChunk->calibrated.clear();
+	pChunk->nNumSlots = 0;
+	pChunk->nNumRecorded = 0;
+	pChunk->nNumLost = 0;
+
+	return pChunk;
+}
+
+bool GSkipRecorder::EnqueueChunk(
+	GSkipRecordingChunk *pChunk,	//[in] the recorder takes ownership.
+	bool bMayDrop)					//[in] true to discard pChunk rather than let the queue grow past its limit.
+{
+	bool bQueued = false;
+	if (GThread::OSLockMutex(m_pQueueMutex))
+	{
+		if (bMayDrop && (m_queue.size() >= GSKIP_RECORDER_MAX_QUEUED_CHUNKS))
+		{
+			m_stats.nSamplesLost += pChunk->samples.size();
+			m_freeChunks.push_back(pChunk);
+		}
+		else
+		{
+			m_stats.nSamplesRecorded += pChunk->samples.size();
+			for (size_t i = 0; i < pChunk->gaps.size(); i++)
+				m_stats.nSamplesMissing += pChunk->gaps[i].nNumMissing;
+			m_queue.push_back(pChunk);
+			bQueued = true;
+		}
+
+		if ((NULL == m_pSpareChunk) && (m_freeChunks.size() > 0))
+		{
+			m_pSpareChunk = m_freeChunks.back();
+			m_freeChunks.pop_back();
+		}
+
+		GThread::OSUnlockMutex(m_pQueueMutex);
+	}
+	else
+		delete pChunk;
+
+	if (bQueued)
+		GThread::OSSetEvent(m_pWakeWriterEvent);
+
+	return bQueued;
+}
+
+void GSkipRecorder::HandOffBatch(void)
+{
+	if (m_pBatch)
+	{
+		EnqueueChunk(m_pBatch, true);
+		m_pBatch = NULL;
+	}
+}
+
+void GSkipRecorder::AddMeasurements(
+	const int *pMeasurements,	//[in]
+	int nNumMeasurements,		//[in]
+	int nNumMissing)			//[in] # of measurements lost just before these ones.
+{
+	unsigned long long nowUs = GUtils::OSGetTimeStampMicroseconds();
+	if (NULL == m_pBatch)
+	{
+		m_pBatch = AllocChunk(kSkipRecordingChunk_Samples);
+		m_pBatch->firstSampleIndex = m_nextSampleIndex;
+		m_pBatch->firstTimeUs = nowUs;
+		m_batchStartTimeMs = GUtils::OSGetTimeStamp();
+	}
+
+	if (nNumMissing > 0)
+	{
+		GSkipRecordingGap gap;
+		gap.nSampleOffset = (unsigned int) m_pBatch->samples.size();
+		gap.nNumMissing = nNumMissing;
+		m_pBatch->gaps.push_back(gap);
+		m_nextSampleIndex += nNumMissing;
+	}
+
+	for (int i = 0; i < nNumMeasurements; i++)
+		m_pBatch->samples.push_back((short) pMeasurements[i]);
+	m_nextSampleIndex += nNumMeasurements;
+	m_pBatch->lastTimeUs = nowUs;
+
+	if ((m_pBatch->samples.size() >= GSKIP_RECORDER_BATCH_SAMPLES) ||
+		((GUtils::OSGetTimeStamp() - m_batchStartTimeMs) >= GSKIP_RECORDER_MAX_BATCH_AGE_MS))
+		HandOffBatch();
+}
+
+void GSkipRecorder::FlushIfStale(void)
+{
+	if (m_pBatch && ((GUtils::OSGetTimeStamp() - m_batchStartTimeMs) >= GSKIP_RECORDER_MAX_BATCH_AGE_MS))
+		HandOffBatch();
+}
+
+void GSkipRecorder::SetMeasurementPeriod(
+	real fPeriodInSeconds)	//[in] applies to measurements added after this call.
+{
+	if (fPeriodInSeconds != m_metadata.fMeasurementPeriod)
+	{
+		HandOffBatch();
+
+		m_metadata.fMeasurementPeriod = fPeriodInSeconds;
+		m_metadata.firstSampleIndex = m_nextSampleIndex;
+		GSkipRecordingChunk *pChunk = AllocChunk(kSkipRecordingChunk_Metadata);
+		pChunk->metadata = m_metadata;
+		EnqueueChunk(pChunk, false);
+	}
+}
+
+void GSkipRecorder::GetStats(
+	GSkipRecorderStats *pStats)	//[out]
+{
+	memset(pStats, 0, sizeof(*pStats));
+	if (GThread::OSLockMutex(m_pQueueMutex))
+	{
+		(*pStats) = m_stats;
+		GThread::OSUnlockMutex(m_pQueueMutex);
+	}
+}
+
+void GSkipRecorder::WriteBlock(
+	size_t nNumBytes)	//[in] # of bytes from the start of m_pBlock, a multiple of GSKIP_RECORDER_PAGE_SIZE.
+{
+	GSTD_TIMELINE_SPAN("GSkipRecorder::WriteBlock", 0, (int) nNumBytes);
+	if (m_pFile && !m_stats.bWriteFailed)
+	{
+		if ((0 != fseek(m_pFile, m_blockOffset, SEEK_SET)) || (1 != fwrite(m_pBlock, nNumBytes, 1, m_pFile)))
+		{
+			if (GThread::OSLockMutex(m_pQueueMutex))
+			{
+				m_stats.bWriteFailed = true;
+				GThread::OSUnlockMutex(m_pQueueMutex);
+			}
+			cppsstream ss;
+			ss << GSTD_S("GSkipRecorder::WriteBlock() write to '") << m_sFileName << GSTD_S("' failed, recording stopped.");
+			GSTD_TRACE(ss.str());
+		}
+	}
+}
+
+void GSkipRecorder::AppendBytes(
+	const unsigned char *pBytes,	//[in]
+	size_t nNumBytes)				//[in]
+{
+	while (nNumBytes > 0)
+	{
+		size_t nCopyBytes = GSKIP_RECORDER_BLOCK_SIZE - m_nBlockBytes;
+		if (nCopyBytes > nNumBytes)
+			nCopyBytes = nNumBytes;
+		memcpy(&m_pBlock[m_nBlockBytes], pBytes, nCopyBytes);
+		m_nBlockBytes += nCopyBytes;
+		m_bBlockDirty = true;
+		pBytes += nCopyBytes;
+		nNumBytes -= nCopyBytes;
+
+		if (GSKIP_RECORDER_BLOCK_SIZE == m_nBlockBytes)
+		{
+			WriteBlock(GSKIP_RECORDER_BLOCK_SIZE);
+			m_blockOffset += GSKIP_RECORDER_BLOCK_SIZE;
+			m_nBlockBytes = 0;
+			m_bBlockDirty = false;
+			//Keep the unused part of the block zeroed, so partial blocks are written with zero padding.
+			memset(m_pBlock, 0, GSKIP_RECORDER_BLOCK_SIZE);
+		}
+	}
+}
+
+void GSkipRecorder::FlushPartialBlock(void)
+{
+	if (m_bBlockDirty)
+	{
+		//Round up to whole pages. The padding reads as a kSkipRecordingChunk_Padding chunk type, and the same
+		//pages are written again from the same offset as the block fills.
+		size_t nNumBytes = ((m_nBlockBytes + GSKIP_RECORDER_PAGE_SIZE - 1)/GSKIP_RECORDER_PAGE_SIZE)*GSKIP_RECORDER_PAGE_SIZE;
+		WriteBlock(nNumBytes);
+		m_bBlockDirty = false;
+	}
+	m_lastFlushTimeMs = GUtils::OSGetTimeStamp();
+}
+
+void GSkipRecorder::EncodePayload(
+	GSkipRecordingChunk *pChunk)	//[in,out] fills in payload, and nFlags.
+{
+	std::vector<unsigned char> &payload = pChunk->payload;
+	payload.clear();
+	if (kSkipRecordingChunk_Metadata == pChunk->nType)
+	{
+		const GSkipRecordingMetadata &metadata = pChunk->metadata;
+		payload.resize(GSKIP_RECORDING_METADATA_FIXED_SIZE + sizeof(GSensorDDSRec));
+		PutLittleEndian(&payload[0], metadata.nVendorId, 4);
+		PutLittleEndian(&payload[4], metadata.nProductId, 4);
+		PutLittleEndian(&payload[8], metadata.nProbeType, 4);
+		PutLittleEndian(&payload[12], sizeof(GSensorDDSRec), 4);
+		PutLittleEndian(&payload[16], metadata.firstSampleIndex, 8);
+		PutDouble(&payload[24], metadata.fMeasurementPeriod);
+		PutDouble(&payload[32], metadata.fVoltsPerBit);
+		PutDouble(&payload[40], metadata.fVoltsOffset);
+		memcpy(&payload[GSKIP_RECORDING_METADATA_FIXED_SIZE], &metadata.ddsRec, sizeof(GSensorDDSRec));
+	}
+	else
+	if (kSkipRecordingChunk_Samples == pChunk->nType)
+	{
+		bool bPacked = (0 != (m_nOptions & kSkipRecorderOption_Compress));
+		size_t nNumSamples = pChunk->samples.size();
+		size_t nGapsEnd = GSKIP_RECORDING_SAMPLES_FIXED_SIZE + 8*pChunk->gaps.size();
+		payload.resize(nGapsEnd + (bPacked ? 4 : 2*nNumSamples));
+		PutLittleEndian(&payload[0], pChunk->firstSampleIndex, 8);
+		PutLittleEndian(&payload[8], pChunk->firstTimeUs, 8);
+		PutLittleEndian(&payload[16], pChunk->lastTimeUs, 8);
+		PutLittleEndian(&payload[24], nNumSamples, 4);
+		PutLittleEndian(&payload[28], pChunk->gaps.size(), 4);
+		size_t i;
+		for (i = 0; i < pChunk->gaps.size(); i++)
+		{
+			PutLittleEndian(&payload[GSKIP_RECORDING_SAMPLES_FIXED_SIZE + 8*i], pChunk->gaps[i].nSampleOffset, 4);
+			PutLittleEndian(&payload[GSKIP_RECORDING_SAMPLES_FIXED_SIZE + 8*i + 4], pChunk->gaps[i].nNumMissing, 4);
+		}
+
+		if (!bPacked)
+		{
+			for (i = 0; i < nNumSamples; i++)
+				PutLittleEndian(&payload[nGapsEnd + 2*i], (unsigned short) pChunk->samples[i], 2);
+		}
+		else
+		{
+			pChunk->nType = kSkipRecordingChunk_PackedSamples;
+			if (nNumSamples > 0)
+				GSkipSampleCodec::PackSamples(&pChunk->samples[0], (int) nNumSamples, &payload);
+			PutLittleEndian(&payload[nGapsEnd], payload.size() - (nGapsEnd + 4), 4);
+
+			if (m_nOptions & kSkipRecorderOption_Calibrated)
+			{
+				pChunk->nFlags |= GSKIP_RECORDING_FLAG_CALIBRATED;
+				pChunk->calibrated.resize(nNumSamples);
+				for (i = 0; i < nNumSamples; i++)
+					pChunk->calibrated[i] = m_calibrationSensor.CalibrateData(pChunk->samples[i]*m_fVoltsPerBit + m_fVoltsOffset);
+
+				size_t nCalibratedStart = payload.size();
+				payload.resize(nCalibratedStart + 4);
+				if (nNumSamples > 0)
+					GSkipSampleCodec::PackReals(&pChunk->calibrated[0], (int) nNumSamples, &payload);
+				PutLittleEndian(&payload[nCalibratedStart], payload.size() - (nCalibratedStart + 4), 4);
+			}
+		}
+	}
+	else
+	if (kSkipRecordingChunk_End == pChunk->nType)
+	{
+		payload.resize(GSKIP_RECORDING_END_SIZE);
+		PutLittleEndian(&payload[0], pChunk->nNumSlots, 8);
+		PutLittleEndian(&payload[8], pChunk->nNumRecorded, 8);
+		PutLittleEndian(&payload[16], pChunk->nNumLost, 8);
+	}
+}
+
+struct GSkipRecorderEncodeJob
+{
+	GSkipRecorder *		pRecorder;
+	std::deque<GSkipRecordingChunk *> *pChunks;
+};
+
+void GSkipRecorder::EncodePayloadItem(void *pContext, int nItem)
+{
+	GSkipRecorderEncodeJob *pJob = (GSkipRecorderEncodeJob *) pContext;
+	pJob->pRecorder->EncodePayload((*pJob->pChunks)[nItem]);
+}
+
+void GSkipRecorder::AppendChunk(
+	const GSkipRecordingChunk *pChunk)	//[in] encoded by EncodePayload().
+{
+	unsigned long long offset = m_blockOffset + m_nBlockBytes;
+	if (kSkipRecordingChunk_Metadata == pChunk->nType)
+		m_metadataOffsets.push_back(offset);
+	else
+	if ((kSkipRecordingChunk_Samples == pChunk->nType) || (kSkipRecordingChunk_PackedSamples == pChunk->nType))
+	{
+		if ((0 == m_indexEntries.size()) || 
+			((m_indexEntries.back().offset/GSKIP_RECORDING_INDEX_BLOCK_SIZE) != (offset/GSKIP_RECORDING_INDEX_BLOCK_SIZE)))
+		{
+			GSkipRecordingIndexEntry entry;
+			entry.offset = offset;
+			entry.firstSampleIndex = pChunk->firstSampleIndex;
+			m_indexEntries.push_back(entry);
+		}
+	}
+	else
+	if (kSkipRecordingChunk_Summary == pChunk->nType)
+		m_summaryOffsets.push_back(offset);
+	else
+	if (kSkipRecordingChunk_End == pChunk->nType)
+	{
+		if (m_bSummaryPending)
+			AppendSummary();
+		AppendIndex();
+	}
+
+	const unsigned char *pPayload = (pChunk->payload.size() > 0) ? &pChunk->payload[0] : NULL;
+	size_t nPayloadBytes = pChunk->payload.size();
+
+	unsigned char header[GSKIP_RECORDING_CHUNK_HEADER_SIZE];
+	PutLittleEndian(&header[0], pChunk->nType, 2);
+	PutLittleEndian(&header[2], pChunk->nFlags, 2);
+	PutLittleEndian(&header[4], nPayloadBytes, 4);
+	PutLittleEndian(&header[8], m_nNextSequence++, 4);
+	unsigned int crc = CalculateCrc32(header, 12);
+	PutLittleEndian(&header[12], CalculateCrc32(pPayload, nPayloadBytes, crc), 4);
+
+	AppendBytes(header, sizeof(header));
+	AppendBytes(pPayload, nPayloadBytes);
+
+	if ((kSkipRecordingChunk_Samples == pChunk->nType) || (kSkipRecordingChunk_PackedSamples == pChunk->nType))
+		AddToSummary(pChunk);
+	else
+	if (kSkipRecordingChunk_End == pChunk->nType)
+		AppendTrailer();
+}
+
+void GSkipRecorder::AddToSummary(
+	const GSkipRecordingChunk *pChunk)	//[in] a samples chunk that has just been appended.
+{
+	unsigned long long sampleIndex = pChunk->firstSampleIndex;
+	size_t nStart = 0;
+	for (size_t nGap = 0; nGap <= pChunk->gaps.size(); nGap++)
+	{
+		size_t nEnd = (nGap < pChunk->gaps.size()) ? pChunk->gaps[nGap].nSampleOffset : pChunk->samples.size();
+		if (nEnd > nStart)
+		{
+			AddToSummary(sampleIndex, &pChunk->samples[nStart], nEnd - nStart);
+			sampleIndex += nEnd - nStart;
+			nStart = nEnd;
+		}
+		if (nGap < pChunk->gaps.size())
+			sampleIndex += pChunk->gaps[nGap].nNumMissing;
+	}
+}
+
+void GSkipRecorder::AddToSummary(
+	unsigned long long sampleIndex,	//[in] of pSamples[0].
+	const short *pSamples,			//[in]
+	size_t nNumSamples)				//[in]
+{
+	const int nChunkLevel = GSKIP_RECORDING_SUMMARY_BASE_LEVEL + GSKIP_RECORDING_SUMMARY_LEVELS - 1;
+	while (nNumSamples > 0)
+	{
+		//Write out the summary once the samples move past the slots that it covers.
+		unsigned long long chunkStart = (sampleIndex >> nChunkLevel) << nChunkLevel;
+		if (chunkStart != m_summary.GetFirstSampleIndex())
+		{
+			if (m_bSummaryPending)
+				AppendSummary();
+			m_summary.Clear(chunkStart);
+		}
+		if (sampleIndex > m_summary.GetNextSampleIndex())
+			m_summary.SkipSamples(sampleIndex - m_summary.GetNextSampleIndex());
+
+		size_t nNumInChunk = nNumSamples;
+		if (nNumInChunk > (chunkStart + (1ULL << nChunkLevel) - sampleIndex))
+			nNumInChunk = (size_t) (chunkStart + (1ULL << nChunkLevel) - sampleIndex);
+		m_summaryValues.resize(nNumInChunk);
+		for (size_t i = 0; i < nNumInChunk; i++)
+			m_summaryValues[i] = pSamples[i];
+		m_summary.AddSamples(&m_summaryValues[0], (int) nNumInChunk);
+		m_bSummaryPending = true;
+
+		sampleIndex += nNumInChunk;
+		pSamples += nNumInChunk;
+		nNumSamples -= nNumInChunk;
+	}
+}
+
+void GSkipRecorder::AppendSummary(void)
+{
+	GSkipRecordingChunk summary;
+	summary.nType = kSkipRecordingChunk_Summary;
+	summary.nFlags = 0;
+	std::vector<unsigned char> &payload = summary.payload;
+	payload.resize(GSKIP_RECORDING_SUMMARY_FIXED_SIZE + 
+		GSKIP_RECORDING_SUMMARY_BUCKET_SIZE*((1 << GSKIP_RECORDING_SUMMARY_LEVELS) - 1));
+	unsigned long long chunkStart = m_summary.GetFirstSampleIndex();
+	PutLittleEndian(&payload[0], chunkStart, 8);
+	PutLittleEndian(&payload[8], GSKIP_RECORDING_SUMMARY_BASE_LEVEL, 4);
+	PutLittleEndian(&payload[12], GSKIP_RECORDING_SUMMARY_LEVELS, 4);
+
+	size_t nPos = GSKIP_RECORDING_SUMMARY_FIXED_SIZE;
+	GSamplePyramidBucket bucket;
+	for (int nLevel = GSKIP_RECORDING_SUMMARY_BASE_LEVEL; 
+		nLevel < (GSKIP_RECORDING_SUMMARY_BASE_LEVEL + GSKIP_RECORDING_SUMMARY_LEVELS); nLevel++)
+	{
+		int nNumBuckets = 1 << (GSKIP_RECORDING_SUMMARY_BASE_LEVEL + GSKIP_RECORDING_SUMMARY_LEVELS - 1 - nLevel);
+		for (int i = 0; i < nNumBuckets; i++, nPos += GSKIP_RECORDING_SUMMARY_BUCKET_SIZE)
+		{
+			unsigned long long bucketStart = chunkStart + (((unsigned long long) i) << nLevel);
+			if (m_summary.GetRange(bucketStart, bucketStart + (1ULL << nLevel) - 1, &bucket) && (bucket.nNumSamples > 0))
+			{
+				float fMean = (float) bucket.fMean;
+				unsigned int nMeanBits;
+				memcpy(&nMeanBits, &fMean, 4);
+				PutLittleEndian(&payload[nPos], bucket.nNumSamples, 4);
+				PutLittleEndian(&payload[nPos + 4], (unsigned short) (short) bucket.fMin, 2);
+				PutLittleEndian(&payload[nPos + 6], (unsigned short) (short) bucket.fMax, 2);
+				PutLittleEndian(&payload[nPos + 8], nMeanBits, 4);
+			}
+		}
+	}
+
+	m_bSummaryPending = false;
+	AppendChunk(&summary);
+}
+
+void GSkipRecorder::AppendIndex(void)
+{
+	GSkipRecordingChunk index;
+	index.nType = kSkipRecordingChunk_Index;
+	index.nFlags = 0;
+	m_indexOffset = m_blockOffset + m_nBlockBytes;
+
+	size_t nMaxItems = (GSKIP_RECORDING_MAX_CHUNK_PAYLOAD - 12)/GSKIP_RECORDING_INDEX_ENTRY_SIZE;
+	size_t nNextMetadata = 0;
+	size_t nNextEntry = 0;
+	size_t nNextSummary = 0;
+	do
+	{
+		//Each index chunk stands on its own, so it is split by count rather than bytes.
+		size_t nNumMetadata = m_metadataOffsets.size() - nNextMetadata;
+		if (nNumMetadata > nMaxItems)
+			nNumMetadata = nMaxItems;
+		size_t nNumEntries = m_indexEntries.size() - nNextEntry;
+		if (nNumEntries > (nMaxItems - nNumMetadata))
+			nNumEntries = nMaxItems - nNumMetadata;
+		size_t nNumSummaries = m_summaryOffsets.size() - nNextSummary;
+		if (nNumSummaries > (nMaxItems - nNumMetadata - nNumEntries))
+			nNumSummaries = nMaxItems - nNumMetadata - nNumEntries;
+
+		std::vector<unsigned char> &payload = index.payload;
+		payload.resize(12 + 8*nNumMetadata + GSKIP_RECORDING_INDEX_ENTRY_SIZE*nNumEntries + 8*nNumSummaries);
+		PutLittleEndian(&payload[0], nNumMetadata, 4);
+		PutLittleEndian(&payload[4], nNumEntries, 4);
+		PutLittleEndian(&payload[8], nNumSummaries, 4);
+		size_t nPos = 12;
+		size_t i;
+		for (i = 0; i < nNumMetadata; i++, nPos += 8)
+			PutLittleEndian(&payload[nPos], m_metadataOffsets[nNextMetadata + i], 8);
+		for (i = 0; i < nNumEntries; i++, nPos += GSKIP_RECORDING_INDEX_ENTRY_SIZE)
+		{
+			PutLittleEndian(&payload[nPos], m_indexEntries[nNextEntry + i].offset, 8);
+			PutLittleEndian(&payload[nPos + 8], m_indexEntries[nNextEntry + i].firstSampleIndex, 8);
+		}
+		for (i = 0; i < nNumSummaries; i++, nPos += 8)
+			PutLittleEndian(&payload[nPos], m_summaryOffsets[nNextSummary + i], 8);
+		nNextMetadata += nNumMetadata;
+		nNextEntry += nNumEntries;
+		nNextSummary += nNumSummaries;
+
+		AppendChunk(&index);
+	}
+	while ((nNextMetadata < m_metadataOffsets.size()) || (nNextEntry < m_indexEntries.size()) || 
+		(nNextSummary < m_summaryOffsets.size()));
+}
+
+void GSkipRecorder::AppendTrailer(void)
+{
+	//Zero pad so that the trailer ends a page, leaving room for a zero chunk header in front of it so that
+	//readers that scan past the end chunk still stop at the padding.
+	size_t nPadBytes = GSKIP_RECORDER_PAGE_SIZE - (m_nBlockBytes % GSKIP_RECORDER_PAGE_SIZE);
+	if (nPadBytes < (GSKIP_RECORDING_CHUNK_HEADER_SIZE + GSKIP_RECORDING_TRAILER_SIZE))
+		nPadBytes += GSKIP_RECORDER_PAGE_SIZE;
+	nPadBytes -= GSKIP_RECORDING_TRAILER_SIZE;
+
+	unsigned char zeros[256];
+	memset(zeros, 0, sizeof(zeros));
+	while (nPadBytes > 0)
+	{
+		size_t nNumBytes = (nPadBytes < sizeof(zeros)) ? nPadBytes : sizeof(zeros);
+		AppendBytes(zeros, nNumBytes);
+		nPadBytes -= nNumBytes;
+	}
+
+	unsigned char trailer[GSKIP_RECORDING_TRAILER_SIZE];
+	memcpy(trailer, GSKIP_RECORDING_TRAILER_SIGNATURE, 8);
+	PutLittleEndian(&trailer[8], m_indexOffset, 8);
+	AppendBytes(trailer, sizeof(trailer));
+}
+
+void GSkipRecorder::DrainQueue(void)
+{
+	std::deque<GSkipRecordingChunk *> chunks;
+	if (GThread::OSLockMutex(m_pQueueMutex))
+	{
+		chunks.swap(m_queue);
+		GThread::OSUnlockMutex(m_pQueueMutex);
+	}
+
+	if (chunks.size() > 0)
+	{
+		size_t i;
+		if ((chunks.size() > 1) && (m_nOptions & kSkipRecorderOption_Compress))
+		{
+			//The writer has fallen behind, so spread the compression over the pool.
+			GSkipRecorderEncodeJob job;
+			job.pRecorder = this;
+			job.pChunks = &chunks;
+			GThreadPool::GetSharedPool()->ParallelFor((int) chunks.size(), EncodePayloadItem, &job);
+		}
+		else
+		{
+			for (i = 0; i < chunks.size(); i++)
+				EncodePayload(chunks[i]);
+		}
+
+		size_t nNumBytes = 0;
+		for (i = 0; i < chunks.size(); i++)
+		{
+			AppendChunk(chunks[i]);
+			nNumBytes += GSKIP_RECORDING_CHUNK_HEADER_SIZE + chunks[i]->payload.size();
+		}
+
+		if (GThread::OSLockMutex(m_pQueueMutex))
+		{
+			m_stats.nBytesWritten += nNumBytes;
+			m_freeChunks.insert(m_freeChunks.end(), chunks.begin(), chunks.end());
+			GThread::OSUnlockMutex(m_pQueueMutex);
+		}
+		else
+		{
+			for (i = 0; i < chunks.size(); i++)
+				delete chunks[i];
+		}
+	}
+}
+
+int GSkipRecorder::WriterThreadFunc(void *pParam)
+{
+	GSkipRecorder *pRecorder = (GSkipRecorder *) pParam;
+	int nIOThreadPolicy = 0;
+	while (!pRecorder->m_bStopWriter)
+	{
+		GThread::ApplyIOThreadPolicy(&nIOThreadPolicy);
+		pRecorder->DrainQueue();
+		if ((GUtils::OSGetTimeStamp() - pRecorder->m_lastFlushTimeMs) >= GSKIP_RECORDER_FLUSH_INTERVAL_MS)
+			pRecorder->FlushPartialBlock();
+		GThread::OSWaitEvent(pRecorder->m_pWakeWriterEvent, GSKIP_RECORDER_FLUSH_INTERVAL_MS/4);
+	}
+	pRecorder->DrainQueue();
+	pRecorder->FlushPartialBlock();
+
+	return 0;
+}
+
+int GSkipRecorder::StopWriterThreadFunc(void *pParam)
+{
+	GSkipRecorder *pRecorder = (GSkipRecorder *) pParam;
+	pRecorder->m_bStopWriter = true;
+	GThread::OSSetEvent(pRecorder->m_pWakeWriterEvent);
+	return 0;
+}
+
+GSkipRecordingReader::GSkipRecordingReader()
+{
+	m_pFile = NULL;
+	m_startTime = 0;
+	m_startTimeUs = 0;
+	m_nNumCorruptChunks = 0;
+	m_bEnded = false;
+	m_segmentFirstIndex = 0;
+	m_segmentStartTime = 0.0;
+	m_fSegmentPeriod = 0.0;
+}
+
+GSkipRecordingReader::~GSkipRecordingReader()
+{
+	Close();
+}
+
+bool GSkipRecordingReader::Open(const cppstring &sFileName)
+{
+	bool bResult = false;
+	Close();
+
+	m_pFile = fopen(sFileName.c_str(), "rb");
+	if (m_pFile)
+	{
+		unsigned char header[GSKIP_RECORDING_HEADER_SIZE];
+		if ((1 == fread(header, sizeof(header), 1, m_pFile)) &&
+			(0 == memcmp(header, GSKIP_RECORDING_SIGNATURE, 8)) &&
+			(GSKIP_RECORDING_VERSION == GetLittleEndian(&header[8], 4)))
+		{
+			m_startTime = GetLittleEndian(&header[16], 8);
+			m_startTimeUs = GetLittleEndian(&header[24], 8);
+			bResult = true;
+		}
+	}
+
+	if (!bResult)
+		Close();
+
+	return bResult;
+}
+
+void GSkipRecordingReader::Close(void)
+{
+	if (m_pFile)
+		fclose(m_pFile);
+	m_pFile = NULL;
+	m_nNumCorruptChunks = 0;
+	m_bEnded = false;
+	m_segmentFirstIndex = 0;
+	m_segmentStartTime = 0.0;
+	m_fSegmentPeriod = 0.0;
+}
+
+bool GSkipRecordingReader::ReadRawChunk(
+	int *pnType,				//[out]
+	int *pnFlags,				//[out]
+	unsigned int *pnSequence)	//[out]
+{
+	while (m_pFile && !m_bEnded)
+	{
+		unsigned char header[GSKIP_RECORDING_CHUNK_HEADER_SIZE];
+		if (1 != fread(header, sizeof(header), 1, m_pFile))
+			return false;
+
+		int nType = (int) GetLittleEndian(&header[0], 2);
+		size_t nPayloadBytes = (size_t) GetLittleEndian(&header[4], 4);
+		if (kSkipRecordingChunk_Padding == nType)
+			return false;
+		if (nPayloadBytes > GSKIP_RECORDING_MAX_CHUNK_PAYLOAD)
+		{
+			m_nNumCorruptChunks++;
+			return false;
+		}
+
+		m_payload.resize(nPayloadBytes);
+		if ((nPayloadBytes > 0) && (1 != fread(&m_payload[0], nPayloadBytes, 1, m_pFile)))
+			return false;//truncated
+
+		unsigned int crc = GSkipRecorder::CalculateCrc32(header, 12);
+		if (GSkipRecorder::CalculateCrc32((nPayloadBytes > 0) ? &m_payload[0] : NULL, nPayloadBytes, crc) != 
+			(unsigned int) GetLittleEndian(&header[12], 4))
+		{
+			m_nNumCorruptChunks++;
+			continue;
+		}
+
+		if (kSkipRecordingChunk_End == nType)
+			m_bEnded = true;//only the trailer follows it.
+		(*pnType) = nType;
+		(*pnFlags) = (int) GetLittleEndian(&header[2], 2);
+		(*pnSequence) = (unsigned int) GetLittleEndian(&header[8], 4);
+		return true;
+	}
+
+	return false;
+}
+
+//Check the sizes in a samples or packed samples payload. Packed samples may take less than a bit each.
+static bool ParseSamplesPayload(int nType, const unsigned char *pPayload, size_t nPayloadBytes, 
+	size_t *pnNumSamples, size_t *pnNumGaps)
+{
+	if (nPayloadBytes < GSKIP_RECORDING_SAMPLES_FIXED_SIZE)
+		return false;
+	size_t nNumSamples = (size_t) GetLittleEndian(&pPayload[24], 4);
+	size_t nNumGaps = (size_t) GetLittleEndian(&pPayload[28], 4);
+	if ((nNumGaps > nPayloadBytes/8) || (nNumSamples > GSKIP_CODEC_FRAME_SAMPLES*nPayloadBytes))
+		return false;
+
+	size_t nGapsEnd = GSKIP_RECORDING_SAMPLES_FIXED_SIZE + 8*nNumGaps;
+	if (kSkipRecordingChunk_Samples == nType)
+	{
+		if (nPayloadBytes != (nGapsEnd + 2*nNumSamples))
+			return false;
+	}
+	else
+	if (nPayloadBytes < (nGapsEnd + 4))
+		return false;
+
+	(*pnNumSamples) = nNumSamples;
+	(*pnNumGaps) = nNumGaps;
+	return true;
+}
+
+//Decode the measurements(and calibrated values, if pCalibrated is not NULL) from a payload that passed ParseSamplesPayload().
+static bool DecodeSamplesPayload(int nType, int nFlags, const unsigned char *pPayload, size_t nPayloadBytes, 
+	short *pSamples, real *pCalibrated)
+{
+	size_t nNumSamples = (size_t) GetLittleEndian(&pPayload[24], 4);
+	size_t nPos = GSKIP_RECORDING_SAMPLES_FIXED_SIZE + 8*((size_t) GetLittleEndian(&pPayload[28], 4));
+	if (kSkipRecordingChunk_Samples == nType)
+	{
+		for (size_t i = 0; i < nNumSamples; i++)
+			pSamples[i] = (short) GetLittleEndian(&pPayload[nPos + 2*i], 2);
+		return true;
+	}
+
+	size_t nPackedBytes = (size_t) GetLittleEndian(&pPayload[nPos], 4);
+	nPos += 4;
+	if ((nPackedBytes > (nPayloadBytes - nPos)) ||
+		((nNumSamples > 0) && (0 == GSkipSampleCodec::UnpackSamples(&pPayload[nPos], nPackedBytes, (int) nNumSamples, pSamples))))
+		return false;
+	nPos += nPackedBytes;
+
+	if (pCalibrated && (nFlags & GSKIP_RECORDING_FLAG_CALIBRATED))
+	{
+		if ((nPayloadBytes - nPos) < 4)
+			return false;
+		size_t nCalibratedBytes = (size_t) GetLittleEndian(&pPayload[nPos], 4);
+		nPos += 4;
+		if ((nCalibratedBytes > (nPayloadBytes - nPos)) ||
+			((nNumSamples > 0) && (0 == GSkipSampleCodec::UnpackReals(&pPayload[nPos], nCalibratedBytes, (int) nNumSamples, pCalibrated))))
+			return false;
+	}
+
+	return true;
+}
+
+bool GSkipRecordingReader::DecodePayload(
+	int nType,							//[in]
+	int nFlags,							//[in]
+	const unsigned char *pPayload,		//[in]
+	size_t nPayloadBytes,				//[in]
+	GSkipRecordingChunk *pChunk)		//[out]
+{
+	pChunk->nType = nType;
+	pChunk->nFlags = nFlags;
+	pChunk->samples.clear();
+	pChunk->gaps.clear();
+	pChunk->calibrated.clear();
+
+	if (kSkipRecordingChunk_Metadata == nType)
+	{
+		size_t nDDSRecBytes = (nPayloadBytes >= GSKIP_RECORDING_METADATA_FIXED_SIZE) ? 
+			(size_t) GetLittleEndian(&pPayload[12], 4) : 0;
+		if ((nPayloadBytes < GSKIP_RECORDING_METADATA_FIXED_SIZE) || 
+			(nPayloadBytes < (GSKIP_RECORDING_METADATA_FIXED_SIZE + nDDSRecBytes)))
+			return false;
+
+		GSkipRecordingMetadata &metadata = pChunk->metadata;
+		metadata.nVendorId = (int) GetLittleEndian(&pPayload[0], 4);
+		metadata.nProductId = (int) GetLittleEndian(&pPayload[4], 4);
+		metadata.nProbeType = (int) GetLittleEndian(&pPayload[8], 4);
+		metadata.firstSampleIndex = GetLittleEndian(&pPayload[16], 8);
+		metadata.fMeasurementPeriod = GetDouble(&pPayload[24]);
+		metadata.fVoltsPerBit = GetDouble(&pPayload[32]);
+		metadata.fVoltsOffset = GetDouble(&pPayload[40]);
+		memset(&metadata.ddsRec, 0, sizeof(metadata.ddsRec));
+		if (nDDSRecBytes > sizeof(metadata.ddsRec))
+			nDDSRecBytes = sizeof(metadata.ddsRec);
+		memcpy(&metadata.ddsRec, &pPayload[GSKIP_RECORDING_METADATA_FIXED_SIZE], nDDSRecBytes);
+	}
+	else
+	if ((kSkipRecordingChunk_Samples == nType) || (kSkipRecordingChunk_PackedSamples == nType))
+	{
+		size_t nNumSamples, nNumGaps;
+		if (!ParseSamplesPayload(nType, pPayload, nPayloadBytes, &nNumSamples, &nNumGaps))
+			return false;
+
+		pChunk->nType = kSkipRecordingChunk_Samples;
+		pChunk->firstSampleIndex = GetLittleEndian(&pPayload[0], 8);
+		pChunk->firstTimeUs = GetLittleEndian(&pPayload[8], 8);
+		pChunk->lastTimeUs = GetLittleEndian(&pPayload[16], 8);
+		pChunk->gaps.resize(nNumGaps);
+		for (size_t i = 0; i < nNumGaps; i++)
+		{
+			pChunk->gaps[i].nSampleOffset = (unsigned int) GetLittleEndian(&pPayload[GSKIP_RECORDING_SAMPLES_FIXED_SIZE + 8*i], 4);
+			pChunk->gaps[i].nNumMissing = (unsigned int) GetLittleEndian(&pPayload[GSKIP_RECORDING_SAMPLES_FIXED_SIZE + 8*i + 4], 4);
+		}
+		pChunk->samples.resize(nNumSamples + 1);//+ 1 so that &samples[0] is valid.
+		if (nFlags & GSKIP_RECORDING_FLAG_CALIBRATED)
+			pChunk->calibrated.resize(nNumSamples + 1);
+		if (!DecodeSamplesPayload(nType, nFlags, pPayload, nPayloadBytes, &pChunk->samples[0], 
+				(pChunk->calibrated.size() > 0) ? &pChunk->calibrated[0] : NULL))
+			return false;
+		pChunk->samples.resize(nNumSamples);
+		if (pChunk->calibrated.size() > 0)
+			pChunk->calibrated.resize(nNumSamples);
+	}
+	else
+	if (kSkipRecordingChunk_End == nType)
+	{
+		if (nPayloadBytes < GSKIP_RECORDING_END_SIZE)
+			return false;
+
+		pChunk->nNumSlots = GetLittleEndian(&pPayload[0], 8);
+		pChunk->nNumRecorded = GetLittleEndian(&pPayload[8], 8);
+		pChunk->nNumLost = GetLittleEndian(&pPayload[16], 8);
+	}
+	//Index and summary chunks, and chunk types from later versions, are returned with just the type and flags filled in.
+
+	return true;
+}
+
+bool GSkipRecordingReader::DecodeChunk(
+	int nType,					//[in]
+	int nFlags,					//[in]
+	unsigned int nSequence,		//[in]
+	GSkipRecordingChunk *pChunk)//[out]
+{
+	pChunk->nSequence = nSequence;
+	if (!DecodePayload(nType, nFlags, (m_payload.size() > 0) ? &m_payload[0] : NULL, m_payload.size(), pChunk))
+		return false;
+
+	if (kSkipRecordingChunk_Metadata == nType)
+	{
+		m_segmentStartTime = GetSampleTime(pChunk->metadata.firstSampleIndex);
+		m_segmentFirstIndex = pChunk->metadata.firstSampleIndex;
+		m_fSegmentPeriod = pChunk->metadata.fMeasurementPeriod;
+	}
+
+	return true;
+}
+
+bool GSkipRecordingReader::ReadChunk(
+	GSkipRecordingChunk *pChunk)	//[out]
+{
+	int nType, nFlags;
+	unsigned int nSequence;
+	while (ReadRawChunk(&nType, &nFlags, &nSequence))
+	{
+		if (DecodeChunk(nType, nFlags, nSequence, pChunk))
+			return true;
+		m_nNumCorruptChunks++;
+	}
+
+	return false;
+}
+
+struct GSkipRecordingDecodeJob
+{
+	std::vector<int>	types;
+	std::vector<int>	flags;
+	std::vector<std::vector<unsigned char> > payloads;
+	std::vector<size_t>	sampleOffsets;//into pData->samples.
+	GSkipRecordingData *pData;
+	volatile int		nNumFailed;
+};
+
+void GSkipRecordingReader::DecodeSamplesItem(void *pContext, int nItem)
+{
+	GSkipRecordingDecodeJob *pJob = (GSkipRecordingDecodeJob *) pContext;
+	const std::vector<unsigned char> &payload = pJob->payloads[nItem];
+	size_t nOffset = pJob->sampleOffsets[nItem];
+	short *pSamples = (pJob->pData->samples.size() > 0) ? &pJob->pData->samples[0] : NULL;
+	real *pCalibrated = (pJob->pData->calibrated.size() > 0) ? &pJob->pData->calibrated[0] : NULL;
+	if (!DecodeSamplesPayload(pJob->types[nItem], pJob->flags[nItem], &payload[0], payload.size(), 
+			pSamples ? (pSamples + nOffset) : NULL, pCalibrated ? (pCalibrated + nOffset) : NULL))
+		GThread::OSAtomicAdd(&pJob->nNumFailed, 1);
+}
+
+bool GSkipRecordingReader::ReadAll(
+	GSkipRecordingData *pData,		//[out]
+	GThreadPool *pPool /* = NULL */)//[in] NULL to use the shared pool.
+{
+	pData->metadata.clear();
+	pData->samples.clear();
+	pData->calibrated.clear();
+	pData->gaps.clear();
+	pData->bEnded = false;
+	if (NULL == m_pFile)
+		return false;
+
+	//Read the chunks in order, which is all the file I/O, and work out where each chunk's samples go.
+	GSkipRecordingDecodeJob job;
+	job.pData = pData;
+	job.nNumFailed = 0;
+	GSkipRecordingChunk chunk;
+	unsigned long long nextSampleIndex = 0;
+	size_t nNumSamples = 0;
+	bool bCalibrated = false;
+	int nType, nFlags;
+	unsigned int nSequence;
+	while (ReadRawChunk(&nType, &nFlags, &nSequence))
+	{
+		size_t nChunkSamples, nNumGaps;
+		if ((kSkipRecordingChunk_Samples == nType) || (kSkipRecordingChunk_PackedSamples == nType))
+		{
+			if (!ParseSamplesPayload(nType, &m_payload[0], m_payload.size(), &nChunkSamples, &nNumGaps))
+			{
+				m_nNumCorruptChunks++;
+				continue;
+			}
+
+			GSkipRecordingGap gap;
+			unsigned long long firstSampleIndex = GetLittleEndian(&m_payload[0], 8);
+			if ((pData->metadata.size() > 0) && (firstSampleIndex > nextSampleIndex))
+			{
+				gap.nSampleOffset = (unsigned int) nNumSamples;
+				gap.nNumMissing = (unsigned int) (firstSampleIndex - nextSampleIndex);
+				pData->gaps.push_back(gap);
+			}
+			nextSampleIndex = firstSampleIndex + nChunkSamples;
+			for (size_t i = 0; i < nNumGaps; i++)
+			{
+				gap.nSampleOffset = (unsigned int) (nNumSamples + GetLittleEndian(&m_payload[GSKIP_RECORDING_SAMPLES_FIXED_SIZE + 8*i], 4));
+				gap.nNumMissing = (unsigned int) GetLittleEndian(&m_payload[GSKIP_RECORDING_SAMPLES_FIXED_SIZE + 8*i + 4], 4);
+				pData->gaps.push_back(gap);
+				nextSampleIndex += gap.nNumMissing;
+			}
+
+			if (nFlags & GSKIP_RECORDING_FLAG_CALIBRATED)
+				bCalibrated = true;
+			job.types.push_back(nType);
+			job.flags.push_back(nFlags);
+			job.sampleOffsets.push_back(nNumSamples);
+			job.payloads.push_back(std::vector<unsigned char>());
+			job.payloads.back().swap(m_payload);
+			nNumSamples += nChunkSamples;
+		}
+		else
+		if (DecodeChunk(nType, nFlags, nSequence, &chunk))
+		{
+			if (kSkipRecordingChunk_Metadata == nType)
+			{
+				pData->metadata.push_back(chunk.metadata);
+				if (1 == pData->metadata.size())
+					nextSampleIndex = chunk.metadata.firstSampleIndex;
+			}
+			else
+			if (kSkipRecordingChunk_End == nType)
+				pData->bEnded = true;
+		}
+		else
+			m_nNumCorruptChunks++;
+	}
+
+	//Then decode the samples, one chunk per item.
+	pData->samples.resize(nNumSamples);
+	if (bCalibrated)
+		pData->calibrated.resize(nNumSamples);
+	if (NULL == pPool)
+		pPool = GThreadPool::GetSharedPool();
+	if (pPool)
+		pPool->ParallelFor((int) job.payloads.size(), DecodeSamplesItem, &job);
+	else
+	{
+		for (size_t i = 0; i < job.payloads.size(); i++)
+			DecodeSamplesItem(&job, (int) i);
+	}
+	m_nNumCorruptChunks += job.nNumFailed;
+
+	return ((pData->metadata.size() > 0) || (nNumSamples > 0));
+}
+
+real GSkipRecordingReader::GetSampleTime(unsigned long long sampleIndex)
+{
+	return m_segmentStartTime + ((real) (long long) (sampleIndex - m_segmentFirstIndex))*m_fSegmentPeriod;
+}
+
+#ifdef LIB_NAMESPACE
+}
+#endif
@@ -0,0 +1,371 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipRecorder.h
+//
+// GSkipRecorder streams the measurements from one device to a recording file, for captures that must be kept
+// intact and read back later. The listener thread appends each measurement packet to the current batch, and hands
+// the batch to a background writer thread once it is full or GSKIP_RECORDER_MAX_BATCH_AGE_MS old, so the
+// acquisition path pays one enqueue per batch. The writer thread encodes the batches as checksummed chunks and
+// writes them in GSKIP_RECORDER_BLOCK_SIZE blocks at block aligned file offsets. Once a second it also writes the
+// partially filled block(padded to GSKIP_RECORDER_PAGE_SIZE), so a crash loses at most a second of data.
+// GSkipRecordingReader reads the chunks back.
+//
+// With kSkipRecorderOption_Compress, the measurements are delta/bit packed(see GSkipSampleCodec.h), which typically
+// shrinks them 4 - 8 times, and kSkipRecorderOption_Calibrated adds the calibrated value of every measurement,
+// XOR encoded. Chunks are independent, so when the writer falls behind it compresses the queued chunks in parallel
+// on the shared GThreadPool, and GSkipRecordingReader::ReadAll() decompresses them in parallel as well.
+//
+// The writer also keeps a GSamplePyramid of the measurements, and writes it out as a summary chunk for every
+// 2^(GSKIP_RECORDING_SUMMARY_BASE_LEVEL + GSKIP_RECORDING_SUMMARY_LEVELS - 1) sample slots, so that plots of a
+// long recording can be drawn from the summaries(see GSkipRecordingMap::GetEnvelope()) instead of the samples.
+//
+// Every measurement slot gets a sample index, counting from 0 when recording starts. Measurements the device sent
+// but the host never received(rolling counter gaps) keep their indices and are listed as gaps, so the time of a 
+// sample is always its index times the measurement period. The rolling counter is 8 bits, so gaps are known modulo 
+// 256. Batches that the recorder itself discards because the writer fell GSKIP_RECORDER_MAX_QUEUED_CHUNKS chunks 
+// behind show up as a jump in the first sample index of the next samples chunk.
+//
+// File layout(all multi-byte fields are little endian, doubles are IEEE 754 bit patterns):
+//		header(32 bytes):
+//			signature		8 bytes, "GOIOREC1"
+//			version			4 bytes, currently 1
+//			reserved		4 bytes
+//			start time		8 bytes, host wall clock time when recording started, in seconds since 1970
+//			start time us	8 bytes, GUtils::OSGetTimeStampMicroseconds() when recording started
+//		followed by chunks, each with a 16 byte header:
+//			type			2 bytes, see ESkipRecordingChunkType. 0 marks the zero padding after the last chunk.
+//			flags			2 bytes, GSKIP_RECORDING_FLAG_*
+//			payload length	4 bytes
+//			sequence		4 bytes, 0 for the first chunk, then +1 for each chunk
+//			crc32			4 bytes, CRC-32(as in zip) of the first 12 header bytes followed by the payload
+//		metadata payload(written at the start, and whenever the measurement period changes):
+//			vendor id		4 bytes
+//			product id		4 bytes
+//			probe type		4 bytes, EProbeType
+//			dds rec size	4 bytes
+//			first index		8 bytes, the period applies from this sample index on
+//			period			8 bytes, double, seconds
+//			volts per bit	8 bytes, double, voltage = raw*volts per bit + volts offset
+//			volts offset	8 bytes, double
+//			dds rec			dds rec size bytes, GSensorDDSRec including the calibration pages, as stored on the sensor
+//		samples payload:
+//			first index		8 bytes, sample index of the first slot in the chunk
+//			first time us	8 bytes, GUtils::OSGetTimeStampMicroseconds() when the first packet in the chunk arrived
+//			last time us	8 bytes, GUtils::OSGetTimeStampMicroseconds() when the last packet in the chunk arrived
+//			# of samples	4 bytes
+//			# of gaps		4 bytes
+//			gaps			8 bytes each: # of samples in the chunk before the gap(4 bytes), # of missing samples(4 bytes)
+//			samples			2 bytes each, raw measurements
+//		packed samples payload:
+//			the samples payload up to and including the gaps, then
+//			packed size		4 bytes
+//			samples			packed size bytes, GSkipSampleCodec::PackSamples()
+//			and if GSKIP_RECORDING_FLAG_CALIBRATED is set:
+//			calibrated size	4 bytes
+//			calibrated		calibrated size bytes, GSkipSampleCodec::PackReals() of the calibrated values
+//		summary payload(written once the slots that it covers are past, and when recording stops):
+//			first index		8 bytes, first slot covered, a multiple of 2^(base level + # of levels - 1)
+//			base level		4 bytes, log2 of the slots per bucket at the first level, GSKIP_RECORDING_SUMMARY_BASE_LEVEL
+//			# of levels		4 bytes, GSKIP_RECORDING_SUMMARY_LEVELS
+//			buckets			12 bytes each, the 2^(# of levels - 1) buckets of the first level in order, then the half as
+//							many buckets of the next level, and so on up to the one bucket that covers the whole chunk:
+//							# of samples(4 bytes), min(2 bytes), max(2 bytes), mean(4 bytes, float), all in raw 
+//							measurement units. Buckets without samples are all zero.
+//		end payload(written when recording stops):
+//			# of slots		8 bytes, sample index that the next sample would have had
+//			# recorded		8 bytes, samples written to the file
+//			# lost			8 bytes, samples discarded because the writer fell behind
+//		index payload(written when recording stops, just before the end chunk, split over consecutive index chunks 
+//		if it is too long for one):
+//			# of metadata	4 bytes
+//			# of entries	4 bytes
+//			# of summaries	4 bytes
+//			metadata		8 bytes each, file offset of a metadata chunk
+//			entries			16 bytes each, for the first samples chunk that starts in each GSKIP_RECORDING_INDEX_BLOCK_SIZE
+//							block of the file: file offset of the chunk(8 bytes), first index of the chunk(8 bytes)
+//			summaries		8 bytes each, file offset of a summary chunk
+//		trailer(the last 16 bytes of a file whose recording was stopped, after the zero padding):
+//			signature		8 bytes, "GOIOIDX1"
+//			index offset	8 bytes, file offset of the first index chunk
+//
+// The end chunk is the last chunk. GSkipRecordingMap uses the index to find the chunks that hold a range of samples
+// without reading the rest of the file. Recordings that were never stopped have no index, so it scans the chunk 
+// headers instead.
+
+#ifndef _GSKIPRECORDER_H_
+#define _GSKIPRECORDER_H_
+
+#include <stdio.h>
+#include "GTypes.h"
+#include "GThread.h"
+#include "GThreadPool.h"
+#include "GSamplePyramid.h"
+#include "GSensorDDSMem.h"
+#include "GMBLSensor.h"
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+#define GSKIP_RECORDING_SIGNATURE "GOIOREC1"
+#define GSKIP_RECORDING_VERSION 1
+#define GSKIP_RECORDING_HEADER_SIZE 32
+#define GSKIP_RECORDING_CHUNK_HEADER_SIZE 16
+#define GSKIP_RECORDING_MAX_CHUNK_PAYLOAD 0x100000 //larger lengths are treated as corruption.
+#define GSKIP_RECORDING_FLAG_CALIBRATED 0x0001
+#define GSKIP_RECORDING_INDEX_BLOCK_SIZE 65536
+#define GSKIP_RECORDING_INDEX_ENTRY_SIZE 16
+#define GSKIP_RECORDING_TRAILER_SIGNATURE "GOIOIDX1"
+#define GSKIP_RECORDING_TRAILER_SIZE 16
+#define GSKIP_RECORDING_SUMMARY_BASE_LEVEL 10
+#define GSKIP_RECORDING_SUMMARY_LEVELS 13
+#define GSKIP_RECORDING_SUMMARY_FIXED_SIZE 16
+#define GSKIP_RECORDING_SUMMARY_BUCKET_SIZE 12
+
+#define GSKIP_RECORDER_BATCH_SAMPLES 512
+#define GSKIP_RECORDER_MAX_BATCH_AGE_MS 250
+#define GSKIP_RECORDER_MAX_QUEUED_CHUNKS 256
+#define GSKIP_RECORDER_BLOCK_SIZE 65536
+#define GSKIP_RECORDER_PAGE_SIZE 4096
+#define GSKIP_RECORDER_FLUSH_INTERVAL_MS 1000
+
+enum ESkipRecordingChunkType
+{
+	kSkipRecordingChunk_Padding = 0,
+	kSkipRecordingChunk_Metadata,
+	kSkipRecordingChunk_Samples,
+	kSkipRecordingChunk_End,
+	kSkipRecordingChunk_PackedSamples,
+	kSkipRecordingChunk_Index,
+	kSkipRecordingChunk_Summary
+};
+
+enum ESkipRecorderOption
+{
+	kSkipRecorderOption_Compress = 1,
+	kSkipRecorderOption_Calibrated = 2 //implies kSkipRecorderOption_Compress.
+};
+
+struct GSkipRecordingMetadata
+{
+	int					nVendorId;
+	int					nProductId;
+	int					nProbeType;
+	unsigned long long	firstSampleIndex;
+	real				fMeasurementPeriod;//seconds, 0.0 if unknown.
+	real				fVoltsPerBit;
+	real				fVoltsOffset;
+	GSensorDDSRec		ddsRec;
+};
+
+struct GSkipRecordingIndexEntry
+{
+	unsigned long long	offset;//of a samples or packed samples chunk.
+	unsigned long long	firstSampleIndex;
+};
+
+struct GSkipRecordingGap
+{
+	unsigned int		nSampleOffset;//# of samples in the chunk that precede the gap.
+	unsigned int		nNumMissing;
+};
+
+// Decoded form of a chunk. Only the fields for nType are meaningful. GSkipRecordingReader returns packed samples
+// chunks as kSkipRecordingChunk_Samples chunks.
+struct GSkipRecordingChunk
+{
+	int					nType;//ESkipRecordingChunkType
+	int					nFlags;
+	unsigned int		nSequence;
+
+	GSkipRecordingMetadata metadata;
+
+	unsigned long long	firstSampleIndex;
+	unsigned long long	firstTimeUs;
+	unsigned long long	lastTimeUs;
+	std::vector<short>	samples;
+	std::vector<GSkipRecordingGap> gaps;
+	std::vector<real>	calibrated;//empty unless GSKIP_RECORDING_FLAG_CALIBRATED is set.
+
+	unsigned long long	nNumSlots;
+	unsigned long long	nNumRecorded;
+	unsigned long long	nNumLost;
+
+	std::vector<unsigned char> payload;//encoded by the writer thread.
+};
+
+// A whole recording, as read by GSkipRecordingReader::ReadAll().
+struct GSkipRecordingData
+{
+	std::vector<GSkipRecordingMetadata> metadata;
+	std::vector<short>	samples;
+	std::vector<real>	calibrated;//one per sample if the recording has calibrated values, else empty.
+	std::vector<GSkipRecordingGap> gaps;//nSampleOffset counts from samples[0]. Includes samples that were not recorded.
+	bool				bEnded;//false if the recording has no end chunk, e.g. because the app crashed.
+};
+
+struct GSkipRecorderStats
+{
+	unsigned long long	nSamplesRecorded;//handed to the writer thread.
+	unsigned long long	nSamplesMissing;//rolling counter gaps.
+	unsigned long long	nSamplesLost;//discarded because the writer fell behind.
+	unsigned long long	nBytesWritten;
+	bool				bWriteFailed;//nothing further is written once a write fails.
+};
+
+class GSkipRecorder
+{
+public:
+	// Create sFileName(overwriting any existing file), write the header and metadata, and start the writer thread.
+	// nOptions is a combination of ESkipRecorderOption. Returns NULL on failure.
+	static GSkipRecorder *	Create(const cppstring &sFileName, const GSkipRecordingMetadata &metadata, int nOptions = 0);
+						~GSkipRecorder();//Writes out everything queued, ends the recording, and closes the file.
+
+	// Producer side: calls must be serialized with each other and with the destructor(the device uses its callback
+	// mutex), but they do not wait for the writer thread.
+	void				AddMeasurements(const int *pMeasurements, int nNumMeasurements, int nNumMissing);
+	void				FlushIfStale(void);//hand over the current batch if it is GSKIP_RECORDER_MAX_BATCH_AGE_MS old.
+	void				SetMeasurementPeriod(real fPeriodInSeconds);//records a metadata chunk if the period changed.
+
+	void				GetStats(GSkipRecorderStats *pStats);//may be called from any thread.
+	const cppstring &	GetFileName(void) { return m_sFileName; }
+
+	static unsigned int	CalculateCrc32(const unsigned char *pBytes, size_t nNumBytes, unsigned int crc = 0);
+
+private:
+						GSkipRecorder(FILE *pFile, const cppstring &sFileName, const GSkipRecordingMetadata &metadata,
+							int nOptions);
+
+	void				HandOffBatch(void);
+	bool				EnqueueChunk(GSkipRecordingChunk *pChunk, bool bMayDrop);
+	GSkipRecordingChunk *	AllocChunk(int nType);
+
+	void				DrainQueue(void);
+	void				EncodePayload(GSkipRecordingChunk *pChunk);//thread safe, so chunks can be encoded in parallel.
+	static void			EncodePayloadItem(void *pContext, int nItem);
+	void				AppendChunk(const GSkipRecordingChunk *pChunk);
+	void				AddToSummary(const GSkipRecordingChunk *pChunk);
+	void				AddToSummary(unsigned long long sampleIndex, const short *pSamples, size_t nNumSamples);
+	void				AppendSummary(void);
+	void				AppendIndex(void);
+	void				AppendTrailer(void);
+	void				AppendBytes(const unsigned char *pBytes, size_t nNumBytes);
+	void				WriteBlock(size_t nNumBytes);
+	void				FlushPartialBlock(void);
+	static int			WriterThreadFunc(void *pParam);
+	static int			StopWriterThreadFunc(void *pParam);
+
+	cppstring			m_sFileName;
+	GSkipRecordingMetadata m_metadata;
+	int					m_nOptions;
+	GMBLSensor			m_calibrationSensor;//only used to calibrate.
+	real				m_fVoltsPerBit;
+	real				m_fVoltsOffset;
+
+	// Producer state:
+	GSkipRecordingChunk *	m_pBatch;
+	GSkipRecordingChunk *	m_pSpareChunk;//taken from m_freeChunks while m_pQueueMutex is held anyway.
+	unsigned int		m_batchStartTimeMs;
+	unsigned long long	m_nextSampleIndex;
+
+	// Shared state, protected by m_pQueueMutex:
+	OSMutex				m_pQueueMutex;
+	std::deque<GSkipRecordingChunk *> m_queue;
+	std::vector<GSkipRecordingChunk *> m_freeChunks;
+	GSkipRecorderStats	m_stats;
+
+	// Writer thread state:
+	OSEvent				m_pWakeWriterEvent;
+	GLiteThread *		m_pWriterThread;
+	volatile bool		m_bStopWriter;
+	FILE *				m_pFile;
+	unsigned char *		m_pBlock;
+	size_t				m_nBlockBytes;//bytes of m_pBlock filled so far.
+	long				m_blockOffset;//file offset of m_pBlock.
+	bool				m_bBlockDirty;//m_pBlock holds bytes that have not been written since they were added.
+	unsigned int		m_lastFlushTimeMs;
+	unsigned int		m_nNextSequence;
+	std::vector<unsigned long long> m_metadataOffsets;
+	std::vector<GSkipRecordingIndexEntry> m_indexEntries;
+	std::vector<unsigned long long> m_summaryOffsets;
+	GSamplePyramid		m_summary;//of the slots that the next summary chunk covers.
+	bool				m_bSummaryPending;//m_summary holds samples that have not been written out.
+	std::vector<real>	m_summaryValues;
+	unsigned long long	m_indexOffset;//of the first index chunk, once it has been appended.
+};
+
+class GSkipRecordingReader
+{
+public:
+						GSkipRecordingReader();
+						~GSkipRecordingReader();
+
+	bool				Open(const cppstring &sFileName);//Reads and validates the header.
+	void				Close(void);
+
+	unsigned long long	GetStartTime(void) { return m_startTime; }
+	unsigned long long	GetStartTimeUs(void) { return m_startTimeUs; }
+
+	// Read the next intact chunk, return false at the end of the recording. Chunks that fail the crc check are
+	// skipped and counted. A corrupt length cannot be skipped, so it ends the recording.
+	bool				ReadChunk(GSkipRecordingChunk *pChunk);
+
+	// Decode a payload that passed the crc check into pChunk(except for nSequence). Returns false if it is malformed.
+	static bool			DecodePayload(int nType, int nFlags, const unsigned char *pPayload, size_t nPayloadBytes,
+							GSkipRecordingChunk *pChunk);
+
+	// Read the rest of the recording in one go. The chunks are read in order, then decoded in parallel on pPool
+	// (NULL for the shared pool). Returns false if nothing could be read.
+	bool				ReadAll(GSkipRecordingData *pData, GThreadPool *pPool = NULL);
+	int					GetNumCorruptChunks(void) { return m_nNumCorruptChunks; }
+
+	// Seconds from sample index 0 to sampleIndex, using the periods from the metadata chunks read so far.
+	real				GetSampleTime(unsigned long long sampleIndex);
+
+private:
+	bool				ReadRawChunk(int *pnType, int *pnFlags, unsigned int *pnSequence);//into m_payload, crc checked.
+	bool				DecodeChunk(int nType, int nFlags, unsigned int nSequence, GSkipRecordingChunk *pChunk);//m_payload
+	static void			DecodeSamplesItem(void *pContext, int nItem);
+
+	FILE *				m_pFile;
+	unsigned long long	m_startTime;
+	unsigned long long	m_startTimeUs;
+	int					m_nNumCorruptChunks;
+	bool				m_bEnded;//the end chunk has been read.
+	unsigned long long	m_segmentFirstIndex;
+	real				m_segmentStartTime;
+	real				m_fSegmentPeriod;
+	std::vector<unsigned char> m_payload;
+};
+
+#ifdef LIB_NAMESPACE
+}
+#endif
+
+#endif // _GSKIPRECORDER_H_
@@ -0,0 +1,721 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipRecordingMap.cpp
+
+#include "stdafx.h"
+#include <math.h>
+#include <algorithm>
+#include "GSkipRecordingMap.h"
+#include "GUtils.h"
+#include "GThreadPool.h"
+
+#ifdef _DEBUG
+#include "GPlatformDebug.h" // for DEBUG_NEW definition
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+static unsigned long long GetLittleEndian(const unsigned char *pSrc, int nBytes)
+{
+	unsigned long long value = 0;
+	for (int i = nBytes - 1; i >= 0; i--)
+		value = (value << 8) | pSrc[i];
+	return value;
+}
+
+static bool IsSummaryBefore(const GSkipRecordingMapSummary &summary, unsigned long long sampleIndex)
+{
+	return summary.firstSampleIndex < sampleIndex;
+}
+
+//Read the bucket at nLevel that holds sampleIndex from the buckets of a summary chunk that starts at chunkStart.
+static void ReadSummaryBucket(const unsigned char *pBuckets, int nLevel, unsigned long long chunkStart, 
+	unsigned long long sampleIndex, GSamplePyramidBucket *pBucket)
+{
+	int nLevelNum = nLevel - GSKIP_RECORDING_SUMMARY_BASE_LEVEL;
+	size_t nBucket = ((size_t) 1 << GSKIP_RECORDING_SUMMARY_LEVELS) - ((size_t) 1 << (GSKIP_RECORDING_SUMMARY_LEVELS - nLevelNum));
+	nBucket += (size_t) ((sampleIndex - chunkStart) >> nLevel);
+	const unsigned char *pSrc = &pBuckets[GSKIP_RECORDING_SUMMARY_BUCKET_SIZE*nBucket];
+
+	unsigned int nMeanBits = (unsigned int) GetLittleEndian(&pSrc[8], 4);
+	float fMean;
+	memcpy(&fMean, &nMeanBits, 4);
+	pBucket->firstSampleIndex = (sampleIndex >> nLevel) << nLevel;
+	pBucket->nNumSamples = (unsigned int) GetLittleEndian(&pSrc[0], 4);
+	pBucket->fMin = (short) GetLittleEndian(&pSrc[4], 2);
+	pBucket->fMax = (short) GetLittleEndian(&pSrc[6], 2);
+	pBucket->fMean = fMean;
+}
+
+static bool IsEntryBefore(const GSkipRecordingIndexEntry &entry, unsigned long long sampleIndex)
+{
+	return entry.firstSampleIndex < sampleIndex;
+}
+
+GSkipRecordingMap::GSkipRecordingMap(int nMaxCachedBlocks /* = GSKIP_RECORDING_MAP_DEFAULT_CACHE_BLOCKS */)
+{
+	m_nMaxCachedBlocks = nMaxCachedBlocks;
+	m_pData = NULL;
+	m_nFileSize = 0;
+	m_pMapping = NULL;
+	m_nNextUse = 0;
+	Close();
+}
+
+GSkipRecordingMap::~GSkipRecordingMap()
+{
+	Close();
+}
+
+bool GSkipRecordingMap::Open(const cppstring &sFileName)
+{
+	Close();
+
+	m_pData = GUtils::OSMapFileReadOnly(sFileName, &m_nFileSize, &m_pMapping);
+	if (m_pData && ((m_nFileSize < GSKIP_RECORDING_HEADER_SIZE) || 
+		(0 != memcmp(m_pData, GSKIP_RECORDING_SIGNATURE, 8)) || 
+		(GSKIP_RECORDING_VERSION != GetLittleEndian(&m_pData[8], 4))))
+		Close();
+	if (NULL == m_pData)
+		return false;
+
+	m_startTime = GetLittleEndian(&m_pData[16], 8);
+	m_bHasIndex = LoadIndex();
+	if (!m_bHasIndex)
+		ScanChunks();
+	LoadMetadata();
+
+	if ((0 == m_numSlots) && (m_indexEntries.size() > 0))
+	{
+		//Not stopped, so find the end of the last block instead.
+		std::vector<GSkipRecordingView> views;
+		GetSamples(m_indexEntries.back().firstSampleIndex, ~0ULL, &views);
+		if (views.size() > 0)
+			m_numSlots = views.back().firstSampleIndex + views.back().nNumSamples;
+	}
+
+	return true;
+}
+
+void GSkipRecordingMap::Close(void)
+{
+	if (m_pData)
+		GUtils::OSUnmapFile(m_pData, m_nFileSize, m_pMapping);
+	m_pData = NULL;
+	m_nFileSize = 0;
+	m_pMapping = NULL;
+	m_startTime = 0;
+	m_dataEnd = 0;
+	m_numSlots = 0;
+	m_bHasIndex = false;
+	m_nNumCorruptChunks = 0;
+	m_metadataOffsets.clear();
+	m_indexEntries.clear();
+	m_summaries.clear();
+	m_coarseSummary.Clear();
+	m_bHasCoarseSummary = false;
+	m_metadata.clear();
+	m_segmentStartTimes.clear();
+	for (std::map<size_t, GSkipRecordingMapBlock *>::iterator iter = m_cache.begin(); iter != m_cache.end(); iter++)
+		delete iter->second;
+	m_cache.clear();
+}
+
+bool GSkipRecordingMap::GetChunkHeader(
+	unsigned long long offset,	//[in]
+	int *pnType,				//[out]
+	int *pnFlags,				//[out]
+	size_t *pnPayloadBytes)		//[out]
+{
+	if ((offset + GSKIP_RECORDING_CHUNK_HEADER_SIZE) > m_nFileSize)
+		return false;
+
+	const unsigned char *pHeader = &m_pData[offset];
+	(*pnType) = (int) GetLittleEndian(&pHeader[0], 2);
+	(*pnFlags) = (int) GetLittleEndian(&pHeader[2], 2);
+	(*pnPayloadBytes) = (size_t) GetLittleEndian(&pHeader[4], 4);
+	return ((kSkipRecordingChunk_Padding != (*pnType)) && ((*pnPayloadBytes) <= GSKIP_RECORDING_MAX_CHUNK_PAYLOAD) &&
+		((offset + GSKIP_RECORDING_CHUNK_HEADER_SIZE + (*pnPayloadBytes)) <= m_nFileSize));
+}
+
+bool GSkipRecordingMap::IsChunkIntact(
+	unsigned long long offset,	//[in] of a chunk that passed GetChunkHeader().
+	size_t nPayloadBytes)		//[in]
+{
+	const unsigned char *pHeader = &m_pData[offset];
+	unsigned int crc = GSkipRecorder::CalculateCrc32(pHeader, 12);
+	crc = GSkipRecorder::CalculateCrc32(&pHeader[GSKIP_RECORDING_CHUNK_HEADER_SIZE], nPayloadBytes, crc);
+	return (crc == (unsigned int) GetLittleEndian(&pHeader[12], 4));
+}
+
+bool GSkipRecordingMap::LoadIndex(void)
+{
+	if (m_nFileSize < (GSKIP_RECORDING_HEADER_SIZE + GSKIP_RECORDING_TRAILER_SIZE))
+		return false;
+	const unsigned char *pTrailer = &m_pData[m_nFileSize - GSKIP_RECORDING_TRAILER_SIZE];
+	if (0 != memcmp(pTrailer, GSKIP_RECORDING_TRAILER_SIGNATURE, 8))
+		return false;//not stopped yet, or the app crashed.
+
+	unsigned long long indexOffset = GetLittleEndian(&pTrailer[8], 8);
+	unsigned long long offset = indexOffset;
+	int nType, nFlags;
+	size_t nPayloadBytes;
+	bool bIntact = (indexOffset >= GSKIP_RECORDING_HEADER_SIZE);
+	while (bIntact && GetChunkHeader(offset, &nType, &nFlags, &nPayloadBytes) && (kSkipRecordingChunk_Index == nType))
+	{
+		const unsigned char *pPayload = &m_pData[offset + GSKIP_RECORDING_CHUNK_HEADER_SIZE];
+		size_t nNumMetadata = (nPayloadBytes >= 12) ? (size_t) GetLittleEndian(&pPayload[0], 4) : 0;
+		size_t nNumEntries = (nPayloadBytes >= 12) ? (size_t) GetLittleEndian(&pPayload[4], 4) : 0;
+		size_t nNumSummaries = (nPayloadBytes >= 12) ? (size_t) GetLittleEndian(&pPayload[8], 4) : 0;
+		bIntact = (nPayloadBytes >= 12) && IsChunkIntact(offset, nPayloadBytes) &&
+			(nPayloadBytes == (12 + 8*nNumMetadata + GSKIP_RECORDING_INDEX_ENTRY_SIZE*nNumEntries + 8*nNumSummaries));
+		if (bIntact)
+		{
+			size_t nPos = 12;
+			size_t i;
+			for (i = 0; i < nNumMetadata; i++, nPos += 8)
+				m_metadataOffsets.push_back(GetLittleEndian(&pPayload[nPos], 8));
+			for (i = 0; i < nNumEntries; i++, nPos += GSKIP_RECORDING_INDEX_ENTRY_SIZE)
+			{
+				GSkipRecordingIndexEntry entry;
+				entry.offset = GetLittleEndian(&pPayload[nPos], 8);
+				entry.firstSampleIndex = GetLittleEndian(&pPayload[nPos + 8], 8);
+				if ((entry.offset < GSKIP_RECORDING_HEADER_SIZE) || (entry.offset >= indexOffset) || 
+					((m_indexEntries.size() > 0) && ((entry.offset <= m_indexEntries.back().offset) || 
+						(entry.firstSampleIndex < m_indexEntries.back().firstSampleIndex))))
+					bIntact = false;
+				m_indexEntries.push_back(entry);
+			}
+			for (i = 0; i < nNumSummaries; i++, nPos += 8)
+				AddSummary(GetLittleEndian(&pPayload[nPos], 8));
+			offset += GSKIP_RECORDING_CHUNK_HEADER_SIZE + nPayloadBytes;
+		}
+	}
+
+	bIntact = bIntact && (offset > indexOffset);
+	if (bIntact)
+	{
+		m_dataEnd = indexOffset;
+		if (GetChunkHeader(offset, &nType, &nFlags, &nPayloadBytes) && (kSkipRecordingChunk_End == nType))
+			ReadEndChunk(offset);
+	}
+	else
+	{
+		m_nNumCorruptChunks++;
+		m_metadataOffsets.clear();
+		m_indexEntries.clear();
+		m_summaries.clear();
+	}
+
+	return bIntact;
+}
+
+void GSkipRecordingMap::ScanChunks(void)
+{
+	unsigned long long offset = GSKIP_RECORDING_HEADER_SIZE;
+	int nType, nFlags;
+	size_t nPayloadBytes;
+	while (GetChunkHeader(offset, &nType, &nFlags, &nPayloadBytes) && 
+		(kSkipRecordingChunk_End != nType) && (kSkipRecordingChunk_Index != nType))
+	{
+		if (kSkipRecordingChunk_Metadata == nType)
+			m_metadataOffsets.push_back(offset);
+		else
+		if (kSkipRecordingChunk_Summary == nType)
+			AddSummary(offset);
+		else
+		if (((kSkipRecordingChunk_Samples == nType) || (kSkipRecordingChunk_PackedSamples == nType)) && (nPayloadBytes >= 8))
+		{
+			//Same rule as GSkipRecorder: the first samples chunk that starts in each block. The crc is checked when
+			//the block is decoded.
+			if ((0 == m_indexEntries.size()) || 
+				((m_indexEntries.back().offset/GSKIP_RECORDING_INDEX_BLOCK_SIZE) != (offset/GSKIP_RECORDING_INDEX_BLOCK_SIZE)))
+			{
+				GSkipRecordingIndexEntry entry;
+				entry.offset = offset;
+				entry.firstSampleIndex = GetLittleEndian(&m_pData[offset + GSKIP_RECORDING_CHUNK_HEADER_SIZE], 8);
+				if ((0 == m_indexEntries.size()) || (entry.firstSampleIndex >= m_indexEntries.back().firstSampleIndex))
+					m_indexEntries.push_back(entry);
+			}
+		}
+		offset += GSKIP_RECORDING_CHUNK_HEADER_SIZE + nPayloadBytes;
+	}
+
+	m_dataEnd = offset;
+	if (GetChunkHeader(offset, &nType, &nFlags, &nPayloadBytes) && (kSkipRecordingChunk_End == nType))
+		ReadEndChunk(offset);
+}
+
+void GSkipRecordingMap::LoadMetadata(void)
+{
+	GSkipRecordingChunk chunk;
+	int nType, nFlags;
+	size_t nPayloadBytes;
+	for (size_t i = 0; i < m_metadataOffsets.size(); i++)
+	{
+		unsigned long long offset = m_metadataOffsets[i];
+		if (GetChunkHeader(offset, &nType, &nFlags, &nPayloadBytes) && (kSkipRecordingChunk_Metadata == nType) &&
+			IsChunkIntact(offset, nPayloadBytes) && 
+			GSkipRecordingReader::DecodePayload(nType, nFlags, &m_pData[offset + GSKIP_RECORDING_CHUNK_HEADER_SIZE], 
+				nPayloadBytes, &chunk) &&
+			((0 == m_metadata.size()) || (chunk.metadata.firstSampleIndex >= m_metadata.back().firstSampleIndex)))
+		{
+			//The same arithmetic as GSkipRecordingReader::GetSampleTime().
+			real fStartTime = (m_metadata.size() > 0) ? GetSampleTime(chunk.metadata.firstSampleIndex) : 0.0;
+			m_metadata.push_back(chunk.metadata);
+			m_segmentStartTimes.push_back(fStartTime);
+		}
+		else
+			m_nNumCorruptChunks++;
+	}
+}
+
+void GSkipRecordingMap::ReadEndChunk(unsigned long long offset)
+{
+	GSkipRecordingChunk chunk;
+	int nType, nFlags;
+	size_t nPayloadBytes;
+	if (GetChunkHeader(offset, &nType, &nFlags, &nPayloadBytes) && IsChunkIntact(offset, nPayloadBytes) &&
+		GSkipRecordingReader::DecodePayload(nType, nFlags, &m_pData[offset + GSKIP_RECORDING_CHUNK_HEADER_SIZE], 
+			nPayloadBytes, &chunk))
+		m_numSlots = chunk.nNumSlots;
+}
+
+void GSkipRecordingMap::AddSummary(
+	unsigned long long offset)	//[in] of a summary chunk, checked when it is first used.
+{
+	int nType, nFlags;
+	size_t nPayloadBytes;
+	if (GetChunkHeader(offset, &nType, &nFlags, &nPayloadBytes) && (kSkipRecordingChunk_Summary == nType) &&
+		(nPayloadBytes >= GSKIP_RECORDING_SUMMARY_FIXED_SIZE))
+	{
+		GSkipRecordingMapSummary summary;
+		summary.offset = offset;
+		summary.firstSampleIndex = GetLittleEndian(&m_pData[offset + GSKIP_RECORDING_CHUNK_HEADER_SIZE], 8);
+		summary.nState = 0;
+		if ((0 == m_summaries.size()) || (summary.firstSampleIndex > m_summaries.back().firstSampleIndex))
+		{
+			m_summaries.push_back(summary);
+			return;
+		}
+	}
+
+	m_nNumCorruptChunks++;
+}
+
+const unsigned char *GSkipRecordingMap::FindSummary(
+	unsigned long long chunkStart)	//[in] multiple of the slots that a summary chunk covers.
+{
+	std::vector<GSkipRecordingMapSummary>::iterator iter = 
+		std::lower_bound(m_summaries.begin(), m_summaries.end(), chunkStart, IsSummaryBefore);
+	if ((iter == m_summaries.end()) || (iter->firstSampleIndex != chunkStart))
+		return NULL;
+
+	const unsigned char *pPayload = &m_pData[iter->offset + GSKIP_RECORDING_CHUNK_HEADER_SIZE];
+	if (0 == iter->nState)
+	{
+		//Only the layout that this version writes is understood.
+		int nType, nFlags;
+		size_t nPayloadBytes;
+		GetChunkHeader(iter->offset, &nType, &nFlags, &nPayloadBytes);
+		iter->nState = ((nPayloadBytes == (GSKIP_RECORDING_SUMMARY_FIXED_SIZE + 
+				GSKIP_RECORDING_SUMMARY_BUCKET_SIZE*((1 << GSKIP_RECORDING_SUMMARY_LEVELS) - 1))) &&
+			(GSKIP_RECORDING_SUMMARY_BASE_LEVEL == GetLittleEndian(&pPayload[8], 4)) &&
+			(GSKIP_RECORDING_SUMMARY_LEVELS == GetLittleEndian(&pPayload[12], 4)) &&
+			IsChunkIntact(iter->offset, nPayloadBytes)) ? 1 : -1;
+		if (iter->nState < 0)
+			m_nNumCorruptChunks++;
+	}
+
+	return (iter->nState > 0) ? &pPayload[GSKIP_RECORDING_SUMMARY_FIXED_SIZE] : NULL;
+}
+
+const GSkipRecordingMetadata *GSkipRecordingMap::GetMetadataForSample(unsigned long long sampleIndex)
+{
+	size_t nSegment = m_metadata.size();
+	while ((nSegment > 1) && (m_metadata[nSegment - 1].firstSampleIndex > sampleIndex))
+		nSegment--;
+	return (nSegment > 0) ? &m_metadata[nSegment - 1] : NULL;
+}
+
+real GSkipRecordingMap::GetSampleTime(unsigned long long sampleIndex)
+{
+	const GSkipRecordingMetadata *pMetadata = GetMetadataForSample(sampleIndex);
+	if (NULL == pMetadata)
+		return 0.0;
+
+	real fStartTime = m_segmentStartTimes[pMetadata - &m_metadata[0]];
+	return fStartTime + ((real) (long long) (sampleIndex - pMetadata->firstSampleIndex))*pMetadata->fMeasurementPeriod;
+}
+
+unsigned long long GSkipRecordingMap::GetSampleIndex(
+	real fTime,		//[in] seconds since sample index 0.
+	bool bRoundUp)	//[in]
+{
+	size_t nSegment = m_metadata.size();
+	while ((nSegment > 1) && (m_segmentStartTimes[nSegment - 1] > fTime))
+		nSegment--;
+	if (0 == nSegment)
+		return 0;
+
+	const GSkipRecordingMetadata &metadata = m_metadata[nSegment - 1];
+	if (metadata.fMeasurementPeriod <= 0.0)
+		return metadata.firstSampleIndex;
+
+	//Allow for rounding error, so that the time of a sample maps back to the same sample.
+	real fNumPeriods = (fTime - m_segmentStartTimes[nSegment - 1])/metadata.fMeasurementPeriod;
+	fNumPeriods = bRoundUp ? ceil(fNumPeriods - 1.0e-6) : floor(fNumPeriods + 1.0e-6);
+	if (fNumPeriods < 0.0)
+		return metadata.firstSampleIndex;//only possible before the first segment.
+
+	return metadata.firstSampleIndex + (long long) fNumPeriods;
+}
+
+void GSkipRecordingMap::DecodeBlock(
+	size_t nBlock,					//[in] index entry.
+	GSkipRecordingMapBlock *pBlock)	//[out]
+{
+	unsigned long long offset = m_indexEntries[nBlock].offset;
+	unsigned long long endOffset = ((nBlock + 1) < m_indexEntries.size()) ? m_indexEntries[nBlock + 1].offset : m_dataEnd;
+	GSkipRecordingChunk chunk;
+	bool bCalibrated = true;
+	int nType, nFlags;
+	size_t nPayloadBytes;
+
+	pBlock->nNumCorruptChunks = 0;
+	while ((offset < endOffset) && GetChunkHeader(offset, &nType, &nFlags, &nPayloadBytes))
+	{
+		if ((kSkipRecordingChunk_Samples == nType) || (kSkipRecordingChunk_PackedSamples == nType))
+		{
+			if (IsChunkIntact(offset, nPayloadBytes) &&
+				GSkipRecordingReader::DecodePayload(nType, nFlags, &m_pData[offset + GSKIP_RECORDING_CHUNK_HEADER_SIZE], 
+					nPayloadBytes, &chunk))
+			{
+				//Split the chunk into runs at its gaps.
+				size_t nBase = pBlock->samples.size();
+				pBlock->samples.insert(pBlock->samples.end(), chunk.samples.begin(), chunk.samples.end());
+				bCalibrated = bCalibrated && (chunk.calibrated.size() == chunk.samples.size());
+				if (bCalibrated)
+					pBlock->calibrated.insert(pBlock->calibrated.end(), chunk.calibrated.begin(), chunk.calibrated.end());
+
+				unsigned long long sampleIndex = chunk.firstSampleIndex;
+				size_t nStart = 0;
+				for (size_t nGap = 0; nGap <= chunk.gaps.size(); nGap++)
+				{
+					size_t nEnd = (nGap < chunk.gaps.size()) ? chunk.gaps[nGap].nSampleOffset : chunk.samples.size();
+					if (nEnd > chunk.samples.size())
+						nEnd = chunk.samples.size();
+					if (nEnd > nStart)
+					{
+						GSkipRecordingMapRun run;
+						run.firstSampleIndex = sampleIndex;
+						run.nOffset = nBase + nStart;
+						run.nNumSamples = nEnd - nStart;
+						GSkipRecordingMapRun *pLast = (pBlock->runs.size() > 0) ? &pBlock->runs.back() : NULL;
+						if (pLast && ((pLast->firstSampleIndex + pLast->nNumSamples) == run.firstSampleIndex) &&
+							((pLast->nOffset + pLast->nNumSamples) == run.nOffset))
+							pLast->nNumSamples += run.nNumSamples;
+						else
+							pBlock->runs.push_back(run);
+						sampleIndex += run.nNumSamples;
+						nStart = nEnd;
+					}
+					if (nGap < chunk.gaps.size())
+						sampleIndex += chunk.gaps[nGap].nNumMissing;
+				}
+			}
+			else
+				pBlock->nNumCorruptChunks++;
+		}
+		offset += GSKIP_RECORDING_CHUNK_HEADER_SIZE + nPayloadBytes;
+	}
+	if (offset < endOffset)
+		pBlock->nNumCorruptChunks++;//a damaged chunk header hides the rest of the block.
+
+	if (!bCalibrated)
+		pBlock->calibrated.clear();
+}
+
+struct GSkipRecordingMapDecodeJob
+{
+	GSkipRecordingMap *	pMap;
+	std::vector<size_t>	blocks;
+	std::vector<GSkipRecordingMapBlock *> decoded;
+};
+
+void GSkipRecordingMap::DecodeBlockItem(void *pContext, int nItem)
+{
+	GSkipRecordingMapDecodeJob *pJob = (GSkipRecordingMapDecodeJob *) pContext;
+	pJob->pMap->DecodeBlock(pJob->blocks[nItem], pJob->decoded[nItem]);
+}
+
+int GSkipRecordingMap::GetSamples(
+	unsigned long long firstSampleIndex,		//[in]
+	unsigned long long lastSampleIndex,			//[in] inclusive.
+	std::vector<GSkipRecordingView> *pViews)	//[out]
+{
+	pViews->clear();
+	if ((0 == m_indexEntries.size()) || (firstSampleIndex > lastSampleIndex))
+		return 0;
+
+	//The last block that starts at or before firstSampleIndex, through the last block that starts at or before
+	//lastSampleIndex.
+	std::vector<GSkipRecordingIndexEntry>::iterator iter = 
+		std::lower_bound(m_indexEntries.begin(), m_indexEntries.end(), firstSampleIndex + 1, IsEntryBefore);
+	size_t nFirstBlock = iter - m_indexEntries.begin();
+	if (nFirstBlock > 0)
+		nFirstBlock--;
+	size_t nEndBlock = nFirstBlock + 1;
+	while ((nEndBlock < m_indexEntries.size()) && (m_indexEntries[nEndBlock].firstSampleIndex <= lastSampleIndex))
+		nEndBlock++;
+
+	m_nNextUse++;
+	GSkipRecordingMapDecodeJob job;
+	job.pMap = this;
+	size_t nBlock;
+	for (nBlock = nFirstBlock; nBlock < nEndBlock; nBlock++)
+	{
+		std::map<size_t, GSkipRecordingMapBlock *>::iterator cacheIter = m_cache.find(nBlock);
+		if (cacheIter != m_cache.end())
+			cacheIter->second->nLastUse = m_nNextUse;
+		else
+		{
+			GSkipRecordingMapBlock *pBlock = new GSkipRecordingMapBlock;
+			pBlock->nLastUse = m_nNextUse;
+			job.blocks.push_back(nBlock);
+			job.decoded.push_back(pBlock);
+		}
+	}
+
+	if (job.blocks.size() > 0)
+	{
+		GThreadPool *pPool = (job.blocks.size() > 1) ? GThreadPool::GetSharedPool() : NULL;
+		if (pPool)
+			pPool->ParallelFor((int) job.blocks.size(), DecodeBlockItem, &job);
+		else
+		{
+			for (size_t i = 0; i < job.blocks.size(); i++)
+				DecodeBlock(job.blocks[i], job.decoded[i]);
+		}
+
+		for (size_t i = 0; i < job.blocks.size(); i++)
+		{
+			m_nNumCorruptChunks += job.decoded[i]->nNumCorruptChunks;
+			m_cache[job.blocks[i]] = job.decoded[i];
+		}
+	}
+
+	//Evict the least recently used blocks, but never the ones that the views below point into.
+	while ((int) m_cache.size() > m_nMaxCachedBlocks)
+	{
+		std::map<size_t, GSkipRecordingMapBlock *>::iterator oldest = m_cache.end();
+		for (std::map<size_t, GSkipRecordingMapBlock *>::iterator cacheIter = m_cache.begin(); cacheIter != m_cache.end(); cacheIter++)
+		{
+			if ((cacheIter->second->nLastUse != m_nNextUse) && 
+				((oldest == m_cache.end()) || (cacheIter->second->nLastUse < oldest->second->nLastUse)))
+				oldest = cacheIter;
+		}
+		if (oldest == m_cache.end())
+			break;
+		delete oldest->second;
+		m_cache.erase(oldest);
+	}
+
+	int nNumSamples = 0;
+	for (nBlock = nFirstBlock; nBlock < nEndBlock; nBlock++)
+	{
+		const GSkipRecordingMapBlock *pBlock = m_cache[nBlock];
+		for (size_t i = 0; i < pBlock->runs.size(); i++)
+		{
+			const GSkipRecordingMapRun &run = pBlock->runs[i];
+			unsigned long long runLastIndex = run.firstSampleIndex + run.nNumSamples - 1;
+			if ((runLastIndex < firstSampleIndex) || (run.firstSampleIndex > lastSampleIndex))
+				continue;
+
+			unsigned long long viewFirstIndex = (run.firstSampleIndex > firstSampleIndex) ? run.firstSampleIndex : firstSampleIndex;
+			unsigned long long viewLastIndex = (runLastIndex < lastSampleIndex) ? runLastIndex : lastSampleIndex;
+			size_t nOffset = run.nOffset + (size_t) (viewFirstIndex - run.firstSampleIndex);
+			GSkipRecordingView view;
+			view.firstSampleIndex = viewFirstIndex;
+			view.pSamples = &pBlock->samples[nOffset];
+			view.pCalibrated = (pBlock->calibrated.size() > 0) ? &pBlock->calibrated[nOffset] : NULL;
+			view.nNumSamples = (int) (viewLastIndex - viewFirstIndex + 1);
+			pViews->push_back(view);
+			nNumSamples += view.nNumSamples;
+		}
+	}
+
+	return nNumSamples;
+}
+
+int GSkipRecordingMap::GetSamplesInTimeRange(
+	real fStartTime,							//[in] seconds since sample index 0.
+	real fEndTime,								//[in] inclusive.
+	std::vector<GSkipRecordingView> *pViews)	//[out]
+{
+	if ((fEndTime < fStartTime) || (fEndTime < 0.0))
+	{
+		pViews->clear();
+		return 0;
+	}
+
+	return GetSamples(GetSampleIndex(fStartTime, true), GetSampleIndex(fEndTime, false), pViews);
+}
+
+void GSkipRecordingMap::SummarizeSamples(
+	int nLevel,									//[in]
+	unsigned long long firstSampleIndex,		//[in]
+	unsigned long long lastSampleIndex,			//[in] inclusive.
+	std::vector<GSamplePyramidBucket> *pBuckets)//[out]
+{
+	unsigned long long bucketsFirst = (firstSampleIndex >> nLevel) << nLevel;
+	unsigned long long bucketsLast = (((lastSampleIndex >> nLevel) + 1) << nLevel) - 1;
+	GSamplePyramid pyramid(nLevel);
+	pyramid.Clear(bucketsFirst);
+
+	std::vector<GSkipRecordingView> views;
+	GetSamples(bucketsFirst, bucketsLast, &views);
+	real values[256];
+	for (size_t i = 0; i < views.size(); i++)
+	{
+		pyramid.SkipSamples(views[i].firstSampleIndex - pyramid.GetNextSampleIndex());
+		for (int nStart = 0; nStart < views[i].nNumSamples; nStart += 256)
+		{
+			int nNumValues = views[i].nNumSamples - nStart;
+			if (nNumValues > 256)
+				nNumValues = 256;
+			for (int j = 0; j < nNumValues; j++)
+				values[j] = views[i].pSamples[nStart + j];
+			pyramid.AddSamples(values, nNumValues);
+		}
+	}
+	pyramid.SkipSamples(bucketsLast + 1 - pyramid.GetNextSampleIndex());
+
+	pyramid.GetBuckets(nLevel, bucketsFirst, bucketsLast, pBuckets);
+}
+
+void GSkipRecordingMap::BuildCoarseSummary(void)
+{
+	if (m_bHasCoarseSummary)
+		return;
+	m_bHasCoarseSummary = true;
+
+	const int nChunkLevel = GSKIP_RECORDING_SUMMARY_BASE_LEVEL + GSKIP_RECORDING_SUMMARY_LEVELS - 1;
+	m_coarseSummary = GSamplePyramid(nChunkLevel);
+	std::vector<GSamplePyramidBucket> buckets;
+	GSamplePyramidBucket bucket;
+	for (unsigned long long chunkStart = 0; chunkStart < m_numSlots; chunkStart += (1ULL << nChunkLevel))
+	{
+		const unsigned char *pSummary = FindSummary(chunkStart);
+		if (pSummary)
+			ReadSummaryBucket(pSummary, nChunkLevel, chunkStart, chunkStart, &bucket);
+		else
+		{
+			SummarizeSamples(nChunkLevel, chunkStart, chunkStart, &buckets);
+			bucket = buckets[0];
+		}
+		m_coarseSummary.AddBaseBucket(bucket);
+	}
+}
+
+int GSkipRecordingMap::GetEnvelope(
+	unsigned long long firstSampleIndex,		//[in]
+	unsigned long long lastSampleIndex,			//[in] inclusive.
+	int nMaxBuckets,							//[in] e.g. the width of the plot in pixels.
+	std::vector<GSamplePyramidBucket> *pBuckets)//[out]
+{
+	pBuckets->clear();
+	if ((m_numSlots > 0) && (lastSampleIndex >= m_numSlots))
+		lastSampleIndex = m_numSlots - 1;
+	if ((0 == m_numSlots) || (firstSampleIndex > lastSampleIndex))
+		return -1;
+
+	const int nChunkLevel = GSKIP_RECORDING_SUMMARY_BASE_LEVEL + GSKIP_RECORDING_SUMMARY_LEVELS - 1;
+	int nLevel = GSamplePyramid::ChooseLevel(lastSampleIndex - firstSampleIndex + 1, nMaxBuckets);
+	if (nLevel > nChunkLevel)
+	{
+		BuildCoarseSummary();
+		if (nLevel > m_coarseSummary.GetTopLevel())
+			nLevel = m_coarseSummary.GetTopLevel();
+		m_coarseSummary.GetBuckets(nLevel, firstSampleIndex, lastSampleIndex, pBuckets);
+		return nLevel;
+	}
+
+	//Otherwise every bucket lies within one summary chunk's span.
+	std::vector<GSamplePyramidBucket> buckets;
+	GSamplePyramidBucket bucket;
+	unsigned long long chunkStart = (firstSampleIndex >> nChunkLevel) << nChunkLevel;
+	for (; chunkStart <= lastSampleIndex; chunkStart += (1ULL << nChunkLevel))
+	{
+		unsigned long long rangeFirst = (chunkStart > firstSampleIndex) ? chunkStart : firstSampleIndex;
+		unsigned long long rangeLast = chunkStart + (1ULL << nChunkLevel) - 1;
+		if (rangeLast > lastSampleIndex)
+			rangeLast = lastSampleIndex;
+
+		const unsigned char *pSummary = (nLevel >= GSKIP_RECORDING_SUMMARY_BASE_LEVEL) ? FindSummary(chunkStart) : NULL;
+		if (pSummary)
+		{
+			for (unsigned long long nBucket = rangeFirst >> nLevel; nBucket <= (rangeLast >> nLevel); nBucket++)
+			{
+				ReadSummaryBucket(pSummary, nLevel, chunkStart, nBucket << nLevel, &bucket);
+				pBuckets->push_back(bucket);
+			}
+		}
+		else
+		{
+			SummarizeSamples(nLevel, rangeFirst, rangeLast, &buckets);
+			pBuckets->insert(pBuckets->end(), buckets.begin(), buckets.end());
+		}
+	}
+
+	return nLevel;
+}
+
+int GSkipRecordingMap::GetEnvelopeInTimeRange(
+	real fStartTime,							//[in] seconds since sample index 0.
+	real fEndTime,								//[in] inclusive.
+	int nMaxBuckets,							//[in]
+	std::vector<GSamplePyramidBucket> *pBuckets)//[out]
+{
+	if ((fEndTime < fStartTime) || (fEndTime < 0.0))
+	{
+		pBuckets->clear();
+		return -1;
+	}
+
+	return GetEnvelope(GetSampleIndex(fStartTime, true), GetSampleIndex(fEndTime, false), nMaxBuckets, pBuckets);
+}
+
+#ifdef LIB_NAMESPACE
+}
+#endif
@@ -0,0 +1,168 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipRecordingMap.h
+//
+// Random access to a recording made by GSkipRecorder, by sample index or by time, for analysis tools that only 
+// need a window of a long capture. The file is memory mapped, the index at the end of the recording(see 
+// GSkipRecorder.h) is binary searched for the index blocks that hold the window, and only those blocks are read.
+// Each block is decompressed whole into a cache of blocks, in parallel on the shared GThreadPool when a window 
+// needs several, and results are views into the cache, so samples are never copied out.
+//
+// GetEnvelope() serves plots: it returns about one min/max/mean bucket per pixel for any range, read straight from 
+// the summary chunks when the buckets are at least 2^GSKIP_RECORDING_SUMMARY_BASE_LEVEL slots wide, so drawing a
+// whole recording costs about as much as drawing a minute of it.
+
+#ifndef _GSKIPRECORDINGMAP_H_
+#define _GSKIPRECORDINGMAP_H_
+
+#include <map>
+#include "GTypes.h"
+#include "GSkipRecorder.h"
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+#define GSKIP_RECORDING_MAP_DEFAULT_CACHE_BLOCKS 16
+
+// Samples with consecutive sample indices, starting at firstSampleIndex. The samples belong to the map's cache,
+// and stay valid until the next GetSamples() call on the same map, or until the map is closed.
+struct GSkipRecordingView
+{
+	unsigned long long	firstSampleIndex;
+	const short *		pSamples;
+	const real *		pCalibrated;//NULL unless the recording has calibrated values.
+	int					nNumSamples;
+};
+
+struct GSkipRecordingMapRun
+{
+	unsigned long long	firstSampleIndex;
+	size_t				nOffset;//into the block's samples.
+	size_t				nNumSamples;
+};
+
+struct GSkipRecordingMapSummary
+{
+	unsigned long long	offset;//of the summary chunk.
+	unsigned long long	firstSampleIndex;
+	int					nState;//0 until checked, then 1 if intact, -1 if corrupt.
+};
+
+// The decompressed samples of the chunks that start in one index block of the file.
+struct GSkipRecordingMapBlock
+{
+	std::vector<short>	samples;
+	std::vector<real>	calibrated;//empty unless every chunk in the block has calibrated values.
+	std::vector<GSkipRecordingMapRun> runs;
+	int					nNumCorruptChunks;
+	unsigned int		nLastUse;
+};
+
+class GSkipRecordingMap
+{
+public:
+	// nMaxCachedBlocks is a soft limit: blocks that the current GetSamples() call returns views into stay cached.
+						GSkipRecordingMap(int nMaxCachedBlocks = GSKIP_RECORDING_MAP_DEFAULT_CACHE_BLOCKS);
+						~GSkipRecordingMap();
+
+	// Map sFileName and load its metadata and index. Recordings without an intact index(e.g. because they are 
+	// still being recorded) are indexed by walking their chunk headers instead.
+	bool				Open(const cppstring &sFileName);
+	void				Close(void);
+
+	bool				HasIndex(void) { return m_bHasIndex; }//false if the index was rebuilt by Open().
+	unsigned long long	GetStartTime(void) { return m_startTime; }
+	const std::vector<GSkipRecordingMetadata> & GetMetadata(void) { return m_metadata; }
+	const GSkipRecordingMetadata *GetMetadataForSample(unsigned long long sampleIndex);//NULL if there is no metadata.
+	unsigned long long	GetNumSlots(void) { return m_numSlots; }//sample index after the last recorded sample.
+
+	real				GetSampleTime(unsigned long long sampleIndex);//seconds since sample index 0.
+	// Sample index of the first sample at or after fTime(bRoundUp) or of the last sample at or before fTime.
+	unsigned long long	GetSampleIndex(real fTime, bool bRoundUp);
+
+	// Find the recorded samples with indices from firstSampleIndex to lastSampleIndex inclusive, as views in index
+	// order. Views end where samples were lost, and at block boundaries. Returns the number of samples found.
+	int					GetSamples(unsigned long long firstSampleIndex, unsigned long long lastSampleIndex, 
+							std::vector<GSkipRecordingView> *pViews);
+	int					GetSamplesInTimeRange(real fStartTime, real fEndTime, std::vector<GSkipRecordingView> *pViews);
+
+	// Get min/max/mean buckets(in raw measurement units) that cover firstSampleIndex to lastSampleIndex, at the 
+	// finest power of two level that needs no more than nMaxBuckets of them, as GSamplePyramid::GetEnvelope() does.
+	// Levels below the summaries, and spans without an intact summary chunk(e.g. the end of a recording that is
+	// still being made) are summarized from the samples, which invalidates views from GetSamples(). Summary chunks
+	// describe the samples as they were recorded, including any in samples chunks that were damaged later. Returns 
+	// the level, or -1 if the range holds no slots.
+	int					GetEnvelope(unsigned long long firstSampleIndex, unsigned long long lastSampleIndex, 
+							int nMaxBuckets, std::vector<GSamplePyramidBucket> *pBuckets);
+	int					GetEnvelopeInTimeRange(real fStartTime, real fEndTime, int nMaxBuckets, 
+							std::vector<GSamplePyramidBucket> *pBuckets);
+
+	int					GetNumCorruptChunks(void) { return m_nNumCorruptChunks; }
+
+private:
+	bool				GetChunkHeader(unsigned long long offset, int *pnType, int *pnFlags, size_t *pnPayloadBytes);
+	bool				IsChunkIntact(unsigned long long offset, size_t nPayloadBytes);
+	bool				LoadIndex(void);
+	void				ScanChunks(void);
+	void				LoadMetadata(void);
+	void				ReadEndChunk(unsigned long long offset);
+	void				AddSummary(unsigned long long offset);
+	const unsigned char *FindSummary(unsigned long long chunkStart);//buckets of an intact summary chunk, or NULL.
+	void				SummarizeSamples(int nLevel, unsigned long long firstSampleIndex, unsigned long long lastSampleIndex,
+							std::vector<GSamplePyramidBucket> *pBuckets);
+	void				BuildCoarseSummary(void);
+	void				DecodeBlock(size_t nBlock, GSkipRecordingMapBlock *pBlock);
+	static void			DecodeBlockItem(void *pContext, int nItem);
+
+	int					m_nMaxCachedBlocks;
+	const unsigned char *m_pData;
+	unsigned long long	m_nFileSize;
+	void *				m_pMapping;
+	unsigned long long	m_startTime;
+	unsigned long long	m_dataEnd;//offset after the last chunk that may hold samples.
+	unsigned long long	m_numSlots;
+	bool				m_bHasIndex;
+	int					m_nNumCorruptChunks;
+	std::vector<unsigned long long> m_metadataOffsets;
+	std::vector<GSkipRecordingIndexEntry> m_indexEntries;
+	std::vector<GSkipRecordingMapSummary> m_summaries;
+	GSamplePyramid		m_coarseSummary;//the top level bucket of every summary chunk, and the levels above.
+	bool				m_bHasCoarseSummary;//m_coarseSummary has been built, on the first request that needs it.
+	std::vector<GSkipRecordingMetadata> m_metadata;
+	std::vector<real>	m_segmentStartTimes;//one per m_metadata.
+	std::map<size_t, GSkipRecordingMapBlock *> m_cache;//by index entry.
+	unsigned int		m_nNextUse;
+};
+
+#ifdef LIB_NAMESPACE
+}
+#endif
+
+#endif // _GSKIPRECORDINGMAP_H_
@@ -0,0 +1,324 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipSampleCodec.cpp
+
+#include "stdafx.h"
+#include "GSkipSampleCodec.h"
+
+#ifdef _DEBUG
+#include "GPlatformDebug.h" // for DEBUG_NEW definition
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+#define GSKIP_CODEC_MAX_SAMPLE_BITS 17 //zigzag encoded difference between two 16 bit values.
+
+//Packs bits least significant bit first.
+class GBitWriter
+{
+public:
+	GBitWriter(std::vector<unsigned char> *pDest) { m_pDest = pDest; m_bits = 0; m_nNumBits = 0; }
+
+	void				Write(unsigned long long value, int nNumBits)//nNumBits <= 64
+	{
+		if (nNumBits > 32)
+		{
+			Write(value, 32);
+			value = value >> 32;
+			nNumBits -= 32;
+		}
+		m_bits |= (value & ((1ULL << nNumBits) - 1)) << m_nNumBits;
+		m_nNumBits += nNumBits;
+		while (m_nNumBits >= 8)
+		{
+			m_pDest->push_back((unsigned char) (m_bits & 0xFF));
+			m_bits = m_bits >> 8;
+			m_nNumBits -= 8;
+		}
+	}
+
+	void				Flush(void)//pad to a whole byte.
+	{
+		if (m_nNumBits > 0)
+			m_pDest->push_back((unsigned char) (m_bits & 0xFF));
+		m_bits = 0;
+		m_nNumBits = 0;
+	}
+
+private:
+	std::vector<unsigned char> *m_pDest;
+	unsigned long long	m_bits;
+	int					m_nNumBits;
+};
+
+class GBitReader
+{
+public:
+	GBitReader(const unsigned char *pSrc, size_t nNumBytes) { m_pSrc = pSrc; m_nNumBytes = nNumBytes; m_nPos = 0; m_bits = 0; m_nNumBits = 0; m_bOverrun = false; }
+
+	unsigned long long	Read(int nNumBits)//nNumBits <= 64
+	{
+		if (nNumBits > 32)
+		{
+			unsigned long long low = Read(32);
+			return low | (Read(nNumBits - 32) << 32);
+		}
+		while (m_nNumBits < nNumBits)
+		{
+			if (m_nPos >= m_nNumBytes)
+			{
+				m_bOverrun = true;
+				return 0;
+			}
+			m_bits |= ((unsigned long long) m_pSrc[m_nPos++]) << m_nNumBits;
+			m_nNumBits += 8;
+		}
+		unsigned long long value = m_bits & ((1ULL << nNumBits) - 1);
+		m_bits = m_bits >> nNumBits;
+		m_nNumBits -= nNumBits;
+		return value;
+	}
+
+	void				SkipToByte(void) { m_bits = 0; m_nNumBits = 0; }
+	size_t				GetNumBytesUsed(void) { return m_nPos; }
+	bool				IsOverrun(void) { return m_bOverrun; }
+
+private:
+	const unsigned char *m_pSrc;
+	size_t				m_nNumBytes;
+	size_t				m_nPos;
+	unsigned long long	m_bits;
+	int					m_nNumBits;
+	bool				m_bOverrun;
+};
+
+static int CountLeadingZeros(unsigned long long value)
+{
+	int nCount = 0;
+	for (unsigned long long mask = 1ULL << 63; mask && !(value & mask); mask = mask >> 1)
+		nCount++;
+	return nCount;
+}
+
+static int CountTrailingZeros(unsigned long long value)
+{
+	int nCount = 0;
+	for (unsigned long long mask = 1; mask && !(value & mask); mask = mask << 1)
+		nCount++;
+	return nCount;
+}
+
+static unsigned long long GetBits(real value)
+{
+	unsigned long long bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+void GSkipSampleCodec::PackSamples(
+	const short *pSamples,				//[in]
+	int nNumSamples,					//[in]
+	std::vector<unsigned char> *pDest)	//[in,out]
+{
+	if (nNumSamples <= 0)
+		return;
+
+	pDest->push_back((unsigned char) (pSamples[0] & 0xFF));
+	pDest->push_back((unsigned char) ((pSamples[0] >> 8) & 0xFF));
+
+	GBitWriter writer(pDest);
+	unsigned int differences[GSKIP_CODEC_FRAME_SAMPLES];
+	for (int nFrameStart = 1; nFrameStart < nNumSamples; nFrameStart += GSKIP_CODEC_FRAME_SAMPLES)
+	{
+		int nFrameSamples = nNumSamples - nFrameStart;
+		if (nFrameSamples > GSKIP_CODEC_FRAME_SAMPLES)
+			nFrameSamples = GSKIP_CODEC_FRAME_SAMPLES;
+
+		unsigned int allBits = 0;
+		int i;
+		for (i = 0; i < nFrameSamples; i++)
+		{
+			int nDifference = pSamples[nFrameStart + i] - pSamples[nFrameStart + i - 1];
+			differences[i] = (unsigned int) ((nDifference << 1) ^ (nDifference >> 31));
+			allBits |= differences[i];
+		}
+
+		int nWidth = 0;
+		while (allBits >> nWidth)
+			nWidth++;
+
+		pDest->push_back((unsigned char) nWidth);
+		if (nWidth > 0)
+		{
+			for (i = 0; i < nFrameSamples; i++)
+				writer.Write(differences[i], nWidth);
+			writer.Flush();
+		}
+	}
+}
+
+size_t GSkipSampleCodec::UnpackSamples(
+	const unsigned char *pSrc,	//[in]
+	size_t nNumBytes,			//[in]
+	int nNumSamples,			//[in]
+	short *pSamples)			//[out]
+{
+	if (nNumSamples <= 0)
+		return 0;
+	if (nNumBytes < 2)
+		return 0;
+
+	int nPrevious = (short) (pSrc[0] | (pSrc[1] << 8));
+	pSamples[0] = (short) nPrevious;
+	size_t nPos = 2;
+
+	for (int nFrameStart = 1; nFrameStart < nNumSamples; nFrameStart += GSKIP_CODEC_FRAME_SAMPLES)
+	{
+		int nFrameSamples = nNumSamples - nFrameStart;
+		if (nFrameSamples > GSKIP_CODEC_FRAME_SAMPLES)
+			nFrameSamples = GSKIP_CODEC_FRAME_SAMPLES;
+
+		if (nPos >= nNumBytes)
+			return 0;
+		int nWidth = pSrc[nPos++];
+		if (nWidth > GSKIP_CODEC_MAX_SAMPLE_BITS)
+			return 0;
+
+		GBitReader reader(&pSrc[nPos], nNumBytes - nPos);
+		for (int i = 0; i < nFrameSamples; i++)
+		{
+			unsigned int difference = (nWidth > 0) ? (unsigned int) reader.Read(nWidth) : 0;
+			int nDifference = (int) (difference >> 1) ^ -((int) (difference & 1));
+			nPrevious = (short) (nPrevious + nDifference);
+			pSamples[nFrameStart + i] = (short) nPrevious;
+		}
+		if (reader.IsOverrun())
+			return 0;
+		nPos += reader.GetNumBytesUsed();
+	}
+
+	return nPos;
+}
+
+void GSkipSampleCodec::PackReals(
+	const real *pValues,				//[in]
+	int nNumValues,						//[in]
+	std::vector<unsigned char> *pDest)	//[in,out]
+{
+	if (nNumValues <= 0)
+		return;
+
+	GBitWriter writer(pDest);
+	unsigned long long previous = GetBits(pValues[0]);
+	writer.Write(previous, 64);
+
+	int nLeadingZeros = -1;//no window yet.
+	int nTrailingZeros = 0;
+	for (int i = 1; i < nNumValues; i++)
+	{
+		unsigned long long bits = GetBits(pValues[i]);
+		unsigned long long xorBits = bits ^ previous;
+		previous = bits;
+
+		if (0 == xorBits)
+		{
+			writer.Write(0, 1);
+			continue;
+		}
+		writer.Write(1, 1);
+
+		int nLeading = CountLeadingZeros(xorBits);
+		if (nLeading > 31)
+			nLeading = 31;
+		int nTrailing = CountTrailingZeros(xorBits);
+		if ((nLeadingZeros >= 0) && (nLeading >= nLeadingZeros) && (nTrailing >= nTrailingZeros))
+		{
+			writer.Write(0, 1);
+			writer.Write(xorBits >> nTrailingZeros, 64 - nLeadingZeros - nTrailingZeros);
+		}
+		else
+		{
+			int nMeaningful = 64 - nLeading - nTrailing;
+			writer.Write(1, 1);
+			writer.Write(nLeading, 5);
+			writer.Write(nMeaningful - 1, 6);
+			writer.Write(xorBits >> nTrailing, nMeaningful);
+			nLeadingZeros = nLeading;
+			nTrailingZeros = nTrailing;
+		}
+	}
+	writer.Flush();
+}
+
+size_t GSkipSampleCodec::UnpackReals(
+	const unsigned char *pSrc,	//[in]
+	size_t nNumBytes,			//[in]
+	int nNumValues,				//[in]
+	real *pValues)				//[out]
+{
+	if (nNumValues <= 0)
+		return 0;
+
+	GBitReader reader(pSrc, nNumBytes);
+	unsigned long long previous = reader.Read(64);
+	memcpy(&pValues[0], &previous, sizeof(previous));
+
+	int nLeadingZeros = -1;
+	int nTrailingZeros = 0;
+	for (int i = 1; (i < nNumValues) && !reader.IsOverrun(); i++)
+	{
+		if (reader.Read(1))
+		{
+			if (reader.Read(1))
+			{
+				nLeadingZeros = (int) reader.Read(5);
+				int nMeaningful = (int) reader.Read(6) + 1;
+				nTrailingZeros = 64 - nLeadingZeros - nMeaningful;
+				if (nTrailingZeros < 0)
+					return 0;
+			}
+			else
+			if (nLeadingZeros < 0)
+				return 0;
+
+			previous ^= reader.Read(64 - nLeadingZeros - nTrailingZeros) << nTrailingZeros;
+		}
+		memcpy(&pValues[i], &previous, sizeof(previous));
+	}
+
+	return reader.IsOverrun() ? 0 : reader.GetNumBytesUsed();
+}
+
+#ifdef LIB_NAMESPACE
+}
+#endif
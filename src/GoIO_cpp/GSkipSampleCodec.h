@@ -0,0 +1,79 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipSampleCodec.h
+//
+// Compact encodings for blocks of measurements, used by the recording file format(see GSkipRecorder.h). Each
+// encoded block stands alone, so blocks can be encoded and decoded on different threads.
+//
+// Raw measurements are 16 bit values that usually change slowly, so PackSamples() stores the first one as is,
+// and the rest as the difference from the previous measurement. The differences are zigzag encoded(0, -1, 1, -2,
+// 2 ... become 0, 1, 2, 3, 4 ...) and bit packed in frames of GSKIP_CODEC_FRAME_SAMPLES, each frame using just
+// enough bits for its largest difference:
+//		first sample	2 bytes, little endian
+//		frames			1 byte bit width(0 - 17), then the frame's differences packed least significant bit first,
+//						padded to a whole byte.
+// A steady signal with a few bits of noise costs 2 - 4 bits per measurement instead of 16.
+//
+// PackReals() encodes calibrated values by XORing each value's IEEE 754 bit pattern with the previous one, which
+// leaves mostly zero bits when successive values are close:
+//		first value		64 bits
+//		each next value	'0' if it equals the previous value, otherwise '1' followed by either
+//						'0' and the XOR bits inside the previous value's window of meaningful bits, or
+//						'1', 5 bits of leading zero count, 6 bits of meaningful bit count - 1, and the meaningful bits.
+// Bits are packed least significant bit first, and the stream is padded to a whole byte.
+
+#ifndef _GSKIPSAMPLECODEC_H_
+#define _GSKIPSAMPLECODEC_H_
+
+#include "GTypes.h"
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+#define GSKIP_CODEC_FRAME_SAMPLES 64
+
+class GSkipSampleCodec
+{
+public:
+	// Append the encoded samples to (*pDest).
+	static void			PackSamples(const short *pSamples, int nNumSamples, std::vector<unsigned char> *pDest);
+	static void			PackReals(const real *pValues, int nNumValues, std::vector<unsigned char> *pDest);
+
+	// Decode exactly nNumSamples(nNumValues) from pSrc. Returns the # of bytes used, or 0 if pSrc is too short or
+	// invalid.
+	static size_t		UnpackSamples(const unsigned char *pSrc, size_t nNumBytes, int nNumSamples, short *pSamples);
+	static size_t		UnpackReals(const unsigned char *pSrc, size_t nNumBytes, int nNumValues, real *pValues);
+};
+
+#ifdef LIB_NAMESPACE
+}
+#endif
+
+#endif // _GSKIPSAMPLECODEC_H_
@@ -0,0 +1,728 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipSimulator.cpp
+
+#include "stdafx.h"
+#include "GSkipSimulator.h"
+#include "GSkipCommExt.h"
+#include "GCyclopsCommExt.h"
+#include "GSensorDDSMem.h"
+#include "GVernierUSB.h"
+#include "GMBLSensor.h"
+#include "GUtils.h"
+
+#ifdef _DEBUG
+#include "GPlatformDebug.h" // for DEBUG_NEW definition
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+#define SIM_MAX_PACKETS_PER_PUMP 64
+
+static const GSkipSimulatorConfig kDefaultSimulatorConfig = { 0, 0, 0, 0, 0, 0, 0, 1, kSensorIdNumber_FirstSmartSensor };
+
+GSkipSimulatorConfig GSkipSimulator::m_config = kDefaultSimulatorConfig;
+
+GSkipSimulator::GSkipSimulator(
+	int nProductID,		//[in] USB product id of the device to simulate.
+	int nDeviceIndex,	//[in] distinguishes simulated devices of the same type, used for the serial number.
+	GSkipVirtualDevicePacketSinkPtr pCmdRespSink,		//[in] receives command response packets.
+	GSkipVirtualDevicePacketSinkPtr pMeasurementSink,	//[in] receives measurement packets.
+	void *pSinkContext)	//[in] passed back to the sinks.
+{
+	m_nProductID = nProductID;
+	m_nDeviceIndex = nDeviceIndex;
+	m_pCmdRespSink = pCmdRespSink;
+	m_pMeasurementSink = pMeasurementSink;
+	m_pSinkContext = pSinkContext;
+	m_pStateMutex = GThread::OSCreateMutex(GSTD_S(""));
+
+	if (USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID == m_nProductID)
+		m_fTickInSeconds = 0.000128;
+	else
+		m_fTickInSeconds = 0.001;
+
+	m_nSensorId = 0;
+	if ((SKIP_DEFAULT_PRODUCT_ID == m_nProductID) || (MINI_GC_DEFAULT_PRODUCT_ID == m_nProductID))
+		m_nSensorId = m_config.nSensorId;
+
+	m_nPeriodTicks = (int) floor(0.1/m_fTickInSeconds + 0.5);
+	m_analogInputChannel = SKIP_ANALOG_INPUT_CHANNEL_VIN_LOW;
+	m_vinOffsetDac = 0;
+	memset(m_temperature, 0, sizeof(m_temperature));
+	m_rollingCounter = 0;
+	m_nMeasurementSequence = 0;
+	m_nPacketsGenerated = 0;
+	m_nPendingResponses = 0;
+
+	BuildNVMemImages();
+	ResetToInitState();
+}
+
+GSkipSimulator::~GSkipSimulator()
+{
+	if (m_pStateMutex)
+		GThread::OSDestroyMutex(m_pStateMutex);
+	m_pStateMutex = NULL;
+}
+
+GSkipSimulator *GSkipSimulator::CreateSimulator(
+	const cppstring &sDeviceName,
+	GSkipVirtualDevicePacketSinkPtr pCmdRespSink,
+	GSkipVirtualDevicePacketSinkPtr pMeasurementSink,
+	void *pSinkContext)
+{
+	GSkipSimulator *pSimulator = NULL;
+	if (IsSimulatedDeviceName(sDeviceName))
+	{
+		//Name is "sim:<product id>:<index>".
+		int nProductID = 0;
+		int nDeviceIndex = 0;
+		size_t i = 4;
+		while ((i < sDeviceName.size()) && (sDeviceName[i] >= '0') && (sDeviceName[i] <= '9'))
+			nProductID = nProductID*10 + (sDeviceName[i++] - '0');
+		if ((i < sDeviceName.size()) && (':' == sDeviceName[i]))
+			i++;
+		while ((i < sDeviceName.size()) && (sDeviceName[i] >= '0') && (sDeviceName[i] <= '9'))
+			nDeviceIndex = nDeviceIndex*10 + (sDeviceName[i++] - '0');
+
+		if ((SKIP_DEFAULT_PRODUCT_ID == nProductID) || (USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID == nProductID) ||
+			(CYCLOPS_DEFAULT_PRODUCT_ID == nProductID) || (MINI_GC_DEFAULT_PRODUCT_ID == nProductID))
+			pSimulator = new GSkipSimulator(nProductID, nDeviceIndex, pCmdRespSink, pMeasurementSink, pSinkContext);
+	}
+
+	return pSimulator;
+}
+
+bool GSkipSimulator::IsSimulatedDeviceName(const cppstring &sDeviceName)
+{
+	return (0 == sDeviceName.compare(0, 4, GSTD_S("sim:")));
+}
+
+StringVector GSkipSimulator::GetAvailableDevices(int nVendorID, int nProductID)
+{
+	StringVector vPortNames;
+	int nNumDevices = 0;
+	if (VERNIER_DEFAULT_VENDOR_ID == nVendorID)
+	{
+		if (SKIP_DEFAULT_PRODUCT_ID == nProductID)
+			nNumDevices = m_config.nNumGoLinks;
+		else
+		if (USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID == nProductID)
+			nNumDevices = m_config.nNumGoTemps;
+		else
+		if (CYCLOPS_DEFAULT_PRODUCT_ID == nProductID)
+			nNumDevices = m_config.nNumGoMotions;
+		else
+		if (MINI_GC_DEFAULT_PRODUCT_ID == nProductID)
+			nNumDevices = m_config.nNumMiniGCs;
+	}
+
+	for (int i = 0; i < nNumDevices; i++)
+	{
+		cppsstream ss;
+		ss << GSTD_S("sim:") << nProductID << GSTD_S(":") << i;
+		vPortNames.push_back(ss.str());
+	}
+
+	return vPortNames;
+}
+
+bool GSkipSimulator::SetConfig(const cppstring &sConfig)
+{
+	bool bResult = true;
+	GSkipSimulatorConfig config = kDefaultSimulatorConfig;
+	size_t i = 0;
+
+	while (bResult && (i < sConfig.size()))
+	{
+		//Parse "key=value", skipping white space and separators.
+		cppstring sKey;
+		int nValue = 0;
+		bool bValueFound = false;
+		while ((i < sConfig.size()) && ((',' == sConfig[i]) || (';' == sConfig[i]) || (' ' == sConfig[i])))
+			i++;
+		while ((i < sConfig.size()) && ('=' != sConfig[i]) && (',' != sConfig[i]) && (';' != sConfig[i]))
+			sKey += sConfig[i++];
+		if ((i < sConfig.size()) && ('=' == sConfig[i]))
+		{
+			i++;
+			while ((i < sConfig.size()) && (sConfig[i] >= '0') && (sConfig[i] <= '9'))
+			{
+				nValue = nValue*10 + (sConfig[i++] - '0');
+				bValueFound = true;
+			}
+		}
+
+		if (0 == sKey.size())
+			continue;
+		if (!bValueFound)
+			bResult = false;
+		else
+		if (GSTD_S("golink") == sKey)
+			config.nNumGoLinks = nValue;
+		else
+		if (GSTD_S("gotemp") == sKey)
+			config.nNumGoTemps = nValue;
+		else
+		if (GSTD_S("gomotion") == sKey)
+			config.nNumGoMotions = nValue;
+		else
+		if (GSTD_S("minigc") == sKey)
+			config.nNumMiniGCs = nValue;
+		else
+		if (GSTD_S("period_us") == sKey)
+			config.nPeriodOverrideUs = nValue;
+		else
+		if (GSTD_S("fill") == sKey)
+			config.nMeasurementsPerPacket = nValue;
+		else
+		if (GSTD_S("loss") == sKey)
+			config.nLossInterval = nValue;
+		else
+		if (GSTD_S("burst") == sKey)
+			config.nLossBurst = nValue;
+		else
+		if (GSTD_S("sensor_id") == sKey)
+			config.nSensorId = nValue;
+		else
+			bResult = false;
+	}
+
+	if (config.nMeasurementsPerPacket > 3)
+		bResult = false;
+	if (config.nSensorId > 255)
+		bResult = false;
+
+	if (bResult)
+		m_config = config;
+	else
+	{
+		cppsstream ss;
+		ss << GSTD_S("GSkipSimulator::SetConfig() rejected '") << sConfig << GSTD_S("'.");
+		GSTD_TRACE(ss.str());
+	}
+
+	return bResult;
+}
+
+void GSkipSimulator::BuildNVMemImages(void)
+{
+	memset(m_localNVMem, 0, sizeof(m_localNVMem));
+	memset(m_remoteNVMem, 0, sizeof(m_remoteNVMem));
+
+	GSensorDDSRec rec;
+	memset(&rec, 0, sizeof(GSensorDDSRec));
+	rec.SensorSerialNumber[0] = (unsigned char) m_nDeviceIndex;
+	rec.SensorSerialNumber[1] = (unsigned char) (m_nDeviceIndex >> 8);
+	rec.MinSamplePeriod = (float) 0.001;
+	rec.TypSamplePeriod = (float) 0.100;
+	rec.CalibrationEquation = kEquationType_Linear;
+	rec.CalibrationPage[0].CalibrationCoefficientA = 0.0;
+	rec.CalibrationPage[0].CalibrationCoefficientB = (float) 1.0;
+	rec.CalibrationPage[0].CalibrationCoefficientC = 0.0;
+	rec.ActiveCalPage = 0;
+	rec.HighestValidCalPageIndex = 0;
+	//OperationType is a LabPro specific field which implies probeType.
+	rec.OperationType = 14;
+
+	if (USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID == m_nProductID)
+	{
+		//Go! Temp keeps its DDS record in local memory.
+		rec.SensorNumber = kSensorIdNumber_GoTemp;
+		strcpy(rec.SensorLongName, "Temperature");
+		strcpy(rec.SensorShortName, "Temp");
+		strcpy(rec.CalibrationPage[0].Units, "(C)");
+		rec.MinSamplePeriod = (float) 0.010;
+		rec.YminValue = (float) -20.0;
+		rec.YmaxValue = (float) 110.0;
+		rec.Checksum = GMBLSensor::CalculateDDSDataChecksum(rec);
+		GMBLSensor::MarshallDDSRec((GSensorDDSRec *) m_localNVMem, rec);
+	}
+	else
+	if (CYCLOPS_DEFAULT_PRODUCT_ID != m_nProductID)
+	{
+		//Go! Link keeps calibration info in local flash, and the sensor keeps the DDS record.
+		GSkipFlashMemoryRecord flashRec;
+		memset(&flashRec, 0, sizeof(flashRec));
+		flashRec.signature = SKIP_VALID_FLASH_SIGNATURE;
+		flashRec.ww = 0x01;
+		flashRec.yy = 0x10;
+		//Numeric fields are big endian, so store them the way WriteSkipFlashRecord() does.
+		unsigned char *pMSB = (unsigned char *) &flashRec.vinSlope;
+		GUtils::OSConvertFloatToBytes((float) 1.0, pMSB + 3, pMSB + 2, pMSB + 1, pMSB);
+		pMSB = (unsigned char *) &flashRec.vinLowSlope;
+		GUtils::OSConvertFloatToBytes((float) 1.0, pMSB + 3, pMSB + 2, pMSB + 1, pMSB);
+		memcpy(m_localNVMem, &flashRec, sizeof(flashRec));
+
+		if (m_nSensorId >= kSensorIdNumber_FirstSmartSensor)
+		{
+			rec.SensorNumber = (unsigned char) m_nSensorId;
+			strcpy(rec.SensorLongName, "Simulated Sensor");
+			strcpy(rec.SensorShortName, "Sim");
+			strcpy(rec.CalibrationPage[0].Units, "(V)");
+			rec.YminValue = 0.0;
+			rec.YmaxValue = (float) 5.0;
+			rec.Checksum = GMBLSensor::CalculateDDSDataChecksum(rec);
+			GMBLSensor::MarshallDDSRec((GSensorDDSRec *) m_remoteNVMem, rec);
+		}
+	}
+}
+
+void GSkipSimulator::ResetToInitState(void)
+{
+	//Mirror what the firmware does in response to SKIP_CMD_ID_INIT.
+	m_bMeasuring = false;
+	m_measurementStartTimeMs = 0;
+	m_fMeasurementsGenerated = 0.0;
+	if (USB_DIRECT_TEMP_DEFAULT_PRODUCT_ID == m_nProductID)
+	{
+		m_nPeriodTicks = (int) floor(0.5/m_fTickInSeconds + 0.5);
+		m_ledColor = kLEDOrange;
+		m_ledBrightness = kSkipOrangeLedBrightness;
+	}
+	else
+	{
+		if (CYCLOPS_DEFAULT_PRODUCT_ID != m_nProductID)
+			m_nPeriodTicks = (int) floor(0.1/m_fTickInSeconds + 0.5);
+		m_ledColor = kLEDOff;
+		m_ledBrightness = 0;
+	}
+}
+
+bool GSkipSimulator::IsCmdSupported(unsigned char cmd)
+{
+	bool bSupported = false;
+	switch (cmd)
+	{
+		case SKIP_CMD_ID_GET_STATUS:
+		case SKIP_CMD_ID_START_MEASUREMENTS:
+		case SKIP_CMD_ID_STOP_MEASUREMENTS:
+		case SKIP_CMD_ID_INIT:
+		case SKIP_CMD_ID_SET_MEASUREMENT_PERIOD:
+		case SKIP_CMD_ID_GET_MEASUREMENT_PERIOD:
+		case SKIP_CMD_ID_SET_LED_STATE:
+		case SKIP_CMD_ID_GET_LED_STATE:
+			bSupported = true;
+			break;
+		case SKIP_CMD_ID_GET_SERIAL_NUMBER:
+		case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_1BYTE:
+		case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_2BYTES:
+		case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_3BYTES:
+		case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_4BYTES:
+		case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_5BYTES:
+		case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_6BYTES:
+		case SKIP_CMD_ID_READ_LOCAL_NV_MEM:
+			bSupported = (CYCLOPS_DEFAULT_PRODUCT_ID != m_nProductID);
+			break;
+		case SKIP_CMD_ID_SET_VIN_OFFSET_DAC:
+		case SKIP_CMD_ID_GET_VIN_OFFSET_DAC:
+		case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_1BYTE:
+		case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_2BYTES:
+		case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_3BYTES:
+		case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_4BYTES:
+		case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_5BYTES:
+		case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_6BYTES:
+		case SKIP_CMD_ID_READ_REMOTE_NV_MEM:
+		case SKIP_CMD_ID_GET_SENSOR_ID:
+		case SKIP_CMD_ID_SET_ANALOG_INPUT_CHANNEL:
+		case SKIP_CMD_ID_GET_ANALOG_INPUT_CHANNEL:
+			bSupported = (SKIP_DEFAULT_PRODUCT_ID == m_nProductID) || (MINI_GC_DEFAULT_PRODUCT_ID == m_nProductID);
+			break;
+		case SKIP_CMD_ID_GET_MEASUREMENT_STATUS:
+		case SKIP_CMD_ID_SET_TEMPERATURE:
+		case SKIP_CMD_ID_GET_TEMPERATURE:
+			bSupported = (CYCLOPS_DEFAULT_PRODUCT_ID == m_nProductID);
+			break;
+		default:
+			break;
+	}
+
+	return bSupported;
+}
+
+void GSkipSimulator::QueueResponse(
+	unsigned char header,	//[in] complete header byte, including the byte count.
+	unsigned char cmd,		//[in]
+	const void *pPayload,	//[in] may be NULL if nPayloadBytes == 0.
+	int nPayloadBytes)		//[in] <= 6
+{
+	GSTD_ASSERT(nPayloadBytes <= 6);
+	if (m_nPendingResponses < (int) (sizeof(m_pendingResponses)/sizeof(m_pendingResponses[0])))
+	{
+		GSkipGenericResponsePacket *pPacket = (GSkipGenericResponsePacket *) &m_pendingResponses[m_nPendingResponses++];
+		memset(pPacket, 0, sizeof(GSkipPacket));
+		pPacket->header = header;
+		pPacket->cmd = cmd;
+		if (nPayloadBytes > 0)
+			memcpy(pPacket->responsePayload, pPayload, nPayloadBytes);
+	}
+}
+
+void GSkipSimulator::QueueDefaultResponse(unsigned char cmd, unsigned char status)
+{
+	unsigned char header = (SKIP_STATUS_SUCCESS == status) ? SKIP_CMD_RESP_DEFAULT_HDR : SKIP_CMD_RESP_ERROR_HDR;
+	if (SKIP_CMD_ID_INIT == cmd)
+	{
+		header = SKIP_INIT_CMD_RESP_HDR;
+		if (SKIP_STATUS_SUCCESS != status)
+			header |= SKIP_MASK_INPUT_PACKET_ERROR_FLAG;
+	}
+	QueueResponse(header, cmd, &status, 1);
+}
+
+void GSkipSimulator::HandleReadNVMem(
+	unsigned char cmd,
+	const unsigned char *pImage,	//[in] 256 byte memory image.
+	unsigned int addr,
+	unsigned int nBytes)
+{
+	if ((addr + nBytes) > 256)
+		QueueDefaultResponse(cmd, SKIP_STATUS_ERROR_INVALID_PARAMETER);
+	else
+	{
+		//First packet carries the cmd and up to 6 bytes, later packets carry up to 7 bytes.
+		unsigned int nBytesThisPacket = (nBytes > SKIP_MAX_READ_NV_MEM_DATA_BYTES_1ST_PACKET) ? SKIP_MAX_READ_NV_MEM_DATA_BYTES_1ST_PACKET : nBytes;
+		unsigned int nBytesSent = nBytesThisPacket;
+		unsigned char header = (unsigned char) (SKIP_INPUT_PACKET_CMD_RESP | SKIP_MASK_CMD_RESP_1ST_PACKET_FLAG | (nBytesThisPacket + 1));
+		if (nBytesSent == nBytes)
+			header |= SKIP_MASK_CMD_RESP_LAST_PACKET_FLAG;
+		QueueResponse(header, cmd, &pImage[addr], nBytesThisPacket);
+
+		while (nBytesSent < nBytes)
+		{
+			nBytesThisPacket = nBytes - nBytesSent;
+			if (nBytesThisPacket > SKIP_MAX_CMD_RESP_NUMBYTES)
+				nBytesThisPacket = SKIP_MAX_CMD_RESP_NUMBYTES;
+			header = (unsigned char) (SKIP_INPUT_PACKET_CMD_RESP | nBytesThisPacket);
+			if ((nBytesSent + nBytesThisPacket) == nBytes)
+				header |= SKIP_MASK_CMD_RESP_LAST_PACKET_FLAG;
+			//There is no cmd byte after the 1st packet, so the payload starts right after the header.
+			QueueResponse(header, pImage[addr + nBytesSent], &pImage[addr + nBytesSent + 1], nBytesThisPacket - 1);
+			nBytesSent += nBytesThisPacket;
+		}
+	}
+}
+
+void GSkipSimulator::HandleCmd(const GSkipOutputPacket *pCmd)
+{
+	unsigned char cmd = pCmd->cmd;
+	const unsigned char *pParams = pCmd->params;
+
+	if (!IsCmdSupported(cmd))
+	{
+		QueueDefaultResponse(cmd, SKIP_STATUS_CMD_NOT_SUPPORTED);
+		return;
+	}
+
+	switch (cmd)
+	{
+		case SKIP_CMD_ID_INIT:
+			ResetToInitState();
+			QueueDefaultResponse(cmd, SKIP_STATUS_SUCCESS);
+			break;
+		case SKIP_CMD_ID_GET_STATUS:
+			{
+				GSkipGetStatusCmdResponsePayload payload;
+				payload.status = 0;
+				payload.minorVersionMasterCPU = 0x23;
+				payload.majorVersionMasterCPU = 0x01;
+				payload.minorVersionSlaveCPU = 0x23;
+				payload.majorVersionSlaveCPU = 0x01;
+				QueueResponse(SKIP_GET_STATUS_CMD_RESP_HDR, cmd, &payload, sizeof(payload));
+			}
+			break;
+		case SKIP_CMD_ID_START_MEASUREMENTS:
+			if ((CYCLOPS_DEFAULT_PRODUCT_ID == m_nProductID) && (pParams[1] || pParams[2]))
+				QueueDefaultResponse(cmd, SKIP_STATUS_ERROR_INVALID_PARAMETER);//Non real time collection is not simulated.
+			else
+			{
+				m_bMeasuring = true;
+				m_measurementStartTimeMs = GUtils::OSGetTimeStamp();
+				m_fMeasurementsGenerated = 0.0;
+				QueueDefaultResponse(cmd, SKIP_STATUS_SUCCESS);
+			}
+			break;
+		case SKIP_CMD_ID_STOP_MEASUREMENTS:
+			m_bMeasuring = false;
+			QueueDefaultResponse(cmd, SKIP_STATUS_SUCCESS);
+			break;
+		case SKIP_CMD_ID_SET_MEASUREMENT_PERIOD:
+			{
+				int nNumTicks;
+				GUtils::OSConvertBytesToInt(pParams[0], pParams[1], pParams[2], pParams[3], &nNumTicks);
+				if (m_bMeasuring)
+					QueueDefaultResponse(cmd, SKIP_STATUS_ERROR_CANNOT_CHANGE_PERIOD_WHILE_COLLECTING);
+				else
+				if (nNumTicks <= 0)
+					QueueDefaultResponse(cmd, SKIP_STATUS_ERROR_INVALID_PARAMETER);
+				else
+				{
+					m_nPeriodTicks = nNumTicks;
+					QueueDefaultResponse(cmd, SKIP_STATUS_SUCCESS);
+				}
+			}
+			break;
+		case SKIP_CMD_ID_GET_MEASUREMENT_PERIOD:
+			{
+				GSkipGetMeasurementPeriodCmdResponsePayload payload;
+				GUtils::OSConvertIntToBytes(m_nPeriodTicks, &payload.lsbyteLswordMeasurementPeriod, &payload.msbyteLswordMeasurementPeriod,
+					&payload.lsbyteMswordMeasurementPeriod, &payload.msbyteMswordMeasurementPeriod);
+				QueueResponse(SKIP_GET_MEASUREMENT_PERIOD_CMD_RESP_HDR, cmd, &payload, sizeof(payload));
+			}
+			break;
+		case SKIP_CMD_ID_SET_LED_STATE:
+			m_ledColor = pParams[0];
+			m_ledBrightness = pParams[1];
+			QueueDefaultResponse(cmd, SKIP_STATUS_SUCCESS);
+			break;
+		case SKIP_CMD_ID_GET_LED_STATE:
+			{
+				GSkipGetLedStateCmdResponsePayload payload;
+				payload.color = m_ledColor;
+				payload.brightness = m_ledBrightness;
+				QueueResponse(SKIP_GET_LED_STATE_CMD_RESP_HDR, cmd, &payload, sizeof(payload));
+			}
+			break;
+		case SKIP_CMD_ID_GET_SERIAL_NUMBER:
+			{
+				GSkipGetSerialNumberCmdResponsePayload payload;
+				payload.ww = 0x01;
+				payload.yy = 0x10;
+				GUtils::OSConvertIntToBytes(m_nDeviceIndex + 1, &payload.lsbyteLswordSerialCounter, &payload.msbyteLswordSerialCounter,
+					&payload.lsbyteMswordSerialCounter, &payload.msbyteMswordSerialCounter);
+				QueueResponse(SKIP_GET_SERIAL_NUMBER_CMD_RESP_HDR, cmd, &payload, sizeof(payload));
+			}
+			break;
+		case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_1BYTE:
+		case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_2BYTES:
+		case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_3BYTES:
+		case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_4BYTES:
+		case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_5BYTES:
+		case SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_6BYTES:
+		case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_1BYTE:
+		case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_2BYTES:
+		case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_3BYTES:
+		case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_4BYTES:
+		case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_5BYTES:
+		case SKIP_CMD_ID_WRITE_REMOTE_NV_MEM_6BYTES:
+			{
+				bool bLocal = (cmd <= SKIP_CMD_ID_WRITE_LOCAL_NV_MEM_6BYTES);
+				unsigned int nBytes = (cmd & SKIP_MASK_WRITE_NV_MEM_CMD_NUMBYTES);
+				unsigned int addr = pParams[0];
+				if ((addr + nBytes) > 256)
+					QueueDefaultResponse(cmd, SKIP_STATUS_ERROR_INVALID_PARAMETER);
+				else
+				if (m_bMeasuring)
+					QueueDefaultResponse(cmd, SKIP_STATUS_ERROR_CANNOT_WRITE_FLASH_WHILE_COLLECTING);
+				else
+				{
+					memcpy(bLocal ? &m_localNVMem[addr] : &m_remoteNVMem[addr], &pParams[1], nBytes);
+					QueueDefaultResponse(cmd, SKIP_STATUS_SUCCESS);
+				}
+			}
+			break;
+		case SKIP_CMD_ID_READ_LOCAL_NV_MEM:
+			HandleReadNVMem(cmd, m_localNVMem, pParams[0], pParams[1]);
+			break;
+		case SKIP_CMD_ID_READ_REMOTE_NV_MEM:
+			HandleReadNVMem(cmd, m_remoteNVMem, pParams[0], pParams[1]);
+			break;
+		case SKIP_CMD_ID_GET_SENSOR_ID:
+			{
+				GSkipGetSensorIdCmdResponsePayload payload;
+				GUtils::OSConvertIntToBytes(m_nSensorId, &payload.lsbyteLswordSensorId, &payload.msbyteLswordSensorId,
+					&payload.lsbyteMswordSensorId, &payload.msbyteMswordSensorId);
+				QueueResponse(SKIP_GET_SENSOR_ID_CMD_RESP_HDR, cmd, &payload, sizeof(payload));
+			}
+			break;
+		case SKIP_CMD_ID_SET_ANALOG_INPUT_CHANNEL:
+			if (pParams[0] > SKIP_ANALOG_INPUT_CHANNEL_VID)
+				QueueDefaultResponse(cmd, SKIP_STATUS_ERROR_INVALID_PARAMETER);
+			else
+			{
+				m_analogInputChannel = pParams[0];
+				QueueDefaultResponse(cmd, SKIP_STATUS_SUCCESS);
+			}
+			break;
+		case SKIP_CMD_ID_GET_ANALOG_INPUT_CHANNEL:
+			QueueResponse(SKIP_GET_ANALOG_INPUT_CHANNEL_CMD_RESP_HDR, cmd, &m_analogInputChannel, 1);
+			break;
+		case SKIP_CMD_ID_SET_VIN_OFFSET_DAC:
+			m_vinOffsetDac = (char) pParams[0];
+			QueueDefaultResponse(cmd, SKIP_STATUS_SUCCESS);
+			break;
+		case SKIP_CMD_ID_GET_VIN_OFFSET_DAC:
+			QueueResponse(SKIP_GET_VIN_OFFSET_DAC_CMD_RESP_HDR, cmd, &m_vinOffsetDac, 1);
+			break;
+		case SKIP_CMD_ID_GET_MEASUREMENT_STATUS:
+			{
+				GSkipGetMeasurementStatusCmdResponsePayload payload;
+				memset(&payload, 0, sizeof(payload));
+				if (m_bMeasuring)
+					payload.flags = SKIP_MEASURMENT_STATUS_MASK_REALTIME_MEAS_ENABLED;
+				QueueResponse(SKIP_GET_MEASUREMENT_STATUS_CMD_RESP_HDR, cmd, &payload, sizeof(payload));
+			}
+			break;
+		case SKIP_CMD_ID_SET_TEMPERATURE:
+			memcpy(m_temperature, pParams, sizeof(m_temperature));
+			QueueDefaultResponse(cmd, SKIP_STATUS_SUCCESS);
+			break;
+		case SKIP_CMD_ID_GET_TEMPERATURE:
+			QueueResponse(SKIP_GET_TEMPERATURE_CMD_RESP_HDR, cmd, m_temperature, sizeof(m_temperature));
+			break;
+		default:
+			QueueDefaultResponse(cmd, SKIP_STATUS_CMD_NOT_SUPPORTED);
+			break;
+	}
+}
+
+void GSkipSimulator::WriteCmdPacket(const GSkipPacket *pPacket)
+{
+	GSkipPacket responses[sizeof(m_pendingResponses)/sizeof(m_pendingResponses[0])];
+	int nNumResponses = 0;
+
+	if (GThread::OSLockMutex(m_pStateMutex))
+	{
+		m_nPendingResponses = 0;
+		HandleCmd((const GSkipOutputPacket *) pPacket);
+		nNumResponses = m_nPendingResponses;
+		memcpy(responses, m_pendingResponses, nNumResponses*sizeof(GSkipPacket));
+		m_nPendingResponses = 0;
+		GThread::OSUnlockMutex(m_pStateMutex);
+	}
+
+	//Deliver outside the state mutex so that the sinks are free to call back into us.
+	for (int i = 0; i < nNumResponses; i++)
+		(*m_pCmdRespSink)(m_pSinkContext, &responses[i]);
+}
+
+int GSkipSimulator::GetMeasurementPeriodInMicroseconds(void)
+{
+	int nPeriodUs = m_config.nPeriodOverrideUs;
+	if (nPeriodUs <= 0)
+		nPeriodUs = (int) floor(m_nPeriodTicks*m_fTickInSeconds*1000000.0 + 0.5);
+	if (nPeriodUs <= 0)
+		nPeriodUs = 1;
+
+	return nPeriodUs;
+}
+
+int GSkipSimulator::GetMeasurementsPerPacket(int nPeriodUs)
+{
+	int nPerPacket = 1;
+	if (CYCLOPS_DEFAULT_PRODUCT_ID != m_nProductID)
+	{
+		if (m_config.nMeasurementsPerPacket > 0)
+			nPerPacket = m_config.nMeasurementsPerPacket;
+		else
+		if (nPeriodUs < 10000)
+			nPerPacket = 3;
+		else
+		if (nPeriodUs < 20000)
+			nPerPacket = 2;
+	}
+
+	return nPerPacket;
+}
+
+void GSkipSimulator::Pump(void)
+{
+	GSkipPacket packets[SIM_MAX_PACKETS_PER_PUMP];
+	bool bMoreDue = true;
+
+	while (bMoreDue)
+	{
+		int nNumPackets = 0;
+		bMoreDue = false;
+
+		if (GThread::OSLockMutex(m_pStateMutex))
+		{
+			if (m_bMeasuring)
+			{
+				int nPeriodUs = GetMeasurementPeriodInMicroseconds();
+				int nPerPacket = GetMeasurementsPerPacket(nPeriodUs);
+				unsigned int elapsedMs = GUtils::OSGetTimeStamp() - m_measurementStartTimeMs;
+				real fMeasurementsDue = floor((elapsedMs*1000.0)/nPeriodUs);
+
+				while (((fMeasurementsDue - m_fMeasurementsGenerated) >= nPerPacket) && (nNumPackets < SIM_MAX_PACKETS_PER_PUMP))
+				{
+					GSkipPacket packet;
+					memset(&packet, 0, sizeof(packet));
+					if (CYCLOPS_DEFAULT_PRODUCT_ID == m_nProductID)
+					{
+						GCyclopsMeasurementPacket *pCyclopsPacket = (GCyclopsMeasurementPacket *) &packet;
+						pCyclopsPacket->nMeasurementsInPacket = 1;
+						pCyclopsPacket->nRollingCounter = m_rollingCounter;
+						GUtils::OSConvertIntToBytes((int) m_nMeasurementSequence, &pCyclopsPacket->measLsByteLsWord, &pCyclopsPacket->measMsByteLsWord,
+							&pCyclopsPacket->measLsByteMsWord, &pCyclopsPacket->measMsByteMsWord);
+						pCyclopsPacket->measurementType = CYCLOPS_MEAS_TYPE_DISTANCE;
+						m_nMeasurementSequence++;
+					}
+					else
+					{
+						GSkipMeasurementPacket *pSkipPacket = (GSkipMeasurementPacket *) &packet;
+						unsigned char *pMeas = &pSkipPacket->meas0LsByte;
+						pSkipPacket->nMeasurementsInPacket = (unsigned char) nPerPacket;
+						pSkipPacket->nRollingCounter = m_rollingCounter;
+						for (int i = 0; i < nPerPacket; i++)
+						{
+							GUtils::OSConvertShortToBytes((short) m_nMeasurementSequence, &pMeas[2*i], &pMeas[2*i + 1]);
+							m_nMeasurementSequence++;
+						}
+					}
+					//Like the firmware, the rolling counter advances by the number of measurements in each packet.
+					m_rollingCounter = (unsigned char) (m_rollingCounter + ((GSkipMeasurementPacket *) &packet)->nMeasurementsInPacket);
+					m_fMeasurementsGenerated += nPerPacket;
+
+					//Lost packets still consume rolling counter values, so the host can see the gap.
+					bool bDrop = (m_config.nLossInterval > 0) && ((int) (m_nPacketsGenerated % m_config.nLossInterval) < m_config.nLossBurst);
+					m_nPacketsGenerated++;
+					if (!bDrop)
+						packets[nNumPackets++] = packet;
+				}
+
+				bMoreDue = (SIM_MAX_PACKETS_PER_PUMP == nNumPackets);
+			}
+
+			GThread::OSUnlockMutex(m_pStateMutex);
+		}
+
+		for (int i = 0; i < nNumPackets; i++)
+			(*m_pMeasurementSink)(m_pSinkContext, &packets[i]);
+	}
+}
+
+#ifdef LIB_NAMESPACE
+}
+#endif
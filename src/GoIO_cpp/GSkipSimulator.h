@@ -0,0 +1,142 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipSimulator.h
+//
+// GSkipSimulator is an in-process stand-in for a Go! Link, Go! Temp, Go! Motion, or Mini GC.
+// It speaks the packet protocol described in GSkipComm.h through the GSkipVirtualDevice interface.
+// That lets the rest of the library (and applications built on GoIO_DLL) be exercised without
+// hardware, e.g. to load test many devices at once.
+//
+// Simulated devices are enabled by SetConfig(), which takes a comma separated list of
+// key=value pairs:
+//		golink=N, gotemp=N, gomotion=N, minigc=N	number of simulated devices of each type.
+//		period_us=N		override the measurement period requested by the host(0 => honour it).
+//		fill=N			measurements per packet, 1 to 3(0 => choose from the period like Go! Link does).
+//		loss=N			drop packets out of every N generated(0 => no loss).
+//		burst=N			number of consecutive packets dropped each time(default 1).
+//		sensor_id=N		sensor id reported by simulated Go! Links and Mini GCs(default 20).
+//
+// Simulated devices are named "sim:<product id>:<index>". Raw measurements ramp up by one per
+// measurement, so consumers can check ordering and detect dropped packets.
+
+#ifndef _GSKIPSIMULATOR_H_
+#define _GSKIPSIMULATOR_H_
+
+#include "GTypes.h"
+#include "GThread.h"
+#include "GSkipComm.h"
+#include "GSkipVirtualDevice.h"
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+struct GSkipSimulatorConfig
+{
+	int nNumGoLinks;
+	int nNumGoTemps;
+	int nNumGoMotions;
+	int nNumMiniGCs;
+	int nPeriodOverrideUs;
+	int nMeasurementsPerPacket;
+	int nLossInterval;
+	int nLossBurst;
+	int nSensorId;
+};
+
+class GSkipSimulator : public GSkipVirtualDevice
+{
+public:
+						GSkipSimulator(int nProductID, int nDeviceIndex,
+							GSkipVirtualDevicePacketSinkPtr pCmdRespSink, GSkipVirtualDevicePacketSinkPtr pMeasurementSink, void *pSinkContext);
+	virtual				~GSkipSimulator();
+
+	// Create a simulator for sDeviceName if it names a simulated device, else return NULL.
+	static GSkipSimulator *	CreateSimulator(const cppstring &sDeviceName,
+							GSkipVirtualDevicePacketSinkPtr pCmdRespSink, GSkipVirtualDevicePacketSinkPtr pMeasurementSink, void *pSinkContext);
+
+	// Handle one command packet. Response packets are delivered through the cmd response sink before this returns.
+	virtual void		WriteCmdPacket(const GSkipPacket *pPacket);
+
+	// Deliver any measurement packets that have come due since the last call. Called from the listener thread.
+	virtual void		Pump(void);
+
+	// Configuration is global, and should be set before the list of available devices is updated.
+	static bool			SetConfig(const cppstring &sConfig);
+	static void			GetConfig(GSkipSimulatorConfig *pConfig) { *pConfig = m_config; }
+	static StringVector	GetAvailableDevices(int nVendorID, int nProductID);
+	static bool			IsSimulatedDeviceName(const cppstring &sDeviceName);
+
+private:
+	void				HandleCmd(const GSkipOutputPacket *pCmd);
+	void				HandleReadNVMem(unsigned char cmd, const unsigned char *pImage, unsigned int addr, unsigned int nBytes);
+	void				QueueResponse(unsigned char header, unsigned char cmd, const void *pPayload, int nPayloadBytes);
+	void				QueueDefaultResponse(unsigned char cmd, unsigned char status);
+	void				ResetToInitState(void);
+	void				BuildNVMemImages(void);
+	int					GetMeasurementPeriodInMicroseconds(void);
+	int					GetMeasurementsPerPacket(int nPeriodUs);
+	bool				IsCmdSupported(unsigned char cmd);
+
+	int					m_nProductID;
+	int					m_nDeviceIndex;
+	GSkipVirtualDevicePacketSinkPtr	m_pCmdRespSink;
+	GSkipVirtualDevicePacketSinkPtr	m_pMeasurementSink;
+	void *				m_pSinkContext;
+	OSMutex				m_pStateMutex;
+
+	unsigned char		m_localNVMem[256];
+	unsigned char		m_remoteNVMem[256];
+	int					m_nSensorId;
+	int					m_nPeriodTicks;
+	real				m_fTickInSeconds;
+	unsigned char		m_ledColor;
+	unsigned char		m_ledBrightness;
+	unsigned char		m_analogInputChannel;
+	char				m_vinOffsetDac;
+	unsigned char		m_temperature[4];
+
+	bool				m_bMeasuring;
+	unsigned int		m_measurementStartTimeMs;
+	real				m_fMeasurementsGenerated;//since measurements were started, real so it does not wrap
+	unsigned int		m_nMeasurementSequence;//value of the next measurement
+	unsigned int		m_nPacketsGenerated;//drives the loss pattern
+	unsigned char		m_rollingCounter;
+
+	GSkipPacket			m_pendingResponses[48];
+	int					m_nPendingResponses;
+
+	static GSkipSimulatorConfig m_config;
+};
+
+#ifdef LIB_NAMESPACE
+}
+#endif
+
+#endif // _GSKIPSIMULATOR_H_
@@ -0,0 +1,162 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipSpillFile.cpp
+
+#include "stdafx.h"
+#include "GSkipSpillFile.h"
+#include "GUtils.h"
+
+#ifdef _DEBUG
+#include "GPlatformDebug.h" // for DEBUG_NEW definition
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+GSkipSpillFile::GSkipSpillFile(FILE *pFile, const cppstring &sFileName)
+{
+	m_pFile = pFile;
+	m_sFileName = sFileName;
+	m_nFirstRec = 0;
+	m_nNextRec = 0;
+	m_nNumMeasurements = 0;
+	m_bPositionedForAppend = true;
+}
+
+GSkipSpillFile::~GSkipSpillFile()
+{
+	if (m_pFile)
+		fclose(m_pFile);
+	m_pFile = NULL;
+	remove(m_sFileName.c_str());
+}
+
+GSkipSpillFile *GSkipSpillFile::Create(
+	const cppstring &sFileName)
+{
+	GSkipSpillFile *pSpillFile = NULL;
+	FILE *pFile = fopen(sFileName.c_str(), "w+b");
+	if (pFile)
+		pSpillFile = new GSkipSpillFile(pFile, sFileName);
+	else
+	{
+		cppsstream ss;
+		ss << GSTD_S("GSkipSpillFile::Create() could not create '") << sFileName << GSTD_S("'.");
+		GSTD_TRACE(ss.str());
+	}
+
+	return pSpillFile;
+}
+
+bool GSkipSpillFile::AppendRec(
+	const GSkipPacket *pRec,	//[in]
+	int nMeasurementsInRec)		//[in]
+{
+	bool bSuccess = false;
+	if (!m_pFile)
+		return false;
+
+	unsigned char record[GSKIP_SPILL_RECORD_SIZE];
+	memcpy(record, pRec, sizeof(GSkipPacket));
+	record[sizeof(GSkipPacket)] = (unsigned char) nMeasurementsInRec;
+
+	if (!m_bPositionedForAppend)
+		m_bPositionedForAppend = (0 == fseek(m_pFile, m_nNextRec*((long) GSKIP_SPILL_RECORD_SIZE), SEEK_SET));
+	if (m_bPositionedForAppend)
+	{
+		if (1 == fwrite(record, sizeof(record), 1, m_pFile))
+		{
+			m_nNextRec++;
+			m_nNumMeasurements += nMeasurementsInRec;
+			bSuccess = true;
+		}
+		else
+		{
+			//The file position is unknown now, so seek before the next write.
+			m_bPositionedForAppend = false;
+			clearerr(m_pFile);
+		}
+	}
+
+	return bSuccess;
+}
+
+int GSkipSpillFile::RetrieveRecs(
+	GSkipPacket *pRecs,						//[out]
+	unsigned char *pNumMeasurementsInRecs,	//[out]
+	int nMaxRecs)							//[in]
+{
+	int nRecsRead = 0;
+	if (nMaxRecs > NumRecsAvailable())
+		nMaxRecs = NumRecsAvailable();
+
+	if ((nMaxRecs > 0) && m_pFile && (0 == fseek(m_pFile, m_nFirstRec*((long) GSKIP_SPILL_RECORD_SIZE), SEEK_SET)))
+	{
+		m_bPositionedForAppend = false;
+		unsigned char record[GSKIP_SPILL_RECORD_SIZE];
+		while ((nRecsRead < nMaxRecs) && (1 == fread(record, sizeof(record), 1, m_pFile)))
+		{
+			memcpy(&pRecs[nRecsRead], record, sizeof(GSkipPacket));
+			pNumMeasurementsInRecs[nRecsRead] = record[sizeof(GSkipPacket)];
+			m_nNumMeasurements -= record[sizeof(GSkipPacket)];
+			m_nFirstRec++;
+			nRecsRead++;
+		}
+		clearerr(m_pFile);
+	}
+
+	if (nRecsRead < nMaxRecs)
+		GSTD_TRACE("GSkipSpillFile::RetrieveRecs() read failed.");
+	if (0 == NumRecsAvailable())
+		Clear();//Caught up, so give the disk space back.
+
+	return nRecsRead;
+}
+
+void GSkipSpillFile::Clear(void)
+{
+	//Reopening truncates the file, but costs a lot more than a seek, so only do it if the backlog was big.
+	if (m_pFile && (m_nNextRec > GSKIP_SPILL_TRUNCATE_THRESHOLD_RECS))
+	{
+		m_pFile = freopen(m_sFileName.c_str(), "w+b", m_pFile);
+		if (!m_pFile)
+			GSTD_TRACE("GSkipSpillFile::Clear() could not reopen the spill file.");
+	}
+	m_nFirstRec = 0;
+	m_nNextRec = 0;
+	m_nNumMeasurements = 0;
+	m_bPositionedForAppend = (m_pFile != NULL) && (0 == fseek(m_pFile, 0, SEEK_SET));
+}
+
+#ifdef LIB_NAMESPACE
+}
+#endif
@@ -0,0 +1,85 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipSpillFile.h
+//
+// Overflow storage for a measurement queue. When the queue fills up faster than the app drains it, the listener
+// thread appends packets here instead of discarding them, and the consumer reads them back in the order that they
+// arrived. Whenever the consumer catches up, the file is reused from the start(and truncated, if the backlog was
+// large), so it only grows as big as the largest backlog. It is deleted when the spill file object is destroyed.
+//
+// Each record is a GSkipPacket followed by the number of measurements in it(1 byte). The records are in host
+// order, because the file never outlives the process that wrote it.
+
+#ifndef _GSKIPSPILLFILE_H_
+#define _GSKIPSPILLFILE_H_
+
+#include <stdio.h>
+#include "GTypes.h"
+#include "GSkipComm.h"
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+#define GSKIP_SPILL_RECORD_SIZE (sizeof(GSkipPacket) + 1)
+#define GSKIP_SPILL_TRUNCATE_THRESHOLD_RECS 100000
+
+class GSkipSpillFile
+{
+public:
+	// Create an empty spill file, return NULL on failure. Existing files with the same name are overwritten.
+	static GSkipSpillFile *	Create(const cppstring &sFileName);
+						~GSkipSpillFile();//Closes and deletes the file.
+
+	// Not thread safe - the owning queue serializes calls with its own mutex.
+	bool				AppendRec(const GSkipPacket *pRec, int nMeasurementsInRec);//false if the write failed.
+	int					RetrieveRecs(GSkipPacket *pRecs, unsigned char *pNumMeasurementsInRecs, int nMaxRecs);//returns # of recs read.
+	void				Clear(void);
+
+	int					NumRecsAvailable(void) { return (int) (m_nNextRec - m_nFirstRec); }
+	int					NumMeasurementsAvailable(void) { return m_nNumMeasurements; }
+	const cppstring &	GetFileName(void) { return m_sFileName; }
+	bool				IsOK(void) { return (m_pFile != NULL); }
+
+private:
+						GSkipSpillFile(FILE *pFile, const cppstring &sFileName);
+
+	FILE *				m_pFile;
+	cppstring			m_sFileName;
+	long				m_nFirstRec;//index of the oldest rec not yet retrieved.
+	long				m_nNextRec;//index that the next appended rec gets.
+	int					m_nNumMeasurements;//sum over the recs from m_nFirstRec to m_nNextRec.
+	bool				m_bPositionedForAppend;//false after a read, stdio needs a seek before switching direction.
+};
+
+#ifdef LIB_NAMESPACE
+}
+#endif
+
+#endif // _GSKIPSPILLFILE_H_
@@ -0,0 +1,441 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipStream.cpp
+
+#include "stdafx.h"
+#include "GSkipStream.h"
+#include "GUtils.h"
+#include "GThread.h"
+
+#ifdef _DEBUG
+#include "GPlatformDebug.h" // for DEBUG_NEW definition
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+cppstring GSkipStreamPublisher::GetSharedMemoryName(
+	const cppstring &sDeviceName)	//[in]
+{
+	unsigned int crc = GSkipRecorder::CalculateCrc32((const unsigned char *) sDeviceName.c_str(), 
+		sDeviceName.length()*sizeof(sDeviceName[0]));
+	cppsstream ss;
+	ss << GSTD_S("/goio.");
+	ss.width(8);
+	ss.fill(GSTD_S('0'));
+	ss << std::hex << crc;
+	return ss.str();
+}
+
+//True if sShmName holds a stream whose publisher is no longer running. Regions that are not fully set up yet,
+//or that an older version created, are never considered stale.
+static bool IsStaleStream(
+	const cppstring &sShmName)	//[in]
+{
+	bool bStale = false;
+	unsigned long long nNumBytes = 0;
+	void *pMapping = NULL;
+	const unsigned char *pData = GUtils::OSOpenSharedMemoryReadOnly(sShmName, &nNumBytes, &pMapping);
+	if (pData)
+	{
+		const GSkipStreamHeader *pHeader = (const GSkipStreamHeader *) pData;
+		if ((nNumBytes >= GSKIP_STREAM_HEADER_SIZE) && 
+			(0 == memcmp(pHeader->signature, GSKIP_STREAM_SIGNATURE, sizeof(pHeader->signature))) &&
+			(0 != pHeader->nPublisherPid))
+			bStale = !GUtils::OSIsProcessRunning(pHeader->nPublisherPid);
+		GUtils::OSCloseSharedMemory(pData, nNumBytes, pMapping);
+	}
+
+	return bStale;
+}
+
+GSkipStreamPublisher *GSkipStreamPublisher::Create(
+	const cppstring &sDeviceName,			//[in]
+	const GSkipRecordingMetadata &metadata,	//[in] sensor and conversion info for the readers.
+	int nNumSlots /* = GSKIP_STREAM_DEFAULT_SLOTS */)	//[in]
+{
+	if ((sizeof(GSkipStreamHeader) > GSKIP_STREAM_HEADER_SIZE) || (sDeviceName.length() >= GSKIP_STREAM_MAX_DEVICE_NAME) ||
+		(nNumSlots <= 0) || (nNumSlots > GSKIP_STREAM_MAX_SLOTS))
+	{
+		GSTD_TRACE("GSkipStreamPublisher::Create - invalid parameters.");
+		return NULL;
+	}
+
+	unsigned int nSlots = 1;
+	while (nSlots < (unsigned int) nNumSlots)
+		nSlots <<= 1;
+
+	cppstring sShmName = GetSharedMemoryName(sDeviceName);
+	unsigned long long nNumBytes = GSKIP_STREAM_HEADER_SIZE + ((unsigned long long) nSlots)*sizeof(GSkipStreamSample);
+	void *pMapping = NULL;
+	unsigned char *pData = GUtils::OSCreateSharedMemory(sShmName, nNumBytes, &pMapping);
+	if ((NULL == pData) && IsStaleStream(sShmName))
+	{
+		//Only one process at a time can open the device, so no other publisher can be replacing the region too.
+		GSTD_TRACE("GSkipStreamPublisher::Create - replacing the shared memory left behind by a publisher that exited.");
+		GUtils::OSRemoveSharedMemory(sShmName);
+		pData = GUtils::OSCreateSharedMemory(sShmName, nNumBytes, &pMapping);
+	}
+	if (NULL == pData)
+	{
+		GSTD_TRACE("GSkipStreamPublisher::Create - unable to create the shared memory.");
+		return NULL;
+	}
+
+	GSkipStreamHeader *pHeader = (GSkipStreamHeader *) pData;
+	memset(pHeader, 0, sizeof(GSkipStreamHeader));
+	pHeader->nVersion = GSKIP_STREAM_VERSION;
+	pHeader->nHeaderSize = GSKIP_STREAM_HEADER_SIZE;
+	pHeader->nSampleSize = sizeof(GSkipStreamSample);
+	pHeader->nMetadataSize = sizeof(GSkipRecordingMetadata);
+	pHeader->nNumSlots = nSlots;
+	pHeader->nState = kSkipStreamState_Publishing;
+	pHeader->nPublisherPid = GUtils::OSGetProcessId();
+	pHeader->startTimeUs = GUtils::OSGetTimeStampMicroseconds();
+	memcpy(pHeader->deviceName, sDeviceName.c_str(), sDeviceName.length());
+	pHeader->metadata = metadata;
+	pHeader->metadata.firstSampleIndex = 0;
+
+	//Readers ignore the region until the signature shows up.
+	GThread::OSMemoryBarrier();
+	memcpy(pHeader->signature, GSKIP_STREAM_SIGNATURE, sizeof(pHeader->signature));
+
+	return new GSkipStreamPublisher(pData, nNumBytes, pMapping, sShmName, metadata);
+}
+
+GSkipStreamPublisher::GSkipStreamPublisher(unsigned char *pData, unsigned long long nNumBytes, void *pMapping,
+	const cppstring &sShmName, const GSkipRecordingMetadata &metadata)
+{
+	m_pData = pData;
+	m_nNumBytes = nNumBytes;
+	m_pMapping = pMapping;
+	m_sShmName = sShmName;
+	m_pHeader = (GSkipStreamHeader *) pData;
+	m_pSlots = (GSkipStreamSample *) (pData + GSKIP_STREAM_HEADER_SIZE);
+	m_calibrationSensor.SetDDSRec(metadata.ddsRec, false);
+	m_fVoltsPerBit = metadata.fVoltsPerBit;
+	m_fVoltsOffset = metadata.fVoltsOffset;
+	m_nextSampleIndex = 0;
+	m_nNumPublished = 0;
+}
+
+GSkipStreamPublisher::~GSkipStreamPublisher()
+{
+	GThread::OSMemoryBarrier();
+	m_pHeader->nState = kSkipStreamState_Stopped;
+	GUtils::OSRemoveSharedMemory(m_sShmName);
+	GUtils::OSCloseSharedMemory(m_pData, m_nNumBytes, m_pMapping);
+}
+
+void GSkipStreamPublisher::AddMeasurements(
+	const int *pMeasurements,	//[in]
+	int nNumMeasurements,		//[in]
+	int nNumMissing)			//[in] # of measurements lost just before these ones.
+{
+	m_nextSampleIndex += nNumMissing;
+	if (nNumMeasurements <= 0)
+		return;
+
+	unsigned long long timeUs = GUtils::OSGetTimeStampMicroseconds();
+	unsigned int nMask = m_pHeader->nNumSlots - 1;
+	unsigned int nStart = m_pHeader->nWriteEnd;
+	unsigned int nEnd = nStart + nNumMeasurements;
+
+	//Claim the slots before touching them, so that readers can tell which of their copies may be torn.
+	if ((nEnd >= m_pHeader->nNumSlots) && !m_pHeader->nRingFull)
+		m_pHeader->nRingFull = 1;
+	m_pHeader->nWriteStart = nEnd;
+	GThread::OSMemoryBarrier();
+	for (int i = 0; i < nNumMeasurements; i++)
+	{
+		GSkipStreamSample *pSlot = &m_pSlots[(nStart + i) & nMask];
+		real fVolts = pMeasurements[i]*m_fVoltsPerBit + m_fVoltsOffset;
+		pSlot->sampleIndex = m_nextSampleIndex++;
+		pSlot->timeUs = timeUs;
+		pSlot->fCalibrated = m_calibrationSensor.CalibrateData(fVolts);
+		pSlot->nRawMeasurement = pMeasurements[i];
+		pSlot->fVolts = (float) fVolts;
+	}
+	GThread::OSMemoryBarrier();
+	m_pHeader->nWriteEnd = nEnd;
+	m_nNumPublished += nNumMeasurements;
+}
+
+void GSkipStreamPublisher::SetMeasurementPeriod(
+	real fPeriodInSeconds)	//[in]
+{
+	if (fPeriodInSeconds == m_pHeader->metadata.fMeasurementPeriod)
+		return;
+
+	m_pHeader->nMetadataSeq++;
+	GThread::OSMemoryBarrier();
+	m_pHeader->metadata.fMeasurementPeriod = fPeriodInSeconds;
+	m_pHeader->metadata.firstSampleIndex = m_nextSampleIndex;
+	GThread::OSMemoryBarrier();
+	m_pHeader->nMetadataSeq++;
+}
+
+GSkipStreamReader::GSkipStreamReader()
+{
+	m_pData = NULL;
+	m_nNumBytes = 0;
+	m_pMapping = NULL;
+	m_pHeader = NULL;
+	m_pSlots = NULL;
+	m_nNumSlots = 0;
+	m_nReadPos = 0;
+	m_nNumLost = 0;
+}
+
+GSkipStreamReader::~GSkipStreamReader()
+{
+	Close();
+}
+
+bool GSkipStreamReader::Open(
+	const cppstring &sDeviceName,	//[in]
+	bool bFromOldest /* = false */)	//[in]
+{
+	Close();
+
+	m_pData = GUtils::OSOpenSharedMemoryReadOnly(GSkipStreamPublisher::GetSharedMemoryName(sDeviceName), &m_nNumBytes, 
+		&m_pMapping);
+	if (NULL == m_pData)
+		return false;
+
+	const GSkipStreamHeader *pHeader = (const GSkipStreamHeader *) m_pData;
+	bool bValid = (m_nNumBytes >= GSKIP_STREAM_HEADER_SIZE) &&
+		(0 == memcmp(pHeader->signature, GSKIP_STREAM_SIGNATURE, sizeof(pHeader->signature)));
+	if (bValid)
+	{
+		GThread::OSMemoryBarrier();
+		unsigned int nNumSlots = pHeader->nNumSlots;
+		bValid = (GSKIP_STREAM_VERSION == pHeader->nVersion) && (GSKIP_STREAM_HEADER_SIZE == pHeader->nHeaderSize) &&
+			(sizeof(GSkipStreamSample) == pHeader->nSampleSize) && (sizeof(GSkipRecordingMetadata) == pHeader->nMetadataSize) &&
+			(nNumSlots > 0) && (0 == (nNumSlots & (nNumSlots - 1))) &&
+			(m_nNumBytes >= GSKIP_STREAM_HEADER_SIZE + ((unsigned long long) nNumSlots)*sizeof(GSkipStreamSample)) &&
+			(sDeviceName.length() < GSKIP_STREAM_MAX_DEVICE_NAME) &&
+			(0 == memcmp(pHeader->deviceName, sDeviceName.c_str(), sDeviceName.length())) &&
+			(0 == pHeader->deviceName[sDeviceName.length()]);
+	}
+	if (!bValid)
+	{
+		GSTD_TRACE("GSkipStreamReader::Open - shared memory does not hold a stream for this device.");
+		GUtils::OSCloseSharedMemory(m_pData, m_nNumBytes, m_pMapping);
+		m_pData = NULL;
+		m_nNumBytes = 0;
+		m_pMapping = NULL;
+		return false;
+	}
+
+	m_pHeader = pHeader;
+	m_pSlots = (const GSkipStreamSample *) (m_pData + GSKIP_STREAM_HEADER_SIZE);
+	m_nNumSlots = pHeader->nNumSlots;
+	m_nReadPos = pHeader->nWriteEnd;
+	if (bFromOldest)
+	{
+		m_nReadPos = pHeader->nRingFull ? (pHeader->nWriteStart - m_nNumSlots) : 0;
+		CatchUp();
+	}
+	m_nNumLost = 0;
+
+	return true;
+}
+
+void GSkipStreamReader::Close(void)
+{
+	if (m_pData)
+		GUtils::OSCloseSharedMemory(m_pData, m_nNumBytes, m_pMapping);
+	m_pData = NULL;
+	m_nNumBytes = 0;
+	m_pMapping = NULL;
+	m_pHeader = NULL;
+	m_pSlots = NULL;
+	m_nNumSlots = 0;
+}
+
+bool GSkipStreamReader::IsPublishing(void)
+{
+	return m_pHeader && (kSkipStreamState_Publishing == m_pHeader->nState);
+}
+
+bool GSkipStreamReader::GetMetadata(
+	GSkipRecordingMetadata *pMetadata)	//[out]
+{
+	if (NULL == m_pHeader)
+		return false;
+
+	//The writer only holds the seqlock for a few stores, so spinning is fine.
+	for (;;)
+	{
+		unsigned int nSeq = m_pHeader->nMetadataSeq;
+		GThread::OSMemoryBarrier();
+		(*pMetadata) = m_pHeader->metadata;
+		GThread::OSMemoryBarrier();
+		if ((0 == (nSeq & 1)) && (nSeq == m_pHeader->nMetadataSeq))
+			break;
+	}
+
+	return true;
+}
+
+unsigned int GSkipStreamReader::CatchUp(void)
+{
+	unsigned int nWriteEnd = m_pHeader->nWriteEnd;
+	GThread::OSMemoryBarrier();
+	unsigned int nBehind = nWriteEnd - m_nReadPos;
+	if (nBehind > m_nNumSlots)
+	{
+		m_nNumLost += nBehind - m_nNumSlots;
+		m_nReadPos = nWriteEnd - m_nNumSlots;
+	}
+
+	return nWriteEnd;
+}
+
+int GSkipStreamReader::CountOverwritten(
+	int nNumSamples)	//[in]
+{
+	GThread::OSMemoryBarrier();
+	unsigned int nWriteStart = m_pHeader->nWriteStart;
+	unsigned int nAhead = nWriteStart - m_nReadPos;
+	if (nAhead <= m_nNumSlots)
+		return 0;
+
+	unsigned int nOverwritten = nAhead - m_nNumSlots;
+	return (nOverwritten < (unsigned int) nNumSamples) ? (int) nOverwritten : nNumSamples;
+}
+
+int GSkipStreamReader::GetNumAvailable(void)
+{
+	if (NULL == m_pHeader)
+		return 0;
+
+	unsigned int nBehind = m_pHeader->nWriteEnd - m_nReadPos;
+	return (int) ((nBehind < m_nNumSlots) ? nBehind : m_nNumSlots);
+}
+
+bool GSkipStreamReader::GetNewest(
+	GSkipStreamSample *pSample)	//[out]
+{
+	if (NULL == m_pHeader)
+		return false;
+
+	//Retry if the writer laps the slot while it is being copied, which only happens with tiny rings.
+	for (;;)
+	{
+		unsigned int nWriteEnd = m_pHeader->nWriteEnd;
+		if ((0 == nWriteEnd) && !m_pHeader->nRingFull)
+			return false;
+		GThread::OSMemoryBarrier();
+		(*pSample) = m_pSlots[(nWriteEnd - 1) & (m_nNumSlots - 1)];
+		GThread::OSMemoryBarrier();
+		if ((m_pHeader->nWriteStart - (nWriteEnd - 1)) <= m_nNumSlots)
+			return true;
+	}
+}
+
+void GSkipStreamReader::SkipToNewest(void)
+{
+	if (m_pHeader)
+		m_nReadPos = m_pHeader->nWriteEnd;
+}
+
+int GSkipStreamReader::Read(
+	GSkipStreamSample *pSamples,	//[out]
+	int nMaxSamples)				//[in]
+{
+	if ((NULL == m_pHeader) || (nMaxSamples <= 0))
+		return 0;
+
+	unsigned int nAvailable = CatchUp() - m_nReadPos;
+	int nNumSamples = (nAvailable < (unsigned int) nMaxSamples) ? (int) nAvailable : nMaxSamples;
+	if (0 == nNumSamples)
+		return 0;
+
+	unsigned int nFirstSlot = m_nReadPos & (m_nNumSlots - 1);
+	unsigned int nFirstRun = m_nNumSlots - nFirstSlot;
+	if (nFirstRun > (unsigned int) nNumSamples)
+		nFirstRun = nNumSamples;
+	memcpy(pSamples, &m_pSlots[nFirstSlot], nFirstRun*sizeof(GSkipStreamSample));
+	if ((int) nFirstRun < nNumSamples)
+		memcpy(&pSamples[nFirstRun], &m_pSlots[0], (nNumSamples - nFirstRun)*sizeof(GSkipStreamSample));
+
+	//Drop the copies of any slots that the writer started on while they were being copied.
+	int nOverwritten = CountOverwritten(nNumSamples);
+	if (nOverwritten > 0)
+	{
+		nNumSamples -= nOverwritten;
+		memmove(pSamples, &pSamples[nOverwritten], nNumSamples*sizeof(GSkipStreamSample));
+		m_nNumLost += nOverwritten;
+		m_nReadPos += nOverwritten;
+	}
+	m_nReadPos += nNumSamples;
+
+	return nNumSamples;
+}
+
+int GSkipStreamReader::Peek(
+	const GSkipStreamSample **ppSamples,	//[out]
+	int nMaxSamples)						//[in]
+{
+	(*ppSamples) = NULL;
+	if ((NULL == m_pHeader) || (nMaxSamples <= 0))
+		return 0;
+
+	unsigned int nAvailable = CatchUp() - m_nReadPos;
+	unsigned int nFirstSlot = m_nReadPos & (m_nNumSlots - 1);
+	if (nAvailable > m_nNumSlots - nFirstSlot)
+		nAvailable = m_nNumSlots - nFirstSlot;//stop at the end of the ring.
+	int nNumSamples = (nAvailable < (unsigned int) nMaxSamples) ? (int) nAvailable : nMaxSamples;
+	if (nNumSamples > 0)
+		(*ppSamples) = &m_pSlots[nFirstSlot];
+
+	return nNumSamples;
+}
+
+int GSkipStreamReader::Consume(
+	int nNumSamples)	//[in] # of the samples returned by Peek() that the caller used.
+{
+	if ((NULL == m_pHeader) || (nNumSamples <= 0))
+		return 0;
+
+	int nOverwritten = CountOverwritten(nNumSamples);
+	m_nNumLost += nOverwritten;
+	m_nReadPos += nNumSamples;
+
+	return nOverwritten;
+}
+
+#ifdef LIB_NAMESPACE
+}
+#endif
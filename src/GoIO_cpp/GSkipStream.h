@@ -0,0 +1,192 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipStream.h
+//
+// GSkipStreamPublisher copies the measurements from one device into a ring in named shared memory, as they arrive, 
+// so that other processes can follow the sensor without going through the process that owns it. Each measurement 
+// is published as a GSkipStreamSample with its sample index, arrival time, raw value, voltage and calibrated value.
+//
+// There is one writer(the device's listener thread) and any number of GSkipStreamReaders, each with its own 
+// cursor in its own process. Readers map the region read only and never write to it, so they cannot slow the
+// writer down or interfere with each other, and reading is plain memory access, with no system calls. A reader 
+// that falls more than a ring behind loses the oldest samples, and the loss is counted rather than returned as
+// torn data: the writer advances nWriteStart before it overwrites any slots and nWriteEnd once they are complete,
+// so a reader knows which slots are complete before it copies them, and which of the copies may have been 
+// overwritten while it was copying by checking nWriteStart again afterwards. The counters are 32 bits and wrap,
+// which is harmless as long as a reader looks at the ring at least once every 2^31 samples.
+//
+// The region is named after a hash of the device name(see GetSharedMemoryName()), because some platforms only
+// allow short names, and readers check the full name in the header. When the publisher stops, it marks the 
+// stream stopped and removes the name; readers that are attached keep their mapping until they close it.
+//
+// Region layout(native byte order, since the readers are on the same computer):
+//		GSkipStreamHeader, padded to GSKIP_STREAM_HEADER_SIZE bytes
+//		nNumSlots GSkipStreamSamples. Sample number n(counting from 0 when publishing started) is in slot n % nNumSlots.
+
+#ifndef _GSKIPSTREAM_H_
+#define _GSKIPSTREAM_H_
+
+#include "GTypes.h"
+#include "GSkipRecorder.h"
+#include "GMBLSensor.h"
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+#define GSKIP_STREAM_SIGNATURE "GOIOSHM1"
+#define GSKIP_STREAM_VERSION 1
+#define GSKIP_STREAM_HEADER_SIZE 4096
+#define GSKIP_STREAM_MAX_DEVICE_NAME 256
+#define GSKIP_STREAM_DEFAULT_SLOTS 65536
+#define GSKIP_STREAM_MAX_SLOTS 0x1000000
+
+enum ESkipStreamState
+{
+	kSkipStreamState_Publishing = 1,
+	kSkipStreamState_Stopped
+};
+
+struct GSkipStreamSample
+{
+	unsigned long long	sampleIndex;//counts measurement slots from 0 when publishing started, including lost ones.
+	unsigned long long	timeUs;//GUtils::OSGetTimeStampMicroseconds() when the packet holding the measurement arrived.
+	real				fCalibrated;//calibrated with the sensor's DDS record.
+	int					nRawMeasurement;
+	float				fVolts;
+};
+
+struct GSkipStreamHeader
+{
+	char				signature[8];//GSKIP_STREAM_SIGNATURE
+	unsigned int		nVersion;
+	unsigned int		nHeaderSize;//offset of the first slot.
+	unsigned int		nSampleSize;//sizeof(GSkipStreamSample)
+	unsigned int		nMetadataSize;//sizeof(GSkipRecordingMetadata)
+	unsigned int		nNumSlots;//a power of 2.
+	volatile unsigned int nState;//ESkipStreamState
+	volatile unsigned int nWriteStart;//# of samples that have been started, slots below nWriteStart - nNumSlots are gone.
+	volatile unsigned int nWriteEnd;//# of samples that are complete.
+	volatile unsigned int nMetadataSeq;//seqlock for metadata: odd while the metadata is being changed.
+	volatile unsigned int nRingFull;//set once nWriteStart has reached nNumSlots.
+	unsigned long long	startTimeUs;//GUtils::OSGetTimeStampMicroseconds() when publishing started.
+	char				deviceName[GSKIP_STREAM_MAX_DEVICE_NAME];
+	GSkipRecordingMetadata metadata;//firstSampleIndex is the sample index that the current period applies from.
+	unsigned int		nPublisherPid;//GUtils::OSGetProcessId() of the publisher, to spot a region left behind by a crash.
+};
+
+class GSkipStreamPublisher
+{
+public:
+	// Create the shared memory for sDeviceName with room for nNumSlots samples(rounded up to a power of 2),
+	// replacing any region that a publisher which crashed left behind. Fails if the publisher of an existing region
+	// is still running. Returns NULL on failure.
+	static GSkipStreamPublisher *	Create(const cppstring &sDeviceName, const GSkipRecordingMetadata &metadata, 
+							int nNumSlots = GSKIP_STREAM_DEFAULT_SLOTS);
+						~GSkipStreamPublisher();//Marks the stream stopped and removes its name.
+
+	// Calls must be serialized with each other and with the destructor(the device uses its callback mutex).
+	void				AddMeasurements(const int *pMeasurements, int nNumMeasurements, int nNumMissing);
+	void				SetMeasurementPeriod(real fPeriodInSeconds);
+
+	unsigned long long	GetNumPublished(void) { return m_nNumPublished; }
+	int					GetNumSlots(void) { return (int) m_pHeader->nNumSlots; }
+
+	static cppstring	GetSharedMemoryName(const cppstring &sDeviceName);
+
+private:
+						GSkipStreamPublisher(unsigned char *pData, unsigned long long nNumBytes, void *pMapping,
+							const cppstring &sShmName, const GSkipRecordingMetadata &metadata);
+
+	unsigned char		*m_pData;
+	unsigned long long	m_nNumBytes;
+	void				*m_pMapping;
+	cppstring			m_sShmName;
+	GSkipStreamHeader	*m_pHeader;
+	GSkipStreamSample	*m_pSlots;
+	GMBLSensor			m_calibrationSensor;//only used to calibrate.
+	real				m_fVoltsPerBit;
+	real				m_fVoltsOffset;
+	unsigned long long	m_nextSampleIndex;
+	unsigned long long	m_nNumPublished;
+};
+
+class GSkipStreamReader
+{
+public:
+						GSkipStreamReader();
+						~GSkipStreamReader();
+
+	// Attach to the stream published for sDeviceName. The cursor starts at the newest sample, or at the oldest one
+	// still in the ring if bFromOldest is set. Returns false if nothing is being published for the device.
+	bool				Open(const cppstring &sDeviceName, bool bFromOldest = false);
+	void				Close(void);
+	bool				IsOpen(void) { return (NULL != m_pHeader); }
+
+	// False once the publisher has stopped. Samples that were published before it stopped may still be read.
+	bool				IsPublishing(void);
+	bool				GetMetadata(GSkipRecordingMetadata *pMetadata);//consistent copy, false if not open.
+	unsigned long long	GetStartTimeUs(void) { return m_pHeader ? m_pHeader->startTimeUs : 0; }
+	int					GetNumSlots(void) { return (int) m_nNumSlots; }
+
+	int					GetNumAvailable(void);//# of samples after the cursor, at most a ring's worth.
+	bool				GetNewest(GSkipStreamSample *pSample);//does not move the cursor, false if nothing was published yet.
+	void				SkipToNewest(void);//move the cursor past everything published so far.
+	unsigned long long	GetNumLost(void) { return m_nNumLost; }//samples overwritten before this reader got to them.
+
+	// Copy up to nMaxSamples samples from the cursor and advance the cursor past them. Returns the # copied.
+	int					Read(GSkipStreamSample *pSamples, int nMaxSamples);
+
+	// Zero copy alternative to Read(): point (*ppSamples) at up to nMaxSamples contiguous samples in the ring, from 
+	// the cursor on, without moving the cursor. Returns the # of samples. Once the caller is done with them, it must
+	// call Consume() with the # it used, which advances the cursor. The writer may overwrite the oldest of them in the
+	// meantime, so Consume() returns the # of samples, counting from the first one, that the caller must discard
+	// whatever it got from. Those are counted as lost.
+	int					Peek(const GSkipStreamSample **ppSamples, int nMaxSamples);
+	int					Consume(int nNumSamples);
+
+private:
+	unsigned int		CatchUp(void);//skips any samples that have been overwritten, returns nWriteEnd.
+	int					CountOverwritten(int nNumSamples);//# of the nNumSamples samples at the cursor that are gone.
+
+	const unsigned char	*m_pData;
+	unsigned long long	m_nNumBytes;
+	void				*m_pMapping;
+	const GSkipStreamHeader	*m_pHeader;
+	const GSkipStreamSample	*m_pSlots;
+	unsigned int		m_nNumSlots;
+	unsigned int		m_nReadPos;
+	unsigned long long	m_nNumLost;
+};
+
+#ifdef LIB_NAMESPACE
+}
+#endif
+
+#endif // _GSKIPSTREAM_H_
@@ -0,0 +1,78 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipVirtualDevice.cpp
+
+#include "stdafx.h"
+#include "GSkipVirtualDevice.h"
+#include "GSkipSimulator.h"
+#include "GSkipPacketReplay.h"
+
+#ifdef _DEBUG
+#include "GPlatformDebug.h" // for DEBUG_NEW definition
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+GSkipVirtualDevice *GSkipVirtualDevice::CreateVirtualDevice(
+	const cppstring &sDeviceName,
+	GSkipVirtualDevicePacketSinkPtr pCmdRespSink,
+	GSkipVirtualDevicePacketSinkPtr pMeasurementSink,
+	void *pSinkContext)
+{
+	GSkipVirtualDevice *pDevice = NULL;
+	if (GSkipSimulator::IsSimulatedDeviceName(sDeviceName))
+		pDevice = GSkipSimulator::CreateSimulator(sDeviceName, pCmdRespSink, pMeasurementSink, pSinkContext);
+	else
+	if (GSkipPacketReplay::IsReplayDeviceName(sDeviceName))
+		pDevice = GSkipPacketReplay::CreateReplay(sDeviceName, pCmdRespSink, pMeasurementSink, pSinkContext);
+
+	return pDevice;
+}
+
+bool GSkipVirtualDevice::IsVirtualDeviceName(const cppstring &sDeviceName)
+{
+	return (GSkipSimulator::IsSimulatedDeviceName(sDeviceName) || GSkipPacketReplay::IsReplayDeviceName(sDeviceName));
+}
+
+StringVector GSkipVirtualDevice::GetAvailableDevices(int nVendorID, int nProductID)
+{
+	StringVector vPortNames = GSkipSimulator::GetAvailableDevices(nVendorID, nProductID);
+	StringVector vReplayPortNames = GSkipPacketReplay::GetAvailableDevices(nVendorID, nProductID);
+	vPortNames.insert(vPortNames.end(), vReplayPortNames.begin(), vReplayPortNames.end());
+
+	return vPortNames;
+}
+
+#ifdef LIB_NAMESPACE
+}
+#endif
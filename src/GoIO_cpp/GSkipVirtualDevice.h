@@ -0,0 +1,71 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GSkipVirtualDevice.h
+//
+// GSkipVirtualDevice is the interface shared by the in-process packet sources that can stand in for a
+// USB device: the simulator(GSkipSimulator.h) and the capture replayer(GSkipPacketReplay.h).
+// Command packets go in through WriteCmdPacket(), and command response and measurement packets come back
+// out through sink functions supplied by the platform layer, exactly as if they had been read from the
+// USB interrupt pipe.
+
+#ifndef _GSKIPVIRTUALDEVICE_H_
+#define _GSKIPVIRTUALDEVICE_H_
+
+#include "GTypes.h"
+#include "GSkipComm.h"
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+typedef void (*GSkipVirtualDevicePacketSinkPtr)(void *pContext, GSkipPacket *pPacket);
+
+class GSkipVirtualDevice
+{
+public:
+	virtual				~GSkipVirtualDevice() {}
+
+	// Handle one command packet. Response packets may be delivered through the cmd response sink before this returns.
+	virtual void		WriteCmdPacket(const GSkipPacket *pPacket) = 0;
+
+	// Deliver any packets that have come due since the last call. Called from the listener thread.
+	virtual void		Pump(void) = 0;
+
+	// Create the virtual device named by sDeviceName, or return NULL if it does not name one.
+	static GSkipVirtualDevice *	CreateVirtualDevice(const cppstring &sDeviceName,
+							GSkipVirtualDevicePacketSinkPtr pCmdRespSink, GSkipVirtualDevicePacketSinkPtr pMeasurementSink, void *pSinkContext);
+	static bool			IsVirtualDeviceName(const cppstring &sDeviceName);
+	static StringVector	GetAvailableDevices(int nVendorID, int nProductID);
+};
+
+#ifdef LIB_NAMESPACE
+}
+#endif
+
+#endif // _GSKIPVIRTUALDEVICE_H_
@@ -0,0 +1,231 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GThreadPool.cpp
+
+#include "stdafx.h"
+#include "GThreadPool.h"
+
+#ifdef _DEBUG
+#include "GPlatformDebug.h" // for DEBUG_NEW definition
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+//The mutex is created before main() runs, so that GetSharedPool() can create the pool safely from any thread.
+struct GSharedThreadPool
+{
+	GSharedThreadPool()
+	{
+		pMutex = GThread::OSCreateMutex(GSTD_S(""));
+		pPool = NULL;
+	}
+	OSMutex				pMutex;
+	GThreadPool *		pPool;//Never deleted: the pool threads may be busy when the process exits.
+};
+static GSharedThreadPool sharedThreadPool;
+
+GThreadPool::GThreadPool(int nNumThreads)
+{
+	m_pWorkSemaphore = GThread::OSCreateSemaphore();
+	m_pDoneEvent = GThread::OSCreateEvent();
+	m_pRunMutex = GThread::OSCreateMutex(GSTD_S(""));
+	m_pItemMutex = GThread::OSCreateMutex(GSTD_S(""));
+	m_bStopWorkers = false;
+	m_pItemFunc = NULL;
+	m_pContext = NULL;
+	m_nNumItems = 0;
+	m_nNextItem = 0;
+	m_nNumItemsDone = 0;
+
+	if (m_pWorkSemaphore && m_pDoneEvent && m_pRunMutex && m_pItemMutex)
+	{
+		for (int i = 0; i < nNumThreads; i++)
+		{
+			GLiteThread *pThread = new GLiteThread((StdThreadFunctionPtr) WorkerThreadFunc, 
+				(StdThreadFunctionPtr) StopWorkerThreadFunc, this);
+			if (!pThread->OSStartThread())
+			{
+				delete pThread;
+				break;
+			}
+			m_threads.push_back(pThread);
+		}
+	}
+}
+
+GThreadPool::~GThreadPool()
+{
+	m_bStopWorkers = true;
+	for (size_t i = 0; i < m_threads.size(); i++)
+		GThread::OSSemPost(m_pWorkSemaphore);
+	for (size_t i = 0; i < m_threads.size(); i++)
+		delete m_threads[i];
+	m_threads.clear();
+
+	if (m_pWorkSemaphore)
+		GThread::OSDestroySemaphore(m_pWorkSemaphore);
+	m_pWorkSemaphore = NULL;
+	if (m_pDoneEvent)
+		GThread::OSDestroyEvent(m_pDoneEvent);
+	m_pDoneEvent = NULL;
+	if (m_pRunMutex)
+		GThread::OSDestroyMutex(m_pRunMutex);
+	m_pRunMutex = NULL;
+	if (m_pItemMutex)
+		GThread::OSDestroyMutex(m_pItemMutex);
+	m_pItemMutex = NULL;
+}
+
+GThreadPool *GThreadPool::GetSharedPool(void)
+{
+	if ((NULL == sharedThreadPool.pPool) && sharedThreadPool.pMutex && GThread::OSLockMutex(sharedThreadPool.pMutex))
+	{
+		if (NULL == sharedThreadPool.pPool)
+		{
+			int nNumThreads = GThread::OSGetNumProcessors() - 1;
+			if (nNumThreads > GTHREADPOOL_MAX_THREADS)
+				nNumThreads = GTHREADPOOL_MAX_THREADS;
+			GThreadPool *pPool = new GThreadPool(nNumThreads);
+			GThread::OSMemoryBarrier();
+			sharedThreadPool.pPool = pPool;
+		}
+		GThread::OSUnlockMutex(sharedThreadPool.pMutex);
+	}
+
+	return sharedThreadPool.pPool;
+}
+
+void GThreadPool::ParallelFor(
+	int nNumItems,					//[in]
+	GThreadPoolItemFunc pItemFunc,	//[in] must be safe to call from several threads at once.
+	void *pContext)					//[in] passed to pItemFunc unchanged.
+{
+	if ((nNumItems <= 1) || (0 == m_threads.size()) || !GThread::OSLockMutex(m_pRunMutex))
+	{
+		for (int i = 0; i < nNumItems; i++)
+			(*pItemFunc)(pContext, i);
+		return;
+	}
+
+	if (GThread::OSLockMutex(m_pItemMutex))
+	{
+		m_pItemFunc = pItemFunc;
+		m_pContext = pContext;
+		m_nNumItems = nNumItems;
+		m_nNextItem = 0;
+		m_nNumItemsDone = 0;
+		GThread::OSUnlockMutex(m_pItemMutex);
+	}
+
+	int nNumWorkers = (int) m_threads.size();
+	if (nNumWorkers > (nNumItems - 1))
+		nNumWorkers = nNumItems - 1;
+	for (int i = 0; i < nNumWorkers; i++)
+		GThread::OSSemPost(m_pWorkSemaphore);
+
+	while (RunNextItem())
+		;
+
+	bool bDone = false;
+	while (!bDone)
+	{
+		if (GThread::OSLockMutex(m_pItemMutex))
+		{
+			bDone = (m_nNumItemsDone >= m_nNumItems);
+			if (bDone)
+				m_pItemFunc = NULL;
+			GThread::OSUnlockMutex(m_pItemMutex);
+		}
+		if (!bDone)
+			GThread::OSWaitEvent(m_pDoneEvent, 100);
+	}
+
+	GThread::OSUnlockMutex(m_pRunMutex);
+}
+
+bool GThreadPool::RunNextItem(void)
+{
+	GThreadPoolItemFunc pItemFunc = NULL;
+	void *pContext = NULL;
+	int nItem = 0;
+	if (GThread::OSLockMutex(m_pItemMutex))
+	{
+		//Workers woken late for an earlier ParallelFor() find nothing to do here.
+		if (m_pItemFunc && (m_nNextItem < m_nNumItems))
+		{
+			pItemFunc = m_pItemFunc;
+			pContext = m_pContext;
+			nItem = m_nNextItem++;
+		}
+		GThread::OSUnlockMutex(m_pItemMutex);
+	}
+
+	if (NULL == pItemFunc)
+		return false;
+
+	(*pItemFunc)(pContext, nItem);
+
+	if (GThread::OSLockMutex(m_pItemMutex))
+	{
+		m_nNumItemsDone++;
+		if (m_nNumItemsDone >= m_nNumItems)
+			GThread::OSSetEvent(m_pDoneEvent);
+		GThread::OSUnlockMutex(m_pItemMutex);
+	}
+
+	return true;
+}
+
+int GThreadPool::WorkerThreadFunc(void *pParam)
+{
+	GThreadPool *pPool = (GThreadPool *) pParam;
+	while (GThread::OSSemWait(pPool->m_pWorkSemaphore) && !pPool->m_bStopWorkers)
+	{
+		while (pPool->RunNextItem())
+			;
+	}
+
+	return 0;
+}
+
+int GThreadPool::StopWorkerThreadFunc(void *pParam)
+{
+	GThreadPool *pPool = (GThreadPool *) pParam;
+	pPool->m_bStopWorkers = true;
+	GThread::OSSemPost(pPool->m_pWorkSemaphore);
+	return 0;
+}
+
+#ifdef LIB_NAMESPACE
+}
+#endif
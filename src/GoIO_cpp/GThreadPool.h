@@ -0,0 +1,90 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GThreadPool.h
+//
+// A small pool of worker threads for splitting CPU bound work into independent items, e.g. compressing or
+// decompressing the chunks of a recording. ParallelFor() hands the items out one at a time, so items may take
+// different amounts of time, and the calling thread works on items too, so it never just waits.
+
+#ifndef _GTHREADPOOL_H_
+#define _GTHREADPOOL_H_
+
+#include "GTypes.h"
+#include "GThread.h"
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+#define GTHREADPOOL_MAX_THREADS 8
+
+typedef void (*GThreadPoolItemFunc)(void *pContext, int nItem);
+
+class GThreadPool
+{
+public:
+	// nNumThreads does not include the threads that call ParallelFor(). 0 runs every item on the calling thread.
+						GThreadPool(int nNumThreads);
+						~GThreadPool();//Waits for the threads to exit.
+
+	// A pool shared by the lib, with one thread per processor besides the caller(up to GTHREADPOOL_MAX_THREADS).
+	// It is created on first use and lives until the process exits.
+	static GThreadPool *	GetSharedPool(void);
+
+	// Call pItemFunc(pContext, nItem) for nItem = 0 to nNumItems - 1, and return once every call has returned.
+	// Calls from different threads take turns.
+	void				ParallelFor(int nNumItems, GThreadPoolItemFunc pItemFunc, void *pContext);
+
+	int					GetNumThreads(void) { return (int) m_threads.size(); }
+
+private:
+	bool				RunNextItem(void);//false if no item was left to run.
+	static int			WorkerThreadFunc(void *pParam);
+	static int			StopWorkerThreadFunc(void *pParam);
+
+	std::vector<GLiteThread *> m_threads;
+	OSSemaphore			m_pWorkSemaphore;//posted once per thread that should look for items.
+	OSEvent				m_pDoneEvent;
+	OSMutex				m_pRunMutex;//held for the whole of a ParallelFor().
+	volatile bool		m_bStopWorkers;
+
+	// Protected by m_pItemMutex:
+	OSMutex				m_pItemMutex;
+	GThreadPoolItemFunc	m_pItemFunc;//NULL between ParallelFor() calls.
+	void *				m_pContext;
+	int					m_nNumItems;
+	int					m_nNextItem;
+	int					m_nNumItemsDone;
+};
+
+#ifdef LIB_NAMESPACE
+}
+#endif
+
+#endif // _GTHREADPOOL_H_
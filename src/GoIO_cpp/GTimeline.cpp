@@ -0,0 +1,270 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GTimeline.cpp
+
+#include "stdafx.h"
+#include "GTimeline.h"
+
+#include <stdio.h>
+
+#ifdef _DEBUG
+#include "GPlatformDebug.h" // for DEBUG_NEW definition
+#undef THIS_FILE
+static char THIS_FILE[] = __FILE__;
+#endif
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+#define GTIMELINE_PHASE_SPAN 'X'
+#define GTIMELINE_PHASE_COUNTER 'C'
+
+struct GTimelineEvent
+{
+	unsigned long long	timeUs;
+	const char *		pName;
+	unsigned int		nDurationUs;
+	unsigned int		nDeviceId;
+	int					nArg;//the value, for counters
+	char				phase;
+};
+
+//Only the owning thread writes to a ring.
+struct GTimelineRing
+{
+	GTimelineEvent *	pEvents;
+	int					nNumEvents;//ring size
+	volatile unsigned int	nNumRecorded;//since the timeline was started
+	unsigned int		nThreadId;
+	volatile bool		bThreadExited;
+	bool				bFree;
+};
+
+volatile bool GTimeline::m_bRunning = false;
+OSMutex GTimeline::m_pRingsMutex = NULL;
+int GTimeline::m_nEventsPerThread = GTIMELINE_DEFAULT_EVENTS_PER_THREAD;
+
+//Rings outlive their threads, so that their events can still be written out. They are reused by new threads
+//once the timeline is restarted(except on Windows, which does not tell us when threads exit).
+static std::vector<GTimelineRing *> timelineRings;
+static OSThreadLocal timelineRingKey;
+static bool bTimelineRingKeyCreated = false;
+static unsigned long long timelineStartUs = 0;
+
+static void OnTimelineThreadExit(void *pRing)
+{
+	((GTimelineRing *) pRing)->bThreadExited = true;
+}
+
+bool GTimeline::Start(
+	int nEventsPerThread)//[in] ring size for threads that record their first event after this call.
+{
+	Stop();
+
+	if (NULL == m_pRingsMutex)
+	{
+		m_pRingsMutex = GThread::OSCreateMutex(GSTD_S(""));
+		bTimelineRingKeyCreated = GThread::OSCreateThreadLocal(&timelineRingKey, OnTimelineThreadExit);
+	}
+
+	if ((NULL == m_pRingsMutex) || !bTimelineRingKeyCreated || (nEventsPerThread <= 0))
+		return false;
+
+	if (GThread::OSLockMutex(m_pRingsMutex))
+	{
+		m_nEventsPerThread = nEventsPerThread;
+		for (size_t i = 0; i < timelineRings.size(); i++)
+		{
+			timelineRings[i]->nNumRecorded = 0;
+			if (timelineRings[i]->bThreadExited)
+				timelineRings[i]->bFree = true;
+		}
+		timelineStartUs = GUtils::OSGetTimeStampMicroseconds();
+		GThread::OSUnlockMutex(m_pRingsMutex);
+	}
+
+	GThread::OSMemoryBarrier();
+	m_bRunning = true;
+	return true;
+}
+
+void GTimeline::Stop(void)
+{
+	m_bRunning = false;
+}
+
+GTimelineRing *GTimeline::GetThreadRing(void)
+{
+	GTimelineRing *pRing = (GTimelineRing *) GThread::OSGetThreadLocal(timelineRingKey);
+	if ((NULL == pRing) && GThread::OSLockMutex(m_pRingsMutex))
+	{
+		for (size_t i = 0; i < timelineRings.size(); i++)
+		{
+			if (timelineRings[i]->bFree && (timelineRings[i]->nNumEvents == m_nEventsPerThread))
+			{
+				pRing = timelineRings[i];
+				break;
+			}
+		}
+
+		if (NULL == pRing)
+		{
+			pRing = new GTimelineRing;
+			pRing->pEvents = new GTimelineEvent[m_nEventsPerThread];
+			pRing->nNumEvents = m_nEventsPerThread;
+			timelineRings.push_back(pRing);
+		}
+		pRing->nNumRecorded = 0;
+		pRing->nThreadId = GThread::OSGetCurrentThreadId();
+		pRing->bThreadExited = false;
+		pRing->bFree = false;
+
+		GThread::OSUnlockMutex(m_pRingsMutex);
+
+		GThread::OSSetThreadLocal(timelineRingKey, pRing);
+	}
+
+	return pRing;
+}
+
+void GTimeline::RecordSpan(
+	const char *pName,				//[in] string literal
+	unsigned long long startUs,		//[in] GUtils::OSGetTimeStampMicroseconds() when the span started
+	unsigned int nDeviceId,			//[in] 0 if the span does not relate to one device
+	int nArg)						//[in]
+{
+	GTimelineRing *pRing = GetThreadRing();
+	if (pRing)
+	{
+		unsigned int nIndex = pRing->nNumRecorded;
+		GTimelineEvent *pEvent = &pRing->pEvents[nIndex % pRing->nNumEvents];
+		pEvent->timeUs = startUs;
+		pEvent->pName = pName;
+		pEvent->nDurationUs = (unsigned int) (GUtils::OSGetTimeStampMicroseconds() - startUs);
+		pEvent->nDeviceId = nDeviceId;
+		pEvent->nArg = nArg;
+		pEvent->phase = GTIMELINE_PHASE_SPAN;
+		pRing->nNumRecorded = nIndex + 1;
+	}
+}
+
+void GTimeline::RecordCounter(
+	const char *pName,				//[in] string literal
+	unsigned int nDeviceId,			//[in] 0 if the counter does not relate to one device
+	int nValue)						//[in]
+{
+	GTimelineRing *pRing = GetThreadRing();
+	if (pRing)
+	{
+		unsigned int nIndex = pRing->nNumRecorded;
+		GTimelineEvent *pEvent = &pRing->pEvents[nIndex % pRing->nNumEvents];
+		pEvent->timeUs = GUtils::OSGetTimeStampMicroseconds();
+		pEvent->pName = pName;
+		pEvent->nDurationUs = 0;
+		pEvent->nDeviceId = nDeviceId;
+		pEvent->nArg = nValue;
+		pEvent->phase = GTIMELINE_PHASE_COUNTER;
+		pRing->nNumRecorded = nIndex + 1;
+	}
+}
+
+bool GTimeline::WriteChromeTrace(const cppstring &sFileName)
+{
+	if (NULL == m_pRingsMutex)
+		return false;
+
+	FILE *pFile = fopen(sFileName.c_str(), "w");
+	if (NULL == pFile)
+	{
+		cppsstream ss;
+		ss << GSTD_S("GTimeline::WriteChromeTrace() could not create '") << sFileName << GSTD_S("'.");
+		GSTD_TRACE(ss.str());
+		return false;
+	}
+
+	bool bResult = false;
+	if (GThread::OSLockMutex(m_pRingsMutex))
+	{
+		bool bRunning = m_bRunning;
+		const char *pSeparator = "";
+		fprintf(pFile, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+		for (size_t i = 0; i < timelineRings.size(); i++)
+		{
+			GTimelineRing *pRing = timelineRings[i];
+			if (pRing->bFree)
+				continue;
+
+			unsigned int nNumRecorded = pRing->nNumRecorded;
+			GThread::OSMemoryBarrier();
+			unsigned int nFirst = 0;
+			if (nNumRecorded > (unsigned int) pRing->nNumEvents)
+			{
+				nFirst = nNumRecorded - pRing->nNumEvents;
+				if (bRunning)
+					nFirst += pRing->nNumEvents/8;//The owner may be overwriting these.
+			}
+
+			fprintf(pFile, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"GoIO thread %u\"}}", 
+				pSeparator, pRing->nThreadId, pRing->nThreadId);
+			pSeparator = ",";
+
+			for (unsigned int nIndex = nFirst; nIndex < nNumRecorded; nIndex++)
+			{
+				const GTimelineEvent *pEvent = &pRing->pEvents[nIndex % pRing->nNumEvents];
+				if (pEvent->timeUs < timelineStartUs)
+					continue;//recorded as the timeline was being restarted.
+				double ts = (double) (pEvent->timeUs - timelineStartUs);
+				if (GTIMELINE_PHASE_SPAN == pEvent->phase)
+					fprintf(pFile, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.0f,\"dur\":%u,\"args\":{\"device\":%u,\"arg\":%d}}",
+						pEvent->pName, pRing->nThreadId, ts, pEvent->nDurationUs, pEvent->nDeviceId, pEvent->nArg);
+				else
+				if (0 == pEvent->nDeviceId)
+					fprintf(pFile, ",\n{\"name\":\"%s\",\"ph\":\"C\",\"pid\":1,\"tid\":%u,\"ts\":%.0f,\"args\":{\"value\":%d}}",
+						pEvent->pName, pRing->nThreadId, ts, pEvent->nArg);
+				else
+					fprintf(pFile, ",\n{\"name\":\"%s %u\",\"ph\":\"C\",\"pid\":1,\"tid\":%u,\"ts\":%.0f,\"args\":{\"value\":%d}}",
+						pEvent->pName, pEvent->nDeviceId, pRing->nThreadId, ts, pEvent->nArg);
+			}
+		}
+		fprintf(pFile, "\n]}\n");
+		bResult = (0 == ferror(pFile));
+
+		GThread::OSUnlockMutex(m_pRingsMutex);
+	}
+
+	if (0 != fclose(pFile))
+		bResult = false;
+
+	return bResult;
+}
+
+#ifdef LIB_NAMESPACE
+}
+#endif
@@ -0,0 +1,124 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GTimeline.h
+//
+// GTimeline is an optional flight recorder for tuning acquisition: spans(a named piece of work with a start
+// time and duration) and counters(e.g. queue depths) are recorded into an in-memory ring per thread, and can be
+// written out in the Chrome trace event JSON format, which chrome://tracing and https://ui.perfetto.dev display
+// as one timeline with a track per thread.
+//
+// Recording costs a test of one flag when the timeline is not running. Each ring keeps the most recent events
+// recorded by its thread; older ones are overwritten. Event names must be string literals(or otherwise live for
+// the life of the process), because only the pointer is stored.
+//
+// Events may carry the id of the device they relate to(see GSkipBaseDevice::GetTimelineId()), and one integer arg.
+
+#ifndef _GTIMELINE_H_
+#define _GTIMELINE_H_
+
+#include "GTypes.h"
+#include "GThread.h"
+#include "GUtils.h"
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+#define GTIMELINE_DEFAULT_EVENTS_PER_THREAD 16384
+
+struct GTimelineRing;
+
+class GTimeline
+{
+public:
+	// Start recording. nEventsPerThread sets the ring size for threads that record their first event after this call.
+	// Events recorded before a previous Stop() are discarded.
+	static bool			Start(int nEventsPerThread = GTIMELINE_DEFAULT_EVENTS_PER_THREAD);
+	static void			Stop(void);
+	static bool			IsRunning(void) { return m_bRunning; }
+
+	// Write the recorded events to sFileName as Chrome trace event JSON. This may be called while the timeline is
+	// running, but the oldest events in each ring may then be overwritten while they are being written out, so
+	// those are skipped.
+	static bool			WriteChromeTrace(const cppstring &sFileName);
+
+	// Use the GSTD_TIMELINE_*() macros rather than calling these directly.
+	static void			RecordSpan(const char *pName, unsigned long long startUs, unsigned int nDeviceId, int nArg);
+	static void			RecordCounter(const char *pName, unsigned int nDeviceId, int nValue);
+
+	// The timeline's own mutex must not record lock waits.
+	static bool			IsTimelineMutex(OSMutex pOSMutex) { return pOSMutex == m_pRingsMutex; }
+
+	static volatile bool	m_bRunning;
+
+private:
+	static GTimelineRing *	GetThreadRing(void);
+
+	static OSMutex		m_pRingsMutex;
+	static int			m_nEventsPerThread;
+};
+
+// Records a span from construction to destruction.
+class GTimelineSpan
+{
+public:
+	GTimelineSpan(const char *pName, unsigned int nDeviceId = 0, int nArg = 0)
+	{
+		m_pName = NULL;
+		if (GTimeline::m_bRunning)
+		{
+			m_pName = pName;
+			m_nDeviceId = nDeviceId;
+			m_nArg = nArg;
+			m_startUs = GUtils::OSGetTimeStampMicroseconds();
+		}
+	}
+	~GTimelineSpan()
+	{
+		if (m_pName)
+			GTimeline::RecordSpan(m_pName, m_startUs, m_nDeviceId, m_nArg);
+	}
+	void				SetArg(int nArg) { m_nArg = nArg; }
+
+private:
+	const char *		m_pName;
+	unsigned int		m_nDeviceId;
+	int					m_nArg;
+	unsigned long long	m_startUs;
+};
+
+// Record a span covering the rest of the enclosing scope. Only one per scope.
+#define GSTD_TIMELINE_SPAN(name, deviceId, arg) GTimelineSpan timelineSpan((name), (deviceId), (arg))
+#define GSTD_TIMELINE_COUNTER(name, deviceId, value) if (GTimeline::m_bRunning) GTimeline::RecordCounter((name), (deviceId), (value))
+
+#ifdef LIB_NAMESPACE
+}
+#endif
+
+#endif // _GTIMELINE_H_
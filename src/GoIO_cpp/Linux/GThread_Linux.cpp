@@ -1,325 +1,648 @@
-/*********************************************************************************
-
-Copyright (c) 2010, Vernier Software & Technology
-All rights reserved.
-
-Redistribution and use in source and binary forms, with or without
-modification, are permitted provided that the following conditions are met:
-    * Redistributions of source code must retain the above copyright
-      notice, this list of conditions and the following disclaimer.
-    * Redistributions in binary form must reproduce the above copyright
-      notice, this list of conditions and the following disclaimer in the
-      documentation and/or other materials provided with the distribution.
-    * Neither the name of Vernier Software & Technology nor the
-      names of its contributors may be used to endorse or promote products
-      derived from this software without specific prior written permission.
-
-THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
-ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
-WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
-DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
-(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
-LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
-ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
-(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-**********************************************************************************/
-// GThread_Linux.cpp
-
-#include "GThread.h"
-#include "GUtils.h"
-#include <stdio.h>
-#include <stdlib.h>
-#include <pthread.h>
-#include <semaphore.h>
-#include <signal.h>
-
-#ifdef LIB_NAMESPACE
-namespace LIB_NAMESPACE {
-#endif
-
-static int g_NGIO_IOAbortSignalId = 0;
-
-static void *start_thread(void *thread)
-{
-	GThread::Main(thread);
-
-	pthread_exit (NULL);
-}
-
-bool GThread::OSStartThread(EThreadPriority /* priority = kThreadPriority_Normal */)
-{
-	bool bResult = false;
-	m_pThreadRef = (OSThreadReference) new pthread_t();
-
-	if (pthread_create((pthread_t *)m_pThreadRef, NULL, start_thread, (void*)this)==0)
-		bResult = true;
-	else
-	{
-		delete (pthread_t *) m_pThreadRef;
-		m_pThreadRef = NULL;
-	}
-
-	return bResult;
-}
-
-void GThread::OSStopThread(void)
-{
-	if (m_pThreadRef)
-	{
-		m_bKillThread = true;
-		while (IsThreadAlive())	// spin until thread exits
-			GUtils::OSSleep(10);	// Give main process a chance to execute
-
-		pthread_join(*((pthread_t *) m_pThreadRef), NULL);//Clean up.
-		delete (pthread_t *) m_pThreadRef;
-		m_pThreadRef = NULL;
-	}
-}
-
-OSMutex GThread::OSCreateMutex(const cppstring &/*sMutexName*/)
-{
-	pthread_mutex_t  *mutex;
-	mutex = (pthread_mutex_t*)malloc(sizeof(*mutex));
-	pthread_mutexattr_t   mta;
-	pthread_mutexattr_init(&mta);
-	pthread_mutexattr_settype(&mta,PTHREAD_MUTEX_RECURSIVE);
-
-	if (mutex)
-	{
-		if(pthread_mutex_init(mutex,&mta)!=0)
-		{
-			GSTD_TRACE(GSTD_S("Trouble in paradise"));
-			free(mutex);
-			mutex = NULL;
-		}
-		else
-		{
-#ifdef _NGIO_LOGGING_ENABLED_
-			char tmpstring[100];//spam
-			sprintf(tmpstring, "Creating mutex %p on thread %p in NGIO_lib.", mutex, pthread_self());
-			GSTD_TRACE(tmpstring);
-#endif
-		}
-	}
-	return (OSMutex)mutex;
-}
-
-bool GThread::OSLockMutex(OSMutex pOSMutex)
-{
-	bool bResult = false;
-
-   	if (pthread_mutex_lock((pthread_mutex_t*)pOSMutex)==0)
-	{
-		bResult = true;
-		//	printf("Locked mutext: %d\n",pOSMutex);
-	}		
-
-	return bResult;
-}
-
-bool GThread::OSTryLockMutex(OSMutex pOSMutex, int nTimeoutMS)
-{
-	bool bResult = false;
-
-	unsigned int sleepDurationMs = 2;
-	unsigned int maxNumAttempts = (nTimeoutMS + 1)/sleepDurationMs;
-	unsigned int numAttempts = 0;
-	if (maxNumAttempts < 1)
-		maxNumAttempts = 1;
-
-	while ((!bResult) && (numAttempts < maxNumAttempts))
-	{
-		if (pthread_mutex_trylock((pthread_mutex_t*)pOSMutex)==0)
-			bResult = true;
-		else
-		{
-			numAttempts++;
-			if (maxNumAttempts != 1)
-				GUtils::OSSleep(sleepDurationMs);//We need a better solution - polling is bogus and unreliable. spam0
-		}
-	}
-	if (!bResult)
-	{
-		char tmpstring[100];//spam
-		sprintf(tmpstring, "Trying to lock mutex %p on thread %p in IO_lib failed", pOSMutex, pthread_self());
-		GSTD_TRACE(tmpstring);
-	}
-
-	return bResult;
-}
-
-bool GThread::OSUnlockMutex(OSMutex pOSMutex)
-{
-   	return (pthread_mutex_unlock((pthread_mutex_t*) pOSMutex) == 0);
-}
-
-void GThread::OSDestroyMutex(OSMutex pOSMutex)
-{
-	pthread_mutex_destroy((pthread_mutex_t*)pOSMutex);
-	free(pOSMutex);
-}
-
-void GThread::OSYield(void)
-{
-	pthread_yield();
-}
-
-void GThread::OSProcessEvents(void)
-{
-}
-
-void GThread::OSSetPriority(EThreadPriority /* ePriority */)
-{
-}
-
-EThreadPriority GThread::OSGetPriority(void)
-{
-	return kThreadPriority_Normal;
-}
-
-void GThread::OSSetCurrentThreadPriority(EThreadPriority /* priority */)
-{
-}
-
-EThreadPriority GThread::OSGetCurrentThreadPriority(void)
-{
-	return kThreadPriority_Normal;
-}
-
-OSSemaphore GThread::OSCreateSemaphore(void)
-{
-	sem_t *sem;
-	sem = (sem_t *) malloc(sizeof(*sem));
-
-	if (sem)
-	{
-		if (sem_init(sem, 0, 0) != 0)
-		{
-			GSTD_TRACE(GSTD_S("Trouble in paradise"));
-			free(sem);
-			sem = NULL;
-		}
-	}
-	return (OSSemaphore) sem;
-}
-
-void GThread::OSDestroySemaphore(OSSemaphore pSemaphore)
-{
-	sem_destroy((sem_t *) pSemaphore);
-	free(pSemaphore);
-}
-
-bool GThread::OSSemPost(OSSemaphore pSemaphore)
-{
-	return (0 == sem_post((sem_t *) pSemaphore));
-}
-
-bool GThread::OSSemWait(OSSemaphore pSemaphore)
-{
-	return (0 == sem_wait((sem_t *) pSemaphore));
-}
-
-static void *start_lite_thread(void *thread)
-{
-	GLiteThread::Main(thread);
-
-	pthread_exit (NULL);
-}
-
-bool GLiteThread::OSStartThread(EThreadPriority priority /* = kThreadPriority_Normal */)
-{
-	bool bResult = false;
-	m_pThreadRef = (OSThreadReference) new pthread_t();
-
-	if (pthread_create((pthread_t *)m_pThreadRef, NULL, start_lite_thread, (void*)this)==0)
-		bResult = true;
-	else
-	{
-		delete (pthread_t *) m_pThreadRef;
-		m_pThreadRef = NULL;
-	}
-
-	return bResult;
-}
-
-void GLiteThread::OSStopThread(void)
-{
-	if (m_pThreadRef)
-	{
-		if (m_pStopFunction)
-			m_pStopFunction(m_pThreadParam);
-
-		while (IsThreadAlive())	// spin until thread exits
-			GUtils::OSSleep(10);	// Give main process a chance to execute
-
-		pthread_join(*((pthread_t *) m_pThreadRef), NULL);//Clean up.
-		delete (pthread_t *) m_pThreadRef;
-		m_pThreadRef = NULL;
-	}
-}
-
-void GLiteThread::OSSetPriority(EThreadPriority /* ePriority */)
-{
-}
-
-EThreadPriority GLiteThread::OSGetPriority(void)
-{
-	return kThreadPriority_Normal;
-}
-
-static void abort_signal_handler(int status)
-{
-}
-
-//Register a handler for the specified IO abort signal. We issue this signal to cancel pending IO operations during
-//device shutdown.
-int NGIO_RegisterIOAbortSignalHandler(int signalNum)
-{
-	int result = 0;
-	if (signalNum <= 0)
-		result = -1;
-	else if (0 == g_NGIO_IOAbortSignalId)
-	{
-		struct sigaction saio;
-		saio.sa_handler = abort_signal_handler;
-		sigemptyset(&saio.sa_mask);   //saio.sa_mask = 0;
-		saio.sa_flags = 0;
-		saio.sa_restorer = NULL;
-
-		result = sigaction(signalNum, &saio, NULL);
-		if (0 == result)
-			g_NGIO_IOAbortSignalId = signalNum;
-		else
-			GSTD_TRACE(GSTD_S("Register IO Abort sigaction() failed"));
-
-	}
-
-	return result;
-}
-
-int NGIO_DeregisterIOAbortSignalHandler()
-{
-	if (g_NGIO_IOAbortSignalId != 0)
-	{
-		struct sigaction saio;
-		saio.sa_handler = SIG_DFL;
-		sigemptyset(&saio.sa_mask);   //saio.sa_mask = 0;
-		saio.sa_flags = 0;
-		saio.sa_restorer = NULL;
-
-		int status = sigaction(g_NGIO_IOAbortSignalId, &saio, NULL);
-		if (0 != status)
-			GSTD_TRACE(GSTD_S("Deregister IO Abort sigaction() failed"));
-
-		g_NGIO_IOAbortSignalId = 0;
-	}
-
-	return 0;
-}
-
-#ifdef LIB_NAMESPACE
-}
-#endif
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GThread_Linux.cpp
+
+#include "GThread.h"
+#include "GUtils.h"
+#include "GTimeline.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/eventfd.h>
+#include <time.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/syscall.h>
+#include <sys/resource.h>
+#include <sched.h>
+#include <errno.h>
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+static int g_NGIO_IOAbortSignalId = 0;
+
+static void *start_thread(void *thread)
+{
+	GThread::Main(thread);
+
+	pthread_exit (NULL);
+}
+
+bool GThread::OSStartThread(EThreadPriority priority /* = kThreadPriority_Normal */)
+{
+	bool bResult = false;
+	m_eStartPriority = priority;//Main() applies this, because nice levels can only be set once we know the thread's id.
+	m_pThreadRef = (OSThreadReference) new pthread_t();
+
+	if (pthread_create((pthread_t *)m_pThreadRef, NULL, start_thread, (void*)this)==0)
+		bResult = true;
+	else
+	{
+		delete (pthread_t *) m_pThreadRef;
+		m_pThreadRef = NULL;
+	}
+
+	return bResult;
+}
+
+void GThread::OSStopThread(void)
+{
+	if (m_pThreadRef)
+	{
+		m_bKillThread = true;
+		while (IsThreadAlive())	// spin until thread exits
+			GUtils::OSSleep(10);	// Give main process a chance to execute
+
+		pthread_join(*((pthread_t *) m_pThreadRef), NULL);//Clean up.
+		delete (pthread_t *) m_pThreadRef;
+		m_pThreadRef = NULL;
+	}
+}
+
+OSMutex GThread::OSCreateMutex(const cppstring &/*sMutexName*/)
+{
+	pthread_mutex_t  *mutex;
+	mutex = (pthread_mutex_t*)malloc(sizeof(*mutex));
+	pthread_mutexattr_t   mta;
+	pthread_mutexattr_init(&mta);
+	pthread_mutexattr_settype(&mta,PTHREAD_MUTEX_RECURSIVE);
+
+	if (mutex)
+	{
+		if(pthread_mutex_init(mutex,&mta)!=0)
+		{
+			GSTD_TRACE(GSTD_S("Trouble in paradise"));
+			free(mutex);
+			mutex = NULL;
+		}
+		else
+		{
+#ifdef _NGIO_LOGGING_ENABLED_
+			char tmpstring[100];//spam
+			sprintf(tmpstring, "Creating mutex %p on thread %p in NGIO_lib.", mutex, pthread_self());
+			GSTD_TRACE(tmpstring);
+#endif
+		}
+	}
+	return (OSMutex)mutex;
+}
+
+OSMutex GThread::OSCreatePriorityInheritMutex(const cppstring &/*sMutexName*/)
+{
+	pthread_mutex_t *mutex = (pthread_mutex_t*)malloc(sizeof(*mutex));
+	pthread_mutexattr_t mta;
+	pthread_mutexattr_init(&mta);
+	pthread_mutexattr_settype(&mta,PTHREAD_MUTEX_RECURSIVE);
+
+	if (mutex)
+	{
+		if ((pthread_mutexattr_setprotocol(&mta, PTHREAD_PRIO_INHERIT) != 0) || (pthread_mutex_init(mutex,&mta) != 0))
+		{
+			free(mutex);
+			mutex = NULL;
+		}
+	}
+	pthread_mutexattr_destroy(&mta);
+	return (OSMutex)mutex;
+}
+
+bool GThread::OSLockMutex(OSMutex pOSMutex)
+{
+	bool bResult = false;
+
+	if (GTimeline::m_bRunning && !GTimeline::IsTimelineMutex(pOSMutex))
+	{
+		//Only record a span if we actually have to wait.
+		if (pthread_mutex_trylock((pthread_mutex_t*)pOSMutex)==0)
+			return true;
+		GSTD_TIMELINE_SPAN("lock wait", 0, 0);
+		return (pthread_mutex_lock((pthread_mutex_t*)pOSMutex)==0);
+	}
+
+   	if (pthread_mutex_lock((pthread_mutex_t*)pOSMutex)==0)
+	{
+		bResult = true;
+		//	printf("Locked mutext: %d\n",pOSMutex);
+	}		
+
+	return bResult;
+}
+
+bool GThread::OSTryLockMutex(OSMutex pOSMutex, int nTimeoutMS)
+{
+	bool bResult = false;
+
+	unsigned int sleepDurationMs = 2;
+	unsigned int maxNumAttempts = (nTimeoutMS + 1)/sleepDurationMs;
+	unsigned int numAttempts = 0;
+	if (maxNumAttempts < 1)
+		maxNumAttempts = 1;
+
+	unsigned long long waitStartUs = 0;
+	while ((!bResult) && (numAttempts < maxNumAttempts))
+	{
+		if (pthread_mutex_trylock((pthread_mutex_t*)pOSMutex)==0)
+			bResult = true;
+		else
+		{
+			if ((0 == numAttempts) && GTimeline::m_bRunning)
+				waitStartUs = GUtils::OSGetTimeStampMicroseconds();
+			numAttempts++;
+			if (maxNumAttempts != 1)
+				GUtils::OSSleep(sleepDurationMs);//We need a better solution - polling is bogus and unreliable. spam0
+		}
+	}
+	if (waitStartUs && !GTimeline::IsTimelineMutex(pOSMutex))
+		GTimeline::RecordSpan("lock wait", waitStartUs, 0, bResult ? 0 : 1);
+	if (!bResult)
+	{
+		char tmpstring[100];//spam
+		sprintf(tmpstring, "Trying to lock mutex %p on thread %p in IO_lib failed", pOSMutex, pthread_self());
+		GSTD_TRACE(tmpstring);
+	}
+
+	return bResult;
+}
+
+bool GThread::OSUnlockMutex(OSMutex pOSMutex)
+{
+   	return (pthread_mutex_unlock((pthread_mutex_t*) pOSMutex) == 0);
+}
+
+void GThread::OSDestroyMutex(OSMutex pOSMutex)
+{
+	pthread_mutex_destroy((pthread_mutex_t*)pOSMutex);
+	free(pOSMutex);
+}
+
+void GThread::OSYield(void)
+{
+	pthread_yield();
+}
+
+void GThread::OSProcessEvents(void)
+{
+}
+
+//Linux schedules each thread separately, so the nice level and policy of a thread are set via its id.
+//kThreadPriority_High and kThreadPriority_TimeCritical use SCHED_FIFO when the process is allowed to(root, CAP_SYS_NICE
+//or a nonzero RLIMIT_RTPRIO), otherwise they fall back to nice levels. Raising the nice level of a thread is always
+//allowed, but lowering it below 0 needs CAP_SYS_NICE or RLIMIT_NICE, so without them the thread gets as close to the
+//requested nice level as RLIMIT_NICE allows.
+static const int kNiceLevels[] = { 5, 0, -5, -10, -15 };//indexed by EThreadPriority
+#define FIFO_PRIORITY_HIGH 10
+#define FIFO_PRIORITY_TIME_CRITICAL 20
+
+static bool LSetThreadPriority(pid_t tid, EThreadPriority ePriority)
+{
+	bool bResult = false;
+	struct sched_param param;
+	memset(&param, 0, sizeof(param));
+
+	if ((ePriority < kThreadPriority_BelowNormal) || (ePriority > kThreadPriority_TimeCritical))
+		return false;
+
+	if (ePriority >= kThreadPriority_High)
+	{
+		param.sched_priority = (kThreadPriority_TimeCritical == ePriority) ? FIFO_PRIORITY_TIME_CRITICAL : FIFO_PRIORITY_HIGH;
+		bResult = (0 == sched_setscheduler(tid, SCHED_FIFO, &param));
+		param.sched_priority = 0;
+	}
+
+	if (!bResult)
+	{
+		if (SCHED_OTHER != sched_getscheduler(tid))
+			sched_setscheduler(tid, SCHED_OTHER, &param);
+
+		int nNice = kNiceLevels[ePriority];
+		bResult = (0 == setpriority(PRIO_PROCESS, tid, nNice));
+		if (!bResult)
+		{
+			struct rlimit niceLimit;
+			if (0 == getrlimit(RLIMIT_NICE, &niceLimit))
+			{
+				int nMinNice = 20 - (int) niceLimit.rlim_cur;
+				errno = 0;
+				int nCurrentNice = getpriority(PRIO_PROCESS, tid);
+				if ((0 == errno) && (nMinNice < nCurrentNice))
+					setpriority(PRIO_PROCESS, tid, nMinNice);
+			}
+
+			static bool bWarned = false;
+			if (!bWarned)
+			{
+				bWarned = true;
+				char tmpstring[100];
+				sprintf(tmpstring, "Thread priority %d is not permitted, so thread %d runs at a lower priority.", (int) ePriority, (int) tid);
+				GSTD_TRACE(tmpstring);
+			}
+		}
+	}
+
+	return bResult;
+}
+
+static EThreadPriority LGetThreadPriority(pid_t tid)
+{
+	EThreadPriority ePriority = kThreadPriority_Normal;
+	int nPolicy = sched_getscheduler(tid);
+	if ((SCHED_FIFO == nPolicy) || (SCHED_RR == nPolicy))
+	{
+		struct sched_param param;
+		if ((0 == sched_getparam(tid, &param)) && (param.sched_priority >= FIFO_PRIORITY_TIME_CRITICAL))
+			ePriority = kThreadPriority_TimeCritical;
+		else
+			ePriority = kThreadPriority_High;
+	}
+	else
+	{
+		errno = 0;
+		int nNice = getpriority(PRIO_PROCESS, tid);//-1 is a legal nice level, so errors are only reported via errno.
+		if (0 == errno)
+		{
+			if (nNice >= 3)
+				ePriority = kThreadPriority_BelowNormal;
+			else
+			if (nNice > -3)
+				ePriority = kThreadPriority_Normal;
+			else
+			if (nNice > -8)
+				ePriority = kThreadPriority_AboveNormal;
+			else
+			if (nNice > -13)
+				ePriority = kThreadPriority_High;
+			else
+				ePriority = kThreadPriority_TimeCritical;
+		}
+	}
+
+	return ePriority;
+}
+
+void GThread::OSSetPriority(EThreadPriority ePriority)
+{
+	if (m_nOSThreadId)
+		LSetThreadPriority((pid_t) m_nOSThreadId, ePriority);
+	else
+		m_eStartPriority = ePriority;//Not running yet.
+}
+
+EThreadPriority GThread::OSGetPriority(void)
+{
+	return m_nOSThreadId ? LGetThreadPriority((pid_t) m_nOSThreadId) : m_eStartPriority;
+}
+
+void GThread::OSSetCurrentThreadPriority(EThreadPriority priority)
+{
+	LSetThreadPriority((pid_t) OSGetCurrentThreadId(), priority);
+}
+
+EThreadPriority GThread::OSGetCurrentThreadPriority(void)
+{
+	return LGetThreadPriority((pid_t) OSGetCurrentThreadId());
+}
+
+bool GThread::OSSetCurrentThreadAffinity(unsigned long long cpuMask)
+{
+	cpu_set_t cpus;
+	CPU_ZERO(&cpus);
+	for (int nCpu = 0; (nCpu < 64) && (nCpu < CPU_SETSIZE); nCpu++)
+	{
+		if ((0 == cpuMask) || (cpuMask & (1ULL << nCpu)))
+			CPU_SET(nCpu, &cpus);
+	}
+
+	bool bResult = (0 == sched_setaffinity(0, sizeof(cpus), &cpus));
+	if ((!bResult) && (0 != cpuMask))
+	{
+		char tmpstring[100];
+		sprintf(tmpstring, "sched_setaffinity(0x%llx) failed: %s", cpuMask, strerror(errno));
+		GSTD_TRACE(tmpstring);
+	}
+	return bResult;
+}
+
+int GThread::OSGetNumProcessors(void)
+{
+	long nNumProcessors = sysconf(_SC_NPROCESSORS_ONLN);
+	return (nNumProcessors > 0) ? (int) nNumProcessors : 1;
+}
+
+OSSemaphore GThread::OSCreateSemaphore(void)
+{
+	sem_t *sem;
+	sem = (sem_t *) malloc(sizeof(*sem));
+
+	if (sem)
+	{
+		if (sem_init(sem, 0, 0) != 0)
+		{
+			GSTD_TRACE(GSTD_S("Trouble in paradise"));
+			free(sem);
+			sem = NULL;
+		}
+	}
+	return (OSSemaphore) sem;
+}
+
+void GThread::OSDestroySemaphore(OSSemaphore pSemaphore)
+{
+	sem_destroy((sem_t *) pSemaphore);
+	free(pSemaphore);
+}
+
+bool GThread::OSSemPost(OSSemaphore pSemaphore)
+{
+	return (0 == sem_post((sem_t *) pSemaphore));
+}
+
+bool GThread::OSSemWait(OSSemaphore pSemaphore)
+{
+	return (0 == sem_wait((sem_t *) pSemaphore));
+}
+
+struct LPthreadEvent
+{
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+	bool bSignalled;
+};
+
+OSEvent GThread::OSCreateEvent(void)
+{
+	LPthreadEvent *pEvent = new LPthreadEvent;
+	if (pEvent)
+	{
+		pEvent->bSignalled = false;
+		if (0 != pthread_mutex_init(&pEvent->mutex, NULL))
+		{
+			GSTD_TRACE(GSTD_S("GThread::OSCreateEvent() - pthread_mutex_init() failed."));
+			delete pEvent;
+			pEvent = NULL;
+		}
+		else
+		{
+			//Time out against the monotonic clock, so setting the wall clock does not stretch or cut short a wait.
+			pthread_condattr_t condAttr;
+			pthread_condattr_init(&condAttr);
+			pthread_condattr_setclock(&condAttr, CLOCK_MONOTONIC);
+			if (0 != pthread_cond_init(&pEvent->cond, &condAttr))
+			{
+				GSTD_TRACE(GSTD_S("GThread::OSCreateEvent() - pthread_cond_init() failed."));
+				pthread_mutex_destroy(&pEvent->mutex);
+				delete pEvent;
+				pEvent = NULL;
+			}
+			pthread_condattr_destroy(&condAttr);
+		}
+	}
+	return (OSEvent) pEvent;
+}
+
+void GThread::OSDestroyEvent(OSEvent pOSEvent)
+{
+	LPthreadEvent *pEvent = (LPthreadEvent *) pOSEvent;
+	if (pEvent)
+	{
+		pthread_cond_destroy(&pEvent->cond);
+		pthread_mutex_destroy(&pEvent->mutex);
+		delete pEvent;
+	}
+}
+
+bool GThread::OSSetEvent(OSEvent pOSEvent)
+{
+	bool bResult = false;
+	LPthreadEvent *pEvent = (LPthreadEvent *) pOSEvent;
+	if (pEvent && (0 == pthread_mutex_lock(&pEvent->mutex)))
+	{
+		pEvent->bSignalled = true;
+		pthread_cond_signal(&pEvent->cond);
+		pthread_mutex_unlock(&pEvent->mutex);
+		bResult = true;
+	}
+	return bResult;
+}
+
+bool GThread::OSWaitEvent(OSEvent pOSEvent, int nTimeoutMS)
+{
+	bool bResult = false;
+	LPthreadEvent *pEvent = (LPthreadEvent *) pOSEvent;
+	if (pEvent && (0 == pthread_mutex_lock(&pEvent->mutex)))
+	{
+		struct timespec deadline;
+		clock_gettime(CLOCK_MONOTONIC, &deadline);
+		deadline.tv_sec += nTimeoutMS/1000;
+		deadline.tv_nsec += (nTimeoutMS % 1000)*1000000;
+		if (deadline.tv_nsec >= 1000000000)
+		{
+			deadline.tv_sec++;
+			deadline.tv_nsec -= 1000000000;
+		}
+
+		int status = 0;
+		while ((!pEvent->bSignalled) && (0 == status))
+			status = pthread_cond_timedwait(&pEvent->cond, &pEvent->mutex, &deadline);
+
+		bResult = pEvent->bSignalled;
+		pEvent->bSignalled = false;
+		pthread_mutex_unlock(&pEvent->mutex);
+	}
+	return bResult;
+}
+
+int GThread::OSCreateReadinessFd(void)
+{
+	int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if (fd < 0)
+		GSTD_TRACE(GSTD_S("GThread::OSCreateReadinessFd() - eventfd() failed."));
+	return fd;
+}
+
+void GThread::OSSignalReadinessFd(int fd)
+{
+	if (fd >= 0)
+	{
+		//Nonblocking: if the counter is saturated the descriptor is already readable, so ignore EAGAIN.
+		uint64_t one = 1;
+		ssize_t nBytesWritten = write(fd, &one, sizeof(one));
+		(void) nBytesWritten;
+	}
+}
+
+void GThread::OSDestroyReadinessFd(int fd)
+{
+	if (fd >= 0)
+		close(fd);
+}
+
+int GThread::OSAtomicAdd(volatile int *pValue, int nDelta)
+{
+	return __sync_add_and_fetch(pValue, nDelta);
+}
+
+void GThread::OSMemoryBarrier(void)
+{
+	__sync_synchronize();
+}
+
+bool GThread::OSCreateThreadLocal(OSThreadLocal *pKey, OSThreadLocalDestructor pDestructor)
+{
+	pthread_key_t key;
+	bool bResult = (0 == pthread_key_create(&key, pDestructor));
+	(*pKey) = key;
+	return bResult;
+}
+
+void *GThread::OSGetThreadLocal(OSThreadLocal key)
+{
+	return pthread_getspecific((pthread_key_t) key);
+}
+
+void GThread::OSSetThreadLocal(OSThreadLocal key, void *pValue)
+{
+	pthread_setspecific((pthread_key_t) key, pValue);
+}
+
+unsigned int GThread::OSGetCurrentThreadId(void)
+{
+	return (unsigned int) syscall(SYS_gettid);
+}
+
+static void *start_lite_thread(void *thread)
+{
+	GLiteThread::Main(thread);
+
+	pthread_exit (NULL);
+}
+
+bool GLiteThread::OSStartThread(EThreadPriority priority /* = kThreadPriority_Normal */)
+{
+	bool bResult = false;
+	m_eStartPriority = priority;//Main() applies this, because nice levels can only be set once we know the thread's id.
+	m_pThreadRef = (OSThreadReference) new pthread_t();
+
+	if (pthread_create((pthread_t *)m_pThreadRef, NULL, start_lite_thread, (void*)this)==0)
+		bResult = true;
+	else
+	{
+		delete (pthread_t *) m_pThreadRef;
+		m_pThreadRef = NULL;
+	}
+
+	return bResult;
+}
+
+void GLiteThread::OSStopThread(void)
+{
+	if (m_pThreadRef)
+	{
+		if (m_pStopFunction)
+			m_pStopFunction(m_pThreadParam);
+
+		while (IsThreadAlive())	// spin until thread exits
+			GUtils::OSSleep(10);	// Give main process a chance to execute
+
+		pthread_join(*((pthread_t *) m_pThreadRef), NULL);//Clean up.
+		delete (pthread_t *) m_pThreadRef;
+		m_pThreadRef = NULL;
+	}
+}
+
+void GLiteThread::OSSetPriority(EThreadPriority ePriority)
+{
+	if (m_nOSThreadId)
+		LSetThreadPriority((pid_t) m_nOSThreadId, ePriority);
+	else
+		m_eStartPriority = ePriority;//Not running yet.
+}
+
+EThreadPriority GLiteThread::OSGetPriority(void)
+{
+	return m_nOSThreadId ? LGetThreadPriority((pid_t) m_nOSThreadId) : m_eStartPriority;
+}
+
+static void abort_signal_handler(int status)
+{
+}
+
+//Register a handler for the specified IO abort signal. We issue this signal to cancel pending IO operations during
+//device shutdown.
+int NGIO_RegisterIOAbortSignalHandler(int signalNum)
+{
+	int result = 0;
+	if (signalNum <= 0)
+		result = -1;
+	else if (0 == g_NGIO_IOAbortSignalId)
+	{
+		struct sigaction saio;
+		saio.sa_handler = abort_signal_handler;
+		sigemptyset(&saio.sa_mask);   //saio.sa_mask = 0;
+		saio.sa_flags = 0;
+		saio.sa_restorer = NULL;
+
+		result = sigaction(signalNum, &saio, NULL);
+		if (0 == result)
+			g_NGIO_IOAbortSignalId = signalNum;
+		else
+			GSTD_TRACE(GSTD_S("Register IO Abort sigaction() failed"));
+
+	}
+
+	return result;
+}
+
+int NGIO_DeregisterIOAbortSignalHandler()
+{
+	if (g_NGIO_IOAbortSignalId != 0)
+	{
+		struct sigaction saio;
+		saio.sa_handler = SIG_DFL;
+		sigemptyset(&saio.sa_mask);   //saio.sa_mask = 0;
+		saio.sa_flags = 0;
+		saio.sa_restorer = NULL;
+
+		int status = sigaction(g_NGIO_IOAbortSignalId, &saio, NULL);
+		if (0 != status)
+			GSTD_TRACE(GSTD_S("Deregister IO Abort sigaction() failed"));
+
+		g_NGIO_IOAbortSignalId = 0;
+	}
+
+	return 0;
+}
+
+#ifdef LIB_NAMESPACE
+}
+#endif
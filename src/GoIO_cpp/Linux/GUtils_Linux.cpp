@@ -1,362 +1,531 @@
-/*********************************************************************************
-
-Copyright (c) 2010, Vernier Software & Technology
-All rights reserved.
-
-Redistribution and use in source and binary forms, with or without
-modification, are permitted provided that the following conditions are met:
-    * Redistributions of source code must retain the above copyright
-      notice, this list of conditions and the following disclaimer.
-    * Redistributions in binary form must reproduce the above copyright
-      notice, this list of conditions and the following disclaimer in the
-      documentation and/or other materials provided with the distribution.
-    * Neither the name of Vernier Software & Technology nor the
-      names of its contributors may be used to endorse or promote products
-      derived from this software without specific prior written permission.
-
-THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
-ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
-WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
-DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
-(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
-LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
-ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
-(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-**********************************************************************************/
-// GUtils_Linux.cpp
-
-#include "GUtils.h"
-#include "GTextUtils.h"
-//#include <sys/timeb.h>
-#include <sys/time.h>
-#include <errno.h>
-
-using namespace std;
-
-#ifdef LIB_NAMESPACE
-namespace LIB_NAMESPACE {
-#endif
-
-namespace { // local namespace
-const char * local_makeAssertString(const char * sFile, int nLine, char * pBuffer);
-const char * local_makeAssertString(const char * sFile, int nLine, char * pBuffer)
-{
-	sprintf(pBuffer, "%s Line: %d", sFile, nLine);
-	return pBuffer;
-}
-
-}
-
-bool GUtils::Assert(bool bArgument, const char * sFile, int nLine)
-{
-	if(!bArgument)
-	{
-		char pBuffer[256];
-		printf("%s\n", local_makeAssertString(sFile, nLine, pBuffer));
-	}
-	return bArgument;
-}
-
-void GUtils::OSAssertDialog(SAppError * pAppError)
-{
-}
-
-void GUtils::Beep(void)
-{
-	// Your basic beep.
-        // jentodoi
-        printf("\a");
-}
-
-void GUtils::MessageBox(const cppstring &msg)
-{
-       // jentodo
-}
-
-bool GUtils::YesNo(const cppstring &msg)
-{
-        // jentodo
-	return false;
-}
-
-bool GUtils::OKCancel(const cppstring &msg)
-{
-        // jentodo
-	return false;
-}
-
-EYesNoCancel GUtils::YesNoCancel(const cppstring &msg)
-{
-        // jentodo
-	return kYesNoCancel_Cancel;
-}
-
-int GUtils::CustomMessageBox(cppstring /*sTitle*/, cppstring msg, StringVector * pvButtonTitles, int nDefaultButton)
-{
-	return 0;
-}
-
-void GUtils::OSTrace(const char *pText)
-{
-	printf("%s\n", pText);
-}
-
-void GUtils::OSDeleteExceptionPtr(OSMemoryExceptionPtr)
-{
-}
-
-void GUtils::OSDeleteExceptionPtr(OSFileExceptionPtr)
-{
-}
-
-cppstring GUtils::OSGetExceptionErrorString(OSMemoryExceptionPtr)
-{
-	cppstring sError = "Memory exception.";
-	return sError;
-}
-
-cppstring GUtils::OSGetExceptionErrorString(OSFileExceptionPtr)
-{
-	cppstring sError = "Truly exceptional.";
-	return sError;
-}
-
-cppstring GUtils::OSGetBuildDateTimeText(void)
-{
-	cppstring sBuildDate = __DATE__;
-	sBuildDate += " ";
-	sBuildDate += __TIME__;
-
-
-	return sBuildDate;
-}
-
-cppstring GUtils::OSChooseTextFileForImport(void)
-{
-	return cppstring();
-}
-
-EKeyboardEvent GUtils::OSTranslateKeyboardEvent(void * pData)
-{ // RETURN a cross-platform keyboard event
-	EKeyboardEvent eEvent = kKeyboardEvent_NullEvent;
-	if (pData != NULL)
-		eEvent = *static_cast<EKeyboardEvent *>(pData);
-
-	return eEvent;
-}
-
-bool GUtils::OSConvertShortToBytes(short nInNum, unsigned char * pLSB, unsigned char * pMSB)
-{
-	if(!pLSB || !pMSB)
-		return false;
-
-	unsigned char * pNum = (unsigned char *) &nInNum;
-	*pLSB = *pNum;
-	pNum++;
-	*pMSB = *pNum;
-	return true;
-}
-
-bool GUtils::OSConvertBytesToShort(char chLSB, char chMSB, short * pOutShort)
-{
-	if(!pOutShort)
-		return false;
-
-	char * pAssign = (char *) pOutShort;
-	*pAssign = chLSB;
-	pAssign++;
-	*pAssign = chMSB;
-	return true;
-}
-
-bool GUtils::OSConvertIntToBytes(int nInNum, 
-									unsigned char * pLSB,
-									unsigned char * pLMidB,
-									unsigned char * pMMidB,
-									unsigned char * pMSB)
-{
-	if(!pLSB || !pLMidB || !pMMidB || !pMSB)
-		return false;
-
-	if(!GSTD_ASSERT(sizeof(int) == 4))
-		return false;
-
-	unsigned char * pNum = (unsigned char *) &nInNum;
-	*pLSB = *pNum;
-	pNum++;
-	*pLMidB = *pNum;
-	pNum++;
-	*pMMidB = *pNum;
-	pNum++;
-	*pMSB = *pNum;
-	return true;
-}
-
-bool GUtils::OSConvertBytesToInt(unsigned char chLSB, 
-								   unsigned char chLMidB,
-								   unsigned char chMMidB,
-		   						   unsigned char chMSB, 
-								   int * pOutInt)
-{
-	if(!pOutInt)
-		return false;
-
-	if(!GSTD_ASSERT(sizeof(int) == 4))
-		return false;
-
-	char * pAssign = (char *) pOutInt;
-	*pAssign = chLSB;
-	pAssign++;
-	*pAssign = chLMidB;
-	pAssign++;
-	*pAssign = chMMidB;
-	pAssign++;
-	*pAssign = chMSB;
-	return true;
-}
-
-bool GUtils::OSConvertFloatToBytes(float fInNum, 
-									unsigned char * pLSB,
-									unsigned char * pLMidB,
-									unsigned char * pMMidB,
-									unsigned char * pMSB)
-{
-	if(!GSTD_ASSERT(sizeof(float) == 4))
-		return false;
-
-	if(!pLSB || !pLMidB || !pMMidB || !pMSB)
-		return false;
-
-	unsigned char * pNum = (unsigned char *) &fInNum;
-	*pLSB = *pNum;
-	pNum++;
-	*pLMidB = *pNum;
-	pNum++;
-	*pMMidB = *pNum;
-	pNum++;
-	*pMSB = *pNum;
-	return true;
-}
-
-bool GUtils::OSConvertBytesToFloat(unsigned char chLSB, 
-								   unsigned char chLMidB,
-								   unsigned char chMMidB,
-		   						   unsigned char chMSB, 
-								   float * pOutFloat)
-{
-	if(!pOutFloat)
-		return false;
-
-	if(!GSTD_ASSERT(sizeof(float) == 4))
-		return false;
-
-	char * pAssign = (char *) pOutFloat;
-	*pAssign = chLSB;
-	pAssign++;
-	*pAssign = chLMidB;
-	pAssign++;
-	*pAssign = chMMidB;
-	pAssign++;
-	*pAssign = chMSB;
-	return true;
-}
-
-int	GUtils::OSConvertMacIntToPlatformInt(int nSourceInt)
-{
-	int nDestInt;
-	char *pSourceInt = (char *) &nSourceInt;
-	char *pDestInt = (char *) &nDestInt;
-
-	pDestInt[3] = pSourceInt[0];
-	pDestInt[2] = pSourceInt[1];
-	pDestInt[1] = pSourceInt[2];
-	pDestInt[0] = pSourceInt[3];
-
-	return nDestInt;
-}
-
-int	GUtils::OSConvertIntelIntToPlatformInt(int nSourceInt)
-{
-	int nDestInt;
-	char *pSourceInt = (char *) &nSourceInt;
-	char *pDestInt = (char *) &nDestInt;
-
-	pDestInt[3] = pSourceInt[0];
-	pDestInt[2] = pSourceInt[1];
-	pDestInt[1] = pSourceInt[2];
-	pDestInt[0] = pSourceInt[3];
-
-	return nDestInt;
-}
-
-
-cppstring GUtils::OSGetUserName(void)
-{
-	cppstring sName;
-
-	// REVISIT - how do we get user-name under OS X? (BSD Function or Carbon?)
-
-	return sName;
-}
-
-#ifndef OPUS_DDK
-void GUtils::OSSetDefaultFolder(const GFileRef &)
-{
-	// this is not needed on the mac
-}
-#endif
-
-bool GUtils::OSIsQuickTimeAvailable(void)
-{
-	int version=false;
-
-
-	return version;
-}
-
-bool GUtils::OSAllowThreadedFirmwareUpdate(void)
-{
-	// return UEnvironment::IsRunningOSX();
-	return true;
-}
-
-real GUtils::OSGetSystemClockTime(void)
-{
-	return clock();
-}
-
-unsigned int GUtils::OSGetTimeStamp()
-{
-  struct timeval currentTime;
-  gettimeofday(&currentTime, NULL);
-  unsigned long long timeMs = currentTime.tv_sec;
-  timeMs = timeMs*1000;
-  timeMs += currentTime.tv_usec/1000;
-  return (unsigned int) timeMs;
-}
-
-void GUtils::OSSleep(unsigned int msToSleep)
-{
-  struct timeval tv;
-  unsigned int usToSleep = msToSleep*1000;
-  tv.tv_sec = usToSleep/1000000;
-  tv.tv_usec = usToSleep % 1000000;
-  select (0, NULL, NULL, NULL, &tv);
-}
-
-bool GUtils::OSIsMainThread(void)
-{
-	// return (MPCurrentTaskID() == MMacApp::sMainTaskID);
-	return true;
-}
-
-void GUtils::OSFloatingPointExceptionReset(void)
-{ // stub
-}
-
-#ifdef LIB_NAMESPACE
-}
-#endif
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// GUtils_Linux.cpp
+
+#include "GUtils.h"
+#include "GTextUtils.h"
+//#include <sys/timeb.h>
+#include <sys/time.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <signal.h>
+
+using namespace std;
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+namespace { // local namespace
+const char * local_makeAssertString(const char * sFile, int nLine, char * pBuffer);
+const char * local_makeAssertString(const char * sFile, int nLine, char * pBuffer)
+{
+	sprintf(pBuffer, "%s Line: %d", sFile, nLine);
+	return pBuffer;
+}
+
+}
+
+bool GUtils::Assert(bool bArgument, const char * sFile, int nLine)
+{
+	if(!bArgument)
+	{
+		char pBuffer[256];
+		printf("%s\n", local_makeAssertString(sFile, nLine, pBuffer));
+	}
+	return bArgument;
+}
+
+void GUtils::OSAssertDialog(SAppError * pAppError)
+{
+}
+
+void GUtils::Beep(void)
+{
+	// Your basic beep.
+        // jentodoi
+        printf("\a");
+}
+
+void GUtils::MessageBox(const cppstring &msg)
+{
+       // jentodo
+}
+
+bool GUtils::YesNo(const cppstring &msg)
+{
+        // jentodo
+	return false;
+}
+
+bool GUtils::OKCancel(const cppstring &msg)
+{
+        // jentodo
+	return false;
+}
+
+EYesNoCancel GUtils::YesNoCancel(const cppstring &msg)
+{
+        // jentodo
+	return kYesNoCancel_Cancel;
+}
+
+int GUtils::CustomMessageBox(cppstring /*sTitle*/, cppstring msg, StringVector * pvButtonTitles, int nDefaultButton)
+{
+	return 0;
+}
+
+void GUtils::OSTrace(const char *pText)
+{
+	printf("%s\n", pText);
+}
+
+void GUtils::OSDeleteExceptionPtr(OSMemoryExceptionPtr)
+{
+}
+
+void GUtils::OSDeleteExceptionPtr(OSFileExceptionPtr)
+{
+}
+
+cppstring GUtils::OSGetExceptionErrorString(OSMemoryExceptionPtr)
+{
+	cppstring sError = "Memory exception.";
+	return sError;
+}
+
+cppstring GUtils::OSGetExceptionErrorString(OSFileExceptionPtr)
+{
+	cppstring sError = "Truly exceptional.";
+	return sError;
+}
+
+cppstring GUtils::OSGetBuildDateTimeText(void)
+{
+	cppstring sBuildDate = __DATE__;
+	sBuildDate += " ";
+	sBuildDate += __TIME__;
+
+
+	return sBuildDate;
+}
+
+cppstring GUtils::OSChooseTextFileForImport(void)
+{
+	return cppstring();
+}
+
+EKeyboardEvent GUtils::OSTranslateKeyboardEvent(void * pData)
+{ // RETURN a cross-platform keyboard event
+	EKeyboardEvent eEvent = kKeyboardEvent_NullEvent;
+	if (pData != NULL)
+		eEvent = *static_cast<EKeyboardEvent *>(pData);
+
+	return eEvent;
+}
+
+bool GUtils::OSConvertShortToBytes(short nInNum, unsigned char * pLSB, unsigned char * pMSB)
+{
+	if(!pLSB || !pMSB)
+		return false;
+
+	unsigned char * pNum = (unsigned char *) &nInNum;
+	*pLSB = *pNum;
+	pNum++;
+	*pMSB = *pNum;
+	return true;
+}
+
+bool GUtils::OSConvertBytesToShort(char chLSB, char chMSB, short * pOutShort)
+{
+	if(!pOutShort)
+		return false;
+
+	char * pAssign = (char *) pOutShort;
+	*pAssign = chLSB;
+	pAssign++;
+	*pAssign = chMSB;
+	return true;
+}
+
+bool GUtils::OSConvertIntToBytes(int nInNum, 
+									unsigned char * pLSB,
+									unsigned char * pLMidB,
+									unsigned char * pMMidB,
+									unsigned char * pMSB)
+{
+	if(!pLSB || !pLMidB || !pMMidB || !pMSB)
+		return false;
+
+	if(!GSTD_ASSERT(sizeof(int) == 4))
+		return false;
+
+	unsigned char * pNum = (unsigned char *) &nInNum;
+	*pLSB = *pNum;
+	pNum++;
+	*pLMidB = *pNum;
+	pNum++;
+	*pMMidB = *pNum;
+	pNum++;
+	*pMSB = *pNum;
+	return true;
+}
+
+bool GUtils::OSConvertBytesToInt(unsigned char chLSB, 
+								   unsigned char chLMidB,
+								   unsigned char chMMidB,
+		   						   unsigned char chMSB, 
+								   int * pOutInt)
+{
+	if(!pOutInt)
+		return false;
+
+	if(!GSTD_ASSERT(sizeof(int) == 4))
+		return false;
+
+	char * pAssign = (char *) pOutInt;
+	*pAssign = chLSB;
+	pAssign++;
+	*pAssign = chLMidB;
+	pAssign++;
+	*pAssign = chMMidB;
+	pAssign++;
+	*pAssign = chMSB;
+	return true;
+}
+
+bool GUtils::OSConvertFloatToBytes(float fInNum, 
+									unsigned char * pLSB,
+									unsigned char * pLMidB,
+									unsigned char * pMMidB,
+									unsigned char * pMSB)
+{
+	if(!GSTD_ASSERT(sizeof(float) == 4))
+		return false;
+
+	if(!pLSB || !pLMidB || !pMMidB || !pMSB)
+		return false;
+
+	unsigned char * pNum = (unsigned char *) &fInNum;
+	*pLSB = *pNum;
+	pNum++;
+	*pLMidB = *pNum;
+	pNum++;
+	*pMMidB = *pNum;
+	pNum++;
+	*pMSB = *pNum;
+	return true;
+}
+
+bool GUtils::OSConvertBytesToFloat(unsigned char chLSB, 
+								   unsigned char chLMidB,
+								   unsigned char chMMidB,
+		   						   unsigned char chMSB, 
+								   float * pOutFloat)
+{
+	if(!pOutFloat)
+		return false;
+
+	if(!GSTD_ASSERT(sizeof(float) == 4))
+		return false;
+
+	char * pAssign = (char *) pOutFloat;
+	*pAssign = chLSB;
+	pAssign++;
+	*pAssign = chLMidB;
+	pAssign++;
+	*pAssign = chMMidB;
+	pAssign++;
+	*pAssign = chMSB;
+	return true;
+}
+
+int	GUtils::OSConvertMacIntToPlatformInt(int nSourceInt)
+{
+	int nDestInt;
+	char *pSourceInt = (char *) &nSourceInt;
+	char *pDestInt = (char *) &nDestInt;
+
+	pDestInt[3] = pSourceInt[0];
+	pDestInt[2] = pSourceInt[1];
+	pDestInt[1] = pSourceInt[2];
+	pDestInt[0] = pSourceInt[3];
+
+	return nDestInt;
+}
+
+int	GUtils::OSConvertIntelIntToPlatformInt(int nSourceInt)
+{
+	int nDestInt;
+	char *pSourceInt = (char *) &nSourceInt;
+	char *pDestInt = (char *) &nDestInt;
+
+	pDestInt[3] = pSourceInt[0];
+	pDestInt[2] = pSourceInt[1];
+	pDestInt[1] = pSourceInt[2];
+	pDestInt[0] = pSourceInt[3];
+
+	return nDestInt;
+}
+
+
+cppstring GUtils::OSGetUserName(void)
+{
+	cppstring sName;
+
+	// REVISIT - how do we get user-name under OS X? (BSD Function or Carbon?)
+
+	return sName;
+}
+
+#ifndef OPUS_DDK
+void GUtils::OSSetDefaultFolder(const GFileRef &)
+{
+	// this is not needed on the mac
+}
+#endif
+
+bool GUtils::OSIsQuickTimeAvailable(void)
+{
+	int version=false;
+
+
+	return version;
+}
+
+bool GUtils::OSAllowThreadedFirmwareUpdate(void)
+{
+	// return UEnvironment::IsRunningOSX();
+	return true;
+}
+
+real GUtils::OSGetSystemClockTime(void)
+{
+	return clock();
+}
+
+unsigned int GUtils::OSGetTimeStamp()
+{
+  struct timeval currentTime;
+  gettimeofday(&currentTime, NULL);
+  unsigned long long timeMs = currentTime.tv_sec;
+  timeMs = timeMs*1000;
+  timeMs += currentTime.tv_usec/1000;
+  return (unsigned int) timeMs;
+}
+
+unsigned long long GUtils::OSGetTimeStampMicroseconds()
+{
+  struct timespec currentTime;
+  clock_gettime(CLOCK_MONOTONIC, &currentTime);
+  unsigned long long timeUs = currentTime.tv_sec;
+  timeUs = timeUs*1000000;
+  timeUs += currentTime.tv_nsec/1000;
+  return timeUs;
+}
+
+const unsigned char *GUtils::OSMapFileReadOnly(const cppstring &sFileName, unsigned long long *pnFileSize, void **ppMapping)
+{
+  const unsigned char *pData = NULL;
+  *pnFileSize = 0;
+  *ppMapping = NULL;
+  int fd = open(sFileName.c_str(), O_RDONLY);
+  if (fd >= 0)
+  {
+    struct stat fileStat;
+    if ((0 == fstat(fd, &fileStat)) && (fileStat.st_size > 0) && ((unsigned long long) fileStat.st_size <= (size_t) -1))
+    {
+      void *pMapped = mmap(NULL, (size_t) fileStat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+      if (MAP_FAILED != pMapped)
+      {
+        pData = (const unsigned char *) pMapped;
+        *pnFileSize = fileStat.st_size;
+      }
+    }
+    close(fd);//the mapping keeps the file open.
+  }
+  return pData;
+}
+
+void GUtils::OSUnmapFile(const unsigned char *pData, unsigned long long nFileSize, void * /*pMapping*/)
+{
+  if (pData)
+    munmap((void *) pData, (size_t) nFileSize);
+}
+
+unsigned char *GUtils::OSCreateSharedMemory(const cppstring &sName, unsigned long long nNumBytes, void **ppMapping)
+{
+  unsigned char *pData = NULL;
+  *ppMapping = NULL;
+  if ((nNumBytes > 0) && (nNumBytes <= (size_t) -1))
+  {
+    int fd = shm_open(sName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd >= 0)
+    {
+      if (0 == ftruncate(fd, (off_t) nNumBytes))
+      {
+        void *pMapped = mmap(NULL, (size_t) nNumBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (MAP_FAILED != pMapped)
+          pData = (unsigned char *) pMapped;
+      }
+      close(fd);
+      if (NULL == pData)
+        shm_unlink(sName.c_str());
+    }
+  }
+  return pData;
+}
+
+const unsigned char *GUtils::OSOpenSharedMemoryReadOnly(const cppstring &sName, unsigned long long *pnNumBytes, void **ppMapping)
+{
+  const unsigned char *pData = NULL;
+  *pnNumBytes = 0;
+  *ppMapping = NULL;
+  int fd = shm_open(sName.c_str(), O_RDONLY, 0);
+  if (fd >= 0)
+  {
+    struct stat shmStat;
+    if ((0 == fstat(fd, &shmStat)) && (shmStat.st_size > 0) && ((unsigned long long) shmStat.st_size <= (size_t) -1))
+    {
+      void *pMapped = mmap(NULL, (size_t) shmStat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+      if (MAP_FAILED != pMapped)
+      {
+        pData = (const unsigned char *) pMapped;
+        *pnNumBytes = shmStat.st_size;
+      }
+    }
+    close(fd);
+  }
+  return pData;
+}
+
+void GUtils::OSCloseSharedMemory(const unsigned char *pData, unsigned long long nNumBytes, void * /*pMapping*/)
+{
+  if (pData)
+    munmap((void *) pData, (size_t) nNumBytes);
+}
+
+void GUtils::OSRemoveSharedMemory(const cppstring &sName)
+{
+  shm_unlink(sName.c_str());
+}
+
+unsigned int GUtils::OSGetProcessId(void)
+{
+  return (unsigned int) getpid();
+}
+
+bool GUtils::OSIsProcessRunning(unsigned int nProcessId)
+{
+  //EPERM means the process exists but belongs to someone else.
+  return (0 == kill((pid_t) nProcessId, 0)) || (ESRCH != errno);
+}
+
+unsigned char *GUtils::OSAllocMirroredMemory(unsigned int nMinBytes, unsigned int *pnNumBytes, void **ppMapping)
+{
+  unsigned char *pData = NULL;
+  *pnNumBytes = 0;
+  *ppMapping = NULL;
+  size_t nPageSize = (size_t) sysconf(_SC_PAGESIZE);
+  size_t nNumBytes = ((nMinBytes + nPageSize - 1)/nPageSize)*nPageSize;
+  if ((nNumBytes > 0) && (nNumBytes <= GUTILS_MAX_MIRRORED_BYTES))
+  {
+    int fd = -1;
+#ifdef SYS_memfd_create
+    fd = (int) syscall(SYS_memfd_create, "GoIO_ring", 0);
+#endif
+    if (fd < 0)
+    {
+      //Kernels older than 3.17 do not have memfd_create(), so use a POSIX shared memory object instead, with its
+      //name removed as soon as it is open.
+      static unsigned int nSerial = 0;
+      char name[32];
+      snprintf(name, sizeof(name), "/GoIO_ring_%d_%u", (int) getpid(), nSerial++);
+      fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+      if (fd >= 0)
+        shm_unlink(name);
+    }
+    if (fd >= 0)
+    {
+      if (0 == ftruncate(fd, (off_t) nNumBytes))
+      {
+        //Reserve room for both views, then map the object over each half of it.
+        void *pReserved = mmap(NULL, 2*nNumBytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (MAP_FAILED != pReserved)
+        {
+          unsigned char *pBase = (unsigned char *) pReserved;
+          if ((MAP_FAILED != mmap(pBase, nNumBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0)) &&
+              (MAP_FAILED != mmap(pBase + nNumBytes, nNumBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0)))
+          {
+            pData = pBase;
+            *pnNumBytes = (unsigned int) nNumBytes;
+          }
+          else
+            munmap(pReserved, 2*nNumBytes);
+        }
+      }
+      close(fd);//the mappings keep the memory.
+    }
+  }
+  return pData;
+}
+
+void GUtils::OSFreeMirroredMemory(unsigned char *pData, unsigned int nNumBytes, void * /*pMapping*/)
+{
+  if (pData)
+    munmap(pData, 2*((size_t) nNumBytes));
+}
+
+void GUtils::OSSleep(unsigned int msToSleep)
+{
+  struct timeval tv;
+  unsigned int usToSleep = msToSleep*1000;
+  tv.tv_sec = usToSleep/1000000;
+  tv.tv_usec = usToSleep % 1000000;
+  select (0, NULL, NULL, NULL, &tv);
+}
+
+bool GUtils::OSIsMainThread(void)
+{
+	// return (MPCurrentTaskID() == MMacApp::sMainTaskID);
+	return true;
+}
+
+void GUtils::OSFloatingPointExceptionReset(void)
+{ // stub
+}
+
+#ifdef LIB_NAMESPACE
+}
+#endif
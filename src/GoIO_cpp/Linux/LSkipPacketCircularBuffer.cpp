@@ -0,0 +1,358 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// LSkipPacketCircularBuffer.cpp
+
+#include "LSkipPacketCircularBuffer.h"
+#include "GSkipSpillFile.h"
+#include "GUtils.h"
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+LSkipPacketCircularBuffer::LSkipPacketCircularBuffer(int numRecs)
+{
+	m_pRecs = new GSkipPacket[numRecs];
+	m_pNumMeasurementsInRecs = new unsigned char[numRecs];
+	m_nNumMeasurements = 0;
+	m_pQueueAccessMutex = NULL;
+	m_nRecsAllocated = numRecs;
+	m_nFirstRec = 0;
+	m_nNextRec = 0;
+	m_config.nCapacity = numRecs - 1;
+	m_config.eOverflowPolicy = kSkipQueueOverflow_DropOldest;
+	m_config.nBlockTimeoutMs = 0;
+	m_pSpaceAvailableEvent = GThread::OSCreateEvent();
+	m_bProducerWaiting = false;
+	m_bWaitingSuspended = false;
+	m_pSpillFile = NULL;
+	m_nSpillWatermark = 0;
+}
+
+LSkipPacketCircularBuffer::~LSkipPacketCircularBuffer()
+{
+	delete [] m_pRecs;
+	delete [] m_pNumMeasurementsInRecs;
+	if (m_pSpaceAvailableEvent)
+		GThread::OSDestroyEvent(m_pSpaceAvailableEvent);
+	if (m_pSpillFile)
+		delete m_pSpillFile;
+}
+
+void LSkipPacketCircularBuffer::SetQueueAccessMutex(OSMutex pQueueAccessMutex)
+{
+	m_pQueueAccessMutex = pQueueAccessMutex;
+	m_bWaitingSuspended = false;
+}
+
+void LSkipPacketCircularBuffer::StopWaitingForSpace()
+{
+	m_bWaitingSuspended = true;
+	if (m_bProducerWaiting)
+		GThread::OSSetEvent(m_pSpaceAvailableEvent);
+}
+
+int LSkipPacketCircularBuffer::AddRec(GSkipPacket *pRec, int nMeasurementsInRec /* = 0 */, bool *pbFull /* = NULL */, 
+	bool *pbDropped /* = NULL */, unsigned int *pnWaitMs /* = NULL */, int *pnSpilled /* = NULL */)
+{
+	int numRecs = 0;
+	if (pbFull)
+		(*pbFull) = false;
+	if (pbDropped)
+		(*pbDropped) = false;
+	if (pnWaitMs)
+		(*pnWaitMs) = 0;
+	if (pnSpilled)
+		(*pnSpilled) = 0;
+	if (m_pQueueAccessMutex != NULL)
+	{
+		if (GThread::OSLockMutex(m_pQueueAccessMutex))
+		{
+			if (SpillRec(pRec, nMeasurementsInRec, pbDropped, pnSpilled))
+			{
+				numRecs = NumRecsAvailable();
+				GThread::OSUnlockMutex(m_pQueueAccessMutex);
+				return numRecs;
+			}
+
+			//Note that even though space for m_nRecsAllocated recs exists, we only report available counts from 0 to (m_nRecsAllocated-1).
+			bool bFull = (NumRingRecs() == (m_nRecsAllocated - 1));
+			if (bFull && (kSkipQueueOverflow_BlockProducer == m_config.eOverflowPolicy) && !m_bWaitingSuspended)
+			{
+				//Wait for the consumer to make space. The mutex is recursive, but we only hold it once here.
+				unsigned int waitStartMs = GUtils::OSGetTimeStamp();
+				unsigned int waitedMs = 0;
+				while (bFull && !m_bWaitingSuspended && (waitedMs < (unsigned int) m_config.nBlockTimeoutMs))
+				{
+					m_bProducerWaiting = true;
+					GThread::OSUnlockMutex(m_pQueueAccessMutex);
+					GThread::OSWaitEvent(m_pSpaceAvailableEvent, m_config.nBlockTimeoutMs - waitedMs);
+					GThread::OSLockMutex(m_pQueueAccessMutex);
+					m_bProducerWaiting = false;
+					waitedMs = GUtils::OSGetTimeStamp() - waitStartMs;
+					bFull = (NumRingRecs() == (m_nRecsAllocated - 1));
+				}
+				if (bFull)
+					m_bWaitingSuspended = true;//Don't stall the listener on every packet while the consumer is stuck.
+				if (pbFull)
+					(*pbFull) = true;
+				if (pnWaitMs)
+					(*pnWaitMs) = waitedMs;
+			}
+
+			if (bFull)
+			{
+				if (pbFull)
+					(*pbFull) = true;
+				if (pbDropped)
+					(*pbDropped) = true;
+				if (kSkipQueueOverflow_DropOldest != m_config.eOverflowPolicy)
+				{
+					//Keep what is queued and discard the new rec.
+					GThread::OSUnlockMutex(m_pQueueAccessMutex);
+					return m_nRecsAllocated - 1;
+				}
+
+				//Advance first record index.
+				m_nNumMeasurements -= m_pNumMeasurementsInRecs[m_nFirstRec];
+				m_nFirstRec++;
+				if (m_nFirstRec == m_nRecsAllocated)
+					m_nFirstRec = 0;
+				if (1 == m_nFirstRec)
+					GSTD_TRACE("LSkipPacketCircularBuffer measurement buffer overflowed.");
+			}
+
+			m_pRecs[m_nNextRec] = (*pRec);
+			m_pNumMeasurementsInRecs[m_nNextRec] = (unsigned char) nMeasurementsInRec;
+			m_nNumMeasurements += nMeasurementsInRec;
+			m_nNextRec++;
+			if (m_nNextRec == m_nRecsAllocated)
+				m_nNextRec = 0;
+
+			numRecs = NumRecsAvailable();
+
+			GThread::OSUnlockMutex(m_pQueueAccessMutex);
+		}
+	}
+	return numRecs;
+}
+
+bool LSkipPacketCircularBuffer::RetrieveRec(GSkipPacket *pRec)
+{
+	bool bRecRetrieved = false;
+	if (m_pQueueAccessMutex != NULL)
+	{
+		if (GThread::OSLockMutex(m_pQueueAccessMutex))
+		{
+			if (0 == NumRingRecs())
+				RefillFromSpillFile();
+
+			if (NumRingRecs() > 0)
+			{
+				(*pRec) = m_pRecs[m_nFirstRec];
+				m_nNumMeasurements -= m_pNumMeasurementsInRecs[m_nFirstRec];
+				m_nFirstRec++;
+				if (m_nFirstRec == m_nRecsAllocated)
+					m_nFirstRec = 0;
+				bRecRetrieved = true;
+				m_bWaitingSuspended = false;
+				if (m_bProducerWaiting)
+					GThread::OSSetEvent(m_pSpaceAvailableEvent);
+			}
+			GThread::OSUnlockMutex(m_pQueueAccessMutex);
+		}
+	}
+	return bRecRetrieved;
+}
+
+int LSkipPacketCircularBuffer::NumRecsAvailable()
+{
+	int numRecs = 0;
+	if (m_pQueueAccessMutex != NULL)
+	{
+		if (GThread::OSLockMutex(m_pQueueAccessMutex))
+		{
+			numRecs = NumRingRecs();
+			if (m_pSpillFile)
+				numRecs += m_pSpillFile->NumRecsAvailable();
+			GThread::OSUnlockMutex(m_pQueueAccessMutex);
+		}
+	}
+	return numRecs;
+}
+
+int LSkipPacketCircularBuffer::NumRingRecs()
+{
+	int numRecs = m_nNextRec - m_nFirstRec;
+	if (numRecs < 0)
+		numRecs += m_nRecsAllocated;
+	return numRecs;
+}
+
+bool LSkipPacketCircularBuffer::SpillRec(GSkipPacket *pRec, int nMeasurementsInRec, bool *pbDropped, int *pnSpilled)
+{
+	if ((NULL == m_pSpillFile) || ((0 == m_pSpillFile->NumRecsAvailable()) && (NumRingRecs() < m_nSpillWatermark)))
+		return false;
+
+	bool bSpilled = m_pSpillFile->AppendRec(pRec, nMeasurementsInRec);
+	if (pnSpilled)
+		(*pnSpilled) = bSpilled ? 1 : -1;
+	if (bSpilled)
+		m_nNumMeasurements += nMeasurementsInRec;
+	else
+	if (m_pSpillFile->NumRecsAvailable() > 0)
+	{
+		//pRec is lost: putting it in the ring would get it ahead of older spilled recs.
+		if (pbDropped)
+			(*pbDropped) = true;
+	}
+	else
+		return false;//Nothing is spilled yet, so the ring can still take pRec.
+
+	return true;
+}
+
+void LSkipPacketCircularBuffer::RefillFromSpillFile()
+{
+	if (m_pSpillFile && (m_pSpillFile->NumRecsAvailable() > 0))
+	{
+		//The spilled recs are all newer than anything that was in the ring.
+		int nMaxRecs = m_nRecsAllocated - 1;
+		if (nMaxRecs > SKIP_SPILL_REFILL_RECS)
+			nMaxRecs = SKIP_SPILL_REFILL_RECS;
+		m_nFirstRec = 0;
+		m_nNextRec = m_pSpillFile->RetrieveRecs(m_pRecs, m_pNumMeasurementsInRecs, nMaxRecs);
+		if (0 == m_nNextRec)
+		{
+			//The spill file is unreadable, so its recs are gone.
+			m_pSpillFile->Clear();
+			m_nNumMeasurements = 0;
+		}
+	}
+}
+
+bool LSkipPacketCircularBuffer::SetSpillFile(GSkipSpillFile *pSpillFile, int nHighWatermark)
+{
+	bool bResult = false;
+	bool bLocked = (m_pQueueAccessMutex != NULL) && GThread::OSLockMutex(m_pQueueAccessMutex);
+	if (bLocked || (NULL == m_pQueueAccessMutex))
+	{
+		if (m_pSpillFile && (m_pSpillFile->NumRecsAvailable() > 0))
+			GSTD_TRACE("LSkipPacketCircularBuffer::SetSpillFile - the old spill file has not been drained.");
+		else
+		{
+			if (m_pSpillFile)
+				delete m_pSpillFile;
+			m_pSpillFile = pSpillFile;
+			m_nSpillWatermark = nHighWatermark;
+			bResult = true;
+		}
+
+		if (bLocked)
+			GThread::OSUnlockMutex(m_pQueueAccessMutex);
+	}
+
+	if (!bResult && pSpillFile)
+		delete pSpillFile;
+
+	return bResult;
+}
+
+void LSkipPacketCircularBuffer::Clear()
+{
+	if (m_pQueueAccessMutex != NULL)
+	{
+		if (GThread::OSLockMutex(m_pQueueAccessMutex))
+		{
+			m_nFirstRec = 0;
+			m_nNextRec = 0;
+			m_nNumMeasurements = 0;
+			if (m_pSpillFile)
+				m_pSpillFile->Clear();
+			m_bWaitingSuspended = false;
+			if (m_bProducerWaiting)
+				GThread::OSSetEvent(m_pSpaceAvailableEvent);
+			GThread::OSUnlockMutex(m_pQueueAccessMutex);
+		}
+	}
+}
+
+void LSkipPacketCircularBuffer::SetConfig(const GSkipQueueConfig &config)
+{
+	bool bLocked = (m_pQueueAccessMutex != NULL) && GThread::OSLockMutex(m_pQueueAccessMutex);
+	if (bLocked || (NULL == m_pQueueAccessMutex))
+	{
+		if (config.nCapacity != (m_nRecsAllocated - 1))
+		{
+			int nNumRecsAllocated = config.nCapacity + 1;
+			GSkipPacket *pRecs = new GSkipPacket[nNumRecsAllocated];
+			unsigned char *pNumMeasurementsInRecs = new unsigned char[nNumRecsAllocated];
+
+			//Keep the newest recs that fit.
+			int numRecs = m_nNextRec - m_nFirstRec;
+			if (numRecs < 0)
+				numRecs += m_nRecsAllocated;
+			int nFirstRec = m_nFirstRec;
+			if (numRecs > config.nCapacity)
+			{
+				nFirstRec = (m_nFirstRec + numRecs - config.nCapacity) % m_nRecsAllocated;
+				numRecs = config.nCapacity;
+			}
+			int nNumMeasurements = 0;
+			for (int i = 0; i < numRecs; i++)
+			{
+				pRecs[i] = m_pRecs[(nFirstRec + i) % m_nRecsAllocated];
+				pNumMeasurementsInRecs[i] = m_pNumMeasurementsInRecs[(nFirstRec + i) % m_nRecsAllocated];
+				nNumMeasurements += pNumMeasurementsInRecs[i];
+			}
+
+			delete [] m_pRecs;
+			delete [] m_pNumMeasurementsInRecs;
+			m_pRecs = pRecs;
+			m_pNumMeasurementsInRecs = pNumMeasurementsInRecs;
+			m_nRecsAllocated = nNumRecsAllocated;
+			m_nFirstRec = 0;
+			m_nNextRec = numRecs;
+			if (m_pSpillFile)
+				nNumMeasurements += m_pSpillFile->NumMeasurementsAvailable();
+			m_nNumMeasurements = nNumMeasurements;
+		}
+		m_config = config;
+		m_bWaitingSuspended = false;
+		if (m_bProducerWaiting)
+			GThread::OSSetEvent(m_pSpaceAvailableEvent);
+
+		if (bLocked)
+			GThread::OSUnlockMutex(m_pQueueAccessMutex);
+	}
+}
+
+#ifdef LIB_NAMESPACE
+}
+#endif
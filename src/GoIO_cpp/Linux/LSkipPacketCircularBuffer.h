@@ -0,0 +1,94 @@
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+// LSkipPacketCircularBuffer.h
+//
+// Packet queue shared by the Linux backends(GSkipBaseDevice_Linux.cpp and GSkipBaseDevice_Linux_libusb.cpp). The
+// listener thread adds measurement and command response packets, and the app thread retrieves them.
+//
+// Packets are copied in and out whole, one at a time, so none ever straddles the end of m_pRecs. Unlike
+// GCircularBuffer, the ring would gain nothing from GUtils::OSAllocMirroredMemory(), so it is a plain array.
+
+#ifndef _LSKIPPACKETCIRCULARBUFFER_H_
+#define _LSKIPPACKETCIRCULARBUFFER_H_
+
+#include "GSkipBaseDevice.h"
+#include "GThread.h"
+
+#ifdef LIB_NAMESPACE
+namespace LIB_NAMESPACE {
+#endif
+
+class GSkipSpillFile;
+
+struct LSkipPacketCircularBuffer
+{
+	LSkipPacketCircularBuffer(int numRecs);
+	~LSkipPacketCircularBuffer();
+
+	void SetQueueAccessMutex(OSMutex pQueueAccessMutex);
+	//*pbFull is set if the buffer was full when pRec arrived, *pbDropped if a rec(pRec or the oldest one) was discarded,
+	//and *pnWaitMs to the time spent waiting for space(kSkipQueueOverflow_BlockProducer only).
+	//*pnSpilled is set to 1 if pRec went to the spill file, and to -1 if writing it there failed.
+	int AddRec(GSkipPacket *pRec, int nMeasurementsInRec = 0, bool *pbFull = NULL, bool *pbDropped = NULL, unsigned int *pnWaitMs = NULL,
+		int *pnSpilled = NULL);//returns # of recs available after the add.
+	bool RetrieveRec(GSkipPacket *pRec);
+	int NumRecsAvailable();//includes spilled recs.
+	int NumMeasurementsAvailable() { return m_nNumMeasurements; }//exact, includes spilled measurements, and safe to call without the queue mutex.
+	void Clear();
+	void SetConfig(const GSkipQueueConfig &config);//keeps the newest recs if the capacity shrinks.
+	void StopWaitingForSpace();//until the consumer next removes a rec, AddRec() drops instead of blocking.
+	//Takes ownership of pSpillFile, which may be NULL to stop spilling. Fails if the current spill file holds recs.
+	bool SetSpillFile(GSkipSpillFile *pSpillFile, int nHighWatermark);
+	int NumRingRecs();//excludes spilled recs, caller must hold the queue mutex.
+	//Caller must hold the queue mutex for these. SpillRec() returns false if pRec belongs in the ring instead.
+	bool SpillRec(GSkipPacket *pRec, int nMeasurementsInRec, bool *pbDropped, int *pnSpilled);
+	void RefillFromSpillFile();//only call this when the ring is empty.
+
+	OSMutex m_pQueueAccessMutex; //Not responsible for creation/destruction of this object.
+	GSkipPacket *m_pRecs;
+	unsigned char *m_pNumMeasurementsInRecs;
+	volatile int m_nNumMeasurements;//sum of m_pNumMeasurementsInRecs[] over the recs in the buffer.
+	int	m_nFirstRec;
+	int m_nNextRec;
+	int m_nRecsAllocated;
+	GSkipQueueConfig m_config;
+	OSEvent m_pSpaceAvailableEvent;
+	volatile bool m_bProducerWaiting;
+	volatile bool m_bWaitingSuspended;
+	//Once the ring holds m_nSpillWatermark recs, new recs go to m_pSpillFile until the consumer has read them all.
+	//The consumer refills the ring from the spill file when the ring runs dry, so recs are always retrieved in order.
+	GSkipSpillFile *m_pSpillFile;
+	int m_nSpillWatermark;
+};
+
+#ifdef LIB_NAMESPACE
+}
+#endif
+
+#endif // _LSKIPPACKETCIRCULARBUFFER_H_
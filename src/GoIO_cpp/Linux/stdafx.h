@@ -1,2 +1,2 @@
-// To make cross-platform code happy...
-
+// To make cross-platform code happy...
+
@@ -1,945 +1,1478 @@
-/*********************************************************************************
-
-Copyright (c) 2010, Vernier Software & Technology
-All rights reserved.
-
-Redistribution and use in source and binary forms, with or without
-modification, are permitted provided that the following conditions are met:
-    * Redistributions of source code must retain the above copyright
-      notice, this list of conditions and the following disclaimer.
-    * Redistributions in binary form must reproduce the above copyright
-      notice, this list of conditions and the following disclaimer in the
-      documentation and/or other materials provided with the distribution.
-    * Neither the name of Vernier Software & Technology nor the
-      names of its contributors may be used to endorse or promote products
-      derived from this software without specific prior written permission.
-
-THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
-ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
-WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
-DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
-(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
-LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
-ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
-(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
-SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-**********************************************************************************/
-
-using System;
-using System.Collections.Generic;
-using System.Text;
-using System.Runtime.InteropServices;
-using VSTCoreDefsdotNET;
-
-namespace GoIOdotNET
-{
-    /// <summary>
-    /// 	The GoIO class provides an application program with full access to the data acquisition capabilities built
-    /// 	into the Go family of devices, which include the Go! Link, Go! Temp, Go! Motion, and Vernier Mini GC devices. 
-    ///     This class is a very thin managed code wrapper around the unmanaged GoIO DLL library.
-    /// 	The GoIO class API is fairly broad, so knowing where to start is hard. The documentation for the 
-    /// 	GoIO_Sensor_Open() and the GoIO_Sensor_SendCmdAndGetResponse() functions are good starting places.
-    /// <para>
-    ///		Refer to the GoIO_ParmBlk class for the command and response data structures passed into GoIO_Sensor_SendCmdAndGetResponse().
-    /// </para>
-    /// <para>
-    /// The GoIOdotNet XML docs are a work in progress. More complete documentation can be found in the GoIO_DLL_interface.h file.
-    /// </para>
-    /// </summary>
-    public class GoIO
-	{
-		public const Int32 MAX_SIZE_SENSOR_NAME = 220;
-
-		/// <summary>
-		/// TIMEOUT_MS_DEFAULT is the recommended timeout in milliseconds for most commands sent to the hardware 
-		/// via GoIO_DeviceSendCmdAndGetResponse(). Note that this timeout is much longer than the expected execution time
-		/// of GoIO_DeviceSendCmdAndGetResponse() for most commands, which is about 50 milliseconds.
-		/// </summary>
-		public const Int32 TIMEOUT_MS_DEFAULT = 2000;
-		public const Int32 READ_DDSMEMBLOCK_TIMEOUT_MS = 2000;
-		public const Int32 WRITE_DDSMEMBLOCK_TIMEOUT_MS = 4000;
-
-        /// <summary>
-        /// GoIO_Diags_SetDebugTraceThreshold() threshold parameter value. Setting debug trace threshold to 
-        /// TRACE_SEVERITY_LOWEST causes the most messages to be sent to the debug console.
-        /// </summary>
-        public const byte TRACE_SEVERITY_LOWEST = 1;
-        public const byte TRACE_SEVERITY_LOW = 10;
-        public const byte TRACE_SEVERITY_MEDIUM = 50;
-        public const byte TRACE_SEVERITY_HIGH = 100;
-
-		/// <summary>
-		/// Call GoIO_Init() once before any other GoIO_ calls are made.
-		/// GoIO_Init() and GoIO_Uninit() should be called from the same thread.
-		/// <para>
-		/// Currently, only one application at a time may successfully communicate with Go devices.
-		/// If separate apps call GoIO_Init() before calling GoIO_Uninit(), generally only the first one to 
-		/// invoke GoIO_Init() will find devices when it calls GoIO_UpdateListOfAvailableDevices() and GoIO_GetNthAvailableDeviceName().
-        /// </para>
-        /// <para>
-        /// The GoIOdotNet XML docs are a work in progress. More complete documentation can be found in the GoIO_DLL_interface.h file.
-		/// </para>
-		/// </summary>
-		/// <returns> 0 iff successful, else -1.</returns>
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Init", CallingConvention = CallingConvention.Cdecl)]
-		public static extern IntPtr Init();
-
-		/// <summary>
-		/// Call GoIO_Uninit() once to 'undo' GoIO_Init().
-		/// GoIO_Init() and GoIO_Uninit() should be called from the same thread.
-		/// </summary>
-		/// <returns>0 iff successful, else -1.</returns>
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Uninit", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Uninit();
-
-		/// <summary>
-		/// This routine returns the major and minor version numbers for the instance of the GoIO library that is
-		/// currently running.
-		/// 
-		/// If a function is not guaranteed to be present in all supported versions of the GoIO library, then the line
-		/// "Added in version 'major.minor'" will appear in the function description in this file.
-		/// 
-		/// It is our intention that all versions of the GoIO library created subsequent to a given version, will be
-		/// backwards compatible with the older version. You should be able to replace an old version of the GoIO library
-		/// with a newer version and everything should still work without rebuilding your application.
-		/// 
-		/// Note that version major2.minor2 is later than version major1.minor1 
-		/// iff. ((major2 > major1) OR ((major2 == major1) AND (minor2 > minor1))).
-		/// 
-		/// Backwards compatibility is definitely our intention, but we do not absolutely guarantee it. If you think
-		/// that you have detected a backwards compatibility bug, then please report it to Vernier Software and Technology.
-		/// Calling GoIO_GetDLLVersion() from your application is a way to identify precisely which version of
-		/// the GoIO library you are actually using.
-		/// </summary>
-		/// <param name="MajorVersion"></param>
-		/// <param name="MinorVersion"></param>
-		/// <returns></returns>
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_GetDLLVersion", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 GetDLLVersion(
-											out UInt16 MajorVersion,
-											out UInt16 MinorVersion);
-
-		/// <summary>
-		/// The GoIO library maintains a separate list of available devices for each supported device type.
-		/// GoIO_UpdateListOfAvailableDevices() updates the list for the specified device type.
-		/// 
-		/// </summary>
-		/// <param name="vendorId">[in] USB vendor id</param>
-		/// <param name="productId">[in] USB product id</param>
-		/// <returns>0 iff successful, else -1.</returns>
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_UpdateListOfAvailableDevices", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 UpdateListOfAvailableDevices(
-											Int32 vendorId,
-											Int32 productId);
-
-		/// <summary>
-		/// Return the Nth entry in the list created by UpdateListOfAvailableDevices().
-		/// A device is placed in the list snapshot even if it has already been opened.
-		/// 
-		/// Pass the device name string placed in devnameBuf to GoIO_Sensor_Open() to open the device. Each
-		/// device name string uniquely identifies the device, so you can determine if a device is already open
-		/// by comparing devnameBuf with the string returned by GoIO_Sensor_GetOpenDeviceName() for each open
-		/// device handle.
-		/// </summary>
-		/// <param name="devnameBuf">[out] buffer to store device name string. Allocate this with a capacity of GoIO.MAX_SIZE_Sensor_NAME.</param>
-		/// <param name="bufSize">[in] Set this to the capacity of devnameBuf.</param>
-		/// <param name="vendorId">[in] USB vendor id</param>
-		/// <param name="productId">[in] USB product id</param>
-		/// <param name="N">[in] index into list of known devices, 0 => first device in list.</param>
-		/// <returns>0 iff successful, else -1.</returns>
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_GetNthAvailableDeviceName", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-		public static extern Int32 GetNthAvailableDeviceName(
-			StringBuilder devnameBuf,
-			Int32 bufSize,
-			Int32 vendorId,
-			Int32 productId,
-			Int32 N);
-
-		/// <summary>
-		/// <para>
-		/// Open a specified Go! device with the name returned by GoIO_GetNthAvailableDeviceName.
-        /// If the device is already open, then this routine will fail.
-        /// </para>
-        /// <para>
-        /// In addition to establishing basic communication with the device, this routine will initialize the
-        /// device. Each GOIO_SENSOR_HANDLE sensor object has an associated DDS memory record. If the physical 
-        /// sensor being opened is a 'smart' sensor with its own physical DDS memory, then this routine will copy
-        /// the contents of the memory on the device to the sensor object's DDS memory record. If the physical 
-        /// sensor does not have DDS memory, then the associated DDS memory record is set to default values appropriate
-        /// for the type of sensor detected.
-        /// </para>
-        /// <para>
-        /// The following commands are sent to Go! Temp devices by GoIO_Sensor_Open():
-        /// </para>
-        /// <para>
-        /// SKIP_CMD_ID_INIT,
-        /// </para>
-        /// <para>
-        /// SKIP_CMD_ID_READ_LOCAL_NV_MEM. - read DDS record(same as GoIO_Sensor_DDSMem_ReadRecord()).
-        /// </para>
-        /// <para>
-        /// The following commands are sent to Go! Link and Vernier Mini GC devices by GoIO_Sensor_Open():
-        /// </para>
-        /// <para>
-        /// SKIP_CMD_ID_INIT,
-        /// </para>
-        /// <para>
-        /// SKIP_CMD_ID_GET_SENSOR_ID,
-        /// </para>
-        /// <para>
-        /// SKIP_CMD_ID_READ_REMOTE_NV_MEM, - read DDS record if this is a 'smart' sensor(same as GoIO_Sensor_DDSMem_ReadRecord()).
-        /// </para>
-        /// <para>
-        /// SKIP_CMD_ID_SET_ANALOG_INPUT_CHANNEL. - based on sensor EProbeType, which is either VSTSensorDDSMemRec.kProbeTypeAnalog5V
-        /// or kProbeTypeAnalog10V.
-        /// </para>
-        /// <para>
-        /// SKIP_CMD_ID_GET_SENSOR_ID is superfluous when sent to the Mini GC, but the Mini GC is implemented internally
-        /// as a Go! Link with a fixed sensor plugged in.
-        /// </para>
-        /// <para>
-        /// Only SKIP_CMD_ID_INIT is sent to Go! Motion by GoIO_Sensor_Open(). Go! Motion does not contain DDS memory, but this routine
-        /// initializes the sensor's associated DDS memory record with calibrations for both meters and feet.
-        /// </para>
-        /// <para>
-        /// Since the device stops sending measurements in response to SKIP_CMD_ID_INIT, an application must send
-        /// SKIP_CMD_ID_START_MEASUREMENTS to the device in order to receive measurements. See description of GoIO_Sensor_ReadRawMeasurements().
-        /// </para>
-        /// <para>
-        /// At any given time, a sensor is 'owned' by only one thread. The thread that calls this routine is the
-        /// initial owner of the sensor. If a GoIO() call is made from a thread that does not own the sensor object
-        /// that is passed in, then the call will generally fail. To allow another thread to access a sensor,
-        /// the owning thread should call GoIO_Sensor_Unlock(), and then the new thread must call GoIO_Sensor_Lock().
-        /// 
-		/// </para>
-		/// </summary>
-        /// <param name="deviceName">[in]name returned by GoIO_GetNthAvailableDeviceName()</param>
-		/// <param name="vendorId">[in] USB vendor id</param>
-		/// <param name="productId">[in] USB product id</param>
-		/// <param name="strictDDSValidationFlag">[in] insist on exactly valid checksum if 1, else use a more lax validation test.</param>
-		/// <returns>handle to open sensor device if successful, else NULL.</returns>
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_Open", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-		public static extern IntPtr Sensor_Open(
-			String deviceName,
-			Int32 vendorId,
-			Int32 productId,
-			Int32 strictDDSValidationFlag);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_Close", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_Close(
-			IntPtr hSensor);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetOpenDeviceName", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-		public static extern Int32 Sensor_GetOpenDeviceName(
-			IntPtr hSensor,
-			StringBuilder devnameBuf,
-			Int32 bufSize,
-			out Int32 vendorId,
-			out Int32 productId);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_Lock", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_Lock(
-			IntPtr hSensor,
-			Int32 timeoutMs);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_Unlock", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_Unlock(
-			IntPtr hSensor);
-
-		/// <summary>
-		/// GoIO_Sensor_ClearIO()
-		/// </summary>
-		/// <param name="hSensor"></param>
-		/// <returns></returns>
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_ClearIO", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_ClearIO(
-			IntPtr hSensor);
-
-		/// <summary>
-		/// GoIO_Sensor_SendCmdAndGetResponse() is a low level function that most .NET code should not use directly.
-		/// Use one of the GoIO_Sensor_SendCmdAndGetResponseN() helper functions instead.
-		/// </summary>
-		/// <param name="hSensor"></param>
-		/// <param name="cmd"></param>
-		/// <param name="parameters"></param>
-		/// <param name="nParamBytes"></param>
-		/// <param name="response"></param>
-		/// <param name="nRespBytes">size of of response buffer on input, # of bytes copied into response buffer on output</param>
-		/// <param name="timeoutMs"></param>
-		/// <returns>0 if successful, else -1.</returns>
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_SendCmdAndGetResponse", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_SendCmdAndGetResponse(
-			IntPtr hSensor,
-			byte cmd,
-			IntPtr parameters,
-			UInt32 nParamBytes,
-			IntPtr response,
-			ref UInt32 nRespBytes,
-			Int32 timeoutMs);
-
-		/// <summary>
-		/// Send a command to the specified device hardware and wait for a response. 
-		/// <para>
-        /// The protocol that is used to communicate with the Go devices via the GoIO_Sensor_SendCmdAndGetResponse() function is documented in the
-        /// GoIO_ParmBlk class.
-		/// </para>
-		/// <para>
-		/// Note that GoIO_Sensor_SendCmdAndGetResponse() will fail if you send a CMD_ID_START_MEASUREMENTS
-		/// command while GoIO_Sensor_GetNumMeasurementsAvailable() says measurements are available. 
-		/// </para>
-		/// <para>
-		/// So...if you are restarting measurements, you should clear any old measurements in the GoIO Measurement 
-		/// Buffer first by reading in the measurements until the Buffer is empty, or you should call GoIO_Sensor_ClearIO().
-		/// </para>
-		/// <para>
-		/// Every command supported by GoIO_Sensor_SendCmdAndGetResponse() has an associated response. If no response
-		/// specific to a command is defined, then the format of the response is GoIODefaultCmdResponse. Some commands
-        /// have associated parameter blocks defined for them.  See GoIO_ParmBlk.
-		/// </para>
-		/// <para>
-		/// If GoIO_Sensor_SendCmdAndGetResponse() returns -1, additional information about a GoIO_Sensor_SendCmdAndGetResponse() 
-		/// error may be obtained by calling GoIO_Sensor_GetLastCmdResponseStatus().
-		/// </para>
-		/// </summary>
-		/// <param name="hSensor">[in] handle to open device.</param>
-		/// <param name="cmd">[in] command code.</param>
-		/// <param name="parameters">[in] cmd specific parameter block</param>
-		/// <param name="response">[out] response block</param>
-		/// <param name="nRespBytes">[out] num of bytes passed back in the response block. 
-		/// Caller does not need to initialize this with the size of response block(as unmanaged code does) because the dotNET
-		/// wrapper does so.
-		/// </param>
-		/// <param name="timeoutMs">[in] # of milliseconds to wait for a reply before giving up. Most devices should reply to 
-		/// almost all the currently defined commands within GoIO.TIMEOUT_MS_DEFAULT milliseconds. In fact, typical response
-		/// times are less than 50 milliseconds. </param>
-		/// <returns>0 if successful, else -1.</returns>
-		public static Int32 Sensor_SendCmdAndGetResponse1(
-			IntPtr hSensor,
-			byte cmd,
-			object parameters,
-			ref object response,
-			ref UInt32 nRespBytes,
-			Int32 timeoutMs)
-		{
-			IntPtr paramPtr = Marshal.AllocHGlobal(Marshal.SizeOf(parameters));
-			Marshal.StructureToPtr(parameters, paramPtr, true);
-			IntPtr responsePtr = Marshal.AllocHGlobal(Marshal.SizeOf(response));
-			nRespBytes = (UInt32)Marshal.SizeOf(response);
-			Int32 status = Sensor_SendCmdAndGetResponse(hSensor, cmd, paramPtr, (UInt32)Marshal.SizeOf(parameters),
-				responsePtr, ref nRespBytes, timeoutMs);
-			if (0 == status)
-				response = Marshal.PtrToStructure(responsePtr, response.GetType());
-			else if ((status < 0) && (1 == nRespBytes) && (1 == Marshal.SizeOf(response)))
-				response = Marshal.PtrToStructure(responsePtr, response.GetType());
-			Marshal.FreeHGlobal(responsePtr);
-			Marshal.FreeHGlobal(paramPtr);
-			return status;
-		}
-
-		/// <summary>
-		/// Sensor_SendCmdAndGetResponse2() is the same as Sensor_SendCmdAndGetResponse1() except that no response block is
-		/// returned by the function(even though some sort of response always comes back from the device unless there is a 
-		/// communication failure). This is reasonable if the caller only cares about when the function succeeds or fails, 
-		/// which can be determined from the return value.
-		/// </summary>
-		/// <param name="hSensor"></param>
-		/// <param name="cmd"></param>
-		/// <param name="parameters"></param>
-		/// <param name="timeoutMs"></param>
-		/// <returns>0 if successful, else -1.</returns>
-		public static Int32 Sensor_SendCmdAndGetResponse2(
-			IntPtr hSensor,
-			byte cmd,
-			object parameters,
-			Int32 timeoutMs)
-		{
-			UInt32 respLen = 0;
-			IntPtr paramPtr = Marshal.AllocHGlobal(Marshal.SizeOf(parameters));
-			Marshal.StructureToPtr(parameters, paramPtr, true);
-			Int32 status = Sensor_SendCmdAndGetResponse(hSensor, cmd, paramPtr, (UInt32)Marshal.SizeOf(parameters),
-				IntPtr.Zero, ref respLen, timeoutMs);
-			Marshal.FreeHGlobal(paramPtr);
-			return status;
-		}
-
-		/// <summary>
-		/// Sensor_SendCmdAndGetResponse3() is the same as Sensor_SendCmdAndGetResponse1() except that no parameter block is sent
-		/// to the device. That works fine for commands that do not require parameters.
-		/// </summary>
-		/// <param name="hSensor"></param>
-		/// <param name="cmd"></param>
-		/// <param name="response"></param>
-		/// <param name="nRespBytes"></param>
-		/// <param name="timeoutMs"></param>
-		/// <returns>0 if successful, else -1.</returns>
-		public static Int32 Sensor_SendCmdAndGetResponse3(
-			IntPtr hSensor,
-			byte cmd,
-			ref object response,
-			ref UInt32 nRespBytes,
-			Int32 timeoutMs)
-		{
-			IntPtr responsePtr = Marshal.AllocHGlobal(Marshal.SizeOf(response));
-			nRespBytes = (UInt32)Marshal.SizeOf(response);
-			Int32 status = Sensor_SendCmdAndGetResponse(hSensor, cmd, IntPtr.Zero, 0, responsePtr, ref nRespBytes, timeoutMs);
-			if (0 == status)
-				response = Marshal.PtrToStructure(responsePtr, response.GetType());
-			else if ((status < 0) && (1 == nRespBytes) && (1 == Marshal.SizeOf(response)))
-				response = Marshal.PtrToStructure(responsePtr, response.GetType());
-			Marshal.FreeHGlobal(responsePtr);
-			return status;
-		}
-
-		/// <summary>
-		/// Sensor_SendCmdAndGetResponse4() is the same as Sensor_SendCmdAndGetResponse1() except that no parameter block is sent
-		/// to the device and no response block is returned by the function. That works fine for commands that do not require 
-		/// parameters when the caller is only interested in success or failure.
-		/// 
-		/// </summary>
-		/// <param name="hSensor"></param>
-		/// <param name="cmd"></param>
-		/// <param name="timeoutMs"></param>
-		/// <returns>0 if successful, else -1.</returns>
-		public static Int32 Sensor_SendCmdAndGetResponse4(
-			IntPtr hSensor,
-			byte cmd,
-			Int32 timeoutMs)
-		{
-			UInt32 respLen = 0;
-			Int32 status = Sensor_SendCmdAndGetResponse(hSensor, cmd, IntPtr.Zero, 0, IntPtr.Zero, ref respLen, timeoutMs);
-			return status;
-		}
-
-        /// <summary>
-        /// GoIO_Sensor_GetLastCmdResponseStatus().
-        /// </summary>
-        /// <param name="hSensor">[in] handle to open sensor.</param>
-        /// <param name="LastCmd">[out] last cmd sent to the sensor.</param>
-        /// <param name="LastCmdStatus">[out] status of last command sent to the sensor.
-		/// <para>
-        /// If command ran successfully and the device reported good status, then this will be be GoIODefaultCmdResponse.STATUS_SUCCESS(aka 0).
-		/// </para>
-		/// <para>
-        /// If no response was reported back from the device, then this will be GoIODefaultCmdResponse.STATUS_ERROR_COMMUNICATION.
-		/// </para>
-		/// <para>
-        /// If the device reported a failure, then this will be a cmd specific error, eg GoIODefaultCmdResponse.STATUS_ERROR_...
-		/// </para>
-        /// </param>
-        /// <param name="LastCmdWithErrorRespSentOvertheWire">[out] last cmd sent that caused the device to report back an error.</param>
-        /// <param name="LastErrorSentOvertheWire">[out] last error that came back from the device 'over the wire'.</param>
-        /// <returns>0 if hSensor is valid, else -1</returns>
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetLastCmdResponseStatus", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_GetLastCmdResponseStatus(
-			IntPtr hSensor,
-			out byte LastCmd,
-			out byte LastCmdStatus,
-			out byte LastCmdWithErrorRespSentOvertheWire,
-			out byte LastErrorSentOvertheWire);
-
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetMeasurementTickInSeconds", CallingConvention = CallingConvention.Cdecl)]
-		public static extern double Sensor_GetMeasurementTickInSeconds(
-			IntPtr hSensor);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetMinimumMeasurementPeriod", CallingConvention = CallingConvention.Cdecl)]
-		public static extern double Sensor_GetMinimumMeasurementPeriod(
-			IntPtr hSensor);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetMaximumMeasurementPeriod", CallingConvention = CallingConvention.Cdecl)]
-		public static extern double Sensor_GetMaximumMeasurementPeriod(
-			IntPtr hSensor);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_SetMeasurementPeriod", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_SetMeasurementPeriod(
-			IntPtr hSensor,
-			Double desiredPeriod,
-			Int32 timeoutMs);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetMeasurementPeriod", CallingConvention = CallingConvention.Cdecl)]
-		public static extern double Sensor_GetMeasurementPeriod(
-			IntPtr hSensor,
-			Int32 timeoutMs);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetNumMeasurementsAvailable", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_GetNumMeasurementsAvailable(
-			IntPtr hSensor);
-
-		/// <summary>
-		/// Retrieve measurements from the GoIO Measurement Buffer. The measurements reported
-		/// by this routine are actually removed from the GoIO Measurement Buffer.
-		/// <para>
-		/// After SKIP_CMD_ID_START_MEASUREMENTS has been sent to the sensor, the sensor starts
-		/// sending measurements to the host computer at the rate specified by GoIO_Sensor_SetMeasurementPeriod(). 
-		/// These measurements are stored in the GoIO Measurement Buffer. 
-		/// A separate GoIO Measurement Buffer is maintained for each open sensor. 
-		/// </para>
-		/// <para>
-		/// Note that for Go! Temp and Go! Link, raw measurements range from -32768 to 32767.
-		/// Go! Motion raw measurements are in microns and can range into the millions.
-		/// </para>
-		/// <para>
-		/// To convert a raw measurement to a voltage use GoIO_Sensor_ConvertToVoltage().
-		/// To convert a voltage to a sensor specific calibrated unit, use GoIO_Sensor_CalibrateData().
-		/// </para>
-		/// <para>
-		/// WARNING!!! IF YOU ARE COLLECTING MORE THAN 50 MEASUREMENTS A SECOND FROM GO! LINK,
-		/// READ THIS: The GoIO Measurement Buffer is packet oriented. If you are collecting 50 or
-		/// less measurements per second, then each packet contains only 1 measurement, and there is
-		/// no problem.
-		/// </para>
-		/// <para>
-		/// If you are collecting more than 50 measurements a second, then each packet may contain 2 
-		/// or 3 measurements. Depending on the exact measurement period, all the packets will 
-		/// contain 2, or all the packets will contain 3 measurements. IF THE LAST MEASUREMENT COPIED
-		/// INTO THE measurements ARRAY ARGUMENT IS NOT THE LAST MEASUREMENT IN ITS PACKET, THEN MEASUREMENTS WILL
-		/// BE LOST.
-		/// </para>
-		/// <para>
-		/// There are a couple of safe workarounds to this problem:
-		/// </para>
-		/// <para>
-		/// 1) Always set the maxCount parameter to a multiple of 6, or
-		/// </para>
-		/// <para>
-		/// 2) Always set the maxCount parameter to GoIO_Sensor_GetNumMeasurementsAvailable().		
-		/// </para>
-		/// <para>
-		/// </para>
-		/// </summary>
-		/// <param name="hSensor">[in] Handle to open device.</param>
-		/// <param name="measurements">[out]Loc to store measurements.</param>
-		/// <param name="maxCount">Maximum number of measurements to copy to measurements array. The measurements 
-		/// array passed in must be allocated with a length of at least maxCount elements.
-		/// If you are taking measurements faster than 50 hertz from GoLink, then you MUST set maxCount to either a multiple of
-		/// 6, or to the value returned by GoIO_Sensor_GetNumMeasurementsAvailable().</param>
-		/// <returns>Number of measurements retrieved from the GoIO Measurement Buffer. This routine returns 
-		/// immediately, so the return value may be less than maxCount. Return value less than 0 implies error.</returns>
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_ReadRawMeasurements", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_ReadRawMeasurements(
-			IntPtr hSensor,
-			Int32[] measurements,
-			UInt32 maxCount);
-
-		/// <summary>
-		/// Report the most recent measurement put in the GoIO Measurement Buffer. If no 
-		/// measurements have been placed in the GoIO Measurement Buffer since it was
-		/// created byGoIO_Sensor_Open(), then report a value of 0. 
-		/// <para>
-		/// This routine also empties the GoIO Measurement Buffer, so GoIO_Sensor_GetNumMeasurementsAvailable()
-		/// will report 0 after calling GoIO_Sensor_GetLatestRawMeasurement().
-		/// </para>
-		/// <para>
-		/// After SKIP_CMD_ID_START_MEASUREMENTS has been sent to the sensor, the sensor starts
-		/// sending measurements to the host computer. These measurements are stored in the 
-		/// GoIO Measurement Buffer. A separate GoIO Measurement Buffer is maintained for each
-		/// open sensor. See the description of GoIO_Sensor_GetNumMeasurementsAvailable().
-		/// </para>
-		/// <para>
-		/// Note that for Go! Temp and Go! Link, raw measurements range from -32768 to 32767.
-		/// Go! Motion raw measurements are in microns and can range into the millions.
-		/// </para>
-		/// <para>
-		/// To convert a raw measurement to a voltage use GoIO_Sensor_ConvertToVoltage().
-		/// To convert a voltage to a sensor specific calibrated unit, use GoIO_Sensor_CalibrateData().
-		/// </para>
-		/// </summary>
-		/// <param name="hSensor"></param>
-		/// <returns>most recent measurement put in the GoIO Measurement Buffer. If no 
-		/// measurements have been placed in the GoIO Measurement Buffer since it was
-		/// created byGoIO_Sensor_Open(), then report a value of 0.</returns>
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetLatestRawMeasurement", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_GetLatestRawMeasurement(
-			IntPtr hSensor);
-
-		/// <summary>
-		/// Convert a raw measurement integer value into a real voltage value.
-		/// Depending on the type of sensor(see GoIO_Sensor_GetProbeType()), the voltage
-		/// may range from 0.0 to 5.0, or from -10.0 to 10.0 . For Go! Motion, voltage returned is simply distance
-		/// in meters.
-		/// </summary>
-		/// <param name="hSensor"></param>
-		/// <param name="rawMeasurement"></param>
-		/// <returns></returns>
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_ConvertToVoltage", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Double Sensor_ConvertToVoltage(
-			IntPtr hSensor,
-			Int32 rawMeasurement);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_CalibrateData", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Double Sensor_CalibrateData(
-			IntPtr hSensor,
-			Double volts);
-
-		/// <summary>
-		/// GoIO_Sensor_GetProbeType()
-		/// </summary>
-		/// <param name="hSensor"></param>
-		/// <returns>VSTSensorDDSMemRec.kProbeType...</returns>
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetProbeType", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_GetProbeType(
-			IntPtr hSensor);
-
-		/// <summary>
-		/// GoIO_Sensor_DDSMem_ReadRecord().
-        /// Read VSTSensorDDSMemRec from nonvolatile memory on the sensor into the local computer memory record associated with hSensor. This routine only
-        /// works on 'smart' sensors. If GoIO_Sensor_DDSMem_ReadRecord() succeeds, then individual fields in the DDS record can be retrieved using
-        /// the other GoIO_Sensor_DDSMem_Get... routines.
-        /// </summary>
-		/// <param name="hSensor"></param>
-		/// <param name="strictDDSValidationFlag">insist on exactly valid checksum if 1, else use a more lax validation test.</param>
-		/// <param name="timeoutMs">READ_DDSMEMBLOCK_TIMEOUT_MS is recommended.</param>
-		/// <returns>0 iff successful, else -1</returns>
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_ReadRecord", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_ReadRecord(
-			IntPtr hSensor,
-			byte strictDDSValidationFlag,
-			Int32 timeoutMs);
-
-        /// <summary>
-        /// GoIO_Sensor_DDSMem_WriteRecord().
-        /// <para>
-        /// Write the data currently stored in the local computer memory copy of the VSTSensorDDSMemRec to the nonvolatile memory
-        /// physically located on the 'smart' sensor. The local computer copy of the VSTSensorDDSMemRec is usually initialized with a call to
-        /// GoIO_Sensor_DDSMem_ReadRecord() followed by calls to the GoIO_Sensor_DDSMem_Set... routines.
-        /// </para>
-        /// <para>
-        /// WARNING: Be careful about using this routine. Changing a smart sensor's DDS memory can cause the sensor
-        /// to stop working with Logger Pro.
-        /// </para>
-        /// </summary>
-        /// <param name="hSensor"></param>
-        /// <param name="timeoutMs">WRITE_DDSMEMBLOCK_TIMEOUT_MS is recommended.</param>
-        /// <returns>0 iff successful, else -1</returns>
-        [DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_WriteRecord", CallingConvention = CallingConvention.Cdecl)]
-        public static extern Int32 Sensor_DDSMem_WriteRecord(
-            IntPtr hSensor,
-            Int32 timeoutMs);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetRecord", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetRecord(
-			IntPtr hSensor,
-			ref VSTSensorDDSMemRec rec);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetRecord", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetRecord(
-			IntPtr hSensor,
-			out VSTSensorDDSMemRec rec);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_ClearRecord", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_ClearRecord(
-			IntPtr hSensor);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_CalculateChecksum", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_CalculateChecksum(
-			IntPtr hSensor,
-			out byte checksum);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetMemMapVersion", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetMemMapVersion(
-			IntPtr hSensor,
-			byte MemMapVersion);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetMemMapVersion", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetMemMapVersion(
-			IntPtr hSensor,
-			out byte MemMapVersion);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetSensorNumber", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetSensorNumber(
-			IntPtr hSensor,
-			byte SensorNumber);
-
-		/// <summary>
-		/// GoIO_Sensor_DDSMem_GetSensorNumber().
-        /// Retrieve the sensor number that identifies the sensor. In general, the combination of sensor number and probe type uniquely identify
-        /// the type of sensor. As it happens, when using Go interfaces, the sensor number provides enough info to uniquely id a sensor.
-        /// <para>
-        /// A reported SensorNumber == 0 indicates that no sensor is plugged into the interface.
-        /// </para>
-        /// </summary>
-		/// <param name="hSensor"></param>
-		/// <param name="SensorNumber"></param>
-		/// <param name="sendQueryToHardwareflag">
-        /// If sendQueryToHardwareflag != 0, then send a CMD_ID_GET_SENSOR_ID to the sensor hardware. The sensor number is returned from the hardware
-        /// and stored in the local computer VSTSensorDDSMemRec.SensorNumber field associated with hSensor. This updated sensor number value is also
-        /// written to the SensorNumber output.
-        /// </param>
-        /// <param name="timeoutMs"># of milliseconds to wait for a reply before giving up. GoIO.TIMEOUT_MS_DEFAULT is recommended.</param>
-		/// <returns></returns>
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetSensorNumber", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetSensorNumber(
-			IntPtr hSensor,
-			out byte SensorNumber,
-			Int32 sendQueryToHardwareflag,
-			Int32 timeoutMs);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetSerialNumber", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetSerialNumber(
-			IntPtr hSensor,
-			byte leastSigByte_SerialNumber,
-			byte midSigByte_SerialNumber,
-			byte mostSigByte_SerialNumber);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetSerialNumber", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetSerialNumber(
-			IntPtr hSensor,
-			out byte leastSigByte_SerialNumber,
-			out byte midSigByte_SerialNumber,
-			out byte mostSigByte_SerialNumber);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetLotCode", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetLotCode(
-			IntPtr hSensor,
-			byte YY_BCD,
-			byte WW_BCD);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetLotCode", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetLotCode(
-			IntPtr hSensor,
-			out byte YY_BCD,
-			out byte WW_BCD);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetManufacturerID", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetManufacturerID(
-			IntPtr hSensor,
-			byte ManufacturerID);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetManufacturerID", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetManufacturerID(
-			IntPtr hSensor,
-			out byte ManufacturerID);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetLongName", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-		public static extern IntPtr Sensor_DDSMem_SetLongName(
-			IntPtr hSensor,
-			String longName);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetLongName", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-		public static extern IntPtr Sensor_DDSMem_GetLongName(
-			IntPtr hSensor,
-			StringBuilder longName,
-			UInt16 maxNumBytesToCopy);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetShortName", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-		public static extern IntPtr Sensor_DDSMem_SetShortName(
-			IntPtr hSensor,
-			String shortName);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetShortName", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-		public static extern IntPtr Sensor_DDSMem_GetShortName(
-			IntPtr hSensor,
-			StringBuilder shortName,
-			UInt16 maxNumBytesToCopy);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetUncertainty", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetUncertainty(
-			IntPtr hSensor,
-			byte Uncertainty);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetUncertainty", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetUncertainty(
-			IntPtr hSensor,
-			out byte Uncertainty);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetSignificantFigures", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetSignificantFigures(
-			IntPtr hSensor,
-			byte SignificantFigures);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetSignificantFigures", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetSignificantFigures(
-			IntPtr hSensor,
-			out byte SignificantFigures);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetCurrentRequirement", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetCurrentRequirement(
-			IntPtr hSensor,
-			byte CurrentRequirement);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetCurrentRequirement", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetCurrentRequirement(
-			IntPtr hSensor,
-			out byte CurrentRequirement);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetAveraging", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetAveraging(
-			IntPtr hSensor,
-			byte Averaging);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetAveraging", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetAveraging(
-			IntPtr hSensor,
-			out byte Averaging);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetMinSamplePeriod", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetMinSamplePeriod(
-			IntPtr hSensor,
-			Single MinSamplePeriod);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetMinSamplePeriod", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetMinSamplePeriod(
-			IntPtr hSensor,
-			out Single MinSamplePeriod);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetTypSamplePeriod", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetTypSamplePeriod(
-			IntPtr hSensor,
-			Single TypSamplePeriod);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetTypSamplePeriod", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetTypSamplePeriod(
-			IntPtr hSensor,
-			out Single TypSamplePeriod);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetTypNumberofSamples", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetTypNumberofSamples(
-			IntPtr hSensor,
-			UInt16 TypNumberofSamples);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetTypNumberofSamples", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetTypNumberofSamples(
-			IntPtr hSensor,
-			out UInt16 TypNumberofSamples);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetWarmUpTime", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetWarmUpTime(
-			IntPtr hSensor,
-			UInt16 WarmUpTime);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetWarmUpTime", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetWarmUpTime(
-			IntPtr hSensor,
-			out UInt16 WarmUpTime);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetExperimentType", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetExperimentType(
-			IntPtr hSensor,
-			byte ExperimentType);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetExperimentType", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetExperimentType(
-			IntPtr hSensor,
-			out byte ExperimentType);
-
-		/// <summary>
-		/// GoIO_Sensor_DDSMem_SetOperationType() can change the probe type. See GoIO_Sensor_GetProbeType().
-		/// </summary>
-		/// <param name="hSensor"></param>
-		/// <param name="OperationType"></param>
-		/// <returns></returns>
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetOperationType", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetOperationType(
-			IntPtr hSensor,
-			byte OperationType);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetOperationType", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetOperationType(
-			IntPtr hSensor,
-			out byte OperationType);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetCalibrationEquation", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetCalibrationEquation(
-			IntPtr hSensor,
-			sbyte CalibrationEquation);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetCalibrationEquation", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetCalibrationEquation(
-			IntPtr hSensor,
-			out sbyte CalibrationEquation);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetYminValue", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetYminValue(
-			IntPtr hSensor,
-			Single YminValue);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetYminValue", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetYminValue(
-			IntPtr hSensor,
-			out Single YminValue);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetYmaxValue", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetYmaxValue(
-			IntPtr hSensor,
-			Single YmaxValue);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetYmaxValue", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetYmaxValue(
-			IntPtr hSensor,
-			out Single YmaxValue);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetYscale", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetYscale(
-			IntPtr hSensor,
-			byte Yscale);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetYscale", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetYscale(
-			IntPtr hSensor,
-			out byte Yscale);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetHighestValidCalPageIndex", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetHighestValidCalPageIndex(
-			IntPtr hSensor,
-			byte HighestValidCalPageIndex);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetHighestValidCalPageIndex", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetHighestValidCalPageIndex(
-			IntPtr hSensor,
-			out byte HighestValidCalPageIndex);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetActiveCalPage", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetActiveCalPage(
-			IntPtr hSensor,
-			byte ActiveCalPage);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetActiveCalPage", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetActiveCalPage(
-			IntPtr hSensor,
-			out byte ActiveCalPage);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetCalPage", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-		public static extern Int32 Sensor_DDSMem_SetCalPage(
-			IntPtr hSensor,
-			byte CalPageIndex,
-			float CalibrationCoefficientA,
-			float CalibrationCoefficientB,
-			float CalibrationCoefficientC,
-			String units);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetCalPage", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
-		public static extern Int32 Sensor_DDSMem_GetCalPage(
-			IntPtr hSensor,
-			byte CalPageIndex,
-			out float CalibrationCoefficientA,
-			out float CalibrationCoefficientB,
-			out float CalibrationCoefficientC,
-			StringBuilder units,
-			UInt16 maxNumBytesToCopy);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetChecksum", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_SetChecksum(
-			IntPtr hSensor,
-			byte Checksum);
-
-		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetChecksum", CallingConvention = CallingConvention.Cdecl)]
-		public static extern Int32 Sensor_DDSMem_GetChecksum(
-			IntPtr hSensor,
-			byte Checksum);
-
-        /// <summary>
-        /// GoIO_Diags_SetDebugTraceThreshold().
-        /// </summary>
-        /// <param name="threshold">Only trace messages marked with a severity >= threshold(GoIO.TRACE_SEVERITY_) are actually sent to the debug output.</param>
-        /// <returns></returns>
-        [DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Diags_SetDebugTraceThreshold", CallingConvention = CallingConvention.Cdecl)]
-        public static extern Int32 Diags_SetDebugTraceThreshold(
-            Int32 threshold);
-
-        [DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Diags_GetDebugTraceThreshold", CallingConvention = CallingConvention.Cdecl)]
-        public static extern Int32 Diags_GetDebugTraceThreshold(
-            out Int32 threshold);
-	}
-}
+/*********************************************************************************
+
+Copyright (c) 2010, Vernier Software & Technology
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of Vernier Software & Technology nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL VERNIER SOFTWARE & TECHNOLOGY BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+**********************************************************************************/
+
+using System;
+using System.Collections.Generic;
+using System.Text;
+using System.Runtime.InteropServices;
+using VSTCoreDefsdotNET;
+
+namespace GoIOdotNET
+{
+    /// <summary>
+    /// 	The GoIO class provides an application program with full access to the data acquisition capabilities built
+    /// 	into the Go family of devices, which include the Go! Link, Go! Temp, Go! Motion, and Vernier Mini GC devices. 
+    ///     This class is a very thin managed code wrapper around the unmanaged GoIO DLL library.
+    /// 	The GoIO class API is fairly broad, so knowing where to start is hard. The documentation for the 
+    /// 	GoIO_Sensor_Open() and the GoIO_Sensor_SendCmdAndGetResponse() functions are good starting places.
+    /// <para>
+    ///		Refer to the GoIO_ParmBlk class for the command and response data structures passed into GoIO_Sensor_SendCmdAndGetResponse().
+    /// </para>
+    /// <para>
+    /// The GoIOdotNet XML docs are a work in progress. More complete documentation can be found in the GoIO_DLL_interface.h file.
+    /// </para>
+    /// </summary>
+    public class GoIO
+	{
+		public const Int32 MAX_SIZE_SENSOR_NAME = 220;
+
+		/// <summary>
+		/// TIMEOUT_MS_DEFAULT is the recommended timeout in milliseconds for most commands sent to the hardware 
+		/// via GoIO_DeviceSendCmdAndGetResponse(). Note that this timeout is much longer than the expected execution time
+		/// of GoIO_DeviceSendCmdAndGetResponse() for most commands, which is about 50 milliseconds.
+		/// </summary>
+		public const Int32 TIMEOUT_MS_DEFAULT = 2000;
+		public const Int32 READ_DDSMEMBLOCK_TIMEOUT_MS = 2000;
+		public const Int32 WRITE_DDSMEMBLOCK_TIMEOUT_MS = 4000;
+
+        /// <summary>
+        /// GoIO_Diags_SetDebugTraceThreshold() threshold parameter value. Setting debug trace threshold to 
+        /// TRACE_SEVERITY_LOWEST causes the most messages to be sent to the debug console.
+        /// </summary>
+        public const byte TRACE_SEVERITY_LOWEST = 1;
+        public const byte TRACE_SEVERITY_LOW = 10;
+        public const byte TRACE_SEVERITY_MEDIUM = 50;
+        public const byte TRACE_SEVERITY_HIGH = 100;
+
+		/// <summary>
+		/// Call GoIO_Init() once before any other GoIO_ calls are made.
+		/// GoIO_Init() and GoIO_Uninit() should be called from the same thread.
+		/// <para>
+		/// Currently, only one application at a time may successfully communicate with Go devices.
+		/// If separate apps call GoIO_Init() before calling GoIO_Uninit(), generally only the first one to 
+		/// invoke GoIO_Init() will find devices when it calls GoIO_UpdateListOfAvailableDevices() and GoIO_GetNthAvailableDeviceName().
+        /// </para>
+        /// <para>
+        /// The GoIOdotNet XML docs are a work in progress. More complete documentation can be found in the GoIO_DLL_interface.h file.
+		/// </para>
+		/// </summary>
+		/// <returns> 0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Init", CallingConvention = CallingConvention.Cdecl)]
+		public static extern IntPtr Init();
+
+		/// <summary>
+		/// Call GoIO_Uninit() once to 'undo' GoIO_Init().
+		/// GoIO_Init() and GoIO_Uninit() should be called from the same thread.
+		/// </summary>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Uninit", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Uninit();
+
+		/// <summary>
+		/// goiod's default socket is DAEMON_SOCKET_NAME in $XDG_RUNTIME_DIR, or in DAEMON_DEFAULT_SOCKET_DIR if
+		/// XDG_RUNTIME_DIR is not set.
+		/// </summary>
+		public const string DAEMON_DEFAULT_SOCKET_DIR = "/run/goiod";
+		public const string DAEMON_SOCKET_NAME = "goiod.socket";
+
+		/// <summary>
+		/// Make the following Init() connect to the goiod daemon at path instead of opening USB devices itself, so that
+		/// several processes can share the same sensors. Only part of the API is supported through the daemon; see
+		/// GoIO_DLL_interface.h for the details. Pass null to go back to opening devices directly.
+		/// Currently only supported on Linux.
+		/// </summary>
+		/// <param name="path">[in] Unix domain socket that goiod listens on.</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_SetDaemonSocketPath", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 SetDaemonSocketPath(
+			string path);
+
+		/// <summary>
+		/// GoIO_SetIOThreadPolicy() priority parameter values.
+		/// </summary>
+		public const Int32 THREAD_PRIORITY_BELOW_NORMAL = 0;
+		public const Int32 THREAD_PRIORITY_NORMAL = 1;
+		public const Int32 THREAD_PRIORITY_ABOVE_NORMAL = 2;
+		public const Int32 THREAD_PRIORITY_HIGH = 3;
+		public const Int32 THREAD_PRIORITY_TIME_CRITICAL = 4;
+
+		/// <summary>
+		/// Set the scheduling priority and the cpus used by the threads that GoIO creates to read from devices and to
+		/// write the binary log. The policy applies to running threads as well as to threads created later.
+		/// See GoIO_DLL_interface.h for how the priorities are implemented on each platform.
+		/// </summary>
+		/// <param name="priority">[in] GoIO.THREAD_PRIORITY_*.</param>
+		/// <param name="cpuMask">[in] Bit n set allows the threads to run on cpu n. 0 allows any cpu.</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_SetIOThreadPolicy", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 SetIOThreadPolicy(
+			Int32 priority,
+			UInt64 cpuMask);
+
+		/// <summary>
+		/// This routine returns the major and minor version numbers for the instance of the GoIO library that is
+		/// currently running.
+		/// 
+		/// If a function is not guaranteed to be present in all supported versions of the GoIO library, then the line
+		/// "Added in version 'major.minor'" will appear in the function description in this file.
+		/// 
+		/// It is our intention that all versions of the GoIO library created subsequent to a given version, will be
+		/// backwards compatible with the older version. You should be able to replace an old version of the GoIO library
+		/// with a newer version and everything should still work without rebuilding your application.
+		/// 
+		/// Note that version major2.minor2 is later than version major1.minor1 
+		/// iff. ((major2 > major1) OR ((major2 == major1) AND (minor2 > minor1))).
+		/// 
+		/// Backwards compatibility is definitely our intention, but we do not absolutely guarantee it. If you think
+		/// that you have detected a backwards compatibility bug, then please report it to Vernier Software and Technology.
+		/// Calling GoIO_GetDLLVersion() from your application is a way to identify precisely which version of
+		/// the GoIO library you are actually using.
+		/// </summary>
+		/// <param name="MajorVersion"></param>
+		/// <param name="MinorVersion"></param>
+		/// <returns></returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_GetDLLVersion", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 GetDLLVersion(
+											out UInt16 MajorVersion,
+											out UInt16 MinorVersion);
+
+		/// <summary>
+		/// The GoIO library maintains a separate list of available devices for each supported device type.
+		/// GoIO_UpdateListOfAvailableDevices() updates the list for the specified device type.
+		/// 
+		/// </summary>
+		/// <param name="vendorId">[in] USB vendor id</param>
+		/// <param name="productId">[in] USB product id</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_UpdateListOfAvailableDevices", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 UpdateListOfAvailableDevices(
+											Int32 vendorId,
+											Int32 productId);
+
+		/// <summary>
+		/// Return the Nth entry in the list created by UpdateListOfAvailableDevices().
+		/// A device is placed in the list snapshot even if it has already been opened.
+		/// 
+		/// Pass the device name string placed in devnameBuf to GoIO_Sensor_Open() to open the device. Each
+		/// device name string uniquely identifies the device, so you can determine if a device is already open
+		/// by comparing devnameBuf with the string returned by GoIO_Sensor_GetOpenDeviceName() for each open
+		/// device handle.
+		/// </summary>
+		/// <param name="devnameBuf">[out] buffer to store device name string. Allocate this with a capacity of GoIO.MAX_SIZE_Sensor_NAME.</param>
+		/// <param name="bufSize">[in] Set this to the capacity of devnameBuf.</param>
+		/// <param name="vendorId">[in] USB vendor id</param>
+		/// <param name="productId">[in] USB product id</param>
+		/// <param name="N">[in] index into list of known devices, 0 => first device in list.</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_GetNthAvailableDeviceName", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+		public static extern Int32 GetNthAvailableDeviceName(
+			StringBuilder devnameBuf,
+			Int32 bufSize,
+			Int32 vendorId,
+			Int32 productId,
+			Int32 N);
+
+		/// <summary>
+		/// <para>
+		/// Open a specified Go! device with the name returned by GoIO_GetNthAvailableDeviceName.
+        /// If the device is already open, then this routine will fail.
+        /// </para>
+        /// <para>
+        /// In addition to establishing basic communication with the device, this routine will initialize the
+        /// device. Each GOIO_SENSOR_HANDLE sensor object has an associated DDS memory record. If the physical 
+        /// sensor being opened is a 'smart' sensor with its own physical DDS memory, then this routine will copy
+        /// the contents of the memory on the device to the sensor object's DDS memory record. If the physical 
+        /// sensor does not have DDS memory, then the associated DDS memory record is set to default values appropriate
+        /// for the type of sensor detected.
+        /// </para>
+        /// <para>
+        /// The following commands are sent to Go! Temp devices by GoIO_Sensor_Open():
+        /// </para>
+        /// <para>
+        /// SKIP_CMD_ID_INIT,
+        /// </para>
+        /// <para>
+        /// SKIP_CMD_ID_READ_LOCAL_NV_MEM. - read DDS record(same as GoIO_Sensor_DDSMem_ReadRecord()).
+        /// </para>
+        /// <para>
+        /// The following commands are sent to Go! Link and Vernier Mini GC devices by GoIO_Sensor_Open():
+        /// </para>
+        /// <para>
+        /// SKIP_CMD_ID_INIT,
+        /// </para>
+        /// <para>
+        /// SKIP_CMD_ID_GET_SENSOR_ID,
+        /// </para>
+        /// <para>
+        /// SKIP_CMD_ID_READ_REMOTE_NV_MEM, - read DDS record if this is a 'smart' sensor(same as GoIO_Sensor_DDSMem_ReadRecord()).
+        /// </para>
+        /// <para>
+        /// SKIP_CMD_ID_SET_ANALOG_INPUT_CHANNEL. - based on sensor EProbeType, which is either VSTSensorDDSMemRec.kProbeTypeAnalog5V
+        /// or kProbeTypeAnalog10V.
+        /// </para>
+        /// <para>
+        /// SKIP_CMD_ID_GET_SENSOR_ID is superfluous when sent to the Mini GC, but the Mini GC is implemented internally
+        /// as a Go! Link with a fixed sensor plugged in.
+        /// </para>
+        /// <para>
+        /// Only SKIP_CMD_ID_INIT is sent to Go! Motion by GoIO_Sensor_Open(). Go! Motion does not contain DDS memory, but this routine
+        /// initializes the sensor's associated DDS memory record with calibrations for both meters and feet.
+        /// </para>
+        /// <para>
+        /// Since the device stops sending measurements in response to SKIP_CMD_ID_INIT, an application must send
+        /// SKIP_CMD_ID_START_MEASUREMENTS to the device in order to receive measurements. See description of GoIO_Sensor_ReadRawMeasurements().
+        /// </para>
+        /// <para>
+        /// At any given time, a sensor is 'owned' by only one thread. The thread that calls this routine is the
+        /// initial owner of the sensor. If a GoIO() call is made from a thread that does not own the sensor object
+        /// that is passed in, then the call will generally fail. To allow another thread to access a sensor,
+        /// the owning thread should call GoIO_Sensor_Unlock(), and then the new thread must call GoIO_Sensor_Lock().
+        /// 
+		/// </para>
+		/// </summary>
+        /// <param name="deviceName">[in]name returned by GoIO_GetNthAvailableDeviceName()</param>
+		/// <param name="vendorId">[in] USB vendor id</param>
+		/// <param name="productId">[in] USB product id</param>
+		/// <param name="strictDDSValidationFlag">[in] insist on exactly valid checksum if 1, else use a more lax validation test.</param>
+		/// <returns>handle to open sensor device if successful, else NULL.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_Open", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+		public static extern IntPtr Sensor_Open(
+			String deviceName,
+			Int32 vendorId,
+			Int32 productId,
+			Int32 strictDDSValidationFlag);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_Close", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_Close(
+			IntPtr hSensor);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetOpenDeviceName", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+		public static extern Int32 Sensor_GetOpenDeviceName(
+			IntPtr hSensor,
+			StringBuilder devnameBuf,
+			Int32 bufSize,
+			out Int32 vendorId,
+			out Int32 productId);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_Lock", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_Lock(
+			IntPtr hSensor,
+			Int32 timeoutMs);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_Unlock", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_Unlock(
+			IntPtr hSensor);
+
+		/// <summary>
+		/// GoIO_Sensor_ClearIO()
+		/// </summary>
+		/// <param name="hSensor"></param>
+		/// <returns></returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_ClearIO", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_ClearIO(
+			IntPtr hSensor);
+
+		/// <summary>
+		/// GoIO_Sensor_SendCmdAndGetResponse() is a low level function that most .NET code should not use directly.
+		/// Use one of the GoIO_Sensor_SendCmdAndGetResponseN() helper functions instead.
+		/// </summary>
+		/// <param name="hSensor"></param>
+		/// <param name="cmd"></param>
+		/// <param name="parameters"></param>
+		/// <param name="nParamBytes"></param>
+		/// <param name="response"></param>
+		/// <param name="nRespBytes">size of of response buffer on input, # of bytes copied into response buffer on output</param>
+		/// <param name="timeoutMs"></param>
+		/// <returns>0 if successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_SendCmdAndGetResponse", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_SendCmdAndGetResponse(
+			IntPtr hSensor,
+			byte cmd,
+			IntPtr parameters,
+			UInt32 nParamBytes,
+			IntPtr response,
+			ref UInt32 nRespBytes,
+			Int32 timeoutMs);
+
+		/// <summary>
+		/// Send a command to the specified device hardware and wait for a response. 
+		/// <para>
+        /// The protocol that is used to communicate with the Go devices via the GoIO_Sensor_SendCmdAndGetResponse() function is documented in the
+        /// GoIO_ParmBlk class.
+		/// </para>
+		/// <para>
+		/// Note that GoIO_Sensor_SendCmdAndGetResponse() will fail if you send a CMD_ID_START_MEASUREMENTS
+		/// command while GoIO_Sensor_GetNumMeasurementsAvailable() says measurements are available. 
+		/// </para>
+		/// <para>
+		/// So...if you are restarting measurements, you should clear any old measurements in the GoIO Measurement 
+		/// Buffer first by reading in the measurements until the Buffer is empty, or you should call GoIO_Sensor_ClearIO().
+		/// </para>
+		/// <para>
+		/// Every command supported by GoIO_Sensor_SendCmdAndGetResponse() has an associated response. If no response
+		/// specific to a command is defined, then the format of the response is GoIODefaultCmdResponse. Some commands
+        /// have associated parameter blocks defined for them.  See GoIO_ParmBlk.
+		/// </para>
+		/// <para>
+		/// If GoIO_Sensor_SendCmdAndGetResponse() returns -1, additional information about a GoIO_Sensor_SendCmdAndGetResponse() 
+		/// error may be obtained by calling GoIO_Sensor_GetLastCmdResponseStatus().
+		/// </para>
+		/// </summary>
+		/// <param name="hSensor">[in] handle to open device.</param>
+		/// <param name="cmd">[in] command code.</param>
+		/// <param name="parameters">[in] cmd specific parameter block</param>
+		/// <param name="response">[out] response block</param>
+		/// <param name="nRespBytes">[out] num of bytes passed back in the response block. 
+		/// Caller does not need to initialize this with the size of response block(as unmanaged code does) because the dotNET
+		/// wrapper does so.
+		/// </param>
+		/// <param name="timeoutMs">[in] # of milliseconds to wait for a reply before giving up. Most devices should reply to 
+		/// almost all the currently defined commands within GoIO.TIMEOUT_MS_DEFAULT milliseconds. In fact, typical response
+		/// times are less than 50 milliseconds. </param>
+		/// <returns>0 if successful, else -1.</returns>
+		public static Int32 Sensor_SendCmdAndGetResponse1(
+			IntPtr hSensor,
+			byte cmd,
+			object parameters,
+			ref object response,
+			ref UInt32 nRespBytes,
+			Int32 timeoutMs)
+		{
+			IntPtr paramPtr = Marshal.AllocHGlobal(Marshal.SizeOf(parameters));
+			Marshal.StructureToPtr(parameters, paramPtr, true);
+			IntPtr responsePtr = Marshal.AllocHGlobal(Marshal.SizeOf(response));
+			nRespBytes = (UInt32)Marshal.SizeOf(response);
+			Int32 status = Sensor_SendCmdAndGetResponse(hSensor, cmd, paramPtr, (UInt32)Marshal.SizeOf(parameters),
+				responsePtr, ref nRespBytes, timeoutMs);
+			if (0 == status)
+				response = Marshal.PtrToStructure(responsePtr, response.GetType());
+			else if ((status < 0) && (1 == nRespBytes) && (1 == Marshal.SizeOf(response)))
+				response = Marshal.PtrToStructure(responsePtr, response.GetType());
+			Marshal.FreeHGlobal(responsePtr);
+			Marshal.FreeHGlobal(paramPtr);
+			return status;
+		}
+
+		/// <summary>
+		/// Sensor_SendCmdAndGetResponse2() is the same as Sensor_SendCmdAndGetResponse1() except that no response block is
+		/// returned by the function(even though some sort of response always comes back from the device unless there is a 
+		/// communication failure). This is reasonable if the caller only cares about when the function succeeds or fails, 
+		/// which can be determined from the return value.
+		/// </summary>
+		/// <param name="hSensor"></param>
+		/// <param name="cmd"></param>
+		/// <param name="parameters"></param>
+		/// <param name="timeoutMs"></param>
+		/// <returns>0 if successful, else -1.</returns>
+		public static Int32 Sensor_SendCmdAndGetResponse2(
+			IntPtr hSensor,
+			byte cmd,
+			object parameters,
+			Int32 timeoutMs)
+		{
+			UInt32 respLen = 0;
+			IntPtr paramPtr = Marshal.AllocHGlobal(Marshal.SizeOf(parameters));
+			Marshal.StructureToPtr(parameters, paramPtr, true);
+			Int32 status = Sensor_SendCmdAndGetResponse(hSensor, cmd, paramPtr, (UInt32)Marshal.SizeOf(parameters),
+				IntPtr.Zero, ref respLen, timeoutMs);
+			Marshal.FreeHGlobal(paramPtr);
+			return status;
+		}
+
+		/// <summary>
+		/// Sensor_SendCmdAndGetResponse3() is the same as Sensor_SendCmdAndGetResponse1() except that no parameter block is sent
+		/// to the device. That works fine for commands that do not require parameters.
+		/// </summary>
+		/// <param name="hSensor"></param>
+		/// <param name="cmd"></param>
+		/// <param name="response"></param>
+		/// <param name="nRespBytes"></param>
+		/// <param name="timeoutMs"></param>
+		/// <returns>0 if successful, else -1.</returns>
+		public static Int32 Sensor_SendCmdAndGetResponse3(
+			IntPtr hSensor,
+			byte cmd,
+			ref object response,
+			ref UInt32 nRespBytes,
+			Int32 timeoutMs)
+		{
+			IntPtr responsePtr = Marshal.AllocHGlobal(Marshal.SizeOf(response));
+			nRespBytes = (UInt32)Marshal.SizeOf(response);
+			Int32 status = Sensor_SendCmdAndGetResponse(hSensor, cmd, IntPtr.Zero, 0, responsePtr, ref nRespBytes, timeoutMs);
+			if (0 == status)
+				response = Marshal.PtrToStructure(responsePtr, response.GetType());
+			else if ((status < 0) && (1 == nRespBytes) && (1 == Marshal.SizeOf(response)))
+				response = Marshal.PtrToStructure(responsePtr, response.GetType());
+			Marshal.FreeHGlobal(responsePtr);
+			return status;
+		}
+
+		/// <summary>
+		/// Sensor_SendCmdAndGetResponse4() is the same as Sensor_SendCmdAndGetResponse1() except that no parameter block is sent
+		/// to the device and no response block is returned by the function. That works fine for commands that do not require 
+		/// parameters when the caller is only interested in success or failure.
+		/// 
+		/// </summary>
+		/// <param name="hSensor"></param>
+		/// <param name="cmd"></param>
+		/// <param name="timeoutMs"></param>
+		/// <returns>0 if successful, else -1.</returns>
+		public static Int32 Sensor_SendCmdAndGetResponse4(
+			IntPtr hSensor,
+			byte cmd,
+			Int32 timeoutMs)
+		{
+			UInt32 respLen = 0;
+			Int32 status = Sensor_SendCmdAndGetResponse(hSensor, cmd, IntPtr.Zero, 0, IntPtr.Zero, ref respLen, timeoutMs);
+			return status;
+		}
+
+        /// <summary>
+        /// GoIO_Sensor_GetLastCmdResponseStatus().
+        /// </summary>
+        /// <param name="hSensor">[in] handle to open sensor.</param>
+        /// <param name="LastCmd">[out] last cmd sent to the sensor.</param>
+        /// <param name="LastCmdStatus">[out] status of last command sent to the sensor.
+		/// <para>
+        /// If command ran successfully and the device reported good status, then this will be be GoIODefaultCmdResponse.STATUS_SUCCESS(aka 0).
+		/// </para>
+		/// <para>
+        /// If no response was reported back from the device, then this will be GoIODefaultCmdResponse.STATUS_ERROR_COMMUNICATION.
+		/// </para>
+		/// <para>
+        /// If the device reported a failure, then this will be a cmd specific error, eg GoIODefaultCmdResponse.STATUS_ERROR_...
+		/// </para>
+        /// </param>
+        /// <param name="LastCmdWithErrorRespSentOvertheWire">[out] last cmd sent that caused the device to report back an error.</param>
+        /// <param name="LastErrorSentOvertheWire">[out] last error that came back from the device 'over the wire'.</param>
+        /// <returns>0 if hSensor is valid, else -1</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetLastCmdResponseStatus", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_GetLastCmdResponseStatus(
+			IntPtr hSensor,
+			out byte LastCmd,
+			out byte LastCmdStatus,
+			out byte LastCmdWithErrorRespSentOvertheWire,
+			out byte LastErrorSentOvertheWire);
+
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetMeasurementTickInSeconds", CallingConvention = CallingConvention.Cdecl)]
+		public static extern double Sensor_GetMeasurementTickInSeconds(
+			IntPtr hSensor);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetMinimumMeasurementPeriod", CallingConvention = CallingConvention.Cdecl)]
+		public static extern double Sensor_GetMinimumMeasurementPeriod(
+			IntPtr hSensor);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetMaximumMeasurementPeriod", CallingConvention = CallingConvention.Cdecl)]
+		public static extern double Sensor_GetMaximumMeasurementPeriod(
+			IntPtr hSensor);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_SetMeasurementPeriod", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_SetMeasurementPeriod(
+			IntPtr hSensor,
+			Double desiredPeriod,
+			Int32 timeoutMs);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetMeasurementPeriod", CallingConvention = CallingConvention.Cdecl)]
+		public static extern double Sensor_GetMeasurementPeriod(
+			IntPtr hSensor,
+			Int32 timeoutMs);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetNumMeasurementsAvailable", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_GetNumMeasurementsAvailable(
+			IntPtr hSensor);
+
+		/// <summary>
+		/// GoIO_SetMeasurementQueueConfig() overflowPolicy parameter values.
+		/// </summary>
+		public const Int32 QUEUE_OVERFLOW_DROP_OLDEST = 0;
+		public const Int32 QUEUE_OVERFLOW_DROP_NEWEST = 1;
+		public const Int32 QUEUE_OVERFLOW_BLOCK_PRODUCER = 2;
+
+		/// <summary>
+		/// Configure the GoIO Measurement Buffer of a sensor before it is opened. Sensor_Open() applies the config
+		/// when deviceName is opened. If deviceName is null, the config becomes the default for devices that have not
+		/// been given a config of their own. Only Linux supports this; see GoIO_DLL_interface.h for the details.
+		/// </summary>
+		/// <param name="deviceName">[in] device name from GetNthAvailableDeviceName(), or null for all devices.</param>
+		/// <param name="capacity">[in] in packets. Each packet holds 1 to 3 measurements. The default is 1999.</param>
+		/// <param name="overflowPolicy">[in] GoIO.QUEUE_OVERFLOW_*.</param>
+		/// <param name="blockTimeoutMs">[in] only used by GoIO.QUEUE_OVERFLOW_BLOCK_PRODUCER.</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_SetMeasurementQueueConfig", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 SetMeasurementQueueConfig(
+			string deviceName,
+			Int32 capacity,
+			Int32 overflowPolicy,
+			Int32 blockTimeoutMs);
+
+		/// <summary>
+		/// Change the capacity and overflow policy of the GoIO Measurement Buffer of an open sensor, even while
+		/// measurements are being collected. If the buffer shrinks, the newest measurements are kept.
+		/// </summary>
+		/// <param name="hSensor">[in] handle to open sensor.</param>
+		/// <param name="capacity">[in] in packets.</param>
+		/// <param name="overflowPolicy">[in] GoIO.QUEUE_OVERFLOW_*.</param>
+		/// <param name="blockTimeoutMs">[in] only used by GoIO.QUEUE_OVERFLOW_BLOCK_PRODUCER.</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_SetMeasurementQueueConfig", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_SetMeasurementQueueConfig(
+			IntPtr hSensor,
+			Int32 capacity,
+			Int32 overflowPolicy,
+			Int32 blockTimeoutMs);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetMeasurementQueueConfig", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_GetMeasurementQueueConfig(
+			IntPtr hSensor,
+			out Int32 capacity,
+			out Int32 overflowPolicy,
+			out Int32 blockTimeoutMs);
+
+		/// <summary>
+		/// Let the GoIO Measurement Buffer overflow to disk. Once highWatermark packets are waiting in the buffer,
+		/// further packets are appended to fileName until the app has read all of them. Sensor_ReadRawMeasurements()
+		/// returns the spilled measurements in order. Only Linux supports this; see GoIO_DLL_interface.h for the details.
+		/// </summary>
+		/// <param name="hSensor">[in] handle to open sensor.</param>
+		/// <param name="fileName">[in] spill file name, or null to stop spilling.</param>
+		/// <param name="highWatermark">[in] in packets.</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_SetMeasurementSpillFile", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_SetMeasurementSpillFile(
+			IntPtr hSensor,
+			string fileName,
+			Int32 highWatermark);
+
+		/// <summary>
+		/// Record every measurement that arrives from the sensor to fileName, along with sample indices, arrival times,
+		/// lost measurement gaps and the sensor's DDS record. Measurements are still delivered as usual. A background
+		/// thread writes the file, and the measurements are compressed; see GoIO_DLL_interface.h for the details.
+		/// </summary>
+		/// <param name="hSensor">[in] handle to open sensor.</param>
+		/// <param name="fileName">[in] recording file name.</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Recorder_Start", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Recorder_Start(
+			IntPtr hSensor,
+			string fileName);
+
+		/// <summary>
+		/// GoIO_Recorder_StartEx() options flags.
+		/// </summary>
+		public const Int32 RECORDER_OPTION_COMPRESS = 1;
+		public const Int32 RECORDER_OPTION_CALIBRATED = 2;
+
+		/// <summary>
+		/// Same as Recorder_Start(), but with options. RECORDER_OPTION_COMPRESS delta encodes and bit packs the
+		/// measurements, and RECORDER_OPTION_CALIBRATED also stores XOR compressed calibrated values. Pass 0 to
+		/// record the raw measurements uncompressed.
+		/// </summary>
+		/// <param name="hSensor">[in] handle to open sensor.</param>
+		/// <param name="fileName">[in] recording file name.</param>
+		/// <param name="options">[in] GoIO.RECORDER_OPTION_* flags.</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Recorder_StartEx", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Recorder_StartEx(
+			IntPtr hSensor,
+			string fileName,
+			Int32 options);
+
+		/// <summary>
+		/// Finish the recording started by Recorder_Start() and close the file.
+		/// </summary>
+		/// <param name="hSensor">[in] handle to open sensor.</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Recorder_Stop", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Recorder_Stop(
+			IntPtr hSensor);
+
+		/// <summary>
+		/// Report on the recording started by Recorder_Start().
+		/// </summary>
+		/// <param name="hSensor">[in] handle to open sensor.</param>
+		/// <param name="samplesRecorded">[out] measurements handed to the background writer.</param>
+		/// <param name="samplesMissing">[out] measurements lost between the sensor and the computer.</param>
+		/// <param name="samplesLost">[out] measurements discarded by the recorder.</param>
+		/// <param name="bytesWritten">[out]</param>
+		/// <param name="writeFailed">[out] 1 if nothing further is being written because of a disk error.</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Recorder_GetStats", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Recorder_GetStats(
+			IntPtr hSensor,
+			out UInt64 samplesRecorded,
+			out UInt64 samplesMissing,
+			out UInt64 samplesLost,
+			out UInt64 bytesWritten,
+			out byte writeFailed);
+
+		/// <summary>
+		/// Default ring size for Sensor_StartPublishing().
+		/// </summary>
+		public const Int32 STREAM_DEFAULT_NUM_SLOTS = 65536;
+
+		/// <summary>
+		/// Publish every measurement that arrives from the sensor to a ring in named shared memory, with its sample index,
+		/// arrival time, voltage and calibrated value, so that other processes can follow the sensor with Stream_Open().
+		/// Readers never slow the publisher down; a reader that falls more than numSlots measurements behind loses the 
+		/// oldest ones. See GoIO_DLL_interface.h for the details.
+		/// </summary>
+		/// <param name="hSensor">[in] handle to open sensor.</param>
+		/// <param name="numSlots">[in] # of measurements the ring holds, rounded up to a power of 2. 0 means STREAM_DEFAULT_NUM_SLOTS.</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_StartPublishing", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_StartPublishing(
+			IntPtr hSensor,
+			Int32 numSlots);
+
+		/// <summary>
+		/// Stop publishing the measurements from the sensor.
+		/// </summary>
+		/// <param name="hSensor">[in] handle to open sensor.</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_StopPublishing", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_StopPublishing(
+			IntPtr hSensor);
+
+		/// <summary>
+		/// Attach to the measurements that some process is publishing for deviceName. The read position starts at the 
+		/// newest measurement, or at the oldest one still in the ring if fromOldest is 1. GoIO_Init() is not required.
+		/// </summary>
+		/// <param name="deviceName">[in] device name, as passed to Sensor_Open().</param>
+		/// <param name="fromOldest">[in]</param>
+		/// <returns>handle to the stream if successful, else IntPtr.Zero.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Stream_Open", CallingConvention = CallingConvention.Cdecl)]
+		public static extern IntPtr Stream_Open(
+			string deviceName,
+			byte fromOldest);
+
+		/// <summary>
+		/// Detach from the stream, and invalidate hStream.
+		/// </summary>
+		/// <param name="hStream">[in] handle from Stream_Open().</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Stream_Close", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Stream_Close(
+			IntPtr hStream);
+
+		/// <summary>
+		/// Copy up to maxCount measurements, oldest first, from the stream's read position, and advance it past them.
+		/// </summary>
+		/// <param name="hStream">[in] handle from Stream_Open().</param>
+		/// <param name="samples">[out] array with room for maxCount samples.</param>
+		/// <param name="maxCount">[in]</param>
+		/// <returns># of measurements copied, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Stream_Read", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Stream_Read(
+			IntPtr hStream,
+			[Out] GoIOStreamSample[] samples,
+			Int32 maxCount);
+
+		/// <summary>
+		/// Point samples at up to maxCount GoIOStreamSamples in the shared memory, from the stream's read position on, 
+		/// without copying them or advancing the read position. Call Stream_Consume() once done with them.
+		/// </summary>
+		/// <param name="hStream">[in] handle from Stream_Open().</param>
+		/// <param name="samples">[out] read only.</param>
+		/// <param name="maxCount">[in]</param>
+		/// <returns># of measurements at samples, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Stream_Peek", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Stream_Peek(
+			IntPtr hStream,
+			out IntPtr samples,
+			Int32 maxCount);
+
+		/// <summary>
+		/// Advance the stream's read position past count measurements returned by Stream_Peek().
+		/// </summary>
+		/// <param name="hStream">[in] handle from Stream_Open().</param>
+		/// <param name="count">[in]</param>
+		/// <returns># of the measurements, counting from the first one, that were overwritten meanwhile and must be 
+		/// discarded, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Stream_Consume", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Stream_Consume(
+			IntPtr hStream,
+			Int32 count);
+
+		/// <summary>
+		/// Report on the stream.
+		/// </summary>
+		/// <param name="hStream">[in] handle from Stream_Open().</param>
+		/// <param name="isPublishing">[out] 0 once the publisher stops.</param>
+		/// <param name="numAvailable">[out] measurements after the read position.</param>
+		/// <param name="samplesLost">[out] measurements overwritten before this handle read them.</param>
+		/// <param name="measurementPeriod">[out] in seconds, 0.0 if unknown.</param>
+		/// <param name="periodFirstSampleIndex">[out] measurementPeriod applies from this sample index on.</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Stream_GetStatus", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Stream_GetStatus(
+			IntPtr hStream,
+			out byte isPublishing,
+			out Int32 numAvailable,
+			out UInt64 samplesLost,
+			out double measurementPeriod,
+			out UInt64 periodFirstSampleIndex);
+
+		/// <summary>
+		/// Consumer policies for Sensor_AddConsumer().
+		/// </summary>
+		public const Int32 CONSUMER_POLICY_SKIP = 0;
+		public const Int32 CONSUMER_POLICY_BLOCK = 1;
+		/// <summary>
+		/// Default ring size for Sensor_AddConsumer().
+		/// </summary>
+		public const Int32 CONSUMER_DEFAULT_NUM_SLOTS = 65536;
+
+		/// <summary>
+		/// Register a consumer of the sensor's measurements within this process. Every consumer sees every measurement, 
+		/// at its own pace, from a single ring shared by all the consumers of the sensor. A CONSUMER_POLICY_SKIP consumer
+		/// that falls numSlots measurements behind loses the oldest ones; GoIO waits for a CONSUMER_POLICY_BLOCK consumer
+		/// instead, which holds up the sensor. Consumer handles may be used from any thread, one thread at a time.
+		/// See GoIO_DLL_interface.h for the details.
+		/// </summary>
+		/// <param name="hSensor">[in] handle to open sensor.</param>
+		/// <param name="policy">[in] CONSUMER_POLICY_*</param>
+		/// <param name="numSlots">[in] # of measurements the ring holds, rounded up to a power of 2. Only used by the first consumer. 0 means CONSUMER_DEFAULT_NUM_SLOTS.</param>
+		/// <returns>handle to the consumer if successful, else IntPtr.Zero.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_AddConsumer", CallingConvention = CallingConvention.Cdecl)]
+		public static extern IntPtr Sensor_AddConsumer(
+			IntPtr hSensor,
+			Int32 policy,
+			Int32 numSlots);
+
+		/// <summary>
+		/// Unregister a consumer, and invalidate hConsumer.
+		/// </summary>
+		/// <param name="hConsumer">[in] handle from Sensor_AddConsumer().</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Consumer_Remove", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Consumer_Remove(
+			IntPtr hConsumer);
+
+		/// <summary>
+		/// Copy up to maxCount raw measurements, oldest first, from the consumer's read position, and advance it past them.
+		/// </summary>
+		/// <param name="hConsumer">[in] handle from Sensor_AddConsumer().</param>
+		/// <param name="measurements">[out] array with room for maxCount measurements.</param>
+		/// <param name="timeStampsUs">[out] host arrival times in microseconds, may be null.</param>
+		/// <param name="maxCount">[in]</param>
+		/// <returns># of measurements copied, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Consumer_ReadRawMeasurements", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Consumer_ReadRawMeasurements(
+			IntPtr hConsumer,
+			[Out] Int32[] measurements,
+			[Out] UInt64[] timeStampsUs,
+			Int32 maxCount);
+
+		/// <summary>
+		/// Copy up to maxCount raw measurements, starting firstIndex measurements after the consumer's read position, 
+		/// without advancing it.
+		/// </summary>
+		/// <param name="hConsumer">[in] handle from Sensor_AddConsumer().</param>
+		/// <param name="measurements">[out] array with room for maxCount measurements.</param>
+		/// <param name="firstIndex">[in] 0 => the measurement at the read position.</param>
+		/// <param name="maxCount">[in]</param>
+		/// <returns># of measurements copied, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Consumer_PeekRawMeasurements", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Consumer_PeekRawMeasurements(
+			IntPtr hConsumer,
+			[Out] Int32[] measurements,
+			Int32 firstIndex,
+			Int32 maxCount);
+
+		/// <summary>
+		/// Report on the consumer, and on all the consumers of its sensor.
+		/// </summary>
+		/// <param name="hConsumer">[in] handle from Sensor_AddConsumer().</param>
+		/// <param name="status">[out]</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Consumer_GetStatus", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Consumer_GetStatus(
+			IntPtr hConsumer,
+			out GoIOConsumerStatus status);
+
+		/// <summary>
+		/// Zero copy alternative to Consumer_ReadRawMeasurements(): point measurements, and timeStampsUs, at the 
+		/// Int32 measurements and UInt64 arrival times after the consumer's read position, where GoIO keeps them, 
+		/// without copying them or advancing the read position. Access them in place with an unsafe pointer or
+		/// Marshal.ReadInt32(), and call Consumer_ReleaseMeasurements() once done with them. 
+		/// See GoIO_DLL_interface.h for the details.
+		/// </summary>
+		/// <param name="hConsumer">[in] handle from Sensor_AddConsumer().</param>
+		/// <param name="measurements">[out] read only, IntPtr.Zero if count is 0.</param>
+		/// <param name="count">[out] # of measurements at measurements.</param>
+		/// <param name="timeStampsUs">[out] host arrival times in microseconds, read only.</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Consumer_BorrowMeasurements", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Consumer_BorrowMeasurements(
+			IntPtr hConsumer,
+			out IntPtr measurements,
+			out Int32 count,
+			out IntPtr timeStampsUs);
+
+		/// <summary>
+		/// Advance the consumer's read position past count measurements returned by Consumer_BorrowMeasurements().
+		/// </summary>
+		/// <param name="hConsumer">[in] handle from Sensor_AddConsumer().</param>
+		/// <param name="count">[in]</param>
+		/// <returns># of the measurements, counting from the first one, that were overwritten meanwhile and must be 
+		/// discarded, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Consumer_ReleaseMeasurements", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Consumer_ReleaseMeasurements(
+			IntPtr hConsumer,
+			Int32 count);
+
+		/// <summary>
+		/// Same as Consumer_BorrowMeasurements(), using a CONSUMER_POLICY_SKIP consumer that the first call adds 
+		/// for the sensor. Call it once before starting measurements.
+		/// </summary>
+		/// <param name="hSensor">[in] handle to open sensor.</param>
+		/// <param name="measurements">[out] read only, IntPtr.Zero if count is 0.</param>
+		/// <param name="count">[out] # of measurements at measurements.</param>
+		/// <param name="timeStampsUs">[out] host arrival times in microseconds, read only.</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_BorrowMeasurements", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_BorrowMeasurements(
+			IntPtr hSensor,
+			out IntPtr measurements,
+			out Int32 count,
+			out IntPtr timeStampsUs);
+
+		/// <summary>
+		/// Same as Consumer_ReleaseMeasurements(), for measurements from Sensor_BorrowMeasurements().
+		/// </summary>
+		/// <param name="hSensor">[in] handle to open sensor.</param>
+		/// <param name="count">[in]</param>
+		/// <returns># of the measurements, counting from the first one, that were overwritten meanwhile and must be 
+		/// discarded, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_ReleaseMeasurements", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_ReleaseMeasurements(
+			IntPtr hSensor,
+			Int32 count);
+
+		/// <summary>
+		/// Retrieve measurements from the GoIO Measurement Buffer. The measurements reported
+		/// by this routine are actually removed from the GoIO Measurement Buffer.
+		/// <para>
+		/// After SKIP_CMD_ID_START_MEASUREMENTS has been sent to the sensor, the sensor starts
+		/// sending measurements to the host computer at the rate specified by GoIO_Sensor_SetMeasurementPeriod(). 
+		/// These measurements are stored in the GoIO Measurement Buffer. 
+		/// A separate GoIO Measurement Buffer is maintained for each open sensor. 
+		/// </para>
+		/// <para>
+		/// Note that for Go! Temp and Go! Link, raw measurements range from -32768 to 32767.
+		/// Go! Motion raw measurements are in microns and can range into the millions.
+		/// </para>
+		/// <para>
+		/// To convert a raw measurement to a voltage use GoIO_Sensor_ConvertToVoltage().
+		/// To convert a voltage to a sensor specific calibrated unit, use GoIO_Sensor_CalibrateData().
+		/// </para>
+		/// <para>
+		/// WARNING!!! IF YOU ARE COLLECTING MORE THAN 50 MEASUREMENTS A SECOND FROM GO! LINK,
+		/// READ THIS: The GoIO Measurement Buffer is packet oriented. If you are collecting 50 or
+		/// less measurements per second, then each packet contains only 1 measurement, and there is
+		/// no problem.
+		/// </para>
+		/// <para>
+		/// If you are collecting more than 50 measurements a second, then each packet may contain 2 
+		/// or 3 measurements. Depending on the exact measurement period, all the packets will 
+		/// contain 2, or all the packets will contain 3 measurements. IF THE LAST MEASUREMENT COPIED
+		/// INTO THE measurements ARRAY ARGUMENT IS NOT THE LAST MEASUREMENT IN ITS PACKET, THEN MEASUREMENTS WILL
+		/// BE LOST.
+		/// </para>
+		/// <para>
+		/// There are a couple of safe workarounds to this problem:
+		/// </para>
+		/// <para>
+		/// 1) Always set the maxCount parameter to a multiple of 6, or
+		/// </para>
+		/// <para>
+		/// 2) Always set the maxCount parameter to GoIO_Sensor_GetNumMeasurementsAvailable().		
+		/// </para>
+		/// <para>
+		/// </para>
+		/// </summary>
+		/// <param name="hSensor">[in] Handle to open device.</param>
+		/// <param name="measurements">[out]Loc to store measurements.</param>
+		/// <param name="maxCount">Maximum number of measurements to copy to measurements array. The measurements 
+		/// array passed in must be allocated with a length of at least maxCount elements.
+		/// If you are taking measurements faster than 50 hertz from GoLink, then you MUST set maxCount to either a multiple of
+		/// 6, or to the value returned by GoIO_Sensor_GetNumMeasurementsAvailable().</param>
+		/// <returns>Number of measurements retrieved from the GoIO Measurement Buffer. This routine returns 
+		/// immediately, so the return value may be less than maxCount. Return value less than 0 implies error.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_ReadRawMeasurements", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_ReadRawMeasurements(
+			IntPtr hSensor,
+			Int32[] measurements,
+			UInt32 maxCount);
+
+		/// <summary>
+		/// Report the most recent measurement put in the GoIO Measurement Buffer. If no 
+		/// measurements have been placed in the GoIO Measurement Buffer since it was
+		/// created byGoIO_Sensor_Open(), then report a value of 0. 
+		/// <para>
+		/// This routine leaves the GoIO Measurement Buffer untouched. The most recent measurement is recorded
+		/// as it arrives, so this routine is cheap enough to call as often as a display needs refreshing.
+		/// Call GoIO_Sensor_GetLatestRawMeasurementEx() to empty the GoIO Measurement Buffer as well.
+		/// </para>
+		/// <para>
+		/// After SKIP_CMD_ID_START_MEASUREMENTS has been sent to the sensor, the sensor starts
+		/// sending measurements to the host computer. These measurements are stored in the 
+		/// GoIO Measurement Buffer. A separate GoIO Measurement Buffer is maintained for each
+		/// open sensor. See the description of GoIO_Sensor_GetNumMeasurementsAvailable().
+		/// </para>
+		/// <para>
+		/// Note that for Go! Temp and Go! Link, raw measurements range from -32768 to 32767.
+		/// Go! Motion raw measurements are in microns and can range into the millions.
+		/// </para>
+		/// <para>
+		/// To convert a raw measurement to a voltage use GoIO_Sensor_ConvertToVoltage().
+		/// To convert a voltage to a sensor specific calibrated unit, use GoIO_Sensor_CalibrateData().
+		/// </para>
+		/// </summary>
+		/// <param name="hSensor"></param>
+		/// <returns>most recent measurement put in the GoIO Measurement Buffer. If no 
+		/// measurements have been placed in the GoIO Measurement Buffer since it was
+		/// created byGoIO_Sensor_Open(), then report a value of 0.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetLatestRawMeasurement", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_GetLatestRawMeasurement(
+			IntPtr hSensor);
+
+		/// <summary>
+		/// Same as GoIO_Sensor_GetLatestRawMeasurement(), but also report when the most recent measurement arrived,
+		/// and optionally empty the GoIO Measurement Buffer.
+		/// <para>
+		/// The timestamp is the host's millisecond tick count at the moment the packet containing the measurement
+		/// was received. It wraps around, and only differences between timestamps are meaningful.
+		/// </para>
+		/// </summary>
+		/// <param name="hSensor">[in] Handle to open device.</param>
+		/// <param name="measurement">[out] Most recent measurement, 0 if none have arrived since GoIO_Sensor_Open().</param>
+		/// <param name="timeStampMs">[out] Host time in milliseconds when the measurement arrived.</param>
+		/// <param name="drainBuffer">[in] If non zero, empty the GoIO Measurement Buffer as well.</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetLatestRawMeasurementEx", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_GetLatestRawMeasurementEx(
+			IntPtr hSensor,
+			out Int32 measurement,
+			out UInt32 timeStampMs,
+			byte drainBuffer);
+
+		/// <summary>
+		/// Signature of the routine passed to Sensor_SetMeasurementCallback().
+		/// measurements points to numMeasurements raw measurements, oldest first. Use Marshal.Copy() to
+		/// copy them out; the memory is only valid for the duration of the call.
+		/// </summary>
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		public delegate void MeasurementCallback(
+			IntPtr hSensor,
+			IntPtr context,
+			IntPtr measurements,
+			Int32 numMeasurements);
+
+		/// <summary>
+		/// Switch a sensor between queued mode and push mode. If callback is not null, measurements are decoded as
+		/// they arrive and passed to callback in batches instead of being stored in the GoIO Measurement Buffer.
+		/// <para>
+		/// callback runs on an internal GoIO thread. Calls for a given sensor never overlap.
+		/// A batch is delivered once it holds minBatchSize measurements, or once its oldest measurement is
+		/// maxLatencyMs old.
+		/// </para>
+		/// <para>
+		/// The caller must keep a reference to the callback delegate until push mode is turned off, otherwise
+		/// the garbage collector may free it while GoIO is still using it.
+		/// Pass null to return to queued mode. See GoIO_DLL_interface.h for details.
+		/// </para>
+		/// </summary>
+		/// <param name="hSensor">[in] Handle to open device.</param>
+		/// <param name="callback">[in] Routine to receive measurements, or null for queued mode.</param>
+		/// <param name="context">[in] Passed to callback unchanged.</param>
+		/// <param name="minBatchSize">[in] Deliver a batch once it holds this many measurements.</param>
+		/// <param name="maxLatencyMs">[in] Deliver a partial batch once its oldest measurement is this old.</param>
+		/// <returns>0 iff successful, else -1.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_SetMeasurementCallback", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_SetMeasurementCallback(
+			IntPtr hSensor,
+			MeasurementCallback callback,
+			IntPtr context,
+			Int32 minBatchSize,
+			Int32 maxLatencyMs);
+
+		/// <summary>
+		/// Block until the GoIO Measurement Buffer holds at least minCount measurements, or until timeoutMs
+		/// milliseconds have elapsed. The calling thread sleeps until enough measurements arrive, so this is much
+		/// cheaper than calling Sensor_GetNumMeasurementsAvailable() in a loop.
+		/// </summary>
+		/// <param name="hSensor">[in] Handle to open device.</param>
+		/// <param name="minCount">[in] Number of measurements to wait for.</param>
+		/// <param name="timeoutMs">[in] Number of milliseconds to wait before giving up.</param>
+		/// <returns>Number of measurements in the GoIO Measurement Buffer. If this is less than minCount, the wait timed out.
+		/// -1 if hSensor is not valid.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_WaitForMeasurements", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_WaitForMeasurements(
+			IntPtr hSensor,
+			Int32 minCount,
+			Int32 timeoutMs);
+
+		/// <summary>
+		/// Block until at least one of the specified sensors has minCount or more measurements in its GoIO Measurement
+		/// Buffer, or until timeoutMs milliseconds have elapsed.
+		/// </summary>
+		/// <param name="sensors">[in] Handles to open devices.</param>
+		/// <param name="numSensors">[in] Number of handles in sensors.</param>
+		/// <param name="minCount">[in] Number of measurements to wait for.</param>
+		/// <param name="timeoutMs">[in] Number of milliseconds to wait before giving up.</param>
+		/// <returns>Index into sensors of a ready sensor, or -1 if the wait timed out or a handle is not valid.</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_WaitAny", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 WaitAny(
+			IntPtr[] sensors,
+			Int32 numSensors,
+			Int32 minCount,
+			Int32 timeoutMs);
+
+		/// <summary>
+		/// Convert a raw measurement integer value into a real voltage value.
+		/// Depending on the type of sensor(see GoIO_Sensor_GetProbeType()), the voltage
+		/// may range from 0.0 to 5.0, or from -10.0 to 10.0 . For Go! Motion, voltage returned is simply distance
+		/// in meters.
+		/// </summary>
+		/// <param name="hSensor"></param>
+		/// <param name="rawMeasurement"></param>
+		/// <returns></returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_ConvertToVoltage", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Double Sensor_ConvertToVoltage(
+			IntPtr hSensor,
+			Int32 rawMeasurement);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_CalibrateData", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Double Sensor_CalibrateData(
+			IntPtr hSensor,
+			Double volts);
+
+		/// <summary>
+		/// GoIO_Sensor_GetProbeType()
+		/// </summary>
+		/// <param name="hSensor"></param>
+		/// <returns>VSTSensorDDSMemRec.kProbeType...</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_GetProbeType", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_GetProbeType(
+			IntPtr hSensor);
+
+		/// <summary>
+		/// GoIO_Sensor_DDSMem_ReadRecord().
+        /// Read VSTSensorDDSMemRec from nonvolatile memory on the sensor into the local computer memory record associated with hSensor. This routine only
+        /// works on 'smart' sensors. If GoIO_Sensor_DDSMem_ReadRecord() succeeds, then individual fields in the DDS record can be retrieved using
+        /// the other GoIO_Sensor_DDSMem_Get... routines.
+        /// </summary>
+		/// <param name="hSensor"></param>
+		/// <param name="strictDDSValidationFlag">insist on exactly valid checksum if 1, else use a more lax validation test.</param>
+		/// <param name="timeoutMs">READ_DDSMEMBLOCK_TIMEOUT_MS is recommended.</param>
+		/// <returns>0 iff successful, else -1</returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_ReadRecord", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_ReadRecord(
+			IntPtr hSensor,
+			byte strictDDSValidationFlag,
+			Int32 timeoutMs);
+
+        /// <summary>
+        /// GoIO_Sensor_DDSMem_WriteRecord().
+        /// <para>
+        /// Write the data currently stored in the local computer memory copy of the VSTSensorDDSMemRec to the nonvolatile memory
+        /// physically located on the 'smart' sensor. The local computer copy of the VSTSensorDDSMemRec is usually initialized with a call to
+        /// GoIO_Sensor_DDSMem_ReadRecord() followed by calls to the GoIO_Sensor_DDSMem_Set... routines.
+        /// </para>
+        /// <para>
+        /// WARNING: Be careful about using this routine. Changing a smart sensor's DDS memory can cause the sensor
+        /// to stop working with Logger Pro.
+        /// </para>
+        /// </summary>
+        /// <param name="hSensor"></param>
+        /// <param name="timeoutMs">WRITE_DDSMEMBLOCK_TIMEOUT_MS is recommended.</param>
+        /// <returns>0 iff successful, else -1</returns>
+        [DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_WriteRecord", CallingConvention = CallingConvention.Cdecl)]
+        public static extern Int32 Sensor_DDSMem_WriteRecord(
+            IntPtr hSensor,
+            Int32 timeoutMs);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetRecord", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetRecord(
+			IntPtr hSensor,
+			ref VSTSensorDDSMemRec rec);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetRecord", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetRecord(
+			IntPtr hSensor,
+			out VSTSensorDDSMemRec rec);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_ClearRecord", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_ClearRecord(
+			IntPtr hSensor);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_CalculateChecksum", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_CalculateChecksum(
+			IntPtr hSensor,
+			out byte checksum);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetMemMapVersion", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetMemMapVersion(
+			IntPtr hSensor,
+			byte MemMapVersion);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetMemMapVersion", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetMemMapVersion(
+			IntPtr hSensor,
+			out byte MemMapVersion);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetSensorNumber", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetSensorNumber(
+			IntPtr hSensor,
+			byte SensorNumber);
+
+		/// <summary>
+		/// GoIO_Sensor_DDSMem_GetSensorNumber().
+        /// Retrieve the sensor number that identifies the sensor. In general, the combination of sensor number and probe type uniquely identify
+        /// the type of sensor. As it happens, when using Go interfaces, the sensor number provides enough info to uniquely id a sensor.
+        /// <para>
+        /// A reported SensorNumber == 0 indicates that no sensor is plugged into the interface.
+        /// </para>
+        /// </summary>
+		/// <param name="hSensor"></param>
+		/// <param name="SensorNumber"></param>
+		/// <param name="sendQueryToHardwareflag">
+        /// If sendQueryToHardwareflag != 0, then send a CMD_ID_GET_SENSOR_ID to the sensor hardware. The sensor number is returned from the hardware
+        /// and stored in the local computer VSTSensorDDSMemRec.SensorNumber field associated with hSensor. This updated sensor number value is also
+        /// written to the SensorNumber output.
+        /// </param>
+        /// <param name="timeoutMs"># of milliseconds to wait for a reply before giving up. GoIO.TIMEOUT_MS_DEFAULT is recommended.</param>
+		/// <returns></returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetSensorNumber", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetSensorNumber(
+			IntPtr hSensor,
+			out byte SensorNumber,
+			Int32 sendQueryToHardwareflag,
+			Int32 timeoutMs);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetSerialNumber", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetSerialNumber(
+			IntPtr hSensor,
+			byte leastSigByte_SerialNumber,
+			byte midSigByte_SerialNumber,
+			byte mostSigByte_SerialNumber);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetSerialNumber", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetSerialNumber(
+			IntPtr hSensor,
+			out byte leastSigByte_SerialNumber,
+			out byte midSigByte_SerialNumber,
+			out byte mostSigByte_SerialNumber);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetLotCode", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetLotCode(
+			IntPtr hSensor,
+			byte YY_BCD,
+			byte WW_BCD);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetLotCode", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetLotCode(
+			IntPtr hSensor,
+			out byte YY_BCD,
+			out byte WW_BCD);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetManufacturerID", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetManufacturerID(
+			IntPtr hSensor,
+			byte ManufacturerID);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetManufacturerID", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetManufacturerID(
+			IntPtr hSensor,
+			out byte ManufacturerID);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetLongName", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+		public static extern IntPtr Sensor_DDSMem_SetLongName(
+			IntPtr hSensor,
+			String longName);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetLongName", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+		public static extern IntPtr Sensor_DDSMem_GetLongName(
+			IntPtr hSensor,
+			StringBuilder longName,
+			UInt16 maxNumBytesToCopy);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetShortName", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+		public static extern IntPtr Sensor_DDSMem_SetShortName(
+			IntPtr hSensor,
+			String shortName);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetShortName", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+		public static extern IntPtr Sensor_DDSMem_GetShortName(
+			IntPtr hSensor,
+			StringBuilder shortName,
+			UInt16 maxNumBytesToCopy);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetUncertainty", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetUncertainty(
+			IntPtr hSensor,
+			byte Uncertainty);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetUncertainty", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetUncertainty(
+			IntPtr hSensor,
+			out byte Uncertainty);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetSignificantFigures", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetSignificantFigures(
+			IntPtr hSensor,
+			byte SignificantFigures);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetSignificantFigures", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetSignificantFigures(
+			IntPtr hSensor,
+			out byte SignificantFigures);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetCurrentRequirement", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetCurrentRequirement(
+			IntPtr hSensor,
+			byte CurrentRequirement);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetCurrentRequirement", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetCurrentRequirement(
+			IntPtr hSensor,
+			out byte CurrentRequirement);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetAveraging", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetAveraging(
+			IntPtr hSensor,
+			byte Averaging);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetAveraging", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetAveraging(
+			IntPtr hSensor,
+			out byte Averaging);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetMinSamplePeriod", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetMinSamplePeriod(
+			IntPtr hSensor,
+			Single MinSamplePeriod);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetMinSamplePeriod", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetMinSamplePeriod(
+			IntPtr hSensor,
+			out Single MinSamplePeriod);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetTypSamplePeriod", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetTypSamplePeriod(
+			IntPtr hSensor,
+			Single TypSamplePeriod);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetTypSamplePeriod", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetTypSamplePeriod(
+			IntPtr hSensor,
+			out Single TypSamplePeriod);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetTypNumberofSamples", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetTypNumberofSamples(
+			IntPtr hSensor,
+			UInt16 TypNumberofSamples);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetTypNumberofSamples", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetTypNumberofSamples(
+			IntPtr hSensor,
+			out UInt16 TypNumberofSamples);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetWarmUpTime", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetWarmUpTime(
+			IntPtr hSensor,
+			UInt16 WarmUpTime);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetWarmUpTime", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetWarmUpTime(
+			IntPtr hSensor,
+			out UInt16 WarmUpTime);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetExperimentType", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetExperimentType(
+			IntPtr hSensor,
+			byte ExperimentType);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetExperimentType", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetExperimentType(
+			IntPtr hSensor,
+			out byte ExperimentType);
+
+		/// <summary>
+		/// GoIO_Sensor_DDSMem_SetOperationType() can change the probe type. See GoIO_Sensor_GetProbeType().
+		/// </summary>
+		/// <param name="hSensor"></param>
+		/// <param name="OperationType"></param>
+		/// <returns></returns>
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetOperationType", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetOperationType(
+			IntPtr hSensor,
+			byte OperationType);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetOperationType", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetOperationType(
+			IntPtr hSensor,
+			out byte OperationType);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetCalibrationEquation", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetCalibrationEquation(
+			IntPtr hSensor,
+			sbyte CalibrationEquation);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetCalibrationEquation", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetCalibrationEquation(
+			IntPtr hSensor,
+			out sbyte CalibrationEquation);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetYminValue", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetYminValue(
+			IntPtr hSensor,
+			Single YminValue);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetYminValue", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetYminValue(
+			IntPtr hSensor,
+			out Single YminValue);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetYmaxValue", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetYmaxValue(
+			IntPtr hSensor,
+			Single YmaxValue);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetYmaxValue", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetYmaxValue(
+			IntPtr hSensor,
+			out Single YmaxValue);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetYscale", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetYscale(
+			IntPtr hSensor,
+			byte Yscale);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetYscale", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetYscale(
+			IntPtr hSensor,
+			out byte Yscale);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetHighestValidCalPageIndex", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetHighestValidCalPageIndex(
+			IntPtr hSensor,
+			byte HighestValidCalPageIndex);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetHighestValidCalPageIndex", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetHighestValidCalPageIndex(
+			IntPtr hSensor,
+			out byte HighestValidCalPageIndex);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetActiveCalPage", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetActiveCalPage(
+			IntPtr hSensor,
+			byte ActiveCalPage);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetActiveCalPage", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetActiveCalPage(
+			IntPtr hSensor,
+			out byte ActiveCalPage);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetCalPage", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+		public static extern Int32 Sensor_DDSMem_SetCalPage(
+			IntPtr hSensor,
+			byte CalPageIndex,
+			float CalibrationCoefficientA,
+			float CalibrationCoefficientB,
+			float CalibrationCoefficientC,
+			String units);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetCalPage", CallingConvention = CallingConvention.Cdecl, CharSet = CharSet.Ansi)]
+		public static extern Int32 Sensor_DDSMem_GetCalPage(
+			IntPtr hSensor,
+			byte CalPageIndex,
+			out float CalibrationCoefficientA,
+			out float CalibrationCoefficientB,
+			out float CalibrationCoefficientC,
+			StringBuilder units,
+			UInt16 maxNumBytesToCopy);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_SetChecksum", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_SetChecksum(
+			IntPtr hSensor,
+			byte Checksum);
+
+		[DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Sensor_DDSMem_GetChecksum", CallingConvention = CallingConvention.Cdecl)]
+		public static extern Int32 Sensor_DDSMem_GetChecksum(
+			IntPtr hSensor,
+			byte Checksum);
+
+        /// <summary>
+        /// GoIO_Diags_SetDebugTraceThreshold().
+        /// </summary>
+        /// <param name="threshold">Only trace messages marked with a severity >= threshold(GoIO.TRACE_SEVERITY_) are actually sent to the debug output.</param>
+        /// <returns></returns>
+        [DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Diags_SetDebugTraceThreshold", CallingConvention = CallingConvention.Cdecl)]
+        public static extern Int32 Diags_SetDebugTraceThreshold(
+            Int32 threshold);
+
+        [DllImport("GoIO_DLL.dll", EntryPoint = "GoIO_Diags_GetDebugTraceThreshold", CallingConvention = CallingConvention.Cdecl)]
+        public static extern Int32 Diags_GetDebugTraceThreshold(
+            out Int32 threshold);
+	}
+
+	/// <summary>
+	/// One published measurement, as returned by GoIO.Stream_Read() and GoIO.Stream_Peek().
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	public struct GoIOStreamSample
+	{
+		public UInt64 sampleIndex;
+		public UInt64 timeUs;
+		public double calibrated;
+		public Int32 rawMeasurement;
+		public float volts;
+	}
+
+	/// <summary>
+	/// Consumer report, as returned by GoIO.Consumer_GetStatus().
+	/// </summary>
+	[StructLayout(LayoutKind.Sequential)]
+	public struct GoIOConsumerStatus
+	{
+		public UInt64 numLost;
+		public UInt64 numWritten;
+		public UInt64 blockedUs;
+		public UInt64 numBlockTimeouts;
+		public Int32 numAvailable;
+		public Int32 numConsumers;
+		public UInt32 slowestLag;
+		public UInt32 maxSlowestLag;
+		public Int32 isSensorOpen;
+		public Int32 reserved;
+	}
+}